@@ -0,0 +1,384 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/build/common.cmake"
+  "/root/repo/external/CMakeLists.txt"
+  "/root/repo/external/boringssl/CMakeLists.txt"
+  "/root/repo/external/googletest/CMakeLists.txt"
+  "/root/repo/external/googletest/cmake/internal_utils.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/appentry/CMakeLists.txt"
+  "/root/repo/src/ccdl/CMakeLists.txt"
+  "/root/repo/src/libcore/CMakeLists.txt"
+  "/root/repo/src/libcore/inc/CMakeLists.txt"
+  "/root/repo/src/libcore/inc/ccm/CMakeLists.txt"
+  "/root/repo/src/libcore/inc/ccm/core/CMakeLists.txt"
+  "/root/repo/src/libcore/inc/ccm/io/CMakeLists.txt"
+  "/root/repo/src/libcore/inc/ccm/math/CMakeLists.txt"
+  "/root/repo/src/libcore/inc/ccm/text/CMakeLists.txt"
+  "/root/repo/src/libcore/inc/ccm/util/CMakeLists.txt"
+  "/root/repo/src/libcore/inc/libcore/CMakeLists.txt"
+  "/root/repo/src/libcore/inc/libcore/util/CMakeLists.txt"
+  "/root/repo/src/libcore/src/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/core/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/io/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/io/ch/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/io/charset/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/math/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/misc/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/security/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/text/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/util/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/util/calendar/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/util/concurrent/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/util/locale/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccm/util/regex/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccmrt/CMakeLists.txt"
+  "/root/repo/src/libcore/src/ccmrt/system/CMakeLists.txt"
+  "/root/repo/src/libcore/src/libcore/CMakeLists.txt"
+  "/root/repo/src/libcore/src/libcore/icu/CMakeLists.txt"
+  "/root/repo/src/libcore/src/libcore/io/CMakeLists.txt"
+  "/root/repo/src/libcore/src/libcore/math/CMakeLists.txt"
+  "/root/repo/src/libcore/src/libcore/util/CMakeLists.txt"
+  "/root/repo/src/libcore/src/pisces/CMakeLists.txt"
+  "/root/repo/src/libcore/src/pisces/system/CMakeLists.txt"
+  "/root/repo/src/runtime/CMakeLists.txt"
+  "/root/repo/src/runtime/cdl/CMakeLists.txt"
+  "/root/repo/src/runtime/component/CMakeLists.txt"
+  "/root/repo/src/runtime/reflection/CMakeLists.txt"
+  "/root/repo/src/runtime/rpc/CMakeLists.txt"
+  "/root/repo/src/runtime/rpc/dbus/CMakeLists.txt"
+  "/root/repo/src/runtime/rpc/socket/CMakeLists.txt"
+  "/root/repo/src/runtime/type/CMakeLists.txt"
+  "/root/repo/src/runtime/util/CMakeLists.txt"
+  "/root/repo/src/sample/CMakeLists.txt"
+  "/root/repo/src/sample/client/CMakeLists.txt"
+  "/root/repo/src/sample/component/CMakeLists.txt"
+  "/root/repo/src/servicemanager/CMakeLists.txt"
+  "/root/repo/src/servicemanager/exe/CMakeLists.txt"
+  "/root/repo/src/servicemanager/lib/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/appentry/CMakeLists.txt"
+  "/root/repo/test/libcore/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/core/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/core/boxing/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/core/string/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/core/thread/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/core/thread/client/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/io/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/io/charset/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/io/charset/charset/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/io/file/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/io/fileinputstream/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/math/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/math/bigdecimal/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/math/biginteger/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/text/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/text/attributedstring/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/arraylist/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/calendar/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/concurrent/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/concurrent/concurrenthashmap/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/concurrent/concurrentlinkedqueue/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/date/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/formatter/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/hashmap/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/hashtable/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/locale/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/random/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/stringtokenizer/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/treemap/CMakeLists.txt"
+  "/root/repo/test/libcore/ccm/util/vector/CMakeLists.txt"
+  "/root/repo/test/libcore/libcore/CMakeLists.txt"
+  "/root/repo/test/libcore/libcore/util/CMakeLists.txt"
+  "/root/repo/test/libcore/libcore/util/zoneinfo/CMakeLists.txt"
+  "/root/repo/test/libtest/CMakeLists.txt"
+  "/root/repo/test/runtime/CMakeLists.txt"
+  "/root/repo/test/runtime/array/CMakeLists.txt"
+  "/root/repo/test/runtime/autoptr/CMakeLists.txt"
+  "/root/repo/test/runtime/char/CMakeLists.txt"
+  "/root/repo/test/runtime/hash/CMakeLists.txt"
+  "/root/repo/test/runtime/localstaticvariable/CMakeLists.txt"
+  "/root/repo/test/runtime/macro/CMakeLists.txt"
+  "/root/repo/test/runtime/nestedinterface/CMakeLists.txt"
+  "/root/repo/test/runtime/newobject/CMakeLists.txt"
+  "/root/repo/test/runtime/newobject/client/CMakeLists.txt"
+  "/root/repo/test/runtime/newobject/component/CMakeLists.txt"
+  "/root/repo/test/runtime/outreferencetype/CMakeLists.txt"
+  "/root/repo/test/runtime/probe/CMakeLists.txt"
+  "/root/repo/test/runtime/refcount/CMakeLists.txt"
+  "/root/repo/test/runtime/reflection/CMakeLists.txt"
+  "/root/repo/test/runtime/reflection/client/CMakeLists.txt"
+  "/root/repo/test/runtime/reflection/component/CMakeLists.txt"
+  "/root/repo/test/runtime/rpc/CMakeLists.txt"
+  "/root/repo/test/runtime/rpc/client/CMakeLists.txt"
+  "/root/repo/test/runtime/rpc/component/CMakeLists.txt"
+  "/root/repo/test/runtime/rpc/service/CMakeLists.txt"
+  "/root/repo/test/runtime/startup/CMakeLists.txt"
+  "/root/repo/test/runtime/stringpool/CMakeLists.txt"
+  "/root/repo/test/runtime/utf8/CMakeLists.txt"
+  "/root/repo/test/support/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/boringssl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ccdl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/runtime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/runtime/cdl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/runtime/component/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/runtime/reflection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/runtime/rpc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/runtime/rpc/dbus/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/runtime/rpc/socket/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/runtime/type/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/runtime/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/inc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/inc/ccm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/inc/ccm/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/inc/ccm/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/inc/ccm/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/inc/ccm/text/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/inc/ccm/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/inc/libcore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/inc/libcore/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/io/ch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/io/charset/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/misc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/security/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/text/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/util/calendar/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/util/concurrent/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/util/locale/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccm/util/regex/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccmrt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/ccmrt/system/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/libcore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/libcore/icu/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/libcore/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/libcore/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/libcore/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/pisces/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libcore/src/pisces/system/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/appentry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/servicemanager/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/servicemanager/exe/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/servicemanager/lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sample/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sample/component/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sample/client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/appentry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/support/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/array/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/autoptr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/char/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/hash/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/localstaticvariable/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/macro/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/nestedinterface/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/newobject/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/newobject/component/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/newobject/client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/outreferencetype/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/probe/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/refcount/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/reflection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/reflection/component/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/reflection/client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/rpc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/rpc/component/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/rpc/client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/rpc/service/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/startup/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/stringpool/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runtime/utf8/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/core/boxing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/core/string/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/core/thread/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/core/thread/client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/io/file/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/io/fileinputstream/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/io/charset/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/io/charset/charset/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/math/bigdecimal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/math/biginteger/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/text/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/text/attributedstring/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/arraylist/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/calendar/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/date/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/formatter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/hashmap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/hashtable/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/locale/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/random/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/stringtokenizer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/treemap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/vector/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/concurrent/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/concurrent/concurrenthashmap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/ccm/util/concurrent/concurrentlinkedqueue/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/libcore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/libcore/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/libcore/libcore/util/zoneinfo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "external/boringssl/CMakeFiles/deploy_boringssl_libraries.dir/DependInfo.cmake"
+  "external/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "external/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "src/ccdl/CMakeFiles/ccdl.dir/DependInfo.cmake"
+  "src/runtime/CMakeFiles/ccmrt.dir/DependInfo.cmake"
+  "src/runtime/cdl/CMakeFiles/cdl.dir/DependInfo.cmake"
+  "src/runtime/component/CMakeFiles/component.dir/DependInfo.cmake"
+  "src/runtime/reflection/CMakeFiles/reflection.dir/DependInfo.cmake"
+  "src/runtime/rpc/CMakeFiles/rpc.dir/DependInfo.cmake"
+  "src/runtime/rpc/dbus/CMakeFiles/rpc-dbus.dir/DependInfo.cmake"
+  "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/DependInfo.cmake"
+  "src/runtime/type/CMakeFiles/type.dir/DependInfo.cmake"
+  "src/runtime/util/CMakeFiles/util.dir/DependInfo.cmake"
+  "src/libcore/inc/CMakeFiles/deploy_libcore_headers.dir/DependInfo.cmake"
+  "src/libcore/inc/ccm/core/CMakeFiles/deploy_libcore_core_headers.dir/DependInfo.cmake"
+  "src/libcore/inc/ccm/io/CMakeFiles/deploy_libcore_io_headers.dir/DependInfo.cmake"
+  "src/libcore/inc/ccm/math/CMakeFiles/deploy_libcore_math_headers.dir/DependInfo.cmake"
+  "src/libcore/inc/ccm/text/CMakeFiles/deploy_libcore_text_headers.dir/DependInfo.cmake"
+  "src/libcore/inc/ccm/util/CMakeFiles/deploy_libcore_util_headers.dir/DependInfo.cmake"
+  "src/libcore/inc/libcore/util/CMakeFiles/deploy_libcore_libcore_util_headers.dir/DependInfo.cmake"
+  "src/libcore/src/CMakeFiles/build_libcore.dir/DependInfo.cmake"
+  "src/libcore/src/CMakeFiles/libcore.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/io/ch/CMakeFiles/ccm_io_ch.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/DependInfo.cmake"
+  "src/libcore/src/ccm/util/regex/CMakeFiles/ccm_util_regex.dir/DependInfo.cmake"
+  "src/libcore/src/ccmrt/system/CMakeFiles/ccmrt_system.dir/DependInfo.cmake"
+  "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/DependInfo.cmake"
+  "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/DependInfo.cmake"
+  "src/libcore/src/libcore/math/CMakeFiles/libcore_math.dir/DependInfo.cmake"
+  "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/DependInfo.cmake"
+  "src/libcore/src/pisces/system/CMakeFiles/pisces_system.dir/DependInfo.cmake"
+  "src/appentry/CMakeFiles/libappentry.dir/DependInfo.cmake"
+  "src/servicemanager/exe/CMakeFiles/servicemanager.dir/DependInfo.cmake"
+  "src/servicemanager/lib/CMakeFiles/libservicemanager.dir/DependInfo.cmake"
+  "src/sample/component/CMakeFiles/FooBarDemo.dir/DependInfo.cmake"
+  "src/sample/client/CMakeFiles/demo.dir/DependInfo.cmake"
+  "test/libtest/CMakeFiles/libtest.dir/DependInfo.cmake"
+  "test/appentry/CMakeFiles/testAppEntry.dir/DependInfo.cmake"
+  "test/support/CMakeFiles/libsupport.dir/DependInfo.cmake"
+  "test/runtime/array/CMakeFiles/testArray.dir/DependInfo.cmake"
+  "test/runtime/autoptr/CMakeFiles/testAutoPtr.dir/DependInfo.cmake"
+  "test/runtime/char/CMakeFiles/testChar.dir/DependInfo.cmake"
+  "test/runtime/hash/CMakeFiles/benchmarkStringHash.dir/DependInfo.cmake"
+  "test/runtime/localstaticvariable/CMakeFiles/testLocalStaticVariable.dir/DependInfo.cmake"
+  "test/runtime/macro/CMakeFiles/testMacro.dir/DependInfo.cmake"
+  "test/runtime/nestedinterface/CMakeFiles/testNestedInterface.dir/DependInfo.cmake"
+  "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/DependInfo.cmake"
+  "test/runtime/newobject/client/CMakeFiles/benchmarkNewObject.dir/DependInfo.cmake"
+  "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/DependInfo.cmake"
+  "test/runtime/probe/CMakeFiles/benchmarkProbe.dir/DependInfo.cmake"
+  "test/runtime/refcount/CMakeFiles/benchmarkRefCount.dir/DependInfo.cmake"
+  "test/runtime/reflection/component/CMakeFiles/ReflectionTestUnit.dir/DependInfo.cmake"
+  "test/runtime/reflection/client/CMakeFiles/testReflection.dir/DependInfo.cmake"
+  "test/runtime/rpc/component/CMakeFiles/RPCTestUnit.dir/DependInfo.cmake"
+  "test/runtime/rpc/client/CMakeFiles/testRPCCli.dir/DependInfo.cmake"
+  "test/runtime/rpc/service/CMakeFiles/testRPCSrv.dir/DependInfo.cmake"
+  "test/runtime/startup/CMakeFiles/benchmarkStartup.dir/DependInfo.cmake"
+  "test/runtime/stringpool/CMakeFiles/benchmarkStringPool.dir/DependInfo.cmake"
+  "test/runtime/utf8/CMakeFiles/benchmarkUTF8.dir/DependInfo.cmake"
+  "test/libcore/ccm/core/boxing/CMakeFiles/benchmarkBoxing.dir/DependInfo.cmake"
+  "test/libcore/ccm/core/string/CMakeFiles/testString.dir/DependInfo.cmake"
+  "test/libcore/ccm/core/thread/client/CMakeFiles/testThreadCli.dir/DependInfo.cmake"
+  "test/libcore/ccm/io/file/CMakeFiles/testFile.dir/DependInfo.cmake"
+  "test/libcore/ccm/io/fileinputstream/CMakeFiles/testFileInputStream.dir/DependInfo.cmake"
+  "test/libcore/ccm/io/charset/charset/CMakeFiles/testCharset.dir/DependInfo.cmake"
+  "test/libcore/ccm/math/bigdecimal/CMakeFiles/testBigDecimal.dir/DependInfo.cmake"
+  "test/libcore/ccm/math/biginteger/CMakeFiles/testBigInteger.dir/DependInfo.cmake"
+  "test/libcore/ccm/text/attributedstring/CMakeFiles/testAttributedString.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/arraylist/CMakeFiles/testArrayList.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/calendar/CMakeFiles/testCalendar.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/date/CMakeFiles/testDate.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/formatter/CMakeFiles/testFormatter.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/hashmap/CMakeFiles/testHashMap.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/hashtable/CMakeFiles/testHashtable.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/locale/CMakeFiles/testLocale.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/random/CMakeFiles/testRandom.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/stringtokenizer/CMakeFiles/testStringTokenizer.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/treemap/CMakeFiles/testTreeMap.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/vector/CMakeFiles/testVector.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/concurrent/concurrenthashmap/CMakeFiles/testConcurrentHashMap.dir/DependInfo.cmake"
+  "test/libcore/ccm/util/concurrent/concurrentlinkedqueue/CMakeFiles/testConcurrentLinkedQueue.dir/DependInfo.cmake"
+  "test/libcore/libcore/util/zoneinfo/CMakeFiles/testZoneInfo.dir/DependInfo.cmake"
+  )
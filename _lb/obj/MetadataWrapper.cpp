@@ -0,0 +1,2696 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include <ccmdef.h>
+#include <stdint.h>
+
+struct MetadataWrapper
+{
+    int             mSize;
+    unsigned char   mMetadata[42664] __attribute__ ((aligned (8)));
+};
+
+static const MetadataWrapper comMetadata __attribute__ ((used,__section__ (".metadata"))) = {
+    42664, {
+    0xfd,0x20,0x2e,0x01,0xa8,0xa6,0x00,0x00,0x02,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,
+    0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xcc,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf8,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x21,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x24,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x2c,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb8,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x46,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x51,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x57,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb8,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x8c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf8,0x8e,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x90,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd8,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x98,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x28,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x88,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x98,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb8,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd8,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe8,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf8,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x28,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x88,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x98,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x28,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x88,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x98,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb8,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd8,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe8,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf8,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x28,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x88,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x98,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x43,0x43,0x4d,0x52,0x75,0x6e,0x74,0x69,0x6d,0x65,0x00,0x68,0x74,0x74,0x70,
+    0x3a,0x2f,0x2f,0x63,0x63,0x6d,0x2e,0x6f,0x72,0x67,0x2f,0x63,0x63,0x6d,0x72,0x74,
+    0x2e,0x73,0x6f,0x00,0x63,0x63,0x6d,0x3a,0x3a,0x00,0x49,0x4f,0x41,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x00,0x55,0x4e,0x4b,0x4e,0x4f,0x57,0x4e,0x00,0x49,0x4e,
+    0x00,0x4f,0x55,0x54,0x00,0x49,0x4e,0x5f,0x4f,0x55,0x54,0x00,0x4f,0x55,0x54,0x5f,
+    0x43,0x41,0x4c,0x4c,0x45,0x45,0x00,0x52,0x50,0x43,0x54,0x79,0x70,0x65,0x00,0x4c,
+    0x6f,0x63,0x61,0x6c,0x00,0x52,0x65,0x6d,0x6f,0x74,0x65,0x00,0x52,0x50,0x43,0x50,
+    0x65,0x65,0x72,0x00,0x50,0x72,0x6f,0x78,0x79,0x00,0x53,0x74,0x75,0x62,0x00,0x49,
+    0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x00,0x50,0x72,0x6f,0x62,0x65,0x00,
+    0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,
+    0x3b,0x29,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,
+    0x65,0x3b,0x2a,0x00,0x69,0x69,0x64,0x00,0x41,0x64,0x64,0x52,0x65,0x66,0x00,0x28,
+    0x48,0x29,0x49,0x00,0x69,0x64,0x00,0x52,0x65,0x6c,0x65,0x61,0x73,0x65,0x00,0x47,
+    0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x49,0x44,0x00,0x28,0x4c,
+    0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,0x2a,
+    0x55,0x2a,0x29,0x45,0x00,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x49,0x43,0x6c,0x61,
+    0x73,0x73,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x41,0x74,0x74,0x61,0x63,0x68,0x4d,
+    0x65,0x74,0x61,0x64,0x61,0x74,0x61,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,
+    0x65,0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x3b,0x2a,0x29,0x45,
+    0x00,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x00,0x47,0x65,0x74,0x4d,0x65,
+    0x74,0x61,0x64,0x61,0x74,0x65,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,
+    0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x3b,0x2a,0x2a,0x29,0x45,
+    0x00,0x43,0x72,0x65,0x61,0x74,0x65,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x28,0x55,
+    0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,
+    0x2a,0x2a,0x29,0x45,0x00,0x49,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x28,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+    0x74,0x3b,0x2a,0x54,0x29,0x45,0x00,0x63,0x6f,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,
+    0x6d,0x65,0x00,0x47,0x65,0x74,0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,0x49,0x44,0x00,
+    0x28,0x4b,0x2a,0x29,0x45,0x00,0x63,0x69,0x64,0x00,0x47,0x65,0x74,0x43,0x6f,0x63,
+    0x6c,0x61,0x73,0x73,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,
+    0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x6b,0x6c,0x61,
+    0x73,0x73,0x00,0x47,0x65,0x74,0x48,0x61,0x73,0x68,0x43,0x6f,0x64,0x65,0x00,0x28,
+    0x49,0x2a,0x29,0x45,0x00,0x68,0x61,0x73,0x68,0x00,0x45,0x71,0x75,0x61,0x6c,0x73,
+    0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,
+    0x65,0x3b,0x2a,0x5a,0x2a,0x29,0x45,0x00,0x6f,0x62,0x6a,0x00,0x73,0x61,0x6d,0x65,
+    0x00,0x53,0x65,0x74,0x52,0x65,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x4f,0x62,0x73,
+    0x65,0x72,0x76,0x65,0x72,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x52,0x65,0x66,
+    0x65,0x72,0x65,0x6e,0x63,0x65,0x4f,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x3b,0x2a,
+    0x29,0x45,0x00,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x00,0x54,0x6f,0x53,0x74,
+    0x72,0x69,0x6e,0x67,0x00,0x28,0x54,0x2a,0x29,0x45,0x00,0x64,0x65,0x73,0x63,0x00,
+    0x49,0x43,0x6c,0x61,0x73,0x73,0x4c,0x6f,0x61,0x64,0x65,0x72,0x00,0x4c,0x6f,0x61,
+    0x64,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x00,0x28,0x54,0x4c,0x63,0x63,
+    0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+    0x3b,0x2a,0x2a,0x29,0x45,0x00,0x70,0x61,0x74,0x68,0x00,0x28,0x4d,0x4c,0x63,0x63,
+    0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+    0x3b,0x2a,0x2a,0x29,0x45,0x00,0x63,0x6f,0x6d,0x70,0x49,0x64,0x00,0x55,0x6e,0x6c,
+    0x6f,0x61,0x64,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x00,0x28,0x4d,0x29,
+    0x45,0x00,0x4c,0x6f,0x61,0x64,0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,0x00,0x28,0x54,
+    0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x63,0x6c,0x61,0x73,
+    0x73,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x66,0x75,0x6c,0x6c,0x4e,0x61,0x6d,0x65,0x00,
+    0x4c,0x6f,0x61,0x64,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x00,0x28,0x54,
+    0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x49,0x6e,0x74,0x65,0x72,0x66,
+    0x61,0x63,0x65,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x69,0x6e,0x74,0x66,0x00,0x47,0x65,
+    0x74,0x50,0x61,0x72,0x65,0x6e,0x74,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x43,
+    0x6c,0x61,0x73,0x73,0x4c,0x6f,0x61,0x64,0x65,0x72,0x3b,0x2a,0x2a,0x29,0x45,0x00,
+    0x70,0x61,0x72,0x65,0x6e,0x74,0x00,0x49,0x57,0x65,0x61,0x6b,0x52,0x65,0x66,0x65,
+    0x72,0x65,0x6e,0x63,0x65,0x00,0x52,0x65,0x73,0x6f,0x6c,0x76,0x65,0x00,0x49,0x57,
+    0x65,0x61,0x6b,0x52,0x65,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x53,0x6f,0x75,0x72,
+    0x63,0x65,0x00,0x47,0x65,0x74,0x57,0x65,0x61,0x6b,0x52,0x65,0x66,0x65,0x72,0x65,
+    0x6e,0x63,0x65,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x57,0x65,0x61,0x6b,0x52,
+    0x65,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x77,0x72,
+    0x00,0x49,0x52,0x65,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x4f,0x62,0x73,0x65,0x72,
+    0x76,0x65,0x72,0x00,0x4f,0x6e,0x4c,0x61,0x73,0x74,0x53,0x74,0x72,0x6f,0x6e,0x67,
+    0x52,0x65,0x66,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4f,0x62,0x6a,0x65,0x63,
+    0x74,0x3b,0x2a,0x29,0x45,0x00,0x4f,0x6e,0x4c,0x61,0x73,0x74,0x57,0x65,0x61,0x6b,
+    0x52,0x65,0x66,0x00,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,
+    0x6e,0x74,0x00,0x47,0x65,0x74,0x4e,0x61,0x6d,0x65,0x00,0x6e,0x61,0x6d,0x65,0x00,
+    0x47,0x65,0x74,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x49,0x44,0x00,0x28,
+    0x4d,0x2a,0x29,0x45,0x00,0x47,0x65,0x74,0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,0x4e,
+    0x75,0x6d,0x62,0x65,0x72,0x00,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x47,0x65,0x74,
+    0x41,0x6c,0x6c,0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,0x65,0x73,0x00,0x28,0x5b,0x4c,
+    0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,
+    0x3b,0x2a,0x29,0x45,0x00,0x6b,0x6c,0x61,0x73,0x73,0x65,0x73,0x00,0x28,0x4b,0x4c,
+    0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,
+    0x3b,0x2a,0x2a,0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,
+    0x63,0x65,0x4e,0x75,0x6d,0x62,0x65,0x72,0x00,0x47,0x65,0x74,0x41,0x6c,0x6c,0x49,
+    0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x73,0x00,0x28,0x5b,0x4c,0x63,0x63,0x6d,
+    0x2f,0x49,0x4d,0x65,0x74,0x61,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,
+    0x2a,0x29,0x45,0x00,0x69,0x6e,0x74,0x66,0x73,0x00,0x47,0x65,0x74,0x49,0x6e,0x74,
+    0x65,0x72,0x66,0x61,0x63,0x65,0x00,0x28,0x55,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,
+    0x65,0x74,0x61,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,0x2a,0x2a,0x29,
+    0x45,0x00,0x47,0x65,0x74,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,
+    0x4e,0x75,0x6d,0x62,0x65,0x72,0x00,0x47,0x65,0x74,0x41,0x6c,0x6c,0x45,0x6e,0x75,
+    0x6d,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x00,0x28,0x5b,0x4c,0x63,0x63,0x6d,
+    0x2f,0x49,0x4d,0x65,0x74,0x61,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x69,0x6f,
+    0x6e,0x3b,0x2a,0x29,0x45,0x00,0x65,0x6e,0x75,0x6d,0x6e,0x73,0x00,0x47,0x65,0x74,
+    0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x00,0x28,0x54,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,
+    0x69,0x6f,0x6e,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x65,0x6e,0x75,0x6d,0x6e,0x00,0x43,
+    0x61,0x6e,0x55,0x6e,0x6c,0x6f,0x61,0x64,0x00,0x28,0x5a,0x2a,0x29,0x45,0x00,0x75,
+    0x6e,0x6c,0x6f,0x61,0x64,0x00,0x55,0x6e,0x6c,0x6f,0x61,0x64,0x00,0x28,0x29,0x45,
+    0x00,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,0x00,0x47,0x65,
+    0x74,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x00,0x63,0x6f,0x6d,0x70,0x00,
+    0x47,0x65,0x74,0x4e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x00,0x6e,0x73,0x00,
+    0x47,0x65,0x74,0x43,0x6c,0x61,0x73,0x73,0x4c,0x6f,0x61,0x64,0x65,0x72,0x00,0x6c,
+    0x6f,0x61,0x64,0x65,0x72,0x00,0x47,0x65,0x74,0x43,0x6f,0x6e,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x6f,0x72,0x4e,0x75,0x6d,0x62,0x65,0x72,0x00,0x47,0x65,0x74,0x41,0x6c,
+    0x6c,0x43,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0x73,0x00,0x28,0x5b,
+    0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6e,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x6f,0x72,0x3b,0x2a,0x29,0x45,0x00,0x63,0x6f,0x6e,0x73,0x74,0x72,
+    0x73,0x00,0x47,0x65,0x74,0x43,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,
+    0x00,0x28,0x54,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6e,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x73,0x69,
+    0x67,0x6e,0x61,0x74,0x75,0x72,0x65,0x00,0x63,0x6f,0x6e,0x73,0x74,0x72,0x00,0x43,
+    0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,
+    0x00,0x28,0x54,0x5a,0x2a,0x29,0x45,0x00,0x72,0x65,0x73,0x75,0x6c,0x74,0x00,0x47,
+    0x65,0x74,0x4d,0x65,0x74,0x68,0x6f,0x64,0x4e,0x75,0x6d,0x62,0x65,0x72,0x00,0x47,
+    0x65,0x74,0x41,0x6c,0x6c,0x4d,0x65,0x74,0x68,0x6f,0x64,0x73,0x00,0x28,0x5b,0x4c,
+    0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x4d,0x65,0x74,0x68,0x6f,0x64,0x3b,
+    0x2a,0x29,0x45,0x00,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x00,0x47,0x65,0x74,0x4d,
+    0x65,0x74,0x68,0x6f,0x64,0x00,0x28,0x54,0x54,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,
+    0x65,0x74,0x61,0x4d,0x65,0x74,0x68,0x6f,0x64,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x6d,
+    0x65,0x74,0x68,0x6f,0x64,0x00,0x49,0x4d,0x65,0x74,0x61,0x45,0x6e,0x75,0x6d,0x65,
+    0x72,0x61,0x74,0x69,0x6f,0x6e,0x00,0x47,0x65,0x74,0x45,0x6e,0x75,0x6d,0x65,0x72,
+    0x61,0x74,0x6f,0x72,0x4e,0x75,0x6d,0x62,0x65,0x72,0x00,0x47,0x65,0x74,0x41,0x6c,
+    0x6c,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x73,0x00,0x28,0x5b,0x4c,
+    0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,
+    0x74,0x6f,0x72,0x3b,0x2a,0x29,0x45,0x00,0x65,0x6e,0x75,0x6d,0x72,0x73,0x00,0x47,
+    0x65,0x74,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x28,0x54,0x4c,
+    0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,
+    0x74,0x6f,0x72,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x65,0x6e,0x75,0x6d,0x72,0x00,0x49,
+    0x4d,0x65,0x74,0x61,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x28,
+    0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x45,0x6e,0x75,0x6d,0x65,0x72,
+    0x61,0x74,0x69,0x6f,0x6e,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x47,0x65,0x74,0x56,0x61,
+    0x6c,0x75,0x65,0x00,0x76,0x61,0x6c,0x75,0x65,0x00,0x49,0x4d,0x65,0x74,0x61,0x49,
+    0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x00,0x28,0x55,0x2a,0x29,0x45,0x00,0x47,
+    0x65,0x74,0x42,0x61,0x73,0x65,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x00,
+    0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x49,0x6e,0x74,0x65,0x72,
+    0x66,0x61,0x63,0x65,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x62,0x61,0x73,0x65,0x49,0x6e,
+    0x74,0x66,0x00,0x47,0x65,0x74,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x4e,0x75,
+    0x6d,0x62,0x65,0x72,0x00,0x47,0x65,0x74,0x41,0x6c,0x6c,0x43,0x6f,0x6e,0x73,0x74,
+    0x61,0x6e,0x74,0x73,0x00,0x28,0x5b,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,
+    0x61,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x3b,0x2a,0x29,0x45,0x00,0x63,0x6f,
+    0x6e,0x73,0x74,0x73,0x00,0x47,0x65,0x74,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,
+    0x00,0x28,0x54,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x63,0x6f,0x6e,0x73,0x74,
+    0x74,0x00,0x28,0x49,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,
+    0x6e,0x73,0x74,0x61,0x6e,0x74,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x69,0x6e,0x64,0x65,
+    0x78,0x00,0x28,0x49,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x4d,0x65,
+    0x74,0x68,0x6f,0x64,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x49,0x4d,0x65,0x74,0x61,0x43,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x00,0x47,0x65,0x74,0x54,0x79,0x70,0x65,0x00,
+    0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x54,0x79,0x70,0x65,0x3b,
+    0x2a,0x2a,0x29,0x45,0x00,0x74,0x79,0x70,0x65,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,
+    0x49,0x4d,0x65,0x74,0x61,0x56,0x61,0x6c,0x75,0x65,0x3b,0x2a,0x2a,0x29,0x45,0x00,
+    0x49,0x4d,0x65,0x74,0x61,0x4d,0x65,0x74,0x68,0x6f,0x64,0x00,0x47,0x65,0x74,0x53,
+    0x69,0x67,0x6e,0x61,0x74,0x75,0x72,0x65,0x00,0x47,0x65,0x74,0x50,0x61,0x72,0x61,
+    0x6d,0x65,0x74,0x65,0x72,0x4e,0x75,0x6d,0x62,0x65,0x72,0x00,0x47,0x65,0x74,0x41,
+    0x6c,0x6c,0x50,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x73,0x00,0x28,0x5b,0x4c,
+    0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x50,0x61,0x72,0x61,0x6d,0x65,0x74,
+    0x65,0x72,0x3b,0x2a,0x29,0x45,0x00,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x47,0x65,
+    0x74,0x50,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x00,0x28,0x49,0x4c,0x63,0x63,
+    0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x50,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,
+    0x3b,0x2a,0x2a,0x29,0x45,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x28,0x54,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x50,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,
+    0x72,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x48,0x61,0x73,0x4f,0x75,0x74,0x41,0x72,0x67,
+    0x75,0x6d,0x65,0x6e,0x74,0x73,0x00,0x6f,0x75,0x74,0x41,0x72,0x67,0x73,0x00,0x49,
+    0x73,0x4f,0x6e,0x65,0x77,0x61,0x79,0x00,0x69,0x73,0x4f,0x6e,0x65,0x77,0x61,0x79,
+    0x00,0x43,0x72,0x65,0x61,0x74,0x65,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4c,
+    0x69,0x73,0x74,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x41,0x72,0x67,0x75,0x6d,
+    0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x61,0x72,0x67,
+    0x4c,0x69,0x73,0x74,0x00,0x49,0x6e,0x76,0x6f,0x6b,0x65,0x00,0x28,0x4c,0x63,0x63,
+    0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,0x2a,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,
+    0x3b,0x2a,0x29,0x45,0x00,0x74,0x68,0x69,0x73,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,
+    0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,
+    0x00,0x49,0x73,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x00,0x69,0x73,0x44,0x65,0x66,
+    0x61,0x75,0x6c,0x74,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x3b,0x2a,0x4c,0x63,0x63,0x6d,0x2f,0x49,
+    0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x49,
+    0x4d,0x65,0x74,0x61,0x50,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x00,0x28,0x4c,
+    0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x4d,0x65,0x74,0x68,0x6f,0x64,0x3b,
+    0x2a,0x2a,0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x64,0x65,0x78,0x00,0x47,0x65,
+    0x74,0x49,0x4f,0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x00,0x28,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x4f,0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x3b,0x2a,
+    0x29,0x45,0x00,0x61,0x74,0x74,0x72,0x00,0x49,0x4d,0x65,0x74,0x61,0x54,0x79,0x70,
+    0x65,0x00,0x47,0x65,0x74,0x54,0x79,0x70,0x65,0x4b,0x69,0x6e,0x64,0x00,0x6b,0x69,
+    0x6e,0x64,0x00,0x47,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x54,0x79,0x70,
+    0x65,0x00,0x65,0x6c,0x65,0x6d,0x54,0x79,0x70,0x65,0x00,0x47,0x65,0x74,0x50,0x6f,
+    0x69,0x6e,0x74,0x65,0x72,0x4e,0x75,0x6d,0x62,0x65,0x72,0x00,0x49,0x4d,0x65,0x74,
+    0x61,0x56,0x61,0x6c,0x75,0x65,0x00,0x47,0x65,0x74,0x42,0x6f,0x6f,0x6c,0x65,0x61,
+    0x6e,0x56,0x61,0x6c,0x75,0x65,0x00,0x47,0x65,0x74,0x43,0x68,0x61,0x72,0x56,0x61,
+    0x6c,0x75,0x65,0x00,0x28,0x43,0x2a,0x29,0x45,0x00,0x47,0x65,0x74,0x42,0x79,0x74,
+    0x65,0x56,0x61,0x6c,0x75,0x65,0x00,0x28,0x42,0x2a,0x29,0x45,0x00,0x47,0x65,0x74,
+    0x53,0x68,0x6f,0x72,0x74,0x56,0x61,0x6c,0x75,0x65,0x00,0x28,0x53,0x2a,0x29,0x45,
+    0x00,0x47,0x65,0x74,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x56,0x61,0x6c,0x75,0x65,
+    0x00,0x47,0x65,0x74,0x4c,0x6f,0x6e,0x67,0x56,0x61,0x6c,0x75,0x65,0x00,0x28,0x4c,
+    0x2a,0x29,0x45,0x00,0x47,0x65,0x74,0x46,0x6c,0x6f,0x61,0x74,0x56,0x61,0x6c,0x75,
+    0x65,0x00,0x28,0x46,0x2a,0x29,0x45,0x00,0x47,0x65,0x74,0x44,0x6f,0x75,0x62,0x6c,
+    0x65,0x56,0x61,0x6c,0x75,0x65,0x00,0x28,0x44,0x2a,0x29,0x45,0x00,0x47,0x65,0x74,
+    0x53,0x74,0x72,0x69,0x6e,0x67,0x56,0x61,0x6c,0x75,0x65,0x00,0x47,0x65,0x74,0x52,
+    0x61,0x64,0x69,0x78,0x00,0x72,0x61,0x64,0x69,0x78,0x00,0x49,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,
+    0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x42,0x79,0x74,0x65,0x00,
+    0x28,0x49,0x42,0x2a,0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,
+    0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x42,0x79,0x74,0x65,0x00,0x28,0x49,
+    0x42,0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x53,0x68,0x6f,0x72,0x74,0x00,0x28,0x49,0x53,0x2a,
+    0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,
+    0x65,0x6e,0x74,0x4f,0x66,0x53,0x68,0x6f,0x72,0x74,0x00,0x28,0x49,0x53,0x29,0x45,
+    0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,
+    0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x28,0x49,0x49,0x2a,0x29,
+    0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,
+    0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x28,0x49,0x49,0x29,
+    0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,
+    0x6e,0x74,0x4f,0x66,0x4c,0x6f,0x6e,0x67,0x00,0x28,0x49,0x4c,0x2a,0x29,0x45,0x00,
+    0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,
+    0x4f,0x66,0x4c,0x6f,0x6e,0x67,0x00,0x28,0x49,0x4c,0x29,0x45,0x00,0x47,0x65,0x74,
+    0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x46,
+    0x6c,0x6f,0x61,0x74,0x00,0x28,0x49,0x46,0x2a,0x29,0x45,0x00,0x53,0x65,0x74,0x49,
+    0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x46,0x6c,
+    0x6f,0x61,0x74,0x00,0x28,0x49,0x46,0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,
+    0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x44,0x6f,0x75,0x62,
+    0x6c,0x65,0x00,0x28,0x49,0x44,0x2a,0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,
+    0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x44,0x6f,0x75,0x62,
+    0x6c,0x65,0x00,0x28,0x49,0x44,0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,
+    0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x43,0x68,0x61,0x72,0x00,
+    0x28,0x49,0x43,0x2a,0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,
+    0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x43,0x68,0x61,0x72,0x00,0x28,0x49,
+    0x43,0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x42,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x00,0x28,0x49,
+    0x5a,0x2a,0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,
+    0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x42,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x00,0x28,
+    0x49,0x5a,0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,
+    0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x28,0x49,
+    0x54,0x2a,0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,
+    0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x28,0x49,
+    0x54,0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x48,0x41,0x4e,0x44,0x4c,0x45,0x00,0x28,0x49,0x48,
+    0x2a,0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x48,0x41,0x4e,0x44,0x4c,0x45,0x00,0x28,0x49,0x48,
+    0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,
+    0x65,0x6e,0x74,0x4f,0x66,0x45,0x43,0x6f,0x64,0x65,0x00,0x28,0x49,0x45,0x2a,0x29,
+    0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,
+    0x6e,0x74,0x4f,0x66,0x45,0x43,0x6f,0x64,0x65,0x00,0x28,0x49,0x45,0x29,0x45,0x00,
+    0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,
+    0x4f,0x66,0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,0x49,0x44,0x00,0x28,0x49,0x4b,0x2a,
+    0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,
+    0x65,0x6e,0x74,0x4f,0x66,0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,0x49,0x44,0x00,0x28,
+    0x49,0x4b,0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,
+    0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+    0x49,0x44,0x00,0x28,0x49,0x4d,0x2a,0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,
+    0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x43,0x6f,0x6d,0x70,
+    0x6f,0x6e,0x65,0x6e,0x74,0x49,0x44,0x00,0x28,0x49,0x4d,0x29,0x45,0x00,0x47,0x65,
+    0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,
+    0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x49,0x44,0x00,0x28,0x49,0x55,0x2a,
+    0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,
+    0x65,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x49,0x44,
+    0x00,0x28,0x49,0x55,0x29,0x45,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,
+    0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x41,0x72,0x72,0x61,0x79,0x00,0x53,
+    0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,
+    0x66,0x41,0x72,0x72,0x61,0x79,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,
+    0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,
+    0x74,0x69,0x6f,0x6e,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,
+    0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x69,
+    0x6f,0x6e,0x00,0x47,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,
+    0x65,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x00,0x28,
+    0x49,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,
+    0x3b,0x2a,0x2a,0x29,0x45,0x00,0x53,0x65,0x74,0x49,0x6e,0x70,0x75,0x74,0x41,0x72,
+    0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,
+    0x65,0x00,0x28,0x49,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,
+    0x61,0x63,0x65,0x3b,0x2a,0x29,0x45,0x00,0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x42,0x79,
+    0x74,0x65,0x00,0x53,0x65,0x74,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x42,0x79,0x74,0x65,0x00,0x61,0x64,0x64,0x72,0x00,
+    0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x53,0x68,0x6f,0x72,0x74,0x00,0x53,0x65,0x74,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x53,
+    0x68,0x6f,0x72,0x74,0x00,0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,0x75,0x74,0x70,0x75,
+    0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x67,
+    0x65,0x72,0x00,0x53,0x65,0x74,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x41,0x73,
+    0x73,0x69,0x67,0x6e,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,
+    0x6e,0x74,0x4f,0x66,0x4c,0x6f,0x6e,0x67,0x00,0x53,0x65,0x74,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x4c,0x6f,0x6e,0x67,
+    0x00,0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,
+    0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x46,0x6c,0x6f,0x61,0x74,0x00,0x53,0x65,0x74,
+    0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,
+    0x46,0x6c,0x6f,0x61,0x74,0x00,0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x44,0x6f,0x75,0x62,
+    0x6c,0x65,0x00,0x53,0x65,0x74,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x44,0x6f,0x75,0x62,0x6c,0x65,0x00,0x41,0x73,0x73,
+    0x69,0x67,0x6e,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,
+    0x74,0x4f,0x66,0x43,0x68,0x61,0x72,0x00,0x53,0x65,0x74,0x4f,0x75,0x74,0x70,0x75,
+    0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x43,0x68,0x61,0x72,0x00,
+    0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x42,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x00,0x53,0x65,
+    0x74,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,
+    0x66,0x42,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x00,0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x53,
+    0x74,0x72,0x69,0x6e,0x67,0x00,0x53,0x65,0x74,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,
+    0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,
+    0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x48,0x41,0x4e,0x44,0x4c,0x45,0x00,0x53,0x65,0x74,
+    0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,
+    0x48,0x41,0x4e,0x44,0x4c,0x45,0x00,0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x45,0x43,0x6f,
+    0x64,0x65,0x00,0x53,0x65,0x74,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x45,0x43,0x6f,0x64,0x65,0x00,0x41,0x73,0x73,0x69,
+    0x67,0x6e,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,
+    0x4f,0x66,0x43,0x6f,0x63,0x6c,0x61,0x73,0x73,0x49,0x44,0x00,0x53,0x65,0x74,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x43,
+    0x6f,0x63,0x6c,0x61,0x73,0x73,0x49,0x44,0x00,0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x43,
+    0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x49,0x44,0x00,0x53,0x65,0x74,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x43,0x6f,
+    0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x49,0x44,0x00,0x41,0x73,0x73,0x69,0x67,0x6e,
+    0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,
+    0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x49,0x44,0x00,0x53,0x65,0x74,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x49,
+    0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x49,0x44,0x00,0x41,0x73,0x73,0x69,0x67,
+    0x6e,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,
+    0x66,0x41,0x72,0x72,0x61,0x79,0x00,0x53,0x65,0x74,0x4f,0x75,0x74,0x70,0x75,0x74,
+    0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x41,0x72,0x72,0x61,0x79,0x00,
+    0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,
+    0x6d,0x65,0x6e,0x74,0x4f,0x66,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x69,0x6f,
+    0x6e,0x00,0x53,0x65,0x74,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,
+    0x65,0x6e,0x74,0x4f,0x66,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,
+    0x00,0x41,0x73,0x73,0x69,0x67,0x6e,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,
+    0x75,0x6d,0x65,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,
+    0x00,0x53,0x65,0x74,0x4f,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6d,0x65,
+    0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x00,0x47,0x65,
+    0x74,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x41,0x64,0x64,0x72,0x65,0x73,0x73,
+    0x00,0x49,0x50,0x61,0x72,0x63,0x65,0x6c,0x00,0x52,0x65,0x61,0x64,0x43,0x68,0x61,
+    0x72,0x00,0x57,0x72,0x69,0x74,0x65,0x43,0x68,0x61,0x72,0x00,0x28,0x43,0x29,0x45,
+    0x00,0x52,0x65,0x61,0x64,0x42,0x79,0x74,0x65,0x00,0x57,0x72,0x69,0x74,0x65,0x42,
+    0x79,0x74,0x65,0x00,0x28,0x42,0x29,0x45,0x00,0x52,0x65,0x61,0x64,0x53,0x68,0x6f,
+    0x72,0x74,0x00,0x57,0x72,0x69,0x74,0x65,0x53,0x68,0x6f,0x72,0x74,0x00,0x28,0x53,
+    0x29,0x45,0x00,0x52,0x65,0x61,0x64,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x57,
+    0x72,0x69,0x74,0x65,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x28,0x49,0x29,0x45,
+    0x00,0x52,0x65,0x61,0x64,0x4c,0x6f,0x6e,0x67,0x00,0x57,0x72,0x69,0x74,0x65,0x4c,
+    0x6f,0x6e,0x67,0x00,0x28,0x4c,0x29,0x45,0x00,0x52,0x65,0x61,0x64,0x46,0x6c,0x6f,
+    0x61,0x74,0x00,0x57,0x72,0x69,0x74,0x65,0x46,0x6c,0x6f,0x61,0x74,0x00,0x28,0x46,
+    0x29,0x45,0x00,0x52,0x65,0x61,0x64,0x44,0x6f,0x75,0x62,0x6c,0x65,0x00,0x57,0x72,
+    0x69,0x74,0x65,0x44,0x6f,0x75,0x62,0x6c,0x65,0x00,0x28,0x44,0x29,0x45,0x00,0x52,
+    0x65,0x61,0x64,0x42,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x00,0x57,0x72,0x69,0x74,0x65,
+    0x42,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x00,0x28,0x5a,0x29,0x45,0x00,0x52,0x65,0x61,
+    0x64,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x57,0x72,0x69,0x74,0x65,0x53,0x74,0x72,
+    0x69,0x6e,0x67,0x00,0x28,0x54,0x29,0x45,0x00,0x52,0x65,0x61,0x64,0x43,0x6f,0x63,
+    0x6c,0x61,0x73,0x73,0x49,0x44,0x00,0x57,0x72,0x69,0x74,0x65,0x43,0x6f,0x63,0x6c,
+    0x61,0x73,0x73,0x49,0x44,0x00,0x28,0x4b,0x29,0x45,0x00,0x52,0x65,0x61,0x64,0x43,
+    0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x49,0x44,0x00,0x57,0x72,0x69,0x74,0x65,
+    0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x49,0x44,0x00,0x52,0x65,0x61,0x64,
+    0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x49,0x44,0x00,0x57,0x72,0x69,0x74,
+    0x65,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x49,0x44,0x00,0x28,0x55,0x29,
+    0x45,0x00,0x52,0x65,0x61,0x64,0x45,0x43,0x6f,0x64,0x65,0x00,0x28,0x45,0x2a,0x29,
+    0x45,0x00,0x57,0x72,0x69,0x74,0x65,0x45,0x43,0x6f,0x64,0x65,0x00,0x28,0x45,0x29,
+    0x45,0x00,0x52,0x65,0x61,0x64,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x69,0x6f,
+    0x6e,0x00,0x57,0x72,0x69,0x74,0x65,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x69,
+    0x6f,0x6e,0x00,0x52,0x65,0x61,0x64,0x41,0x72,0x72,0x61,0x79,0x00,0x28,0x48,0x29,
+    0x45,0x00,0x61,0x72,0x72,0x61,0x79,0x00,0x57,0x72,0x69,0x74,0x65,0x41,0x72,0x72,
+    0x61,0x79,0x00,0x52,0x65,0x61,0x64,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,
+    0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,
+    0x65,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x57,0x72,0x69,0x74,0x65,0x49,0x6e,0x74,0x65,
+    0x72,0x66,0x61,0x63,0x65,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,
+    0x65,0x72,0x66,0x61,0x63,0x65,0x3b,0x2a,0x29,0x45,0x00,0x47,0x65,0x74,0x44,0x61,
+    0x74,0x61,0x00,0x28,0x48,0x2a,0x29,0x45,0x00,0x64,0x61,0x74,0x61,0x00,0x47,0x65,
+    0x74,0x44,0x61,0x74,0x61,0x53,0x69,0x7a,0x65,0x00,0x73,0x69,0x7a,0x65,0x00,0x53,
+    0x65,0x74,0x44,0x61,0x74,0x61,0x00,0x28,0x42,0x2a,0x4c,0x29,0x45,0x00,0x53,0x65,
+    0x74,0x44,0x61,0x74,0x61,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x00,0x70,0x6f,
+    0x73,0x00,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x50,0x61,0x63,0x6b,
+    0x00,0x52,0x65,0x61,0x64,0x46,0x72,0x6f,0x6d,0x50,0x61,0x72,0x63,0x65,0x6c,0x00,
+    0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x50,0x61,0x72,0x63,0x65,0x6c,0x3b,0x2a,0x29,
+    0x45,0x00,0x73,0x6f,0x75,0x72,0x63,0x65,0x00,0x57,0x72,0x69,0x74,0x65,0x54,0x6f,
+    0x50,0x61,0x72,0x63,0x65,0x6c,0x00,0x64,0x65,0x73,0x74,0x00,0x49,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x46,0x75,0x74,0x75,0x72,0x65,0x00,0x49,0x73,
+    0x44,0x6f,0x6e,0x65,0x00,0x64,0x6f,0x6e,0x65,0x00,0x57,0x61,0x69,0x74,0x00,0x47,
+    0x65,0x74,0x52,0x65,0x70,0x6c,0x79,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x50,
+    0x61,0x72,0x63,0x65,0x6c,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x72,0x65,0x73,0x50,0x61,
+    0x72,0x63,0x65,0x6c,0x00,0x49,0x52,0x50,0x43,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x00,0x47,0x65,0x74,0x52,0x50,0x43,0x54,0x79,0x70,0x65,0x00,0x28,0x4c,0x63,0x63,
+    0x6d,0x2f,0x52,0x50,0x43,0x54,0x79,0x70,0x65,0x3b,0x2a,0x29,0x45,0x00,0x49,0x73,
+    0x50,0x65,0x65,0x72,0x41,0x6c,0x69,0x76,0x65,0x00,0x61,0x6c,0x69,0x76,0x65,0x00,
+    0x4c,0x69,0x6e,0x6b,0x54,0x6f,0x44,0x65,0x61,0x74,0x68,0x00,0x28,0x4c,0x63,0x63,
+    0x6d,0x2f,0x49,0x44,0x65,0x61,0x74,0x68,0x52,0x65,0x63,0x69,0x70,0x69,0x65,0x6e,
+    0x74,0x3b,0x2a,0x48,0x49,0x29,0x45,0x00,0x72,0x65,0x63,0x69,0x70,0x69,0x65,0x6e,
+    0x74,0x00,0x63,0x6f,0x6f,0x6b,0x69,0x65,0x00,0x66,0x6c,0x61,0x67,0x73,0x00,0x55,
+    0x6e,0x6c,0x69,0x6e,0x6b,0x54,0x6f,0x44,0x65,0x61,0x74,0x68,0x00,0x28,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x44,0x65,0x61,0x74,0x68,0x52,0x65,0x63,0x69,0x70,0x69,0x65,
+    0x6e,0x74,0x3b,0x2a,0x48,0x49,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x44,0x65,0x61,0x74,
+    0x68,0x52,0x65,0x63,0x69,0x70,0x69,0x65,0x6e,0x74,0x3b,0x2a,0x2a,0x29,0x45,0x00,
+    0x6f,0x75,0x74,0x52,0x65,0x63,0x69,0x70,0x69,0x65,0x6e,0x74,0x00,0x28,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x50,0x72,0x6f,0x78,0x79,0x3b,0x2a,0x4c,0x63,0x63,0x6d,0x2f,
+    0x49,0x4d,0x65,0x74,0x61,0x4d,0x65,0x74,0x68,0x6f,0x64,0x3b,0x2a,0x4c,0x63,0x63,
+    0x6d,0x2f,0x49,0x50,0x61,0x72,0x63,0x65,0x6c,0x3b,0x2a,0x4c,0x63,0x63,0x6d,0x2f,
+    0x49,0x50,0x61,0x72,0x63,0x65,0x6c,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x70,0x72,0x6f,
+    0x78,0x79,0x00,0x61,0x72,0x67,0x50,0x61,0x72,0x63,0x65,0x6c,0x00,0x49,0x6e,0x76,
+    0x6f,0x6b,0x65,0x41,0x73,0x79,0x6e,0x63,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,
+    0x50,0x72,0x6f,0x78,0x79,0x3b,0x2a,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,
+    0x61,0x4d,0x65,0x74,0x68,0x6f,0x64,0x3b,0x2a,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x50,
+    0x61,0x72,0x63,0x65,0x6c,0x3b,0x2a,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x46,0x75,0x74,0x75,0x72,0x65,0x3b,0x2a,0x2a,
+    0x29,0x45,0x00,0x66,0x75,0x74,0x75,0x72,0x65,0x00,0x53,0x74,0x61,0x72,0x74,0x4c,
+    0x69,0x73,0x74,0x65,0x6e,0x69,0x6e,0x67,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,
+    0x53,0x74,0x75,0x62,0x3b,0x2a,0x29,0x45,0x00,0x73,0x74,0x75,0x62,0x00,0x4d,0x61,
+    0x74,0x63,0x68,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,
+    0x66,0x61,0x63,0x65,0x50,0x61,0x63,0x6b,0x3b,0x2a,0x5a,0x2a,0x29,0x45,0x00,0x69,
+    0x70,0x61,0x63,0x6b,0x00,0x6d,0x61,0x74,0x63,0x68,0x65,0x64,0x00,0x49,0x52,0x50,
+    0x43,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x46,0x61,0x63,0x74,0x6f,0x72,0x79,0x00,
+    0x43,0x72,0x65,0x61,0x74,0x65,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x50,
+    0x61,0x63,0x6b,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,
+    0x66,0x61,0x63,0x65,0x50,0x61,0x63,0x6b,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x43,0x72,
+    0x65,0x61,0x74,0x65,0x50,0x61,0x72,0x63,0x65,0x6c,0x00,0x70,0x61,0x72,0x63,0x65,
+    0x6c,0x00,0x43,0x72,0x65,0x61,0x74,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x00,
+    0x28,0x4c,0x63,0x63,0x6d,0x2f,0x52,0x50,0x43,0x50,0x65,0x65,0x72,0x3b,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x52,0x50,0x43,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x3b,0x2a,
+    0x2a,0x29,0x45,0x00,0x70,0x65,0x65,0x72,0x00,0x63,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x00,0x4d,0x61,0x72,0x73,0x68,0x61,0x6c,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,
+    0x65,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,
+    0x63,0x65,0x3b,0x2a,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,
+    0x61,0x63,0x65,0x50,0x61,0x63,0x6b,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x55,0x6e,0x6d,
+    0x61,0x72,0x73,0x68,0x61,0x6c,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x00,
+    0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,
+    0x50,0x61,0x63,0x6b,0x3b,0x2a,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,
+    0x72,0x66,0x61,0x63,0x65,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x49,0x50,0x72,0x6f,0x78,
+    0x79,0x00,0x47,0x65,0x74,0x54,0x61,0x72,0x67,0x65,0x74,0x43,0x6f,0x63,0x6c,0x61,
+    0x73,0x73,0x00,0x74,0x61,0x72,0x67,0x65,0x74,0x00,0x49,0x73,0x53,0x74,0x75,0x62,
+    0x41,0x6c,0x69,0x76,0x65,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,
+    0x61,0x4d,0x65,0x74,0x68,0x6f,0x64,0x3b,0x2a,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x41,
+    0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x3b,0x2a,0x4c,0x63,0x63,
+    0x6d,0x2f,0x49,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x46,0x75,0x74,
+    0x75,0x72,0x65,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x49,0x44,0x65,0x61,0x74,0x68,0x52,
+    0x65,0x63,0x69,0x70,0x69,0x65,0x6e,0x74,0x00,0x50,0x72,0x6f,0x78,0x79,0x44,0x69,
+    0x65,0x64,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x50,0x72,0x6f,0x78,0x79,0x3b,
+    0x2a,0x2a,0x29,0x45,0x00,0x77,0x68,0x6f,0x00,0x49,0x53,0x74,0x75,0x62,0x00,0x28,
+    0x4c,0x63,0x63,0x6d,0x2f,0x49,0x50,0x61,0x72,0x63,0x65,0x6c,0x3b,0x2a,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x50,0x61,0x72,0x63,0x65,0x6c,0x3b,0x2a,0x2a,0x29,0x45,0x00,
+    0x60,0xe5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+    0x09,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x0d,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0x11,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0x15,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x19,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x82,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x74,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xd4,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xdf,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd5,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xcc,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9c,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6f,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,0x0c,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x10,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,0x11,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe8,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x05,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc4,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x8f,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,0x05,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x4f,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,0x56,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xe2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd4,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,
+    0xdc,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xe0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x89,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,0x90,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x81,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x67,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x31,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,0x36,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xe0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x65,0xe0,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x36,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,
+    0xb5,0xe0,0xff,0xff,0xff,0xff,0xff,0xff,0x4c,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x28,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb9,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0x35,0xe0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa9,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf7,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdb,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xe0,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x9a,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8d,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x6f,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x2a,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0x29,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xec,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0xde,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xd6,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0xde,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xac,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0xde,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8b,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,
+    0x50,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xdb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xe5,0xdd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xeb,0xdd,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd6,0xdd,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x5d,0xdd,0xff,0xff,0xff,0xff,0xff,0xff,0x83,0xdd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0xdd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa1,0xdb,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x53,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xdd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x2d,0xdd,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xee,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe2,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,0xe6,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7d,0xdb,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x8e,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x47,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x2e,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,0x30,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0xdc,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x60,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,
+    0xe7,0xdb,0xff,0xff,0xff,0xff,0xff,0xff,0x8c,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa6,0xdb,0xff,0xff,0xff,0xff,0xff,0xff,0x86,0xd9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9c,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb5,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x36,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,
+    0x0e,0xdb,0xff,0xff,0xff,0xff,0xff,0xff,0x9c,0xd7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd3,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xdc,0xda,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xce,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x61,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,
+    0x91,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xdc,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xda,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x54,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x16,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xd9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xca,0xd7,0xb4,0x35,0x6c,0xb6,0xd3,0x44,
+    0xa6,0xb4,0x00,0x00,0x07,0x08,0x05,0x02,0x09,0x05,0x03,0x00,0x08,0x05,0x00,0x00,
+    0xb4,0xd9,0xff,0xff,0xff,0xff,0xff,0xff,0xbc,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd8,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0xd9,0xff,0xff,0xff,0xff,0xff,0xff,0x4d,0xd7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xdb,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x75,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,0x27,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x56,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x3d,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xd8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x4a,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0x76,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0d,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc2,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x7d,0xd7,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x86,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x16,0xd7,0xff,0xff,0xff,0xff,0xff,0xff,0x67,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x96,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd1,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xda,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcc,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xaa,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xe6,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa9,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x27,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb4,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc2,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0xa7,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd6,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x8a,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x5d,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0x64,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x29,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x67,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x09,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc6,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,0xc5,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xd6,0xdb,0x8f,0xbe,0x39,0x9f,0x4e,
+    0x1d,0x80,0x08,0x0a,0x03,0x0b,0x01,0x03,0x07,0x0d,0x07,0x0c,0x01,0x0f,0x00,0x00,
+    0x91,0xd4,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xce,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x70,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x50,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x05,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0xd6,0xd3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x57,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb3,0xd3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe3,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0x2d,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xbb,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xd3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xd5,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xd3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc3,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xc8,0xce,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa6,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x98,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x08,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x56,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,0x57,0xce,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x86,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1e,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf2,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe6,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xce,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1f,0xcd,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x89,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0x92,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x84,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x9e,0xcd,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x57,0xcd,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xcd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6f,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x28,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0xcb,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8e,0xcd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xbf,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xc5,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb4,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x96,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa3,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xbe,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x61,0xc9,0xff,0xff,0xff,0xff,0xff,0xff,0x66,0xc9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x95,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x36,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xea,0x14,0x35,0xf2,0x7f,0x5b,0x16,0x4a,
+    0xda,0x85,0x01,0x00,0x02,0x0d,0x0e,0x0c,0x0b,0x08,0x05,0x0d,0x03,0x08,0x00,0x00,
+    0x66,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x27,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb3,0xca,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8b,0xca,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xa5,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe5,0xcb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf7,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,0xd7,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x06,0xca,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb3,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbd,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8f,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0xc9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x59,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0xe5,0x08,0xf5,0x3f,0xba,0x6e,0x4a,
+    0x4b,0xad,0x0b,0x08,0x0b,0x0d,0x0d,0x03,0x0c,0x03,0x0f,0x0e,0x07,0x03,0x00,0x00,
+    0x1f,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,0xac,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8d,0xc9,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0xcb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x89,0xc9,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x67,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x45,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd3,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3b,0xcb,0xff,0xff,0xff,0xff,0xff,0xff,0x77,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x14,0xcb,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x48,0xf5,0xa9,0x03,0x59,0x10,0x49,
+    0x5f,0xaf,0x09,0x07,0x00,0x03,0x03,0x06,0x04,0x06,0x06,0x03,0x0b,0x02,0x00,0x00,
+    0xda,0xca,0xff,0xff,0xff,0xff,0xff,0xff,0x2c,0xc3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x98,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x98,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1e,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,0xc3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x53,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x75,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x1d,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x5d,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x29,0xc9,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdc,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xdf,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,0xe8,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xda,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbb,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x9f,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xce,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x75,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6e,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x51,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xeb,0xc3,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xc8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc5,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0xea,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd4,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8b,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xdf,0xc0,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xc3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3f,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,0x45,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x34,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x16,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3e,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x5c,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,0x1a,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe4,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1f,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe4,0x54,0x70,0xc2,0x98,0xf9,0xac,0x4e,
+    0x2c,0x9a,0x01,0x07,0x0d,0x00,0x05,0x0a,0x0a,0x06,0x0d,0x0c,0x0c,0x0d,0x00,0x00,
+    0x9a,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa3,0xc0,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7b,0xc0,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xf0,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdd,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8b,0xc3,0xff,0xff,0xff,0xff,0xff,0xff,0xb2,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x64,0xc3,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x62,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x21,0x4f,0x68,0x9f,0x6d,0x84,0x47,
+    0x41,0xb6,0x0c,0x07,0x04,0x0f,0x0b,0x07,0x01,0x0c,0x05,0x03,0x00,0x0a,0x00,0x00,
+    0x60,0xc4,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x98,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe8,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x88,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xd8,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xaa,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xa8,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd9,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8b,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xd5,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1c,0xc3,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x4e,0xc0,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd1,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xaf,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8c,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x87,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x6b,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6c,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xde,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,0x04,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa6,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x89,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x5f,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x24,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf5,0xc0,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0xc0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xed,0xc0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8d,0xc0,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa3,0x07,0x77,0xba,0xf8,0xe2,0x18,0x43,
+    0x59,0x85,0x0f,0x01,0x02,0x09,0x04,0x00,0x0f,0x00,0x02,0x0b,0x02,0x0e,0x00,0x00,
+    0x90,0xc0,0xff,0xff,0xff,0xff,0xff,0xff,0x6c,0xb6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x0d,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xba,0xb7,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0xb7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xad,0xb7,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe9,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x29,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc3,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa1,0xb6,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd5,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x36,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x60,0x10,0x0f,0xea,0x93,0x80,0x49,
+    0xb3,0x96,0x0b,0x0e,0x0a,0x08,0x06,0x09,0x0d,0x0c,0x0f,0x02,0x05,0x03,0x00,0x00,
+    0x2f,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xbc,0xb4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0c,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xb7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x45,0xb6,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd3,0xb7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x35,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0x77,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xec,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe6,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xed,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdb,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x98,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0x98,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x85,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x31,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd6,0x37,0xe1,0xc9,0x44,0x23,0xcb,0x4a,
+    0x76,0x9a,0x04,0x0d,0x00,0x0a,0x09,0x0d,0x0e,0x0a,0x01,0x07,0x07,0x03,0x00,0x00,
+    0x48,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0xb2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0xb6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x65,0xb4,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x92,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,0x97,0xb3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6e,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x10,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2a,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0b,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0xb2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x16,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xe8,0xdf,0xc0,0xa0,0x80,0x1c,0x42,
+    0x0a,0xad,0x0b,0x0e,0x05,0x01,0x0c,0x09,0x0d,0x02,0x0a,0x00,0x0c,0x09,0x00,0x00,
+    0xac,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0x9c,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x98,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x88,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xd8,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x28,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0xb8,0xff,0xff,0xff,0xff,0xff,0xff,0xa8,0xb8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x95,0xb8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x31,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xba,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x19,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xb7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x77,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0xba,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc4,0xb6,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x43,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0xba,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x37,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0xb6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xed,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x14,0xb6,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x66,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa9,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1f,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x61,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0x66,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x64,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x59,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x22,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd8,0xb8,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xb8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb4,0xb4,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x35,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xb8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x35,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0xb4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x4c,0xb8,0xff,0xff,0xff,0xff,0xff,0xff,0x67,0xae,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x25,0xb8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xba,0x59,0xc3,0x38,0xb3,0x97,0x7b,0x4b,
+    0xf7,0xbc,0x0c,0x0d,0x05,0x0f,0x06,0x0b,0x0b,0x0e,0x0d,0x06,0x0e,0x09,0x00,0x00,
+    0xeb,0xb7,0xff,0xff,0xff,0xff,0xff,0xff,0x1c,0xac,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x05,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x09,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x11,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x12,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x13,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x14,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x15,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x16,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x17,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x19,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x1b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x1b,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x1d,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x1d,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x21,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x22,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x23,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x24,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x89,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0x98,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf4,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x51,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x2e,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6c,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb4,0xb4,0xff,0xff,0xff,0xff,0xff,0xff,0xc4,0xb4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe4,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe4,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x66,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0xb4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5b,0xb4,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x5c,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe1,0xb3,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0xb3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd4,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd4,0xae,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7a,0xb3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x8c,0xb3,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x4c,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xae,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x12,0xb3,0xff,0xff,0xff,0xff,0xff,0xff,0x21,0xb3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc4,0xae,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc4,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x59,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0xb2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xb7,0xb2,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3c,0xae,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xad,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3d,0xb2,0xff,0xff,0xff,0xff,0xff,0xff,0x4d,0xb2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb4,0xad,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb4,0xac,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x55,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd4,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xe4,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x2c,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0xac,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6a,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,0x7b,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa4,0xac,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa4,0xab,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x35,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x13,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1c,0xac,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xab,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x99,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,0xa8,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xab,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x94,0xaa,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x43,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x3e,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0c,0xab,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xaa,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc4,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xaa,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x84,0xa9,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x6f,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfc,0xa9,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf5,0xae,0xff,0xff,0xff,0xff,0xff,0xff,0x06,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xa9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x74,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8d,0xae,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x9e,0xae,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xec,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xec,0xa7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x24,0xae,0xff,0xff,0xff,0xff,0xff,0xff,0x35,0xae,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x64,0xa7,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x25,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0xad,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xcd,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xdc,0xa7,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdc,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x53,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0x63,0xad,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0xa7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x54,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xea,0xac,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xfa,0xac,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xcc,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcc,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0xac,0xff,0xff,0xff,0xff,0xff,0xff,0x94,0xac,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x44,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0xac,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x2f,0xac,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xbc,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb5,0xab,0xff,0xff,0xff,0xff,0xff,0xff,0xcb,0xab,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x34,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xab,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x68,0xab,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xac,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xa3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xee,0xaa,0xff,0xff,0xff,0xff,0xff,0xff,0x04,0xab,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x24,0xa3,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8b,0xaa,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xa1,0xaa,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x9c,0xa3,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9c,0xa2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x27,0xaa,0xff,0xff,0xff,0xff,0xff,0xff,0xe5,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xa3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x14,0xa2,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x25,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb7,0xa9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x7d,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8c,0xa2,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8c,0xa1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x47,0xa9,0xff,0xff,0xff,0xff,0xff,0xff,0x23,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xa2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0xa1,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdd,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbc,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7c,0xa1,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0xa0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x73,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,0x87,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0xa0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf4,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x36,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x32,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6c,0xa0,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0xa7,0xff,0xff,0xff,0xff,0xff,0xff,0xa6,0xa3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe4,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe4,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0xa7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x4d,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x5c,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xa7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf0,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,0xd3,0xa2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd4,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd4,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x3d,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x4c,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x15,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,0x04,0xa2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc4,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc4,0x9c,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x2d,0xa3,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3c,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3e,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0x2f,0xa1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb4,0x9c,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb4,0x9b,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd1,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1d,0xa2,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x2c,0x9c,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe3,0xa3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x61,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0x5c,0xa0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa4,0x9b,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa4,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf5,0xa3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x0d,0xa1,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1c,0x9b,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd3,0xa2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x86,0xa3,0xff,0xff,0xff,0xff,0xff,0xff,0x8b,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x94,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0xa3,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xfd,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0c,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc3,0xa1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xad,0xa2,0xff,0xff,0xff,0xff,0xff,0xff,0xb6,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x99,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x84,0x98,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x34,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xa2,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xed,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfc,0x98,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb3,0xa0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd0,0xa1,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x98,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x74,0x97,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xa1,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xdd,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xec,0x97,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa3,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf9,0xa0,0xff,0xff,0xff,0xff,0xff,0xff,0x16,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x97,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x64,0x96,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8e,0xa0,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xcd,0x9c,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xdc,0x96,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0xa0,0xff,0xff,0xff,0xff,0xff,0xff,0x45,0x9c,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x96,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x54,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb5,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbd,0x9b,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xcc,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x47,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0x72,0x9b,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x95,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x44,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdb,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xad,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xbc,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x9c,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6c,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xa7,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x94,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x34,0x93,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x9d,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xac,0x93,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x9b,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x99,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x99,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x93,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x24,0x92,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x8d,0x98,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x9c,0x92,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xca,0x9c,0xff,0xff,0xff,0xff,0xff,0xff,0x19,0x99,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x92,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x14,0x91,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x9c,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x7d,0x97,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8c,0x91,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x99,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0x9b,0xff,0xff,0xff,0xff,0xff,0xff,0xf5,0x96,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x91,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0x9b,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x6d,0x96,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7c,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x98,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x9b,0xff,0xff,0xff,0xff,0xff,0xff,0x34,0x94,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf4,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xba,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5d,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6c,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x97,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x51,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xaa,0x96,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe4,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe4,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe9,0x99,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x4d,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x5c,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x96,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7e,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x93,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd4,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8b,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x25,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xcb,0x29,0x3d,0xd1,0xf7,0x79,0x4b,
+    0x63,0x9e,0x0a,0x0d,0x01,0x04,0x0a,0x05,0x07,0x0f,0x0d,0x09,0x0f,0x01,0x00,0x00,
+    0xf1,0x98,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0x84,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x70,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x50,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x90,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x05,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd0,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x70,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x50,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf0,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x09,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x90,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x09,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd0,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x70,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x40,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x97,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xb4,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x42,0x97,0xff,0xff,0xff,0xff,0xff,0xff,0x44,0x97,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa4,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x34,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0x96,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x17,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xaa,0x96,0xff,0xff,0xff,0xff,0xff,0xff,0xac,0x96,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf4,0x89,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x96,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x7b,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9c,0x89,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x13,0x96,0xff,0xff,0xff,0xff,0xff,0xff,0x16,0x96,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x44,0x89,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0x95,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x4f,0x83,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xec,0x88,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7f,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0x84,0x95,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x94,0x88,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x95,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x3e,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x88,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xea,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0x94,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe4,0x87,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,0x94,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xa2,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8c,0x87,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x53,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0x56,0x94,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x34,0x87,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x94,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x07,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdc,0x86,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xbe,0x93,0xff,0xff,0xff,0xff,0xff,0xff,0xc2,0x93,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x84,0x86,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x93,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x29,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x86,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x2b,0x93,0xff,0xff,0xff,0xff,0xff,0xff,0x30,0x93,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd4,0x85,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe5,0x92,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x55,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x85,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x98,0x92,0xff,0xff,0xff,0xff,0xff,0xff,0x9c,0x92,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x24,0x85,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x92,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xf0,0x7e,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcc,0x84,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x07,0x92,0xff,0xff,0xff,0xff,0xff,0xff,0x0e,0x92,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x74,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc3,0x91,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x84,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7b,0x91,0xff,0xff,0xff,0xff,0xff,0xff,0x15,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc4,0x83,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x91,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xa9,0x83,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0x83,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xec,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xf5,0x90,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x14,0x83,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x90,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xac,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0x82,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x62,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0x65,0x90,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x64,0x82,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0x90,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x6f,0x7c,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x82,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd2,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xa4,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb4,0x81,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8b,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x8d,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6a,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0x35,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x12,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0x80,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc7,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x54,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x93,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x4e,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0xa6,0x83,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x2a,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x59,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x07,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb9,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x51,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa2,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8e,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,0xcc,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6e,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc6,0x26,0xee,0x84,0x0a,0x6c,0x29,0x43,
+    0x27,0xb6,0x05,0x04,0x0e,0x05,0x0f,0x0c,0x03,0x0b,0x00,0x06,0x0a,0x08,0x00,0x00,
+    0x32,0x8d,0xff,0xff,0xff,0xff,0xff,0xff,0xdc,0x76,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x78,0xff,0xff,0xff,0xff,0xff,0xff,0x08,0x78,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe6,0x77,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x76,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xc9,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x76,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x93,0x77,0xff,0xff,0xff,0xff,0xff,0xff,0x97,0x77,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x75,0x77,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xd0,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xba,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x99,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,0x78,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x77,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x13,0xd7,0x34,0xe1,0x1f,0x8d,0x4c,
+    0x66,0x80,0x05,0x07,0x03,0x00,0x08,0x0e,0x09,0x09,0x06,0x04,0x08,0x03,0x00,0x00,
+    0x3c,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,0x9c,0x74,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xee,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,0xb1,0x79,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc5,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa2,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x6d,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7f,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,0x80,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6b,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xce,0xf2,0x89,0xbf,0x5f,0xba,0x5d,0x4f,
+    0x66,0xa8,0x09,0x0e,0x03,0x04,0x00,0x04,0x08,0x0e,0x0e,0x00,0x00,0x09,0x00,0x00,
+    0x35,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,0x4c,0x73,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x90,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x50,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xb9,0x89,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbc,0x89,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7e,0x89,0xff,0xff,0xff,0xff,0xff,0xff,0xe1,0x77,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x5a,0x89,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x89,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x3c,0x89,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x89,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x02,0x89,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe1,0x88,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xbf,0x88,0xff,0xff,0xff,0xff,0xff,0xff,0xc5,0x88,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x88,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x42,0x88,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x88,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x40,0x88,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x7a,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1d,0x88,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1d,0x88,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x56,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x76,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd3,0x87,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0x86,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8d,0x87,0xff,0xff,0xff,0xff,0xff,0xff,0x91,0x87,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x87,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0x75,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xeb,0x86,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x23,0x87,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x87,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x09,0x87,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0x86,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xce,0x86,0xff,0xff,0xff,0xff,0xff,0xff,0xcc,0x86,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb7,0x86,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x95,0x86,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xf1,0xad,0xd1,0x62,0x20,0xfd,0x45,
+    0x33,0xaa,0x0e,0x0d,0x0d,0x04,0x08,0x01,0x0a,0x00,0x04,0x04,0x01,0x07,0x00,0x00,
+    0x5d,0x86,0xff,0xff,0xff,0xff,0xff,0xff,0xac,0x6d,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x86,0xff,0xff,0xff,0xff,0xff,0xff,0x0c,0x86,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xaf,0x85,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd6,0x85,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xa8,0x83,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb3,0x85,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x92,0x85,0xff,0xff,0xff,0xff,0xff,0xff,0x98,0x85,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8c,0x85,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x69,0x85,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x85,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x52,0x85,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa5,0x6c,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x84,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfd,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0x08,0x85,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x81,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf5,0x6b,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x36,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7d,0xf9,0x98,0x25,0x6b,0x0e,0xa2,0x45,
+    0x21,0x8c,0x0f,0x0f,0x0e,0x0c,0x0a,0x08,0x03,0x04,0x07,0x02,0x03,0x03,0x00,0x00,
+    0x9b,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0xdc,0x6a,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x32,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0x1d,0x6c,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x13,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf2,0x83,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x89,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x81,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe0,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x80,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x41,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x80,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x89,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x80,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x6d,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x41,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xea,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc9,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1d,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x81,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xbf,0x6e,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0x71,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe3,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7d,0xf9,0x98,0x25,0x6b,0x0e,0xa2,0x45,
+    0x21,0x8c,0x0f,0x0f,0x0e,0x0c,0x0a,0x08,0x03,0x04,0x07,0x02,0x03,0x03,0x00,0x00,
+    0x79,0x81,0xff,0xff,0xff,0xff,0xff,0xff,0x4c,0x67,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x39,0x81,0xff,0xff,0xff,0xff,0xff,0xff,0x3b,0x81,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x25,0x81,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x49,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xe5,0x52,0x77,0x0a,0x88,0xbd,0x4a,
+    0xb9,0x99,0x04,0x01,0x07,0x01,0x07,0x06,0x0e,0x00,0x06,0x04,0x04,0x0f,0x00,0x00,
+    0xe9,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0x8c,0x66,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0x7e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xb4,0x7e,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x9f,0x7e,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x38,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7d,0x7e,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x95,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x80,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x2b,0x7c,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x16,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x16,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x19,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x24,0x00,0x00,0x00,
+    0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+    0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x19,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x34,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x19,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x34,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x58,0x00,0x00,0x00,
+    0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00}};
+
+COM_PUBLIC extern const uintptr_t soMetadataHandle = reinterpret_cast<uintptr_t>(&comMetadata);
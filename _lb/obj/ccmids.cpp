@@ -0,0 +1,76 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "ccmtypes.h"
+
+namespace ccm {
+
+COM_PUBLIC extern const InterfaceID IID_IClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IClassLoader =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IWeakReference =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IWeakReferenceSource =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IReferenceObserver =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaComponent =
+        {{0x35b4d7ca,0xb66c,0x44d3,0xb4a6,{0x0,0x0,0x7,0x8,0x5,0x2,0x9,0x5,0x3,0x0,0x8,0x5}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaCoclass =
+        {{0x8fdbd639,0x39be,0x4e9f,0x801d,{0x8,0xa,0x3,0xb,0x1,0x3,0x7,0xd,0x7,0xc,0x1,0xf}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaEnumeration =
+        {{0xf23514ea,0x5b7f,0x4a16,0x85da,{0x1,0x0,0x2,0xd,0xe,0xc,0xb,0x8,0x5,0xd,0x3,0x8}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaEnumerator =
+        {{0xf508e549,0xba3f,0x4a6e,0xad4b,{0xb,0x8,0xb,0xd,0xd,0x3,0xc,0x3,0xf,0xe,0x7,0x3}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaInterface =
+        {{0xa9f54826,0x5903,0x4910,0xaf5f,{0x9,0x7,0x0,0x3,0x3,0x6,0x4,0x6,0x6,0x3,0xb,0x2}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaConstant =
+        {{0xc27054e4,0xf998,0x4eac,0x9a2c,{0x1,0x7,0xd,0x0,0x5,0xa,0xa,0x6,0xd,0xc,0xc,0xd}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaMethod =
+        {{0x684f21a0,0x6d9f,0x4784,0xb641,{0xc,0x7,0x4,0xf,0xb,0x7,0x1,0xc,0x5,0x3,0x0,0xa}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaConstructor =
+        {{0xba7707a3,0xe2f8,0x4318,0x8559,{0xf,0x1,0x2,0x9,0x4,0x0,0xf,0x0,0x2,0xb,0x2,0xe}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaParameter =
+        {{0x0f1060f0,0x93ea,0x4980,0x96b3,{0xb,0xe,0xa,0x8,0x6,0x9,0xd,0xc,0xf,0x2,0x5,0x3}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaType =
+        {{0xc9e137d6,0x2344,0x4acb,0x9a76,{0x4,0xd,0x0,0xa,0x9,0xd,0xe,0xa,0x1,0x7,0x7,0x3}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IMetaValue =
+        {{0xc0dfe841,0x80a0,0x421c,0xad0a,{0xb,0xe,0x5,0x1,0xc,0x9,0xd,0x2,0xa,0x0,0xc,0x9}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IArgumentList =
+        {{0x38c359ba,0x97b3,0x4b7b,0xbcf7,{0xc,0xd,0x5,0xf,0x6,0xb,0xb,0xe,0xd,0x6,0xe,0x9}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IParcel =
+        {{0x3d29cb55,0xf7d1,0x4b79,0x9e63,{0xa,0xd,0x1,0x4,0xa,0x5,0x7,0xf,0xd,0x9,0xf,0x1}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IInterfacePack =
+        {{0x84ee26c6,0x6c0a,0x4329,0xb627,{0x5,0x4,0xe,0x5,0xf,0xc,0x3,0xb,0x0,0x6,0xa,0x8}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IInvocationFuture =
+        {{0x34d71332,0x1fe1,0x4c8d,0x8066,{0x5,0x7,0x3,0x0,0x8,0xe,0x9,0x9,0x6,0x4,0x8,0x3}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IRPCChannel =
+        {{0xbf89f2ce,0xba5f,0x4f5d,0xa866,{0x9,0xe,0x3,0x4,0x0,0x4,0x8,0xe,0xe,0x0,0x0,0x9}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IRPCChannelFactory =
+        {{0xd1adf1f9,0x2062,0x45fd,0xaa33,{0xe,0xd,0xd,0x4,0x8,0x1,0xa,0x0,0x4,0x4,0x1,0x7}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IProxy =
+        {{0x2598f97d,0x0e6b,0x45a2,0x8c21,{0xf,0xf,0xe,0xc,0xa,0x8,0x3,0x4,0x7,0x2,0x3,0x3}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IDeathRecipient =
+        {{0x2598f97d,0x0e6b,0x45a2,0x8c21,{0xf,0xf,0xe,0xc,0xa,0x8,0x3,0x4,0x7,0x2,0x3,0x3}}, &CID_CCMRuntime};
+COM_PUBLIC extern const InterfaceID IID_IStub =
+        {{0x7752e566,0x880a,0x4abd,0x99b9,{0x4,0x1,0x7,0x1,0x7,0x6,0xe,0x0,0x6,0x4,0x4,0xf}}, &CID_CCMRuntime};
+
+
+}
+
@@ -0,0 +1,1468 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CCMRUNTIMEINTERFACES_H_GEN__
+#define __CCM_CCMRUNTIMEINTERFACES_H_GEN__
+
+#include "ccmtypes.h"
+
+namespace ccm {
+
+COM_PUBLIC extern const ComponentID CID_CCMRuntime;
+
+
+
+
+enum class IOAttribute;
+enum class RPCType;
+enum class RPCPeer;
+
+
+
+enum class IOAttribute
+{
+    UNKNOWN,
+    IN,
+    OUT,
+    IN_OUT,
+    OUT_CALLEE
+};
+
+
+enum class RPCType
+{
+    Local,
+    Remote
+};
+
+
+enum class RPCPeer
+{
+    Proxy,
+    Stub
+};
+
+
+
+
+extern const InterfaceID IID_IClassObject;
+extern const InterfaceID IID_IObject;
+extern const InterfaceID IID_IClassLoader;
+extern const InterfaceID IID_IWeakReference;
+extern const InterfaceID IID_IWeakReferenceSource;
+extern const InterfaceID IID_IReferenceObserver;
+extern const InterfaceID IID_IMetaComponent;
+extern const InterfaceID IID_IMetaCoclass;
+extern const InterfaceID IID_IMetaEnumeration;
+extern const InterfaceID IID_IMetaEnumerator;
+extern const InterfaceID IID_IMetaInterface;
+extern const InterfaceID IID_IMetaConstant;
+extern const InterfaceID IID_IMetaMethod;
+extern const InterfaceID IID_IMetaConstructor;
+extern const InterfaceID IID_IMetaParameter;
+extern const InterfaceID IID_IMetaType;
+extern const InterfaceID IID_IMetaValue;
+extern const InterfaceID IID_IArgumentList;
+extern const InterfaceID IID_IParcel;
+extern const InterfaceID IID_IInterfacePack;
+extern const InterfaceID IID_IInvocationFuture;
+extern const InterfaceID IID_IRPCChannel;
+extern const InterfaceID IID_IRPCChannelFactory;
+extern const InterfaceID IID_IProxy;
+extern const InterfaceID IID_IDeathRecipient;
+extern const InterfaceID IID_IStub;
+
+
+interface IClassObject;
+interface IObject;
+interface IClassLoader;
+interface IWeakReference;
+interface IWeakReferenceSource;
+interface IReferenceObserver;
+interface IMetaComponent;
+interface IMetaCoclass;
+interface IMetaEnumeration;
+interface IMetaEnumerator;
+interface IMetaInterface;
+interface IMetaConstant;
+interface IMetaMethod;
+interface IMetaConstructor;
+interface IMetaParameter;
+interface IMetaType;
+interface IMetaValue;
+interface IArgumentList;
+interface IParcel;
+interface IInterfacePack;
+interface IInvocationFuture;
+interface IRPCChannel;
+interface IRPCChannelFactory;
+interface IProxy;
+interface IDeathRecipient;
+interface IStub;
+
+
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000002)
+interface IClassObject : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IClassObject* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IClassObject*)object->Probe(IID_IClassObject);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IClassObject;
+    }
+
+    virtual ECode AttachMetadata(
+        /* [in] */ ccm::IMetaComponent* component) = 0;
+
+    virtual ECode GetMetadate(
+        /* [out] */ ccm::IMetaComponent** component) = 0;
+
+    virtual ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000003)
+interface IObject : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IObject* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IObject*)object->Probe(IID_IObject);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IObject;
+    }
+
+    virtual ECode AttachMetadata(
+        /* [in] */ ccm::IMetaComponent* component,
+        /* [in] */ const String& coclassName) = 0;
+
+    virtual ECode GetCoclassID(
+        /* [out] */ CoclassID* cid) = 0;
+
+    virtual ECode GetCoclass(
+        /* [out] */ ccm::IMetaCoclass** klass) = 0;
+
+    virtual ECode GetHashCode(
+        /* [out] */ Integer* hash) = 0;
+
+    virtual ECode Equals(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* same) = 0;
+
+    virtual ECode SetReferenceObserver(
+        /* [in] */ ccm::IReferenceObserver* observer) = 0;
+
+    virtual ECode ToString(
+        /* [out] */ String* desc) = 0;
+};
+
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000004)
+interface IClassLoader : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IClassLoader* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IClassLoader*)object->Probe(IID_IClassLoader);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IClassLoader;
+    }
+
+    virtual ECode LoadComponent(
+        /* [in] */ const String& path,
+        /* [out] */ ccm::IMetaComponent** component) = 0;
+
+    virtual ECode LoadComponent(
+        /* [in] */ const ComponentID& compId,
+        /* [out] */ ccm::IMetaComponent** component) = 0;
+
+    virtual ECode UnloadComponent(
+        /* [in] */ const ComponentID& compId) = 0;
+
+    virtual ECode LoadCoclass(
+        /* [in] */ const String& fullName,
+        /* [out] */ ccm::IMetaCoclass** klass) = 0;
+
+    virtual ECode LoadInterface(
+        /* [in] */ const String& fullName,
+        /* [out] */ ccm::IMetaInterface** intf) = 0;
+
+    virtual ECode GetParent(
+        /* [out] */ ccm::IClassLoader** parent) = 0;
+};
+
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000005)
+interface IWeakReference : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IWeakReference* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IWeakReference*)object->Probe(IID_IWeakReference);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IWeakReference;
+    }
+
+    virtual ECode Resolve(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000006)
+interface IWeakReferenceSource : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IWeakReferenceSource* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IWeakReferenceSource*)object->Probe(IID_IWeakReferenceSource);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IWeakReferenceSource;
+    }
+
+    virtual ECode GetWeakReference(
+        /* [out] */ ccm::IWeakReference** wr) = 0;
+};
+
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000007)
+interface IReferenceObserver : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IReferenceObserver* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IReferenceObserver*)object->Probe(IID_IReferenceObserver);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IReferenceObserver;
+    }
+
+    virtual ECode OnLastStrongRef(
+        /* [in] */ ccm::IObject* obj) = 0;
+
+    virtual ECode OnLastWeakRef(
+        /* [in] */ ccm::IObject* obj) = 0;
+};
+
+
+INTERFACE_ID(35b4d7ca-b66c-44d3-b4a6-007852953085)
+interface IMetaComponent : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMetaComponent* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaComponent*)object->Probe(IID_IMetaComponent);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaComponent;
+    }
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetComponentID(
+        /* [out] */ ComponentID* cid) = 0;
+
+    virtual ECode GetCoclassNumber(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode GetAllCoclasses(
+        /* [out] */ Array<ccm::IMetaCoclass*>& klasses) = 0;
+
+    virtual ECode GetCoclass(
+        /* [in] */ const String& fullName,
+        /* [out] */ ccm::IMetaCoclass** klass) = 0;
+
+    virtual ECode GetCoclass(
+        /* [in] */ const CoclassID& cid,
+        /* [out] */ ccm::IMetaCoclass** klass) = 0;
+
+    virtual ECode GetInterfaceNumber(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode GetAllInterfaces(
+        /* [out] */ Array<ccm::IMetaInterface*>& intfs) = 0;
+
+    virtual ECode GetInterface(
+        /* [in] */ const String& fullName,
+        /* [out] */ ccm::IMetaInterface** intf) = 0;
+
+    virtual ECode GetInterface(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IMetaInterface** intf) = 0;
+
+    virtual ECode GetEnumerationNumber(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode GetAllEnumerations(
+        /* [out] */ Array<ccm::IMetaEnumeration*>& enumns) = 0;
+
+    virtual ECode GetEnumeration(
+        /* [in] */ const String& fullName,
+        /* [out] */ ccm::IMetaEnumeration** enumn) = 0;
+
+    virtual ECode CanUnload(
+        /* [out] */ Boolean* unload) = 0;
+
+    virtual ECode Unload() = 0;
+};
+
+
+INTERFACE_ID(8fdbd639-39be-4e9f-801d-8a3b137d7c1f)
+interface IMetaCoclass : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMetaCoclass* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaCoclass*)object->Probe(IID_IMetaCoclass);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaCoclass;
+    }
+
+    virtual ECode GetComponent(
+        /* [out] */ ccm::IMetaComponent** comp) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetNamespace(
+        /* [out] */ String* ns) = 0;
+
+    virtual ECode GetCoclassID(
+        /* [out] */ CoclassID* cid) = 0;
+
+    virtual ECode GetClassLoader(
+        /* [out] */ ccm::IClassLoader** loader) = 0;
+
+    virtual ECode GetConstructorNumber(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode GetAllConstructors(
+        /* [out] */ Array<ccm::IMetaConstructor*>& constrs) = 0;
+
+    virtual ECode GetConstructor(
+        /* [in] */ const String& signature,
+        /* [out] */ ccm::IMetaConstructor** constr) = 0;
+
+    virtual ECode GetInterfaceNumber(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode GetAllInterfaces(
+        /* [out] */ Array<ccm::IMetaInterface*>& intfs) = 0;
+
+    virtual ECode GetInterface(
+        /* [in] */ const String& fullName,
+        /* [out] */ ccm::IMetaInterface** intf) = 0;
+
+    virtual ECode ContainsInterface(
+        /* [in] */ const String& fullName,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode GetMethodNumber(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode GetAllMethods(
+        /* [out] */ Array<ccm::IMetaMethod*>& methods) = 0;
+
+    virtual ECode GetMethod(
+        /* [in] */ const String& name,
+        /* [in] */ const String& signature,
+        /* [out] */ ccm::IMetaMethod** method) = 0;
+
+    virtual ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+
+INTERFACE_ID(f23514ea-5b7f-4a16-85da-102decb85d38)
+interface IMetaEnumeration : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMetaEnumeration* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaEnumeration*)object->Probe(IID_IMetaEnumeration);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaEnumeration;
+    }
+
+    virtual ECode GetComponent(
+        /* [out] */ ccm::IMetaComponent** comp) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetNamespace(
+        /* [out] */ String* ns) = 0;
+
+    virtual ECode GetEnumeratorNumber(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode GetAllEnumerators(
+        /* [out] */ Array<ccm::IMetaEnumerator*>& enumrs) = 0;
+
+    virtual ECode GetEnumerator(
+        /* [in] */ const String& name,
+        /* [out] */ ccm::IMetaEnumerator** enumr) = 0;
+};
+
+
+INTERFACE_ID(f508e549-ba3f-4a6e-ad4b-b8bdd3c3fe73)
+interface IMetaEnumerator : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMetaEnumerator* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaEnumerator*)object->Probe(IID_IMetaEnumerator);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaEnumerator;
+    }
+
+    virtual ECode GetEnumeration(
+        /* [out] */ ccm::IMetaEnumeration** enumn) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetValue(
+        /* [out] */ Integer* value) = 0;
+};
+
+
+INTERFACE_ID(a9f54826-5903-4910-af5f-9703364663b2)
+interface IMetaInterface : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMetaInterface* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaInterface*)object->Probe(IID_IMetaInterface);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaInterface;
+    }
+
+    virtual ECode GetComponent(
+        /* [out] */ ccm::IMetaComponent** comp) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetNamespace(
+        /* [out] */ String* ns) = 0;
+
+    virtual ECode GetInterfaceID(
+        /* [out] */ InterfaceID* iid) = 0;
+
+    virtual ECode GetBaseInterface(
+        /* [out] */ ccm::IMetaInterface** baseIntf) = 0;
+
+    virtual ECode GetConstantNumber(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode GetAllConstants(
+        /* [out] */ Array<ccm::IMetaConstant*>& consts) = 0;
+
+    virtual ECode GetConstant(
+        /* [in] */ const String& name,
+        /* [out] */ ccm::IMetaConstant** constt) = 0;
+
+    virtual ECode GetConstant(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::IMetaConstant** constt) = 0;
+
+    virtual ECode GetMethodNumber(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode GetAllMethods(
+        /* [out] */ Array<ccm::IMetaMethod*>& methods) = 0;
+
+    virtual ECode GetMethod(
+        /* [in] */ const String& name,
+        /* [in] */ const String& signature,
+        /* [out] */ ccm::IMetaMethod** method) = 0;
+
+    virtual ECode GetMethod(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::IMetaMethod** method) = 0;
+};
+
+
+INTERFACE_ID(c27054e4-f998-4eac-9a2c-17d05aa6dccd)
+interface IMetaConstant : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMetaConstant* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaConstant*)object->Probe(IID_IMetaConstant);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaConstant;
+    }
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetType(
+        /* [out] */ ccm::IMetaType** type) = 0;
+
+    virtual ECode GetValue(
+        /* [out] */ ccm::IMetaValue** value) = 0;
+};
+
+
+INTERFACE_ID(684f21a0-6d9f-4784-b641-c74fb71c530a)
+interface IMetaMethod : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMetaMethod* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaMethod*)object->Probe(IID_IMetaMethod);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaMethod;
+    }
+
+    virtual ECode GetInterface(
+        /* [out] */ ccm::IMetaInterface** intf) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetSignature(
+        /* [out] */ String* signature) = 0;
+
+    virtual ECode GetParameterNumber(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode GetAllParameters(
+        /* [out] */ Array<ccm::IMetaParameter*>& params) = 0;
+
+    virtual ECode GetParameter(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::IMetaParameter** param) = 0;
+
+    virtual ECode GetParameter(
+        /* [in] */ const String& name,
+        /* [out] */ ccm::IMetaParameter** param) = 0;
+
+    virtual ECode HasOutArguments(
+        /* [out] */ Boolean* outArgs) = 0;
+
+    virtual ECode IsOneway(
+        /* [out] */ Boolean* isOneway) = 0;
+
+    virtual ECode CreateArgumentList(
+        /* [out] */ ccm::IArgumentList** argList) = 0;
+
+    virtual ECode Invoke(
+        /* [in] */ ccm::IInterface* thisObject,
+        /* [in] */ ccm::IArgumentList* argList) = 0;
+};
+
+
+INTERFACE_ID(ba7707a3-e2f8-4318-8559-f12940f02b2e)
+interface IMetaConstructor : public IMetaMethod
+{
+    using IInterface::Probe;
+
+    inline static IMetaConstructor* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaConstructor*)object->Probe(IID_IMetaConstructor);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaConstructor;
+    }
+
+    virtual ECode GetCoclass(
+        /* [out] */ ccm::IMetaCoclass** klass) = 0;
+
+    virtual ECode IsDefault(
+        /* [out] */ Boolean* isDefault) = 0;
+
+    virtual ECode CreateObject(
+        /* [in] */ ccm::IArgumentList* argList,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+
+INTERFACE_ID(0f1060f0-93ea-4980-96b3-bea869dcf253)
+interface IMetaParameter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMetaParameter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaParameter*)object->Probe(IID_IMetaParameter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaParameter;
+    }
+
+    virtual ECode GetMethod(
+        /* [out] */ ccm::IMetaMethod** method) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetIndex(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetIOAttribute(
+        /* [out] */ ccm::IOAttribute* attr) = 0;
+
+    virtual ECode GetType(
+        /* [out] */ ccm::IMetaType** type) = 0;
+};
+
+
+INTERFACE_ID(c9e137d6-2344-4acb-9a76-4d0a9dea1773)
+interface IMetaType : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMetaType* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaType*)object->Probe(IID_IMetaType);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaType;
+    }
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetTypeKind(
+        /* [out] */ Integer* kind) = 0;
+
+    virtual ECode GetElementType(
+        /* [out] */ ccm::IMetaType** elemType) = 0;
+
+    virtual ECode GetPointerNumber(
+        /* [out] */ Integer* number) = 0;
+};
+
+
+INTERFACE_ID(c0dfe841-80a0-421c-ad0a-be51c9d2a0c9)
+interface IMetaValue : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMetaValue* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMetaValue*)object->Probe(IID_IMetaValue);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMetaValue;
+    }
+
+    virtual ECode GetType(
+        /* [out] */ ccm::IMetaType** type) = 0;
+
+    virtual ECode GetBooleanValue(
+        /* [out] */ Boolean* value) = 0;
+
+    virtual ECode GetCharValue(
+        /* [out] */ Char* value) = 0;
+
+    virtual ECode GetByteValue(
+        /* [out] */ Byte* value) = 0;
+
+    virtual ECode GetShortValue(
+        /* [out] */ Short* value) = 0;
+
+    virtual ECode GetIntegerValue(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetLongValue(
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode GetFloatValue(
+        /* [out] */ Float* value) = 0;
+
+    virtual ECode GetDoubleValue(
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode GetStringValue(
+        /* [out] */ String* value) = 0;
+
+    virtual ECode GetRadix(
+        /* [out] */ Integer* radix) = 0;
+};
+
+
+INTERFACE_ID(38c359ba-97b3-4b7b-bcf7-cd5f6bbed6e9)
+interface IArgumentList : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IArgumentList* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IArgumentList*)object->Probe(IID_IArgumentList);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IArgumentList;
+    }
+
+    virtual ECode GetInputArgumentOfByte(
+        /* [in] */ Integer index,
+        /* [out] */ Byte* value) = 0;
+
+    virtual ECode SetInputArgumentOfByte(
+        /* [in] */ Integer index,
+        /* [in] */ Byte value) = 0;
+
+    virtual ECode GetInputArgumentOfShort(
+        /* [in] */ Integer index,
+        /* [out] */ Short* value) = 0;
+
+    virtual ECode SetInputArgumentOfShort(
+        /* [in] */ Integer index,
+        /* [in] */ Short value) = 0;
+
+    virtual ECode GetInputArgumentOfInteger(
+        /* [in] */ Integer index,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode SetInputArgumentOfInteger(
+        /* [in] */ Integer index,
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode GetInputArgumentOfLong(
+        /* [in] */ Integer index,
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode SetInputArgumentOfLong(
+        /* [in] */ Integer index,
+        /* [in] */ Long value) = 0;
+
+    virtual ECode GetInputArgumentOfFloat(
+        /* [in] */ Integer index,
+        /* [out] */ Float* value) = 0;
+
+    virtual ECode SetInputArgumentOfFloat(
+        /* [in] */ Integer index,
+        /* [out] */ Float value) = 0;
+
+    virtual ECode GetInputArgumentOfDouble(
+        /* [in] */ Integer index,
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode SetInputArgumentOfDouble(
+        /* [in] */ Integer index,
+        /* [in] */ Double value) = 0;
+
+    virtual ECode GetInputArgumentOfChar(
+        /* [in] */ Integer index,
+        /* [out] */ Char* value) = 0;
+
+    virtual ECode SetInputArgumentOfChar(
+        /* [in] */ Integer index,
+        /* [in] */ Char value) = 0;
+
+    virtual ECode GetInputArgumentOfBoolean(
+        /* [in] */ Integer index,
+        /* [out] */ Boolean* value) = 0;
+
+    virtual ECode SetInputArgumentOfBoolean(
+        /* [in] */ Integer index,
+        /* [in] */ Boolean value) = 0;
+
+    virtual ECode GetInputArgumentOfString(
+        /* [in] */ Integer index,
+        /* [out] */ String* value) = 0;
+
+    virtual ECode SetInputArgumentOfString(
+        /* [in] */ Integer index,
+        /* [in] */ const String& value) = 0;
+
+    virtual ECode GetInputArgumentOfHANDLE(
+        /* [in] */ Integer index,
+        /* [out] */ HANDLE* value) = 0;
+
+    virtual ECode SetInputArgumentOfHANDLE(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE value) = 0;
+
+    virtual ECode GetInputArgumentOfECode(
+        /* [in] */ Integer index,
+        /* [out] */ ECode* value) = 0;
+
+    virtual ECode SetInputArgumentOfECode(
+        /* [in] */ Integer index,
+        /* [in] */ ECode value) = 0;
+
+    virtual ECode GetInputArgumentOfCoclassID(
+        /* [in] */ Integer index,
+        /* [out] */ CoclassID* value) = 0;
+
+    virtual ECode SetInputArgumentOfCoclassID(
+        /* [in] */ Integer index,
+        /* [in] */ const CoclassID& value) = 0;
+
+    virtual ECode GetInputArgumentOfComponentID(
+        /* [in] */ Integer index,
+        /* [out] */ ComponentID* value) = 0;
+
+    virtual ECode SetInputArgumentOfComponentID(
+        /* [in] */ Integer index,
+        /* [in] */ const ComponentID& value) = 0;
+
+    virtual ECode GetInputArgumentOfInterfaceID(
+        /* [in] */ Integer index,
+        /* [out] */ InterfaceID* value) = 0;
+
+    virtual ECode SetInputArgumentOfInterfaceID(
+        /* [in] */ Integer index,
+        /* [in] */ const InterfaceID& value) = 0;
+
+    virtual ECode GetInputArgumentOfArray(
+        /* [in] */ Integer index,
+        /* [out] */ HANDLE* value) = 0;
+
+    virtual ECode SetInputArgumentOfArray(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE value) = 0;
+
+    virtual ECode GetInputArgumentOfEnumeration(
+        /* [in] */ Integer index,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode SetInputArgumentOfEnumeration(
+        /* [in] */ Integer index,
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode GetInputArgumentOfInterface(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::IInterface** value) = 0;
+
+    virtual ECode SetInputArgumentOfInterface(
+        /* [in] */ Integer index,
+        /* [in] */ ccm::IInterface* value) = 0;
+
+    virtual ECode AssignOutputArgumentOfByte(
+        /* [in] */ Integer index,
+        /* [in] */ Byte value) = 0;
+
+    virtual ECode SetOutputArgumentOfByte(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfShort(
+        /* [in] */ Integer index,
+        /* [in] */ Short value) = 0;
+
+    virtual ECode SetOutputArgumentOfShort(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfInteger(
+        /* [in] */ Integer index,
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode SetOutputArgumentOfInteger(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfLong(
+        /* [in] */ Integer index,
+        /* [in] */ Long value) = 0;
+
+    virtual ECode SetOutputArgumentOfLong(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfFloat(
+        /* [in] */ Integer index,
+        /* [in] */ Float value) = 0;
+
+    virtual ECode SetOutputArgumentOfFloat(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfDouble(
+        /* [in] */ Integer index,
+        /* [in] */ Double value) = 0;
+
+    virtual ECode SetOutputArgumentOfDouble(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfChar(
+        /* [in] */ Integer index,
+        /* [in] */ Char value) = 0;
+
+    virtual ECode SetOutputArgumentOfChar(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfBoolean(
+        /* [in] */ Integer index,
+        /* [in] */ Boolean value) = 0;
+
+    virtual ECode SetOutputArgumentOfBoolean(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfString(
+        /* [in] */ Integer index,
+        /* [in] */ const String& value) = 0;
+
+    virtual ECode SetOutputArgumentOfString(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfHANDLE(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE value) = 0;
+
+    virtual ECode SetOutputArgumentOfHANDLE(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfECode(
+        /* [in] */ Integer index,
+        /* [in] */ ECode value) = 0;
+
+    virtual ECode SetOutputArgumentOfECode(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfCoclassID(
+        /* [in] */ Integer index,
+        /* [in] */ const CoclassID& value) = 0;
+
+    virtual ECode SetOutputArgumentOfCoclassID(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfComponentID(
+        /* [in] */ Integer index,
+        /* [in] */ const ComponentID& value) = 0;
+
+    virtual ECode SetOutputArgumentOfComponentID(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfInterfaceID(
+        /* [in] */ Integer index,
+        /* [in] */ const InterfaceID& value) = 0;
+
+    virtual ECode SetOutputArgumentOfInterfaceID(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfArray(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE value) = 0;
+
+    virtual ECode SetOutputArgumentOfArray(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfEnumeration(
+        /* [in] */ Integer index,
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode SetOutputArgumentOfEnumeration(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode AssignOutputArgumentOfInterface(
+        /* [in] */ Integer index,
+        /* [in] */ ccm::IInterface* value) = 0;
+
+    virtual ECode SetOutputArgumentOfInterface(
+        /* [in] */ Integer index,
+        /* [in] */ HANDLE addr) = 0;
+
+    virtual ECode GetArgumentAddress(
+        /* [in] */ Integer index,
+        /* [out] */ HANDLE* addr) = 0;
+};
+
+
+INTERFACE_ID(3d29cb55-f7d1-4b79-9e63-ad14a57fd9f1)
+interface IParcel : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IParcel* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IParcel*)object->Probe(IID_IParcel);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IParcel;
+    }
+
+    virtual ECode ReadChar(
+        /* [out] */ Char* value) = 0;
+
+    virtual ECode WriteChar(
+        /* [in] */ Char value) = 0;
+
+    virtual ECode ReadByte(
+        /* [out] */ Byte* value) = 0;
+
+    virtual ECode WriteByte(
+        /* [in] */ Byte value) = 0;
+
+    virtual ECode ReadShort(
+        /* [out] */ Short* value) = 0;
+
+    virtual ECode WriteShort(
+        /* [in] */ Short value) = 0;
+
+    virtual ECode ReadInteger(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode WriteInteger(
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode ReadLong(
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode WriteLong(
+        /* [in] */ Long value) = 0;
+
+    virtual ECode ReadFloat(
+        /* [out] */ Float* value) = 0;
+
+    virtual ECode WriteFloat(
+        /* [in] */ Float value) = 0;
+
+    virtual ECode ReadDouble(
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode WriteDouble(
+        /* [in] */ Double value) = 0;
+
+    virtual ECode ReadBoolean(
+        /* [out] */ Boolean* value) = 0;
+
+    virtual ECode WriteBoolean(
+        /* [in] */ Boolean value) = 0;
+
+    virtual ECode ReadString(
+        /* [out] */ String* value) = 0;
+
+    virtual ECode WriteString(
+        /* [in] */ const String& value) = 0;
+
+    virtual ECode ReadCoclassID(
+        /* [out] */ CoclassID* value) = 0;
+
+    virtual ECode WriteCoclassID(
+        /* [in] */ const CoclassID& value) = 0;
+
+    virtual ECode ReadComponentID(
+        /* [out] */ ComponentID* value) = 0;
+
+    virtual ECode WriteComponentID(
+        /* [in] */ const ComponentID& value) = 0;
+
+    virtual ECode ReadInterfaceID(
+        /* [out] */ InterfaceID* value) = 0;
+
+    virtual ECode WriteInterfaceID(
+        /* [in] */ const InterfaceID& value) = 0;
+
+    virtual ECode ReadECode(
+        /* [out] */ ECode* value) = 0;
+
+    virtual ECode WriteECode(
+        /* [in] */ ECode value) = 0;
+
+    virtual ECode ReadEnumeration(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode WriteEnumeration(
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode ReadArray(
+        /* [out] */ HANDLE array) = 0;
+
+    virtual ECode WriteArray(
+        /* [in] */ HANDLE array) = 0;
+
+    virtual ECode ReadInterface(
+        /* [out] */ ccm::IInterface** value) = 0;
+
+    virtual ECode WriteInterface(
+        /* [in] */ ccm::IInterface* value) = 0;
+
+    virtual ECode GetData(
+        /* [out] */ HANDLE* data) = 0;
+
+    virtual ECode GetDataSize(
+        /* [out] */ Long* size) = 0;
+
+    virtual ECode SetData(
+        /* [in] */ Byte* data,
+        /* [in] */ Long size) = 0;
+
+    virtual ECode SetDataPosition(
+        /* [in] */ Long pos) = 0;
+};
+
+
+INTERFACE_ID(84ee26c6-6c0a-4329-b627-54e5fc3b06a8)
+interface IInterfacePack : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IInterfacePack* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IInterfacePack*)object->Probe(IID_IInterfacePack);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IInterfacePack;
+    }
+
+    virtual ECode GetCoclassID(
+        /* [out] */ CoclassID* cid) = 0;
+
+    virtual ECode GetInterfaceID(
+        /* [out] */ InterfaceID* iid) = 0;
+
+    virtual ECode GetHashCode(
+        /* [out] */ Integer* hash) = 0;
+
+    virtual ECode ReadFromParcel(
+        /* [in] */ ccm::IParcel* source) = 0;
+
+    virtual ECode WriteToParcel(
+        /* [in] */ ccm::IParcel* dest) = 0;
+};
+
+
+INTERFACE_ID(34d71332-1fe1-4c8d-8066-57308e996483)
+interface IInvocationFuture : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IInvocationFuture* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IInvocationFuture*)object->Probe(IID_IInvocationFuture);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IInvocationFuture;
+    }
+
+    virtual ECode IsDone(
+        /* [out] */ Boolean* done) = 0;
+
+    virtual ECode Wait() = 0;
+
+    virtual ECode GetReply(
+        /* [out] */ ccm::IParcel** resParcel) = 0;
+};
+
+
+INTERFACE_ID(bf89f2ce-ba5f-4f5d-a866-9e34048ee009)
+interface IRPCChannel : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IRPCChannel* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IRPCChannel*)object->Probe(IID_IRPCChannel);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IRPCChannel;
+    }
+
+    virtual ECode GetRPCType(
+        /* [out] */ ccm::RPCType* type) = 0;
+
+    virtual ECode IsPeerAlive(
+        /* [out] */ Boolean* alive) = 0;
+
+    virtual ECode LinkToDeath(
+        /* [in] */ ccm::IDeathRecipient* recipient,
+        /* [in] */ HANDLE cookie = 0,
+        /* [in] */ Integer flags = 0x0) = 0;
+
+    virtual ECode UnlinkToDeath(
+        /* [in] */ ccm::IDeathRecipient* recipient,
+        /* [in] */ HANDLE cookie = 0,
+        /* [in] */ Integer flags = 0x0,
+        /* [out] */ ccm::IDeathRecipient** outRecipient = nullptr) = 0;
+
+    virtual ECode Invoke(
+        /* [in] */ ccm::IProxy* proxy,
+        /* [in] */ ccm::IMetaMethod* method,
+        /* [in] */ ccm::IParcel* argParcel,
+        /* [out] */ ccm::IParcel** resParcel) = 0;
+
+    virtual ECode InvokeAsync(
+        /* [in] */ ccm::IProxy* proxy,
+        /* [in] */ ccm::IMetaMethod* method,
+        /* [in] */ ccm::IParcel* argParcel,
+        /* [out] */ ccm::IInvocationFuture** future) = 0;
+
+    virtual ECode StartListening(
+        /* [in] */ ccm::IStub* stub) = 0;
+
+    virtual ECode Match(
+        /* [in] */ ccm::IInterfacePack* ipack,
+        /* [out] */ Boolean* matched) = 0;
+};
+
+
+INTERFACE_ID(d1adf1f9-2062-45fd-aa33-edd481a04417)
+interface IRPCChannelFactory : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IRPCChannelFactory* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IRPCChannelFactory*)object->Probe(IID_IRPCChannelFactory);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IRPCChannelFactory;
+    }
+
+    virtual ECode CreateInterfacePack(
+        /* [out] */ ccm::IInterfacePack** ipack) = 0;
+
+    virtual ECode CreateParcel(
+        /* [out] */ ccm::IParcel** parcel) = 0;
+
+    virtual ECode CreateChannel(
+        /* [in] */ ccm::RPCPeer peer,
+        /* [out] */ ccm::IRPCChannel** channel) = 0;
+
+    virtual ECode MarshalInterface(
+        /* [in] */ ccm::IInterface* object,
+        /* [out] */ ccm::IInterfacePack** ipack) = 0;
+
+    virtual ECode UnmarshalInterface(
+        /* [in] */ ccm::IInterfacePack* data,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+
+INTERFACE_ID(2598f97d-0e6b-45a2-8c21-ffeca8347233)
+interface IProxy : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IProxy* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IProxy*)object->Probe(IID_IProxy);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IProxy;
+    }
+
+    virtual ECode GetTargetCoclass(
+        /* [out] */ ccm::IMetaCoclass** target) = 0;
+
+    virtual ECode IsStubAlive(
+        /* [out] */ Boolean* alive) = 0;
+
+    virtual ECode LinkToDeath(
+        /* [in] */ ccm::IDeathRecipient* recipient,
+        /* [in] */ HANDLE cookie = 0,
+        /* [in] */ Integer flags = 0x0) = 0;
+
+    virtual ECode UnlinkToDeath(
+        /* [in] */ ccm::IDeathRecipient* recipient,
+        /* [in] */ HANDLE cookie = 0,
+        /* [in] */ Integer flags = 0x0,
+        /* [out] */ ccm::IDeathRecipient** outRecipient = nullptr) = 0;
+
+    virtual ECode InvokeAsync(
+        /* [in] */ ccm::IMetaMethod* method,
+        /* [in] */ ccm::IArgumentList* argList,
+        /* [out] */ ccm::IInvocationFuture** future) = 0;
+};
+
+
+INTERFACE_ID(2598f97d-0e6b-45a2-8c21-ffeca8347233)
+interface IDeathRecipient : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDeathRecipient* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDeathRecipient*)object->Probe(IID_IDeathRecipient);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDeathRecipient;
+    }
+
+    virtual ECode ProxyDied(
+        /* [out] */ ccm::IProxy** who) = 0;
+};
+
+
+INTERFACE_ID(7752e566-880a-4abd-99b9-417176e0644f)
+interface IStub : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStub* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStub*)object->Probe(IID_IStub);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStub;
+    }
+
+    virtual ECode Match(
+        /* [in] */ ccm::IInterfacePack* ipack,
+        /* [out] */ Boolean* matched) = 0;
+
+    virtual ECode Invoke(
+        /* [in] */ ccm::IParcel* argParcel,
+        /* [out] */ ccm::IParcel** resParcel) = 0;
+};
+
+
+
+}
+
+#endif // __CCM_CCMRUNTIMEINTERFACES_H_GEN__
\ No newline at end of file
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/appentry/entry.cpp" "src/appentry/CMakeFiles/libappentry.dir/entry.cpp.o" "gcc" "src/appentry/CMakeFiles/libappentry.dir/entry.cpp.o.d"
+  "/root/repo/_lb/src/appentry/libcore.cpp" "src/appentry/CMakeFiles/libappentry.dir/libcore.cpp.o" "gcc" "src/appentry/CMakeFiles/libappentry.dir/libcore.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
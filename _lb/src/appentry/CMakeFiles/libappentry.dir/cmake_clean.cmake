@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libappentry.dir/entry.cpp.o"
+  "CMakeFiles/libappentry.dir/entry.cpp.o.d"
+  "CMakeFiles/libappentry.dir/libcore.cpp.o"
+  "CMakeFiles/libappentry.dir/libcore.cpp.o.d"
+  "libappentry.a"
+  "libappentry.pdb"
+  "libcore.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libappentry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
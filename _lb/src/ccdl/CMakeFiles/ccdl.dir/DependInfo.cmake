@@ -0,0 +1,72 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ccdl/Options.cpp" "src/ccdl/CMakeFiles/ccdl.dir/Options.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/Options.cpp.o.d"
+  "/root/repo/src/ccdl/ast/AdditiveExpression.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/AdditiveExpression.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/AdditiveExpression.cpp.o.d"
+  "/root/repo/src/ccdl/ast/AndExpression.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/AndExpression.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/AndExpression.cpp.o.d"
+  "/root/repo/src/ccdl/ast/ArrayType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/ArrayType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/ArrayType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/BooleanType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/BooleanType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/BooleanType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/ByteType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/ByteType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/ByteType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/CharType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/CharType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/CharType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Coclass.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Coclass.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Coclass.cpp.o.d"
+  "/root/repo/src/ccdl/ast/CoclassIDType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/CoclassIDType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/CoclassIDType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/ComponentIDType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/ComponentIDType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/ComponentIDType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Constant.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Constant.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Constant.cpp.o.d"
+  "/root/repo/src/ccdl/ast/DoubleType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/DoubleType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/DoubleType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/ECodeType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/ECodeType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/ECodeType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Enumeration.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Enumeration.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Enumeration.cpp.o.d"
+  "/root/repo/src/ccdl/ast/ExclusiveOrExpression.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/ExclusiveOrExpression.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/ExclusiveOrExpression.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Expression.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Expression.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Expression.cpp.o.d"
+  "/root/repo/src/ccdl/ast/FloatType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/FloatType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/FloatType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/HANDLEType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/HANDLEType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/HANDLEType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/InclusiveOrExpression.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/InclusiveOrExpression.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/InclusiveOrExpression.cpp.o.d"
+  "/root/repo/src/ccdl/ast/IntegerType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/IntegerType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/IntegerType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Interface.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Interface.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Interface.cpp.o.d"
+  "/root/repo/src/ccdl/ast/InterfaceIDType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/InterfaceIDType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/InterfaceIDType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/LongType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/LongType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/LongType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Method.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Method.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Method.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Module.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Module.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Module.cpp.o.d"
+  "/root/repo/src/ccdl/ast/MultiplicativeExpression.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/MultiplicativeExpression.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/MultiplicativeExpression.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Namespace.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Namespace.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Namespace.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Node.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Node.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Node.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Parameter.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Parameter.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Parameter.cpp.o.d"
+  "/root/repo/src/ccdl/ast/PointerType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/PointerType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/PointerType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Pool.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Pool.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Pool.cpp.o.d"
+  "/root/repo/src/ccdl/ast/PostfixExpression.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/PostfixExpression.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/PostfixExpression.cpp.o.d"
+  "/root/repo/src/ccdl/ast/ReferenceType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/ReferenceType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/ReferenceType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/ShiftExpression.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/ShiftExpression.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/ShiftExpression.cpp.o.d"
+  "/root/repo/src/ccdl/ast/ShortType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/ShortType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/ShortType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/StringType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/StringType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/StringType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/TripleType.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/TripleType.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/TripleType.cpp.o.d"
+  "/root/repo/src/ccdl/ast/Type.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/Type.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/Type.cpp.o.d"
+  "/root/repo/src/ccdl/ast/UnaryExpression.cpp" "src/ccdl/CMakeFiles/ccdl.dir/ast/UnaryExpression.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/ast/UnaryExpression.cpp.o.d"
+  "/root/repo/src/ccdl/codegen/CodeGenerator.cpp" "src/ccdl/CMakeFiles/ccdl.dir/codegen/CodeGenerator.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/codegen/CodeGenerator.cpp.o.d"
+  "/root/repo/src/ccdl/main.cpp" "src/ccdl/CMakeFiles/ccdl.dir/main.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/main.cpp.o.d"
+  "/root/repo/src/ccdl/metadata/MetaBuilder.cpp" "src/ccdl/CMakeFiles/ccdl.dir/metadata/MetaBuilder.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/metadata/MetaBuilder.cpp.o.d"
+  "/root/repo/src/ccdl/metadata/MetaDumper.cpp" "src/ccdl/CMakeFiles/ccdl.dir/metadata/MetaDumper.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/metadata/MetaDumper.cpp.o.d"
+  "/root/repo/src/ccdl/metadata/MetaResolver.cpp" "src/ccdl/CMakeFiles/ccdl.dir/metadata/MetaResolver.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/metadata/MetaResolver.cpp.o.d"
+  "/root/repo/src/ccdl/parser/Parser.cpp" "src/ccdl/CMakeFiles/ccdl.dir/parser/Parser.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/parser/Parser.cpp.o.d"
+  "/root/repo/src/ccdl/parser/Tokenizer.cpp" "src/ccdl/CMakeFiles/ccdl.dir/parser/Tokenizer.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/parser/Tokenizer.cpp.o.d"
+  "/root/repo/src/ccdl/parser/World.cpp" "src/ccdl/CMakeFiles/ccdl.dir/parser/World.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/parser/World.cpp.o.d"
+  "/root/repo/src/ccdl/util/File.cpp" "src/ccdl/CMakeFiles/ccdl.dir/util/File.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/util/File.cpp.o.d"
+  "/root/repo/src/ccdl/util/Logger.cpp" "src/ccdl/CMakeFiles/ccdl.dir/util/Logger.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/util/Logger.cpp.o.d"
+  "/root/repo/src/ccdl/util/MetadataUtils.cpp" "src/ccdl/CMakeFiles/ccdl.dir/util/MetadataUtils.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/util/MetadataUtils.cpp.o.d"
+  "/root/repo/src/ccdl/util/String.cpp" "src/ccdl/CMakeFiles/ccdl.dir/util/String.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/util/String.cpp.o.d"
+  "/root/repo/src/ccdl/util/StringBuilder.cpp" "src/ccdl/CMakeFiles/ccdl.dir/util/StringBuilder.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/util/StringBuilder.cpp.o.d"
+  "/root/repo/src/ccdl/util/StringPool.cpp" "src/ccdl/CMakeFiles/ccdl.dir/util/StringPool.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/util/StringPool.cpp.o.d"
+  "/root/repo/src/ccdl/util/Uuid.cpp" "src/ccdl/CMakeFiles/ccdl.dir/util/Uuid.cpp.o" "gcc" "src/ccdl/CMakeFiles/ccdl.dir/util/Uuid.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,117 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccdl.dir/Options.cpp.o"
+  "CMakeFiles/ccdl.dir/Options.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/AdditiveExpression.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/AdditiveExpression.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/AndExpression.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/AndExpression.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/ArrayType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/ArrayType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/BooleanType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/BooleanType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/ByteType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/ByteType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/CharType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/CharType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Coclass.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Coclass.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/CoclassIDType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/CoclassIDType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/ComponentIDType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/ComponentIDType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Constant.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Constant.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/DoubleType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/DoubleType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/ECodeType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/ECodeType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Enumeration.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Enumeration.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/ExclusiveOrExpression.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/ExclusiveOrExpression.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Expression.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Expression.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/FloatType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/FloatType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/HANDLEType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/HANDLEType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/InclusiveOrExpression.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/InclusiveOrExpression.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/IntegerType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/IntegerType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Interface.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Interface.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/InterfaceIDType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/InterfaceIDType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/LongType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/LongType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Method.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Method.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Module.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Module.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/MultiplicativeExpression.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/MultiplicativeExpression.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Namespace.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Namespace.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Node.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Node.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Parameter.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Parameter.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/PointerType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/PointerType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Pool.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Pool.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/PostfixExpression.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/PostfixExpression.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/ReferenceType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/ReferenceType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/ShiftExpression.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/ShiftExpression.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/ShortType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/ShortType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/StringType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/StringType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/TripleType.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/TripleType.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/Type.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/Type.cpp.o.d"
+  "CMakeFiles/ccdl.dir/ast/UnaryExpression.cpp.o"
+  "CMakeFiles/ccdl.dir/ast/UnaryExpression.cpp.o.d"
+  "CMakeFiles/ccdl.dir/codegen/CodeGenerator.cpp.o"
+  "CMakeFiles/ccdl.dir/codegen/CodeGenerator.cpp.o.d"
+  "CMakeFiles/ccdl.dir/main.cpp.o"
+  "CMakeFiles/ccdl.dir/main.cpp.o.d"
+  "CMakeFiles/ccdl.dir/metadata/MetaBuilder.cpp.o"
+  "CMakeFiles/ccdl.dir/metadata/MetaBuilder.cpp.o.d"
+  "CMakeFiles/ccdl.dir/metadata/MetaDumper.cpp.o"
+  "CMakeFiles/ccdl.dir/metadata/MetaDumper.cpp.o.d"
+  "CMakeFiles/ccdl.dir/metadata/MetaResolver.cpp.o"
+  "CMakeFiles/ccdl.dir/metadata/MetaResolver.cpp.o.d"
+  "CMakeFiles/ccdl.dir/parser/Parser.cpp.o"
+  "CMakeFiles/ccdl.dir/parser/Parser.cpp.o.d"
+  "CMakeFiles/ccdl.dir/parser/Tokenizer.cpp.o"
+  "CMakeFiles/ccdl.dir/parser/Tokenizer.cpp.o.d"
+  "CMakeFiles/ccdl.dir/parser/World.cpp.o"
+  "CMakeFiles/ccdl.dir/parser/World.cpp.o.d"
+  "CMakeFiles/ccdl.dir/util/File.cpp.o"
+  "CMakeFiles/ccdl.dir/util/File.cpp.o.d"
+  "CMakeFiles/ccdl.dir/util/Logger.cpp.o"
+  "CMakeFiles/ccdl.dir/util/Logger.cpp.o.d"
+  "CMakeFiles/ccdl.dir/util/MetadataUtils.cpp.o"
+  "CMakeFiles/ccdl.dir/util/MetadataUtils.cpp.o.d"
+  "CMakeFiles/ccdl.dir/util/String.cpp.o"
+  "CMakeFiles/ccdl.dir/util/String.cpp.o.d"
+  "CMakeFiles/ccdl.dir/util/StringBuilder.cpp.o"
+  "CMakeFiles/ccdl.dir/util/StringBuilder.cpp.o.d"
+  "CMakeFiles/ccdl.dir/util/StringPool.cpp.o"
+  "CMakeFiles/ccdl.dir/util/StringPool.cpp.o.d"
+  "CMakeFiles/ccdl.dir/util/Uuid.cpp.o"
+  "CMakeFiles/ccdl.dir/util/Uuid.cpp.o.d"
+  "ccdl"
+  "ccdl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccdl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
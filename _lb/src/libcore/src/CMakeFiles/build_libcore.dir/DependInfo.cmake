@@ -0,0 +1,108 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_lb/src/libcore/src/MetadataWrapper.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CArrayHolder.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CBoolean.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CByte.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CChar.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CDouble.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CFloat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CInteger.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CLong.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CRuntimePermission.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CShort.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStackTrace.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStackTraceElement.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CString.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStringBuffer.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStringBuilder.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CSystem.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CThread.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CThreadGroup.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CThreadLocal.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CBufferedWriter.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CByteArrayOutputStream.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CDirectByteBuffer.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFile.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFileDescriptor.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFileInputStream.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFileOutputStream.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_COutputStreamWriter.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CPrintWriter.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CStringWriter.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_math_CBigDecimal.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_math_CBigInteger.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_math_CMathContext.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_misc_CFDBigInteger.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_security_CPermissions.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_security_CSecureRandom.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_security_action_CGetPropertyAction.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CAttributedCharacterIteratorAttribute.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CAttributedString.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CChoiceFormat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDateFormatField.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDateFormatSymbols.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDecimalFormat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDecimalFormatSymbols.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CFieldPosition.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CMessageFormat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CParsePosition.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CSimpleDateFormat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CArrayList.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CDate.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CFormatter.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CGregorianCalendar.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CHashMap.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CHashSet.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CHashtable.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLinkedHashMap.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLinkedHashSet.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLinkedList.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLocale.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLocaleBuilder.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CProperties.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CPropertyPermission.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CRandom.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CSimpleEntry.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CSimpleImmutableEntry.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CSimpleTimeZone.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CStringTokenizer.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CTreeMap.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CTreeSet.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CVector.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CEra.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CGregorian.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CJulianCalendar.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CLocalGregorianCalendar.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_CConcurrentHashMap.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_CConcurrentLinkedQueue.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_atomic_CAtomicBoolean.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_atomic_CAtomicInteger.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_atomic_CAtomicLong.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccmrt_system_CPathClassLoader.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_libcore_io_CLibcore.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_libcore_io_CMemoryMappedFile.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_libcore_util_CZoneInfoWallTime.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_pisces_system_CStructStat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/libcorePub.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,94 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_libcore"
+  "MetadataWrapper.cpp"
+  "_ccm_core_CArray.cpp"
+  "_ccm_core_CArrayHolder.cpp"
+  "_ccm_core_CBoolean.cpp"
+  "_ccm_core_CByte.cpp"
+  "_ccm_core_CChar.cpp"
+  "_ccm_core_CDouble.cpp"
+  "_ccm_core_CFloat.cpp"
+  "_ccm_core_CInteger.cpp"
+  "_ccm_core_CLong.cpp"
+  "_ccm_core_CRuntimePermission.cpp"
+  "_ccm_core_CShort.cpp"
+  "_ccm_core_CStackTrace.cpp"
+  "_ccm_core_CStackTraceElement.cpp"
+  "_ccm_core_CString.cpp"
+  "_ccm_core_CStringBuffer.cpp"
+  "_ccm_core_CStringBuilder.cpp"
+  "_ccm_core_CSystem.cpp"
+  "_ccm_core_CThread.cpp"
+  "_ccm_core_CThreadGroup.cpp"
+  "_ccm_core_CThreadLocal.cpp"
+  "_ccm_io_CBufferedWriter.cpp"
+  "_ccm_io_CByteArrayOutputStream.cpp"
+  "_ccm_io_CDirectByteBuffer.cpp"
+  "_ccm_io_CFile.cpp"
+  "_ccm_io_CFileDescriptor.cpp"
+  "_ccm_io_CFileInputStream.cpp"
+  "_ccm_io_CFileOutputStream.cpp"
+  "_ccm_io_COutputStreamWriter.cpp"
+  "_ccm_io_CPrintWriter.cpp"
+  "_ccm_io_CStringWriter.cpp"
+  "_ccm_math_CBigDecimal.cpp"
+  "_ccm_math_CBigInteger.cpp"
+  "_ccm_math_CMathContext.cpp"
+  "_ccm_misc_CFDBigInteger.cpp"
+  "_ccm_security_CPermissions.cpp"
+  "_ccm_security_CSecureRandom.cpp"
+  "_ccm_security_action_CGetPropertyAction.cpp"
+  "_ccm_text_CAttributedCharacterIteratorAttribute.cpp"
+  "_ccm_text_CAttributedString.cpp"
+  "_ccm_text_CChoiceFormat.cpp"
+  "_ccm_text_CDateFormatField.cpp"
+  "_ccm_text_CDateFormatSymbols.cpp"
+  "_ccm_text_CDecimalFormat.cpp"
+  "_ccm_text_CDecimalFormatSymbols.cpp"
+  "_ccm_text_CFieldPosition.cpp"
+  "_ccm_text_CMessageFormat.cpp"
+  "_ccm_text_CParsePosition.cpp"
+  "_ccm_text_CSimpleDateFormat.cpp"
+  "_ccm_util_CArrayList.cpp"
+  "_ccm_util_CDate.cpp"
+  "_ccm_util_CFormatter.cpp"
+  "_ccm_util_CGregorianCalendar.cpp"
+  "_ccm_util_CHashMap.cpp"
+  "_ccm_util_CHashSet.cpp"
+  "_ccm_util_CHashtable.cpp"
+  "_ccm_util_CLinkedHashMap.cpp"
+  "_ccm_util_CLinkedHashSet.cpp"
+  "_ccm_util_CLinkedList.cpp"
+  "_ccm_util_CLocale.cpp"
+  "_ccm_util_CLocaleBuilder.cpp"
+  "_ccm_util_CProperties.cpp"
+  "_ccm_util_CPropertyPermission.cpp"
+  "_ccm_util_CRandom.cpp"
+  "_ccm_util_CSimpleEntry.cpp"
+  "_ccm_util_CSimpleImmutableEntry.cpp"
+  "_ccm_util_CSimpleTimeZone.cpp"
+  "_ccm_util_CStringTokenizer.cpp"
+  "_ccm_util_CTreeMap.cpp"
+  "_ccm_util_CTreeSet.cpp"
+  "_ccm_util_CVector.cpp"
+  "_ccm_util_calendar_CEra.cpp"
+  "_ccm_util_calendar_CGregorian.cpp"
+  "_ccm_util_calendar_CJulianCalendar.cpp"
+  "_ccm_util_calendar_CLocalGregorianCalendar.cpp"
+  "_ccm_util_concurrent_CConcurrentHashMap.cpp"
+  "_ccm_util_concurrent_CConcurrentLinkedQueue.cpp"
+  "_ccm_util_concurrent_atomic_CAtomicBoolean.cpp"
+  "_ccm_util_concurrent_atomic_CAtomicInteger.cpp"
+  "_ccm_util_concurrent_atomic_CAtomicLong.cpp"
+  "_ccmrt_system_CPathClassLoader.cpp"
+  "_libcore_io_CLibcore.cpp"
+  "_libcore_io_CMemoryMappedFile.cpp"
+  "_libcore_util_CZoneInfoWallTime.cpp"
+  "_pisces_system_CStructStat.cpp"
+  "libcorePub.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build_libcore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
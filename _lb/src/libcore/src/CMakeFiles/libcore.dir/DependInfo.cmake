@@ -0,0 +1,213 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_lb/src/libcore/src/MetadataWrapper.cpp" "src/libcore/src/CMakeFiles/libcore.dir/MetadataWrapper.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/MetadataWrapper.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CArray.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CArray.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CArrayHolder.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CArrayHolder.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CArrayHolder.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CBoolean.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CBoolean.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CBoolean.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CByte.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CByte.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CByte.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CChar.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CChar.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CChar.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CDouble.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CDouble.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CDouble.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CFloat.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CFloat.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CFloat.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CInteger.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CInteger.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CInteger.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CLong.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CLong.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CLong.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CRuntimePermission.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CRuntimePermission.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CRuntimePermission.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CShort.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CShort.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CShort.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStackTrace.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CStackTrace.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CStackTrace.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStackTraceElement.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CStackTraceElement.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CStackTraceElement.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CString.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CString.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CString.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStringBuffer.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CStringBuffer.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CStringBuffer.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStringBuilder.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CStringBuilder.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CStringBuilder.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CSystem.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CSystem.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CSystem.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CThread.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CThread.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CThread.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CThreadGroup.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CThreadGroup.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CThreadGroup.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CThreadLocal.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CThreadLocal.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_core_CThreadLocal.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CBufferedWriter.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CBufferedWriter.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CBufferedWriter.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CByteArrayOutputStream.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CByteArrayOutputStream.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CByteArrayOutputStream.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CDirectByteBuffer.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CDirectByteBuffer.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CDirectByteBuffer.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFile.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CFile.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CFile.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFileDescriptor.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CFileDescriptor.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CFileDescriptor.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFileInputStream.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CFileInputStream.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CFileInputStream.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFileOutputStream.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CFileOutputStream.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CFileOutputStream.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_COutputStreamWriter.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_COutputStreamWriter.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_COutputStreamWriter.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CPrintWriter.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CPrintWriter.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CPrintWriter.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CStringWriter.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CStringWriter.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_io_CStringWriter.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_math_CBigDecimal.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_math_CBigDecimal.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_math_CBigDecimal.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_math_CBigInteger.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_math_CBigInteger.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_math_CBigInteger.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_math_CMathContext.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_math_CMathContext.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_math_CMathContext.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_misc_CFDBigInteger.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_misc_CFDBigInteger.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_misc_CFDBigInteger.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_security_CPermissions.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_security_CPermissions.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_security_CPermissions.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_security_CSecureRandom.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_security_CSecureRandom.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_security_CSecureRandom.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_security_action_CGetPropertyAction.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_security_action_CGetPropertyAction.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_security_action_CGetPropertyAction.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CAttributedCharacterIteratorAttribute.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CAttributedCharacterIteratorAttribute.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CAttributedCharacterIteratorAttribute.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CAttributedString.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CAttributedString.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CAttributedString.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CChoiceFormat.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CChoiceFormat.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CChoiceFormat.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDateFormatField.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CDateFormatField.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CDateFormatField.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDateFormatSymbols.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CDateFormatSymbols.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CDateFormatSymbols.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDecimalFormat.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CDecimalFormat.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CDecimalFormat.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDecimalFormatSymbols.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CDecimalFormatSymbols.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CDecimalFormatSymbols.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CFieldPosition.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CFieldPosition.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CFieldPosition.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CMessageFormat.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CMessageFormat.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CMessageFormat.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CParsePosition.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CParsePosition.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CParsePosition.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CSimpleDateFormat.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CSimpleDateFormat.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_text_CSimpleDateFormat.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CArrayList.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CArrayList.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CArrayList.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CDate.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CDate.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CDate.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CFormatter.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CFormatter.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CFormatter.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CGregorianCalendar.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CGregorianCalendar.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CGregorianCalendar.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CHashMap.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CHashMap.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CHashMap.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CHashSet.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CHashSet.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CHashSet.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CHashtable.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CHashtable.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CHashtable.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLinkedHashMap.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CLinkedHashMap.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CLinkedHashMap.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLinkedHashSet.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CLinkedHashSet.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CLinkedHashSet.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLinkedList.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CLinkedList.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CLinkedList.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLocale.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CLocale.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CLocale.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLocaleBuilder.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CLocaleBuilder.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CLocaleBuilder.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CProperties.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CProperties.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CProperties.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CPropertyPermission.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CPropertyPermission.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CPropertyPermission.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CRandom.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CRandom.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CRandom.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CSimpleEntry.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CSimpleEntry.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CSimpleEntry.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CSimpleImmutableEntry.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CSimpleImmutableEntry.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CSimpleImmutableEntry.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CSimpleTimeZone.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CSimpleTimeZone.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CSimpleTimeZone.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CStringTokenizer.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CStringTokenizer.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CStringTokenizer.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CTreeMap.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CTreeMap.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CTreeMap.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CTreeSet.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CTreeSet.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CTreeSet.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CVector.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CVector.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_CVector.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CEra.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_calendar_CEra.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_calendar_CEra.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CGregorian.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_calendar_CGregorian.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_calendar_CGregorian.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CJulianCalendar.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_calendar_CJulianCalendar.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_calendar_CJulianCalendar.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CLocalGregorianCalendar.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_calendar_CLocalGregorianCalendar.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_calendar_CLocalGregorianCalendar.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_CConcurrentHashMap.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_concurrent_CConcurrentHashMap.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_concurrent_CConcurrentHashMap.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_CConcurrentLinkedQueue.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_concurrent_CConcurrentLinkedQueue.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_concurrent_CConcurrentLinkedQueue.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_atomic_CAtomicBoolean.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicBoolean.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicBoolean.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_atomic_CAtomicInteger.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicInteger.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicInteger.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_atomic_CAtomicLong.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicLong.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicLong.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_ccmrt_system_CPathClassLoader.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_ccmrt_system_CPathClassLoader.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_ccmrt_system_CPathClassLoader.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_libcore_io_CLibcore.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_libcore_io_CLibcore.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_libcore_io_CLibcore.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_libcore_io_CMemoryMappedFile.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_libcore_io_CMemoryMappedFile.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_libcore_io_CMemoryMappedFile.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_libcore_util_CZoneInfoWallTime.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_libcore_util_CZoneInfoWallTime.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_libcore_util_CZoneInfoWallTime.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/_pisces_system_CStructStat.cpp" "src/libcore/src/CMakeFiles/libcore.dir/_pisces_system_CStructStat.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/_pisces_system_CStructStat.cpp.o.d"
+  "/root/repo/_lb/src/libcore/src/libcorePub.cpp" "src/libcore/src/CMakeFiles/libcore.dir/libcorePub.cpp.o" "gcc" "src/libcore/src/CMakeFiles/libcore.dir/libcorePub.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_lb/src/libcore/src/MetadataWrapper.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CArrayHolder.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CBoolean.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CByte.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CChar.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CDouble.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CFloat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CInteger.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CLong.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CRuntimePermission.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CShort.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStackTrace.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStackTraceElement.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CString.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStringBuffer.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CStringBuilder.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CSystem.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CThread.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CThreadGroup.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_core_CThreadLocal.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CBufferedWriter.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CByteArrayOutputStream.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CDirectByteBuffer.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFile.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFileDescriptor.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFileInputStream.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CFileOutputStream.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_COutputStreamWriter.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CPrintWriter.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_io_CStringWriter.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_math_CBigDecimal.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_math_CBigInteger.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_math_CMathContext.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_misc_CFDBigInteger.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_security_CPermissions.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_security_CSecureRandom.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_security_action_CGetPropertyAction.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CAttributedCharacterIteratorAttribute.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CAttributedString.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CChoiceFormat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDateFormatField.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDateFormatSymbols.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDecimalFormat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CDecimalFormatSymbols.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CFieldPosition.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CMessageFormat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CParsePosition.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_text_CSimpleDateFormat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CArrayList.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CDate.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CFormatter.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CGregorianCalendar.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CHashMap.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CHashSet.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CHashtable.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLinkedHashMap.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLinkedHashSet.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLinkedList.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLocale.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CLocaleBuilder.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CProperties.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CPropertyPermission.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CRandom.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CSimpleEntry.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CSimpleImmutableEntry.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CSimpleTimeZone.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CStringTokenizer.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CTreeMap.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CTreeSet.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_CVector.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CEra.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CGregorian.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CJulianCalendar.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_calendar_CLocalGregorianCalendar.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_CConcurrentHashMap.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_CConcurrentLinkedQueue.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_atomic_CAtomicBoolean.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_atomic_CAtomicInteger.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccm_util_concurrent_atomic_CAtomicLong.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_ccmrt_system_CPathClassLoader.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_libcore_io_CLibcore.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_libcore_io_CMemoryMappedFile.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_libcore_util_CZoneInfoWallTime.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/_pisces_system_CStructStat.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  "/root/repo/_lb/src/libcore/src/libcorePub.cpp" "/root/repo/_lb/src/libcore/src/_ccm_core_CArray.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_lb/src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/io/ch/CMakeFiles/ccm_io_ch.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccm/util/regex/CMakeFiles/ccm_util_regex.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/ccmrt/system/CMakeFiles/ccmrt_system.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/libcore/math/CMakeFiles/libcore_math.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/libcore/src/pisces/system/CMakeFiles/pisces_system.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
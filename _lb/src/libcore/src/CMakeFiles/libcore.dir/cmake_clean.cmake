@@ -0,0 +1,267 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libcore.dir/MetadataWrapper.cpp.o"
+  "CMakeFiles/libcore.dir/MetadataWrapper.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CArray.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CArray.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CArrayHolder.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CArrayHolder.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CBoolean.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CBoolean.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CByte.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CByte.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CChar.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CChar.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CDouble.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CDouble.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CFloat.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CFloat.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CInteger.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CInteger.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CLong.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CLong.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CRuntimePermission.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CRuntimePermission.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CShort.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CShort.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CStackTrace.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CStackTrace.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CStackTraceElement.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CStackTraceElement.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CString.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CString.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CStringBuffer.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CStringBuffer.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CStringBuilder.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CStringBuilder.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CSystem.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CSystem.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CThread.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CThread.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CThreadGroup.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CThreadGroup.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_core_CThreadLocal.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_core_CThreadLocal.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_io_CBufferedWriter.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_io_CBufferedWriter.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_io_CByteArrayOutputStream.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_io_CByteArrayOutputStream.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_io_CDirectByteBuffer.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_io_CDirectByteBuffer.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_io_CFile.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_io_CFile.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_io_CFileDescriptor.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_io_CFileDescriptor.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_io_CFileInputStream.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_io_CFileInputStream.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_io_CFileOutputStream.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_io_CFileOutputStream.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_io_COutputStreamWriter.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_io_COutputStreamWriter.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_io_CPrintWriter.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_io_CPrintWriter.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_io_CStringWriter.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_io_CStringWriter.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_math_CBigDecimal.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_math_CBigDecimal.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_math_CBigInteger.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_math_CBigInteger.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_math_CMathContext.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_math_CMathContext.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_misc_CFDBigInteger.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_misc_CFDBigInteger.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_security_CPermissions.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_security_CPermissions.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_security_CSecureRandom.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_security_CSecureRandom.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_security_action_CGetPropertyAction.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_security_action_CGetPropertyAction.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CAttributedCharacterIteratorAttribute.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CAttributedCharacterIteratorAttribute.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CAttributedString.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CAttributedString.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CChoiceFormat.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CChoiceFormat.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CDateFormatField.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CDateFormatField.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CDateFormatSymbols.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CDateFormatSymbols.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CDecimalFormat.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CDecimalFormat.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CDecimalFormatSymbols.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CDecimalFormatSymbols.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CFieldPosition.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CFieldPosition.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CMessageFormat.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CMessageFormat.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CParsePosition.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CParsePosition.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_text_CSimpleDateFormat.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_text_CSimpleDateFormat.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CArrayList.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CArrayList.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CDate.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CDate.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CFormatter.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CFormatter.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CGregorianCalendar.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CGregorianCalendar.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CHashMap.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CHashMap.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CHashSet.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CHashSet.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CHashtable.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CHashtable.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CLinkedHashMap.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CLinkedHashMap.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CLinkedHashSet.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CLinkedHashSet.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CLinkedList.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CLinkedList.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CLocale.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CLocale.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CLocaleBuilder.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CLocaleBuilder.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CProperties.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CProperties.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CPropertyPermission.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CPropertyPermission.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CRandom.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CRandom.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CSimpleEntry.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CSimpleEntry.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CSimpleImmutableEntry.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CSimpleImmutableEntry.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CSimpleTimeZone.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CSimpleTimeZone.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CStringTokenizer.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CStringTokenizer.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CTreeMap.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CTreeMap.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CTreeSet.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CTreeSet.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_CVector.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_CVector.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_calendar_CEra.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_calendar_CEra.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_calendar_CGregorian.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_calendar_CGregorian.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_calendar_CJulianCalendar.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_calendar_CJulianCalendar.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_calendar_CLocalGregorianCalendar.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_calendar_CLocalGregorianCalendar.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_concurrent_CConcurrentHashMap.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_concurrent_CConcurrentHashMap.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_concurrent_CConcurrentLinkedQueue.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_concurrent_CConcurrentLinkedQueue.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicBoolean.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicBoolean.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicInteger.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicInteger.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicLong.cpp.o"
+  "CMakeFiles/libcore.dir/_ccm_util_concurrent_atomic_CAtomicLong.cpp.o.d"
+  "CMakeFiles/libcore.dir/_ccmrt_system_CPathClassLoader.cpp.o"
+  "CMakeFiles/libcore.dir/_ccmrt_system_CPathClassLoader.cpp.o.d"
+  "CMakeFiles/libcore.dir/_libcore_io_CLibcore.cpp.o"
+  "CMakeFiles/libcore.dir/_libcore_io_CLibcore.cpp.o.d"
+  "CMakeFiles/libcore.dir/_libcore_io_CMemoryMappedFile.cpp.o"
+  "CMakeFiles/libcore.dir/_libcore_io_CMemoryMappedFile.cpp.o.d"
+  "CMakeFiles/libcore.dir/_libcore_util_CZoneInfoWallTime.cpp.o"
+  "CMakeFiles/libcore.dir/_libcore_util_CZoneInfoWallTime.cpp.o.d"
+  "CMakeFiles/libcore.dir/_pisces_system_CStructStat.cpp.o"
+  "CMakeFiles/libcore.dir/_pisces_system_CStructStat.cpp.o.d"
+  "CMakeFiles/libcore.dir/libcorePub.cpp.o"
+  "CMakeFiles/libcore.dir/libcorePub.cpp.o.d"
+  "MetadataWrapper.cpp"
+  "_ccm_core_CArray.cpp"
+  "_ccm_core_CArrayHolder.cpp"
+  "_ccm_core_CBoolean.cpp"
+  "_ccm_core_CByte.cpp"
+  "_ccm_core_CChar.cpp"
+  "_ccm_core_CDouble.cpp"
+  "_ccm_core_CFloat.cpp"
+  "_ccm_core_CInteger.cpp"
+  "_ccm_core_CLong.cpp"
+  "_ccm_core_CRuntimePermission.cpp"
+  "_ccm_core_CShort.cpp"
+  "_ccm_core_CStackTrace.cpp"
+  "_ccm_core_CStackTraceElement.cpp"
+  "_ccm_core_CString.cpp"
+  "_ccm_core_CStringBuffer.cpp"
+  "_ccm_core_CStringBuilder.cpp"
+  "_ccm_core_CSystem.cpp"
+  "_ccm_core_CThread.cpp"
+  "_ccm_core_CThreadGroup.cpp"
+  "_ccm_core_CThreadLocal.cpp"
+  "_ccm_io_CBufferedWriter.cpp"
+  "_ccm_io_CByteArrayOutputStream.cpp"
+  "_ccm_io_CDirectByteBuffer.cpp"
+  "_ccm_io_CFile.cpp"
+  "_ccm_io_CFileDescriptor.cpp"
+  "_ccm_io_CFileInputStream.cpp"
+  "_ccm_io_CFileOutputStream.cpp"
+  "_ccm_io_COutputStreamWriter.cpp"
+  "_ccm_io_CPrintWriter.cpp"
+  "_ccm_io_CStringWriter.cpp"
+  "_ccm_math_CBigDecimal.cpp"
+  "_ccm_math_CBigInteger.cpp"
+  "_ccm_math_CMathContext.cpp"
+  "_ccm_misc_CFDBigInteger.cpp"
+  "_ccm_security_CPermissions.cpp"
+  "_ccm_security_CSecureRandom.cpp"
+  "_ccm_security_action_CGetPropertyAction.cpp"
+  "_ccm_text_CAttributedCharacterIteratorAttribute.cpp"
+  "_ccm_text_CAttributedString.cpp"
+  "_ccm_text_CChoiceFormat.cpp"
+  "_ccm_text_CDateFormatField.cpp"
+  "_ccm_text_CDateFormatSymbols.cpp"
+  "_ccm_text_CDecimalFormat.cpp"
+  "_ccm_text_CDecimalFormatSymbols.cpp"
+  "_ccm_text_CFieldPosition.cpp"
+  "_ccm_text_CMessageFormat.cpp"
+  "_ccm_text_CParsePosition.cpp"
+  "_ccm_text_CSimpleDateFormat.cpp"
+  "_ccm_util_CArrayList.cpp"
+  "_ccm_util_CDate.cpp"
+  "_ccm_util_CFormatter.cpp"
+  "_ccm_util_CGregorianCalendar.cpp"
+  "_ccm_util_CHashMap.cpp"
+  "_ccm_util_CHashSet.cpp"
+  "_ccm_util_CHashtable.cpp"
+  "_ccm_util_CLinkedHashMap.cpp"
+  "_ccm_util_CLinkedHashSet.cpp"
+  "_ccm_util_CLinkedList.cpp"
+  "_ccm_util_CLocale.cpp"
+  "_ccm_util_CLocaleBuilder.cpp"
+  "_ccm_util_CProperties.cpp"
+  "_ccm_util_CPropertyPermission.cpp"
+  "_ccm_util_CRandom.cpp"
+  "_ccm_util_CSimpleEntry.cpp"
+  "_ccm_util_CSimpleImmutableEntry.cpp"
+  "_ccm_util_CSimpleTimeZone.cpp"
+  "_ccm_util_CStringTokenizer.cpp"
+  "_ccm_util_CTreeMap.cpp"
+  "_ccm_util_CTreeSet.cpp"
+  "_ccm_util_CVector.cpp"
+  "_ccm_util_calendar_CEra.cpp"
+  "_ccm_util_calendar_CGregorian.cpp"
+  "_ccm_util_calendar_CJulianCalendar.cpp"
+  "_ccm_util_calendar_CLocalGregorianCalendar.cpp"
+  "_ccm_util_concurrent_CConcurrentHashMap.cpp"
+  "_ccm_util_concurrent_CConcurrentLinkedQueue.cpp"
+  "_ccm_util_concurrent_atomic_CAtomicBoolean.cpp"
+  "_ccm_util_concurrent_atomic_CAtomicInteger.cpp"
+  "_ccm_util_concurrent_atomic_CAtomicLong.cpp"
+  "_ccmrt_system_CPathClassLoader.cpp"
+  "_libcore_io_CLibcore.cpp"
+  "_libcore_io_CMemoryMappedFile.cpp"
+  "_libcore_util_CZoneInfoWallTime.cpp"
+  "_pisces_system_CStructStat.cpp"
+  "libcore.pdb"
+  "libcore.so"
+  "libcorePub.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libcore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
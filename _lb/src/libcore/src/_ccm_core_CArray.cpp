@@ -0,0 +1,209 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CArray.h"
+#include "ccm.core.ICArrayClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CArrayClassObject
+    : public ClassObject
+    , public ICArrayClassObject
+{
+public:
+    CArrayClassObject();
+
+    ~CArrayClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& elemId,
+        /* [in] */ Long size,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CArrayClassObject* sCArrayClassObject = nullptr;
+static std::atomic<CArrayClassObject*> sCArrayCachedClassObject(nullptr);
+static Spinlock& GetCArrayClassObjectLock()
+{
+    static Spinlock sCArrayClassObjectLock;
+    return sCArrayClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CArrayClassObject, ClassObject, ICArrayClassObject);
+
+CArrayClassObject::CArrayClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CArrayClassObject::~CArrayClassObject()
+{
+    Spinlock& lock = GetCArrayClassObjectLock();
+    lock.Lock();
+    sCArrayClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CArrayClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CArrayClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CArrayClassObject::CreateObject(
+    /* [in] */ const InterfaceID& elemId,
+    /* [in] */ Long size,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CArray), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CArray* _obj = new(addr) CArray();
+    ECode ec = _obj->Constructor(elemId, size);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CArray");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCArrayClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCArrayClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCArrayClassObject == nullptr) {
+        sCArrayClassObject = new CArrayClassObject();
+    }
+    else if (sCArrayClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCArrayClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCArrayClassObject;
+    return NOERROR;
+}
+
+static CArrayClassObject* GetCachedCArrayClassObject()
+{
+    CArrayClassObject* clsObject = sCArrayCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCArrayClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCArrayCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCArrayClassObject == nullptr) {
+            sCArrayClassObject = new CArrayClassObject();
+        }
+        else if (sCArrayClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCArrayClassObject;
+        clsObject->AddRef();
+        sCArrayCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCArrayClassObjectCache()
+{
+    Spinlock& lock = GetCArrayClassObjectLock();
+    lock.Lock();
+    CArrayClassObject* clsObject = sCArrayCachedClassObject.load(std::memory_order_relaxed);
+    sCArrayCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CArray::_CArray()
+{
+    sCArrayClassObject->AddRef();
+}
+
+_CArray::~_CArray()
+{
+    sCArrayClassObject->Release();
+}
+
+ECode _CArray::New(
+    /* [in] */ const InterfaceID& elemId,
+    /* [in] */ Long size,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CArrayClassObject* cachedClsObject = GetCachedCArrayClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(elemId, size, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CArray, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICArrayClassObject::Probe(clsObject)->CreateObject(elemId, size, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CArrayHolder.h"
+#include "ccm.core.ICArrayHolderClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CArrayHolderClassObject
+    : public ClassObject
+    , public ICArrayHolderClassObject
+{
+public:
+    CArrayHolderClassObject();
+
+    ~CArrayHolderClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const Triple& array,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CArrayHolderClassObject* sCArrayHolderClassObject = nullptr;
+static std::atomic<CArrayHolderClassObject*> sCArrayHolderCachedClassObject(nullptr);
+static Spinlock& GetCArrayHolderClassObjectLock()
+{
+    static Spinlock sCArrayHolderClassObjectLock;
+    return sCArrayHolderClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CArrayHolderClassObject, ClassObject, ICArrayHolderClassObject);
+
+CArrayHolderClassObject::CArrayHolderClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CArrayHolderClassObject::~CArrayHolderClassObject()
+{
+    Spinlock& lock = GetCArrayHolderClassObjectLock();
+    lock.Lock();
+    sCArrayHolderClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CArrayHolderClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CArrayHolderClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CArrayHolderClassObject::CreateObject(
+    /* [in] */ const Triple& array,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CArrayHolder), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CArrayHolder* _obj = new(addr) CArrayHolder();
+    ECode ec = _obj->Constructor(array);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CArrayHolder");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCArrayHolderClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCArrayHolderClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCArrayHolderClassObject == nullptr) {
+        sCArrayHolderClassObject = new CArrayHolderClassObject();
+    }
+    else if (sCArrayHolderClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCArrayHolderClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCArrayHolderClassObject;
+    return NOERROR;
+}
+
+static CArrayHolderClassObject* GetCachedCArrayHolderClassObject()
+{
+    CArrayHolderClassObject* clsObject = sCArrayHolderCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCArrayHolderClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCArrayHolderCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCArrayHolderClassObject == nullptr) {
+            sCArrayHolderClassObject = new CArrayHolderClassObject();
+        }
+        else if (sCArrayHolderClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCArrayHolderClassObject;
+        clsObject->AddRef();
+        sCArrayHolderCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCArrayHolderClassObjectCache()
+{
+    Spinlock& lock = GetCArrayHolderClassObjectLock();
+    lock.Lock();
+    CArrayHolderClassObject* clsObject = sCArrayHolderCachedClassObject.load(std::memory_order_relaxed);
+    sCArrayHolderCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CArrayHolder::_CArrayHolder()
+{
+    sCArrayHolderClassObject->AddRef();
+}
+
+_CArrayHolder::~_CArrayHolder()
+{
+    sCArrayHolderClassObject->Release();
+}
+
+ECode _CArrayHolder::New(
+    /* [in] */ const Triple& array,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CArrayHolderClassObject* cachedClsObject = GetCachedCArrayHolderClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(array, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CArrayHolder, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICArrayHolderClassObject::Probe(clsObject)->CreateObject(array, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
@@ -0,0 +1,46 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_CARRAYHOLDER_H_GEN__
+#define __CCM_CORE_CARRAYHOLDER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const CoclassID CID_CArrayHolder;
+
+COCLASS_ID(f608b0cd-d0af-4adb-a2a4-6f241136b992)
+class _CArrayHolder
+{
+public:
+    _CArrayHolder();
+
+    virtual ~_CArrayHolder();
+
+    static ECode New(
+        /* [in] */ const Triple& array,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_CARRAYHOLDER_H_GEN__
@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CBoolean.h"
+#include "ccm.core.ICBooleanClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CBooleanClassObject
+    : public ClassObject
+    , public ICBooleanClassObject
+{
+public:
+    CBooleanClassObject();
+
+    ~CBooleanClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Boolean value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CBooleanClassObject* sCBooleanClassObject = nullptr;
+static std::atomic<CBooleanClassObject*> sCBooleanCachedClassObject(nullptr);
+static Spinlock& GetCBooleanClassObjectLock()
+{
+    static Spinlock sCBooleanClassObjectLock;
+    return sCBooleanClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CBooleanClassObject, ClassObject, ICBooleanClassObject);
+
+CBooleanClassObject::CBooleanClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CBooleanClassObject::~CBooleanClassObject()
+{
+    Spinlock& lock = GetCBooleanClassObjectLock();
+    lock.Lock();
+    sCBooleanClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CBooleanClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CBooleanClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CBooleanClassObject::CreateObject(
+    /* [in] */ Boolean value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBoolean), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBoolean* _obj = new(addr) CBoolean();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CBoolean");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCBooleanClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCBooleanClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCBooleanClassObject == nullptr) {
+        sCBooleanClassObject = new CBooleanClassObject();
+    }
+    else if (sCBooleanClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCBooleanClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCBooleanClassObject;
+    return NOERROR;
+}
+
+static CBooleanClassObject* GetCachedCBooleanClassObject()
+{
+    CBooleanClassObject* clsObject = sCBooleanCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCBooleanClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCBooleanCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCBooleanClassObject == nullptr) {
+            sCBooleanClassObject = new CBooleanClassObject();
+        }
+        else if (sCBooleanClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCBooleanClassObject;
+        clsObject->AddRef();
+        sCBooleanCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCBooleanClassObjectCache()
+{
+    Spinlock& lock = GetCBooleanClassObjectLock();
+    lock.Lock();
+    CBooleanClassObject* clsObject = sCBooleanCachedClassObject.load(std::memory_order_relaxed);
+    sCBooleanCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CBoolean::_CBoolean()
+{
+    sCBooleanClassObject->AddRef();
+}
+
+_CBoolean::~_CBoolean()
+{
+    sCBooleanClassObject->Release();
+}
+
+ECode _CBoolean::New(
+    /* [in] */ Boolean value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBooleanClassObject* cachedClsObject = GetCachedCBooleanClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBoolean, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBooleanClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
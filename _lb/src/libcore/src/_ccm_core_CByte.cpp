@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CByte.h"
+#include "ccm.core.ICByteClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CByteClassObject
+    : public ClassObject
+    , public ICByteClassObject
+{
+public:
+    CByteClassObject();
+
+    ~CByteClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Byte value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CByteClassObject* sCByteClassObject = nullptr;
+static std::atomic<CByteClassObject*> sCByteCachedClassObject(nullptr);
+static Spinlock& GetCByteClassObjectLock()
+{
+    static Spinlock sCByteClassObjectLock;
+    return sCByteClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CByteClassObject, ClassObject, ICByteClassObject);
+
+CByteClassObject::CByteClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CByteClassObject::~CByteClassObject()
+{
+    Spinlock& lock = GetCByteClassObjectLock();
+    lock.Lock();
+    sCByteClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CByteClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CByteClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CByteClassObject::CreateObject(
+    /* [in] */ Byte value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CByte), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CByte* _obj = new(addr) CByte();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CByte");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCByteClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCByteClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCByteClassObject == nullptr) {
+        sCByteClassObject = new CByteClassObject();
+    }
+    else if (sCByteClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCByteClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCByteClassObject;
+    return NOERROR;
+}
+
+static CByteClassObject* GetCachedCByteClassObject()
+{
+    CByteClassObject* clsObject = sCByteCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCByteClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCByteCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCByteClassObject == nullptr) {
+            sCByteClassObject = new CByteClassObject();
+        }
+        else if (sCByteClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCByteClassObject;
+        clsObject->AddRef();
+        sCByteCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCByteClassObjectCache()
+{
+    Spinlock& lock = GetCByteClassObjectLock();
+    lock.Lock();
+    CByteClassObject* clsObject = sCByteCachedClassObject.load(std::memory_order_relaxed);
+    sCByteCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CByte::_CByte()
+{
+    sCByteClassObject->AddRef();
+}
+
+_CByte::~_CByte()
+{
+    sCByteClassObject->Release();
+}
+
+ECode _CByte::New(
+    /* [in] */ Byte value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CByteClassObject* cachedClsObject = GetCachedCByteClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CByte, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICByteClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
@@ -0,0 +1,46 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_CBYTE_H_GEN__
+#define __CCM_CORE_CBYTE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const CoclassID CID_CByte;
+
+COCLASS_ID(bdf665c0-8a7a-4621-ba55-e6a097dfc85d)
+class _CByte
+{
+public:
+    _CByte();
+
+    virtual ~_CByte();
+
+    static ECode New(
+        /* [in] */ Byte value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_CBYTE_H_GEN__
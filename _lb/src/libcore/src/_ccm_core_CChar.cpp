@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CChar.h"
+#include "ccm.core.ICCharClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CCharClassObject
+    : public ClassObject
+    , public ICCharClassObject
+{
+public:
+    CCharClassObject();
+
+    ~CCharClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Char value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CCharClassObject* sCCharClassObject = nullptr;
+static std::atomic<CCharClassObject*> sCCharCachedClassObject(nullptr);
+static Spinlock& GetCCharClassObjectLock()
+{
+    static Spinlock sCCharClassObjectLock;
+    return sCCharClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CCharClassObject, ClassObject, ICCharClassObject);
+
+CCharClassObject::CCharClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CCharClassObject::~CCharClassObject()
+{
+    Spinlock& lock = GetCCharClassObjectLock();
+    lock.Lock();
+    sCCharClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CCharClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CCharClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CCharClassObject::CreateObject(
+    /* [in] */ Char value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CChar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CChar* _obj = new(addr) CChar();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CChar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCCharClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCCharClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCCharClassObject == nullptr) {
+        sCCharClassObject = new CCharClassObject();
+    }
+    else if (sCCharClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCCharClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCCharClassObject;
+    return NOERROR;
+}
+
+static CCharClassObject* GetCachedCCharClassObject()
+{
+    CCharClassObject* clsObject = sCCharCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCCharClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCCharCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCCharClassObject == nullptr) {
+            sCCharClassObject = new CCharClassObject();
+        }
+        else if (sCCharClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCCharClassObject;
+        clsObject->AddRef();
+        sCCharCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCCharClassObjectCache()
+{
+    Spinlock& lock = GetCCharClassObjectLock();
+    lock.Lock();
+    CCharClassObject* clsObject = sCCharCachedClassObject.load(std::memory_order_relaxed);
+    sCCharCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CChar::_CChar()
+{
+    sCCharClassObject->AddRef();
+}
+
+_CChar::~_CChar()
+{
+    sCCharClassObject->Release();
+}
+
+ECode _CChar::New(
+    /* [in] */ Char value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CCharClassObject* cachedClsObject = GetCachedCCharClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CChar, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICCharClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
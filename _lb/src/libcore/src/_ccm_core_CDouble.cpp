@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CDouble.h"
+#include "ccm.core.ICDoubleClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CDoubleClassObject
+    : public ClassObject
+    , public ICDoubleClassObject
+{
+public:
+    CDoubleClassObject();
+
+    ~CDoubleClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Double value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CDoubleClassObject* sCDoubleClassObject = nullptr;
+static std::atomic<CDoubleClassObject*> sCDoubleCachedClassObject(nullptr);
+static Spinlock& GetCDoubleClassObjectLock()
+{
+    static Spinlock sCDoubleClassObjectLock;
+    return sCDoubleClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CDoubleClassObject, ClassObject, ICDoubleClassObject);
+
+CDoubleClassObject::CDoubleClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CDoubleClassObject::~CDoubleClassObject()
+{
+    Spinlock& lock = GetCDoubleClassObjectLock();
+    lock.Lock();
+    sCDoubleClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CDoubleClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CDoubleClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CDoubleClassObject::CreateObject(
+    /* [in] */ Double value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDouble), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDouble* _obj = new(addr) CDouble();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CDouble");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCDoubleClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCDoubleClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCDoubleClassObject == nullptr) {
+        sCDoubleClassObject = new CDoubleClassObject();
+    }
+    else if (sCDoubleClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCDoubleClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCDoubleClassObject;
+    return NOERROR;
+}
+
+static CDoubleClassObject* GetCachedCDoubleClassObject()
+{
+    CDoubleClassObject* clsObject = sCDoubleCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCDoubleClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCDoubleCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCDoubleClassObject == nullptr) {
+            sCDoubleClassObject = new CDoubleClassObject();
+        }
+        else if (sCDoubleClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCDoubleClassObject;
+        clsObject->AddRef();
+        sCDoubleCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCDoubleClassObjectCache()
+{
+    Spinlock& lock = GetCDoubleClassObjectLock();
+    lock.Lock();
+    CDoubleClassObject* clsObject = sCDoubleCachedClassObject.load(std::memory_order_relaxed);
+    sCDoubleCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CDouble::_CDouble()
+{
+    sCDoubleClassObject->AddRef();
+}
+
+_CDouble::~_CDouble()
+{
+    sCDoubleClassObject->Release();
+}
+
+ECode _CDouble::New(
+    /* [in] */ Double value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDoubleClassObject* cachedClsObject = GetCachedCDoubleClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDouble, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDoubleClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CFloat.h"
+#include "ccm.core.ICFloatClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CFloatClassObject
+    : public ClassObject
+    , public ICFloatClassObject
+{
+public:
+    CFloatClassObject();
+
+    ~CFloatClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Float value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CFloatClassObject* sCFloatClassObject = nullptr;
+static std::atomic<CFloatClassObject*> sCFloatCachedClassObject(nullptr);
+static Spinlock& GetCFloatClassObjectLock()
+{
+    static Spinlock sCFloatClassObjectLock;
+    return sCFloatClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CFloatClassObject, ClassObject, ICFloatClassObject);
+
+CFloatClassObject::CFloatClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CFloatClassObject::~CFloatClassObject()
+{
+    Spinlock& lock = GetCFloatClassObjectLock();
+    lock.Lock();
+    sCFloatClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CFloatClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CFloatClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CFloatClassObject::CreateObject(
+    /* [in] */ Float value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFloat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFloat* _obj = new(addr) CFloat();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CFloat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCFloatClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCFloatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCFloatClassObject == nullptr) {
+        sCFloatClassObject = new CFloatClassObject();
+    }
+    else if (sCFloatClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCFloatClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCFloatClassObject;
+    return NOERROR;
+}
+
+static CFloatClassObject* GetCachedCFloatClassObject()
+{
+    CFloatClassObject* clsObject = sCFloatCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCFloatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCFloatCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCFloatClassObject == nullptr) {
+            sCFloatClassObject = new CFloatClassObject();
+        }
+        else if (sCFloatClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCFloatClassObject;
+        clsObject->AddRef();
+        sCFloatCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCFloatClassObjectCache()
+{
+    Spinlock& lock = GetCFloatClassObjectLock();
+    lock.Lock();
+    CFloatClassObject* clsObject = sCFloatCachedClassObject.load(std::memory_order_relaxed);
+    sCFloatCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CFloat::_CFloat()
+{
+    sCFloatClassObject->AddRef();
+}
+
+_CFloat::~_CFloat()
+{
+    sCFloatClassObject->Release();
+}
+
+ECode _CFloat::New(
+    /* [in] */ Float value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFloatClassObject* cachedClsObject = GetCachedCFloatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFloat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFloatClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
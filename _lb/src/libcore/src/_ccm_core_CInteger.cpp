@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CInteger.h"
+#include "ccm.core.ICIntegerClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CIntegerClassObject
+    : public ClassObject
+    , public ICIntegerClassObject
+{
+public:
+    CIntegerClassObject();
+
+    ~CIntegerClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Integer value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CIntegerClassObject* sCIntegerClassObject = nullptr;
+static std::atomic<CIntegerClassObject*> sCIntegerCachedClassObject(nullptr);
+static Spinlock& GetCIntegerClassObjectLock()
+{
+    static Spinlock sCIntegerClassObjectLock;
+    return sCIntegerClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CIntegerClassObject, ClassObject, ICIntegerClassObject);
+
+CIntegerClassObject::CIntegerClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CIntegerClassObject::~CIntegerClassObject()
+{
+    Spinlock& lock = GetCIntegerClassObjectLock();
+    lock.Lock();
+    sCIntegerClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CIntegerClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CIntegerClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CIntegerClassObject::CreateObject(
+    /* [in] */ Integer value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CInteger), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CInteger* _obj = new(addr) CInteger();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CInteger");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCIntegerClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCIntegerClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCIntegerClassObject == nullptr) {
+        sCIntegerClassObject = new CIntegerClassObject();
+    }
+    else if (sCIntegerClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCIntegerClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCIntegerClassObject;
+    return NOERROR;
+}
+
+static CIntegerClassObject* GetCachedCIntegerClassObject()
+{
+    CIntegerClassObject* clsObject = sCIntegerCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCIntegerClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCIntegerCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCIntegerClassObject == nullptr) {
+            sCIntegerClassObject = new CIntegerClassObject();
+        }
+        else if (sCIntegerClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCIntegerClassObject;
+        clsObject->AddRef();
+        sCIntegerCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCIntegerClassObjectCache()
+{
+    Spinlock& lock = GetCIntegerClassObjectLock();
+    lock.Lock();
+    CIntegerClassObject* clsObject = sCIntegerCachedClassObject.load(std::memory_order_relaxed);
+    sCIntegerCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CInteger::_CInteger()
+{
+    sCIntegerClassObject->AddRef();
+}
+
+_CInteger::~_CInteger()
+{
+    sCIntegerClassObject->Release();
+}
+
+ECode _CInteger::New(
+    /* [in] */ Integer value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CIntegerClassObject* cachedClsObject = GetCachedCIntegerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CInteger, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICIntegerClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
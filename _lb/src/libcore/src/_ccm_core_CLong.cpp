@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CLong.h"
+#include "ccm.core.ICLongClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CLongClassObject
+    : public ClassObject
+    , public ICLongClassObject
+{
+public:
+    CLongClassObject();
+
+    ~CLongClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Long value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CLongClassObject* sCLongClassObject = nullptr;
+static std::atomic<CLongClassObject*> sCLongCachedClassObject(nullptr);
+static Spinlock& GetCLongClassObjectLock()
+{
+    static Spinlock sCLongClassObjectLock;
+    return sCLongClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CLongClassObject, ClassObject, ICLongClassObject);
+
+CLongClassObject::CLongClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CLongClassObject::~CLongClassObject()
+{
+    Spinlock& lock = GetCLongClassObjectLock();
+    lock.Lock();
+    sCLongClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CLongClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CLongClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CLongClassObject::CreateObject(
+    /* [in] */ Long value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLong), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLong* _obj = new(addr) CLong();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CLong");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCLongClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCLongClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCLongClassObject == nullptr) {
+        sCLongClassObject = new CLongClassObject();
+    }
+    else if (sCLongClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCLongClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCLongClassObject;
+    return NOERROR;
+}
+
+static CLongClassObject* GetCachedCLongClassObject()
+{
+    CLongClassObject* clsObject = sCLongCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCLongClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCLongCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCLongClassObject == nullptr) {
+            sCLongClassObject = new CLongClassObject();
+        }
+        else if (sCLongClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCLongClassObject;
+        clsObject->AddRef();
+        sCLongCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCLongClassObjectCache()
+{
+    Spinlock& lock = GetCLongClassObjectLock();
+    lock.Lock();
+    CLongClassObject* clsObject = sCLongCachedClassObject.load(std::memory_order_relaxed);
+    sCLongCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CLong::_CLong()
+{
+    sCLongClassObject->AddRef();
+}
+
+_CLong::~_CLong()
+{
+    sCLongClassObject->Release();
+}
+
+ECode _CLong::New(
+    /* [in] */ Long value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLongClassObject* cachedClsObject = GetCachedCLongClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLong, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLongClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
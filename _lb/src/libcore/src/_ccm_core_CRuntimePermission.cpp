@@ -0,0 +1,252 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CRuntimePermission.h"
+#include "ccm.core.ICRuntimePermissionClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CRuntimePermissionClassObject
+    : public ClassObject
+    , public ICRuntimePermissionClassObject
+{
+public:
+    CRuntimePermissionClassObject();
+
+    ~CRuntimePermissionClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& name,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& name,
+        /* [in] */ const String& actions,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CRuntimePermissionClassObject* sCRuntimePermissionClassObject = nullptr;
+static std::atomic<CRuntimePermissionClassObject*> sCRuntimePermissionCachedClassObject(nullptr);
+static Spinlock& GetCRuntimePermissionClassObjectLock()
+{
+    static Spinlock sCRuntimePermissionClassObjectLock;
+    return sCRuntimePermissionClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CRuntimePermissionClassObject, ClassObject, ICRuntimePermissionClassObject);
+
+CRuntimePermissionClassObject::CRuntimePermissionClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CRuntimePermissionClassObject::~CRuntimePermissionClassObject()
+{
+    Spinlock& lock = GetCRuntimePermissionClassObjectLock();
+    lock.Lock();
+    sCRuntimePermissionClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CRuntimePermissionClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CRuntimePermissionClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CRuntimePermissionClassObject::CreateObject(
+    /* [in] */ const String& name,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CRuntimePermission), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CRuntimePermission* _obj = new(addr) CRuntimePermission();
+    ECode ec = _obj->Constructor(name);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CRuntimePermission");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CRuntimePermissionClassObject::CreateObject(
+    /* [in] */ const String& name,
+    /* [in] */ const String& actions,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CRuntimePermission), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CRuntimePermission* _obj = new(addr) CRuntimePermission();
+    ECode ec = _obj->Constructor(name, actions);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CRuntimePermission");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCRuntimePermissionClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCRuntimePermissionClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCRuntimePermissionClassObject == nullptr) {
+        sCRuntimePermissionClassObject = new CRuntimePermissionClassObject();
+    }
+    else if (sCRuntimePermissionClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCRuntimePermissionClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCRuntimePermissionClassObject;
+    return NOERROR;
+}
+
+static CRuntimePermissionClassObject* GetCachedCRuntimePermissionClassObject()
+{
+    CRuntimePermissionClassObject* clsObject = sCRuntimePermissionCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCRuntimePermissionClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCRuntimePermissionCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCRuntimePermissionClassObject == nullptr) {
+            sCRuntimePermissionClassObject = new CRuntimePermissionClassObject();
+        }
+        else if (sCRuntimePermissionClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCRuntimePermissionClassObject;
+        clsObject->AddRef();
+        sCRuntimePermissionCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCRuntimePermissionClassObjectCache()
+{
+    Spinlock& lock = GetCRuntimePermissionClassObjectLock();
+    lock.Lock();
+    CRuntimePermissionClassObject* clsObject = sCRuntimePermissionCachedClassObject.load(std::memory_order_relaxed);
+    sCRuntimePermissionCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CRuntimePermission::_CRuntimePermission()
+{
+    sCRuntimePermissionClassObject->AddRef();
+}
+
+_CRuntimePermission::~_CRuntimePermission()
+{
+    sCRuntimePermissionClassObject->Release();
+}
+
+ECode _CRuntimePermission::New(
+    /* [in] */ const String& name,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CRuntimePermissionClassObject* cachedClsObject = GetCachedCRuntimePermissionClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(name, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CRuntimePermission, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICRuntimePermissionClassObject::Probe(clsObject)->CreateObject(name, iid, object);
+};
+
+ECode _CRuntimePermission::New(
+    /* [in] */ const String& name,
+    /* [in] */ const String& actions,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CRuntimePermissionClassObject* cachedClsObject = GetCachedCRuntimePermissionClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(name, actions, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CRuntimePermission, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICRuntimePermissionClassObject::Probe(clsObject)->CreateObject(name, actions, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
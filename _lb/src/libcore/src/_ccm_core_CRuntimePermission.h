@@ -0,0 +1,52 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_CRUNTIMEPERMISSION_H_GEN__
+#define __CCM_CORE_CRUNTIMEPERMISSION_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const CoclassID CID_CRuntimePermission;
+
+COCLASS_ID(106e254e-0909-4238-8db4-2e343715c9ad)
+class _CRuntimePermission
+{
+public:
+    _CRuntimePermission();
+
+    virtual ~_CRuntimePermission();
+
+    static ECode New(
+        /* [in] */ const String& name,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const String& name,
+        /* [in] */ const String& actions,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_CRUNTIMEPERMISSION_H_GEN__
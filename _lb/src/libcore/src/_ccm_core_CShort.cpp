@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CShort.h"
+#include "ccm.core.ICShortClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CShortClassObject
+    : public ClassObject
+    , public ICShortClassObject
+{
+public:
+    CShortClassObject();
+
+    ~CShortClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Short value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CShortClassObject* sCShortClassObject = nullptr;
+static std::atomic<CShortClassObject*> sCShortCachedClassObject(nullptr);
+static Spinlock& GetCShortClassObjectLock()
+{
+    static Spinlock sCShortClassObjectLock;
+    return sCShortClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CShortClassObject, ClassObject, ICShortClassObject);
+
+CShortClassObject::CShortClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CShortClassObject::~CShortClassObject()
+{
+    Spinlock& lock = GetCShortClassObjectLock();
+    lock.Lock();
+    sCShortClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CShortClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CShortClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CShortClassObject::CreateObject(
+    /* [in] */ Short value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CShort), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CShort* _obj = new(addr) CShort();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CShort");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCShortClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCShortClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCShortClassObject == nullptr) {
+        sCShortClassObject = new CShortClassObject();
+    }
+    else if (sCShortClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCShortClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCShortClassObject;
+    return NOERROR;
+}
+
+static CShortClassObject* GetCachedCShortClassObject()
+{
+    CShortClassObject* clsObject = sCShortCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCShortClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCShortCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCShortClassObject == nullptr) {
+            sCShortClassObject = new CShortClassObject();
+        }
+        else if (sCShortClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCShortClassObject;
+        clsObject->AddRef();
+        sCShortCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCShortClassObjectCache()
+{
+    Spinlock& lock = GetCShortClassObjectLock();
+    lock.Lock();
+    CShortClassObject* clsObject = sCShortCachedClassObject.load(std::memory_order_relaxed);
+    sCShortCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CShort::_CShort()
+{
+    sCShortClassObject->AddRef();
+}
+
+_CShort::~_CShort()
+{
+    sCShortClassObject->Release();
+}
+
+ECode _CShort::New(
+    /* [in] */ Short value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CShortClassObject* cachedClsObject = GetCachedCShortClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CShort, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICShortClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
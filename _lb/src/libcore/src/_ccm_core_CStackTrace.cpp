@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CStackTrace.h"
+#include "ccm.core.ICStackTraceClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CStackTraceClassObject
+    : public ClassObject
+    , public ICStackTraceClassObject
+{
+public:
+    CStackTraceClassObject();
+
+    ~CStackTraceClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& message,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CStackTraceClassObject* sCStackTraceClassObject = nullptr;
+static std::atomic<CStackTraceClassObject*> sCStackTraceCachedClassObject(nullptr);
+static Spinlock& GetCStackTraceClassObjectLock()
+{
+    static Spinlock sCStackTraceClassObjectLock;
+    return sCStackTraceClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CStackTraceClassObject, ClassObject, ICStackTraceClassObject);
+
+CStackTraceClassObject::CStackTraceClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CStackTraceClassObject::~CStackTraceClassObject()
+{
+    Spinlock& lock = GetCStackTraceClassObjectLock();
+    lock.Lock();
+    sCStackTraceClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CStackTraceClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CStackTraceClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStackTrace), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStackTrace* _obj = new(addr) CStackTrace();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStackTrace");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CStackTraceClassObject::CreateObject(
+    /* [in] */ const String& message,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStackTrace), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStackTrace* _obj = new(addr) CStackTrace();
+    ECode ec = _obj->Constructor(message);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStackTrace");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCStackTraceClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCStackTraceClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCStackTraceClassObject == nullptr) {
+        sCStackTraceClassObject = new CStackTraceClassObject();
+    }
+    else if (sCStackTraceClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCStackTraceClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCStackTraceClassObject;
+    return NOERROR;
+}
+
+static CStackTraceClassObject* GetCachedCStackTraceClassObject()
+{
+    CStackTraceClassObject* clsObject = sCStackTraceCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCStackTraceClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCStackTraceCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCStackTraceClassObject == nullptr) {
+            sCStackTraceClassObject = new CStackTraceClassObject();
+        }
+        else if (sCStackTraceClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCStackTraceClassObject;
+        clsObject->AddRef();
+        sCStackTraceCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCStackTraceClassObjectCache()
+{
+    Spinlock& lock = GetCStackTraceClassObjectLock();
+    lock.Lock();
+    CStackTraceClassObject* clsObject = sCStackTraceCachedClassObject.load(std::memory_order_relaxed);
+    sCStackTraceCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CStackTrace::_CStackTrace()
+{
+    sCStackTraceClassObject->AddRef();
+}
+
+_CStackTrace::~_CStackTrace()
+{
+    sCStackTraceClassObject->Release();
+}
+
+ECode _CStackTrace::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStackTraceClassObject* cachedClsObject = GetCachedCStackTraceClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CStackTrace, iid, nullptr, object);
+};
+
+ECode _CStackTrace::New(
+    /* [in] */ const String& message,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStackTraceClassObject* cachedClsObject = GetCachedCStackTraceClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(message, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStackTrace, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStackTraceClassObject::Probe(clsObject)->CreateObject(message, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
@@ -0,0 +1,215 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CStackTraceElement.h"
+#include "ccm.core.ICStackTraceElementClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CStackTraceElementClassObject
+    : public ClassObject
+    , public ICStackTraceElementClassObject
+{
+public:
+    CStackTraceElementClassObject();
+
+    ~CStackTraceElementClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& no,
+        /* [in] */ const String& pc,
+        /* [in] */ const String& soname,
+        /* [in] */ const String& symbol,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CStackTraceElementClassObject* sCStackTraceElementClassObject = nullptr;
+static std::atomic<CStackTraceElementClassObject*> sCStackTraceElementCachedClassObject(nullptr);
+static Spinlock& GetCStackTraceElementClassObjectLock()
+{
+    static Spinlock sCStackTraceElementClassObjectLock;
+    return sCStackTraceElementClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CStackTraceElementClassObject, ClassObject, ICStackTraceElementClassObject);
+
+CStackTraceElementClassObject::CStackTraceElementClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CStackTraceElementClassObject::~CStackTraceElementClassObject()
+{
+    Spinlock& lock = GetCStackTraceElementClassObjectLock();
+    lock.Lock();
+    sCStackTraceElementClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CStackTraceElementClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CStackTraceElementClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CStackTraceElementClassObject::CreateObject(
+    /* [in] */ const String& no,
+    /* [in] */ const String& pc,
+    /* [in] */ const String& soname,
+    /* [in] */ const String& symbol,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStackTraceElement), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStackTraceElement* _obj = new(addr) CStackTraceElement();
+    ECode ec = _obj->Constructor(no, pc, soname, symbol);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStackTraceElement");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCStackTraceElementClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCStackTraceElementClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCStackTraceElementClassObject == nullptr) {
+        sCStackTraceElementClassObject = new CStackTraceElementClassObject();
+    }
+    else if (sCStackTraceElementClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCStackTraceElementClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCStackTraceElementClassObject;
+    return NOERROR;
+}
+
+static CStackTraceElementClassObject* GetCachedCStackTraceElementClassObject()
+{
+    CStackTraceElementClassObject* clsObject = sCStackTraceElementCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCStackTraceElementClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCStackTraceElementCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCStackTraceElementClassObject == nullptr) {
+            sCStackTraceElementClassObject = new CStackTraceElementClassObject();
+        }
+        else if (sCStackTraceElementClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCStackTraceElementClassObject;
+        clsObject->AddRef();
+        sCStackTraceElementCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCStackTraceElementClassObjectCache()
+{
+    Spinlock& lock = GetCStackTraceElementClassObjectLock();
+    lock.Lock();
+    CStackTraceElementClassObject* clsObject = sCStackTraceElementCachedClassObject.load(std::memory_order_relaxed);
+    sCStackTraceElementCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CStackTraceElement::_CStackTraceElement()
+{
+    sCStackTraceElementClassObject->AddRef();
+}
+
+_CStackTraceElement::~_CStackTraceElement()
+{
+    sCStackTraceElementClassObject->Release();
+}
+
+ECode _CStackTraceElement::New(
+    /* [in] */ const String& no,
+    /* [in] */ const String& pc,
+    /* [in] */ const String& soname,
+    /* [in] */ const String& symbol,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStackTraceElementClassObject* cachedClsObject = GetCachedCStackTraceElementClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(no, pc, soname, symbol, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStackTraceElement, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStackTraceElementClassObject::Probe(clsObject)->CreateObject(no, pc, soname, symbol, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CString.h"
+#include "ccm.core.ICStringClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CStringClassObject
+    : public ClassObject
+    , public ICStringClassObject
+{
+public:
+    CStringClassObject();
+
+    ~CStringClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& str,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CStringClassObject* sCStringClassObject = nullptr;
+static std::atomic<CStringClassObject*> sCStringCachedClassObject(nullptr);
+static Spinlock& GetCStringClassObjectLock()
+{
+    static Spinlock sCStringClassObjectLock;
+    return sCStringClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CStringClassObject, ClassObject, ICStringClassObject);
+
+CStringClassObject::CStringClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CStringClassObject::~CStringClassObject()
+{
+    Spinlock& lock = GetCStringClassObjectLock();
+    lock.Lock();
+    sCStringClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CStringClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CStringClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CStringClassObject::CreateObject(
+    /* [in] */ const String& str,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CString), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CString* _obj = new(addr) CString();
+    ECode ec = _obj->Constructor(str);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CString");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCStringClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCStringClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCStringClassObject == nullptr) {
+        sCStringClassObject = new CStringClassObject();
+    }
+    else if (sCStringClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCStringClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCStringClassObject;
+    return NOERROR;
+}
+
+static CStringClassObject* GetCachedCStringClassObject()
+{
+    CStringClassObject* clsObject = sCStringCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCStringClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCStringCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCStringClassObject == nullptr) {
+            sCStringClassObject = new CStringClassObject();
+        }
+        else if (sCStringClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCStringClassObject;
+        clsObject->AddRef();
+        sCStringCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCStringClassObjectCache()
+{
+    Spinlock& lock = GetCStringClassObjectLock();
+    lock.Lock();
+    CStringClassObject* clsObject = sCStringCachedClassObject.load(std::memory_order_relaxed);
+    sCStringCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CString::_CString()
+{
+    sCStringClassObject->AddRef();
+}
+
+_CString::~_CString()
+{
+    sCStringClassObject->Release();
+}
+
+ECode _CString::New(
+    /* [in] */ const String& str,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringClassObject* cachedClsObject = GetCachedCStringClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(str, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CString, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringClassObject::Probe(clsObject)->CreateObject(str, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
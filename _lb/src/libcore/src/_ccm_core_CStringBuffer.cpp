@@ -0,0 +1,316 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CStringBuffer.h"
+#include "ccm.core.ICStringBufferClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CStringBufferClassObject
+    : public ClassObject
+    , public ICStringBufferClassObject
+{
+public:
+    CStringBufferClassObject();
+
+    ~CStringBufferClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer capacity,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& str,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::core::ICharSequence* seq,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CStringBufferClassObject* sCStringBufferClassObject = nullptr;
+static std::atomic<CStringBufferClassObject*> sCStringBufferCachedClassObject(nullptr);
+static Spinlock& GetCStringBufferClassObjectLock()
+{
+    static Spinlock sCStringBufferClassObjectLock;
+    return sCStringBufferClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CStringBufferClassObject, ClassObject, ICStringBufferClassObject);
+
+CStringBufferClassObject::CStringBufferClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CStringBufferClassObject::~CStringBufferClassObject()
+{
+    Spinlock& lock = GetCStringBufferClassObjectLock();
+    lock.Lock();
+    sCStringBufferClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CStringBufferClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CStringBufferClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringBuffer), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringBuffer* _obj = new(addr) CStringBuffer();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStringBuffer");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CStringBufferClassObject::CreateObject(
+    /* [in] */ Integer capacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringBuffer), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringBuffer* _obj = new(addr) CStringBuffer();
+    ECode ec = _obj->Constructor(capacity);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStringBuffer");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CStringBufferClassObject::CreateObject(
+    /* [in] */ const String& str,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringBuffer), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringBuffer* _obj = new(addr) CStringBuffer();
+    ECode ec = _obj->Constructor(str);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStringBuffer");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CStringBufferClassObject::CreateObject(
+    /* [in] */ ccm::core::ICharSequence* seq,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringBuffer), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringBuffer* _obj = new(addr) CStringBuffer();
+    ECode ec = _obj->Constructor(seq);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStringBuffer");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCStringBufferClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCStringBufferClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCStringBufferClassObject == nullptr) {
+        sCStringBufferClassObject = new CStringBufferClassObject();
+    }
+    else if (sCStringBufferClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCStringBufferClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCStringBufferClassObject;
+    return NOERROR;
+}
+
+static CStringBufferClassObject* GetCachedCStringBufferClassObject()
+{
+    CStringBufferClassObject* clsObject = sCStringBufferCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCStringBufferClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCStringBufferCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCStringBufferClassObject == nullptr) {
+            sCStringBufferClassObject = new CStringBufferClassObject();
+        }
+        else if (sCStringBufferClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCStringBufferClassObject;
+        clsObject->AddRef();
+        sCStringBufferCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCStringBufferClassObjectCache()
+{
+    Spinlock& lock = GetCStringBufferClassObjectLock();
+    lock.Lock();
+    CStringBufferClassObject* clsObject = sCStringBufferCachedClassObject.load(std::memory_order_relaxed);
+    sCStringBufferCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CStringBuffer::_CStringBuffer()
+{
+    sCStringBufferClassObject->AddRef();
+}
+
+_CStringBuffer::~_CStringBuffer()
+{
+    sCStringBufferClassObject->Release();
+}
+
+ECode _CStringBuffer::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringBufferClassObject* cachedClsObject = GetCachedCStringBufferClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CStringBuffer, iid, nullptr, object);
+};
+
+ECode _CStringBuffer::New(
+    /* [in] */ Integer capacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringBufferClassObject* cachedClsObject = GetCachedCStringBufferClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(capacity, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStringBuffer, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringBufferClassObject::Probe(clsObject)->CreateObject(capacity, iid, object);
+};
+
+ECode _CStringBuffer::New(
+    /* [in] */ const String& str,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringBufferClassObject* cachedClsObject = GetCachedCStringBufferClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(str, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStringBuffer, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringBufferClassObject::Probe(clsObject)->CreateObject(str, iid, object);
+};
+
+ECode _CStringBuffer::New(
+    /* [in] */ ccm::core::ICharSequence* seq,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringBufferClassObject* cachedClsObject = GetCachedCStringBufferClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(seq, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStringBuffer, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringBufferClassObject::Probe(clsObject)->CreateObject(seq, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
@@ -0,0 +1,316 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CStringBuilder.h"
+#include "ccm.core.ICStringBuilderClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CStringBuilderClassObject
+    : public ClassObject
+    , public ICStringBuilderClassObject
+{
+public:
+    CStringBuilderClassObject();
+
+    ~CStringBuilderClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer capacity,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& str,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::core::ICharSequence* seq,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CStringBuilderClassObject* sCStringBuilderClassObject = nullptr;
+static std::atomic<CStringBuilderClassObject*> sCStringBuilderCachedClassObject(nullptr);
+static Spinlock& GetCStringBuilderClassObjectLock()
+{
+    static Spinlock sCStringBuilderClassObjectLock;
+    return sCStringBuilderClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CStringBuilderClassObject, ClassObject, ICStringBuilderClassObject);
+
+CStringBuilderClassObject::CStringBuilderClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CStringBuilderClassObject::~CStringBuilderClassObject()
+{
+    Spinlock& lock = GetCStringBuilderClassObjectLock();
+    lock.Lock();
+    sCStringBuilderClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CStringBuilderClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CStringBuilderClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringBuilder), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringBuilder* _obj = new(addr) CStringBuilder();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStringBuilder");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CStringBuilderClassObject::CreateObject(
+    /* [in] */ Integer capacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringBuilder), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringBuilder* _obj = new(addr) CStringBuilder();
+    ECode ec = _obj->Constructor(capacity);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStringBuilder");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CStringBuilderClassObject::CreateObject(
+    /* [in] */ const String& str,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringBuilder), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringBuilder* _obj = new(addr) CStringBuilder();
+    ECode ec = _obj->Constructor(str);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStringBuilder");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CStringBuilderClassObject::CreateObject(
+    /* [in] */ ccm::core::ICharSequence* seq,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringBuilder), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringBuilder* _obj = new(addr) CStringBuilder();
+    ECode ec = _obj->Constructor(seq);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CStringBuilder");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCStringBuilderClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCStringBuilderClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCStringBuilderClassObject == nullptr) {
+        sCStringBuilderClassObject = new CStringBuilderClassObject();
+    }
+    else if (sCStringBuilderClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCStringBuilderClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCStringBuilderClassObject;
+    return NOERROR;
+}
+
+static CStringBuilderClassObject* GetCachedCStringBuilderClassObject()
+{
+    CStringBuilderClassObject* clsObject = sCStringBuilderCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCStringBuilderClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCStringBuilderCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCStringBuilderClassObject == nullptr) {
+            sCStringBuilderClassObject = new CStringBuilderClassObject();
+        }
+        else if (sCStringBuilderClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCStringBuilderClassObject;
+        clsObject->AddRef();
+        sCStringBuilderCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCStringBuilderClassObjectCache()
+{
+    Spinlock& lock = GetCStringBuilderClassObjectLock();
+    lock.Lock();
+    CStringBuilderClassObject* clsObject = sCStringBuilderCachedClassObject.load(std::memory_order_relaxed);
+    sCStringBuilderCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CStringBuilder::_CStringBuilder()
+{
+    sCStringBuilderClassObject->AddRef();
+}
+
+_CStringBuilder::~_CStringBuilder()
+{
+    sCStringBuilderClassObject->Release();
+}
+
+ECode _CStringBuilder::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringBuilderClassObject* cachedClsObject = GetCachedCStringBuilderClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CStringBuilder, iid, nullptr, object);
+};
+
+ECode _CStringBuilder::New(
+    /* [in] */ Integer capacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringBuilderClassObject* cachedClsObject = GetCachedCStringBuilderClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(capacity, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStringBuilder, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringBuilderClassObject::Probe(clsObject)->CreateObject(capacity, iid, object);
+};
+
+ECode _CStringBuilder::New(
+    /* [in] */ const String& str,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringBuilderClassObject* cachedClsObject = GetCachedCStringBuilderClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(str, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStringBuilder, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringBuilderClassObject::Probe(clsObject)->CreateObject(str, iid, object);
+};
+
+ECode _CStringBuilder::New(
+    /* [in] */ ccm::core::ICharSequence* seq,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringBuilderClassObject* cachedClsObject = GetCachedCStringBuilderClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(seq, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStringBuilder, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringBuilderClassObject::Probe(clsObject)->CreateObject(seq, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
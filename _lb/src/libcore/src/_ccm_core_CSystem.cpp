@@ -0,0 +1,176 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CSystem.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CSystemClassObject
+    : public ClassObject
+{
+public:
+    CSystemClassObject();
+
+    ~CSystemClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CSystemClassObject* sCSystemClassObject = nullptr;
+static std::atomic<CSystemClassObject*> sCSystemCachedClassObject(nullptr);
+static Spinlock& GetCSystemClassObjectLock()
+{
+    static Spinlock sCSystemClassObjectLock;
+    return sCSystemClassObjectLock;
+}
+
+CSystemClassObject::CSystemClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CSystemClassObject::~CSystemClassObject()
+{
+    Spinlock& lock = GetCSystemClassObjectLock();
+    lock.Lock();
+    sCSystemClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CSystemClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CSystemClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSystem), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSystem* _obj = new(addr) CSystem();
+    _obj->AttachMetadata(mComponent, "ccm::core::CSystem");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCSystemClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCSystemClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCSystemClassObject == nullptr) {
+        sCSystemClassObject = new CSystemClassObject();
+    }
+    else if (sCSystemClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCSystemClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCSystemClassObject;
+    return NOERROR;
+}
+
+static CSystemClassObject* GetCachedCSystemClassObject()
+{
+    CSystemClassObject* clsObject = sCSystemCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCSystemClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCSystemCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCSystemClassObject == nullptr) {
+            sCSystemClassObject = new CSystemClassObject();
+        }
+        else if (sCSystemClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCSystemClassObject;
+        clsObject->AddRef();
+        sCSystemCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCSystemClassObjectCache()
+{
+    Spinlock& lock = GetCSystemClassObjectLock();
+    lock.Lock();
+    CSystemClassObject* clsObject = sCSystemCachedClassObject.load(std::memory_order_relaxed);
+    sCSystemCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CSystem::_CSystem()
+{
+    sCSystemClassObject->AddRef();
+}
+
+_CSystem::~_CSystem()
+{
+    sCSystemClassObject->Release();
+}
+
+ECode _CSystem::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSystemClassObject* cachedClsObject = GetCachedCSystemClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CSystem, iid, nullptr, object);
+};
+
+} // namespace core
+} // namespace ccm
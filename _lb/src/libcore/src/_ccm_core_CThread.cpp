@@ -0,0 +1,282 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CThread.h"
+#include "ccm.core.ICThreadClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CThreadClassObject
+    : public ClassObject
+    , public ICThreadClassObject
+{
+public:
+    CThreadClassObject();
+
+    ~CThreadClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::core::IThreadGroup* group,
+        /* [in] */ const String& name,
+        /* [in] */ Integer priority,
+        /* [in] */ Boolean daemon,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ HANDLE peer,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CThreadClassObject* sCThreadClassObject = nullptr;
+static std::atomic<CThreadClassObject*> sCThreadCachedClassObject(nullptr);
+static Spinlock& GetCThreadClassObjectLock()
+{
+    static Spinlock sCThreadClassObjectLock;
+    return sCThreadClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CThreadClassObject, ClassObject, ICThreadClassObject);
+
+CThreadClassObject::CThreadClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CThreadClassObject::~CThreadClassObject()
+{
+    Spinlock& lock = GetCThreadClassObjectLock();
+    lock.Lock();
+    sCThreadClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CThreadClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CThreadClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CThread), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CThread* _obj = new(addr) CThread();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CThread");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CThreadClassObject::CreateObject(
+    /* [in] */ ccm::core::IThreadGroup* group,
+    /* [in] */ const String& name,
+    /* [in] */ Integer priority,
+    /* [in] */ Boolean daemon,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CThread), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CThread* _obj = new(addr) CThread();
+    ECode ec = _obj->Constructor(group, name, priority, daemon);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CThread");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CThreadClassObject::CreateObject(
+    /* [in] */ HANDLE peer,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CThread), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CThread* _obj = new(addr) CThread();
+    ECode ec = _obj->Constructor(peer);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CThread");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCThreadClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCThreadClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCThreadClassObject == nullptr) {
+        sCThreadClassObject = new CThreadClassObject();
+    }
+    else if (sCThreadClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCThreadClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCThreadClassObject;
+    return NOERROR;
+}
+
+static CThreadClassObject* GetCachedCThreadClassObject()
+{
+    CThreadClassObject* clsObject = sCThreadCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCThreadClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCThreadCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCThreadClassObject == nullptr) {
+            sCThreadClassObject = new CThreadClassObject();
+        }
+        else if (sCThreadClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCThreadClassObject;
+        clsObject->AddRef();
+        sCThreadCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCThreadClassObjectCache()
+{
+    Spinlock& lock = GetCThreadClassObjectLock();
+    lock.Lock();
+    CThreadClassObject* clsObject = sCThreadCachedClassObject.load(std::memory_order_relaxed);
+    sCThreadCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CThread::_CThread()
+{
+    sCThreadClassObject->AddRef();
+}
+
+_CThread::~_CThread()
+{
+    sCThreadClassObject->Release();
+}
+
+ECode _CThread::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CThreadClassObject* cachedClsObject = GetCachedCThreadClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CThread, iid, nullptr, object);
+};
+
+ECode _CThread::New(
+    /* [in] */ ccm::core::IThreadGroup* group,
+    /* [in] */ const String& name,
+    /* [in] */ Integer priority,
+    /* [in] */ Boolean daemon,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CThreadClassObject* cachedClsObject = GetCachedCThreadClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(group, name, priority, daemon, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CThread, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICThreadClassObject::Probe(clsObject)->CreateObject(group, name, priority, daemon, iid, object);
+};
+
+ECode _CThread::New(
+    /* [in] */ HANDLE peer,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CThreadClassObject* cachedClsObject = GetCachedCThreadClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(peer, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CThread, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICThreadClassObject::Probe(clsObject)->CreateObject(peer, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
@@ -0,0 +1,276 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CThreadGroup.h"
+#include "ccm.core.ICThreadGroupClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CThreadGroupClassObject
+    : public ClassObject
+    , public ICThreadGroupClassObject
+{
+public:
+    CThreadGroupClassObject();
+
+    ~CThreadGroupClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& name,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::core::IThreadGroup* parent,
+        /* [in] */ const String& name,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CThreadGroupClassObject* sCThreadGroupClassObject = nullptr;
+static std::atomic<CThreadGroupClassObject*> sCThreadGroupCachedClassObject(nullptr);
+static Spinlock& GetCThreadGroupClassObjectLock()
+{
+    static Spinlock sCThreadGroupClassObjectLock;
+    return sCThreadGroupClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CThreadGroupClassObject, ClassObject, ICThreadGroupClassObject);
+
+CThreadGroupClassObject::CThreadGroupClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CThreadGroupClassObject::~CThreadGroupClassObject()
+{
+    Spinlock& lock = GetCThreadGroupClassObjectLock();
+    lock.Lock();
+    sCThreadGroupClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CThreadGroupClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CThreadGroupClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CThreadGroup), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CThreadGroup* _obj = new(addr) CThreadGroup();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CThreadGroup");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CThreadGroupClassObject::CreateObject(
+    /* [in] */ const String& name,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CThreadGroup), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CThreadGroup* _obj = new(addr) CThreadGroup();
+    ECode ec = _obj->Constructor(name);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CThreadGroup");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CThreadGroupClassObject::CreateObject(
+    /* [in] */ ccm::core::IThreadGroup* parent,
+    /* [in] */ const String& name,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CThreadGroup), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CThreadGroup* _obj = new(addr) CThreadGroup();
+    ECode ec = _obj->Constructor(parent, name);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CThreadGroup");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCThreadGroupClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCThreadGroupClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCThreadGroupClassObject == nullptr) {
+        sCThreadGroupClassObject = new CThreadGroupClassObject();
+    }
+    else if (sCThreadGroupClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCThreadGroupClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCThreadGroupClassObject;
+    return NOERROR;
+}
+
+static CThreadGroupClassObject* GetCachedCThreadGroupClassObject()
+{
+    CThreadGroupClassObject* clsObject = sCThreadGroupCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCThreadGroupClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCThreadGroupCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCThreadGroupClassObject == nullptr) {
+            sCThreadGroupClassObject = new CThreadGroupClassObject();
+        }
+        else if (sCThreadGroupClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCThreadGroupClassObject;
+        clsObject->AddRef();
+        sCThreadGroupCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCThreadGroupClassObjectCache()
+{
+    Spinlock& lock = GetCThreadGroupClassObjectLock();
+    lock.Lock();
+    CThreadGroupClassObject* clsObject = sCThreadGroupCachedClassObject.load(std::memory_order_relaxed);
+    sCThreadGroupCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CThreadGroup::_CThreadGroup()
+{
+    sCThreadGroupClassObject->AddRef();
+}
+
+_CThreadGroup::~_CThreadGroup()
+{
+    sCThreadGroupClassObject->Release();
+}
+
+ECode _CThreadGroup::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CThreadGroupClassObject* cachedClsObject = GetCachedCThreadGroupClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CThreadGroup, iid, nullptr, object);
+};
+
+ECode _CThreadGroup::New(
+    /* [in] */ const String& name,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CThreadGroupClassObject* cachedClsObject = GetCachedCThreadGroupClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(name, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CThreadGroup, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICThreadGroupClassObject::Probe(clsObject)->CreateObject(name, iid, object);
+};
+
+ECode _CThreadGroup::New(
+    /* [in] */ ccm::core::IThreadGroup* parent,
+    /* [in] */ const String& name,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CThreadGroupClassObject* cachedClsObject = GetCachedCThreadGroupClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(parent, name, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CThreadGroup, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICThreadGroupClassObject::Probe(clsObject)->CreateObject(parent, name, iid, object);
+};
+
+} // namespace core
+} // namespace ccm
@@ -0,0 +1,181 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CThreadLocal.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+class CThreadLocalClassObject
+    : public ClassObject
+{
+public:
+    CThreadLocalClassObject();
+
+    ~CThreadLocalClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CThreadLocalClassObject* sCThreadLocalClassObject = nullptr;
+static std::atomic<CThreadLocalClassObject*> sCThreadLocalCachedClassObject(nullptr);
+static Spinlock& GetCThreadLocalClassObjectLock()
+{
+    static Spinlock sCThreadLocalClassObjectLock;
+    return sCThreadLocalClassObjectLock;
+}
+
+CThreadLocalClassObject::CThreadLocalClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CThreadLocalClassObject::~CThreadLocalClassObject()
+{
+    Spinlock& lock = GetCThreadLocalClassObjectLock();
+    lock.Lock();
+    sCThreadLocalClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CThreadLocalClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CThreadLocalClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CThreadLocal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CThreadLocal* _obj = new(addr) CThreadLocal();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::core::CThreadLocal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCThreadLocalClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCThreadLocalClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCThreadLocalClassObject == nullptr) {
+        sCThreadLocalClassObject = new CThreadLocalClassObject();
+    }
+    else if (sCThreadLocalClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCThreadLocalClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCThreadLocalClassObject;
+    return NOERROR;
+}
+
+static CThreadLocalClassObject* GetCachedCThreadLocalClassObject()
+{
+    CThreadLocalClassObject* clsObject = sCThreadLocalCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCThreadLocalClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCThreadLocalCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCThreadLocalClassObject == nullptr) {
+            sCThreadLocalClassObject = new CThreadLocalClassObject();
+        }
+        else if (sCThreadLocalClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCThreadLocalClassObject;
+        clsObject->AddRef();
+        sCThreadLocalCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCThreadLocalClassObjectCache()
+{
+    Spinlock& lock = GetCThreadLocalClassObjectLock();
+    lock.Lock();
+    CThreadLocalClassObject* clsObject = sCThreadLocalCachedClassObject.load(std::memory_order_relaxed);
+    sCThreadLocalCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CThreadLocal::_CThreadLocal()
+{
+    sCThreadLocalClassObject->AddRef();
+}
+
+_CThreadLocal::~_CThreadLocal()
+{
+    sCThreadLocalClassObject->Release();
+}
+
+ECode _CThreadLocal::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CThreadLocalClassObject* cachedClsObject = GetCachedCThreadLocalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CThreadLocal, iid, nullptr, object);
+};
+
+} // namespace core
+} // namespace ccm
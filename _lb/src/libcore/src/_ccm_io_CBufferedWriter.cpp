@@ -0,0 +1,252 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CBufferedWriter.h"
+#include "ccm.io.ICBufferedWriterClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+class CBufferedWriterClassObject
+    : public ClassObject
+    , public ICBufferedWriterClassObject
+{
+public:
+    CBufferedWriterClassObject();
+
+    ~CBufferedWriterClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IWriter* outW,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IWriter* outW,
+        /* [in] */ Integer sz,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CBufferedWriterClassObject* sCBufferedWriterClassObject = nullptr;
+static std::atomic<CBufferedWriterClassObject*> sCBufferedWriterCachedClassObject(nullptr);
+static Spinlock& GetCBufferedWriterClassObjectLock()
+{
+    static Spinlock sCBufferedWriterClassObjectLock;
+    return sCBufferedWriterClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CBufferedWriterClassObject, ClassObject, ICBufferedWriterClassObject);
+
+CBufferedWriterClassObject::CBufferedWriterClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CBufferedWriterClassObject::~CBufferedWriterClassObject()
+{
+    Spinlock& lock = GetCBufferedWriterClassObjectLock();
+    lock.Lock();
+    sCBufferedWriterClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CBufferedWriterClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CBufferedWriterClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CBufferedWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IWriter* outW,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBufferedWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBufferedWriter* _obj = new(addr) CBufferedWriter();
+    ECode ec = _obj->Constructor(outW);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CBufferedWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBufferedWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IWriter* outW,
+    /* [in] */ Integer sz,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBufferedWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBufferedWriter* _obj = new(addr) CBufferedWriter();
+    ECode ec = _obj->Constructor(outW, sz);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CBufferedWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCBufferedWriterClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCBufferedWriterClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCBufferedWriterClassObject == nullptr) {
+        sCBufferedWriterClassObject = new CBufferedWriterClassObject();
+    }
+    else if (sCBufferedWriterClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCBufferedWriterClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCBufferedWriterClassObject;
+    return NOERROR;
+}
+
+static CBufferedWriterClassObject* GetCachedCBufferedWriterClassObject()
+{
+    CBufferedWriterClassObject* clsObject = sCBufferedWriterCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCBufferedWriterClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCBufferedWriterCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCBufferedWriterClassObject == nullptr) {
+            sCBufferedWriterClassObject = new CBufferedWriterClassObject();
+        }
+        else if (sCBufferedWriterClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCBufferedWriterClassObject;
+        clsObject->AddRef();
+        sCBufferedWriterCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCBufferedWriterClassObjectCache()
+{
+    Spinlock& lock = GetCBufferedWriterClassObjectLock();
+    lock.Lock();
+    CBufferedWriterClassObject* clsObject = sCBufferedWriterCachedClassObject.load(std::memory_order_relaxed);
+    sCBufferedWriterCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CBufferedWriter::_CBufferedWriter()
+{
+    sCBufferedWriterClassObject->AddRef();
+}
+
+_CBufferedWriter::~_CBufferedWriter()
+{
+    sCBufferedWriterClassObject->Release();
+}
+
+ECode _CBufferedWriter::New(
+    /* [in] */ ccm::io::IWriter* outW,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBufferedWriterClassObject* cachedClsObject = GetCachedCBufferedWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(outW, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBufferedWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBufferedWriterClassObject::Probe(clsObject)->CreateObject(outW, iid, object);
+};
+
+ECode _CBufferedWriter::New(
+    /* [in] */ ccm::io::IWriter* outW,
+    /* [in] */ Integer sz,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBufferedWriterClassObject* cachedClsObject = GetCachedCBufferedWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(outW, sz, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBufferedWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBufferedWriterClassObject::Probe(clsObject)->CreateObject(outW, sz, iid, object);
+};
+
+} // namespace io
+} // namespace ccm
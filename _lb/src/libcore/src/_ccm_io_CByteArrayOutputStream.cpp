@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CByteArrayOutputStream.h"
+#include "ccm.io.ICByteArrayOutputStreamClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+class CByteArrayOutputStreamClassObject
+    : public ClassObject
+    , public ICByteArrayOutputStreamClassObject
+{
+public:
+    CByteArrayOutputStreamClassObject();
+
+    ~CByteArrayOutputStreamClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer size,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CByteArrayOutputStreamClassObject* sCByteArrayOutputStreamClassObject = nullptr;
+static std::atomic<CByteArrayOutputStreamClassObject*> sCByteArrayOutputStreamCachedClassObject(nullptr);
+static Spinlock& GetCByteArrayOutputStreamClassObjectLock()
+{
+    static Spinlock sCByteArrayOutputStreamClassObjectLock;
+    return sCByteArrayOutputStreamClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CByteArrayOutputStreamClassObject, ClassObject, ICByteArrayOutputStreamClassObject);
+
+CByteArrayOutputStreamClassObject::CByteArrayOutputStreamClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CByteArrayOutputStreamClassObject::~CByteArrayOutputStreamClassObject()
+{
+    Spinlock& lock = GetCByteArrayOutputStreamClassObjectLock();
+    lock.Lock();
+    sCByteArrayOutputStreamClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CByteArrayOutputStreamClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CByteArrayOutputStreamClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CByteArrayOutputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CByteArrayOutputStream* _obj = new(addr) CByteArrayOutputStream();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CByteArrayOutputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CByteArrayOutputStreamClassObject::CreateObject(
+    /* [in] */ Integer size,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CByteArrayOutputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CByteArrayOutputStream* _obj = new(addr) CByteArrayOutputStream();
+    ECode ec = _obj->Constructor(size);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CByteArrayOutputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCByteArrayOutputStreamClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCByteArrayOutputStreamClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCByteArrayOutputStreamClassObject == nullptr) {
+        sCByteArrayOutputStreamClassObject = new CByteArrayOutputStreamClassObject();
+    }
+    else if (sCByteArrayOutputStreamClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCByteArrayOutputStreamClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCByteArrayOutputStreamClassObject;
+    return NOERROR;
+}
+
+static CByteArrayOutputStreamClassObject* GetCachedCByteArrayOutputStreamClassObject()
+{
+    CByteArrayOutputStreamClassObject* clsObject = sCByteArrayOutputStreamCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCByteArrayOutputStreamClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCByteArrayOutputStreamCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCByteArrayOutputStreamClassObject == nullptr) {
+            sCByteArrayOutputStreamClassObject = new CByteArrayOutputStreamClassObject();
+        }
+        else if (sCByteArrayOutputStreamClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCByteArrayOutputStreamClassObject;
+        clsObject->AddRef();
+        sCByteArrayOutputStreamCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCByteArrayOutputStreamClassObjectCache()
+{
+    Spinlock& lock = GetCByteArrayOutputStreamClassObjectLock();
+    lock.Lock();
+    CByteArrayOutputStreamClassObject* clsObject = sCByteArrayOutputStreamCachedClassObject.load(std::memory_order_relaxed);
+    sCByteArrayOutputStreamCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CByteArrayOutputStream::_CByteArrayOutputStream()
+{
+    sCByteArrayOutputStreamClassObject->AddRef();
+}
+
+_CByteArrayOutputStream::~_CByteArrayOutputStream()
+{
+    sCByteArrayOutputStreamClassObject->Release();
+}
+
+ECode _CByteArrayOutputStream::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CByteArrayOutputStreamClassObject* cachedClsObject = GetCachedCByteArrayOutputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CByteArrayOutputStream, iid, nullptr, object);
+};
+
+ECode _CByteArrayOutputStream::New(
+    /* [in] */ Integer size,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CByteArrayOutputStreamClassObject* cachedClsObject = GetCachedCByteArrayOutputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(size, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CByteArrayOutputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICByteArrayOutputStreamClassObject::Probe(clsObject)->CreateObject(size, iid, object);
+};
+
+} // namespace io
+} // namespace ccm
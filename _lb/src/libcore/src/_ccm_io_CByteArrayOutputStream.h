@@ -0,0 +1,50 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_CBYTEARRAYOUTPUTSTREAM_H_GEN__
+#define __CCM_IO_CBYTEARRAYOUTPUTSTREAM_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const CoclassID CID_CByteArrayOutputStream;
+
+COCLASS_ID(69455e4d-56b1-43b1-98b1-e4907e332a4f)
+class _CByteArrayOutputStream
+{
+public:
+    _CByteArrayOutputStream();
+
+    virtual ~_CByteArrayOutputStream();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer size,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_CBYTEARRAYOUTPUTSTREAM_H_GEN__
@@ -0,0 +1,215 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CDirectByteBuffer.h"
+#include "ccm.io.ICDirectByteBufferClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+class CDirectByteBufferClassObject
+    : public ClassObject
+    , public ICDirectByteBufferClassObject
+{
+public:
+    CDirectByteBufferClassObject();
+
+    ~CDirectByteBufferClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Integer cap,
+        /* [in] */ HANDLE address,
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Boolean isReadOnly,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CDirectByteBufferClassObject* sCDirectByteBufferClassObject = nullptr;
+static std::atomic<CDirectByteBufferClassObject*> sCDirectByteBufferCachedClassObject(nullptr);
+static Spinlock& GetCDirectByteBufferClassObjectLock()
+{
+    static Spinlock sCDirectByteBufferClassObjectLock;
+    return sCDirectByteBufferClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CDirectByteBufferClassObject, ClassObject, ICDirectByteBufferClassObject);
+
+CDirectByteBufferClassObject::CDirectByteBufferClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CDirectByteBufferClassObject::~CDirectByteBufferClassObject()
+{
+    Spinlock& lock = GetCDirectByteBufferClassObjectLock();
+    lock.Lock();
+    sCDirectByteBufferClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CDirectByteBufferClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CDirectByteBufferClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CDirectByteBufferClassObject::CreateObject(
+    /* [in] */ Integer cap,
+    /* [in] */ HANDLE address,
+    /* [in] */ ccm::io::IFileDescriptor* fd,
+    /* [in] */ Boolean isReadOnly,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDirectByteBuffer), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDirectByteBuffer* _obj = new(addr) CDirectByteBuffer();
+    ECode ec = _obj->Constructor(cap, address, fd, isReadOnly);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CDirectByteBuffer");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCDirectByteBufferClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCDirectByteBufferClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCDirectByteBufferClassObject == nullptr) {
+        sCDirectByteBufferClassObject = new CDirectByteBufferClassObject();
+    }
+    else if (sCDirectByteBufferClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCDirectByteBufferClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCDirectByteBufferClassObject;
+    return NOERROR;
+}
+
+static CDirectByteBufferClassObject* GetCachedCDirectByteBufferClassObject()
+{
+    CDirectByteBufferClassObject* clsObject = sCDirectByteBufferCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCDirectByteBufferClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCDirectByteBufferCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCDirectByteBufferClassObject == nullptr) {
+            sCDirectByteBufferClassObject = new CDirectByteBufferClassObject();
+        }
+        else if (sCDirectByteBufferClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCDirectByteBufferClassObject;
+        clsObject->AddRef();
+        sCDirectByteBufferCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCDirectByteBufferClassObjectCache()
+{
+    Spinlock& lock = GetCDirectByteBufferClassObjectLock();
+    lock.Lock();
+    CDirectByteBufferClassObject* clsObject = sCDirectByteBufferCachedClassObject.load(std::memory_order_relaxed);
+    sCDirectByteBufferCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CDirectByteBuffer::_CDirectByteBuffer()
+{
+    sCDirectByteBufferClassObject->AddRef();
+}
+
+_CDirectByteBuffer::~_CDirectByteBuffer()
+{
+    sCDirectByteBufferClassObject->Release();
+}
+
+ECode _CDirectByteBuffer::New(
+    /* [in] */ Integer cap,
+    /* [in] */ HANDLE address,
+    /* [in] */ ccm::io::IFileDescriptor* fd,
+    /* [in] */ Boolean isReadOnly,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDirectByteBufferClassObject* cachedClsObject = GetCachedCDirectByteBufferClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(cap, address, fd, isReadOnly, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDirectByteBuffer, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDirectByteBufferClassObject::Probe(clsObject)->CreateObject(cap, address, fd, isReadOnly, iid, object);
+};
+
+} // namespace io
+} // namespace ccm
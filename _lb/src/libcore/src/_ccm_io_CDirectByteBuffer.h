@@ -0,0 +1,49 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_CDIRECTBYTEBUFFER_H_GEN__
+#define __CCM_IO_CDIRECTBYTEBUFFER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const CoclassID CID_CDirectByteBuffer;
+
+COCLASS_ID(160997fd-1165-46dd-a47a-8a000bcd1916)
+class _CDirectByteBuffer
+{
+public:
+    _CDirectByteBuffer();
+
+    virtual ~_CDirectByteBuffer();
+
+    static ECode New(
+        /* [in] */ Integer cap,
+        /* [in] */ HANDLE address,
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Boolean isReadOnly,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_CDIRECTBYTEBUFFER_H_GEN__
@@ -0,0 +1,433 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CFile.h"
+#include "ccm.io.ICFileClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+class CFileClassObject
+    : public ClassObject
+    , public ICFileClassObject
+{
+public:
+    CFileClassObject();
+
+    ~CFileClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& pathname,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& parent,
+        /* [in] */ const String& child,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFile* parent,
+        /* [in] */ const String& child,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::net::IURI* uri,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& pathname,
+        /* [in] */ Integer prefixLength,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& child,
+        /* [in] */ ccm::io::IFile* parent,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CFileClassObject* sCFileClassObject = nullptr;
+static std::atomic<CFileClassObject*> sCFileCachedClassObject(nullptr);
+static Spinlock& GetCFileClassObjectLock()
+{
+    static Spinlock sCFileClassObjectLock;
+    return sCFileClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CFileClassObject, ClassObject, ICFileClassObject);
+
+CFileClassObject::CFileClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CFileClassObject::~CFileClassObject()
+{
+    Spinlock& lock = GetCFileClassObjectLock();
+    lock.Lock();
+    sCFileClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CFileClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CFileClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CFileClassObject::CreateObject(
+    /* [in] */ const String& pathname,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFile), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFile* _obj = new(addr) CFile();
+    ECode ec = _obj->Constructor(pathname);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFile");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileClassObject::CreateObject(
+    /* [in] */ const String& parent,
+    /* [in] */ const String& child,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFile), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFile* _obj = new(addr) CFile();
+    ECode ec = _obj->Constructor(parent, child);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFile");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileClassObject::CreateObject(
+    /* [in] */ ccm::io::IFile* parent,
+    /* [in] */ const String& child,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFile), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFile* _obj = new(addr) CFile();
+    ECode ec = _obj->Constructor(parent, child);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFile");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileClassObject::CreateObject(
+    /* [in] */ ccm::net::IURI* uri,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFile), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFile* _obj = new(addr) CFile();
+    ECode ec = _obj->Constructor(uri);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFile");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileClassObject::CreateObject(
+    /* [in] */ const String& pathname,
+    /* [in] */ Integer prefixLength,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFile), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFile* _obj = new(addr) CFile();
+    ECode ec = _obj->Constructor(pathname, prefixLength);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFile");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileClassObject::CreateObject(
+    /* [in] */ const String& child,
+    /* [in] */ ccm::io::IFile* parent,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFile), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFile* _obj = new(addr) CFile();
+    ECode ec = _obj->Constructor(child, parent);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFile");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCFileClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCFileClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCFileClassObject == nullptr) {
+        sCFileClassObject = new CFileClassObject();
+    }
+    else if (sCFileClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCFileClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCFileClassObject;
+    return NOERROR;
+}
+
+static CFileClassObject* GetCachedCFileClassObject()
+{
+    CFileClassObject* clsObject = sCFileCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCFileClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCFileCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCFileClassObject == nullptr) {
+            sCFileClassObject = new CFileClassObject();
+        }
+        else if (sCFileClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCFileClassObject;
+        clsObject->AddRef();
+        sCFileCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCFileClassObjectCache()
+{
+    Spinlock& lock = GetCFileClassObjectLock();
+    lock.Lock();
+    CFileClassObject* clsObject = sCFileCachedClassObject.load(std::memory_order_relaxed);
+    sCFileCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CFile::_CFile()
+{
+    sCFileClassObject->AddRef();
+}
+
+_CFile::~_CFile()
+{
+    sCFileClassObject->Release();
+}
+
+ECode _CFile::New(
+    /* [in] */ const String& pathname,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileClassObject* cachedClsObject = GetCachedCFileClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(pathname, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFile, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileClassObject::Probe(clsObject)->CreateObject(pathname, iid, object);
+};
+
+ECode _CFile::New(
+    /* [in] */ const String& parent,
+    /* [in] */ const String& child,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileClassObject* cachedClsObject = GetCachedCFileClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(parent, child, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFile, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileClassObject::Probe(clsObject)->CreateObject(parent, child, iid, object);
+};
+
+ECode _CFile::New(
+    /* [in] */ ccm::io::IFile* parent,
+    /* [in] */ const String& child,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileClassObject* cachedClsObject = GetCachedCFileClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(parent, child, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFile, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileClassObject::Probe(clsObject)->CreateObject(parent, child, iid, object);
+};
+
+ECode _CFile::New(
+    /* [in] */ ccm::net::IURI* uri,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileClassObject* cachedClsObject = GetCachedCFileClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(uri, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFile, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileClassObject::Probe(clsObject)->CreateObject(uri, iid, object);
+};
+
+ECode _CFile::New(
+    /* [in] */ const String& pathname,
+    /* [in] */ Integer prefixLength,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileClassObject* cachedClsObject = GetCachedCFileClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(pathname, prefixLength, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFile, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileClassObject::Probe(clsObject)->CreateObject(pathname, prefixLength, iid, object);
+};
+
+ECode _CFile::New(
+    /* [in] */ const String& child,
+    /* [in] */ ccm::io::IFile* parent,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileClassObject* cachedClsObject = GetCachedCFileClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(child, parent, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFile, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileClassObject::Probe(clsObject)->CreateObject(child, parent, iid, object);
+};
+
+} // namespace io
+} // namespace ccm
@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CFileDescriptor.h"
+#include "ccm.io.ICFileDescriptorClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+class CFileDescriptorClassObject
+    : public ClassObject
+    , public ICFileDescriptorClassObject
+{
+public:
+    CFileDescriptorClassObject();
+
+    ~CFileDescriptorClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer descriptor,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CFileDescriptorClassObject* sCFileDescriptorClassObject = nullptr;
+static std::atomic<CFileDescriptorClassObject*> sCFileDescriptorCachedClassObject(nullptr);
+static Spinlock& GetCFileDescriptorClassObjectLock()
+{
+    static Spinlock sCFileDescriptorClassObjectLock;
+    return sCFileDescriptorClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CFileDescriptorClassObject, ClassObject, ICFileDescriptorClassObject);
+
+CFileDescriptorClassObject::CFileDescriptorClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CFileDescriptorClassObject::~CFileDescriptorClassObject()
+{
+    Spinlock& lock = GetCFileDescriptorClassObjectLock();
+    lock.Lock();
+    sCFileDescriptorClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CFileDescriptorClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CFileDescriptorClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileDescriptor), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileDescriptor* _obj = new(addr) CFileDescriptor();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileDescriptor");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileDescriptorClassObject::CreateObject(
+    /* [in] */ Integer descriptor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileDescriptor), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileDescriptor* _obj = new(addr) CFileDescriptor();
+    ECode ec = _obj->Constructor(descriptor);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileDescriptor");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCFileDescriptorClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCFileDescriptorClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCFileDescriptorClassObject == nullptr) {
+        sCFileDescriptorClassObject = new CFileDescriptorClassObject();
+    }
+    else if (sCFileDescriptorClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCFileDescriptorClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCFileDescriptorClassObject;
+    return NOERROR;
+}
+
+static CFileDescriptorClassObject* GetCachedCFileDescriptorClassObject()
+{
+    CFileDescriptorClassObject* clsObject = sCFileDescriptorCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCFileDescriptorClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCFileDescriptorCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCFileDescriptorClassObject == nullptr) {
+            sCFileDescriptorClassObject = new CFileDescriptorClassObject();
+        }
+        else if (sCFileDescriptorClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCFileDescriptorClassObject;
+        clsObject->AddRef();
+        sCFileDescriptorCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCFileDescriptorClassObjectCache()
+{
+    Spinlock& lock = GetCFileDescriptorClassObjectLock();
+    lock.Lock();
+    CFileDescriptorClassObject* clsObject = sCFileDescriptorCachedClassObject.load(std::memory_order_relaxed);
+    sCFileDescriptorCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CFileDescriptor::_CFileDescriptor()
+{
+    sCFileDescriptorClassObject->AddRef();
+}
+
+_CFileDescriptor::~_CFileDescriptor()
+{
+    sCFileDescriptorClassObject->Release();
+}
+
+ECode _CFileDescriptor::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileDescriptorClassObject* cachedClsObject = GetCachedCFileDescriptorClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CFileDescriptor, iid, nullptr, object);
+};
+
+ECode _CFileDescriptor::New(
+    /* [in] */ Integer descriptor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileDescriptorClassObject* cachedClsObject = GetCachedCFileDescriptorClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(descriptor, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileDescriptor, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileDescriptorClassObject::Probe(clsObject)->CreateObject(descriptor, iid, object);
+};
+
+} // namespace io
+} // namespace ccm
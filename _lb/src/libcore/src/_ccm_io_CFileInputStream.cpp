@@ -0,0 +1,338 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CFileInputStream.h"
+#include "ccm.io.ICFileInputStreamClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+class CFileInputStreamClassObject
+    : public ClassObject
+    , public ICFileInputStreamClassObject
+{
+public:
+    CFileInputStreamClassObject();
+
+    ~CFileInputStreamClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& name,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFile* file,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFileDescriptor* fdObj,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFileDescriptor* fdObj,
+        /* [in] */ Boolean isFdOwner,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CFileInputStreamClassObject* sCFileInputStreamClassObject = nullptr;
+static std::atomic<CFileInputStreamClassObject*> sCFileInputStreamCachedClassObject(nullptr);
+static Spinlock& GetCFileInputStreamClassObjectLock()
+{
+    static Spinlock sCFileInputStreamClassObjectLock;
+    return sCFileInputStreamClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CFileInputStreamClassObject, ClassObject, ICFileInputStreamClassObject);
+
+CFileInputStreamClassObject::CFileInputStreamClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CFileInputStreamClassObject::~CFileInputStreamClassObject()
+{
+    Spinlock& lock = GetCFileInputStreamClassObjectLock();
+    lock.Lock();
+    sCFileInputStreamClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CFileInputStreamClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CFileInputStreamClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CFileInputStreamClassObject::CreateObject(
+    /* [in] */ const String& name,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileInputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileInputStream* _obj = new(addr) CFileInputStream();
+    ECode ec = _obj->Constructor(name);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileInputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileInputStreamClassObject::CreateObject(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileInputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileInputStream* _obj = new(addr) CFileInputStream();
+    ECode ec = _obj->Constructor(file);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileInputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileInputStreamClassObject::CreateObject(
+    /* [in] */ ccm::io::IFileDescriptor* fdObj,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileInputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileInputStream* _obj = new(addr) CFileInputStream();
+    ECode ec = _obj->Constructor(fdObj);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileInputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileInputStreamClassObject::CreateObject(
+    /* [in] */ ccm::io::IFileDescriptor* fdObj,
+    /* [in] */ Boolean isFdOwner,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileInputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileInputStream* _obj = new(addr) CFileInputStream();
+    ECode ec = _obj->Constructor(fdObj, isFdOwner);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileInputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCFileInputStreamClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCFileInputStreamClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCFileInputStreamClassObject == nullptr) {
+        sCFileInputStreamClassObject = new CFileInputStreamClassObject();
+    }
+    else if (sCFileInputStreamClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCFileInputStreamClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCFileInputStreamClassObject;
+    return NOERROR;
+}
+
+static CFileInputStreamClassObject* GetCachedCFileInputStreamClassObject()
+{
+    CFileInputStreamClassObject* clsObject = sCFileInputStreamCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCFileInputStreamClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCFileInputStreamCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCFileInputStreamClassObject == nullptr) {
+            sCFileInputStreamClassObject = new CFileInputStreamClassObject();
+        }
+        else if (sCFileInputStreamClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCFileInputStreamClassObject;
+        clsObject->AddRef();
+        sCFileInputStreamCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCFileInputStreamClassObjectCache()
+{
+    Spinlock& lock = GetCFileInputStreamClassObjectLock();
+    lock.Lock();
+    CFileInputStreamClassObject* clsObject = sCFileInputStreamCachedClassObject.load(std::memory_order_relaxed);
+    sCFileInputStreamCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CFileInputStream::_CFileInputStream()
+{
+    sCFileInputStreamClassObject->AddRef();
+}
+
+_CFileInputStream::~_CFileInputStream()
+{
+    sCFileInputStreamClassObject->Release();
+}
+
+ECode _CFileInputStream::New(
+    /* [in] */ const String& name,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileInputStreamClassObject* cachedClsObject = GetCachedCFileInputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(name, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileInputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileInputStreamClassObject::Probe(clsObject)->CreateObject(name, iid, object);
+};
+
+ECode _CFileInputStream::New(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileInputStreamClassObject* cachedClsObject = GetCachedCFileInputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(file, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileInputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileInputStreamClassObject::Probe(clsObject)->CreateObject(file, iid, object);
+};
+
+ECode _CFileInputStream::New(
+    /* [in] */ ccm::io::IFileDescriptor* fdObj,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileInputStreamClassObject* cachedClsObject = GetCachedCFileInputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(fdObj, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileInputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileInputStreamClassObject::Probe(clsObject)->CreateObject(fdObj, iid, object);
+};
+
+ECode _CFileInputStream::New(
+    /* [in] */ ccm::io::IFileDescriptor* fdObj,
+    /* [in] */ Boolean isFdOwner,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileInputStreamClassObject* cachedClsObject = GetCachedCFileInputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(fdObj, isFdOwner, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileInputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileInputStreamClassObject::Probe(clsObject)->CreateObject(fdObj, isFdOwner, iid, object);
+};
+
+} // namespace io
+} // namespace ccm
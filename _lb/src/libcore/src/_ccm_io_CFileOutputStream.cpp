@@ -0,0 +1,430 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CFileOutputStream.h"
+#include "ccm.io.ICFileOutputStreamClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+class CFileOutputStreamClassObject
+    : public ClassObject
+    , public ICFileOutputStreamClassObject
+{
+public:
+    CFileOutputStreamClassObject();
+
+    ~CFileOutputStreamClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& name,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& name,
+        /* [in] */ Boolean append,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFile* file,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFile* file,
+        /* [in] */ Boolean append,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFileDescriptor* fdObj,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFileDescriptor* fdObj,
+        /* [in] */ Boolean isFdOwner,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CFileOutputStreamClassObject* sCFileOutputStreamClassObject = nullptr;
+static std::atomic<CFileOutputStreamClassObject*> sCFileOutputStreamCachedClassObject(nullptr);
+static Spinlock& GetCFileOutputStreamClassObjectLock()
+{
+    static Spinlock sCFileOutputStreamClassObjectLock;
+    return sCFileOutputStreamClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CFileOutputStreamClassObject, ClassObject, ICFileOutputStreamClassObject);
+
+CFileOutputStreamClassObject::CFileOutputStreamClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CFileOutputStreamClassObject::~CFileOutputStreamClassObject()
+{
+    Spinlock& lock = GetCFileOutputStreamClassObjectLock();
+    lock.Lock();
+    sCFileOutputStreamClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CFileOutputStreamClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CFileOutputStreamClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CFileOutputStreamClassObject::CreateObject(
+    /* [in] */ const String& name,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileOutputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileOutputStream* _obj = new(addr) CFileOutputStream();
+    ECode ec = _obj->Constructor(name);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileOutputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileOutputStreamClassObject::CreateObject(
+    /* [in] */ const String& name,
+    /* [in] */ Boolean append,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileOutputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileOutputStream* _obj = new(addr) CFileOutputStream();
+    ECode ec = _obj->Constructor(name, append);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileOutputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileOutputStreamClassObject::CreateObject(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileOutputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileOutputStream* _obj = new(addr) CFileOutputStream();
+    ECode ec = _obj->Constructor(file);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileOutputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileOutputStreamClassObject::CreateObject(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ Boolean append,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileOutputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileOutputStream* _obj = new(addr) CFileOutputStream();
+    ECode ec = _obj->Constructor(file, append);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileOutputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileOutputStreamClassObject::CreateObject(
+    /* [in] */ ccm::io::IFileDescriptor* fdObj,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileOutputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileOutputStream* _obj = new(addr) CFileOutputStream();
+    ECode ec = _obj->Constructor(fdObj);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileOutputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFileOutputStreamClassObject::CreateObject(
+    /* [in] */ ccm::io::IFileDescriptor* fdObj,
+    /* [in] */ Boolean isFdOwner,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFileOutputStream), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFileOutputStream* _obj = new(addr) CFileOutputStream();
+    ECode ec = _obj->Constructor(fdObj, isFdOwner);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CFileOutputStream");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCFileOutputStreamClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCFileOutputStreamClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCFileOutputStreamClassObject == nullptr) {
+        sCFileOutputStreamClassObject = new CFileOutputStreamClassObject();
+    }
+    else if (sCFileOutputStreamClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCFileOutputStreamClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCFileOutputStreamClassObject;
+    return NOERROR;
+}
+
+static CFileOutputStreamClassObject* GetCachedCFileOutputStreamClassObject()
+{
+    CFileOutputStreamClassObject* clsObject = sCFileOutputStreamCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCFileOutputStreamClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCFileOutputStreamCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCFileOutputStreamClassObject == nullptr) {
+            sCFileOutputStreamClassObject = new CFileOutputStreamClassObject();
+        }
+        else if (sCFileOutputStreamClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCFileOutputStreamClassObject;
+        clsObject->AddRef();
+        sCFileOutputStreamCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCFileOutputStreamClassObjectCache()
+{
+    Spinlock& lock = GetCFileOutputStreamClassObjectLock();
+    lock.Lock();
+    CFileOutputStreamClassObject* clsObject = sCFileOutputStreamCachedClassObject.load(std::memory_order_relaxed);
+    sCFileOutputStreamCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CFileOutputStream::_CFileOutputStream()
+{
+    sCFileOutputStreamClassObject->AddRef();
+}
+
+_CFileOutputStream::~_CFileOutputStream()
+{
+    sCFileOutputStreamClassObject->Release();
+}
+
+ECode _CFileOutputStream::New(
+    /* [in] */ const String& name,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileOutputStreamClassObject* cachedClsObject = GetCachedCFileOutputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(name, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileOutputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileOutputStreamClassObject::Probe(clsObject)->CreateObject(name, iid, object);
+};
+
+ECode _CFileOutputStream::New(
+    /* [in] */ const String& name,
+    /* [in] */ Boolean append,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileOutputStreamClassObject* cachedClsObject = GetCachedCFileOutputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(name, append, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileOutputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileOutputStreamClassObject::Probe(clsObject)->CreateObject(name, append, iid, object);
+};
+
+ECode _CFileOutputStream::New(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileOutputStreamClassObject* cachedClsObject = GetCachedCFileOutputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(file, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileOutputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileOutputStreamClassObject::Probe(clsObject)->CreateObject(file, iid, object);
+};
+
+ECode _CFileOutputStream::New(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ Boolean append,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileOutputStreamClassObject* cachedClsObject = GetCachedCFileOutputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(file, append, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileOutputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileOutputStreamClassObject::Probe(clsObject)->CreateObject(file, append, iid, object);
+};
+
+ECode _CFileOutputStream::New(
+    /* [in] */ ccm::io::IFileDescriptor* fdObj,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileOutputStreamClassObject* cachedClsObject = GetCachedCFileOutputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(fdObj, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileOutputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileOutputStreamClassObject::Probe(clsObject)->CreateObject(fdObj, iid, object);
+};
+
+ECode _CFileOutputStream::New(
+    /* [in] */ ccm::io::IFileDescriptor* fdObj,
+    /* [in] */ Boolean isFdOwner,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFileOutputStreamClassObject* cachedClsObject = GetCachedCFileOutputStreamClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(fdObj, isFdOwner, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFileOutputStream, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFileOutputStreamClassObject::Probe(clsObject)->CreateObject(fdObj, isFdOwner, iid, object);
+};
+
+} // namespace io
+} // namespace ccm
@@ -0,0 +1,344 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "COutputStreamWriter.h"
+#include "ccm.io.ICOutputStreamWriterClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+class COutputStreamWriterClassObject
+    : public ClassObject
+    , public ICOutputStreamWriterClassObject
+{
+public:
+    COutputStreamWriterClassObject();
+
+    ~COutputStreamWriterClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ const String& charsetName,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ ccm::io::charset::ICharset* cs,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ ccm::io::charset::ICharsetEncoder* enc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static COutputStreamWriterClassObject* sCOutputStreamWriterClassObject = nullptr;
+static std::atomic<COutputStreamWriterClassObject*> sCOutputStreamWriterCachedClassObject(nullptr);
+static Spinlock& GetCOutputStreamWriterClassObjectLock()
+{
+    static Spinlock sCOutputStreamWriterClassObjectLock;
+    return sCOutputStreamWriterClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(COutputStreamWriterClassObject, ClassObject, ICOutputStreamWriterClassObject);
+
+COutputStreamWriterClassObject::COutputStreamWriterClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+COutputStreamWriterClassObject::~COutputStreamWriterClassObject()
+{
+    Spinlock& lock = GetCOutputStreamWriterClassObjectLock();
+    lock.Lock();
+    sCOutputStreamWriterClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode COutputStreamWriterClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode COutputStreamWriterClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode COutputStreamWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ const String& charsetName,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(COutputStreamWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    COutputStreamWriter* _obj = new(addr) COutputStreamWriter();
+    ECode ec = _obj->Constructor(outstream, charsetName);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::COutputStreamWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode COutputStreamWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(COutputStreamWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    COutputStreamWriter* _obj = new(addr) COutputStreamWriter();
+    ECode ec = _obj->Constructor(outstream);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::COutputStreamWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode COutputStreamWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ ccm::io::charset::ICharset* cs,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(COutputStreamWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    COutputStreamWriter* _obj = new(addr) COutputStreamWriter();
+    ECode ec = _obj->Constructor(outstream, cs);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::COutputStreamWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode COutputStreamWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ ccm::io::charset::ICharsetEncoder* enc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(COutputStreamWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    COutputStreamWriter* _obj = new(addr) COutputStreamWriter();
+    ECode ec = _obj->Constructor(outstream, enc);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::COutputStreamWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCOutputStreamWriterClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCOutputStreamWriterClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCOutputStreamWriterClassObject == nullptr) {
+        sCOutputStreamWriterClassObject = new COutputStreamWriterClassObject();
+    }
+    else if (sCOutputStreamWriterClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCOutputStreamWriterClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCOutputStreamWriterClassObject;
+    return NOERROR;
+}
+
+static COutputStreamWriterClassObject* GetCachedCOutputStreamWriterClassObject()
+{
+    COutputStreamWriterClassObject* clsObject = sCOutputStreamWriterCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCOutputStreamWriterClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCOutputStreamWriterCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCOutputStreamWriterClassObject == nullptr) {
+            sCOutputStreamWriterClassObject = new COutputStreamWriterClassObject();
+        }
+        else if (sCOutputStreamWriterClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCOutputStreamWriterClassObject;
+        clsObject->AddRef();
+        sCOutputStreamWriterCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCOutputStreamWriterClassObjectCache()
+{
+    Spinlock& lock = GetCOutputStreamWriterClassObjectLock();
+    lock.Lock();
+    COutputStreamWriterClassObject* clsObject = sCOutputStreamWriterCachedClassObject.load(std::memory_order_relaxed);
+    sCOutputStreamWriterCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_COutputStreamWriter::_COutputStreamWriter()
+{
+    sCOutputStreamWriterClassObject->AddRef();
+}
+
+_COutputStreamWriter::~_COutputStreamWriter()
+{
+    sCOutputStreamWriterClassObject->Release();
+}
+
+ECode _COutputStreamWriter::New(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ const String& charsetName,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    COutputStreamWriterClassObject* cachedClsObject = GetCachedCOutputStreamWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(outstream, charsetName, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_COutputStreamWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICOutputStreamWriterClassObject::Probe(clsObject)->CreateObject(outstream, charsetName, iid, object);
+};
+
+ECode _COutputStreamWriter::New(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    COutputStreamWriterClassObject* cachedClsObject = GetCachedCOutputStreamWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(outstream, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_COutputStreamWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICOutputStreamWriterClassObject::Probe(clsObject)->CreateObject(outstream, iid, object);
+};
+
+ECode _COutputStreamWriter::New(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ ccm::io::charset::ICharset* cs,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    COutputStreamWriterClassObject* cachedClsObject = GetCachedCOutputStreamWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(outstream, cs, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_COutputStreamWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICOutputStreamWriterClassObject::Probe(clsObject)->CreateObject(outstream, cs, iid, object);
+};
+
+ECode _COutputStreamWriter::New(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ ccm::io::charset::ICharsetEncoder* enc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    COutputStreamWriterClassObject* cachedClsObject = GetCachedCOutputStreamWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(outstream, enc, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_COutputStreamWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICOutputStreamWriterClassObject::Probe(clsObject)->CreateObject(outstream, enc, iid, object);
+};
+
+} // namespace io
+} // namespace ccm
@@ -0,0 +1,64 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_COUTPUTSTREAMWRITER_H_GEN__
+#define __CCM_IO_COUTPUTSTREAMWRITER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const CoclassID CID_COutputStreamWriter;
+
+COCLASS_ID(3f1442a5-ce76-40b3-8889-c9431c810c1d)
+class _COutputStreamWriter
+{
+public:
+    _COutputStreamWriter();
+
+    virtual ~_COutputStreamWriter();
+
+    static ECode New(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ const String& charsetName,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ ccm::io::charset::ICharset* cs,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ ccm::io::charset::ICharsetEncoder* enc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_COUTPUTSTREAMWRITER_H_GEN__
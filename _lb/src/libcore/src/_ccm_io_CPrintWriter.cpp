@@ -0,0 +1,519 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CPrintWriter.h"
+#include "ccm.io.ICPrintWriterClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+class CPrintWriterClassObject
+    : public ClassObject
+    , public ICPrintWriterClassObject
+{
+public:
+    CPrintWriterClassObject();
+
+    ~CPrintWriterClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IWriter* outstream,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IWriter* outstream,
+        /* [in] */ Boolean autoFlush,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ Boolean autoFlush,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& fileName,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& fileName,
+        /* [in] */ const String& csn,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFile* file,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFile* file,
+        /* [in] */ const String& csn,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CPrintWriterClassObject* sCPrintWriterClassObject = nullptr;
+static std::atomic<CPrintWriterClassObject*> sCPrintWriterCachedClassObject(nullptr);
+static Spinlock& GetCPrintWriterClassObjectLock()
+{
+    static Spinlock sCPrintWriterClassObjectLock;
+    return sCPrintWriterClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CPrintWriterClassObject, ClassObject, ICPrintWriterClassObject);
+
+CPrintWriterClassObject::CPrintWriterClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CPrintWriterClassObject::~CPrintWriterClassObject()
+{
+    Spinlock& lock = GetCPrintWriterClassObjectLock();
+    lock.Lock();
+    sCPrintWriterClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CPrintWriterClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CPrintWriterClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CPrintWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IWriter* outstream,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPrintWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPrintWriter* _obj = new(addr) CPrintWriter();
+    ECode ec = _obj->Constructor(outstream);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CPrintWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CPrintWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IWriter* outstream,
+    /* [in] */ Boolean autoFlush,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPrintWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPrintWriter* _obj = new(addr) CPrintWriter();
+    ECode ec = _obj->Constructor(outstream, autoFlush);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CPrintWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CPrintWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPrintWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPrintWriter* _obj = new(addr) CPrintWriter();
+    ECode ec = _obj->Constructor(outstream);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CPrintWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CPrintWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ Boolean autoFlush,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPrintWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPrintWriter* _obj = new(addr) CPrintWriter();
+    ECode ec = _obj->Constructor(outstream, autoFlush);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CPrintWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CPrintWriterClassObject::CreateObject(
+    /* [in] */ const String& fileName,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPrintWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPrintWriter* _obj = new(addr) CPrintWriter();
+    ECode ec = _obj->Constructor(fileName);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CPrintWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CPrintWriterClassObject::CreateObject(
+    /* [in] */ const String& fileName,
+    /* [in] */ const String& csn,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPrintWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPrintWriter* _obj = new(addr) CPrintWriter();
+    ECode ec = _obj->Constructor(fileName, csn);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CPrintWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CPrintWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPrintWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPrintWriter* _obj = new(addr) CPrintWriter();
+    ECode ec = _obj->Constructor(file);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CPrintWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CPrintWriterClassObject::CreateObject(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const String& csn,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPrintWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPrintWriter* _obj = new(addr) CPrintWriter();
+    ECode ec = _obj->Constructor(file, csn);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CPrintWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCPrintWriterClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCPrintWriterClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCPrintWriterClassObject == nullptr) {
+        sCPrintWriterClassObject = new CPrintWriterClassObject();
+    }
+    else if (sCPrintWriterClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCPrintWriterClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCPrintWriterClassObject;
+    return NOERROR;
+}
+
+static CPrintWriterClassObject* GetCachedCPrintWriterClassObject()
+{
+    CPrintWriterClassObject* clsObject = sCPrintWriterCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCPrintWriterClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCPrintWriterCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCPrintWriterClassObject == nullptr) {
+            sCPrintWriterClassObject = new CPrintWriterClassObject();
+        }
+        else if (sCPrintWriterClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCPrintWriterClassObject;
+        clsObject->AddRef();
+        sCPrintWriterCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCPrintWriterClassObjectCache()
+{
+    Spinlock& lock = GetCPrintWriterClassObjectLock();
+    lock.Lock();
+    CPrintWriterClassObject* clsObject = sCPrintWriterCachedClassObject.load(std::memory_order_relaxed);
+    sCPrintWriterCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CPrintWriter::_CPrintWriter()
+{
+    sCPrintWriterClassObject->AddRef();
+}
+
+_CPrintWriter::~_CPrintWriter()
+{
+    sCPrintWriterClassObject->Release();
+}
+
+ECode _CPrintWriter::New(
+    /* [in] */ ccm::io::IWriter* outstream,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPrintWriterClassObject* cachedClsObject = GetCachedCPrintWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(outstream, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CPrintWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPrintWriterClassObject::Probe(clsObject)->CreateObject(outstream, iid, object);
+};
+
+ECode _CPrintWriter::New(
+    /* [in] */ ccm::io::IWriter* outstream,
+    /* [in] */ Boolean autoFlush,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPrintWriterClassObject* cachedClsObject = GetCachedCPrintWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(outstream, autoFlush, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CPrintWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPrintWriterClassObject::Probe(clsObject)->CreateObject(outstream, autoFlush, iid, object);
+};
+
+ECode _CPrintWriter::New(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPrintWriterClassObject* cachedClsObject = GetCachedCPrintWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(outstream, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CPrintWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPrintWriterClassObject::Probe(clsObject)->CreateObject(outstream, iid, object);
+};
+
+ECode _CPrintWriter::New(
+    /* [in] */ ccm::io::IOutputStream* outstream,
+    /* [in] */ Boolean autoFlush,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPrintWriterClassObject* cachedClsObject = GetCachedCPrintWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(outstream, autoFlush, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CPrintWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPrintWriterClassObject::Probe(clsObject)->CreateObject(outstream, autoFlush, iid, object);
+};
+
+ECode _CPrintWriter::New(
+    /* [in] */ const String& fileName,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPrintWriterClassObject* cachedClsObject = GetCachedCPrintWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(fileName, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CPrintWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPrintWriterClassObject::Probe(clsObject)->CreateObject(fileName, iid, object);
+};
+
+ECode _CPrintWriter::New(
+    /* [in] */ const String& fileName,
+    /* [in] */ const String& csn,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPrintWriterClassObject* cachedClsObject = GetCachedCPrintWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(fileName, csn, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CPrintWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPrintWriterClassObject::Probe(clsObject)->CreateObject(fileName, csn, iid, object);
+};
+
+ECode _CPrintWriter::New(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPrintWriterClassObject* cachedClsObject = GetCachedCPrintWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(file, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CPrintWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPrintWriterClassObject::Probe(clsObject)->CreateObject(file, iid, object);
+};
+
+ECode _CPrintWriter::New(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const String& csn,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPrintWriterClassObject* cachedClsObject = GetCachedCPrintWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(file, csn, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CPrintWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPrintWriterClassObject::Probe(clsObject)->CreateObject(file, csn, iid, object);
+};
+
+} // namespace io
+} // namespace ccm
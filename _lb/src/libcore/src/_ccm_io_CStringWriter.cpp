@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CStringWriter.h"
+#include "ccm.io.ICStringWriterClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+class CStringWriterClassObject
+    : public ClassObject
+    , public ICStringWriterClassObject
+{
+public:
+    CStringWriterClassObject();
+
+    ~CStringWriterClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialSize,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CStringWriterClassObject* sCStringWriterClassObject = nullptr;
+static std::atomic<CStringWriterClassObject*> sCStringWriterCachedClassObject(nullptr);
+static Spinlock& GetCStringWriterClassObjectLock()
+{
+    static Spinlock sCStringWriterClassObjectLock;
+    return sCStringWriterClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CStringWriterClassObject, ClassObject, ICStringWriterClassObject);
+
+CStringWriterClassObject::CStringWriterClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CStringWriterClassObject::~CStringWriterClassObject()
+{
+    Spinlock& lock = GetCStringWriterClassObjectLock();
+    lock.Lock();
+    sCStringWriterClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CStringWriterClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CStringWriterClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringWriter* _obj = new(addr) CStringWriter();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CStringWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CStringWriterClassObject::CreateObject(
+    /* [in] */ Integer initialSize,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringWriter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringWriter* _obj = new(addr) CStringWriter();
+    ECode ec = _obj->Constructor(initialSize);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::io::CStringWriter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCStringWriterClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCStringWriterClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCStringWriterClassObject == nullptr) {
+        sCStringWriterClassObject = new CStringWriterClassObject();
+    }
+    else if (sCStringWriterClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCStringWriterClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCStringWriterClassObject;
+    return NOERROR;
+}
+
+static CStringWriterClassObject* GetCachedCStringWriterClassObject()
+{
+    CStringWriterClassObject* clsObject = sCStringWriterCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCStringWriterClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCStringWriterCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCStringWriterClassObject == nullptr) {
+            sCStringWriterClassObject = new CStringWriterClassObject();
+        }
+        else if (sCStringWriterClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCStringWriterClassObject;
+        clsObject->AddRef();
+        sCStringWriterCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCStringWriterClassObjectCache()
+{
+    Spinlock& lock = GetCStringWriterClassObjectLock();
+    lock.Lock();
+    CStringWriterClassObject* clsObject = sCStringWriterCachedClassObject.load(std::memory_order_relaxed);
+    sCStringWriterCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CStringWriter::_CStringWriter()
+{
+    sCStringWriterClassObject->AddRef();
+}
+
+_CStringWriter::~_CStringWriter()
+{
+    sCStringWriterClassObject->Release();
+}
+
+ECode _CStringWriter::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringWriterClassObject* cachedClsObject = GetCachedCStringWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CStringWriter, iid, nullptr, object);
+};
+
+ECode _CStringWriter::New(
+    /* [in] */ Integer initialSize,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringWriterClassObject* cachedClsObject = GetCachedCStringWriterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialSize, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStringWriter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringWriterClassObject::Probe(clsObject)->CreateObject(initialSize, iid, object);
+};
+
+} // namespace io
+} // namespace ccm
@@ -0,0 +1,893 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CBigDecimal.h"
+#include "ccm.math.ICBigDecimalClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace math {
+
+class CBigDecimalClassObject
+    : public ClassObject
+    , public ICBigDecimalClassObject
+{
+public:
+    CBigDecimalClassObject();
+
+    ~CBigDecimalClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const Array<Char>& arr,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer len,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const Array<Char>& arr,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer len,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const Array<Char>& arr,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const Array<Char>& arr,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& value,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Double value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Double value,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::math::IBigInteger* unscaledValue,
+        /* [in] */ Integer scale,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::math::IBigInteger* unscaledValue,
+        /* [in] */ Integer scale,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer value,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Long value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Long value,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CBigDecimalClassObject* sCBigDecimalClassObject = nullptr;
+static std::atomic<CBigDecimalClassObject*> sCBigDecimalCachedClassObject(nullptr);
+static Spinlock& GetCBigDecimalClassObjectLock()
+{
+    static Spinlock sCBigDecimalClassObjectLock;
+    return sCBigDecimalClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CBigDecimalClassObject, ClassObject, ICBigDecimalClassObject);
+
+CBigDecimalClassObject::CBigDecimalClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CBigDecimalClassObject::~CBigDecimalClassObject()
+{
+    Spinlock& lock = GetCBigDecimalClassObjectLock();
+    lock.Lock();
+    sCBigDecimalClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CBigDecimalClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ const Array<Char>& arr,
+    /* [in] */ Integer offset,
+    /* [in] */ Integer len,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(arr, offset, len);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ const Array<Char>& arr,
+    /* [in] */ Integer offset,
+    /* [in] */ Integer len,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(arr, offset, len, mc);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ const Array<Char>& arr,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(arr);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ const Array<Char>& arr,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(arr, mc);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ const String& value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ const String& value,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(value, mc);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ Double value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ Double value,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(value, mc);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ ccm::math::IBigInteger* value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ ccm::math::IBigInteger* value,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(value, mc);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ ccm::math::IBigInteger* unscaledValue,
+    /* [in] */ Integer scale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(unscaledValue, scale);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ ccm::math::IBigInteger* unscaledValue,
+    /* [in] */ Integer scale,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(unscaledValue, scale, mc);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ Integer value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ Integer value,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(value, mc);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ Long value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigDecimalClassObject::CreateObject(
+    /* [in] */ Long value,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigDecimal), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigDecimal* _obj = new(addr) CBigDecimal();
+    ECode ec = _obj->Constructor(value, mc);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigDecimal");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCBigDecimalClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCBigDecimalClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCBigDecimalClassObject == nullptr) {
+        sCBigDecimalClassObject = new CBigDecimalClassObject();
+    }
+    else if (sCBigDecimalClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCBigDecimalClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCBigDecimalClassObject;
+    return NOERROR;
+}
+
+static CBigDecimalClassObject* GetCachedCBigDecimalClassObject()
+{
+    CBigDecimalClassObject* clsObject = sCBigDecimalCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCBigDecimalClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCBigDecimalCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCBigDecimalClassObject == nullptr) {
+            sCBigDecimalClassObject = new CBigDecimalClassObject();
+        }
+        else if (sCBigDecimalClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCBigDecimalClassObject;
+        clsObject->AddRef();
+        sCBigDecimalCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCBigDecimalClassObjectCache()
+{
+    Spinlock& lock = GetCBigDecimalClassObjectLock();
+    lock.Lock();
+    CBigDecimalClassObject* clsObject = sCBigDecimalCachedClassObject.load(std::memory_order_relaxed);
+    sCBigDecimalCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CBigDecimal::_CBigDecimal()
+{
+    sCBigDecimalClassObject->AddRef();
+}
+
+_CBigDecimal::~_CBigDecimal()
+{
+    sCBigDecimalClassObject->Release();
+}
+
+ECode _CBigDecimal::New(
+    /* [in] */ const Array<Char>& arr,
+    /* [in] */ Integer offset,
+    /* [in] */ Integer len,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(arr, offset, len, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(arr, offset, len, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ const Array<Char>& arr,
+    /* [in] */ Integer offset,
+    /* [in] */ Integer len,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(arr, offset, len, mc, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(arr, offset, len, mc, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ const Array<Char>& arr,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(arr, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(arr, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ const Array<Char>& arr,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(arr, mc, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(arr, mc, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ const String& value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ const String& value,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, mc, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(value, mc, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ Double value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ Double value,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, mc, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(value, mc, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ ccm::math::IBigInteger* value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ ccm::math::IBigInteger* value,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, mc, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(value, mc, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ ccm::math::IBigInteger* unscaledValue,
+    /* [in] */ Integer scale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(unscaledValue, scale, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(unscaledValue, scale, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ ccm::math::IBigInteger* unscaledValue,
+    /* [in] */ Integer scale,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(unscaledValue, scale, mc, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(unscaledValue, scale, mc, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ Integer value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ Integer value,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, mc, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(value, mc, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ Long value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+ECode _CBigDecimal::New(
+    /* [in] */ Long value,
+    /* [in] */ ccm::math::IMathContext* mc,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigDecimalClassObject* cachedClsObject = GetCachedCBigDecimalClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, mc, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigDecimal, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigDecimalClassObject::Probe(clsObject)->CreateObject(value, mc, iid, object);
+};
+
+} // namespace math
+} // namespace ccm
@@ -0,0 +1,135 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MATH_CBIGDECIMAL_H_GEN__
+#define __CCM_MATH_CBIGDECIMAL_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace math {
+
+extern const CoclassID CID_CBigDecimal;
+
+COCLASS_ID(c0f44da4-575b-44e6-b234-2208a28582ae)
+class _CBigDecimal
+{
+public:
+    _CBigDecimal();
+
+    virtual ~_CBigDecimal();
+
+    static ECode New(
+        /* [in] */ const Array<Char>& arr,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer len,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const Array<Char>& arr,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer len,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const Array<Char>& arr,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const Array<Char>& arr,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const String& value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const String& value,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Double value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Double value,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::math::IBigInteger* unscaledValue,
+        /* [in] */ Integer scale,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::math::IBigInteger* unscaledValue,
+        /* [in] */ Integer scale,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer value,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Long value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Long value,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace math
+} // namespace ccm
+
+#endif // __CCM_MATH_CBIGDECIMAL_H_GEN__
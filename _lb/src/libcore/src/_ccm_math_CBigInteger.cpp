@@ -0,0 +1,436 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CBigInteger.h"
+#include "ccm.math.ICBigIntegerClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace math {
+
+class CBigIntegerClassObject
+    : public ClassObject
+    , public ICBigIntegerClassObject
+{
+public:
+    CBigIntegerClassObject();
+
+    ~CBigIntegerClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Integer numBits,
+        /* [in] */ ccm::util::IRandom* random,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer bitLength,
+        /* [in] */ Integer certainty,
+        /* [in] */ ccm::util::IRandom* random,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& value,
+        /* [in] */ Integer radix,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer signum,
+        /* [in] */ const Array<Byte>& magnitude,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const Array<Byte>& value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CBigIntegerClassObject* sCBigIntegerClassObject = nullptr;
+static std::atomic<CBigIntegerClassObject*> sCBigIntegerCachedClassObject(nullptr);
+static Spinlock& GetCBigIntegerClassObjectLock()
+{
+    static Spinlock sCBigIntegerClassObjectLock;
+    return sCBigIntegerClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CBigIntegerClassObject, ClassObject, ICBigIntegerClassObject);
+
+CBigIntegerClassObject::CBigIntegerClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CBigIntegerClassObject::~CBigIntegerClassObject()
+{
+    Spinlock& lock = GetCBigIntegerClassObjectLock();
+    lock.Lock();
+    sCBigIntegerClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CBigIntegerClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CBigIntegerClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CBigIntegerClassObject::CreateObject(
+    /* [in] */ Integer numBits,
+    /* [in] */ ccm::util::IRandom* random,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigInteger), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigInteger* _obj = new(addr) CBigInteger();
+    ECode ec = _obj->Constructor(numBits, random);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigInteger");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigIntegerClassObject::CreateObject(
+    /* [in] */ Integer bitLength,
+    /* [in] */ Integer certainty,
+    /* [in] */ ccm::util::IRandom* random,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigInteger), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigInteger* _obj = new(addr) CBigInteger();
+    ECode ec = _obj->Constructor(bitLength, certainty, random);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigInteger");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigIntegerClassObject::CreateObject(
+    /* [in] */ const String& value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigInteger), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigInteger* _obj = new(addr) CBigInteger();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigInteger");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigIntegerClassObject::CreateObject(
+    /* [in] */ const String& value,
+    /* [in] */ Integer radix,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigInteger), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigInteger* _obj = new(addr) CBigInteger();
+    ECode ec = _obj->Constructor(value, radix);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigInteger");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigIntegerClassObject::CreateObject(
+    /* [in] */ Integer signum,
+    /* [in] */ const Array<Byte>& magnitude,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigInteger), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigInteger* _obj = new(addr) CBigInteger();
+    ECode ec = _obj->Constructor(signum, magnitude);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigInteger");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CBigIntegerClassObject::CreateObject(
+    /* [in] */ const Array<Byte>& value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CBigInteger), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CBigInteger* _obj = new(addr) CBigInteger();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CBigInteger");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCBigIntegerClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCBigIntegerClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCBigIntegerClassObject == nullptr) {
+        sCBigIntegerClassObject = new CBigIntegerClassObject();
+    }
+    else if (sCBigIntegerClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCBigIntegerClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCBigIntegerClassObject;
+    return NOERROR;
+}
+
+static CBigIntegerClassObject* GetCachedCBigIntegerClassObject()
+{
+    CBigIntegerClassObject* clsObject = sCBigIntegerCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCBigIntegerClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCBigIntegerCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCBigIntegerClassObject == nullptr) {
+            sCBigIntegerClassObject = new CBigIntegerClassObject();
+        }
+        else if (sCBigIntegerClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCBigIntegerClassObject;
+        clsObject->AddRef();
+        sCBigIntegerCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCBigIntegerClassObjectCache()
+{
+    Spinlock& lock = GetCBigIntegerClassObjectLock();
+    lock.Lock();
+    CBigIntegerClassObject* clsObject = sCBigIntegerCachedClassObject.load(std::memory_order_relaxed);
+    sCBigIntegerCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CBigInteger::_CBigInteger()
+{
+    sCBigIntegerClassObject->AddRef();
+}
+
+_CBigInteger::~_CBigInteger()
+{
+    sCBigIntegerClassObject->Release();
+}
+
+ECode _CBigInteger::New(
+    /* [in] */ Integer numBits,
+    /* [in] */ ccm::util::IRandom* random,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigIntegerClassObject* cachedClsObject = GetCachedCBigIntegerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(numBits, random, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigInteger, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigIntegerClassObject::Probe(clsObject)->CreateObject(numBits, random, iid, object);
+};
+
+ECode _CBigInteger::New(
+    /* [in] */ Integer bitLength,
+    /* [in] */ Integer certainty,
+    /* [in] */ ccm::util::IRandom* random,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigIntegerClassObject* cachedClsObject = GetCachedCBigIntegerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(bitLength, certainty, random, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigInteger, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigIntegerClassObject::Probe(clsObject)->CreateObject(bitLength, certainty, random, iid, object);
+};
+
+ECode _CBigInteger::New(
+    /* [in] */ const String& value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigIntegerClassObject* cachedClsObject = GetCachedCBigIntegerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigInteger, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigIntegerClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+ECode _CBigInteger::New(
+    /* [in] */ const String& value,
+    /* [in] */ Integer radix,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigIntegerClassObject* cachedClsObject = GetCachedCBigIntegerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, radix, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigInteger, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigIntegerClassObject::Probe(clsObject)->CreateObject(value, radix, iid, object);
+};
+
+ECode _CBigInteger::New(
+    /* [in] */ Integer signum,
+    /* [in] */ const Array<Byte>& magnitude,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigIntegerClassObject* cachedClsObject = GetCachedCBigIntegerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(signum, magnitude, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigInteger, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigIntegerClassObject::Probe(clsObject)->CreateObject(signum, magnitude, iid, object);
+};
+
+ECode _CBigInteger::New(
+    /* [in] */ const Array<Byte>& value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CBigIntegerClassObject* cachedClsObject = GetCachedCBigIntegerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CBigInteger, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICBigIntegerClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+} // namespace math
+} // namespace ccm
@@ -0,0 +1,76 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MATH_CBIGINTEGER_H_GEN__
+#define __CCM_MATH_CBIGINTEGER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace math {
+
+extern const CoclassID CID_CBigInteger;
+
+COCLASS_ID(7a1ab981-ac06-4343-9746-db146876d3ac)
+class _CBigInteger
+{
+public:
+    _CBigInteger();
+
+    virtual ~_CBigInteger();
+
+    static ECode New(
+        /* [in] */ Integer numBits,
+        /* [in] */ ccm::util::IRandom* random,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer bitLength,
+        /* [in] */ Integer certainty,
+        /* [in] */ ccm::util::IRandom* random,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const String& value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const String& value,
+        /* [in] */ Integer radix,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer signum,
+        /* [in] */ const Array<Byte>& magnitude,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const Array<Byte>& value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace math
+} // namespace ccm
+
+#endif // __CCM_MATH_CBIGINTEGER_H_GEN__
@@ -0,0 +1,295 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CMathContext.h"
+#include "ccm.math.ICMathContextClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace math {
+
+class CMathContextClassObject
+    : public ClassObject
+    , public ICMathContextClassObject
+{
+public:
+    CMathContextClassObject();
+
+    ~CMathContextClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Integer precision,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer precision,
+        /* [in] */ ccm::math::RoundingMode roundingMode,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& s,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CMathContextClassObject* sCMathContextClassObject = nullptr;
+static std::atomic<CMathContextClassObject*> sCMathContextCachedClassObject(nullptr);
+static Spinlock& GetCMathContextClassObjectLock()
+{
+    static Spinlock sCMathContextClassObjectLock;
+    return sCMathContextClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CMathContextClassObject, ClassObject, ICMathContextClassObject);
+
+CMathContextClassObject::CMathContextClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CMathContextClassObject::~CMathContextClassObject()
+{
+    Spinlock& lock = GetCMathContextClassObjectLock();
+    lock.Lock();
+    sCMathContextClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CMathContextClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CMathContextClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CMathContextClassObject::CreateObject(
+    /* [in] */ Integer precision,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CMathContext), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CMathContext* _obj = new(addr) CMathContext();
+    ECode ec = _obj->Constructor(precision);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CMathContext");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CMathContextClassObject::CreateObject(
+    /* [in] */ Integer precision,
+    /* [in] */ ccm::math::RoundingMode roundingMode,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CMathContext), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CMathContext* _obj = new(addr) CMathContext();
+    ECode ec = _obj->Constructor(precision, roundingMode);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CMathContext");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CMathContextClassObject::CreateObject(
+    /* [in] */ const String& s,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CMathContext), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CMathContext* _obj = new(addr) CMathContext();
+    ECode ec = _obj->Constructor(s);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::math::CMathContext");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCMathContextClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCMathContextClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCMathContextClassObject == nullptr) {
+        sCMathContextClassObject = new CMathContextClassObject();
+    }
+    else if (sCMathContextClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCMathContextClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCMathContextClassObject;
+    return NOERROR;
+}
+
+static CMathContextClassObject* GetCachedCMathContextClassObject()
+{
+    CMathContextClassObject* clsObject = sCMathContextCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCMathContextClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCMathContextCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCMathContextClassObject == nullptr) {
+            sCMathContextClassObject = new CMathContextClassObject();
+        }
+        else if (sCMathContextClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCMathContextClassObject;
+        clsObject->AddRef();
+        sCMathContextCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCMathContextClassObjectCache()
+{
+    Spinlock& lock = GetCMathContextClassObjectLock();
+    lock.Lock();
+    CMathContextClassObject* clsObject = sCMathContextCachedClassObject.load(std::memory_order_relaxed);
+    sCMathContextCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CMathContext::_CMathContext()
+{
+    sCMathContextClassObject->AddRef();
+}
+
+_CMathContext::~_CMathContext()
+{
+    sCMathContextClassObject->Release();
+}
+
+ECode _CMathContext::New(
+    /* [in] */ Integer precision,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CMathContextClassObject* cachedClsObject = GetCachedCMathContextClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(precision, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CMathContext, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICMathContextClassObject::Probe(clsObject)->CreateObject(precision, iid, object);
+};
+
+ECode _CMathContext::New(
+    /* [in] */ Integer precision,
+    /* [in] */ ccm::math::RoundingMode roundingMode,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CMathContextClassObject* cachedClsObject = GetCachedCMathContextClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(precision, roundingMode, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CMathContext, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICMathContextClassObject::Probe(clsObject)->CreateObject(precision, roundingMode, iid, object);
+};
+
+ECode _CMathContext::New(
+    /* [in] */ const String& s,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CMathContextClassObject* cachedClsObject = GetCachedCMathContextClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(s, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CMathContext, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICMathContextClassObject::Probe(clsObject)->CreateObject(s, iid, object);
+};
+
+} // namespace math
+} // namespace ccm
@@ -0,0 +1,57 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MATH_CMATHCONTEXT_H_GEN__
+#define __CCM_MATH_CMATHCONTEXT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace math {
+
+extern const CoclassID CID_CMathContext;
+
+COCLASS_ID(5542bfb6-c4d8-4fb2-a9b9-9683c61ad170)
+class _CMathContext
+{
+public:
+    _CMathContext();
+
+    virtual ~_CMathContext();
+
+    static ECode New(
+        /* [in] */ Integer precision,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer precision,
+        /* [in] */ ccm::math::RoundingMode roundingMode,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const String& s,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace math
+} // namespace ccm
+
+#endif // __CCM_MATH_CMATHCONTEXT_H_GEN__
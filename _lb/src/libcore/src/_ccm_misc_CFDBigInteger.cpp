@@ -0,0 +1,215 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CFDBigInteger.h"
+#include "ccm.misc.ICFDBigIntegerClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace misc {
+
+class CFDBigIntegerClassObject
+    : public ClassObject
+    , public ICFDBigIntegerClassObject
+{
+public:
+    CFDBigIntegerClassObject();
+
+    ~CFDBigIntegerClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Long lValue,
+        /* [in] */ const Array<Char>& digits,
+        /* [in] */ Integer kDigits,
+        /* [in] */ Integer nDigits,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CFDBigIntegerClassObject* sCFDBigIntegerClassObject = nullptr;
+static std::atomic<CFDBigIntegerClassObject*> sCFDBigIntegerCachedClassObject(nullptr);
+static Spinlock& GetCFDBigIntegerClassObjectLock()
+{
+    static Spinlock sCFDBigIntegerClassObjectLock;
+    return sCFDBigIntegerClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CFDBigIntegerClassObject, ClassObject, ICFDBigIntegerClassObject);
+
+CFDBigIntegerClassObject::CFDBigIntegerClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CFDBigIntegerClassObject::~CFDBigIntegerClassObject()
+{
+    Spinlock& lock = GetCFDBigIntegerClassObjectLock();
+    lock.Lock();
+    sCFDBigIntegerClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CFDBigIntegerClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CFDBigIntegerClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CFDBigIntegerClassObject::CreateObject(
+    /* [in] */ Long lValue,
+    /* [in] */ const Array<Char>& digits,
+    /* [in] */ Integer kDigits,
+    /* [in] */ Integer nDigits,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFDBigInteger), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFDBigInteger* _obj = new(addr) CFDBigInteger();
+    ECode ec = _obj->Constructor(lValue, digits, kDigits, nDigits);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::misc::CFDBigInteger");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCFDBigIntegerClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCFDBigIntegerClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCFDBigIntegerClassObject == nullptr) {
+        sCFDBigIntegerClassObject = new CFDBigIntegerClassObject();
+    }
+    else if (sCFDBigIntegerClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCFDBigIntegerClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCFDBigIntegerClassObject;
+    return NOERROR;
+}
+
+static CFDBigIntegerClassObject* GetCachedCFDBigIntegerClassObject()
+{
+    CFDBigIntegerClassObject* clsObject = sCFDBigIntegerCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCFDBigIntegerClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCFDBigIntegerCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCFDBigIntegerClassObject == nullptr) {
+            sCFDBigIntegerClassObject = new CFDBigIntegerClassObject();
+        }
+        else if (sCFDBigIntegerClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCFDBigIntegerClassObject;
+        clsObject->AddRef();
+        sCFDBigIntegerCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCFDBigIntegerClassObjectCache()
+{
+    Spinlock& lock = GetCFDBigIntegerClassObjectLock();
+    lock.Lock();
+    CFDBigIntegerClassObject* clsObject = sCFDBigIntegerCachedClassObject.load(std::memory_order_relaxed);
+    sCFDBigIntegerCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CFDBigInteger::_CFDBigInteger()
+{
+    sCFDBigIntegerClassObject->AddRef();
+}
+
+_CFDBigInteger::~_CFDBigInteger()
+{
+    sCFDBigIntegerClassObject->Release();
+}
+
+ECode _CFDBigInteger::New(
+    /* [in] */ Long lValue,
+    /* [in] */ const Array<Char>& digits,
+    /* [in] */ Integer kDigits,
+    /* [in] */ Integer nDigits,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFDBigIntegerClassObject* cachedClsObject = GetCachedCFDBigIntegerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(lValue, digits, kDigits, nDigits, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFDBigInteger, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFDBigIntegerClassObject::Probe(clsObject)->CreateObject(lValue, digits, kDigits, nDigits, iid, object);
+};
+
+} // namespace misc
+} // namespace ccm
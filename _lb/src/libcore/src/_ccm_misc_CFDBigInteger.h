@@ -0,0 +1,49 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MISC_CFDBIGINTEGER_H_GEN__
+#define __CCM_MISC_CFDBIGINTEGER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace misc {
+
+extern const CoclassID CID_CFDBigInteger;
+
+COCLASS_ID(e8cd20cc-761f-4006-9741-fe8cf701c009)
+class _CFDBigInteger
+{
+public:
+    _CFDBigInteger();
+
+    virtual ~_CFDBigInteger();
+
+    static ECode New(
+        /* [in] */ Long lValue,
+        /* [in] */ const Array<Char>& digits,
+        /* [in] */ Integer kDigits,
+        /* [in] */ Integer nDigits,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace misc
+} // namespace ccm
+
+#endif // __CCM_MISC_CFDBIGINTEGER_H_GEN__
@@ -0,0 +1,176 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CPermissions.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+
+class CPermissionsClassObject
+    : public ClassObject
+{
+public:
+    CPermissionsClassObject();
+
+    ~CPermissionsClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CPermissionsClassObject* sCPermissionsClassObject = nullptr;
+static std::atomic<CPermissionsClassObject*> sCPermissionsCachedClassObject(nullptr);
+static Spinlock& GetCPermissionsClassObjectLock()
+{
+    static Spinlock sCPermissionsClassObjectLock;
+    return sCPermissionsClassObjectLock;
+}
+
+CPermissionsClassObject::CPermissionsClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CPermissionsClassObject::~CPermissionsClassObject()
+{
+    Spinlock& lock = GetCPermissionsClassObjectLock();
+    lock.Lock();
+    sCPermissionsClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CPermissionsClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CPermissionsClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPermissions), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPermissions* _obj = new(addr) CPermissions();
+    _obj->AttachMetadata(mComponent, "ccm::security::CPermissions");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCPermissionsClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCPermissionsClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCPermissionsClassObject == nullptr) {
+        sCPermissionsClassObject = new CPermissionsClassObject();
+    }
+    else if (sCPermissionsClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCPermissionsClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCPermissionsClassObject;
+    return NOERROR;
+}
+
+static CPermissionsClassObject* GetCachedCPermissionsClassObject()
+{
+    CPermissionsClassObject* clsObject = sCPermissionsCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCPermissionsClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCPermissionsCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCPermissionsClassObject == nullptr) {
+            sCPermissionsClassObject = new CPermissionsClassObject();
+        }
+        else if (sCPermissionsClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCPermissionsClassObject;
+        clsObject->AddRef();
+        sCPermissionsCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCPermissionsClassObjectCache()
+{
+    Spinlock& lock = GetCPermissionsClassObjectLock();
+    lock.Lock();
+    CPermissionsClassObject* clsObject = sCPermissionsCachedClassObject.load(std::memory_order_relaxed);
+    sCPermissionsCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CPermissions::_CPermissions()
+{
+    sCPermissionsClassObject->AddRef();
+}
+
+_CPermissions::~_CPermissions()
+{
+    sCPermissionsClassObject->Release();
+}
+
+ECode _CPermissions::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPermissionsClassObject* cachedClsObject = GetCachedCPermissionsClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CPermissions, iid, nullptr, object);
+};
+
+} // namespace security
+} // namespace ccm
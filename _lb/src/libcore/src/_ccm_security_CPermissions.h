@@ -0,0 +1,45 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_SECURITY_CPERMISSIONS_H_GEN__
+#define __CCM_SECURITY_CPERMISSIONS_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+
+extern const CoclassID CID_CPermissions;
+
+COCLASS_ID(c9a89c69-63a6-4636-b77a-97c83ba380ee)
+class _CPermissions
+{
+public:
+    _CPermissions();
+
+    virtual ~_CPermissions();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace security
+} // namespace ccm
+
+#endif // __CCM_SECURITY_CPERMISSIONS_H_GEN__
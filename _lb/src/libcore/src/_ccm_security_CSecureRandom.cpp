@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CSecureRandom.h"
+#include "ccm.security.ICSecureRandomClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+
+class CSecureRandomClassObject
+    : public ClassObject
+    , public ICSecureRandomClassObject
+{
+public:
+    CSecureRandomClassObject();
+
+    ~CSecureRandomClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const Array<Byte>& seed,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CSecureRandomClassObject* sCSecureRandomClassObject = nullptr;
+static std::atomic<CSecureRandomClassObject*> sCSecureRandomCachedClassObject(nullptr);
+static Spinlock& GetCSecureRandomClassObjectLock()
+{
+    static Spinlock sCSecureRandomClassObjectLock;
+    return sCSecureRandomClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CSecureRandomClassObject, ClassObject, ICSecureRandomClassObject);
+
+CSecureRandomClassObject::CSecureRandomClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CSecureRandomClassObject::~CSecureRandomClassObject()
+{
+    Spinlock& lock = GetCSecureRandomClassObjectLock();
+    lock.Lock();
+    sCSecureRandomClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CSecureRandomClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CSecureRandomClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSecureRandom), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSecureRandom* _obj = new(addr) CSecureRandom();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::security::CSecureRandom");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CSecureRandomClassObject::CreateObject(
+    /* [in] */ const Array<Byte>& seed,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSecureRandom), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSecureRandom* _obj = new(addr) CSecureRandom();
+    ECode ec = _obj->Constructor(seed);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::security::CSecureRandom");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCSecureRandomClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCSecureRandomClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCSecureRandomClassObject == nullptr) {
+        sCSecureRandomClassObject = new CSecureRandomClassObject();
+    }
+    else if (sCSecureRandomClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCSecureRandomClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCSecureRandomClassObject;
+    return NOERROR;
+}
+
+static CSecureRandomClassObject* GetCachedCSecureRandomClassObject()
+{
+    CSecureRandomClassObject* clsObject = sCSecureRandomCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCSecureRandomClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCSecureRandomCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCSecureRandomClassObject == nullptr) {
+            sCSecureRandomClassObject = new CSecureRandomClassObject();
+        }
+        else if (sCSecureRandomClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCSecureRandomClassObject;
+        clsObject->AddRef();
+        sCSecureRandomCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCSecureRandomClassObjectCache()
+{
+    Spinlock& lock = GetCSecureRandomClassObjectLock();
+    lock.Lock();
+    CSecureRandomClassObject* clsObject = sCSecureRandomCachedClassObject.load(std::memory_order_relaxed);
+    sCSecureRandomCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CSecureRandom::_CSecureRandom()
+{
+    sCSecureRandomClassObject->AddRef();
+}
+
+_CSecureRandom::~_CSecureRandom()
+{
+    sCSecureRandomClassObject->Release();
+}
+
+ECode _CSecureRandom::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSecureRandomClassObject* cachedClsObject = GetCachedCSecureRandomClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CSecureRandom, iid, nullptr, object);
+};
+
+ECode _CSecureRandom::New(
+    /* [in] */ const Array<Byte>& seed,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSecureRandomClassObject* cachedClsObject = GetCachedCSecureRandomClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(seed, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSecureRandom, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSecureRandomClassObject::Probe(clsObject)->CreateObject(seed, iid, object);
+};
+
+} // namespace security
+} // namespace ccm
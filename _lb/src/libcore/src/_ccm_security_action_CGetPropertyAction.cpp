@@ -0,0 +1,254 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CGetPropertyAction.h"
+#include "ccm.security.action.ICGetPropertyActionClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+namespace action {
+
+class CGetPropertyActionClassObject
+    : public ClassObject
+    , public ICGetPropertyActionClassObject
+{
+public:
+    CGetPropertyActionClassObject();
+
+    ~CGetPropertyActionClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& theProp,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& theProp,
+        /* [in] */ const String& defaultVal,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CGetPropertyActionClassObject* sCGetPropertyActionClassObject = nullptr;
+static std::atomic<CGetPropertyActionClassObject*> sCGetPropertyActionCachedClassObject(nullptr);
+static Spinlock& GetCGetPropertyActionClassObjectLock()
+{
+    static Spinlock sCGetPropertyActionClassObjectLock;
+    return sCGetPropertyActionClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CGetPropertyActionClassObject, ClassObject, ICGetPropertyActionClassObject);
+
+CGetPropertyActionClassObject::CGetPropertyActionClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CGetPropertyActionClassObject::~CGetPropertyActionClassObject()
+{
+    Spinlock& lock = GetCGetPropertyActionClassObjectLock();
+    lock.Lock();
+    sCGetPropertyActionClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CGetPropertyActionClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CGetPropertyActionClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CGetPropertyActionClassObject::CreateObject(
+    /* [in] */ const String& theProp,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CGetPropertyAction), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CGetPropertyAction* _obj = new(addr) CGetPropertyAction();
+    ECode ec = _obj->Constructor(theProp);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::security::action::CGetPropertyAction");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CGetPropertyActionClassObject::CreateObject(
+    /* [in] */ const String& theProp,
+    /* [in] */ const String& defaultVal,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CGetPropertyAction), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CGetPropertyAction* _obj = new(addr) CGetPropertyAction();
+    ECode ec = _obj->Constructor(theProp, defaultVal);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::security::action::CGetPropertyAction");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCGetPropertyActionClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCGetPropertyActionClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCGetPropertyActionClassObject == nullptr) {
+        sCGetPropertyActionClassObject = new CGetPropertyActionClassObject();
+    }
+    else if (sCGetPropertyActionClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCGetPropertyActionClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCGetPropertyActionClassObject;
+    return NOERROR;
+}
+
+static CGetPropertyActionClassObject* GetCachedCGetPropertyActionClassObject()
+{
+    CGetPropertyActionClassObject* clsObject = sCGetPropertyActionCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCGetPropertyActionClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCGetPropertyActionCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCGetPropertyActionClassObject == nullptr) {
+            sCGetPropertyActionClassObject = new CGetPropertyActionClassObject();
+        }
+        else if (sCGetPropertyActionClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCGetPropertyActionClassObject;
+        clsObject->AddRef();
+        sCGetPropertyActionCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCGetPropertyActionClassObjectCache()
+{
+    Spinlock& lock = GetCGetPropertyActionClassObjectLock();
+    lock.Lock();
+    CGetPropertyActionClassObject* clsObject = sCGetPropertyActionCachedClassObject.load(std::memory_order_relaxed);
+    sCGetPropertyActionCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CGetPropertyAction::_CGetPropertyAction()
+{
+    sCGetPropertyActionClassObject->AddRef();
+}
+
+_CGetPropertyAction::~_CGetPropertyAction()
+{
+    sCGetPropertyActionClassObject->Release();
+}
+
+ECode _CGetPropertyAction::New(
+    /* [in] */ const String& theProp,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CGetPropertyActionClassObject* cachedClsObject = GetCachedCGetPropertyActionClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(theProp, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CGetPropertyAction, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICGetPropertyActionClassObject::Probe(clsObject)->CreateObject(theProp, iid, object);
+};
+
+ECode _CGetPropertyAction::New(
+    /* [in] */ const String& theProp,
+    /* [in] */ const String& defaultVal,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CGetPropertyActionClassObject* cachedClsObject = GetCachedCGetPropertyActionClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(theProp, defaultVal, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CGetPropertyAction, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICGetPropertyActionClassObject::Probe(clsObject)->CreateObject(theProp, defaultVal, iid, object);
+};
+
+} // namespace action
+} // namespace security
+} // namespace ccm
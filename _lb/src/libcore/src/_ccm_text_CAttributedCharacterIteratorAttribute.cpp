@@ -0,0 +1,158 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CAttributedCharacterIteratorAttribute.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CAttributedCharacterIteratorAttributeClassObject
+    : public ClassObject
+{
+public:
+    CAttributedCharacterIteratorAttributeClassObject();
+
+    ~CAttributedCharacterIteratorAttributeClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CAttributedCharacterIteratorAttributeClassObject* sCAttributedCharacterIteratorAttributeClassObject = nullptr;
+static std::atomic<CAttributedCharacterIteratorAttributeClassObject*> sCAttributedCharacterIteratorAttributeCachedClassObject(nullptr);
+static Spinlock& GetCAttributedCharacterIteratorAttributeClassObjectLock()
+{
+    static Spinlock sCAttributedCharacterIteratorAttributeClassObjectLock;
+    return sCAttributedCharacterIteratorAttributeClassObjectLock;
+}
+
+CAttributedCharacterIteratorAttributeClassObject::CAttributedCharacterIteratorAttributeClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CAttributedCharacterIteratorAttributeClassObject::~CAttributedCharacterIteratorAttributeClassObject()
+{
+    Spinlock& lock = GetCAttributedCharacterIteratorAttributeClassObjectLock();
+    lock.Lock();
+    sCAttributedCharacterIteratorAttributeClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CAttributedCharacterIteratorAttributeClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CAttributedCharacterIteratorAttributeClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    *object = nullptr;
+    return NOERROR;
+}
+
+ECode GetCAttributedCharacterIteratorAttributeClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCAttributedCharacterIteratorAttributeClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCAttributedCharacterIteratorAttributeClassObject == nullptr) {
+        sCAttributedCharacterIteratorAttributeClassObject = new CAttributedCharacterIteratorAttributeClassObject();
+    }
+    else if (sCAttributedCharacterIteratorAttributeClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCAttributedCharacterIteratorAttributeClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCAttributedCharacterIteratorAttributeClassObject;
+    return NOERROR;
+}
+
+static CAttributedCharacterIteratorAttributeClassObject* GetCachedCAttributedCharacterIteratorAttributeClassObject()
+{
+    CAttributedCharacterIteratorAttributeClassObject* clsObject = sCAttributedCharacterIteratorAttributeCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCAttributedCharacterIteratorAttributeClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCAttributedCharacterIteratorAttributeCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCAttributedCharacterIteratorAttributeClassObject == nullptr) {
+            sCAttributedCharacterIteratorAttributeClassObject = new CAttributedCharacterIteratorAttributeClassObject();
+        }
+        else if (sCAttributedCharacterIteratorAttributeClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCAttributedCharacterIteratorAttributeClassObject;
+        clsObject->AddRef();
+        sCAttributedCharacterIteratorAttributeCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCAttributedCharacterIteratorAttributeClassObjectCache()
+{
+    Spinlock& lock = GetCAttributedCharacterIteratorAttributeClassObjectLock();
+    lock.Lock();
+    CAttributedCharacterIteratorAttributeClassObject* clsObject = sCAttributedCharacterIteratorAttributeCachedClassObject.load(std::memory_order_relaxed);
+    sCAttributedCharacterIteratorAttributeCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CAttributedCharacterIteratorAttribute::_CAttributedCharacterIteratorAttribute()
+{
+    sCAttributedCharacterIteratorAttributeClassObject->AddRef();
+}
+
+_CAttributedCharacterIteratorAttribute::~_CAttributedCharacterIteratorAttribute()
+{
+    sCAttributedCharacterIteratorAttributeClassObject->Release();
+}
+
+} // namespace text
+} // namespace ccm
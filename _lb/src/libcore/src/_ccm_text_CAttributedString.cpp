@@ -0,0 +1,396 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CAttributedString.h"
+#include "ccm.text.ICAttributedStringClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CAttributedStringClassObject
+    : public ClassObject
+    , public ICAttributedStringClassObject
+{
+public:
+    CAttributedStringClassObject();
+
+    ~CAttributedStringClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& text,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& text,
+        /* [in] */ ccm::util::IMap* attributes,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+        /* [in] */ Integer beginIndex,
+        /* [in] */ Integer endIndex,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+        /* [in] */ Integer beginIndex,
+        /* [in] */ Integer endIndex,
+        /* [in] */ const Array<ccm::text::IAttributedCharacterIterator::IAttribute*>& attributes,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CAttributedStringClassObject* sCAttributedStringClassObject = nullptr;
+static std::atomic<CAttributedStringClassObject*> sCAttributedStringCachedClassObject(nullptr);
+static Spinlock& GetCAttributedStringClassObjectLock()
+{
+    static Spinlock sCAttributedStringClassObjectLock;
+    return sCAttributedStringClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CAttributedStringClassObject, ClassObject, ICAttributedStringClassObject);
+
+CAttributedStringClassObject::CAttributedStringClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CAttributedStringClassObject::~CAttributedStringClassObject()
+{
+    Spinlock& lock = GetCAttributedStringClassObjectLock();
+    lock.Lock();
+    sCAttributedStringClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CAttributedStringClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CAttributedStringClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CAttributedStringClassObject::CreateObject(
+    /* [in] */ const String& text,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAttributedString), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAttributedString* _obj = new(addr) CAttributedString();
+    ECode ec = _obj->Constructor(text);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CAttributedString");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CAttributedStringClassObject::CreateObject(
+    /* [in] */ const String& text,
+    /* [in] */ ccm::util::IMap* attributes,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAttributedString), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAttributedString* _obj = new(addr) CAttributedString();
+    ECode ec = _obj->Constructor(text, attributes);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CAttributedString");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CAttributedStringClassObject::CreateObject(
+    /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAttributedString), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAttributedString* _obj = new(addr) CAttributedString();
+    ECode ec = _obj->Constructor(text);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CAttributedString");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CAttributedStringClassObject::CreateObject(
+    /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+    /* [in] */ Integer beginIndex,
+    /* [in] */ Integer endIndex,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAttributedString), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAttributedString* _obj = new(addr) CAttributedString();
+    ECode ec = _obj->Constructor(text, beginIndex, endIndex);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CAttributedString");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CAttributedStringClassObject::CreateObject(
+    /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+    /* [in] */ Integer beginIndex,
+    /* [in] */ Integer endIndex,
+    /* [in] */ const Array<ccm::text::IAttributedCharacterIterator::IAttribute*>& attributes,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAttributedString), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAttributedString* _obj = new(addr) CAttributedString();
+    ECode ec = _obj->Constructor(text, beginIndex, endIndex, attributes);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CAttributedString");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCAttributedStringClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCAttributedStringClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCAttributedStringClassObject == nullptr) {
+        sCAttributedStringClassObject = new CAttributedStringClassObject();
+    }
+    else if (sCAttributedStringClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCAttributedStringClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCAttributedStringClassObject;
+    return NOERROR;
+}
+
+static CAttributedStringClassObject* GetCachedCAttributedStringClassObject()
+{
+    CAttributedStringClassObject* clsObject = sCAttributedStringCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCAttributedStringClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCAttributedStringCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCAttributedStringClassObject == nullptr) {
+            sCAttributedStringClassObject = new CAttributedStringClassObject();
+        }
+        else if (sCAttributedStringClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCAttributedStringClassObject;
+        clsObject->AddRef();
+        sCAttributedStringCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCAttributedStringClassObjectCache()
+{
+    Spinlock& lock = GetCAttributedStringClassObjectLock();
+    lock.Lock();
+    CAttributedStringClassObject* clsObject = sCAttributedStringCachedClassObject.load(std::memory_order_relaxed);
+    sCAttributedStringCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CAttributedString::_CAttributedString()
+{
+    sCAttributedStringClassObject->AddRef();
+}
+
+_CAttributedString::~_CAttributedString()
+{
+    sCAttributedStringClassObject->Release();
+}
+
+ECode _CAttributedString::New(
+    /* [in] */ const String& text,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAttributedStringClassObject* cachedClsObject = GetCachedCAttributedStringClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(text, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CAttributedString, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICAttributedStringClassObject::Probe(clsObject)->CreateObject(text, iid, object);
+};
+
+ECode _CAttributedString::New(
+    /* [in] */ const String& text,
+    /* [in] */ ccm::util::IMap* attributes,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAttributedStringClassObject* cachedClsObject = GetCachedCAttributedStringClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(text, attributes, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CAttributedString, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICAttributedStringClassObject::Probe(clsObject)->CreateObject(text, attributes, iid, object);
+};
+
+ECode _CAttributedString::New(
+    /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAttributedStringClassObject* cachedClsObject = GetCachedCAttributedStringClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(text, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CAttributedString, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICAttributedStringClassObject::Probe(clsObject)->CreateObject(text, iid, object);
+};
+
+ECode _CAttributedString::New(
+    /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+    /* [in] */ Integer beginIndex,
+    /* [in] */ Integer endIndex,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAttributedStringClassObject* cachedClsObject = GetCachedCAttributedStringClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(text, beginIndex, endIndex, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CAttributedString, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICAttributedStringClassObject::Probe(clsObject)->CreateObject(text, beginIndex, endIndex, iid, object);
+};
+
+ECode _CAttributedString::New(
+    /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+    /* [in] */ Integer beginIndex,
+    /* [in] */ Integer endIndex,
+    /* [in] */ const Array<ccm::text::IAttributedCharacterIterator::IAttribute*>& attributes,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAttributedStringClassObject* cachedClsObject = GetCachedCAttributedStringClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(text, beginIndex, endIndex, attributes, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CAttributedString, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICAttributedStringClassObject::Probe(clsObject)->CreateObject(text, beginIndex, endIndex, attributes, iid, object);
+};
+
+} // namespace text
+} // namespace ccm
@@ -0,0 +1,73 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_CATTRIBUTEDSTRING_H_GEN__
+#define __CCM_TEXT_CATTRIBUTEDSTRING_H_GEN__
+
+#include "libcore.h"
+#include "ccm.text.IAttributedCharacterIterator.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const CoclassID CID_CAttributedString;
+
+COCLASS_ID(d90f0463-63bb-43dd-8ae6-69152b0fcbd1)
+class _CAttributedString
+{
+public:
+    _CAttributedString();
+
+    virtual ~_CAttributedString();
+
+    static ECode New(
+        /* [in] */ const String& text,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const String& text,
+        /* [in] */ ccm::util::IMap* attributes,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+        /* [in] */ Integer beginIndex,
+        /* [in] */ Integer endIndex,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::text::IAttributedCharacterIterator* text,
+        /* [in] */ Integer beginIndex,
+        /* [in] */ Integer endIndex,
+        /* [in] */ const Array<ccm::text::IAttributedCharacterIterator::IAttribute*>& attributes,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_CATTRIBUTEDSTRING_H_GEN__
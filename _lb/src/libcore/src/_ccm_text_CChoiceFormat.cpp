@@ -0,0 +1,252 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CChoiceFormat.h"
+#include "ccm.text.ICChoiceFormatClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CChoiceFormatClassObject
+    : public ClassObject
+    , public ICChoiceFormatClassObject
+{
+public:
+    CChoiceFormatClassObject();
+
+    ~CChoiceFormatClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& newPattern,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const Array<Double>& limits,
+        /* [in] */ const Array<String>& formats,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CChoiceFormatClassObject* sCChoiceFormatClassObject = nullptr;
+static std::atomic<CChoiceFormatClassObject*> sCChoiceFormatCachedClassObject(nullptr);
+static Spinlock& GetCChoiceFormatClassObjectLock()
+{
+    static Spinlock sCChoiceFormatClassObjectLock;
+    return sCChoiceFormatClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CChoiceFormatClassObject, ClassObject, ICChoiceFormatClassObject);
+
+CChoiceFormatClassObject::CChoiceFormatClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CChoiceFormatClassObject::~CChoiceFormatClassObject()
+{
+    Spinlock& lock = GetCChoiceFormatClassObjectLock();
+    lock.Lock();
+    sCChoiceFormatClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CChoiceFormatClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CChoiceFormatClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CChoiceFormatClassObject::CreateObject(
+    /* [in] */ const String& newPattern,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CChoiceFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CChoiceFormat* _obj = new(addr) CChoiceFormat();
+    ECode ec = _obj->Constructor(newPattern);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CChoiceFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CChoiceFormatClassObject::CreateObject(
+    /* [in] */ const Array<Double>& limits,
+    /* [in] */ const Array<String>& formats,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CChoiceFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CChoiceFormat* _obj = new(addr) CChoiceFormat();
+    ECode ec = _obj->Constructor(limits, formats);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CChoiceFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCChoiceFormatClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCChoiceFormatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCChoiceFormatClassObject == nullptr) {
+        sCChoiceFormatClassObject = new CChoiceFormatClassObject();
+    }
+    else if (sCChoiceFormatClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCChoiceFormatClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCChoiceFormatClassObject;
+    return NOERROR;
+}
+
+static CChoiceFormatClassObject* GetCachedCChoiceFormatClassObject()
+{
+    CChoiceFormatClassObject* clsObject = sCChoiceFormatCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCChoiceFormatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCChoiceFormatCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCChoiceFormatClassObject == nullptr) {
+            sCChoiceFormatClassObject = new CChoiceFormatClassObject();
+        }
+        else if (sCChoiceFormatClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCChoiceFormatClassObject;
+        clsObject->AddRef();
+        sCChoiceFormatCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCChoiceFormatClassObjectCache()
+{
+    Spinlock& lock = GetCChoiceFormatClassObjectLock();
+    lock.Lock();
+    CChoiceFormatClassObject* clsObject = sCChoiceFormatCachedClassObject.load(std::memory_order_relaxed);
+    sCChoiceFormatCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CChoiceFormat::_CChoiceFormat()
+{
+    sCChoiceFormatClassObject->AddRef();
+}
+
+_CChoiceFormat::~_CChoiceFormat()
+{
+    sCChoiceFormatClassObject->Release();
+}
+
+ECode _CChoiceFormat::New(
+    /* [in] */ const String& newPattern,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CChoiceFormatClassObject* cachedClsObject = GetCachedCChoiceFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(newPattern, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CChoiceFormat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICChoiceFormatClassObject::Probe(clsObject)->CreateObject(newPattern, iid, object);
+};
+
+ECode _CChoiceFormat::New(
+    /* [in] */ const Array<Double>& limits,
+    /* [in] */ const Array<String>& formats,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CChoiceFormatClassObject* cachedClsObject = GetCachedCChoiceFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(limits, formats, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CChoiceFormat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICChoiceFormatClassObject::Probe(clsObject)->CreateObject(limits, formats, iid, object);
+};
+
+} // namespace text
+} // namespace ccm
@@ -0,0 +1,52 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_CCHOICEFORMAT_H_GEN__
+#define __CCM_TEXT_CCHOICEFORMAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const CoclassID CID_CChoiceFormat;
+
+COCLASS_ID(026a67bd-0d05-4263-8612-b5accc480ec5)
+class _CChoiceFormat
+{
+public:
+    _CChoiceFormat();
+
+    virtual ~_CChoiceFormat();
+
+    static ECode New(
+        /* [in] */ const String& newPattern,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const Array<Double>& limits,
+        /* [in] */ const Array<String>& formats,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_CCHOICEFORMAT_H_GEN__
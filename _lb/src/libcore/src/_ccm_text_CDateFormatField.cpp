@@ -0,0 +1,158 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CDateFormatField.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CDateFormatFieldClassObject
+    : public ClassObject
+{
+public:
+    CDateFormatFieldClassObject();
+
+    ~CDateFormatFieldClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CDateFormatFieldClassObject* sCDateFormatFieldClassObject = nullptr;
+static std::atomic<CDateFormatFieldClassObject*> sCDateFormatFieldCachedClassObject(nullptr);
+static Spinlock& GetCDateFormatFieldClassObjectLock()
+{
+    static Spinlock sCDateFormatFieldClassObjectLock;
+    return sCDateFormatFieldClassObjectLock;
+}
+
+CDateFormatFieldClassObject::CDateFormatFieldClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CDateFormatFieldClassObject::~CDateFormatFieldClassObject()
+{
+    Spinlock& lock = GetCDateFormatFieldClassObjectLock();
+    lock.Lock();
+    sCDateFormatFieldClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CDateFormatFieldClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CDateFormatFieldClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    *object = nullptr;
+    return NOERROR;
+}
+
+ECode GetCDateFormatFieldClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCDateFormatFieldClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCDateFormatFieldClassObject == nullptr) {
+        sCDateFormatFieldClassObject = new CDateFormatFieldClassObject();
+    }
+    else if (sCDateFormatFieldClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCDateFormatFieldClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCDateFormatFieldClassObject;
+    return NOERROR;
+}
+
+static CDateFormatFieldClassObject* GetCachedCDateFormatFieldClassObject()
+{
+    CDateFormatFieldClassObject* clsObject = sCDateFormatFieldCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCDateFormatFieldClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCDateFormatFieldCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCDateFormatFieldClassObject == nullptr) {
+            sCDateFormatFieldClassObject = new CDateFormatFieldClassObject();
+        }
+        else if (sCDateFormatFieldClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCDateFormatFieldClassObject;
+        clsObject->AddRef();
+        sCDateFormatFieldCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCDateFormatFieldClassObjectCache()
+{
+    Spinlock& lock = GetCDateFormatFieldClassObjectLock();
+    lock.Lock();
+    CDateFormatFieldClassObject* clsObject = sCDateFormatFieldCachedClassObject.load(std::memory_order_relaxed);
+    sCDateFormatFieldCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CDateFormatField::_CDateFormatField()
+{
+    sCDateFormatFieldClassObject->AddRef();
+}
+
+_CDateFormatField::~_CDateFormatField()
+{
+    sCDateFormatFieldClassObject->Release();
+}
+
+} // namespace text
+} // namespace ccm
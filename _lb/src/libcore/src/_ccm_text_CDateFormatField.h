@@ -0,0 +1,42 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_CDATEFORMATFIELD_H_GEN__
+#define __CCM_TEXT_CDATEFORMATFIELD_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const CoclassID CID_CDateFormatField;
+
+COCLASS_ID(43ac1b62-c9d8-4345-a293-f27cf49427f0)
+class _CDateFormatField
+{
+public:
+    _CDateFormatField();
+
+    virtual ~_CDateFormatField();
+
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_CDATEFORMATFIELD_H_GEN__
@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CDateFormatSymbols.h"
+#include "ccm.text.ICDateFormatSymbolsClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CDateFormatSymbolsClassObject
+    : public ClassObject
+    , public ICDateFormatSymbolsClassObject
+{
+public:
+    CDateFormatSymbolsClassObject();
+
+    ~CDateFormatSymbolsClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CDateFormatSymbolsClassObject* sCDateFormatSymbolsClassObject = nullptr;
+static std::atomic<CDateFormatSymbolsClassObject*> sCDateFormatSymbolsCachedClassObject(nullptr);
+static Spinlock& GetCDateFormatSymbolsClassObjectLock()
+{
+    static Spinlock sCDateFormatSymbolsClassObjectLock;
+    return sCDateFormatSymbolsClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CDateFormatSymbolsClassObject, ClassObject, ICDateFormatSymbolsClassObject);
+
+CDateFormatSymbolsClassObject::CDateFormatSymbolsClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CDateFormatSymbolsClassObject::~CDateFormatSymbolsClassObject()
+{
+    Spinlock& lock = GetCDateFormatSymbolsClassObjectLock();
+    lock.Lock();
+    sCDateFormatSymbolsClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CDateFormatSymbolsClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CDateFormatSymbolsClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDateFormatSymbols), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDateFormatSymbols* _obj = new(addr) CDateFormatSymbols();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CDateFormatSymbols");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CDateFormatSymbolsClassObject::CreateObject(
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDateFormatSymbols), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDateFormatSymbols* _obj = new(addr) CDateFormatSymbols();
+    ECode ec = _obj->Constructor(locale);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CDateFormatSymbols");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCDateFormatSymbolsClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCDateFormatSymbolsClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCDateFormatSymbolsClassObject == nullptr) {
+        sCDateFormatSymbolsClassObject = new CDateFormatSymbolsClassObject();
+    }
+    else if (sCDateFormatSymbolsClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCDateFormatSymbolsClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCDateFormatSymbolsClassObject;
+    return NOERROR;
+}
+
+static CDateFormatSymbolsClassObject* GetCachedCDateFormatSymbolsClassObject()
+{
+    CDateFormatSymbolsClassObject* clsObject = sCDateFormatSymbolsCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCDateFormatSymbolsClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCDateFormatSymbolsCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCDateFormatSymbolsClassObject == nullptr) {
+            sCDateFormatSymbolsClassObject = new CDateFormatSymbolsClassObject();
+        }
+        else if (sCDateFormatSymbolsClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCDateFormatSymbolsClassObject;
+        clsObject->AddRef();
+        sCDateFormatSymbolsCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCDateFormatSymbolsClassObjectCache()
+{
+    Spinlock& lock = GetCDateFormatSymbolsClassObjectLock();
+    lock.Lock();
+    CDateFormatSymbolsClassObject* clsObject = sCDateFormatSymbolsCachedClassObject.load(std::memory_order_relaxed);
+    sCDateFormatSymbolsCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CDateFormatSymbols::_CDateFormatSymbols()
+{
+    sCDateFormatSymbolsClassObject->AddRef();
+}
+
+_CDateFormatSymbols::~_CDateFormatSymbols()
+{
+    sCDateFormatSymbolsClassObject->Release();
+}
+
+ECode _CDateFormatSymbols::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDateFormatSymbolsClassObject* cachedClsObject = GetCachedCDateFormatSymbolsClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CDateFormatSymbols, iid, nullptr, object);
+};
+
+ECode _CDateFormatSymbols::New(
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDateFormatSymbolsClassObject* cachedClsObject = GetCachedCDateFormatSymbolsClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(locale, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDateFormatSymbols, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDateFormatSymbolsClassObject::Probe(clsObject)->CreateObject(locale, iid, object);
+};
+
+} // namespace text
+} // namespace ccm
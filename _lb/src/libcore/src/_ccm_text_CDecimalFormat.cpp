@@ -0,0 +1,276 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CDecimalFormat.h"
+#include "ccm.text.ICDecimalFormatClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CDecimalFormatClassObject
+    : public ClassObject
+    , public ICDecimalFormatClassObject
+{
+public:
+    CDecimalFormatClassObject();
+
+    ~CDecimalFormatClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& pattern,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& pattern,
+        /* [in] */ ccm::text::IDecimalFormatSymbols* symbols,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CDecimalFormatClassObject* sCDecimalFormatClassObject = nullptr;
+static std::atomic<CDecimalFormatClassObject*> sCDecimalFormatCachedClassObject(nullptr);
+static Spinlock& GetCDecimalFormatClassObjectLock()
+{
+    static Spinlock sCDecimalFormatClassObjectLock;
+    return sCDecimalFormatClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CDecimalFormatClassObject, ClassObject, ICDecimalFormatClassObject);
+
+CDecimalFormatClassObject::CDecimalFormatClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CDecimalFormatClassObject::~CDecimalFormatClassObject()
+{
+    Spinlock& lock = GetCDecimalFormatClassObjectLock();
+    lock.Lock();
+    sCDecimalFormatClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CDecimalFormatClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CDecimalFormatClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDecimalFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDecimalFormat* _obj = new(addr) CDecimalFormat();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CDecimalFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CDecimalFormatClassObject::CreateObject(
+    /* [in] */ const String& pattern,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDecimalFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDecimalFormat* _obj = new(addr) CDecimalFormat();
+    ECode ec = _obj->Constructor(pattern);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CDecimalFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CDecimalFormatClassObject::CreateObject(
+    /* [in] */ const String& pattern,
+    /* [in] */ ccm::text::IDecimalFormatSymbols* symbols,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDecimalFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDecimalFormat* _obj = new(addr) CDecimalFormat();
+    ECode ec = _obj->Constructor(pattern, symbols);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CDecimalFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCDecimalFormatClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCDecimalFormatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCDecimalFormatClassObject == nullptr) {
+        sCDecimalFormatClassObject = new CDecimalFormatClassObject();
+    }
+    else if (sCDecimalFormatClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCDecimalFormatClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCDecimalFormatClassObject;
+    return NOERROR;
+}
+
+static CDecimalFormatClassObject* GetCachedCDecimalFormatClassObject()
+{
+    CDecimalFormatClassObject* clsObject = sCDecimalFormatCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCDecimalFormatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCDecimalFormatCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCDecimalFormatClassObject == nullptr) {
+            sCDecimalFormatClassObject = new CDecimalFormatClassObject();
+        }
+        else if (sCDecimalFormatClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCDecimalFormatClassObject;
+        clsObject->AddRef();
+        sCDecimalFormatCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCDecimalFormatClassObjectCache()
+{
+    Spinlock& lock = GetCDecimalFormatClassObjectLock();
+    lock.Lock();
+    CDecimalFormatClassObject* clsObject = sCDecimalFormatCachedClassObject.load(std::memory_order_relaxed);
+    sCDecimalFormatCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CDecimalFormat::_CDecimalFormat()
+{
+    sCDecimalFormatClassObject->AddRef();
+}
+
+_CDecimalFormat::~_CDecimalFormat()
+{
+    sCDecimalFormatClassObject->Release();
+}
+
+ECode _CDecimalFormat::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDecimalFormatClassObject* cachedClsObject = GetCachedCDecimalFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CDecimalFormat, iid, nullptr, object);
+};
+
+ECode _CDecimalFormat::New(
+    /* [in] */ const String& pattern,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDecimalFormatClassObject* cachedClsObject = GetCachedCDecimalFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(pattern, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDecimalFormat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDecimalFormatClassObject::Probe(clsObject)->CreateObject(pattern, iid, object);
+};
+
+ECode _CDecimalFormat::New(
+    /* [in] */ const String& pattern,
+    /* [in] */ ccm::text::IDecimalFormatSymbols* symbols,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDecimalFormatClassObject* cachedClsObject = GetCachedCDecimalFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(pattern, symbols, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDecimalFormat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDecimalFormatClassObject::Probe(clsObject)->CreateObject(pattern, symbols, iid, object);
+};
+
+} // namespace text
+} // namespace ccm
@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CDecimalFormatSymbols.h"
+#include "ccm.text.ICDecimalFormatSymbolsClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CDecimalFormatSymbolsClassObject
+    : public ClassObject
+    , public ICDecimalFormatSymbolsClassObject
+{
+public:
+    CDecimalFormatSymbolsClassObject();
+
+    ~CDecimalFormatSymbolsClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CDecimalFormatSymbolsClassObject* sCDecimalFormatSymbolsClassObject = nullptr;
+static std::atomic<CDecimalFormatSymbolsClassObject*> sCDecimalFormatSymbolsCachedClassObject(nullptr);
+static Spinlock& GetCDecimalFormatSymbolsClassObjectLock()
+{
+    static Spinlock sCDecimalFormatSymbolsClassObjectLock;
+    return sCDecimalFormatSymbolsClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CDecimalFormatSymbolsClassObject, ClassObject, ICDecimalFormatSymbolsClassObject);
+
+CDecimalFormatSymbolsClassObject::CDecimalFormatSymbolsClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CDecimalFormatSymbolsClassObject::~CDecimalFormatSymbolsClassObject()
+{
+    Spinlock& lock = GetCDecimalFormatSymbolsClassObjectLock();
+    lock.Lock();
+    sCDecimalFormatSymbolsClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CDecimalFormatSymbolsClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CDecimalFormatSymbolsClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDecimalFormatSymbols), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDecimalFormatSymbols* _obj = new(addr) CDecimalFormatSymbols();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CDecimalFormatSymbols");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CDecimalFormatSymbolsClassObject::CreateObject(
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDecimalFormatSymbols), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDecimalFormatSymbols* _obj = new(addr) CDecimalFormatSymbols();
+    ECode ec = _obj->Constructor(locale);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CDecimalFormatSymbols");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCDecimalFormatSymbolsClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCDecimalFormatSymbolsClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCDecimalFormatSymbolsClassObject == nullptr) {
+        sCDecimalFormatSymbolsClassObject = new CDecimalFormatSymbolsClassObject();
+    }
+    else if (sCDecimalFormatSymbolsClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCDecimalFormatSymbolsClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCDecimalFormatSymbolsClassObject;
+    return NOERROR;
+}
+
+static CDecimalFormatSymbolsClassObject* GetCachedCDecimalFormatSymbolsClassObject()
+{
+    CDecimalFormatSymbolsClassObject* clsObject = sCDecimalFormatSymbolsCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCDecimalFormatSymbolsClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCDecimalFormatSymbolsCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCDecimalFormatSymbolsClassObject == nullptr) {
+            sCDecimalFormatSymbolsClassObject = new CDecimalFormatSymbolsClassObject();
+        }
+        else if (sCDecimalFormatSymbolsClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCDecimalFormatSymbolsClassObject;
+        clsObject->AddRef();
+        sCDecimalFormatSymbolsCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCDecimalFormatSymbolsClassObjectCache()
+{
+    Spinlock& lock = GetCDecimalFormatSymbolsClassObjectLock();
+    lock.Lock();
+    CDecimalFormatSymbolsClassObject* clsObject = sCDecimalFormatSymbolsCachedClassObject.load(std::memory_order_relaxed);
+    sCDecimalFormatSymbolsCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CDecimalFormatSymbols::_CDecimalFormatSymbols()
+{
+    sCDecimalFormatSymbolsClassObject->AddRef();
+}
+
+_CDecimalFormatSymbols::~_CDecimalFormatSymbols()
+{
+    sCDecimalFormatSymbolsClassObject->Release();
+}
+
+ECode _CDecimalFormatSymbols::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDecimalFormatSymbolsClassObject* cachedClsObject = GetCachedCDecimalFormatSymbolsClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CDecimalFormatSymbols, iid, nullptr, object);
+};
+
+ECode _CDecimalFormatSymbols::New(
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDecimalFormatSymbolsClassObject* cachedClsObject = GetCachedCDecimalFormatSymbolsClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(locale, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDecimalFormatSymbols, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDecimalFormatSymbolsClassObject::Probe(clsObject)->CreateObject(locale, iid, object);
+};
+
+} // namespace text
+} // namespace ccm
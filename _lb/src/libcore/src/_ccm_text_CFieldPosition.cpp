@@ -0,0 +1,295 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CFieldPosition.h"
+#include "ccm.text.ICFieldPositionClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CFieldPositionClassObject
+    : public ClassObject
+    , public ICFieldPositionClassObject
+{
+public:
+    CFieldPositionClassObject();
+
+    ~CFieldPositionClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Integer field,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::text::IFormatField* attribute,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::text::IFormatField* attribute,
+        /* [in] */ Integer field,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CFieldPositionClassObject* sCFieldPositionClassObject = nullptr;
+static std::atomic<CFieldPositionClassObject*> sCFieldPositionCachedClassObject(nullptr);
+static Spinlock& GetCFieldPositionClassObjectLock()
+{
+    static Spinlock sCFieldPositionClassObjectLock;
+    return sCFieldPositionClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CFieldPositionClassObject, ClassObject, ICFieldPositionClassObject);
+
+CFieldPositionClassObject::CFieldPositionClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CFieldPositionClassObject::~CFieldPositionClassObject()
+{
+    Spinlock& lock = GetCFieldPositionClassObjectLock();
+    lock.Lock();
+    sCFieldPositionClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CFieldPositionClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CFieldPositionClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CFieldPositionClassObject::CreateObject(
+    /* [in] */ Integer field,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFieldPosition), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFieldPosition* _obj = new(addr) CFieldPosition();
+    ECode ec = _obj->Constructor(field);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CFieldPosition");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFieldPositionClassObject::CreateObject(
+    /* [in] */ ccm::text::IFormatField* attribute,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFieldPosition), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFieldPosition* _obj = new(addr) CFieldPosition();
+    ECode ec = _obj->Constructor(attribute);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CFieldPosition");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFieldPositionClassObject::CreateObject(
+    /* [in] */ ccm::text::IFormatField* attribute,
+    /* [in] */ Integer field,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFieldPosition), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFieldPosition* _obj = new(addr) CFieldPosition();
+    ECode ec = _obj->Constructor(attribute, field);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CFieldPosition");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCFieldPositionClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCFieldPositionClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCFieldPositionClassObject == nullptr) {
+        sCFieldPositionClassObject = new CFieldPositionClassObject();
+    }
+    else if (sCFieldPositionClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCFieldPositionClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCFieldPositionClassObject;
+    return NOERROR;
+}
+
+static CFieldPositionClassObject* GetCachedCFieldPositionClassObject()
+{
+    CFieldPositionClassObject* clsObject = sCFieldPositionCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCFieldPositionClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCFieldPositionCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCFieldPositionClassObject == nullptr) {
+            sCFieldPositionClassObject = new CFieldPositionClassObject();
+        }
+        else if (sCFieldPositionClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCFieldPositionClassObject;
+        clsObject->AddRef();
+        sCFieldPositionCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCFieldPositionClassObjectCache()
+{
+    Spinlock& lock = GetCFieldPositionClassObjectLock();
+    lock.Lock();
+    CFieldPositionClassObject* clsObject = sCFieldPositionCachedClassObject.load(std::memory_order_relaxed);
+    sCFieldPositionCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CFieldPosition::_CFieldPosition()
+{
+    sCFieldPositionClassObject->AddRef();
+}
+
+_CFieldPosition::~_CFieldPosition()
+{
+    sCFieldPositionClassObject->Release();
+}
+
+ECode _CFieldPosition::New(
+    /* [in] */ Integer field,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFieldPositionClassObject* cachedClsObject = GetCachedCFieldPositionClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(field, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFieldPosition, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFieldPositionClassObject::Probe(clsObject)->CreateObject(field, iid, object);
+};
+
+ECode _CFieldPosition::New(
+    /* [in] */ ccm::text::IFormatField* attribute,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFieldPositionClassObject* cachedClsObject = GetCachedCFieldPositionClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(attribute, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFieldPosition, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFieldPositionClassObject::Probe(clsObject)->CreateObject(attribute, iid, object);
+};
+
+ECode _CFieldPosition::New(
+    /* [in] */ ccm::text::IFormatField* attribute,
+    /* [in] */ Integer field,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFieldPositionClassObject* cachedClsObject = GetCachedCFieldPositionClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(attribute, field, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFieldPosition, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFieldPositionClassObject::Probe(clsObject)->CreateObject(attribute, field, iid, object);
+};
+
+} // namespace text
+} // namespace ccm
@@ -0,0 +1,252 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CMessageFormat.h"
+#include "ccm.text.ICMessageFormatClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CMessageFormatClassObject
+    : public ClassObject
+    , public ICMessageFormatClassObject
+{
+public:
+    CMessageFormatClassObject();
+
+    ~CMessageFormatClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& pattern,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& pattern,
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CMessageFormatClassObject* sCMessageFormatClassObject = nullptr;
+static std::atomic<CMessageFormatClassObject*> sCMessageFormatCachedClassObject(nullptr);
+static Spinlock& GetCMessageFormatClassObjectLock()
+{
+    static Spinlock sCMessageFormatClassObjectLock;
+    return sCMessageFormatClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CMessageFormatClassObject, ClassObject, ICMessageFormatClassObject);
+
+CMessageFormatClassObject::CMessageFormatClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CMessageFormatClassObject::~CMessageFormatClassObject()
+{
+    Spinlock& lock = GetCMessageFormatClassObjectLock();
+    lock.Lock();
+    sCMessageFormatClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CMessageFormatClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CMessageFormatClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CMessageFormatClassObject::CreateObject(
+    /* [in] */ const String& pattern,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CMessageFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CMessageFormat* _obj = new(addr) CMessageFormat();
+    ECode ec = _obj->Constructor(pattern);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CMessageFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CMessageFormatClassObject::CreateObject(
+    /* [in] */ const String& pattern,
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CMessageFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CMessageFormat* _obj = new(addr) CMessageFormat();
+    ECode ec = _obj->Constructor(pattern, locale);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CMessageFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCMessageFormatClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCMessageFormatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCMessageFormatClassObject == nullptr) {
+        sCMessageFormatClassObject = new CMessageFormatClassObject();
+    }
+    else if (sCMessageFormatClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCMessageFormatClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCMessageFormatClassObject;
+    return NOERROR;
+}
+
+static CMessageFormatClassObject* GetCachedCMessageFormatClassObject()
+{
+    CMessageFormatClassObject* clsObject = sCMessageFormatCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCMessageFormatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCMessageFormatCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCMessageFormatClassObject == nullptr) {
+            sCMessageFormatClassObject = new CMessageFormatClassObject();
+        }
+        else if (sCMessageFormatClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCMessageFormatClassObject;
+        clsObject->AddRef();
+        sCMessageFormatCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCMessageFormatClassObjectCache()
+{
+    Spinlock& lock = GetCMessageFormatClassObjectLock();
+    lock.Lock();
+    CMessageFormatClassObject* clsObject = sCMessageFormatCachedClassObject.load(std::memory_order_relaxed);
+    sCMessageFormatCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CMessageFormat::_CMessageFormat()
+{
+    sCMessageFormatClassObject->AddRef();
+}
+
+_CMessageFormat::~_CMessageFormat()
+{
+    sCMessageFormatClassObject->Release();
+}
+
+ECode _CMessageFormat::New(
+    /* [in] */ const String& pattern,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CMessageFormatClassObject* cachedClsObject = GetCachedCMessageFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(pattern, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CMessageFormat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICMessageFormatClassObject::Probe(clsObject)->CreateObject(pattern, iid, object);
+};
+
+ECode _CMessageFormat::New(
+    /* [in] */ const String& pattern,
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CMessageFormatClassObject* cachedClsObject = GetCachedCMessageFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(pattern, locale, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CMessageFormat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICMessageFormatClassObject::Probe(clsObject)->CreateObject(pattern, locale, iid, object);
+};
+
+} // namespace text
+} // namespace ccm
@@ -0,0 +1,206 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CParsePosition.h"
+#include "ccm.text.ICParsePositionClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CParsePositionClassObject
+    : public ClassObject
+    , public ICParsePositionClassObject
+{
+public:
+    CParsePositionClassObject();
+
+    ~CParsePositionClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Integer index,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CParsePositionClassObject* sCParsePositionClassObject = nullptr;
+static std::atomic<CParsePositionClassObject*> sCParsePositionCachedClassObject(nullptr);
+static Spinlock& GetCParsePositionClassObjectLock()
+{
+    static Spinlock sCParsePositionClassObjectLock;
+    return sCParsePositionClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CParsePositionClassObject, ClassObject, ICParsePositionClassObject);
+
+CParsePositionClassObject::CParsePositionClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CParsePositionClassObject::~CParsePositionClassObject()
+{
+    Spinlock& lock = GetCParsePositionClassObjectLock();
+    lock.Lock();
+    sCParsePositionClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CParsePositionClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CParsePositionClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CParsePositionClassObject::CreateObject(
+    /* [in] */ Integer index,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CParsePosition), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CParsePosition* _obj = new(addr) CParsePosition();
+    ECode ec = _obj->Constructor(index);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CParsePosition");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCParsePositionClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCParsePositionClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCParsePositionClassObject == nullptr) {
+        sCParsePositionClassObject = new CParsePositionClassObject();
+    }
+    else if (sCParsePositionClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCParsePositionClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCParsePositionClassObject;
+    return NOERROR;
+}
+
+static CParsePositionClassObject* GetCachedCParsePositionClassObject()
+{
+    CParsePositionClassObject* clsObject = sCParsePositionCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCParsePositionClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCParsePositionCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCParsePositionClassObject == nullptr) {
+            sCParsePositionClassObject = new CParsePositionClassObject();
+        }
+        else if (sCParsePositionClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCParsePositionClassObject;
+        clsObject->AddRef();
+        sCParsePositionCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCParsePositionClassObjectCache()
+{
+    Spinlock& lock = GetCParsePositionClassObjectLock();
+    lock.Lock();
+    CParsePositionClassObject* clsObject = sCParsePositionCachedClassObject.load(std::memory_order_relaxed);
+    sCParsePositionCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CParsePosition::_CParsePosition()
+{
+    sCParsePositionClassObject->AddRef();
+}
+
+_CParsePosition::~_CParsePosition()
+{
+    sCParsePositionClassObject->Release();
+}
+
+ECode _CParsePosition::New(
+    /* [in] */ Integer index,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CParsePositionClassObject* cachedClsObject = GetCachedCParsePositionClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(index, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CParsePosition, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICParsePositionClassObject::Probe(clsObject)->CreateObject(index, iid, object);
+};
+
+} // namespace text
+} // namespace ccm
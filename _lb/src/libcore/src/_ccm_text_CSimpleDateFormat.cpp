@@ -0,0 +1,322 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CSimpleDateFormat.h"
+#include "ccm.text.ICSimpleDateFormatClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+class CSimpleDateFormatClassObject
+    : public ClassObject
+    , public ICSimpleDateFormatClassObject
+{
+public:
+    CSimpleDateFormatClassObject();
+
+    ~CSimpleDateFormatClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& pattern,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& pattern,
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& pattern,
+        /* [in] */ ccm::text::IDateFormatSymbols* formatSymbols,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CSimpleDateFormatClassObject* sCSimpleDateFormatClassObject = nullptr;
+static std::atomic<CSimpleDateFormatClassObject*> sCSimpleDateFormatCachedClassObject(nullptr);
+static Spinlock& GetCSimpleDateFormatClassObjectLock()
+{
+    static Spinlock sCSimpleDateFormatClassObjectLock;
+    return sCSimpleDateFormatClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CSimpleDateFormatClassObject, ClassObject, ICSimpleDateFormatClassObject);
+
+CSimpleDateFormatClassObject::CSimpleDateFormatClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CSimpleDateFormatClassObject::~CSimpleDateFormatClassObject()
+{
+    Spinlock& lock = GetCSimpleDateFormatClassObjectLock();
+    lock.Lock();
+    sCSimpleDateFormatClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CSimpleDateFormatClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CSimpleDateFormatClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleDateFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleDateFormat* _obj = new(addr) CSimpleDateFormat();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CSimpleDateFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CSimpleDateFormatClassObject::CreateObject(
+    /* [in] */ const String& pattern,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleDateFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleDateFormat* _obj = new(addr) CSimpleDateFormat();
+    ECode ec = _obj->Constructor(pattern);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CSimpleDateFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CSimpleDateFormatClassObject::CreateObject(
+    /* [in] */ const String& pattern,
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleDateFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleDateFormat* _obj = new(addr) CSimpleDateFormat();
+    ECode ec = _obj->Constructor(pattern, locale);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CSimpleDateFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CSimpleDateFormatClassObject::CreateObject(
+    /* [in] */ const String& pattern,
+    /* [in] */ ccm::text::IDateFormatSymbols* formatSymbols,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleDateFormat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleDateFormat* _obj = new(addr) CSimpleDateFormat();
+    ECode ec = _obj->Constructor(pattern, formatSymbols);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::text::CSimpleDateFormat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCSimpleDateFormatClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCSimpleDateFormatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCSimpleDateFormatClassObject == nullptr) {
+        sCSimpleDateFormatClassObject = new CSimpleDateFormatClassObject();
+    }
+    else if (sCSimpleDateFormatClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCSimpleDateFormatClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCSimpleDateFormatClassObject;
+    return NOERROR;
+}
+
+static CSimpleDateFormatClassObject* GetCachedCSimpleDateFormatClassObject()
+{
+    CSimpleDateFormatClassObject* clsObject = sCSimpleDateFormatCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCSimpleDateFormatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCSimpleDateFormatCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCSimpleDateFormatClassObject == nullptr) {
+            sCSimpleDateFormatClassObject = new CSimpleDateFormatClassObject();
+        }
+        else if (sCSimpleDateFormatClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCSimpleDateFormatClassObject;
+        clsObject->AddRef();
+        sCSimpleDateFormatCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCSimpleDateFormatClassObjectCache()
+{
+    Spinlock& lock = GetCSimpleDateFormatClassObjectLock();
+    lock.Lock();
+    CSimpleDateFormatClassObject* clsObject = sCSimpleDateFormatCachedClassObject.load(std::memory_order_relaxed);
+    sCSimpleDateFormatCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CSimpleDateFormat::_CSimpleDateFormat()
+{
+    sCSimpleDateFormatClassObject->AddRef();
+}
+
+_CSimpleDateFormat::~_CSimpleDateFormat()
+{
+    sCSimpleDateFormatClassObject->Release();
+}
+
+ECode _CSimpleDateFormat::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleDateFormatClassObject* cachedClsObject = GetCachedCSimpleDateFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CSimpleDateFormat, iid, nullptr, object);
+};
+
+ECode _CSimpleDateFormat::New(
+    /* [in] */ const String& pattern,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleDateFormatClassObject* cachedClsObject = GetCachedCSimpleDateFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(pattern, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleDateFormat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleDateFormatClassObject::Probe(clsObject)->CreateObject(pattern, iid, object);
+};
+
+ECode _CSimpleDateFormat::New(
+    /* [in] */ const String& pattern,
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleDateFormatClassObject* cachedClsObject = GetCachedCSimpleDateFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(pattern, locale, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleDateFormat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleDateFormatClassObject::Probe(clsObject)->CreateObject(pattern, locale, iid, object);
+};
+
+ECode _CSimpleDateFormat::New(
+    /* [in] */ const String& pattern,
+    /* [in] */ ccm::text::IDateFormatSymbols* formatSymbols,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleDateFormatClassObject* cachedClsObject = GetCachedCSimpleDateFormatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(pattern, formatSymbols, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleDateFormat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleDateFormatClassObject::Probe(clsObject)->CreateObject(pattern, formatSymbols, iid, object);
+};
+
+} // namespace text
+} // namespace ccm
@@ -0,0 +1,273 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CArrayList.h"
+#include "ccm.util.ICArrayListClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CArrayListClassObject
+    : public ClassObject
+    , public ICArrayListClassObject
+{
+public:
+    CArrayListClassObject();
+
+    ~CArrayListClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CArrayListClassObject* sCArrayListClassObject = nullptr;
+static std::atomic<CArrayListClassObject*> sCArrayListCachedClassObject(nullptr);
+static Spinlock& GetCArrayListClassObjectLock()
+{
+    static Spinlock sCArrayListClassObjectLock;
+    return sCArrayListClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CArrayListClassObject, ClassObject, ICArrayListClassObject);
+
+CArrayListClassObject::CArrayListClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CArrayListClassObject::~CArrayListClassObject()
+{
+    Spinlock& lock = GetCArrayListClassObjectLock();
+    lock.Lock();
+    sCArrayListClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CArrayListClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CArrayListClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CArrayList), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CArrayList* _obj = new(addr) CArrayList();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CArrayList");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CArrayListClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CArrayList), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CArrayList* _obj = new(addr) CArrayList();
+    ECode ec = _obj->Constructor(initialCapacity);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CArrayList");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CArrayListClassObject::CreateObject(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CArrayList), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CArrayList* _obj = new(addr) CArrayList();
+    ECode ec = _obj->Constructor(c);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CArrayList");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCArrayListClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCArrayListClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCArrayListClassObject == nullptr) {
+        sCArrayListClassObject = new CArrayListClassObject();
+    }
+    else if (sCArrayListClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCArrayListClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCArrayListClassObject;
+    return NOERROR;
+}
+
+static CArrayListClassObject* GetCachedCArrayListClassObject()
+{
+    CArrayListClassObject* clsObject = sCArrayListCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCArrayListClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCArrayListCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCArrayListClassObject == nullptr) {
+            sCArrayListClassObject = new CArrayListClassObject();
+        }
+        else if (sCArrayListClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCArrayListClassObject;
+        clsObject->AddRef();
+        sCArrayListCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCArrayListClassObjectCache()
+{
+    Spinlock& lock = GetCArrayListClassObjectLock();
+    lock.Lock();
+    CArrayListClassObject* clsObject = sCArrayListCachedClassObject.load(std::memory_order_relaxed);
+    sCArrayListCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CArrayList::_CArrayList()
+{
+    sCArrayListClassObject->AddRef();
+}
+
+_CArrayList::~_CArrayList()
+{
+    sCArrayListClassObject->Release();
+}
+
+ECode _CArrayList::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CArrayListClassObject* cachedClsObject = GetCachedCArrayListClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CArrayList, iid, nullptr, object);
+};
+
+ECode _CArrayList::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CArrayListClassObject* cachedClsObject = GetCachedCArrayListClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CArrayList, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICArrayListClassObject::Probe(clsObject)->CreateObject(initialCapacity, iid, object);
+};
+
+ECode _CArrayList::New(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CArrayListClassObject* cachedClsObject = GetCachedCArrayListClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(c, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CArrayList, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICArrayListClassObject::Probe(clsObject)->CreateObject(c, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,435 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CDate.h"
+#include "ccm.util.ICDateClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CDateClassObject
+    : public ClassObject
+    , public ICDateClassObject
+{
+public:
+    CDateClassObject();
+
+    ~CDateClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Long date,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer date,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer date,
+        /* [in] */ Integer hrs,
+        /* [in] */ Integer min,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer date,
+        /* [in] */ Integer hrs,
+        /* [in] */ Integer min,
+        /* [in] */ Integer sec,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& s,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CDateClassObject* sCDateClassObject = nullptr;
+static std::atomic<CDateClassObject*> sCDateCachedClassObject(nullptr);
+static Spinlock& GetCDateClassObjectLock()
+{
+    static Spinlock sCDateClassObjectLock;
+    return sCDateClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CDateClassObject, ClassObject, ICDateClassObject);
+
+CDateClassObject::CDateClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CDateClassObject::~CDateClassObject()
+{
+    Spinlock& lock = GetCDateClassObjectLock();
+    lock.Lock();
+    sCDateClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CDateClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CDateClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDate), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDate* _obj = new(addr) CDate();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CDate");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CDateClassObject::CreateObject(
+    /* [in] */ Long date,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDate), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDate* _obj = new(addr) CDate();
+    ECode ec = _obj->Constructor(date);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CDate");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CDateClassObject::CreateObject(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer date,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDate), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDate* _obj = new(addr) CDate();
+    ECode ec = _obj->Constructor(year, month, date);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CDate");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CDateClassObject::CreateObject(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer date,
+    /* [in] */ Integer hrs,
+    /* [in] */ Integer min,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDate), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDate* _obj = new(addr) CDate();
+    ECode ec = _obj->Constructor(year, month, date, hrs, min);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CDate");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CDateClassObject::CreateObject(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer date,
+    /* [in] */ Integer hrs,
+    /* [in] */ Integer min,
+    /* [in] */ Integer sec,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDate), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDate* _obj = new(addr) CDate();
+    ECode ec = _obj->Constructor(year, month, date, hrs, min, sec);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CDate");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CDateClassObject::CreateObject(
+    /* [in] */ const String& s,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CDate), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CDate* _obj = new(addr) CDate();
+    ECode ec = _obj->Constructor(s);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CDate");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCDateClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCDateClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCDateClassObject == nullptr) {
+        sCDateClassObject = new CDateClassObject();
+    }
+    else if (sCDateClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCDateClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCDateClassObject;
+    return NOERROR;
+}
+
+static CDateClassObject* GetCachedCDateClassObject()
+{
+    CDateClassObject* clsObject = sCDateCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCDateClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCDateCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCDateClassObject == nullptr) {
+            sCDateClassObject = new CDateClassObject();
+        }
+        else if (sCDateClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCDateClassObject;
+        clsObject->AddRef();
+        sCDateCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCDateClassObjectCache()
+{
+    Spinlock& lock = GetCDateClassObjectLock();
+    lock.Lock();
+    CDateClassObject* clsObject = sCDateCachedClassObject.load(std::memory_order_relaxed);
+    sCDateCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CDate::_CDate()
+{
+    sCDateClassObject->AddRef();
+}
+
+_CDate::~_CDate()
+{
+    sCDateClassObject->Release();
+}
+
+ECode _CDate::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDateClassObject* cachedClsObject = GetCachedCDateClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CDate, iid, nullptr, object);
+};
+
+ECode _CDate::New(
+    /* [in] */ Long date,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDateClassObject* cachedClsObject = GetCachedCDateClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(date, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDate, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDateClassObject::Probe(clsObject)->CreateObject(date, iid, object);
+};
+
+ECode _CDate::New(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer date,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDateClassObject* cachedClsObject = GetCachedCDateClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(year, month, date, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDate, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDateClassObject::Probe(clsObject)->CreateObject(year, month, date, iid, object);
+};
+
+ECode _CDate::New(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer date,
+    /* [in] */ Integer hrs,
+    /* [in] */ Integer min,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDateClassObject* cachedClsObject = GetCachedCDateClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(year, month, date, hrs, min, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDate, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDateClassObject::Probe(clsObject)->CreateObject(year, month, date, hrs, min, iid, object);
+};
+
+ECode _CDate::New(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer date,
+    /* [in] */ Integer hrs,
+    /* [in] */ Integer min,
+    /* [in] */ Integer sec,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDateClassObject* cachedClsObject = GetCachedCDateClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(year, month, date, hrs, min, sec, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDate, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDateClassObject::Probe(clsObject)->CreateObject(year, month, date, hrs, min, sec, iid, object);
+};
+
+ECode _CDate::New(
+    /* [in] */ const String& s,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CDateClassObject* cachedClsObject = GetCachedCDateClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(s, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CDate, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICDateClassObject::Probe(clsObject)->CreateObject(s, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
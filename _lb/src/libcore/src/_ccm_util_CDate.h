@@ -0,0 +1,81 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CDATE_H_GEN__
+#define __CCM_UTIL_CDATE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const CoclassID CID_CDate;
+
+COCLASS_ID(57b9bd7b-d0d5-42c5-9784-202614517a4f)
+class _CDate
+{
+public:
+    _CDate();
+
+    virtual ~_CDate();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Long date,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer date,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer date,
+        /* [in] */ Integer hrs,
+        /* [in] */ Integer min,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer date,
+        /* [in] */ Integer hrs,
+        /* [in] */ Integer min,
+        /* [in] */ Integer sec,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const String& s,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CDATE_H_GEN__
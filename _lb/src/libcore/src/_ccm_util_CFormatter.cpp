@@ -0,0 +1,776 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CFormatter.h"
+#include "ccm.util.ICFormatterClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CFormatterClassObject
+    : public ClassObject
+    , public ICFormatterClassObject
+{
+public:
+    CFormatterClassObject();
+
+    ~CFormatterClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::core::IAppendable* a,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ILocale* l,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::core::IAppendable* a,
+        /* [in] */ ccm::util::ILocale* l,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& fileName,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& fileName,
+        /* [in] */ const String& csn,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& fileName,
+        /* [in] */ const String& csn,
+        /* [in] */ ccm::util::ILocale* l,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFile* file,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFile* file,
+        /* [in] */ const String& csn,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IFile* file,
+        /* [in] */ const String& csn,
+        /* [in] */ ccm::util::ILocale* l,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IPrintStream* ps,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IOutputStream* os,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IOutputStream* os,
+        /* [in] */ const String& csn,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::io::IOutputStream* os,
+        /* [in] */ const String& csn,
+        /* [in] */ ccm::util::ILocale* l,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CFormatterClassObject* sCFormatterClassObject = nullptr;
+static std::atomic<CFormatterClassObject*> sCFormatterCachedClassObject(nullptr);
+static Spinlock& GetCFormatterClassObjectLock()
+{
+    static Spinlock sCFormatterClassObjectLock;
+    return sCFormatterClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CFormatterClassObject, ClassObject, ICFormatterClassObject);
+
+CFormatterClassObject::CFormatterClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CFormatterClassObject::~CFormatterClassObject()
+{
+    Spinlock& lock = GetCFormatterClassObjectLock();
+    lock.Lock();
+    sCFormatterClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CFormatterClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ ccm::core::IAppendable* a,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(a);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ ccm::util::ILocale* l,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(l);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ ccm::core::IAppendable* a,
+    /* [in] */ ccm::util::ILocale* l,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(a, l);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ const String& fileName,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(fileName);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ const String& fileName,
+    /* [in] */ const String& csn,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(fileName, csn);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ const String& fileName,
+    /* [in] */ const String& csn,
+    /* [in] */ ccm::util::ILocale* l,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(fileName, csn, l);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(file);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const String& csn,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(file, csn);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const String& csn,
+    /* [in] */ ccm::util::ILocale* l,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(file, csn, l);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ ccm::io::IPrintStream* ps,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(ps);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ ccm::io::IOutputStream* os,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(os);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ ccm::io::IOutputStream* os,
+    /* [in] */ const String& csn,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(os, csn);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFormatterClassObject::CreateObject(
+    /* [in] */ ccm::io::IOutputStream* os,
+    /* [in] */ const String& csn,
+    /* [in] */ ccm::util::ILocale* l,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFormatter), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFormatter* _obj = new(addr) CFormatter();
+    ECode ec = _obj->Constructor(os, csn, l);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CFormatter");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCFormatterClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCFormatterClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCFormatterClassObject == nullptr) {
+        sCFormatterClassObject = new CFormatterClassObject();
+    }
+    else if (sCFormatterClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCFormatterClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCFormatterClassObject;
+    return NOERROR;
+}
+
+static CFormatterClassObject* GetCachedCFormatterClassObject()
+{
+    CFormatterClassObject* clsObject = sCFormatterCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCFormatterClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCFormatterCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCFormatterClassObject == nullptr) {
+            sCFormatterClassObject = new CFormatterClassObject();
+        }
+        else if (sCFormatterClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCFormatterClassObject;
+        clsObject->AddRef();
+        sCFormatterCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCFormatterClassObjectCache()
+{
+    Spinlock& lock = GetCFormatterClassObjectLock();
+    lock.Lock();
+    CFormatterClassObject* clsObject = sCFormatterCachedClassObject.load(std::memory_order_relaxed);
+    sCFormatterCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CFormatter::_CFormatter()
+{
+    sCFormatterClassObject->AddRef();
+}
+
+_CFormatter::~_CFormatter()
+{
+    sCFormatterClassObject->Release();
+}
+
+ECode _CFormatter::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CFormatter, iid, nullptr, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ ccm::core::IAppendable* a,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(a, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(a, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ ccm::util::ILocale* l,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(l, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(l, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ ccm::core::IAppendable* a,
+    /* [in] */ ccm::util::ILocale* l,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(a, l, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(a, l, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ const String& fileName,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(fileName, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(fileName, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ const String& fileName,
+    /* [in] */ const String& csn,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(fileName, csn, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(fileName, csn, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ const String& fileName,
+    /* [in] */ const String& csn,
+    /* [in] */ ccm::util::ILocale* l,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(fileName, csn, l, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(fileName, csn, l, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(file, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(file, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const String& csn,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(file, csn, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(file, csn, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ ccm::io::IFile* file,
+    /* [in] */ const String& csn,
+    /* [in] */ ccm::util::ILocale* l,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(file, csn, l, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(file, csn, l, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ ccm::io::IPrintStream* ps,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(ps, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(ps, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ ccm::io::IOutputStream* os,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(os, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(os, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ ccm::io::IOutputStream* os,
+    /* [in] */ const String& csn,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(os, csn, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(os, csn, iid, object);
+};
+
+ECode _CFormatter::New(
+    /* [in] */ ccm::io::IOutputStream* os,
+    /* [in] */ const String& csn,
+    /* [in] */ ccm::util::ILocale* l,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFormatterClassObject* cachedClsObject = GetCachedCFormatterClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(os, csn, l, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFormatter, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFormatterClassObject::Probe(clsObject)->CreateObject(os, csn, l, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
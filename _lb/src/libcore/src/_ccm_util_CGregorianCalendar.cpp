@@ -0,0 +1,481 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CGregorianCalendar.h"
+#include "ccm.util.ICGregorianCalendarClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CGregorianCalendarClassObject
+    : public ClassObject
+    , public ICGregorianCalendarClassObject
+{
+public:
+    CGregorianCalendarClassObject();
+
+    ~CGregorianCalendarClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ITimeZone* zone,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ITimeZone* zone,
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer dayOfMonth,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer dayOfMonth,
+        /* [in] */ Integer hourOfDay,
+        /* [in] */ Integer minute,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer dayOfMonth,
+        /* [in] */ Integer hourOfDay,
+        /* [in] */ Integer minute,
+        /* [in] */ Integer second,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CGregorianCalendarClassObject* sCGregorianCalendarClassObject = nullptr;
+static std::atomic<CGregorianCalendarClassObject*> sCGregorianCalendarCachedClassObject(nullptr);
+static Spinlock& GetCGregorianCalendarClassObjectLock()
+{
+    static Spinlock sCGregorianCalendarClassObjectLock;
+    return sCGregorianCalendarClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CGregorianCalendarClassObject, ClassObject, ICGregorianCalendarClassObject);
+
+CGregorianCalendarClassObject::CGregorianCalendarClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CGregorianCalendarClassObject::~CGregorianCalendarClassObject()
+{
+    Spinlock& lock = GetCGregorianCalendarClassObjectLock();
+    lock.Lock();
+    sCGregorianCalendarClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CGregorianCalendarClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CGregorianCalendarClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CGregorianCalendar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CGregorianCalendar* _obj = new(addr) CGregorianCalendar();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CGregorianCalendar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CGregorianCalendarClassObject::CreateObject(
+    /* [in] */ ccm::util::ITimeZone* zone,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CGregorianCalendar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CGregorianCalendar* _obj = new(addr) CGregorianCalendar();
+    ECode ec = _obj->Constructor(zone);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CGregorianCalendar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CGregorianCalendarClassObject::CreateObject(
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CGregorianCalendar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CGregorianCalendar* _obj = new(addr) CGregorianCalendar();
+    ECode ec = _obj->Constructor(locale);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CGregorianCalendar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CGregorianCalendarClassObject::CreateObject(
+    /* [in] */ ccm::util::ITimeZone* zone,
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CGregorianCalendar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CGregorianCalendar* _obj = new(addr) CGregorianCalendar();
+    ECode ec = _obj->Constructor(zone, locale);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CGregorianCalendar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CGregorianCalendarClassObject::CreateObject(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer dayOfMonth,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CGregorianCalendar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CGregorianCalendar* _obj = new(addr) CGregorianCalendar();
+    ECode ec = _obj->Constructor(year, month, dayOfMonth);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CGregorianCalendar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CGregorianCalendarClassObject::CreateObject(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer dayOfMonth,
+    /* [in] */ Integer hourOfDay,
+    /* [in] */ Integer minute,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CGregorianCalendar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CGregorianCalendar* _obj = new(addr) CGregorianCalendar();
+    ECode ec = _obj->Constructor(year, month, dayOfMonth, hourOfDay, minute);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CGregorianCalendar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CGregorianCalendarClassObject::CreateObject(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer dayOfMonth,
+    /* [in] */ Integer hourOfDay,
+    /* [in] */ Integer minute,
+    /* [in] */ Integer second,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CGregorianCalendar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CGregorianCalendar* _obj = new(addr) CGregorianCalendar();
+    ECode ec = _obj->Constructor(year, month, dayOfMonth, hourOfDay, minute, second);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CGregorianCalendar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCGregorianCalendarClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCGregorianCalendarClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCGregorianCalendarClassObject == nullptr) {
+        sCGregorianCalendarClassObject = new CGregorianCalendarClassObject();
+    }
+    else if (sCGregorianCalendarClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCGregorianCalendarClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCGregorianCalendarClassObject;
+    return NOERROR;
+}
+
+static CGregorianCalendarClassObject* GetCachedCGregorianCalendarClassObject()
+{
+    CGregorianCalendarClassObject* clsObject = sCGregorianCalendarCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCGregorianCalendarClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCGregorianCalendarCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCGregorianCalendarClassObject == nullptr) {
+            sCGregorianCalendarClassObject = new CGregorianCalendarClassObject();
+        }
+        else if (sCGregorianCalendarClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCGregorianCalendarClassObject;
+        clsObject->AddRef();
+        sCGregorianCalendarCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCGregorianCalendarClassObjectCache()
+{
+    Spinlock& lock = GetCGregorianCalendarClassObjectLock();
+    lock.Lock();
+    CGregorianCalendarClassObject* clsObject = sCGregorianCalendarCachedClassObject.load(std::memory_order_relaxed);
+    sCGregorianCalendarCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CGregorianCalendar::_CGregorianCalendar()
+{
+    sCGregorianCalendarClassObject->AddRef();
+}
+
+_CGregorianCalendar::~_CGregorianCalendar()
+{
+    sCGregorianCalendarClassObject->Release();
+}
+
+ECode _CGregorianCalendar::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CGregorianCalendarClassObject* cachedClsObject = GetCachedCGregorianCalendarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CGregorianCalendar, iid, nullptr, object);
+};
+
+ECode _CGregorianCalendar::New(
+    /* [in] */ ccm::util::ITimeZone* zone,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CGregorianCalendarClassObject* cachedClsObject = GetCachedCGregorianCalendarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(zone, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CGregorianCalendar, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICGregorianCalendarClassObject::Probe(clsObject)->CreateObject(zone, iid, object);
+};
+
+ECode _CGregorianCalendar::New(
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CGregorianCalendarClassObject* cachedClsObject = GetCachedCGregorianCalendarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(locale, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CGregorianCalendar, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICGregorianCalendarClassObject::Probe(clsObject)->CreateObject(locale, iid, object);
+};
+
+ECode _CGregorianCalendar::New(
+    /* [in] */ ccm::util::ITimeZone* zone,
+    /* [in] */ ccm::util::ILocale* locale,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CGregorianCalendarClassObject* cachedClsObject = GetCachedCGregorianCalendarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(zone, locale, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CGregorianCalendar, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICGregorianCalendarClassObject::Probe(clsObject)->CreateObject(zone, locale, iid, object);
+};
+
+ECode _CGregorianCalendar::New(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer dayOfMonth,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CGregorianCalendarClassObject* cachedClsObject = GetCachedCGregorianCalendarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(year, month, dayOfMonth, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CGregorianCalendar, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICGregorianCalendarClassObject::Probe(clsObject)->CreateObject(year, month, dayOfMonth, iid, object);
+};
+
+ECode _CGregorianCalendar::New(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer dayOfMonth,
+    /* [in] */ Integer hourOfDay,
+    /* [in] */ Integer minute,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CGregorianCalendarClassObject* cachedClsObject = GetCachedCGregorianCalendarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(year, month, dayOfMonth, hourOfDay, minute, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CGregorianCalendar, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICGregorianCalendarClassObject::Probe(clsObject)->CreateObject(year, month, dayOfMonth, hourOfDay, minute, iid, object);
+};
+
+ECode _CGregorianCalendar::New(
+    /* [in] */ Integer year,
+    /* [in] */ Integer month,
+    /* [in] */ Integer dayOfMonth,
+    /* [in] */ Integer hourOfDay,
+    /* [in] */ Integer minute,
+    /* [in] */ Integer second,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CGregorianCalendarClassObject* cachedClsObject = GetCachedCGregorianCalendarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(year, month, dayOfMonth, hourOfDay, minute, second, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CGregorianCalendar, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICGregorianCalendarClassObject::Probe(clsObject)->CreateObject(year, month, dayOfMonth, hourOfDay, minute, second, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
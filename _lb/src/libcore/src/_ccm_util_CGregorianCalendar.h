@@ -0,0 +1,87 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CGREGORIANCALENDAR_H_GEN__
+#define __CCM_UTIL_CGREGORIANCALENDAR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const CoclassID CID_CGregorianCalendar;
+
+COCLASS_ID(e3a4ed7a-c706-4a8a-9116-2c9fcfe97a25)
+class _CGregorianCalendar
+{
+public:
+    _CGregorianCalendar();
+
+    virtual ~_CGregorianCalendar();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::util::ITimeZone* zone,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::util::ITimeZone* zone,
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer dayOfMonth,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer dayOfMonth,
+        /* [in] */ Integer hourOfDay,
+        /* [in] */ Integer minute,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer dayOfMonth,
+        /* [in] */ Integer hourOfDay,
+        /* [in] */ Integer minute,
+        /* [in] */ Integer second,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CGREGORIANCALENDAR_H_GEN__
@@ -0,0 +1,319 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CHashMap.h"
+#include "ccm.util.ICHashMapClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CHashMapClassObject
+    : public ClassObject
+    , public ICHashMapClassObject
+{
+public:
+    CHashMapClassObject();
+
+    ~CHashMapClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::IMap* m,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ Float loadFactor,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CHashMapClassObject* sCHashMapClassObject = nullptr;
+static std::atomic<CHashMapClassObject*> sCHashMapCachedClassObject(nullptr);
+static Spinlock& GetCHashMapClassObjectLock()
+{
+    static Spinlock sCHashMapClassObjectLock;
+    return sCHashMapClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CHashMapClassObject, ClassObject, ICHashMapClassObject);
+
+CHashMapClassObject::CHashMapClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CHashMapClassObject::~CHashMapClassObject()
+{
+    Spinlock& lock = GetCHashMapClassObjectLock();
+    lock.Lock();
+    sCHashMapClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CHashMapClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CHashMapClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashMap* _obj = new(addr) CHashMap();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CHashMapClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashMap* _obj = new(addr) CHashMap();
+    ECode ec = _obj->Constructor(initialCapacity);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CHashMapClassObject::CreateObject(
+    /* [in] */ ccm::util::IMap* m,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashMap* _obj = new(addr) CHashMap();
+    ECode ec = _obj->Constructor(m);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CHashMapClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashMap* _obj = new(addr) CHashMap();
+    ECode ec = _obj->Constructor(initialCapacity, loadFactor);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCHashMapClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCHashMapClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCHashMapClassObject == nullptr) {
+        sCHashMapClassObject = new CHashMapClassObject();
+    }
+    else if (sCHashMapClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCHashMapClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCHashMapClassObject;
+    return NOERROR;
+}
+
+static CHashMapClassObject* GetCachedCHashMapClassObject()
+{
+    CHashMapClassObject* clsObject = sCHashMapCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCHashMapClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCHashMapCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCHashMapClassObject == nullptr) {
+            sCHashMapClassObject = new CHashMapClassObject();
+        }
+        else if (sCHashMapClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCHashMapClassObject;
+        clsObject->AddRef();
+        sCHashMapCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCHashMapClassObjectCache()
+{
+    Spinlock& lock = GetCHashMapClassObjectLock();
+    lock.Lock();
+    CHashMapClassObject* clsObject = sCHashMapCachedClassObject.load(std::memory_order_relaxed);
+    sCHashMapCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CHashMap::_CHashMap()
+{
+    sCHashMapClassObject->AddRef();
+}
+
+_CHashMap::~_CHashMap()
+{
+    sCHashMapClassObject->Release();
+}
+
+ECode _CHashMap::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashMapClassObject* cachedClsObject = GetCachedCHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CHashMap, iid, nullptr, object);
+};
+
+ECode _CHashMap::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashMapClassObject* cachedClsObject = GetCachedCHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICHashMapClassObject::Probe(clsObject)->CreateObject(initialCapacity, iid, object);
+};
+
+ECode _CHashMap::New(
+    /* [in] */ ccm::util::IMap* m,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashMapClassObject* cachedClsObject = GetCachedCHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(m, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICHashMapClassObject::Probe(clsObject)->CreateObject(m, iid, object);
+};
+
+ECode _CHashMap::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashMapClassObject* cachedClsObject = GetCachedCHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, loadFactor, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICHashMapClassObject::Probe(clsObject)->CreateObject(initialCapacity, loadFactor, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,368 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CHashSet.h"
+#include "ccm.util.ICHashSetClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CHashSetClassObject
+    : public ClassObject
+    , public ICHashSetClassObject
+{
+public:
+    CHashSetClassObject();
+
+    ~CHashSetClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ Float loadFactor,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ Float loadFactor,
+        /* [in] */ Boolean dummy,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CHashSetClassObject* sCHashSetClassObject = nullptr;
+static std::atomic<CHashSetClassObject*> sCHashSetCachedClassObject(nullptr);
+static Spinlock& GetCHashSetClassObjectLock()
+{
+    static Spinlock sCHashSetClassObjectLock;
+    return sCHashSetClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CHashSetClassObject, ClassObject, ICHashSetClassObject);
+
+CHashSetClassObject::CHashSetClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CHashSetClassObject::~CHashSetClassObject()
+{
+    Spinlock& lock = GetCHashSetClassObjectLock();
+    lock.Lock();
+    sCHashSetClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CHashSetClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CHashSetClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashSet* _obj = new(addr) CHashSet();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CHashSetClassObject::CreateObject(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashSet* _obj = new(addr) CHashSet();
+    ECode ec = _obj->Constructor(c);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CHashSetClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashSet* _obj = new(addr) CHashSet();
+    ECode ec = _obj->Constructor(initialCapacity);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CHashSetClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashSet* _obj = new(addr) CHashSet();
+    ECode ec = _obj->Constructor(initialCapacity, loadFactor);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CHashSetClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ Boolean dummy,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashSet* _obj = new(addr) CHashSet();
+    ECode ec = _obj->Constructor(initialCapacity, loadFactor, dummy);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCHashSetClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCHashSetClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCHashSetClassObject == nullptr) {
+        sCHashSetClassObject = new CHashSetClassObject();
+    }
+    else if (sCHashSetClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCHashSetClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCHashSetClassObject;
+    return NOERROR;
+}
+
+static CHashSetClassObject* GetCachedCHashSetClassObject()
+{
+    CHashSetClassObject* clsObject = sCHashSetCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCHashSetClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCHashSetCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCHashSetClassObject == nullptr) {
+            sCHashSetClassObject = new CHashSetClassObject();
+        }
+        else if (sCHashSetClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCHashSetClassObject;
+        clsObject->AddRef();
+        sCHashSetCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCHashSetClassObjectCache()
+{
+    Spinlock& lock = GetCHashSetClassObjectLock();
+    lock.Lock();
+    CHashSetClassObject* clsObject = sCHashSetCachedClassObject.load(std::memory_order_relaxed);
+    sCHashSetCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CHashSet::_CHashSet()
+{
+    sCHashSetClassObject->AddRef();
+}
+
+_CHashSet::~_CHashSet()
+{
+    sCHashSetClassObject->Release();
+}
+
+ECode _CHashSet::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashSetClassObject* cachedClsObject = GetCachedCHashSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CHashSet, iid, nullptr, object);
+};
+
+ECode _CHashSet::New(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashSetClassObject* cachedClsObject = GetCachedCHashSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(c, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CHashSet, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICHashSetClassObject::Probe(clsObject)->CreateObject(c, iid, object);
+};
+
+ECode _CHashSet::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashSetClassObject* cachedClsObject = GetCachedCHashSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CHashSet, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICHashSetClassObject::Probe(clsObject)->CreateObject(initialCapacity, iid, object);
+};
+
+ECode _CHashSet::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashSetClassObject* cachedClsObject = GetCachedCHashSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, loadFactor, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CHashSet, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICHashSetClassObject::Probe(clsObject)->CreateObject(initialCapacity, loadFactor, iid, object);
+};
+
+ECode _CHashSet::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ Boolean dummy,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashSetClassObject* cachedClsObject = GetCachedCHashSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, loadFactor, dummy, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CHashSet, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICHashSetClassObject::Probe(clsObject)->CreateObject(initialCapacity, loadFactor, dummy, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,319 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CHashtable.h"
+#include "ccm.util.ICHashtableClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CHashtableClassObject
+    : public ClassObject
+    , public ICHashtableClassObject
+{
+public:
+    CHashtableClassObject();
+
+    ~CHashtableClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ Float loadFactor,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::IMap* t,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CHashtableClassObject* sCHashtableClassObject = nullptr;
+static std::atomic<CHashtableClassObject*> sCHashtableCachedClassObject(nullptr);
+static Spinlock& GetCHashtableClassObjectLock()
+{
+    static Spinlock sCHashtableClassObjectLock;
+    return sCHashtableClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CHashtableClassObject, ClassObject, ICHashtableClassObject);
+
+CHashtableClassObject::CHashtableClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CHashtableClassObject::~CHashtableClassObject()
+{
+    Spinlock& lock = GetCHashtableClassObjectLock();
+    lock.Lock();
+    sCHashtableClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CHashtableClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CHashtableClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashtable), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashtable* _obj = new(addr) CHashtable();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashtable");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CHashtableClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashtable), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashtable* _obj = new(addr) CHashtable();
+    ECode ec = _obj->Constructor(initialCapacity);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashtable");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CHashtableClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashtable), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashtable* _obj = new(addr) CHashtable();
+    ECode ec = _obj->Constructor(initialCapacity, loadFactor);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashtable");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CHashtableClassObject::CreateObject(
+    /* [in] */ ccm::util::IMap* t,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CHashtable), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CHashtable* _obj = new(addr) CHashtable();
+    ECode ec = _obj->Constructor(t);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CHashtable");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCHashtableClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCHashtableClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCHashtableClassObject == nullptr) {
+        sCHashtableClassObject = new CHashtableClassObject();
+    }
+    else if (sCHashtableClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCHashtableClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCHashtableClassObject;
+    return NOERROR;
+}
+
+static CHashtableClassObject* GetCachedCHashtableClassObject()
+{
+    CHashtableClassObject* clsObject = sCHashtableCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCHashtableClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCHashtableCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCHashtableClassObject == nullptr) {
+            sCHashtableClassObject = new CHashtableClassObject();
+        }
+        else if (sCHashtableClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCHashtableClassObject;
+        clsObject->AddRef();
+        sCHashtableCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCHashtableClassObjectCache()
+{
+    Spinlock& lock = GetCHashtableClassObjectLock();
+    lock.Lock();
+    CHashtableClassObject* clsObject = sCHashtableCachedClassObject.load(std::memory_order_relaxed);
+    sCHashtableCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CHashtable::_CHashtable()
+{
+    sCHashtableClassObject->AddRef();
+}
+
+_CHashtable::~_CHashtable()
+{
+    sCHashtableClassObject->Release();
+}
+
+ECode _CHashtable::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashtableClassObject* cachedClsObject = GetCachedCHashtableClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CHashtable, iid, nullptr, object);
+};
+
+ECode _CHashtable::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashtableClassObject* cachedClsObject = GetCachedCHashtableClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CHashtable, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICHashtableClassObject::Probe(clsObject)->CreateObject(initialCapacity, iid, object);
+};
+
+ECode _CHashtable::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashtableClassObject* cachedClsObject = GetCachedCHashtableClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, loadFactor, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CHashtable, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICHashtableClassObject::Probe(clsObject)->CreateObject(initialCapacity, loadFactor, iid, object);
+};
+
+ECode _CHashtable::New(
+    /* [in] */ ccm::util::IMap* t,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CHashtableClassObject* cachedClsObject = GetCachedCHashtableClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(t, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CHashtable, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICHashtableClassObject::Probe(clsObject)->CreateObject(t, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
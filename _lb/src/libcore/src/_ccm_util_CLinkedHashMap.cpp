@@ -0,0 +1,368 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CLinkedHashMap.h"
+#include "ccm.util.ICLinkedHashMapClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CLinkedHashMapClassObject
+    : public ClassObject
+    , public ICLinkedHashMapClassObject
+{
+public:
+    CLinkedHashMapClassObject();
+
+    ~CLinkedHashMapClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ Float loadFactor,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ Float loadFactor,
+        /* [in] */ Boolean accessOrder,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::IMap* m,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CLinkedHashMapClassObject* sCLinkedHashMapClassObject = nullptr;
+static std::atomic<CLinkedHashMapClassObject*> sCLinkedHashMapCachedClassObject(nullptr);
+static Spinlock& GetCLinkedHashMapClassObjectLock()
+{
+    static Spinlock sCLinkedHashMapClassObjectLock;
+    return sCLinkedHashMapClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CLinkedHashMapClassObject, ClassObject, ICLinkedHashMapClassObject);
+
+CLinkedHashMapClassObject::CLinkedHashMapClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CLinkedHashMapClassObject::~CLinkedHashMapClassObject()
+{
+    Spinlock& lock = GetCLinkedHashMapClassObjectLock();
+    lock.Lock();
+    sCLinkedHashMapClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CLinkedHashMapClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CLinkedHashMapClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedHashMap* _obj = new(addr) CLinkedHashMap();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CLinkedHashMapClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedHashMap* _obj = new(addr) CLinkedHashMap();
+    ECode ec = _obj->Constructor(initialCapacity);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CLinkedHashMapClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedHashMap* _obj = new(addr) CLinkedHashMap();
+    ECode ec = _obj->Constructor(initialCapacity, loadFactor);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CLinkedHashMapClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ Boolean accessOrder,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedHashMap* _obj = new(addr) CLinkedHashMap();
+    ECode ec = _obj->Constructor(initialCapacity, loadFactor, accessOrder);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CLinkedHashMapClassObject::CreateObject(
+    /* [in] */ ccm::util::IMap* m,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedHashMap* _obj = new(addr) CLinkedHashMap();
+    ECode ec = _obj->Constructor(m);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCLinkedHashMapClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCLinkedHashMapClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCLinkedHashMapClassObject == nullptr) {
+        sCLinkedHashMapClassObject = new CLinkedHashMapClassObject();
+    }
+    else if (sCLinkedHashMapClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCLinkedHashMapClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCLinkedHashMapClassObject;
+    return NOERROR;
+}
+
+static CLinkedHashMapClassObject* GetCachedCLinkedHashMapClassObject()
+{
+    CLinkedHashMapClassObject* clsObject = sCLinkedHashMapCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCLinkedHashMapClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCLinkedHashMapCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCLinkedHashMapClassObject == nullptr) {
+            sCLinkedHashMapClassObject = new CLinkedHashMapClassObject();
+        }
+        else if (sCLinkedHashMapClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCLinkedHashMapClassObject;
+        clsObject->AddRef();
+        sCLinkedHashMapCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCLinkedHashMapClassObjectCache()
+{
+    Spinlock& lock = GetCLinkedHashMapClassObjectLock();
+    lock.Lock();
+    CLinkedHashMapClassObject* clsObject = sCLinkedHashMapCachedClassObject.load(std::memory_order_relaxed);
+    sCLinkedHashMapCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CLinkedHashMap::_CLinkedHashMap()
+{
+    sCLinkedHashMapClassObject->AddRef();
+}
+
+_CLinkedHashMap::~_CLinkedHashMap()
+{
+    sCLinkedHashMapClassObject->Release();
+}
+
+ECode _CLinkedHashMap::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedHashMapClassObject* cachedClsObject = GetCachedCLinkedHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CLinkedHashMap, iid, nullptr, object);
+};
+
+ECode _CLinkedHashMap::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedHashMapClassObject* cachedClsObject = GetCachedCLinkedHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLinkedHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLinkedHashMapClassObject::Probe(clsObject)->CreateObject(initialCapacity, iid, object);
+};
+
+ECode _CLinkedHashMap::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedHashMapClassObject* cachedClsObject = GetCachedCLinkedHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, loadFactor, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLinkedHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLinkedHashMapClassObject::Probe(clsObject)->CreateObject(initialCapacity, loadFactor, iid, object);
+};
+
+ECode _CLinkedHashMap::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ Boolean accessOrder,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedHashMapClassObject* cachedClsObject = GetCachedCLinkedHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, loadFactor, accessOrder, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLinkedHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLinkedHashMapClassObject::Probe(clsObject)->CreateObject(initialCapacity, loadFactor, accessOrder, iid, object);
+};
+
+ECode _CLinkedHashMap::New(
+    /* [in] */ ccm::util::IMap* m,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedHashMapClassObject* cachedClsObject = GetCachedCLinkedHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(m, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLinkedHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLinkedHashMapClassObject::Probe(clsObject)->CreateObject(m, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,319 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CLinkedHashSet.h"
+#include "ccm.util.ICLinkedHashSetClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CLinkedHashSetClassObject
+    : public ClassObject
+    , public ICLinkedHashSetClassObject
+{
+public:
+    CLinkedHashSetClassObject();
+
+    ~CLinkedHashSetClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ Float loadFactor,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CLinkedHashSetClassObject* sCLinkedHashSetClassObject = nullptr;
+static std::atomic<CLinkedHashSetClassObject*> sCLinkedHashSetCachedClassObject(nullptr);
+static Spinlock& GetCLinkedHashSetClassObjectLock()
+{
+    static Spinlock sCLinkedHashSetClassObjectLock;
+    return sCLinkedHashSetClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CLinkedHashSetClassObject, ClassObject, ICLinkedHashSetClassObject);
+
+CLinkedHashSetClassObject::CLinkedHashSetClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CLinkedHashSetClassObject::~CLinkedHashSetClassObject()
+{
+    Spinlock& lock = GetCLinkedHashSetClassObjectLock();
+    lock.Lock();
+    sCLinkedHashSetClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CLinkedHashSetClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CLinkedHashSetClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedHashSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedHashSet* _obj = new(addr) CLinkedHashSet();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedHashSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CLinkedHashSetClassObject::CreateObject(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedHashSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedHashSet* _obj = new(addr) CLinkedHashSet();
+    ECode ec = _obj->Constructor(c);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedHashSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CLinkedHashSetClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedHashSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedHashSet* _obj = new(addr) CLinkedHashSet();
+    ECode ec = _obj->Constructor(initialCapacity);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedHashSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CLinkedHashSetClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedHashSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedHashSet* _obj = new(addr) CLinkedHashSet();
+    ECode ec = _obj->Constructor(initialCapacity, loadFactor);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedHashSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCLinkedHashSetClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCLinkedHashSetClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCLinkedHashSetClassObject == nullptr) {
+        sCLinkedHashSetClassObject = new CLinkedHashSetClassObject();
+    }
+    else if (sCLinkedHashSetClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCLinkedHashSetClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCLinkedHashSetClassObject;
+    return NOERROR;
+}
+
+static CLinkedHashSetClassObject* GetCachedCLinkedHashSetClassObject()
+{
+    CLinkedHashSetClassObject* clsObject = sCLinkedHashSetCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCLinkedHashSetClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCLinkedHashSetCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCLinkedHashSetClassObject == nullptr) {
+            sCLinkedHashSetClassObject = new CLinkedHashSetClassObject();
+        }
+        else if (sCLinkedHashSetClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCLinkedHashSetClassObject;
+        clsObject->AddRef();
+        sCLinkedHashSetCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCLinkedHashSetClassObjectCache()
+{
+    Spinlock& lock = GetCLinkedHashSetClassObjectLock();
+    lock.Lock();
+    CLinkedHashSetClassObject* clsObject = sCLinkedHashSetCachedClassObject.load(std::memory_order_relaxed);
+    sCLinkedHashSetCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CLinkedHashSet::_CLinkedHashSet()
+{
+    sCLinkedHashSetClassObject->AddRef();
+}
+
+_CLinkedHashSet::~_CLinkedHashSet()
+{
+    sCLinkedHashSetClassObject->Release();
+}
+
+ECode _CLinkedHashSet::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedHashSetClassObject* cachedClsObject = GetCachedCLinkedHashSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CLinkedHashSet, iid, nullptr, object);
+};
+
+ECode _CLinkedHashSet::New(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedHashSetClassObject* cachedClsObject = GetCachedCLinkedHashSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(c, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLinkedHashSet, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLinkedHashSetClassObject::Probe(clsObject)->CreateObject(c, iid, object);
+};
+
+ECode _CLinkedHashSet::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedHashSetClassObject* cachedClsObject = GetCachedCLinkedHashSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLinkedHashSet, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLinkedHashSetClassObject::Probe(clsObject)->CreateObject(initialCapacity, iid, object);
+};
+
+ECode _CLinkedHashSet::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedHashSetClassObject* cachedClsObject = GetCachedCLinkedHashSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, loadFactor, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLinkedHashSet, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLinkedHashSetClassObject::Probe(clsObject)->CreateObject(initialCapacity, loadFactor, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CLinkedList.h"
+#include "ccm.util.ICLinkedListClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CLinkedListClassObject
+    : public ClassObject
+    , public ICLinkedListClassObject
+{
+public:
+    CLinkedListClassObject();
+
+    ~CLinkedListClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CLinkedListClassObject* sCLinkedListClassObject = nullptr;
+static std::atomic<CLinkedListClassObject*> sCLinkedListCachedClassObject(nullptr);
+static Spinlock& GetCLinkedListClassObjectLock()
+{
+    static Spinlock sCLinkedListClassObjectLock;
+    return sCLinkedListClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CLinkedListClassObject, ClassObject, ICLinkedListClassObject);
+
+CLinkedListClassObject::CLinkedListClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CLinkedListClassObject::~CLinkedListClassObject()
+{
+    Spinlock& lock = GetCLinkedListClassObjectLock();
+    lock.Lock();
+    sCLinkedListClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CLinkedListClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CLinkedListClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedList), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedList* _obj = new(addr) CLinkedList();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedList");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CLinkedListClassObject::CreateObject(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLinkedList), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLinkedList* _obj = new(addr) CLinkedList();
+    ECode ec = _obj->Constructor(c);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLinkedList");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCLinkedListClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCLinkedListClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCLinkedListClassObject == nullptr) {
+        sCLinkedListClassObject = new CLinkedListClassObject();
+    }
+    else if (sCLinkedListClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCLinkedListClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCLinkedListClassObject;
+    return NOERROR;
+}
+
+static CLinkedListClassObject* GetCachedCLinkedListClassObject()
+{
+    CLinkedListClassObject* clsObject = sCLinkedListCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCLinkedListClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCLinkedListCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCLinkedListClassObject == nullptr) {
+            sCLinkedListClassObject = new CLinkedListClassObject();
+        }
+        else if (sCLinkedListClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCLinkedListClassObject;
+        clsObject->AddRef();
+        sCLinkedListCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCLinkedListClassObjectCache()
+{
+    Spinlock& lock = GetCLinkedListClassObjectLock();
+    lock.Lock();
+    CLinkedListClassObject* clsObject = sCLinkedListCachedClassObject.load(std::memory_order_relaxed);
+    sCLinkedListCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CLinkedList::_CLinkedList()
+{
+    sCLinkedListClassObject->AddRef();
+}
+
+_CLinkedList::~_CLinkedList()
+{
+    sCLinkedListClassObject->Release();
+}
+
+ECode _CLinkedList::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedListClassObject* cachedClsObject = GetCachedCLinkedListClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CLinkedList, iid, nullptr, object);
+};
+
+ECode _CLinkedList::New(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLinkedListClassObject* cachedClsObject = GetCachedCLinkedListClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(c, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLinkedList, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLinkedListClassObject::Probe(clsObject)->CreateObject(c, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,301 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CLocale.h"
+#include "ccm.util.ICLocaleClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CLocaleClassObject
+    : public ClassObject
+    , public ICLocaleClassObject
+{
+public:
+    CLocaleClassObject();
+
+    ~CLocaleClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& language,
+        /* [in] */ const String& country,
+        /* [in] */ const String& variant,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& language,
+        /* [in] */ const String& country,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& language,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CLocaleClassObject* sCLocaleClassObject = nullptr;
+static std::atomic<CLocaleClassObject*> sCLocaleCachedClassObject(nullptr);
+static Spinlock& GetCLocaleClassObjectLock()
+{
+    static Spinlock sCLocaleClassObjectLock;
+    return sCLocaleClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CLocaleClassObject, ClassObject, ICLocaleClassObject);
+
+CLocaleClassObject::CLocaleClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CLocaleClassObject::~CLocaleClassObject()
+{
+    Spinlock& lock = GetCLocaleClassObjectLock();
+    lock.Lock();
+    sCLocaleClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CLocaleClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CLocaleClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CLocaleClassObject::CreateObject(
+    /* [in] */ const String& language,
+    /* [in] */ const String& country,
+    /* [in] */ const String& variant,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLocale), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLocale* _obj = new(addr) CLocale();
+    ECode ec = _obj->Constructor(language, country, variant);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLocale");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CLocaleClassObject::CreateObject(
+    /* [in] */ const String& language,
+    /* [in] */ const String& country,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLocale), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLocale* _obj = new(addr) CLocale();
+    ECode ec = _obj->Constructor(language, country);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLocale");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CLocaleClassObject::CreateObject(
+    /* [in] */ const String& language,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLocale), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLocale* _obj = new(addr) CLocale();
+    ECode ec = _obj->Constructor(language);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLocale");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCLocaleClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCLocaleClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCLocaleClassObject == nullptr) {
+        sCLocaleClassObject = new CLocaleClassObject();
+    }
+    else if (sCLocaleClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCLocaleClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCLocaleClassObject;
+    return NOERROR;
+}
+
+static CLocaleClassObject* GetCachedCLocaleClassObject()
+{
+    CLocaleClassObject* clsObject = sCLocaleCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCLocaleClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCLocaleCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCLocaleClassObject == nullptr) {
+            sCLocaleClassObject = new CLocaleClassObject();
+        }
+        else if (sCLocaleClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCLocaleClassObject;
+        clsObject->AddRef();
+        sCLocaleCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCLocaleClassObjectCache()
+{
+    Spinlock& lock = GetCLocaleClassObjectLock();
+    lock.Lock();
+    CLocaleClassObject* clsObject = sCLocaleCachedClassObject.load(std::memory_order_relaxed);
+    sCLocaleCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CLocale::_CLocale()
+{
+    sCLocaleClassObject->AddRef();
+}
+
+_CLocale::~_CLocale()
+{
+    sCLocaleClassObject->Release();
+}
+
+ECode _CLocale::New(
+    /* [in] */ const String& language,
+    /* [in] */ const String& country,
+    /* [in] */ const String& variant,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLocaleClassObject* cachedClsObject = GetCachedCLocaleClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(language, country, variant, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLocale, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLocaleClassObject::Probe(clsObject)->CreateObject(language, country, variant, iid, object);
+};
+
+ECode _CLocale::New(
+    /* [in] */ const String& language,
+    /* [in] */ const String& country,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLocaleClassObject* cachedClsObject = GetCachedCLocaleClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(language, country, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLocale, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLocaleClassObject::Probe(clsObject)->CreateObject(language, country, iid, object);
+};
+
+ECode _CLocale::New(
+    /* [in] */ const String& language,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLocaleClassObject* cachedClsObject = GetCachedCLocaleClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(language, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLocale, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLocaleClassObject::Probe(clsObject)->CreateObject(language, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
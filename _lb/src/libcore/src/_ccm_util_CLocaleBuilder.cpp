@@ -0,0 +1,181 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CLocaleBuilder.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CLocaleBuilderClassObject
+    : public ClassObject
+{
+public:
+    CLocaleBuilderClassObject();
+
+    ~CLocaleBuilderClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CLocaleBuilderClassObject* sCLocaleBuilderClassObject = nullptr;
+static std::atomic<CLocaleBuilderClassObject*> sCLocaleBuilderCachedClassObject(nullptr);
+static Spinlock& GetCLocaleBuilderClassObjectLock()
+{
+    static Spinlock sCLocaleBuilderClassObjectLock;
+    return sCLocaleBuilderClassObjectLock;
+}
+
+CLocaleBuilderClassObject::CLocaleBuilderClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CLocaleBuilderClassObject::~CLocaleBuilderClassObject()
+{
+    Spinlock& lock = GetCLocaleBuilderClassObjectLock();
+    lock.Lock();
+    sCLocaleBuilderClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CLocaleBuilderClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CLocaleBuilderClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLocaleBuilder), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLocaleBuilder* _obj = new(addr) CLocaleBuilder();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CLocaleBuilder");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCLocaleBuilderClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCLocaleBuilderClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCLocaleBuilderClassObject == nullptr) {
+        sCLocaleBuilderClassObject = new CLocaleBuilderClassObject();
+    }
+    else if (sCLocaleBuilderClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCLocaleBuilderClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCLocaleBuilderClassObject;
+    return NOERROR;
+}
+
+static CLocaleBuilderClassObject* GetCachedCLocaleBuilderClassObject()
+{
+    CLocaleBuilderClassObject* clsObject = sCLocaleBuilderCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCLocaleBuilderClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCLocaleBuilderCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCLocaleBuilderClassObject == nullptr) {
+            sCLocaleBuilderClassObject = new CLocaleBuilderClassObject();
+        }
+        else if (sCLocaleBuilderClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCLocaleBuilderClassObject;
+        clsObject->AddRef();
+        sCLocaleBuilderCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCLocaleBuilderClassObjectCache()
+{
+    Spinlock& lock = GetCLocaleBuilderClassObjectLock();
+    lock.Lock();
+    CLocaleBuilderClassObject* clsObject = sCLocaleBuilderCachedClassObject.load(std::memory_order_relaxed);
+    sCLocaleBuilderCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CLocaleBuilder::_CLocaleBuilder()
+{
+    sCLocaleBuilderClassObject->AddRef();
+}
+
+_CLocaleBuilder::~_CLocaleBuilder()
+{
+    sCLocaleBuilderClassObject->Release();
+}
+
+ECode _CLocaleBuilder::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLocaleBuilderClassObject* cachedClsObject = GetCachedCLocaleBuilderClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CLocaleBuilder, iid, nullptr, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CProperties.h"
+#include "ccm.util.ICPropertiesClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CPropertiesClassObject
+    : public ClassObject
+    , public ICPropertiesClassObject
+{
+public:
+    CPropertiesClassObject();
+
+    ~CPropertiesClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::IProperties* defaults,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CPropertiesClassObject* sCPropertiesClassObject = nullptr;
+static std::atomic<CPropertiesClassObject*> sCPropertiesCachedClassObject(nullptr);
+static Spinlock& GetCPropertiesClassObjectLock()
+{
+    static Spinlock sCPropertiesClassObjectLock;
+    return sCPropertiesClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CPropertiesClassObject, ClassObject, ICPropertiesClassObject);
+
+CPropertiesClassObject::CPropertiesClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CPropertiesClassObject::~CPropertiesClassObject()
+{
+    Spinlock& lock = GetCPropertiesClassObjectLock();
+    lock.Lock();
+    sCPropertiesClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CPropertiesClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CPropertiesClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CProperties), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CProperties* _obj = new(addr) CProperties();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CProperties");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CPropertiesClassObject::CreateObject(
+    /* [in] */ ccm::util::IProperties* defaults,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CProperties), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CProperties* _obj = new(addr) CProperties();
+    ECode ec = _obj->Constructor(defaults);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CProperties");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCPropertiesClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCPropertiesClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCPropertiesClassObject == nullptr) {
+        sCPropertiesClassObject = new CPropertiesClassObject();
+    }
+    else if (sCPropertiesClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCPropertiesClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCPropertiesClassObject;
+    return NOERROR;
+}
+
+static CPropertiesClassObject* GetCachedCPropertiesClassObject()
+{
+    CPropertiesClassObject* clsObject = sCPropertiesCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCPropertiesClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCPropertiesCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCPropertiesClassObject == nullptr) {
+            sCPropertiesClassObject = new CPropertiesClassObject();
+        }
+        else if (sCPropertiesClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCPropertiesClassObject;
+        clsObject->AddRef();
+        sCPropertiesCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCPropertiesClassObjectCache()
+{
+    Spinlock& lock = GetCPropertiesClassObjectLock();
+    lock.Lock();
+    CPropertiesClassObject* clsObject = sCPropertiesCachedClassObject.load(std::memory_order_relaxed);
+    sCPropertiesCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CProperties::_CProperties()
+{
+    sCPropertiesClassObject->AddRef();
+}
+
+_CProperties::~_CProperties()
+{
+    sCPropertiesClassObject->Release();
+}
+
+ECode _CProperties::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPropertiesClassObject* cachedClsObject = GetCachedCPropertiesClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CProperties, iid, nullptr, object);
+};
+
+ECode _CProperties::New(
+    /* [in] */ ccm::util::IProperties* defaults,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPropertiesClassObject* cachedClsObject = GetCachedCPropertiesClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(defaults, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CProperties, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPropertiesClassObject::Probe(clsObject)->CreateObject(defaults, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,209 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CPropertyPermission.h"
+#include "ccm.util.ICPropertyPermissionClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CPropertyPermissionClassObject
+    : public ClassObject
+    , public ICPropertyPermissionClassObject
+{
+public:
+    CPropertyPermissionClassObject();
+
+    ~CPropertyPermissionClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& name,
+        /* [in] */ const String& actioins,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CPropertyPermissionClassObject* sCPropertyPermissionClassObject = nullptr;
+static std::atomic<CPropertyPermissionClassObject*> sCPropertyPermissionCachedClassObject(nullptr);
+static Spinlock& GetCPropertyPermissionClassObjectLock()
+{
+    static Spinlock sCPropertyPermissionClassObjectLock;
+    return sCPropertyPermissionClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CPropertyPermissionClassObject, ClassObject, ICPropertyPermissionClassObject);
+
+CPropertyPermissionClassObject::CPropertyPermissionClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CPropertyPermissionClassObject::~CPropertyPermissionClassObject()
+{
+    Spinlock& lock = GetCPropertyPermissionClassObjectLock();
+    lock.Lock();
+    sCPropertyPermissionClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CPropertyPermissionClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CPropertyPermissionClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CPropertyPermissionClassObject::CreateObject(
+    /* [in] */ const String& name,
+    /* [in] */ const String& actioins,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPropertyPermission), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPropertyPermission* _obj = new(addr) CPropertyPermission();
+    ECode ec = _obj->Constructor(name, actioins);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CPropertyPermission");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCPropertyPermissionClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCPropertyPermissionClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCPropertyPermissionClassObject == nullptr) {
+        sCPropertyPermissionClassObject = new CPropertyPermissionClassObject();
+    }
+    else if (sCPropertyPermissionClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCPropertyPermissionClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCPropertyPermissionClassObject;
+    return NOERROR;
+}
+
+static CPropertyPermissionClassObject* GetCachedCPropertyPermissionClassObject()
+{
+    CPropertyPermissionClassObject* clsObject = sCPropertyPermissionCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCPropertyPermissionClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCPropertyPermissionCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCPropertyPermissionClassObject == nullptr) {
+            sCPropertyPermissionClassObject = new CPropertyPermissionClassObject();
+        }
+        else if (sCPropertyPermissionClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCPropertyPermissionClassObject;
+        clsObject->AddRef();
+        sCPropertyPermissionCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCPropertyPermissionClassObjectCache()
+{
+    Spinlock& lock = GetCPropertyPermissionClassObjectLock();
+    lock.Lock();
+    CPropertyPermissionClassObject* clsObject = sCPropertyPermissionCachedClassObject.load(std::memory_order_relaxed);
+    sCPropertyPermissionCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CPropertyPermission::_CPropertyPermission()
+{
+    sCPropertyPermissionClassObject->AddRef();
+}
+
+_CPropertyPermission::~_CPropertyPermission()
+{
+    sCPropertyPermissionClassObject->Release();
+}
+
+ECode _CPropertyPermission::New(
+    /* [in] */ const String& name,
+    /* [in] */ const String& actioins,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPropertyPermissionClassObject* cachedClsObject = GetCachedCPropertyPermissionClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(name, actioins, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CPropertyPermission, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPropertyPermissionClassObject::Probe(clsObject)->CreateObject(name, actioins, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,47 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CPROPERTYPERMISSION_H_GEN__
+#define __CCM_UTIL_CPROPERTYPERMISSION_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const CoclassID CID_CPropertyPermission;
+
+COCLASS_ID(0ce2245f-c9d7-4a24-8fda-56ab5d38ea18)
+class _CPropertyPermission
+{
+public:
+    _CPropertyPermission();
+
+    virtual ~_CPropertyPermission();
+
+    static ECode New(
+        /* [in] */ const String& name,
+        /* [in] */ const String& actioins,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CPROPERTYPERMISSION_H_GEN__
@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CRandom.h"
+#include "ccm.util.ICRandomClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CRandomClassObject
+    : public ClassObject
+    , public ICRandomClassObject
+{
+public:
+    CRandomClassObject();
+
+    ~CRandomClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Long seed,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CRandomClassObject* sCRandomClassObject = nullptr;
+static std::atomic<CRandomClassObject*> sCRandomCachedClassObject(nullptr);
+static Spinlock& GetCRandomClassObjectLock()
+{
+    static Spinlock sCRandomClassObjectLock;
+    return sCRandomClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CRandomClassObject, ClassObject, ICRandomClassObject);
+
+CRandomClassObject::CRandomClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CRandomClassObject::~CRandomClassObject()
+{
+    Spinlock& lock = GetCRandomClassObjectLock();
+    lock.Lock();
+    sCRandomClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CRandomClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CRandomClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CRandom), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CRandom* _obj = new(addr) CRandom();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CRandom");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CRandomClassObject::CreateObject(
+    /* [in] */ Long seed,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CRandom), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CRandom* _obj = new(addr) CRandom();
+    ECode ec = _obj->Constructor(seed);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CRandom");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCRandomClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCRandomClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCRandomClassObject == nullptr) {
+        sCRandomClassObject = new CRandomClassObject();
+    }
+    else if (sCRandomClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCRandomClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCRandomClassObject;
+    return NOERROR;
+}
+
+static CRandomClassObject* GetCachedCRandomClassObject()
+{
+    CRandomClassObject* clsObject = sCRandomCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCRandomClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCRandomCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCRandomClassObject == nullptr) {
+            sCRandomClassObject = new CRandomClassObject();
+        }
+        else if (sCRandomClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCRandomClassObject;
+        clsObject->AddRef();
+        sCRandomCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCRandomClassObjectCache()
+{
+    Spinlock& lock = GetCRandomClassObjectLock();
+    lock.Lock();
+    CRandomClassObject* clsObject = sCRandomCachedClassObject.load(std::memory_order_relaxed);
+    sCRandomCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CRandom::_CRandom()
+{
+    sCRandomClassObject->AddRef();
+}
+
+_CRandom::~_CRandom()
+{
+    sCRandomClassObject->Release();
+}
+
+ECode _CRandom::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CRandomClassObject* cachedClsObject = GetCachedCRandomClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CRandom, iid, nullptr, object);
+};
+
+ECode _CRandom::New(
+    /* [in] */ Long seed,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CRandomClassObject* cachedClsObject = GetCachedCRandomClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(seed, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CRandom, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICRandomClassObject::Probe(clsObject)->CreateObject(seed, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,252 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CSimpleEntry.h"
+#include "ccm.util.ICSimpleEntryClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CSimpleEntryClassObject
+    : public ClassObject
+    , public ICSimpleEntryClassObject
+{
+public:
+    CSimpleEntryClassObject();
+
+    ~CSimpleEntryClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ ccm::IInterface* key,
+        /* [in] */ ccm::IInterface* value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::IMapEntry* entry,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CSimpleEntryClassObject* sCSimpleEntryClassObject = nullptr;
+static std::atomic<CSimpleEntryClassObject*> sCSimpleEntryCachedClassObject(nullptr);
+static Spinlock& GetCSimpleEntryClassObjectLock()
+{
+    static Spinlock sCSimpleEntryClassObjectLock;
+    return sCSimpleEntryClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CSimpleEntryClassObject, ClassObject, ICSimpleEntryClassObject);
+
+CSimpleEntryClassObject::CSimpleEntryClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CSimpleEntryClassObject::~CSimpleEntryClassObject()
+{
+    Spinlock& lock = GetCSimpleEntryClassObjectLock();
+    lock.Lock();
+    sCSimpleEntryClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CSimpleEntryClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CSimpleEntryClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CSimpleEntryClassObject::CreateObject(
+    /* [in] */ ccm::IInterface* key,
+    /* [in] */ ccm::IInterface* value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleEntry), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleEntry* _obj = new(addr) CSimpleEntry();
+    ECode ec = _obj->Constructor(key, value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CSimpleEntry");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CSimpleEntryClassObject::CreateObject(
+    /* [in] */ ccm::util::IMapEntry* entry,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleEntry), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleEntry* _obj = new(addr) CSimpleEntry();
+    ECode ec = _obj->Constructor(entry);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CSimpleEntry");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCSimpleEntryClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCSimpleEntryClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCSimpleEntryClassObject == nullptr) {
+        sCSimpleEntryClassObject = new CSimpleEntryClassObject();
+    }
+    else if (sCSimpleEntryClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCSimpleEntryClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCSimpleEntryClassObject;
+    return NOERROR;
+}
+
+static CSimpleEntryClassObject* GetCachedCSimpleEntryClassObject()
+{
+    CSimpleEntryClassObject* clsObject = sCSimpleEntryCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCSimpleEntryClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCSimpleEntryCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCSimpleEntryClassObject == nullptr) {
+            sCSimpleEntryClassObject = new CSimpleEntryClassObject();
+        }
+        else if (sCSimpleEntryClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCSimpleEntryClassObject;
+        clsObject->AddRef();
+        sCSimpleEntryCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCSimpleEntryClassObjectCache()
+{
+    Spinlock& lock = GetCSimpleEntryClassObjectLock();
+    lock.Lock();
+    CSimpleEntryClassObject* clsObject = sCSimpleEntryCachedClassObject.load(std::memory_order_relaxed);
+    sCSimpleEntryCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CSimpleEntry::_CSimpleEntry()
+{
+    sCSimpleEntryClassObject->AddRef();
+}
+
+_CSimpleEntry::~_CSimpleEntry()
+{
+    sCSimpleEntryClassObject->Release();
+}
+
+ECode _CSimpleEntry::New(
+    /* [in] */ ccm::IInterface* key,
+    /* [in] */ ccm::IInterface* value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleEntryClassObject* cachedClsObject = GetCachedCSimpleEntryClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(key, value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleEntry, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleEntryClassObject::Probe(clsObject)->CreateObject(key, value, iid, object);
+};
+
+ECode _CSimpleEntry::New(
+    /* [in] */ ccm::util::IMapEntry* entry,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleEntryClassObject* cachedClsObject = GetCachedCSimpleEntryClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(entry, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleEntry, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleEntryClassObject::Probe(clsObject)->CreateObject(entry, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,252 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CSimpleImmutableEntry.h"
+#include "ccm.util.ICSimpleImmutableEntryClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CSimpleImmutableEntryClassObject
+    : public ClassObject
+    , public ICSimpleImmutableEntryClassObject
+{
+public:
+    CSimpleImmutableEntryClassObject();
+
+    ~CSimpleImmutableEntryClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ ccm::IInterface* key,
+        /* [in] */ ccm::IInterface* value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::IMapEntry* entry,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CSimpleImmutableEntryClassObject* sCSimpleImmutableEntryClassObject = nullptr;
+static std::atomic<CSimpleImmutableEntryClassObject*> sCSimpleImmutableEntryCachedClassObject(nullptr);
+static Spinlock& GetCSimpleImmutableEntryClassObjectLock()
+{
+    static Spinlock sCSimpleImmutableEntryClassObjectLock;
+    return sCSimpleImmutableEntryClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CSimpleImmutableEntryClassObject, ClassObject, ICSimpleImmutableEntryClassObject);
+
+CSimpleImmutableEntryClassObject::CSimpleImmutableEntryClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CSimpleImmutableEntryClassObject::~CSimpleImmutableEntryClassObject()
+{
+    Spinlock& lock = GetCSimpleImmutableEntryClassObjectLock();
+    lock.Lock();
+    sCSimpleImmutableEntryClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CSimpleImmutableEntryClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CSimpleImmutableEntryClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CSimpleImmutableEntryClassObject::CreateObject(
+    /* [in] */ ccm::IInterface* key,
+    /* [in] */ ccm::IInterface* value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleImmutableEntry), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleImmutableEntry* _obj = new(addr) CSimpleImmutableEntry();
+    ECode ec = _obj->Constructor(key, value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CSimpleImmutableEntry");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CSimpleImmutableEntryClassObject::CreateObject(
+    /* [in] */ ccm::util::IMapEntry* entry,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleImmutableEntry), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleImmutableEntry* _obj = new(addr) CSimpleImmutableEntry();
+    ECode ec = _obj->Constructor(entry);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CSimpleImmutableEntry");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCSimpleImmutableEntryClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCSimpleImmutableEntryClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCSimpleImmutableEntryClassObject == nullptr) {
+        sCSimpleImmutableEntryClassObject = new CSimpleImmutableEntryClassObject();
+    }
+    else if (sCSimpleImmutableEntryClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCSimpleImmutableEntryClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCSimpleImmutableEntryClassObject;
+    return NOERROR;
+}
+
+static CSimpleImmutableEntryClassObject* GetCachedCSimpleImmutableEntryClassObject()
+{
+    CSimpleImmutableEntryClassObject* clsObject = sCSimpleImmutableEntryCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCSimpleImmutableEntryClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCSimpleImmutableEntryCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCSimpleImmutableEntryClassObject == nullptr) {
+            sCSimpleImmutableEntryClassObject = new CSimpleImmutableEntryClassObject();
+        }
+        else if (sCSimpleImmutableEntryClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCSimpleImmutableEntryClassObject;
+        clsObject->AddRef();
+        sCSimpleImmutableEntryCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCSimpleImmutableEntryClassObjectCache()
+{
+    Spinlock& lock = GetCSimpleImmutableEntryClassObjectLock();
+    lock.Lock();
+    CSimpleImmutableEntryClassObject* clsObject = sCSimpleImmutableEntryCachedClassObject.load(std::memory_order_relaxed);
+    sCSimpleImmutableEntryCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CSimpleImmutableEntry::_CSimpleImmutableEntry()
+{
+    sCSimpleImmutableEntryClassObject->AddRef();
+}
+
+_CSimpleImmutableEntry::~_CSimpleImmutableEntry()
+{
+    sCSimpleImmutableEntryClassObject->Release();
+}
+
+ECode _CSimpleImmutableEntry::New(
+    /* [in] */ ccm::IInterface* key,
+    /* [in] */ ccm::IInterface* value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleImmutableEntryClassObject* cachedClsObject = GetCachedCSimpleImmutableEntryClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(key, value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleImmutableEntry, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleImmutableEntryClassObject::Probe(clsObject)->CreateObject(key, value, iid, object);
+};
+
+ECode _CSimpleImmutableEntry::New(
+    /* [in] */ ccm::util::IMapEntry* entry,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleImmutableEntryClassObject* cachedClsObject = GetCachedCSimpleImmutableEntryClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(entry, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleImmutableEntry, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleImmutableEntryClassObject::Probe(clsObject)->CreateObject(entry, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
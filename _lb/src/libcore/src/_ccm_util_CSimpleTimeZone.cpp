@@ -0,0 +1,431 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CSimpleTimeZone.h"
+#include "ccm.util.ICSimpleTimeZoneClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CSimpleTimeZoneClassObject
+    : public ClassObject
+    , public ICSimpleTimeZoneClassObject
+{
+public:
+    CSimpleTimeZoneClassObject();
+
+    ~CSimpleTimeZoneClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Integer rawOffset,
+        /* [in] */ const String& id,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer rawOffset,
+        /* [in] */ const String& id,
+        /* [in] */ Integer startMonth,
+        /* [in] */ Integer startDay,
+        /* [in] */ Integer startDayOfWeek,
+        /* [in] */ Integer startTime,
+        /* [in] */ Integer endMonth,
+        /* [in] */ Integer endDay,
+        /* [in] */ Integer endDayOfWeek,
+        /* [in] */ Integer endTime,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer rawOffset,
+        /* [in] */ const String& id,
+        /* [in] */ Integer startMonth,
+        /* [in] */ Integer startDay,
+        /* [in] */ Integer startDayOfWeek,
+        /* [in] */ Integer startTime,
+        /* [in] */ Integer endMonth,
+        /* [in] */ Integer endDay,
+        /* [in] */ Integer endDayOfWeek,
+        /* [in] */ Integer endTime,
+        /* [in] */ Integer dstSavings,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer rawOffset,
+        /* [in] */ const String& id,
+        /* [in] */ Integer startMonth,
+        /* [in] */ Integer startDay,
+        /* [in] */ Integer startDayOfWeek,
+        /* [in] */ Integer startTime,
+        /* [in] */ Integer startTimeMode,
+        /* [in] */ Integer endMonth,
+        /* [in] */ Integer endDay,
+        /* [in] */ Integer endDayOfWeek,
+        /* [in] */ Integer endTime,
+        /* [in] */ Integer endTimeMode,
+        /* [in] */ Integer dstSavings,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CSimpleTimeZoneClassObject* sCSimpleTimeZoneClassObject = nullptr;
+static std::atomic<CSimpleTimeZoneClassObject*> sCSimpleTimeZoneCachedClassObject(nullptr);
+static Spinlock& GetCSimpleTimeZoneClassObjectLock()
+{
+    static Spinlock sCSimpleTimeZoneClassObjectLock;
+    return sCSimpleTimeZoneClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CSimpleTimeZoneClassObject, ClassObject, ICSimpleTimeZoneClassObject);
+
+CSimpleTimeZoneClassObject::CSimpleTimeZoneClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CSimpleTimeZoneClassObject::~CSimpleTimeZoneClassObject()
+{
+    Spinlock& lock = GetCSimpleTimeZoneClassObjectLock();
+    lock.Lock();
+    sCSimpleTimeZoneClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CSimpleTimeZoneClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CSimpleTimeZoneClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CSimpleTimeZoneClassObject::CreateObject(
+    /* [in] */ Integer rawOffset,
+    /* [in] */ const String& id,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleTimeZone), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleTimeZone* _obj = new(addr) CSimpleTimeZone();
+    ECode ec = _obj->Constructor(rawOffset, id);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CSimpleTimeZone");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CSimpleTimeZoneClassObject::CreateObject(
+    /* [in] */ Integer rawOffset,
+    /* [in] */ const String& id,
+    /* [in] */ Integer startMonth,
+    /* [in] */ Integer startDay,
+    /* [in] */ Integer startDayOfWeek,
+    /* [in] */ Integer startTime,
+    /* [in] */ Integer endMonth,
+    /* [in] */ Integer endDay,
+    /* [in] */ Integer endDayOfWeek,
+    /* [in] */ Integer endTime,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleTimeZone), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleTimeZone* _obj = new(addr) CSimpleTimeZone();
+    ECode ec = _obj->Constructor(rawOffset, id, startMonth, startDay, startDayOfWeek, startTime, endMonth, endDay, endDayOfWeek, endTime);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CSimpleTimeZone");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CSimpleTimeZoneClassObject::CreateObject(
+    /* [in] */ Integer rawOffset,
+    /* [in] */ const String& id,
+    /* [in] */ Integer startMonth,
+    /* [in] */ Integer startDay,
+    /* [in] */ Integer startDayOfWeek,
+    /* [in] */ Integer startTime,
+    /* [in] */ Integer endMonth,
+    /* [in] */ Integer endDay,
+    /* [in] */ Integer endDayOfWeek,
+    /* [in] */ Integer endTime,
+    /* [in] */ Integer dstSavings,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleTimeZone), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleTimeZone* _obj = new(addr) CSimpleTimeZone();
+    ECode ec = _obj->Constructor(rawOffset, id, startMonth, startDay, startDayOfWeek, startTime, endMonth, endDay, endDayOfWeek, endTime, dstSavings);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CSimpleTimeZone");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CSimpleTimeZoneClassObject::CreateObject(
+    /* [in] */ Integer rawOffset,
+    /* [in] */ const String& id,
+    /* [in] */ Integer startMonth,
+    /* [in] */ Integer startDay,
+    /* [in] */ Integer startDayOfWeek,
+    /* [in] */ Integer startTime,
+    /* [in] */ Integer startTimeMode,
+    /* [in] */ Integer endMonth,
+    /* [in] */ Integer endDay,
+    /* [in] */ Integer endDayOfWeek,
+    /* [in] */ Integer endTime,
+    /* [in] */ Integer endTimeMode,
+    /* [in] */ Integer dstSavings,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CSimpleTimeZone), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CSimpleTimeZone* _obj = new(addr) CSimpleTimeZone();
+    ECode ec = _obj->Constructor(rawOffset, id, startMonth, startDay, startDayOfWeek, startTime, startTimeMode, endMonth, endDay, endDayOfWeek, endTime, endTimeMode, dstSavings);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CSimpleTimeZone");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCSimpleTimeZoneClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCSimpleTimeZoneClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCSimpleTimeZoneClassObject == nullptr) {
+        sCSimpleTimeZoneClassObject = new CSimpleTimeZoneClassObject();
+    }
+    else if (sCSimpleTimeZoneClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCSimpleTimeZoneClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCSimpleTimeZoneClassObject;
+    return NOERROR;
+}
+
+static CSimpleTimeZoneClassObject* GetCachedCSimpleTimeZoneClassObject()
+{
+    CSimpleTimeZoneClassObject* clsObject = sCSimpleTimeZoneCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCSimpleTimeZoneClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCSimpleTimeZoneCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCSimpleTimeZoneClassObject == nullptr) {
+            sCSimpleTimeZoneClassObject = new CSimpleTimeZoneClassObject();
+        }
+        else if (sCSimpleTimeZoneClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCSimpleTimeZoneClassObject;
+        clsObject->AddRef();
+        sCSimpleTimeZoneCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCSimpleTimeZoneClassObjectCache()
+{
+    Spinlock& lock = GetCSimpleTimeZoneClassObjectLock();
+    lock.Lock();
+    CSimpleTimeZoneClassObject* clsObject = sCSimpleTimeZoneCachedClassObject.load(std::memory_order_relaxed);
+    sCSimpleTimeZoneCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CSimpleTimeZone::_CSimpleTimeZone()
+{
+    sCSimpleTimeZoneClassObject->AddRef();
+}
+
+_CSimpleTimeZone::~_CSimpleTimeZone()
+{
+    sCSimpleTimeZoneClassObject->Release();
+}
+
+ECode _CSimpleTimeZone::New(
+    /* [in] */ Integer rawOffset,
+    /* [in] */ const String& id,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleTimeZoneClassObject* cachedClsObject = GetCachedCSimpleTimeZoneClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(rawOffset, id, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleTimeZone, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleTimeZoneClassObject::Probe(clsObject)->CreateObject(rawOffset, id, iid, object);
+};
+
+ECode _CSimpleTimeZone::New(
+    /* [in] */ Integer rawOffset,
+    /* [in] */ const String& id,
+    /* [in] */ Integer startMonth,
+    /* [in] */ Integer startDay,
+    /* [in] */ Integer startDayOfWeek,
+    /* [in] */ Integer startTime,
+    /* [in] */ Integer endMonth,
+    /* [in] */ Integer endDay,
+    /* [in] */ Integer endDayOfWeek,
+    /* [in] */ Integer endTime,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleTimeZoneClassObject* cachedClsObject = GetCachedCSimpleTimeZoneClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(rawOffset, id, startMonth, startDay, startDayOfWeek, startTime, endMonth, endDay, endDayOfWeek, endTime, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleTimeZone, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleTimeZoneClassObject::Probe(clsObject)->CreateObject(rawOffset, id, startMonth, startDay, startDayOfWeek, startTime, endMonth, endDay, endDayOfWeek, endTime, iid, object);
+};
+
+ECode _CSimpleTimeZone::New(
+    /* [in] */ Integer rawOffset,
+    /* [in] */ const String& id,
+    /* [in] */ Integer startMonth,
+    /* [in] */ Integer startDay,
+    /* [in] */ Integer startDayOfWeek,
+    /* [in] */ Integer startTime,
+    /* [in] */ Integer endMonth,
+    /* [in] */ Integer endDay,
+    /* [in] */ Integer endDayOfWeek,
+    /* [in] */ Integer endTime,
+    /* [in] */ Integer dstSavings,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleTimeZoneClassObject* cachedClsObject = GetCachedCSimpleTimeZoneClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(rawOffset, id, startMonth, startDay, startDayOfWeek, startTime, endMonth, endDay, endDayOfWeek, endTime, dstSavings, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleTimeZone, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleTimeZoneClassObject::Probe(clsObject)->CreateObject(rawOffset, id, startMonth, startDay, startDayOfWeek, startTime, endMonth, endDay, endDayOfWeek, endTime, dstSavings, iid, object);
+};
+
+ECode _CSimpleTimeZone::New(
+    /* [in] */ Integer rawOffset,
+    /* [in] */ const String& id,
+    /* [in] */ Integer startMonth,
+    /* [in] */ Integer startDay,
+    /* [in] */ Integer startDayOfWeek,
+    /* [in] */ Integer startTime,
+    /* [in] */ Integer startTimeMode,
+    /* [in] */ Integer endMonth,
+    /* [in] */ Integer endDay,
+    /* [in] */ Integer endDayOfWeek,
+    /* [in] */ Integer endTime,
+    /* [in] */ Integer endTimeMode,
+    /* [in] */ Integer dstSavings,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CSimpleTimeZoneClassObject* cachedClsObject = GetCachedCSimpleTimeZoneClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(rawOffset, id, startMonth, startDay, startDayOfWeek, startTime, startTimeMode, endMonth, endDay, endDayOfWeek, endTime, endTimeMode, dstSavings, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CSimpleTimeZone, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICSimpleTimeZoneClassObject::Probe(clsObject)->CreateObject(rawOffset, id, startMonth, startDay, startDayOfWeek, startTime, startTimeMode, endMonth, endDay, endDayOfWeek, endTime, endTimeMode, dstSavings, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,301 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CStringTokenizer.h"
+#include "ccm.util.ICStringTokenizerClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CStringTokenizerClassObject
+    : public ClassObject
+    , public ICStringTokenizerClassObject
+{
+public:
+    CStringTokenizerClassObject();
+
+    ~CStringTokenizerClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& str,
+        /* [in] */ const String& delim,
+        /* [in] */ Boolean returnDelims,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& str,
+        /* [in] */ const String& delim,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const String& str,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CStringTokenizerClassObject* sCStringTokenizerClassObject = nullptr;
+static std::atomic<CStringTokenizerClassObject*> sCStringTokenizerCachedClassObject(nullptr);
+static Spinlock& GetCStringTokenizerClassObjectLock()
+{
+    static Spinlock sCStringTokenizerClassObjectLock;
+    return sCStringTokenizerClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CStringTokenizerClassObject, ClassObject, ICStringTokenizerClassObject);
+
+CStringTokenizerClassObject::CStringTokenizerClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CStringTokenizerClassObject::~CStringTokenizerClassObject()
+{
+    Spinlock& lock = GetCStringTokenizerClassObjectLock();
+    lock.Lock();
+    sCStringTokenizerClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CStringTokenizerClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CStringTokenizerClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CStringTokenizerClassObject::CreateObject(
+    /* [in] */ const String& str,
+    /* [in] */ const String& delim,
+    /* [in] */ Boolean returnDelims,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringTokenizer), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringTokenizer* _obj = new(addr) CStringTokenizer();
+    ECode ec = _obj->Constructor(str, delim, returnDelims);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CStringTokenizer");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CStringTokenizerClassObject::CreateObject(
+    /* [in] */ const String& str,
+    /* [in] */ const String& delim,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringTokenizer), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringTokenizer* _obj = new(addr) CStringTokenizer();
+    ECode ec = _obj->Constructor(str, delim);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CStringTokenizer");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CStringTokenizerClassObject::CreateObject(
+    /* [in] */ const String& str,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStringTokenizer), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStringTokenizer* _obj = new(addr) CStringTokenizer();
+    ECode ec = _obj->Constructor(str);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CStringTokenizer");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCStringTokenizerClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCStringTokenizerClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCStringTokenizerClassObject == nullptr) {
+        sCStringTokenizerClassObject = new CStringTokenizerClassObject();
+    }
+    else if (sCStringTokenizerClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCStringTokenizerClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCStringTokenizerClassObject;
+    return NOERROR;
+}
+
+static CStringTokenizerClassObject* GetCachedCStringTokenizerClassObject()
+{
+    CStringTokenizerClassObject* clsObject = sCStringTokenizerCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCStringTokenizerClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCStringTokenizerCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCStringTokenizerClassObject == nullptr) {
+            sCStringTokenizerClassObject = new CStringTokenizerClassObject();
+        }
+        else if (sCStringTokenizerClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCStringTokenizerClassObject;
+        clsObject->AddRef();
+        sCStringTokenizerCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCStringTokenizerClassObjectCache()
+{
+    Spinlock& lock = GetCStringTokenizerClassObjectLock();
+    lock.Lock();
+    CStringTokenizerClassObject* clsObject = sCStringTokenizerCachedClassObject.load(std::memory_order_relaxed);
+    sCStringTokenizerCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CStringTokenizer::_CStringTokenizer()
+{
+    sCStringTokenizerClassObject->AddRef();
+}
+
+_CStringTokenizer::~_CStringTokenizer()
+{
+    sCStringTokenizerClassObject->Release();
+}
+
+ECode _CStringTokenizer::New(
+    /* [in] */ const String& str,
+    /* [in] */ const String& delim,
+    /* [in] */ Boolean returnDelims,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringTokenizerClassObject* cachedClsObject = GetCachedCStringTokenizerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(str, delim, returnDelims, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStringTokenizer, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringTokenizerClassObject::Probe(clsObject)->CreateObject(str, delim, returnDelims, iid, object);
+};
+
+ECode _CStringTokenizer::New(
+    /* [in] */ const String& str,
+    /* [in] */ const String& delim,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringTokenizerClassObject* cachedClsObject = GetCachedCStringTokenizerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(str, delim, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStringTokenizer, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringTokenizerClassObject::Probe(clsObject)->CreateObject(str, delim, iid, object);
+};
+
+ECode _CStringTokenizer::New(
+    /* [in] */ const String& str,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStringTokenizerClassObject* cachedClsObject = GetCachedCStringTokenizerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(str, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStringTokenizer, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStringTokenizerClassObject::Probe(clsObject)->CreateObject(str, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,59 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CSTRINGTOKENIZER_H_GEN__
+#define __CCM_UTIL_CSTRINGTOKENIZER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const CoclassID CID_CStringTokenizer;
+
+COCLASS_ID(6858c0ba-e3a0-48fd-8f22-bbdc4503d83d)
+class _CStringTokenizer
+{
+public:
+    _CStringTokenizer();
+
+    virtual ~_CStringTokenizer();
+
+    static ECode New(
+        /* [in] */ const String& str,
+        /* [in] */ const String& delim,
+        /* [in] */ Boolean returnDelims,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const String& str,
+        /* [in] */ const String& delim,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ const String& str,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CSTRINGTOKENIZER_H_GEN__
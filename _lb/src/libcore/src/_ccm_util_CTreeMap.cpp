@@ -0,0 +1,316 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CTreeMap.h"
+#include "ccm.util.ICTreeMapClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CTreeMapClassObject
+    : public ClassObject
+    , public ICTreeMapClassObject
+{
+public:
+    CTreeMapClassObject();
+
+    ~CTreeMapClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::IComparator* comparator,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::IMap* m,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ISortedMap* m,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CTreeMapClassObject* sCTreeMapClassObject = nullptr;
+static std::atomic<CTreeMapClassObject*> sCTreeMapCachedClassObject(nullptr);
+static Spinlock& GetCTreeMapClassObjectLock()
+{
+    static Spinlock sCTreeMapClassObjectLock;
+    return sCTreeMapClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CTreeMapClassObject, ClassObject, ICTreeMapClassObject);
+
+CTreeMapClassObject::CTreeMapClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CTreeMapClassObject::~CTreeMapClassObject()
+{
+    Spinlock& lock = GetCTreeMapClassObjectLock();
+    lock.Lock();
+    sCTreeMapClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CTreeMapClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CTreeMapClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CTreeMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CTreeMap* _obj = new(addr) CTreeMap();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CTreeMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CTreeMapClassObject::CreateObject(
+    /* [in] */ ccm::util::IComparator* comparator,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CTreeMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CTreeMap* _obj = new(addr) CTreeMap();
+    ECode ec = _obj->Constructor(comparator);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CTreeMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CTreeMapClassObject::CreateObject(
+    /* [in] */ ccm::util::IMap* m,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CTreeMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CTreeMap* _obj = new(addr) CTreeMap();
+    ECode ec = _obj->Constructor(m);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CTreeMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CTreeMapClassObject::CreateObject(
+    /* [in] */ ccm::util::ISortedMap* m,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CTreeMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CTreeMap* _obj = new(addr) CTreeMap();
+    ECode ec = _obj->Constructor(m);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CTreeMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCTreeMapClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCTreeMapClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCTreeMapClassObject == nullptr) {
+        sCTreeMapClassObject = new CTreeMapClassObject();
+    }
+    else if (sCTreeMapClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCTreeMapClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCTreeMapClassObject;
+    return NOERROR;
+}
+
+static CTreeMapClassObject* GetCachedCTreeMapClassObject()
+{
+    CTreeMapClassObject* clsObject = sCTreeMapCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCTreeMapClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCTreeMapCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCTreeMapClassObject == nullptr) {
+            sCTreeMapClassObject = new CTreeMapClassObject();
+        }
+        else if (sCTreeMapClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCTreeMapClassObject;
+        clsObject->AddRef();
+        sCTreeMapCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCTreeMapClassObjectCache()
+{
+    Spinlock& lock = GetCTreeMapClassObjectLock();
+    lock.Lock();
+    CTreeMapClassObject* clsObject = sCTreeMapCachedClassObject.load(std::memory_order_relaxed);
+    sCTreeMapCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CTreeMap::_CTreeMap()
+{
+    sCTreeMapClassObject->AddRef();
+}
+
+_CTreeMap::~_CTreeMap()
+{
+    sCTreeMapClassObject->Release();
+}
+
+ECode _CTreeMap::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CTreeMapClassObject* cachedClsObject = GetCachedCTreeMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CTreeMap, iid, nullptr, object);
+};
+
+ECode _CTreeMap::New(
+    /* [in] */ ccm::util::IComparator* comparator,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CTreeMapClassObject* cachedClsObject = GetCachedCTreeMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(comparator, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CTreeMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICTreeMapClassObject::Probe(clsObject)->CreateObject(comparator, iid, object);
+};
+
+ECode _CTreeMap::New(
+    /* [in] */ ccm::util::IMap* m,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CTreeMapClassObject* cachedClsObject = GetCachedCTreeMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(m, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CTreeMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICTreeMapClassObject::Probe(clsObject)->CreateObject(m, iid, object);
+};
+
+ECode _CTreeMap::New(
+    /* [in] */ ccm::util::ISortedMap* m,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CTreeMapClassObject* cachedClsObject = GetCachedCTreeMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(m, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CTreeMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICTreeMapClassObject::Probe(clsObject)->CreateObject(m, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
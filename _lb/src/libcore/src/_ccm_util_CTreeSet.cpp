@@ -0,0 +1,316 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CTreeSet.h"
+#include "ccm.util.ICTreeSetClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CTreeSetClassObject
+    : public ClassObject
+    , public ICTreeSetClassObject
+{
+public:
+    CTreeSetClassObject();
+
+    ~CTreeSetClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::IComparator* comparator,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ISortedSet* s,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CTreeSetClassObject* sCTreeSetClassObject = nullptr;
+static std::atomic<CTreeSetClassObject*> sCTreeSetCachedClassObject(nullptr);
+static Spinlock& GetCTreeSetClassObjectLock()
+{
+    static Spinlock sCTreeSetClassObjectLock;
+    return sCTreeSetClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CTreeSetClassObject, ClassObject, ICTreeSetClassObject);
+
+CTreeSetClassObject::CTreeSetClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CTreeSetClassObject::~CTreeSetClassObject()
+{
+    Spinlock& lock = GetCTreeSetClassObjectLock();
+    lock.Lock();
+    sCTreeSetClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CTreeSetClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CTreeSetClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CTreeSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CTreeSet* _obj = new(addr) CTreeSet();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CTreeSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CTreeSetClassObject::CreateObject(
+    /* [in] */ ccm::util::IComparator* comparator,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CTreeSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CTreeSet* _obj = new(addr) CTreeSet();
+    ECode ec = _obj->Constructor(comparator);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CTreeSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CTreeSetClassObject::CreateObject(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CTreeSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CTreeSet* _obj = new(addr) CTreeSet();
+    ECode ec = _obj->Constructor(c);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CTreeSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CTreeSetClassObject::CreateObject(
+    /* [in] */ ccm::util::ISortedSet* s,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CTreeSet), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CTreeSet* _obj = new(addr) CTreeSet();
+    ECode ec = _obj->Constructor(s);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CTreeSet");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCTreeSetClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCTreeSetClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCTreeSetClassObject == nullptr) {
+        sCTreeSetClassObject = new CTreeSetClassObject();
+    }
+    else if (sCTreeSetClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCTreeSetClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCTreeSetClassObject;
+    return NOERROR;
+}
+
+static CTreeSetClassObject* GetCachedCTreeSetClassObject()
+{
+    CTreeSetClassObject* clsObject = sCTreeSetCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCTreeSetClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCTreeSetCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCTreeSetClassObject == nullptr) {
+            sCTreeSetClassObject = new CTreeSetClassObject();
+        }
+        else if (sCTreeSetClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCTreeSetClassObject;
+        clsObject->AddRef();
+        sCTreeSetCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCTreeSetClassObjectCache()
+{
+    Spinlock& lock = GetCTreeSetClassObjectLock();
+    lock.Lock();
+    CTreeSetClassObject* clsObject = sCTreeSetCachedClassObject.load(std::memory_order_relaxed);
+    sCTreeSetCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CTreeSet::_CTreeSet()
+{
+    sCTreeSetClassObject->AddRef();
+}
+
+_CTreeSet::~_CTreeSet()
+{
+    sCTreeSetClassObject->Release();
+}
+
+ECode _CTreeSet::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CTreeSetClassObject* cachedClsObject = GetCachedCTreeSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CTreeSet, iid, nullptr, object);
+};
+
+ECode _CTreeSet::New(
+    /* [in] */ ccm::util::IComparator* comparator,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CTreeSetClassObject* cachedClsObject = GetCachedCTreeSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(comparator, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CTreeSet, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICTreeSetClassObject::Probe(clsObject)->CreateObject(comparator, iid, object);
+};
+
+ECode _CTreeSet::New(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CTreeSetClassObject* cachedClsObject = GetCachedCTreeSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(c, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CTreeSet, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICTreeSetClassObject::Probe(clsObject)->CreateObject(c, iid, object);
+};
+
+ECode _CTreeSet::New(
+    /* [in] */ ccm::util::ISortedSet* s,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CTreeSetClassObject* cachedClsObject = GetCachedCTreeSetClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(s, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CTreeSet, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICTreeSetClassObject::Probe(clsObject)->CreateObject(s, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,319 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CVector.h"
+#include "ccm.util.ICVectorClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+class CVectorClassObject
+    : public ClassObject
+    , public ICVectorClassObject
+{
+public:
+    CVectorClassObject();
+
+    ~CVectorClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ Integer capacityIncrement,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CVectorClassObject* sCVectorClassObject = nullptr;
+static std::atomic<CVectorClassObject*> sCVectorCachedClassObject(nullptr);
+static Spinlock& GetCVectorClassObjectLock()
+{
+    static Spinlock sCVectorClassObjectLock;
+    return sCVectorClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CVectorClassObject, ClassObject, ICVectorClassObject);
+
+CVectorClassObject::CVectorClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CVectorClassObject::~CVectorClassObject()
+{
+    Spinlock& lock = GetCVectorClassObjectLock();
+    lock.Lock();
+    sCVectorClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CVectorClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CVectorClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CVector), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CVector* _obj = new(addr) CVector();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CVector");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CVectorClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CVector), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CVector* _obj = new(addr) CVector();
+    ECode ec = _obj->Constructor(initialCapacity);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CVector");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CVectorClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Integer capacityIncrement,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CVector), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CVector* _obj = new(addr) CVector();
+    ECode ec = _obj->Constructor(initialCapacity, capacityIncrement);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CVector");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CVectorClassObject::CreateObject(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CVector), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CVector* _obj = new(addr) CVector();
+    ECode ec = _obj->Constructor(c);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::CVector");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCVectorClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCVectorClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCVectorClassObject == nullptr) {
+        sCVectorClassObject = new CVectorClassObject();
+    }
+    else if (sCVectorClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCVectorClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCVectorClassObject;
+    return NOERROR;
+}
+
+static CVectorClassObject* GetCachedCVectorClassObject()
+{
+    CVectorClassObject* clsObject = sCVectorCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCVectorClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCVectorCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCVectorClassObject == nullptr) {
+            sCVectorClassObject = new CVectorClassObject();
+        }
+        else if (sCVectorClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCVectorClassObject;
+        clsObject->AddRef();
+        sCVectorCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCVectorClassObjectCache()
+{
+    Spinlock& lock = GetCVectorClassObjectLock();
+    lock.Lock();
+    CVectorClassObject* clsObject = sCVectorCachedClassObject.load(std::memory_order_relaxed);
+    sCVectorCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CVector::_CVector()
+{
+    sCVectorClassObject->AddRef();
+}
+
+_CVector::~_CVector()
+{
+    sCVectorClassObject->Release();
+}
+
+ECode _CVector::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CVectorClassObject* cachedClsObject = GetCachedCVectorClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CVector, iid, nullptr, object);
+};
+
+ECode _CVector::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CVectorClassObject* cachedClsObject = GetCachedCVectorClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CVector, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICVectorClassObject::Probe(clsObject)->CreateObject(initialCapacity, iid, object);
+};
+
+ECode _CVector::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Integer capacityIncrement,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CVectorClassObject* cachedClsObject = GetCachedCVectorClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, capacityIncrement, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CVector, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICVectorClassObject::Probe(clsObject)->CreateObject(initialCapacity, capacityIncrement, iid, object);
+};
+
+ECode _CVector::New(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CVectorClassObject* cachedClsObject = GetCachedCVectorClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(c, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CVector, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICVectorClassObject::Probe(clsObject)->CreateObject(c, iid, object);
+};
+
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,217 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CEra.h"
+#include "ccm.util.calendar.ICEraClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+class CEraClassObject
+    : public ClassObject
+    , public ICEraClassObject
+{
+public:
+    CEraClassObject();
+
+    ~CEraClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& name,
+        /* [in] */ const String& abbr,
+        /* [in] */ Long since,
+        /* [in] */ Boolean localTime,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CEraClassObject* sCEraClassObject = nullptr;
+static std::atomic<CEraClassObject*> sCEraCachedClassObject(nullptr);
+static Spinlock& GetCEraClassObjectLock()
+{
+    static Spinlock sCEraClassObjectLock;
+    return sCEraClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CEraClassObject, ClassObject, ICEraClassObject);
+
+CEraClassObject::CEraClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CEraClassObject::~CEraClassObject()
+{
+    Spinlock& lock = GetCEraClassObjectLock();
+    lock.Lock();
+    sCEraClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CEraClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CEraClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CEraClassObject::CreateObject(
+    /* [in] */ const String& name,
+    /* [in] */ const String& abbr,
+    /* [in] */ Long since,
+    /* [in] */ Boolean localTime,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CEra), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CEra* _obj = new(addr) CEra();
+    ECode ec = _obj->Constructor(name, abbr, since, localTime);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::calendar::CEra");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCEraClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCEraClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCEraClassObject == nullptr) {
+        sCEraClassObject = new CEraClassObject();
+    }
+    else if (sCEraClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCEraClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCEraClassObject;
+    return NOERROR;
+}
+
+static CEraClassObject* GetCachedCEraClassObject()
+{
+    CEraClassObject* clsObject = sCEraCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCEraClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCEraCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCEraClassObject == nullptr) {
+            sCEraClassObject = new CEraClassObject();
+        }
+        else if (sCEraClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCEraClassObject;
+        clsObject->AddRef();
+        sCEraCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCEraClassObjectCache()
+{
+    Spinlock& lock = GetCEraClassObjectLock();
+    lock.Lock();
+    CEraClassObject* clsObject = sCEraCachedClassObject.load(std::memory_order_relaxed);
+    sCEraCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CEra::_CEra()
+{
+    sCEraClassObject->AddRef();
+}
+
+_CEra::~_CEra()
+{
+    sCEraClassObject->Release();
+}
+
+ECode _CEra::New(
+    /* [in] */ const String& name,
+    /* [in] */ const String& abbr,
+    /* [in] */ Long since,
+    /* [in] */ Boolean localTime,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CEraClassObject* cachedClsObject = GetCachedCEraClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(name, abbr, since, localTime, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CEra, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICEraClassObject::Probe(clsObject)->CreateObject(name, abbr, since, localTime, iid, object);
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
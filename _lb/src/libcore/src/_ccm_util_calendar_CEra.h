@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CALENDAR_CERA_H_GEN__
+#define __CCM_UTIL_CALENDAR_CERA_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+extern const CoclassID CID_CEra;
+
+COCLASS_ID(40eab8b9-84da-4399-a171-ce260a17204a)
+class _CEra
+{
+public:
+    _CEra();
+
+    virtual ~_CEra();
+
+    static ECode New(
+        /* [in] */ const String& name,
+        /* [in] */ const String& abbr,
+        /* [in] */ Long since,
+        /* [in] */ Boolean localTime,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CALENDAR_CERA_H_GEN__
@@ -0,0 +1,183 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CGregorian.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+class CGregorianClassObject
+    : public ClassObject
+{
+public:
+    CGregorianClassObject();
+
+    ~CGregorianClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CGregorianClassObject* sCGregorianClassObject = nullptr;
+static std::atomic<CGregorianClassObject*> sCGregorianCachedClassObject(nullptr);
+static Spinlock& GetCGregorianClassObjectLock()
+{
+    static Spinlock sCGregorianClassObjectLock;
+    return sCGregorianClassObjectLock;
+}
+
+CGregorianClassObject::CGregorianClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CGregorianClassObject::~CGregorianClassObject()
+{
+    Spinlock& lock = GetCGregorianClassObjectLock();
+    lock.Lock();
+    sCGregorianClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CGregorianClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CGregorianClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CGregorian), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CGregorian* _obj = new(addr) CGregorian();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::calendar::CGregorian");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCGregorianClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCGregorianClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCGregorianClassObject == nullptr) {
+        sCGregorianClassObject = new CGregorianClassObject();
+    }
+    else if (sCGregorianClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCGregorianClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCGregorianClassObject;
+    return NOERROR;
+}
+
+static CGregorianClassObject* GetCachedCGregorianClassObject()
+{
+    CGregorianClassObject* clsObject = sCGregorianCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCGregorianClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCGregorianCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCGregorianClassObject == nullptr) {
+            sCGregorianClassObject = new CGregorianClassObject();
+        }
+        else if (sCGregorianClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCGregorianClassObject;
+        clsObject->AddRef();
+        sCGregorianCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCGregorianClassObjectCache()
+{
+    Spinlock& lock = GetCGregorianClassObjectLock();
+    lock.Lock();
+    CGregorianClassObject* clsObject = sCGregorianCachedClassObject.load(std::memory_order_relaxed);
+    sCGregorianCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CGregorian::_CGregorian()
+{
+    sCGregorianClassObject->AddRef();
+}
+
+_CGregorian::~_CGregorian()
+{
+    sCGregorianClassObject->Release();
+}
+
+ECode _CGregorian::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CGregorianClassObject* cachedClsObject = GetCachedCGregorianClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CGregorian, iid, nullptr, object);
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,47 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CALENDAR_CGREGORIAN_H_GEN__
+#define __CCM_UTIL_CALENDAR_CGREGORIAN_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+extern const CoclassID CID_CGregorian;
+
+COCLASS_ID(f726de31-d4f4-440b-b8a5-dfb25fea88d2)
+class _CGregorian
+{
+public:
+    _CGregorian();
+
+    virtual ~_CGregorian();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CALENDAR_CGREGORIAN_H_GEN__
@@ -0,0 +1,183 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CJulianCalendar.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+class CJulianCalendarClassObject
+    : public ClassObject
+{
+public:
+    CJulianCalendarClassObject();
+
+    ~CJulianCalendarClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CJulianCalendarClassObject* sCJulianCalendarClassObject = nullptr;
+static std::atomic<CJulianCalendarClassObject*> sCJulianCalendarCachedClassObject(nullptr);
+static Spinlock& GetCJulianCalendarClassObjectLock()
+{
+    static Spinlock sCJulianCalendarClassObjectLock;
+    return sCJulianCalendarClassObjectLock;
+}
+
+CJulianCalendarClassObject::CJulianCalendarClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CJulianCalendarClassObject::~CJulianCalendarClassObject()
+{
+    Spinlock& lock = GetCJulianCalendarClassObjectLock();
+    lock.Lock();
+    sCJulianCalendarClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CJulianCalendarClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CJulianCalendarClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CJulianCalendar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CJulianCalendar* _obj = new(addr) CJulianCalendar();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::calendar::CJulianCalendar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCJulianCalendarClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCJulianCalendarClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCJulianCalendarClassObject == nullptr) {
+        sCJulianCalendarClassObject = new CJulianCalendarClassObject();
+    }
+    else if (sCJulianCalendarClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCJulianCalendarClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCJulianCalendarClassObject;
+    return NOERROR;
+}
+
+static CJulianCalendarClassObject* GetCachedCJulianCalendarClassObject()
+{
+    CJulianCalendarClassObject* clsObject = sCJulianCalendarCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCJulianCalendarClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCJulianCalendarCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCJulianCalendarClassObject == nullptr) {
+            sCJulianCalendarClassObject = new CJulianCalendarClassObject();
+        }
+        else if (sCJulianCalendarClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCJulianCalendarClassObject;
+        clsObject->AddRef();
+        sCJulianCalendarCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCJulianCalendarClassObjectCache()
+{
+    Spinlock& lock = GetCJulianCalendarClassObjectLock();
+    lock.Lock();
+    CJulianCalendarClassObject* clsObject = sCJulianCalendarCachedClassObject.load(std::memory_order_relaxed);
+    sCJulianCalendarCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CJulianCalendar::_CJulianCalendar()
+{
+    sCJulianCalendarClassObject->AddRef();
+}
+
+_CJulianCalendar::~_CJulianCalendar()
+{
+    sCJulianCalendarClassObject->Release();
+}
+
+ECode _CJulianCalendar::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CJulianCalendarClassObject* cachedClsObject = GetCachedCJulianCalendarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CJulianCalendar, iid, nullptr, object);
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
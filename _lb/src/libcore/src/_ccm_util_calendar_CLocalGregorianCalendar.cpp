@@ -0,0 +1,211 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CLocalGregorianCalendar.h"
+#include "ccm.util.calendar.ICLocalGregorianCalendarClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+class CLocalGregorianCalendarClassObject
+    : public ClassObject
+    , public ICLocalGregorianCalendarClassObject
+{
+public:
+    CLocalGregorianCalendarClassObject();
+
+    ~CLocalGregorianCalendarClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& name,
+        /* [in] */ const Array<ccm::util::calendar::IEra*>& eras,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CLocalGregorianCalendarClassObject* sCLocalGregorianCalendarClassObject = nullptr;
+static std::atomic<CLocalGregorianCalendarClassObject*> sCLocalGregorianCalendarCachedClassObject(nullptr);
+static Spinlock& GetCLocalGregorianCalendarClassObjectLock()
+{
+    static Spinlock sCLocalGregorianCalendarClassObjectLock;
+    return sCLocalGregorianCalendarClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CLocalGregorianCalendarClassObject, ClassObject, ICLocalGregorianCalendarClassObject);
+
+CLocalGregorianCalendarClassObject::CLocalGregorianCalendarClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CLocalGregorianCalendarClassObject::~CLocalGregorianCalendarClassObject()
+{
+    Spinlock& lock = GetCLocalGregorianCalendarClassObjectLock();
+    lock.Lock();
+    sCLocalGregorianCalendarClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CLocalGregorianCalendarClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CLocalGregorianCalendarClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CLocalGregorianCalendarClassObject::CreateObject(
+    /* [in] */ const String& name,
+    /* [in] */ const Array<ccm::util::calendar::IEra*>& eras,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLocalGregorianCalendar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLocalGregorianCalendar* _obj = new(addr) CLocalGregorianCalendar();
+    ECode ec = _obj->Constructor(name, eras);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::calendar::CLocalGregorianCalendar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCLocalGregorianCalendarClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCLocalGregorianCalendarClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCLocalGregorianCalendarClassObject == nullptr) {
+        sCLocalGregorianCalendarClassObject = new CLocalGregorianCalendarClassObject();
+    }
+    else if (sCLocalGregorianCalendarClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCLocalGregorianCalendarClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCLocalGregorianCalendarClassObject;
+    return NOERROR;
+}
+
+static CLocalGregorianCalendarClassObject* GetCachedCLocalGregorianCalendarClassObject()
+{
+    CLocalGregorianCalendarClassObject* clsObject = sCLocalGregorianCalendarCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCLocalGregorianCalendarClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCLocalGregorianCalendarCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCLocalGregorianCalendarClassObject == nullptr) {
+            sCLocalGregorianCalendarClassObject = new CLocalGregorianCalendarClassObject();
+        }
+        else if (sCLocalGregorianCalendarClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCLocalGregorianCalendarClassObject;
+        clsObject->AddRef();
+        sCLocalGregorianCalendarCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCLocalGregorianCalendarClassObjectCache()
+{
+    Spinlock& lock = GetCLocalGregorianCalendarClassObjectLock();
+    lock.Lock();
+    CLocalGregorianCalendarClassObject* clsObject = sCLocalGregorianCalendarCachedClassObject.load(std::memory_order_relaxed);
+    sCLocalGregorianCalendarCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CLocalGregorianCalendar::_CLocalGregorianCalendar()
+{
+    sCLocalGregorianCalendarClassObject->AddRef();
+}
+
+_CLocalGregorianCalendar::~_CLocalGregorianCalendar()
+{
+    sCLocalGregorianCalendarClassObject->Release();
+}
+
+ECode _CLocalGregorianCalendar::New(
+    /* [in] */ const String& name,
+    /* [in] */ const Array<ccm::util::calendar::IEra*>& eras,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLocalGregorianCalendarClassObject* cachedClsObject = GetCachedCLocalGregorianCalendarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(name, eras, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CLocalGregorianCalendar, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICLocalGregorianCalendarClassObject::Probe(clsObject)->CreateObject(name, eras, iid, object);
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
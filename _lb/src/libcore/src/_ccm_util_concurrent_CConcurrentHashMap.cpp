@@ -0,0 +1,370 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CConcurrentHashMap.h"
+#include "ccm.util.concurrent.ICConcurrentHashMapClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+
+class CConcurrentHashMapClassObject
+    : public ClassObject
+    , public ICConcurrentHashMapClassObject
+{
+public:
+    CConcurrentHashMapClassObject();
+
+    ~CConcurrentHashMapClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ Float loadFactor,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialCapacity,
+        /* [in] */ Float loadFactor,
+        /* [in] */ Integer concurrencyLevel,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::IMap* m,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CConcurrentHashMapClassObject* sCConcurrentHashMapClassObject = nullptr;
+static std::atomic<CConcurrentHashMapClassObject*> sCConcurrentHashMapCachedClassObject(nullptr);
+static Spinlock& GetCConcurrentHashMapClassObjectLock()
+{
+    static Spinlock sCConcurrentHashMapClassObjectLock;
+    return sCConcurrentHashMapClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CConcurrentHashMapClassObject, ClassObject, ICConcurrentHashMapClassObject);
+
+CConcurrentHashMapClassObject::CConcurrentHashMapClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CConcurrentHashMapClassObject::~CConcurrentHashMapClassObject()
+{
+    Spinlock& lock = GetCConcurrentHashMapClassObjectLock();
+    lock.Lock();
+    sCConcurrentHashMapClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CConcurrentHashMapClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CConcurrentHashMapClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CConcurrentHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CConcurrentHashMap* _obj = new(addr) CConcurrentHashMap();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::CConcurrentHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CConcurrentHashMapClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CConcurrentHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CConcurrentHashMap* _obj = new(addr) CConcurrentHashMap();
+    ECode ec = _obj->Constructor(initialCapacity);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::CConcurrentHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CConcurrentHashMapClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CConcurrentHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CConcurrentHashMap* _obj = new(addr) CConcurrentHashMap();
+    ECode ec = _obj->Constructor(initialCapacity, loadFactor);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::CConcurrentHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CConcurrentHashMapClassObject::CreateObject(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ Integer concurrencyLevel,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CConcurrentHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CConcurrentHashMap* _obj = new(addr) CConcurrentHashMap();
+    ECode ec = _obj->Constructor(initialCapacity, loadFactor, concurrencyLevel);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::CConcurrentHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CConcurrentHashMapClassObject::CreateObject(
+    /* [in] */ ccm::util::IMap* m,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CConcurrentHashMap), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CConcurrentHashMap* _obj = new(addr) CConcurrentHashMap();
+    ECode ec = _obj->Constructor(m);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::CConcurrentHashMap");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCConcurrentHashMapClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCConcurrentHashMapClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCConcurrentHashMapClassObject == nullptr) {
+        sCConcurrentHashMapClassObject = new CConcurrentHashMapClassObject();
+    }
+    else if (sCConcurrentHashMapClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCConcurrentHashMapClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCConcurrentHashMapClassObject;
+    return NOERROR;
+}
+
+static CConcurrentHashMapClassObject* GetCachedCConcurrentHashMapClassObject()
+{
+    CConcurrentHashMapClassObject* clsObject = sCConcurrentHashMapCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCConcurrentHashMapClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCConcurrentHashMapCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCConcurrentHashMapClassObject == nullptr) {
+            sCConcurrentHashMapClassObject = new CConcurrentHashMapClassObject();
+        }
+        else if (sCConcurrentHashMapClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCConcurrentHashMapClassObject;
+        clsObject->AddRef();
+        sCConcurrentHashMapCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCConcurrentHashMapClassObjectCache()
+{
+    Spinlock& lock = GetCConcurrentHashMapClassObjectLock();
+    lock.Lock();
+    CConcurrentHashMapClassObject* clsObject = sCConcurrentHashMapCachedClassObject.load(std::memory_order_relaxed);
+    sCConcurrentHashMapCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CConcurrentHashMap::_CConcurrentHashMap()
+{
+    sCConcurrentHashMapClassObject->AddRef();
+}
+
+_CConcurrentHashMap::~_CConcurrentHashMap()
+{
+    sCConcurrentHashMapClassObject->Release();
+}
+
+ECode _CConcurrentHashMap::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CConcurrentHashMapClassObject* cachedClsObject = GetCachedCConcurrentHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CConcurrentHashMap, iid, nullptr, object);
+};
+
+ECode _CConcurrentHashMap::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CConcurrentHashMapClassObject* cachedClsObject = GetCachedCConcurrentHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CConcurrentHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICConcurrentHashMapClassObject::Probe(clsObject)->CreateObject(initialCapacity, iid, object);
+};
+
+ECode _CConcurrentHashMap::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CConcurrentHashMapClassObject* cachedClsObject = GetCachedCConcurrentHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, loadFactor, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CConcurrentHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICConcurrentHashMapClassObject::Probe(clsObject)->CreateObject(initialCapacity, loadFactor, iid, object);
+};
+
+ECode _CConcurrentHashMap::New(
+    /* [in] */ Integer initialCapacity,
+    /* [in] */ Float loadFactor,
+    /* [in] */ Integer concurrencyLevel,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CConcurrentHashMapClassObject* cachedClsObject = GetCachedCConcurrentHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialCapacity, loadFactor, concurrencyLevel, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CConcurrentHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICConcurrentHashMapClassObject::Probe(clsObject)->CreateObject(initialCapacity, loadFactor, concurrencyLevel, iid, object);
+};
+
+ECode _CConcurrentHashMap::New(
+    /* [in] */ ccm::util::IMap* m,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CConcurrentHashMapClassObject* cachedClsObject = GetCachedCConcurrentHashMapClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(m, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CConcurrentHashMap, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICConcurrentHashMapClassObject::Probe(clsObject)->CreateObject(m, iid, object);
+};
+
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
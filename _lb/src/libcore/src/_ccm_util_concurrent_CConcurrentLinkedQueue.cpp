@@ -0,0 +1,232 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CConcurrentLinkedQueue.h"
+#include "ccm.util.concurrent.ICConcurrentLinkedQueueClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+
+class CConcurrentLinkedQueueClassObject
+    : public ClassObject
+    , public ICConcurrentLinkedQueueClassObject
+{
+public:
+    CConcurrentLinkedQueueClassObject();
+
+    ~CConcurrentLinkedQueueClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CConcurrentLinkedQueueClassObject* sCConcurrentLinkedQueueClassObject = nullptr;
+static std::atomic<CConcurrentLinkedQueueClassObject*> sCConcurrentLinkedQueueCachedClassObject(nullptr);
+static Spinlock& GetCConcurrentLinkedQueueClassObjectLock()
+{
+    static Spinlock sCConcurrentLinkedQueueClassObjectLock;
+    return sCConcurrentLinkedQueueClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CConcurrentLinkedQueueClassObject, ClassObject, ICConcurrentLinkedQueueClassObject);
+
+CConcurrentLinkedQueueClassObject::CConcurrentLinkedQueueClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CConcurrentLinkedQueueClassObject::~CConcurrentLinkedQueueClassObject()
+{
+    Spinlock& lock = GetCConcurrentLinkedQueueClassObjectLock();
+    lock.Lock();
+    sCConcurrentLinkedQueueClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CConcurrentLinkedQueueClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CConcurrentLinkedQueueClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CConcurrentLinkedQueue), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CConcurrentLinkedQueue* _obj = new(addr) CConcurrentLinkedQueue();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::CConcurrentLinkedQueue");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CConcurrentLinkedQueueClassObject::CreateObject(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CConcurrentLinkedQueue), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CConcurrentLinkedQueue* _obj = new(addr) CConcurrentLinkedQueue();
+    ECode ec = _obj->Constructor(c);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::CConcurrentLinkedQueue");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCConcurrentLinkedQueueClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCConcurrentLinkedQueueClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCConcurrentLinkedQueueClassObject == nullptr) {
+        sCConcurrentLinkedQueueClassObject = new CConcurrentLinkedQueueClassObject();
+    }
+    else if (sCConcurrentLinkedQueueClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCConcurrentLinkedQueueClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCConcurrentLinkedQueueClassObject;
+    return NOERROR;
+}
+
+static CConcurrentLinkedQueueClassObject* GetCachedCConcurrentLinkedQueueClassObject()
+{
+    CConcurrentLinkedQueueClassObject* clsObject = sCConcurrentLinkedQueueCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCConcurrentLinkedQueueClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCConcurrentLinkedQueueCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCConcurrentLinkedQueueClassObject == nullptr) {
+            sCConcurrentLinkedQueueClassObject = new CConcurrentLinkedQueueClassObject();
+        }
+        else if (sCConcurrentLinkedQueueClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCConcurrentLinkedQueueClassObject;
+        clsObject->AddRef();
+        sCConcurrentLinkedQueueCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCConcurrentLinkedQueueClassObjectCache()
+{
+    Spinlock& lock = GetCConcurrentLinkedQueueClassObjectLock();
+    lock.Lock();
+    CConcurrentLinkedQueueClassObject* clsObject = sCConcurrentLinkedQueueCachedClassObject.load(std::memory_order_relaxed);
+    sCConcurrentLinkedQueueCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CConcurrentLinkedQueue::_CConcurrentLinkedQueue()
+{
+    sCConcurrentLinkedQueueClassObject->AddRef();
+}
+
+_CConcurrentLinkedQueue::~_CConcurrentLinkedQueue()
+{
+    sCConcurrentLinkedQueueClassObject->Release();
+}
+
+ECode _CConcurrentLinkedQueue::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CConcurrentLinkedQueueClassObject* cachedClsObject = GetCachedCConcurrentLinkedQueueClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CConcurrentLinkedQueue, iid, nullptr, object);
+};
+
+ECode _CConcurrentLinkedQueue::New(
+    /* [in] */ ccm::util::ICollection* c,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CConcurrentLinkedQueueClassObject* cachedClsObject = GetCachedCConcurrentLinkedQueueClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(c, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CConcurrentLinkedQueue, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICConcurrentLinkedQueueClassObject::Probe(clsObject)->CreateObject(c, iid, object);
+};
+
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,52 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CONCURRENT_CCONCURRENTLINKEDQUEUE_H_GEN__
+#define __CCM_UTIL_CONCURRENT_CCONCURRENTLINKEDQUEUE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+
+extern const CoclassID CID_CConcurrentLinkedQueue;
+
+COCLASS_ID(eb235f4e-904f-4534-97a8-e5a70cee8846)
+class _CConcurrentLinkedQueue
+{
+public:
+    _CConcurrentLinkedQueue();
+
+    virtual ~_CConcurrentLinkedQueue();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CONCURRENT_CCONCURRENTLINKEDQUEUE_H_GEN__
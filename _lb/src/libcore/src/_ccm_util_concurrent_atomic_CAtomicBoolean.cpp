@@ -0,0 +1,234 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CAtomicBoolean.h"
+#include "ccm.util.concurrent.atomic.ICAtomicBooleanClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+namespace atomic {
+
+class CAtomicBooleanClassObject
+    : public ClassObject
+    , public ICAtomicBooleanClassObject
+{
+public:
+    CAtomicBooleanClassObject();
+
+    ~CAtomicBooleanClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Boolean initialValue,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CAtomicBooleanClassObject* sCAtomicBooleanClassObject = nullptr;
+static std::atomic<CAtomicBooleanClassObject*> sCAtomicBooleanCachedClassObject(nullptr);
+static Spinlock& GetCAtomicBooleanClassObjectLock()
+{
+    static Spinlock sCAtomicBooleanClassObjectLock;
+    return sCAtomicBooleanClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CAtomicBooleanClassObject, ClassObject, ICAtomicBooleanClassObject);
+
+CAtomicBooleanClassObject::CAtomicBooleanClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CAtomicBooleanClassObject::~CAtomicBooleanClassObject()
+{
+    Spinlock& lock = GetCAtomicBooleanClassObjectLock();
+    lock.Lock();
+    sCAtomicBooleanClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CAtomicBooleanClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CAtomicBooleanClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAtomicBoolean), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAtomicBoolean* _obj = new(addr) CAtomicBoolean();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::atomic::CAtomicBoolean");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CAtomicBooleanClassObject::CreateObject(
+    /* [in] */ Boolean initialValue,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAtomicBoolean), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAtomicBoolean* _obj = new(addr) CAtomicBoolean();
+    ECode ec = _obj->Constructor(initialValue);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::atomic::CAtomicBoolean");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCAtomicBooleanClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCAtomicBooleanClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCAtomicBooleanClassObject == nullptr) {
+        sCAtomicBooleanClassObject = new CAtomicBooleanClassObject();
+    }
+    else if (sCAtomicBooleanClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCAtomicBooleanClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCAtomicBooleanClassObject;
+    return NOERROR;
+}
+
+static CAtomicBooleanClassObject* GetCachedCAtomicBooleanClassObject()
+{
+    CAtomicBooleanClassObject* clsObject = sCAtomicBooleanCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCAtomicBooleanClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCAtomicBooleanCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCAtomicBooleanClassObject == nullptr) {
+            sCAtomicBooleanClassObject = new CAtomicBooleanClassObject();
+        }
+        else if (sCAtomicBooleanClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCAtomicBooleanClassObject;
+        clsObject->AddRef();
+        sCAtomicBooleanCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCAtomicBooleanClassObjectCache()
+{
+    Spinlock& lock = GetCAtomicBooleanClassObjectLock();
+    lock.Lock();
+    CAtomicBooleanClassObject* clsObject = sCAtomicBooleanCachedClassObject.load(std::memory_order_relaxed);
+    sCAtomicBooleanCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CAtomicBoolean::_CAtomicBoolean()
+{
+    sCAtomicBooleanClassObject->AddRef();
+}
+
+_CAtomicBoolean::~_CAtomicBoolean()
+{
+    sCAtomicBooleanClassObject->Release();
+}
+
+ECode _CAtomicBoolean::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAtomicBooleanClassObject* cachedClsObject = GetCachedCAtomicBooleanClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CAtomicBoolean, iid, nullptr, object);
+};
+
+ECode _CAtomicBoolean::New(
+    /* [in] */ Boolean initialValue,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAtomicBooleanClassObject* cachedClsObject = GetCachedCAtomicBooleanClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialValue, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CAtomicBoolean, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICAtomicBooleanClassObject::Probe(clsObject)->CreateObject(initialValue, iid, object);
+};
+
+} // namespace atomic
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
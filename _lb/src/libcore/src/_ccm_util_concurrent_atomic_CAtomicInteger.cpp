@@ -0,0 +1,234 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CAtomicInteger.h"
+#include "ccm.util.concurrent.atomic.ICAtomicIntegerClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+namespace atomic {
+
+class CAtomicIntegerClassObject
+    : public ClassObject
+    , public ICAtomicIntegerClassObject
+{
+public:
+    CAtomicIntegerClassObject();
+
+    ~CAtomicIntegerClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Integer initialValue,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CAtomicIntegerClassObject* sCAtomicIntegerClassObject = nullptr;
+static std::atomic<CAtomicIntegerClassObject*> sCAtomicIntegerCachedClassObject(nullptr);
+static Spinlock& GetCAtomicIntegerClassObjectLock()
+{
+    static Spinlock sCAtomicIntegerClassObjectLock;
+    return sCAtomicIntegerClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CAtomicIntegerClassObject, ClassObject, ICAtomicIntegerClassObject);
+
+CAtomicIntegerClassObject::CAtomicIntegerClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CAtomicIntegerClassObject::~CAtomicIntegerClassObject()
+{
+    Spinlock& lock = GetCAtomicIntegerClassObjectLock();
+    lock.Lock();
+    sCAtomicIntegerClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CAtomicIntegerClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CAtomicIntegerClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAtomicInteger), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAtomicInteger* _obj = new(addr) CAtomicInteger();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::atomic::CAtomicInteger");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CAtomicIntegerClassObject::CreateObject(
+    /* [in] */ Integer initialValue,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAtomicInteger), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAtomicInteger* _obj = new(addr) CAtomicInteger();
+    ECode ec = _obj->Constructor(initialValue);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::atomic::CAtomicInteger");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCAtomicIntegerClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCAtomicIntegerClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCAtomicIntegerClassObject == nullptr) {
+        sCAtomicIntegerClassObject = new CAtomicIntegerClassObject();
+    }
+    else if (sCAtomicIntegerClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCAtomicIntegerClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCAtomicIntegerClassObject;
+    return NOERROR;
+}
+
+static CAtomicIntegerClassObject* GetCachedCAtomicIntegerClassObject()
+{
+    CAtomicIntegerClassObject* clsObject = sCAtomicIntegerCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCAtomicIntegerClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCAtomicIntegerCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCAtomicIntegerClassObject == nullptr) {
+            sCAtomicIntegerClassObject = new CAtomicIntegerClassObject();
+        }
+        else if (sCAtomicIntegerClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCAtomicIntegerClassObject;
+        clsObject->AddRef();
+        sCAtomicIntegerCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCAtomicIntegerClassObjectCache()
+{
+    Spinlock& lock = GetCAtomicIntegerClassObjectLock();
+    lock.Lock();
+    CAtomicIntegerClassObject* clsObject = sCAtomicIntegerCachedClassObject.load(std::memory_order_relaxed);
+    sCAtomicIntegerCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CAtomicInteger::_CAtomicInteger()
+{
+    sCAtomicIntegerClassObject->AddRef();
+}
+
+_CAtomicInteger::~_CAtomicInteger()
+{
+    sCAtomicIntegerClassObject->Release();
+}
+
+ECode _CAtomicInteger::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAtomicIntegerClassObject* cachedClsObject = GetCachedCAtomicIntegerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CAtomicInteger, iid, nullptr, object);
+};
+
+ECode _CAtomicInteger::New(
+    /* [in] */ Integer initialValue,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAtomicIntegerClassObject* cachedClsObject = GetCachedCAtomicIntegerClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialValue, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CAtomicInteger, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICAtomicIntegerClassObject::Probe(clsObject)->CreateObject(initialValue, iid, object);
+};
+
+} // namespace atomic
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,54 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CONCURRENT_ATOMIC_CATOMICINTEGER_H_GEN__
+#define __CCM_UTIL_CONCURRENT_ATOMIC_CATOMICINTEGER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+namespace atomic {
+
+extern const CoclassID CID_CAtomicInteger;
+
+COCLASS_ID(37e94445-0ee6-460f-9105-4afed59d6586)
+class _CAtomicInteger
+{
+public:
+    _CAtomicInteger();
+
+    virtual ~_CAtomicInteger();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Integer initialValue,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace atomic
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CONCURRENT_ATOMIC_CATOMICINTEGER_H_GEN__
@@ -0,0 +1,234 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CAtomicLong.h"
+#include "ccm.util.concurrent.atomic.ICAtomicLongClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+namespace atomic {
+
+class CAtomicLongClassObject
+    : public ClassObject
+    , public ICAtomicLongClassObject
+{
+public:
+    CAtomicLongClassObject();
+
+    ~CAtomicLongClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Long initialValue,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CAtomicLongClassObject* sCAtomicLongClassObject = nullptr;
+static std::atomic<CAtomicLongClassObject*> sCAtomicLongCachedClassObject(nullptr);
+static Spinlock& GetCAtomicLongClassObjectLock()
+{
+    static Spinlock sCAtomicLongClassObjectLock;
+    return sCAtomicLongClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CAtomicLongClassObject, ClassObject, ICAtomicLongClassObject);
+
+CAtomicLongClassObject::CAtomicLongClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CAtomicLongClassObject::~CAtomicLongClassObject()
+{
+    Spinlock& lock = GetCAtomicLongClassObjectLock();
+    lock.Lock();
+    sCAtomicLongClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CAtomicLongClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CAtomicLongClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAtomicLong), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAtomicLong* _obj = new(addr) CAtomicLong();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::atomic::CAtomicLong");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CAtomicLongClassObject::CreateObject(
+    /* [in] */ Long initialValue,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CAtomicLong), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CAtomicLong* _obj = new(addr) CAtomicLong();
+    ECode ec = _obj->Constructor(initialValue);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::util::concurrent::atomic::CAtomicLong");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCAtomicLongClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCAtomicLongClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCAtomicLongClassObject == nullptr) {
+        sCAtomicLongClassObject = new CAtomicLongClassObject();
+    }
+    else if (sCAtomicLongClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCAtomicLongClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCAtomicLongClassObject;
+    return NOERROR;
+}
+
+static CAtomicLongClassObject* GetCachedCAtomicLongClassObject()
+{
+    CAtomicLongClassObject* clsObject = sCAtomicLongCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCAtomicLongClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCAtomicLongCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCAtomicLongClassObject == nullptr) {
+            sCAtomicLongClassObject = new CAtomicLongClassObject();
+        }
+        else if (sCAtomicLongClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCAtomicLongClassObject;
+        clsObject->AddRef();
+        sCAtomicLongCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCAtomicLongClassObjectCache()
+{
+    Spinlock& lock = GetCAtomicLongClassObjectLock();
+    lock.Lock();
+    CAtomicLongClassObject* clsObject = sCAtomicLongCachedClassObject.load(std::memory_order_relaxed);
+    sCAtomicLongCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CAtomicLong::_CAtomicLong()
+{
+    sCAtomicLongClassObject->AddRef();
+}
+
+_CAtomicLong::~_CAtomicLong()
+{
+    sCAtomicLongClassObject->Release();
+}
+
+ECode _CAtomicLong::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAtomicLongClassObject* cachedClsObject = GetCachedCAtomicLongClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CAtomicLong, iid, nullptr, object);
+};
+
+ECode _CAtomicLong::New(
+    /* [in] */ Long initialValue,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CAtomicLongClassObject* cachedClsObject = GetCachedCAtomicLongClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(initialValue, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CAtomicLong, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICAtomicLongClassObject::Probe(clsObject)->CreateObject(initialValue, iid, object);
+};
+
+} // namespace atomic
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
@@ -0,0 +1,209 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CPathClassLoader.h"
+#include "ccmrt.system.ICPathClassLoaderClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccmrt {
+namespace system {
+
+class CPathClassLoaderClassObject
+    : public ClassObject
+    , public ICPathClassLoaderClassObject
+{
+public:
+    CPathClassLoaderClassObject();
+
+    ~CPathClassLoaderClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const String& classPath,
+        /* [in] */ ccm::IClassLoader* parent,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CPathClassLoaderClassObject* sCPathClassLoaderClassObject = nullptr;
+static std::atomic<CPathClassLoaderClassObject*> sCPathClassLoaderCachedClassObject(nullptr);
+static Spinlock& GetCPathClassLoaderClassObjectLock()
+{
+    static Spinlock sCPathClassLoaderClassObjectLock;
+    return sCPathClassLoaderClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CPathClassLoaderClassObject, ClassObject, ICPathClassLoaderClassObject);
+
+CPathClassLoaderClassObject::CPathClassLoaderClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CPathClassLoaderClassObject::~CPathClassLoaderClassObject()
+{
+    Spinlock& lock = GetCPathClassLoaderClassObjectLock();
+    lock.Lock();
+    sCPathClassLoaderClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CPathClassLoaderClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CPathClassLoaderClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CPathClassLoaderClassObject::CreateObject(
+    /* [in] */ const String& classPath,
+    /* [in] */ ccm::IClassLoader* parent,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CPathClassLoader), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CPathClassLoader* _obj = new(addr) CPathClassLoader();
+    ECode ec = _obj->Constructor(classPath, parent);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccmrt::system::CPathClassLoader");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCPathClassLoaderClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCPathClassLoaderClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCPathClassLoaderClassObject == nullptr) {
+        sCPathClassLoaderClassObject = new CPathClassLoaderClassObject();
+    }
+    else if (sCPathClassLoaderClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCPathClassLoaderClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCPathClassLoaderClassObject;
+    return NOERROR;
+}
+
+static CPathClassLoaderClassObject* GetCachedCPathClassLoaderClassObject()
+{
+    CPathClassLoaderClassObject* clsObject = sCPathClassLoaderCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCPathClassLoaderClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCPathClassLoaderCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCPathClassLoaderClassObject == nullptr) {
+            sCPathClassLoaderClassObject = new CPathClassLoaderClassObject();
+        }
+        else if (sCPathClassLoaderClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCPathClassLoaderClassObject;
+        clsObject->AddRef();
+        sCPathClassLoaderCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCPathClassLoaderClassObjectCache()
+{
+    Spinlock& lock = GetCPathClassLoaderClassObjectLock();
+    lock.Lock();
+    CPathClassLoaderClassObject* clsObject = sCPathClassLoaderCachedClassObject.load(std::memory_order_relaxed);
+    sCPathClassLoaderCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CPathClassLoader::_CPathClassLoader()
+{
+    sCPathClassLoaderClassObject->AddRef();
+}
+
+_CPathClassLoader::~_CPathClassLoader()
+{
+    sCPathClassLoaderClassObject->Release();
+}
+
+ECode _CPathClassLoader::New(
+    /* [in] */ const String& classPath,
+    /* [in] */ ccm::IClassLoader* parent,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CPathClassLoaderClassObject* cachedClsObject = GetCachedCPathClassLoaderClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(classPath, parent, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CPathClassLoader, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICPathClassLoaderClassObject::Probe(clsObject)->CreateObject(classPath, parent, iid, object);
+};
+
+} // namespace system
+} // namespace ccmrt
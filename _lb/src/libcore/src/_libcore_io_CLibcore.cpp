@@ -0,0 +1,176 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CLibcore.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace libcore {
+namespace io {
+
+class CLibcoreClassObject
+    : public ClassObject
+{
+public:
+    CLibcoreClassObject();
+
+    ~CLibcoreClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CLibcoreClassObject* sCLibcoreClassObject = nullptr;
+static std::atomic<CLibcoreClassObject*> sCLibcoreCachedClassObject(nullptr);
+static Spinlock& GetCLibcoreClassObjectLock()
+{
+    static Spinlock sCLibcoreClassObjectLock;
+    return sCLibcoreClassObjectLock;
+}
+
+CLibcoreClassObject::CLibcoreClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CLibcoreClassObject::~CLibcoreClassObject()
+{
+    Spinlock& lock = GetCLibcoreClassObjectLock();
+    lock.Lock();
+    sCLibcoreClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CLibcoreClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CLibcoreClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CLibcore), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CLibcore* _obj = new(addr) CLibcore();
+    _obj->AttachMetadata(mComponent, "libcore::io::CLibcore");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCLibcoreClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCLibcoreClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCLibcoreClassObject == nullptr) {
+        sCLibcoreClassObject = new CLibcoreClassObject();
+    }
+    else if (sCLibcoreClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCLibcoreClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCLibcoreClassObject;
+    return NOERROR;
+}
+
+static CLibcoreClassObject* GetCachedCLibcoreClassObject()
+{
+    CLibcoreClassObject* clsObject = sCLibcoreCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCLibcoreClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCLibcoreCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCLibcoreClassObject == nullptr) {
+            sCLibcoreClassObject = new CLibcoreClassObject();
+        }
+        else if (sCLibcoreClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCLibcoreClassObject;
+        clsObject->AddRef();
+        sCLibcoreCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCLibcoreClassObjectCache()
+{
+    Spinlock& lock = GetCLibcoreClassObjectLock();
+    lock.Lock();
+    CLibcoreClassObject* clsObject = sCLibcoreCachedClassObject.load(std::memory_order_relaxed);
+    sCLibcoreCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CLibcore::_CLibcore()
+{
+    sCLibcoreClassObject->AddRef();
+}
+
+_CLibcore::~_CLibcore()
+{
+    sCLibcoreClassObject->Release();
+}
+
+ECode _CLibcore::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CLibcoreClassObject* cachedClsObject = GetCachedCLibcoreClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CLibcore, iid, nullptr, object);
+};
+
+} // namespace io
+} // namespace libcore
@@ -0,0 +1,45 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_IO_CLIBCORE_H_GEN__
+#define __LIBCORE_IO_CLIBCORE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace io {
+
+extern const CoclassID CID_CLibcore;
+
+COCLASS_ID(cfaed610-0e3c-4e2a-a533-2fccc50ae541)
+class _CLibcore
+{
+public:
+    _CLibcore();
+
+    virtual ~_CLibcore();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace io
+} // namespace libcore
+
+#endif // __LIBCORE_IO_CLIBCORE_H_GEN__
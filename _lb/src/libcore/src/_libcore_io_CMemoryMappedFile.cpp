@@ -0,0 +1,209 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CMemoryMappedFile.h"
+#include "libcore.io.ICMemoryMappedFileClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace libcore {
+namespace io {
+
+class CMemoryMappedFileClassObject
+    : public ClassObject
+    , public ICMemoryMappedFileClassObject
+{
+public:
+    CMemoryMappedFileClassObject();
+
+    ~CMemoryMappedFileClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ HANDLE address,
+        /* [in] */ Long size,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CMemoryMappedFileClassObject* sCMemoryMappedFileClassObject = nullptr;
+static std::atomic<CMemoryMappedFileClassObject*> sCMemoryMappedFileCachedClassObject(nullptr);
+static Spinlock& GetCMemoryMappedFileClassObjectLock()
+{
+    static Spinlock sCMemoryMappedFileClassObjectLock;
+    return sCMemoryMappedFileClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CMemoryMappedFileClassObject, ClassObject, ICMemoryMappedFileClassObject);
+
+CMemoryMappedFileClassObject::CMemoryMappedFileClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CMemoryMappedFileClassObject::~CMemoryMappedFileClassObject()
+{
+    Spinlock& lock = GetCMemoryMappedFileClassObjectLock();
+    lock.Lock();
+    sCMemoryMappedFileClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CMemoryMappedFileClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CMemoryMappedFileClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CMemoryMappedFileClassObject::CreateObject(
+    /* [in] */ HANDLE address,
+    /* [in] */ Long size,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CMemoryMappedFile), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CMemoryMappedFile* _obj = new(addr) CMemoryMappedFile();
+    ECode ec = _obj->Constructor(address, size);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "libcore::io::CMemoryMappedFile");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCMemoryMappedFileClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCMemoryMappedFileClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCMemoryMappedFileClassObject == nullptr) {
+        sCMemoryMappedFileClassObject = new CMemoryMappedFileClassObject();
+    }
+    else if (sCMemoryMappedFileClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCMemoryMappedFileClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCMemoryMappedFileClassObject;
+    return NOERROR;
+}
+
+static CMemoryMappedFileClassObject* GetCachedCMemoryMappedFileClassObject()
+{
+    CMemoryMappedFileClassObject* clsObject = sCMemoryMappedFileCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCMemoryMappedFileClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCMemoryMappedFileCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCMemoryMappedFileClassObject == nullptr) {
+            sCMemoryMappedFileClassObject = new CMemoryMappedFileClassObject();
+        }
+        else if (sCMemoryMappedFileClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCMemoryMappedFileClassObject;
+        clsObject->AddRef();
+        sCMemoryMappedFileCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCMemoryMappedFileClassObjectCache()
+{
+    Spinlock& lock = GetCMemoryMappedFileClassObjectLock();
+    lock.Lock();
+    CMemoryMappedFileClassObject* clsObject = sCMemoryMappedFileCachedClassObject.load(std::memory_order_relaxed);
+    sCMemoryMappedFileCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CMemoryMappedFile::_CMemoryMappedFile()
+{
+    sCMemoryMappedFileClassObject->AddRef();
+}
+
+_CMemoryMappedFile::~_CMemoryMappedFile()
+{
+    sCMemoryMappedFileClassObject->Release();
+}
+
+ECode _CMemoryMappedFile::New(
+    /* [in] */ HANDLE address,
+    /* [in] */ Long size,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CMemoryMappedFileClassObject* cachedClsObject = GetCachedCMemoryMappedFileClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(address, size, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CMemoryMappedFile, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICMemoryMappedFileClassObject::Probe(clsObject)->CreateObject(address, size, iid, object);
+};
+
+} // namespace io
+} // namespace libcore
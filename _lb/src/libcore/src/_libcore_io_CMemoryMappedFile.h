@@ -0,0 +1,47 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_IO_CMEMORYMAPPEDFILE_H_GEN__
+#define __LIBCORE_IO_CMEMORYMAPPEDFILE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace io {
+
+extern const CoclassID CID_CMemoryMappedFile;
+
+COCLASS_ID(4fd4ee55-6fc3-4dd2-af89-e1a560cf707c)
+class _CMemoryMappedFile
+{
+public:
+    _CMemoryMappedFile();
+
+    virtual ~_CMemoryMappedFile();
+
+    static ECode New(
+        /* [in] */ HANDLE address,
+        /* [in] */ Long size,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace io
+} // namespace libcore
+
+#endif // __LIBCORE_IO_CMEMORYMAPPEDFILE_H_GEN__
@@ -0,0 +1,181 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CZoneInfoWallTime.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace libcore {
+namespace util {
+
+class CZoneInfoWallTimeClassObject
+    : public ClassObject
+{
+public:
+    CZoneInfoWallTimeClassObject();
+
+    ~CZoneInfoWallTimeClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CZoneInfoWallTimeClassObject* sCZoneInfoWallTimeClassObject = nullptr;
+static std::atomic<CZoneInfoWallTimeClassObject*> sCZoneInfoWallTimeCachedClassObject(nullptr);
+static Spinlock& GetCZoneInfoWallTimeClassObjectLock()
+{
+    static Spinlock sCZoneInfoWallTimeClassObjectLock;
+    return sCZoneInfoWallTimeClassObjectLock;
+}
+
+CZoneInfoWallTimeClassObject::CZoneInfoWallTimeClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CZoneInfoWallTimeClassObject::~CZoneInfoWallTimeClassObject()
+{
+    Spinlock& lock = GetCZoneInfoWallTimeClassObjectLock();
+    lock.Lock();
+    sCZoneInfoWallTimeClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CZoneInfoWallTimeClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CZoneInfoWallTimeClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CZoneInfoWallTime), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CZoneInfoWallTime* _obj = new(addr) CZoneInfoWallTime();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "libcore::util::CZoneInfoWallTime");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCZoneInfoWallTimeClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCZoneInfoWallTimeClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCZoneInfoWallTimeClassObject == nullptr) {
+        sCZoneInfoWallTimeClassObject = new CZoneInfoWallTimeClassObject();
+    }
+    else if (sCZoneInfoWallTimeClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCZoneInfoWallTimeClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCZoneInfoWallTimeClassObject;
+    return NOERROR;
+}
+
+static CZoneInfoWallTimeClassObject* GetCachedCZoneInfoWallTimeClassObject()
+{
+    CZoneInfoWallTimeClassObject* clsObject = sCZoneInfoWallTimeCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCZoneInfoWallTimeClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCZoneInfoWallTimeCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCZoneInfoWallTimeClassObject == nullptr) {
+            sCZoneInfoWallTimeClassObject = new CZoneInfoWallTimeClassObject();
+        }
+        else if (sCZoneInfoWallTimeClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCZoneInfoWallTimeClassObject;
+        clsObject->AddRef();
+        sCZoneInfoWallTimeCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCZoneInfoWallTimeClassObjectCache()
+{
+    Spinlock& lock = GetCZoneInfoWallTimeClassObjectLock();
+    lock.Lock();
+    CZoneInfoWallTimeClassObject* clsObject = sCZoneInfoWallTimeCachedClassObject.load(std::memory_order_relaxed);
+    sCZoneInfoWallTimeCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CZoneInfoWallTime::_CZoneInfoWallTime()
+{
+    sCZoneInfoWallTimeClassObject->AddRef();
+}
+
+_CZoneInfoWallTime::~_CZoneInfoWallTime()
+{
+    sCZoneInfoWallTimeClassObject->Release();
+}
+
+ECode _CZoneInfoWallTime::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CZoneInfoWallTimeClassObject* cachedClsObject = GetCachedCZoneInfoWallTimeClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CZoneInfoWallTime, iid, nullptr, object);
+};
+
+} // namespace util
+} // namespace libcore
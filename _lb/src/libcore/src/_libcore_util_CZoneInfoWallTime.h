@@ -0,0 +1,45 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_UTIL_CZONEINFOWALLTIME_H_GEN__
+#define __LIBCORE_UTIL_CZONEINFOWALLTIME_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace util {
+
+extern const CoclassID CID_CZoneInfoWallTime;
+
+COCLASS_ID(b9bc96e1-babc-46c0-86f4-79c914e06ef9)
+class _CZoneInfoWallTime
+{
+public:
+    _CZoneInfoWallTime();
+
+    virtual ~_CZoneInfoWallTime();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace util
+} // namespace libcore
+
+#endif // __LIBCORE_UTIL_CZONEINFOWALLTIME_H_GEN__
@@ -0,0 +1,242 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CStructStat.h"
+#include "pisces.system.ICStructStatClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace pisces {
+namespace system {
+
+class CStructStatClassObject
+    : public ClassObject
+    , public ICStructStatClassObject
+{
+public:
+    CStructStatClassObject();
+
+    ~CStructStatClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Long st_dev,
+        /* [in] */ Long st_ino,
+        /* [in] */ Integer st_mode,
+        /* [in] */ Long st_nlink,
+        /* [in] */ Integer st_uid,
+        /* [in] */ Integer st_gid,
+        /* [in] */ Long st_rdev,
+        /* [in] */ Long st_size,
+        /* [in] */ Long st_atime,
+        /* [in] */ Long st_mtime,
+        /* [in] */ Long st_ctime,
+        /* [in] */ Long st_blksize,
+        /* [in] */ Long st_blocks,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CStructStatClassObject* sCStructStatClassObject = nullptr;
+static std::atomic<CStructStatClassObject*> sCStructStatCachedClassObject(nullptr);
+static Spinlock& GetCStructStatClassObjectLock()
+{
+    static Spinlock sCStructStatClassObjectLock;
+    return sCStructStatClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CStructStatClassObject, ClassObject, ICStructStatClassObject);
+
+CStructStatClassObject::CStructStatClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CStructStatClassObject::~CStructStatClassObject()
+{
+    Spinlock& lock = GetCStructStatClassObjectLock();
+    lock.Lock();
+    sCStructStatClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CStructStatClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CStructStatClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CStructStatClassObject::CreateObject(
+    /* [in] */ Long st_dev,
+    /* [in] */ Long st_ino,
+    /* [in] */ Integer st_mode,
+    /* [in] */ Long st_nlink,
+    /* [in] */ Integer st_uid,
+    /* [in] */ Integer st_gid,
+    /* [in] */ Long st_rdev,
+    /* [in] */ Long st_size,
+    /* [in] */ Long st_atime,
+    /* [in] */ Long st_mtime,
+    /* [in] */ Long st_ctime,
+    /* [in] */ Long st_blksize,
+    /* [in] */ Long st_blocks,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CStructStat), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CStructStat* _obj = new(addr) CStructStat();
+    ECode ec = _obj->Constructor(st_dev, st_ino, st_mode, st_nlink, st_uid, st_gid, st_rdev, st_size, st_atime, st_mtime, st_ctime, st_blksize, st_blocks);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "pisces::system::CStructStat");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCStructStatClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCStructStatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCStructStatClassObject == nullptr) {
+        sCStructStatClassObject = new CStructStatClassObject();
+    }
+    else if (sCStructStatClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCStructStatClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCStructStatClassObject;
+    return NOERROR;
+}
+
+static CStructStatClassObject* GetCachedCStructStatClassObject()
+{
+    CStructStatClassObject* clsObject = sCStructStatCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCStructStatClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCStructStatCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCStructStatClassObject == nullptr) {
+            sCStructStatClassObject = new CStructStatClassObject();
+        }
+        else if (sCStructStatClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCStructStatClassObject;
+        clsObject->AddRef();
+        sCStructStatCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCStructStatClassObjectCache()
+{
+    Spinlock& lock = GetCStructStatClassObjectLock();
+    lock.Lock();
+    CStructStatClassObject* clsObject = sCStructStatCachedClassObject.load(std::memory_order_relaxed);
+    sCStructStatCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CStructStat::_CStructStat()
+{
+    sCStructStatClassObject->AddRef();
+}
+
+_CStructStat::~_CStructStat()
+{
+    sCStructStatClassObject->Release();
+}
+
+ECode _CStructStat::New(
+    /* [in] */ Long st_dev,
+    /* [in] */ Long st_ino,
+    /* [in] */ Integer st_mode,
+    /* [in] */ Long st_nlink,
+    /* [in] */ Integer st_uid,
+    /* [in] */ Integer st_gid,
+    /* [in] */ Long st_rdev,
+    /* [in] */ Long st_size,
+    /* [in] */ Long st_atime,
+    /* [in] */ Long st_mtime,
+    /* [in] */ Long st_ctime,
+    /* [in] */ Long st_blksize,
+    /* [in] */ Long st_blocks,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CStructStatClassObject* cachedClsObject = GetCachedCStructStatClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(st_dev, st_ino, st_mode, st_nlink, st_uid, st_gid, st_rdev, st_size, st_atime, st_mtime, st_ctime, st_blksize, st_blocks, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CStructStat, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICStructStatClassObject::Probe(clsObject)->CreateObject(st_dev, st_ino, st_mode, st_nlink, st_uid, st_gid, st_rdev, st_size, st_atime, st_mtime, st_ctime, st_blksize, st_blocks, iid, object);
+};
+
+} // namespace system
+} // namespace pisces
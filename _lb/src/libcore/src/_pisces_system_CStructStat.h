@@ -0,0 +1,58 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __PISCES_SYSTEM_CSTRUCTSTAT_H_GEN__
+#define __PISCES_SYSTEM_CSTRUCTSTAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace pisces {
+namespace system {
+
+extern const CoclassID CID_CStructStat;
+
+COCLASS_ID(37213cfe-2bfc-4572-b06e-e2fba3837c36)
+class _CStructStat
+{
+public:
+    _CStructStat();
+
+    virtual ~_CStructStat();
+
+    static ECode New(
+        /* [in] */ Long st_dev,
+        /* [in] */ Long st_ino,
+        /* [in] */ Integer st_mode,
+        /* [in] */ Long st_nlink,
+        /* [in] */ Integer st_uid,
+        /* [in] */ Integer st_gid,
+        /* [in] */ Long st_rdev,
+        /* [in] */ Long st_size,
+        /* [in] */ Long st_atime,
+        /* [in] */ Long st_mtime,
+        /* [in] */ Long st_ctime,
+        /* [in] */ Long st_blksize,
+        /* [in] */ Long st_blocks,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace system
+} // namespace pisces
+
+#endif // __PISCES_SYSTEM_CSTRUCTSTAT_H_GEN__
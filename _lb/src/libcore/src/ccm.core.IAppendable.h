@@ -0,0 +1,61 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_IAPPENDABLE_H_GEN__
+#define __CCM_CORE_IAPPENDABLE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IAppendable;
+
+INTERFACE_ID(46d6e833-cb8a-4b12-9e3c-bfc25bf7c8f7)
+interface IAppendable : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IAppendable* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IAppendable*)object->Probe(IID_IAppendable);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IAppendable;
+    }
+
+    virtual ECode Append(
+        /* [in] */ ccm::core::ICharSequence* csq) = 0;
+
+    virtual ECode Append(
+        /* [in] */ ccm::core::ICharSequence* csq,
+        /* [in] */ Integer start,
+        /* [in] */ Integer end) = 0;
+
+    virtual ECode Append(
+        /* [in] */ Char c) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_IAPPENDABLE_H_GEN__
@@ -0,0 +1,64 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_IARRAY_H_GEN__
+#define __CCM_CORE_IARRAY_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IArray;
+
+INTERFACE_ID(0a5ffe64-d284-4772-852c-962cee7a9604)
+interface IArray : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IArray* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IArray*)object->Probe(IID_IArray);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IArray;
+    }
+
+    virtual ECode Get(
+        /* [in] */ Long index,
+        /* [out] */ ccm::IInterface** element) = 0;
+
+    virtual ECode GetLength(
+        /* [out] */ Long* size) = 0;
+
+    virtual ECode GetTypeId(
+        /* [out] */ InterfaceID* id) = 0;
+
+    virtual ECode Set(
+        /* [in] */ Long index,
+        /* [in] */ ccm::IInterface* element) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_IARRAY_H_GEN__
@@ -0,0 +1,68 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_IARRAYHOLDER_H_GEN__
+#define __CCM_CORE_IARRAYHOLDER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IArrayHolder;
+
+INTERFACE_ID(9549d2b9-6356-42fa-92bd-5d8ea657e5e6)
+interface IArrayHolder : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IArrayHolder* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IArrayHolder*)object->Probe(IID_IArrayHolder);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IArrayHolder;
+    }
+
+    static constexpr Integer TYPE_UNKNOWN_ARRAY = 0;
+    static constexpr Integer TYPE_CHAR_ARRAY = 1;
+    static constexpr Integer TYPE_BYTE_ARRAY = 2;
+    static constexpr Integer TYPE_SHORT_ARRAY = 3;
+    static constexpr Integer TYPE_INTEGER_ARRAY = 4;
+    static constexpr Integer TYPE_LONG_ARRAY = 5;
+    static constexpr Integer TYPE_FLOAT_ARRAY = 6;
+    static constexpr Integer TYPE_DOUBLE_ARRAY = 7;
+    static constexpr Integer TYPE_BOOLEAN_ARRAY = 8;
+    static constexpr Integer TYPE_STRING_ARRAY = 9;
+    static constexpr Integer TYPE_INTERFACE_ARRAY = 17;
+
+    virtual ECode GetArray(
+        /* [out] */ Triple* array) = 0;
+
+    virtual ECode GetArrayType(
+        /* [out] */ Integer* type) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_IARRAYHOLDER_H_GEN__
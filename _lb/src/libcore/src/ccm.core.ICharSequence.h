@@ -0,0 +1,65 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ICHARSEQUENCE_H_GEN__
+#define __CCM_CORE_ICHARSEQUENCE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_ICharSequence;
+
+INTERFACE_ID(21107670-c69c-4bab-b7a2-476469271786)
+interface ICharSequence : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICharSequence* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICharSequence*)object->Probe(IID_ICharSequence);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICharSequence;
+    }
+
+    virtual ECode GetCharAt(
+        /* [in] */ Integer index,
+        /* [out] */ Char* c) = 0;
+
+    virtual ECode GetLength(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode SubSequence(
+        /* [in] */ Integer start,
+        /* [in] */ Integer end,
+        /* [out] */ ccm::core::ICharSequence** subcsq) = 0;
+
+    virtual ECode ToString(
+        /* [out] */ String* str) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ICHARSEQUENCE_H_GEN__
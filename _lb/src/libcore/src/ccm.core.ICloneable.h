@@ -0,0 +1,54 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ICLONEABLE_H_GEN__
+#define __CCM_CORE_ICLONEABLE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_ICloneable;
+
+INTERFACE_ID(5ff88e9d-b164-4ac5-b923-194ba8de7d3b)
+interface ICloneable : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICloneable* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICloneable*)object->Probe(IID_ICloneable);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICloneable;
+    }
+
+    virtual ECode Clone(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** obj) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ICLONEABLE_H_GEN__
@@ -0,0 +1,54 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ICOMPARABLE_H_GEN__
+#define __CCM_CORE_ICOMPARABLE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IComparable;
+
+INTERFACE_ID(0a64e9a5-54ac-4cbd-a638-452ee2d134bd)
+interface IComparable : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IComparable* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IComparable*)object->Probe(IID_IComparable);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IComparable;
+    }
+
+    virtual ECode CompareTo(
+        /* [in] */ ccm::IInterface* other,
+        /* [out] */ Integer* result) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ICOMPARABLE_H_GEN__
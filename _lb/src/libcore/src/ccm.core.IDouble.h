@@ -0,0 +1,91 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_IDOUBLE_H_GEN__
+#define __CCM_CORE_IDOUBLE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IDouble;
+
+INTERFACE_ID(6aeffb3e-f757-44b6-a71f-2ddc607f11c8)
+interface IDouble : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDouble* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDouble*)object->Probe(IID_IDouble);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDouble;
+    }
+
+    static const Double POSITIVE_INFINITY;
+    static const Double NEGATIVE_INFINITY;
+    static const Double NaN;
+    static constexpr Double MAX_VALUE = 1.7976931348623157e+308;
+    static constexpr Double MIN_NORMAL = 2.2250738585072014e-308;
+    static constexpr Double MIN_VALUE = 4.9406564584124654e-324;
+    static constexpr Integer MAX_EXPONENT = 1023;
+    static constexpr Integer MIN_EXPONENT = -1022;
+    static constexpr Integer SIZE = 64;
+
+    virtual ECode ByteValue(
+        /* [out] */ Byte* value) = 0;
+
+    virtual ECode CompareTo(
+        /* [in] */ ccm::IInterface* other,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode DoubleValue(
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode FloatValue(
+        /* [out] */ Float* value) = 0;
+
+    virtual ECode GetValue(
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode IntegerValue(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode IsInfinite(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode IsNaN(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode LongValue(
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode ShortValue(
+        /* [out] */ Short* value) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_IDOUBLE_H_GEN__
@@ -0,0 +1,88 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_IFLOAT_H_GEN__
+#define __CCM_CORE_IFLOAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IFloat;
+
+INTERFACE_ID(b39e1aff-9fc5-45b2-850b-a0c070167916)
+interface IFloat : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFloat* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFloat*)object->Probe(IID_IFloat);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFloat;
+    }
+
+    static const Float POSITIVE_INFINITY;
+    static const Float NEGATIVE_INFINITY;
+    static const Float NaN;
+    static constexpr Float MAX_VALUE = 3.402823e+38;
+    static constexpr Float MIN_NORMAL = 1.175494e-38;
+    static constexpr Float MIN_VALUE = 1.401298e-45;
+
+    virtual ECode ByteValue(
+        /* [out] */ Byte* value) = 0;
+
+    virtual ECode CompareTo(
+        /* [in] */ ccm::IInterface* other,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode DoubleValue(
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode FloatValue(
+        /* [out] */ Float* value) = 0;
+
+    virtual ECode GetValue(
+        /* [out] */ Float* value) = 0;
+
+    virtual ECode IntegerValue(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode IsInfinite(
+        /* [out] */ Boolean* infinite) = 0;
+
+    virtual ECode IsNaN(
+        /* [out] */ Boolean* nan) = 0;
+
+    virtual ECode LongValue(
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode ShortValue(
+        /* [out] */ Short* value) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_IFLOAT_H_GEN__
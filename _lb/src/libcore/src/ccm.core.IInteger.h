@@ -0,0 +1,79 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_IINTEGER_H_GEN__
+#define __CCM_CORE_IINTEGER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IInteger;
+
+INTERFACE_ID(2108de07-543c-4cc5-9a59-d25121b4568e)
+interface IInteger : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IInteger* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IInteger*)object->Probe(IID_IInteger);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IInteger;
+    }
+
+    static constexpr Integer MIN_VALUE = 0x80000000;
+    static constexpr Integer MAX_VALUE = 0x7fffffff;
+    static constexpr Integer SIZE = 32;
+
+    virtual ECode ByteValue(
+        /* [out] */ Byte* value) = 0;
+
+    virtual ECode CompareTo(
+        /* [in] */ ccm::IInterface* other,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode DoubleValue(
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode FloatValue(
+        /* [out] */ Float* value) = 0;
+
+    virtual ECode GetValue(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode IntegerValue(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode LongValue(
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode ShortValue(
+        /* [out] */ Short* value) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_IINTEGER_H_GEN__
@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_IITERABLE_H_GEN__
+#define __CCM_CORE_IITERABLE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IIterable;
+
+INTERFACE_ID(dd6c303a-21c3-487f-b431-906b286f00f5)
+interface IIterable : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IIterable* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IIterable*)object->Probe(IID_IIterable);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IIterable;
+    }
+
+    virtual ECode GetIterator(
+        /* [out] */ ccm::util::IIterator** it) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_IITERABLE_H_GEN__
@@ -0,0 +1,52 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_IRUNNABLE_H_GEN__
+#define __CCM_CORE_IRUNNABLE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IRunnable;
+
+INTERFACE_ID(c6c344d7-4fb3-4221-852e-48356c6bf78d)
+interface IRunnable : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IRunnable* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IRunnable*)object->Probe(IID_IRunnable);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IRunnable;
+    }
+
+    virtual ECode Run() = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_IRUNNABLE_H_GEN__
@@ -0,0 +1,59 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_IRUNTIME_H_GEN__
+#define __CCM_CORE_IRUNTIME_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IRuntime;
+
+INTERFACE_ID(22b24f1e-45ec-4669-86c8-a75cd6af7e2a)
+interface IRuntime : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IRuntime* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IRuntime*)object->Probe(IID_IRuntime);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IRuntime;
+    }
+
+    virtual ECode AddShutdownHook(
+        /* [in] */ ccm::core::IThread* hook) = 0;
+
+    virtual ECode AvailableProcessors(
+        /* [out] */ Integer* ncpu) = 0;
+
+    virtual ECode Exit(
+        /* [in] */ Integer status) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_IRUNTIME_H_GEN__
@@ -0,0 +1,68 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ISECURITYMANAGER_H_GEN__
+#define __CCM_CORE_ISECURITYMANAGER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_ISecurityManager;
+
+INTERFACE_ID(a8d886cf-a4f1-4733-b5ff-a670789b9c25)
+interface ISecurityManager : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISecurityManager* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISecurityManager*)object->Probe(IID_ISecurityManager);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ISecurityManager;
+    }
+
+    virtual ECode CheckDelete(
+        /* [in] */ const String& file) = 0;
+
+    virtual ECode CheckExec(
+        /* [in] */ const String& file) = 0;
+
+    virtual ECode CheckPermission(
+        /* [in] */ ccm::security::IPermission* perm) = 0;
+
+    virtual ECode CheckPropertyAccess(
+        /* [in] */ const String& key) = 0;
+
+    virtual ECode CheckRead(
+        /* [in] */ const String& file) = 0;
+
+    virtual ECode CheckWrite(
+        /* [in] */ const String& file) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ISECURITYMANAGER_H_GEN__
@@ -0,0 +1,63 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ISTACKTRACE_H_GEN__
+#define __CCM_CORE_ISTACKTRACE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IStackTrace;
+
+INTERFACE_ID(b03ae37d-1d06-4a25-8d44-9790d292c9bf)
+interface IStackTrace : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStackTrace* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStackTrace*)object->Probe(IID_IStackTrace);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStackTrace;
+    }
+
+    virtual ECode FillInStackTrace() = 0;
+
+    virtual ECode GetStackTrace(
+        /* [out, callee] */ Array<ccm::core::IStackTraceElement*>* stack) = 0;
+
+    virtual ECode PrintStackTrace() = 0;
+
+    virtual ECode PrintStackTrace(
+        /* [in] */ ccm::io::IPrintStream* s) = 0;
+
+    virtual ECode PrintStackTrace(
+        /* [in] */ ccm::io::IPrintWriter* s) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ISTACKTRACE_H_GEN__
@@ -0,0 +1,69 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ISTRING_H_GEN__
+#define __CCM_CORE_ISTRING_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IString;
+
+INTERFACE_ID(d676d0a0-4708-49b6-9b97-a0a6be4223cd)
+interface IString : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IString* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IString*)object->Probe(IID_IString);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IString;
+    }
+
+    virtual ECode CompareTo(
+        /* [in] */ ccm::IInterface* other,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode GetCharAt(
+        /* [in] */ Integer index,
+        /* [out] */ Char* c) = 0;
+
+    virtual ECode GetLength(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode SubSequence(
+        /* [in] */ Integer start,
+        /* [in] */ Integer end,
+        /* [out] */ ccm::core::ICharSequence** subcsq) = 0;
+
+    virtual ECode ToString(
+        /* [out] */ String* str) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ISTRING_H_GEN__
@@ -0,0 +1,222 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ISTRINGBUILDER_H_GEN__
+#define __CCM_CORE_ISTRINGBUILDER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IStringBuilder;
+
+INTERFACE_ID(29904f3a-9219-4613-b6b2-1fc42ac75eb9)
+interface IStringBuilder : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStringBuilder* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStringBuilder*)object->Probe(IID_IStringBuilder);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStringBuilder;
+    }
+
+    virtual ECode Append(
+        /* [in] */ ccm::IInterface* obj) = 0;
+
+    virtual ECode Append(
+        /* [in] */ const String& str) = 0;
+
+    virtual ECode Append(
+        /* [in] */ ccm::core::IStringBuffer* sb) = 0;
+
+    virtual ECode Append(
+        /* [in] */ ccm::core::ICharSequence* s) = 0;
+
+    virtual ECode Append(
+        /* [in] */ ccm::core::ICharSequence* s,
+        /* [in] */ Integer start,
+        /* [in] */ Integer end) = 0;
+
+    virtual ECode Append(
+        /* [in] */ const Array<Char>& str) = 0;
+
+    virtual ECode Append(
+        /* [in] */ const Array<Char>& str,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer len) = 0;
+
+    virtual ECode Append(
+        /* [in] */ Boolean b) = 0;
+
+    virtual ECode Append(
+        /* [in] */ Integer i) = 0;
+
+    virtual ECode Append(
+        /* [in] */ Long l) = 0;
+
+    virtual ECode Append(
+        /* [in] */ Float f) = 0;
+
+    virtual ECode Append(
+        /* [in] */ Double d) = 0;
+
+    virtual ECode Append(
+        /* [in] */ Char c) = 0;
+
+    virtual ECode Delete(
+        /* [in] */ Integer start,
+        /* [in] */ Integer end) = 0;
+
+    virtual ECode DeleteCharAt(
+        /* [in] */ Integer index) = 0;
+
+    virtual ECode EnsureCapacity(
+        /* [in] */ Integer minimumCapacity) = 0;
+
+    virtual ECode GetCapacity(
+        /* [out] */ Integer* capacity) = 0;
+
+    virtual ECode GetCharAt(
+        /* [in] */ Integer index,
+        /* [out] */ Char* c) = 0;
+
+    virtual ECode GetChars(
+        /* [in] */ Integer start,
+        /* [in] */ Integer end,
+        /* [out] */ Array<Char>& dst,
+        /* [in] */ Integer dstStart) = 0;
+
+    virtual ECode GetLength(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode Replace(
+        /* [in] */ Integer start,
+        /* [in] */ Integer end,
+        /* [in] */ const String& str) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer index,
+        /* [in] */ const Array<Char>& str,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer len) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer offset,
+        /* [in] */ ccm::IInterface* obj) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer offset,
+        /* [in] */ const String& str) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer offset,
+        /* [in] */ const Array<Char>& str) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer dstOffset,
+        /* [in] */ ccm::core::ICharSequence* s) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer dstOffset,
+        /* [in] */ ccm::core::ICharSequence* s,
+        /* [in] */ Integer start,
+        /* [in] */ Integer end) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer offset,
+        /* [in] */ Boolean b) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer offset,
+        /* [in] */ Char c) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer offset,
+        /* [in] */ Integer i) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer offset,
+        /* [in] */ Long l) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer offset,
+        /* [in] */ Float f) = 0;
+
+    virtual ECode Insert(
+        /* [in] */ Integer offset,
+        /* [in] */ Double d) = 0;
+
+    virtual ECode IndexOf(
+        /* [in] */ const String& str,
+        /* [out] */ Integer* idx) = 0;
+
+    virtual ECode IndexOf(
+        /* [in] */ const String& str,
+        /* [in] */ Integer fromIndex,
+        /* [out] */ Integer* idx) = 0;
+
+    virtual ECode LastIndexOf(
+        /* [in] */ const String& str,
+        /* [out] */ Integer* idx) = 0;
+
+    virtual ECode LastIndexOf(
+        /* [in] */ const String& str,
+        /* [in] */ Integer fromIndex,
+        /* [out] */ Integer* idx) = 0;
+
+    virtual ECode Reverse() = 0;
+
+    virtual ECode SetCharAt(
+        /* [in] */ Integer index,
+        /* [in] */ Char ch) = 0;
+
+    virtual ECode SetLength(
+        /* [in] */ Integer newLength) = 0;
+
+    virtual ECode SubSequence(
+        /* [in] */ Integer start,
+        /* [in] */ Integer end,
+        /* [out] */ ccm::core::ICharSequence** subcsq) = 0;
+
+    virtual ECode Substring(
+        /* [in] */ Integer start,
+        /* [out] */ String* str) = 0;
+
+    virtual ECode Substring(
+        /* [in] */ Integer start,
+        /* [in] */ Integer end,
+        /* [out] */ String* str) = 0;
+
+    virtual ECode ToString(
+        /* [out] */ String* str) = 0;
+
+    virtual ECode TrimToSize() = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ISTRINGBUILDER_H_GEN__
@@ -0,0 +1,67 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ISYNCHRONIZE_H_GEN__
+#define __CCM_CORE_ISYNCHRONIZE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_ISynchronize;
+
+INTERFACE_ID(7ddf21a8-3891-484e-a23b-2ad9cedabf17)
+interface ISynchronize : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISynchronize* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISynchronize*)object->Probe(IID_ISynchronize);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ISynchronize;
+    }
+
+    virtual ECode Lock() = 0;
+
+    virtual ECode Unlock() = 0;
+
+    virtual ECode Notify() = 0;
+
+    virtual ECode NotifyAll() = 0;
+
+    virtual ECode Wait() = 0;
+
+    virtual ECode Wait(
+        /* [in] */ Long millis) = 0;
+
+    virtual ECode Wait(
+        /* [in] */ Long millis,
+        /* [in] */ Integer nanos) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ISYNCHRONIZE_H_GEN__
@@ -0,0 +1,135 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ITHREAD_H_GEN__
+#define __CCM_CORE_ITHREAD_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IThread;
+
+INTERFACE_ID(fb0ec407-baa3-47ed-9a3f-fe666ee9fca0)
+interface IThread : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IThread* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IThread*)object->Probe(IID_IThread);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IThread;
+    }
+
+    static constexpr Integer MIN_PRIORITY = 1;
+    static constexpr Integer NORM_PRIORITY = 5;
+    static constexpr Integer MAX_PRIORITY = 10;
+
+    virtual ECode BlockedOn(
+        /* [in] */ ccm::io::IInterruptible* b) = 0;
+
+    virtual ECode CheckAccess() = 0;
+
+    virtual ECode CountStackFrames(
+        /* [out] */ Integer* frameNum) = 0;
+
+    virtual ECode Destroy() = 0;
+
+    virtual ECode GetContextClassLoader(
+        /* [out] */ ccm::IClassLoader** loader) = 0;
+
+    virtual ECode GetId(
+        /* [out] */ Long* id) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetPriority(
+        /* [out] */ Integer* priority) = 0;
+
+    virtual ECode GetStackTrace(
+        /* [out, callee] */ Array<ccm::core::IStackTraceElement*>* trace) = 0;
+
+    virtual ECode GetState(
+        /* [out] */ ccm::core::ThreadState* state) = 0;
+
+    virtual ECode GetThreadGroup(
+        /* [out] */ ccm::core::IThreadGroup** tg) = 0;
+
+    virtual ECode Interrupt() = 0;
+
+    virtual ECode IsAlive(
+        /* [out] */ Boolean* alive) = 0;
+
+    virtual ECode IsDaemon(
+        /* [out] */ Boolean* daemon) = 0;
+
+    virtual ECode IsInterrupted(
+        /* [out] */ Boolean* interrupted) = 0;
+
+    virtual ECode Join() = 0;
+
+    virtual ECode Join(
+        /* [in] */ Long millis) = 0;
+
+    virtual ECode Join(
+        /* [in] */ Long millis,
+        /* [in] */ Integer nanos) = 0;
+
+    virtual ECode ParkFor(
+        /* [in] */ Long nanos) = 0;
+
+    virtual ECode ParkUntil(
+        /* [in] */ Long time) = 0;
+
+    virtual ECode Resume() = 0;
+
+    virtual ECode Run() = 0;
+
+    virtual ECode SetContextClassLoader(
+        /* [in] */ ccm::IClassLoader* cl) = 0;
+
+    virtual ECode SetDaemon(
+        /* [in] */ Boolean on) = 0;
+
+    virtual ECode SetName(
+        /* [in] */ const String& name) = 0;
+
+    virtual ECode SetPriority(
+        /* [in] */ Integer newPriority) = 0;
+
+    virtual ECode Start() = 0;
+
+    virtual ECode Stop() = 0;
+
+    virtual ECode Suspend() = 0;
+
+    virtual ECode Unpark() = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ITHREAD_H_GEN__
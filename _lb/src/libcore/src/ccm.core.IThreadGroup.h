@@ -0,0 +1,124 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ITHREADGROUP_H_GEN__
+#define __CCM_CORE_ITHREADGROUP_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IThreadGroup;
+
+INTERFACE_ID(b25cfd17-1013-406e-b0cd-74be7637571c)
+interface IThreadGroup : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IThreadGroup* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IThreadGroup*)object->Probe(IID_IThreadGroup);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IThreadGroup;
+    }
+
+    virtual ECode ActiveCount(
+        /* [out] */ Integer* count) = 0;
+
+    virtual ECode ActiveGroupCount(
+        /* [out] */ Integer* count) = 0;
+
+    virtual ECode Add(
+        /* [in] */ ccm::core::IThread* t) = 0;
+
+    virtual ECode AddUnstarted() = 0;
+
+    virtual ECode CheckAccess() = 0;
+
+    virtual ECode Destroy() = 0;
+
+    virtual ECode Enumerate(
+        /* [out] */ Array<ccm::core::IThread*>& list,
+        /* [out] */ Integer* count) = 0;
+
+    virtual ECode Enumerate(
+        /* [out] */ Array<ccm::core::IThread*>& list,
+        /* [in] */ Boolean recurse,
+        /* [out] */ Integer* count) = 0;
+
+    virtual ECode Enumerate(
+        /* [out] */ Array<ccm::core::IThreadGroup*>& list,
+        /* [out] */ Integer* count) = 0;
+
+    virtual ECode Enumerate(
+        /* [out] */ Array<ccm::core::IThreadGroup*>& list,
+        /* [in] */ Boolean recurse,
+        /* [out] */ Integer* count) = 0;
+
+    virtual ECode GetMaxPriority(
+        /* [out] */ Integer* priority) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetParent(
+        /* [out] */ ccm::core::IThreadGroup** parent) = 0;
+
+    virtual ECode Interrupt() = 0;
+
+    virtual ECode IsDaemon(
+        /* [out] */ Boolean* daemon) = 0;
+
+    virtual ECode IsDestroyed(
+        /* [out] */ Boolean* destroyed) = 0;
+
+    virtual ECode List() = 0;
+
+    virtual ECode ParentOf(
+        /* [in] */ ccm::core::IThreadGroup* g,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Resume() = 0;
+
+    virtual ECode SetDaemon(
+        /* [in] */ Boolean daemon) = 0;
+
+    virtual ECode SetMaxPriority(
+        /* [in] */ Integer pri) = 0;
+
+    virtual ECode Stop() = 0;
+
+    virtual ECode Suspend() = 0;
+
+    virtual ECode ThreadStartFailed(
+        /* [in] */ ccm::core::IThread* t) = 0;
+
+    virtual ECode ThreadTerminated(
+        /* [in] */ ccm::core::IThread* t) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ITHREADGROUP_H_GEN__
@@ -0,0 +1,58 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_CORE_ITHREADLOCAL_H_GEN__
+#define __CCM_CORE_ITHREADLOCAL_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace core {
+
+extern const InterfaceID IID_IThreadLocal;
+
+INTERFACE_ID(8d3b5361-18be-40a4-8a8d-7ded4ac1824f)
+interface IThreadLocal : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IThreadLocal* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IThreadLocal*)object->Probe(IID_IThreadLocal);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IThreadLocal;
+    }
+
+    virtual ECode Get(
+        /* [out] */ ccm::IInterface** value) = 0;
+
+    virtual ECode Remove() = 0;
+
+    virtual ECode Set(
+        /* [in] */ ccm::IInterface* value) = 0;
+};
+
+} // namespace core
+} // namespace ccm
+
+#endif // __CCM_CORE_ITHREADLOCAL_H_GEN__
@@ -0,0 +1,96 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IBUFFER_H_GEN__
+#define __CCM_IO_IBUFFER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IBuffer;
+
+INTERFACE_ID(73dcfab7-ea7a-4bab-af32-4c3d0ad6b986)
+interface IBuffer : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IBuffer* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IBuffer*)object->Probe(IID_IBuffer);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IBuffer;
+    }
+
+    virtual ECode Clear() = 0;
+
+    virtual ECode Flip() = 0;
+
+    virtual ECode GetArray(
+        /* [out] */ ccm::IInterface** array) = 0;
+
+    virtual ECode GetArrayOffset(
+        /* [out] */ Integer* offset) = 0;
+
+    virtual ECode GetCapacity(
+        /* [out] */ Integer* capacity) = 0;
+
+    virtual ECode GetLimit(
+        /* [out] */ Integer* limit) = 0;
+
+    virtual ECode GetPosition(
+        /* [out] */ Integer* position) = 0;
+
+    virtual ECode HasArray(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode HasRemaining(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode IsDirect(
+        /* [out] */ Boolean* direct) = 0;
+
+    virtual ECode IsReadOnly(
+        /* [out] */ Boolean* readOnly) = 0;
+
+    virtual ECode Mark() = 0;
+
+    virtual ECode Remaining(
+        /* [out] */ Integer* remaining) = 0;
+
+    virtual ECode Reset() = 0;
+
+    virtual ECode Rewind() = 0;
+
+    virtual ECode SetLimit(
+        /* [in] */ Integer newLimit) = 0;
+
+    virtual ECode SetPosition(
+        /* [in] */ Integer newPosition) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IBUFFER_H_GEN__
@@ -0,0 +1,68 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IBYTEARRAYOUTPUTSTREAM_H_GEN__
+#define __CCM_IO_IBYTEARRAYOUTPUTSTREAM_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IByteArrayOutputStream;
+
+INTERFACE_ID(266680ff-0a52-4a45-8222-10da4c4b9178)
+interface IByteArrayOutputStream : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IByteArrayOutputStream* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IByteArrayOutputStream*)object->Probe(IID_IByteArrayOutputStream);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IByteArrayOutputStream;
+    }
+
+    virtual ECode Reset() = 0;
+
+    virtual ECode GetSize(
+        /* [out] */ Integer* size) = 0;
+
+    virtual ECode ToByteArray(
+        /* [out, callee] */ Array<Byte>* array) = 0;
+
+    virtual ECode ToString(
+        /* [out] */ String* desc) = 0;
+
+    virtual ECode ToString(
+        /* [in] */ const String& charsetName,
+        /* [out] */ String* desc) = 0;
+
+    virtual ECode WriteTo(
+        /* [in] */ ccm::io::IOutputStream* outs) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IBYTEARRAYOUTPUTSTREAM_H_GEN__
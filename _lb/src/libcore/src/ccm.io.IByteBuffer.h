@@ -0,0 +1,211 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IBYTEBUFFER_H_GEN__
+#define __CCM_IO_IBYTEBUFFER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IByteBuffer;
+
+INTERFACE_ID(0a78992f-b55e-40bc-933b-f35b1046cc45)
+interface IByteBuffer : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IByteBuffer* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IByteBuffer*)object->Probe(IID_IByteBuffer);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IByteBuffer;
+    }
+
+    virtual ECode AsCharBuffer(
+        /* [out] */ ccm::io::ICharBuffer** buffer) = 0;
+
+    virtual ECode AsDoubleBuffer(
+        /* [out] */ ccm::io::IDoubleBuffer** buffer) = 0;
+
+    virtual ECode AsFloatBuffer(
+        /* [out] */ ccm::io::IFloatBuffer** buffer) = 0;
+
+    virtual ECode AsIntegerBuffer(
+        /* [out] */ ccm::io::IIntegerBuffer** buffer) = 0;
+
+    virtual ECode AsLongBuffer(
+        /* [out] */ ccm::io::ILongBuffer** buffer) = 0;
+
+    virtual ECode AsReadOnlyBuffer(
+        /* [out] */ ccm::io::IByteBuffer** buffer) = 0;
+
+    virtual ECode AsShortBuffer(
+        /* [out] */ ccm::io::IShortBuffer** buffer) = 0;
+
+    virtual ECode Compact() = 0;
+
+    virtual ECode Duplicate(
+        /* [out] */ ccm::io::IByteBuffer** buffer) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Byte* b) = 0;
+
+    virtual ECode Get(
+        /* [in] */ Integer index,
+        /* [out] */ Byte* b) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Array<Byte>& dst) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Array<Byte>& dst,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer length) = 0;
+
+    virtual ECode GetChar(
+        /* [out] */ Char* c) = 0;
+
+    virtual ECode GetChar(
+        /* [in] */ Integer index,
+        /* [out] */ Char* c) = 0;
+
+    virtual ECode GetDouble(
+        /* [out] */ Double* d) = 0;
+
+    virtual ECode GetDouble(
+        /* [in] */ Integer index,
+        /* [out] */ Double* d) = 0;
+
+    virtual ECode GetFloat(
+        /* [out] */ Float* f) = 0;
+
+    virtual ECode GetFloat(
+        /* [in] */ Integer index,
+        /* [out] */ Float* f) = 0;
+
+    virtual ECode GetInteger(
+        /* [out] */ Integer* i) = 0;
+
+    virtual ECode GetInteger(
+        /* [in] */ Integer index,
+        /* [out] */ Integer* i) = 0;
+
+    virtual ECode GetLong(
+        /* [out] */ Long* l) = 0;
+
+    virtual ECode GetLong(
+        /* [in] */ Integer index,
+        /* [out] */ Long* l) = 0;
+
+    virtual ECode GetOrder(
+        /* [out] */ ccm::io::IByteOrder** bo) = 0;
+
+    virtual ECode GetShort(
+        /* [out] */ Short* s) = 0;
+
+    virtual ECode GetShort(
+        /* [in] */ Integer index,
+        /* [out] */ Short* s) = 0;
+
+    virtual ECode HasArray(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode IsAccessible(
+        /* [out] */ Boolean* accessible) = 0;
+
+    virtual ECode Put(
+        /* [in] */ Byte b) = 0;
+
+    virtual ECode Put(
+        /* [in] */ Integer index,
+        /* [in] */ Byte b) = 0;
+
+    virtual ECode Put(
+        /* [in] */ ccm::io::IByteBuffer* src) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const Array<Byte>& src) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const Array<Byte>& src,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer length) = 0;
+
+    virtual ECode PutChar(
+        /* [in] */ Char value) = 0;
+
+    virtual ECode PutChar(
+        /* [in] */ Integer index,
+        /* [in] */ Char value) = 0;
+
+    virtual ECode PutDouble(
+        /* [in] */ Double value) = 0;
+
+    virtual ECode PutDouble(
+        /* [in] */ Integer index,
+        /* [in] */ Double value) = 0;
+
+    virtual ECode PutFloat(
+        /* [in] */ Float value) = 0;
+
+    virtual ECode PutFloat(
+        /* [in] */ Integer index,
+        /* [in] */ Float value) = 0;
+
+    virtual ECode PutInteger(
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode PutInteger(
+        /* [in] */ Integer index,
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode PutLong(
+        /* [in] */ Long value) = 0;
+
+    virtual ECode PutLong(
+        /* [in] */ Integer index,
+        /* [in] */ Long value) = 0;
+
+    virtual ECode PutShort(
+        /* [in] */ Short value) = 0;
+
+    virtual ECode PutShort(
+        /* [in] */ Integer index,
+        /* [in] */ Short value) = 0;
+
+    virtual ECode SetAccessible(
+        /* [in] */ Boolean value) = 0;
+
+    virtual ECode SetOrder(
+        /* [in] */ ccm::io::IByteOrder* bo) = 0;
+
+    virtual ECode Slice(
+        /* [out] */ ccm::io::IByteBuffer** buffer) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IBYTEBUFFER_H_GEN__
@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IBYTEORDER_H_GEN__
+#define __CCM_IO_IBYTEORDER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IByteOrder;
+
+INTERFACE_ID(079172f5-93a1-40bb-beae-a08786d9b9aa)
+interface IByteOrder : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IByteOrder* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IByteOrder*)object->Probe(IID_IByteOrder);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IByteOrder;
+    }
+
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IBYTEORDER_H_GEN__
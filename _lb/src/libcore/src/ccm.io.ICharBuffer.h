@@ -0,0 +1,116 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_ICHARBUFFER_H_GEN__
+#define __CCM_IO_ICHARBUFFER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_ICharBuffer;
+
+INTERFACE_ID(c1f712ff-c3af-4ac8-9ffa-1439d81831c8)
+interface ICharBuffer : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICharBuffer* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICharBuffer*)object->Probe(IID_ICharBuffer);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICharBuffer;
+    }
+
+    virtual ECode AsReadOnlyBuffer(
+        /* [out] */ ccm::io::ICharBuffer** buffer) = 0;
+
+    virtual ECode Compact() = 0;
+
+    virtual ECode Duplicate(
+        /* [out] */ ccm::io::ICharBuffer** buffer) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Char* c) = 0;
+
+    virtual ECode Get(
+        /* [in] */ Integer index,
+        /* [out] */ Char* c) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Array<Char>& dst) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Array<Char>& dst,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer length) = 0;
+
+    virtual ECode GetOrder(
+        /* [out] */ ccm::io::IByteOrder** bo) = 0;
+
+    virtual ECode HasArray(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Put(
+        /* [in] */ Char c) = 0;
+
+    virtual ECode Put(
+        /* [in] */ Integer index,
+        /* [in] */ Char c) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const Array<Char>& src) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const Array<Char>& src,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer length) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const String& src) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const String& src,
+        /* [in] */ Integer start,
+        /* [in] */ Integer end) = 0;
+
+    virtual ECode Put(
+        /* [in] */ ccm::io::ICharBuffer* src) = 0;
+
+    virtual ECode Slice(
+        /* [out] */ ccm::io::ICharBuffer** buffer) = 0;
+
+    virtual ECode ToString(
+        /* [out] */ String* desc) = 0;
+
+    virtual ECode ToString(
+        /* [in] */ Integer start,
+        /* [in] */ Integer end,
+        /* [out] */ String* desc) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_ICHARBUFFER_H_GEN__
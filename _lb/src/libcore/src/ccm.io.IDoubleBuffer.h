@@ -0,0 +1,100 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IDOUBLEBUFFER_H_GEN__
+#define __CCM_IO_IDOUBLEBUFFER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IDoubleBuffer;
+
+INTERFACE_ID(23485c78-6782-4d5f-8d30-55cf6a6e5dde)
+interface IDoubleBuffer : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDoubleBuffer* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDoubleBuffer*)object->Probe(IID_IDoubleBuffer);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDoubleBuffer;
+    }
+
+    virtual ECode AsReadOnlyBuffer(
+        /* [out] */ ccm::io::IDoubleBuffer** buffer) = 0;
+
+    virtual ECode Compact() = 0;
+
+    virtual ECode Duplicate(
+        /* [out] */ ccm::io::IDoubleBuffer** buffer) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Double* d) = 0;
+
+    virtual ECode Get(
+        /* [in] */ Integer index,
+        /* [out] */ Double* d) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Array<Double>& dst) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Array<Double>& dst,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer length) = 0;
+
+    virtual ECode GetOrder(
+        /* [out] */ ccm::io::IByteOrder** bo) = 0;
+
+    virtual ECode HasArray(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Put(
+        /* [in] */ Double d) = 0;
+
+    virtual ECode Put(
+        /* [in] */ Integer index,
+        /* [in] */ Double d) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const Array<Double>& src) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const Array<Double>& src,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer length) = 0;
+
+    virtual ECode Put(
+        /* [in] */ ccm::io::IDoubleBuffer* src) = 0;
+
+    virtual ECode Slice(
+        /* [out] */ ccm::io::IDoubleBuffer** buffer) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IDOUBLEBUFFER_H_GEN__
@@ -0,0 +1,192 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IFILE_H_GEN__
+#define __CCM_IO_IFILE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IFile;
+
+INTERFACE_ID(64d64034-3b89-4cc0-b446-d20c3a6a0f8f)
+interface IFile : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFile* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFile*)object->Probe(IID_IFile);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFile;
+    }
+
+    virtual ECode CanExecute(
+        /* [out] */ Boolean* executable) = 0;
+
+    virtual ECode CanRead(
+        /* [out] */ Boolean* readable) = 0;
+
+    virtual ECode CanWrite(
+        /* [out] */ Boolean* writeable) = 0;
+
+    virtual ECode CreateNewFile(
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode Delete(
+        /* [out] */ Boolean* succeeded = nullptr) = 0;
+
+    virtual ECode DeleteOnExit() = 0;
+
+    virtual ECode Exists(
+        /* [out] */ Boolean* existed) = 0;
+
+    virtual ECode GetAbsoluteFile(
+        /* [out] */ ccm::io::IFile** f) = 0;
+
+    virtual ECode GetAbsolutePath(
+        /* [out] */ String* path) = 0;
+
+    virtual ECode GetCanonicalFile(
+        /* [out] */ ccm::io::IFile** f) = 0;
+
+    virtual ECode GetCanonicalPath(
+        /* [out] */ String* path) = 0;
+
+    virtual ECode GetFreeSpace(
+        /* [out] */ Long* space) = 0;
+
+    virtual ECode GetLength(
+        /* [out] */ Long* len) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetParent(
+        /* [out] */ String* parent) = 0;
+
+    virtual ECode GetParentFile(
+        /* [out] */ ccm::io::IFile** parent) = 0;
+
+    virtual ECode GetPath(
+        /* [out] */ String* path) = 0;
+
+    virtual ECode GetPrefixLength(
+        /* [out] */ Integer* length) = 0;
+
+    virtual ECode GetTotalSpace(
+        /* [out] */ Long* space) = 0;
+
+    virtual ECode GetUsableSpace(
+        /* [out] */ Long* space) = 0;
+
+    virtual ECode IsAbsolute(
+        /* [out] */ Boolean* absolute) = 0;
+
+    virtual ECode IsDirectory(
+        /* [out] */ Boolean* directory) = 0;
+
+    virtual ECode IsFile(
+        /* [out] */ Boolean* file) = 0;
+
+    virtual ECode IsHidden(
+        /* [out] */ Boolean* hidden) = 0;
+
+    virtual ECode LastModified(
+        /* [out] */ Long* time) = 0;
+
+    virtual ECode List(
+        /* [out, callee] */ Array<String>* files) = 0;
+
+    virtual ECode List(
+        /* [in] */ ccm::io::IFilenameFilter* filter,
+        /* [out, callee] */ Array<String>* files) = 0;
+
+    virtual ECode ListFiles(
+        /* [out, callee] */ Array<ccm::io::IFile*>* files) = 0;
+
+    virtual ECode ListFiles(
+        /* [in] */ ccm::io::IFilenameFilter* filter,
+        /* [out, callee] */ Array<ccm::io::IFile*>* files) = 0;
+
+    virtual ECode ListFiles(
+        /* [in] */ ccm::io::IFileFilter* filter,
+        /* [out, callee] */ Array<ccm::io::IFile*>* files) = 0;
+
+    virtual ECode Mkdir(
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode Mkdirs(
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode RenameTo(
+        /* [in] */ ccm::io::IFile* dest,
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode SetExecutable(
+        /* [in] */ Boolean executable,
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode SetExecutable(
+        /* [in] */ Boolean executable,
+        /* [in] */ Boolean ownerOnly,
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode SetLastModified(
+        /* [in] */ Long time,
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode SetReadOnly(
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode SetReadable(
+        /* [in] */ Boolean readable,
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode SetReadable(
+        /* [in] */ Boolean readable,
+        /* [in] */ Boolean ownerOnly,
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode SetWritable(
+        /* [in] */ Boolean writable,
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode SetWritable(
+        /* [in] */ Boolean writable,
+        /* [in] */ Boolean ownerOnly,
+        /* [out] */ Boolean* succeeded) = 0;
+
+    virtual ECode ToURI(
+        /* [out] */ ccm::net::IURI** id) = 0;
+
+    virtual ECode ToURL(
+        /* [out] */ ccm::net::IURL** locator) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IFILE_H_GEN__
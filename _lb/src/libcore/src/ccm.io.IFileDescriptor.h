@@ -0,0 +1,64 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IFILEDESCRIPTOR_H_GEN__
+#define __CCM_IO_IFILEDESCRIPTOR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IFileDescriptor;
+
+INTERFACE_ID(1a03d7ff-b6c9-4cb2-a30a-af6a5c6733e2)
+interface IFileDescriptor : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFileDescriptor* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFileDescriptor*)object->Probe(IID_IFileDescriptor);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFileDescriptor;
+    }
+
+    virtual ECode GetInt(
+        /* [out] */ Integer* fd) = 0;
+
+    virtual ECode IsSocket(
+        /* [out] */ Boolean* socket) = 0;
+
+    virtual ECode SetInt(
+        /* [in] */ Integer fd) = 0;
+
+    virtual ECode Sync() = 0;
+
+    virtual ECode Valid(
+        /* [out] */ Boolean* valid) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IFILEDESCRIPTOR_H_GEN__
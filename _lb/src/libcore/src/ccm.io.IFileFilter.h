@@ -0,0 +1,54 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IFILEFILTER_H_GEN__
+#define __CCM_IO_IFILEFILTER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IFileFilter;
+
+INTERFACE_ID(5135c5a7-1174-430b-93f6-548b17a436cf)
+interface IFileFilter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFileFilter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFileFilter*)object->Probe(IID_IFileFilter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFileFilter;
+    }
+
+    virtual ECode Accept(
+        /* [in] */ ccm::io::IFile* pathname,
+        /* [out] */ Boolean* accepted) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IFILEFILTER_H_GEN__
@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IFILEINPUTSTREAM_H_GEN__
+#define __CCM_IO_IFILEINPUTSTREAM_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IFileInputStream;
+
+INTERFACE_ID(4062b7ff-4bea-4200-a9f6-8d2b706956fc)
+interface IFileInputStream : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFileInputStream* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFileInputStream*)object->Probe(IID_IFileInputStream);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFileInputStream;
+    }
+
+    virtual ECode GetChannel(
+        /* [out] */ ccm::io::channels::IFileChannel** channel) = 0;
+
+    virtual ECode GetFD(
+        /* [out] */ ccm::io::IFileDescriptor** fd) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IFILEINPUTSTREAM_H_GEN__
@@ -0,0 +1,55 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IFILENAMEFILTER_H_GEN__
+#define __CCM_IO_IFILENAMEFILTER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IFilenameFilter;
+
+INTERFACE_ID(0b2dca26-5399-4264-b1cb-af295694925b)
+interface IFilenameFilter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFilenameFilter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFilenameFilter*)object->Probe(IID_IFilenameFilter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFilenameFilter;
+    }
+
+    virtual ECode Accept(
+        /* [in] */ ccm::io::IFile* dir,
+        /* [in] */ const String& name,
+        /* [out] */ Boolean* accepted) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IFILENAMEFILTER_H_GEN__
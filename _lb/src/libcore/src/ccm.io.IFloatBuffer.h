@@ -0,0 +1,100 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IFLOATBUFFER_H_GEN__
+#define __CCM_IO_IFLOATBUFFER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IFloatBuffer;
+
+INTERFACE_ID(6cac7adc-080b-417f-ab85-d0821bf88423)
+interface IFloatBuffer : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFloatBuffer* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFloatBuffer*)object->Probe(IID_IFloatBuffer);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFloatBuffer;
+    }
+
+    virtual ECode AsReadOnlyBuffer(
+        /* [out] */ ccm::io::IFloatBuffer** buffer) = 0;
+
+    virtual ECode Compact() = 0;
+
+    virtual ECode Duplicate(
+        /* [out] */ ccm::io::IFloatBuffer** buffer) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Float* f) = 0;
+
+    virtual ECode Get(
+        /* [in] */ Integer index,
+        /* [out] */ Float* f) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Array<Float>& dst) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Array<Float>& dst,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer length) = 0;
+
+    virtual ECode GetOrder(
+        /* [out] */ ccm::io::IByteOrder** bo) = 0;
+
+    virtual ECode HasArray(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Put(
+        /* [in] */ Float f) = 0;
+
+    virtual ECode Put(
+        /* [in] */ Integer index,
+        /* [in] */ Float f) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const Array<Float>& src) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const Array<Float>& src,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer length) = 0;
+
+    virtual ECode Put(
+        /* [in] */ ccm::io::IFloatBuffer* src) = 0;
+
+    virtual ECode Slice(
+        /* [out] */ ccm::io::IFloatBuffer** buffer) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IFLOATBUFFER_H_GEN__
@@ -0,0 +1,80 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IINPUTSTREAM_H_GEN__
+#define __CCM_IO_IINPUTSTREAM_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IInputStream;
+
+INTERFACE_ID(ffea83b0-bb5d-4a13-b9e8-9a430b97e854)
+interface IInputStream : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IInputStream* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IInputStream*)object->Probe(IID_IInputStream);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IInputStream;
+    }
+
+    virtual ECode Available(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode Close() = 0;
+
+    virtual ECode IsMarkSupported(
+        /* [out] */ Boolean* supported) = 0;
+
+    virtual ECode Mark(
+        /* [in] */ Integer readLimit) = 0;
+
+    virtual ECode Read(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode Read(
+        /* [out] */ Array<Byte>& buffer,
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode Read(
+        /* [out] */ Array<Byte>& buffer,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer size,
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode Reset() = 0;
+
+    virtual ECode Skip(
+        /* [in] */ Long byteCount,
+        /* [out] */ Long* number) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IINPUTSTREAM_H_GEN__
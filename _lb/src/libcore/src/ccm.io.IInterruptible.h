@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IINTERRUPTIBLE_H_GEN__
+#define __CCM_IO_IINTERRUPTIBLE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IInterruptible;
+
+INTERFACE_ID(f6e25f86-4f88-4e18-bd93-e1dea5bcf946)
+interface IInterruptible : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IInterruptible* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IInterruptible*)object->Probe(IID_IInterruptible);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IInterruptible;
+    }
+
+    virtual ECode Interrupt(
+        /* [in] */ ccm::core::IThread* t) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IINTERRUPTIBLE_H_GEN__
@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IOBJECTINPUT_H_GEN__
+#define __CCM_IO_IOBJECTINPUT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IObjectInput;
+
+INTERFACE_ID(bd7676a1-7d70-4404-9df0-d33ed812e903)
+interface IObjectInput : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IObjectInput* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IObjectInput*)object->Probe(IID_IObjectInput);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IObjectInput;
+    }
+
+    virtual ECode ReadObject(
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IOBJECTINPUT_H_GEN__
@@ -0,0 +1,65 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IOUTPUTSTREAM_H_GEN__
+#define __CCM_IO_IOUTPUTSTREAM_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IOutputStream;
+
+INTERFACE_ID(46274ade-a4d4-4200-8d95-59b40160cf68)
+interface IOutputStream : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IOutputStream* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IOutputStream*)object->Probe(IID_IOutputStream);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IOutputStream;
+    }
+
+    virtual ECode Close() = 0;
+
+    virtual ECode Flush() = 0;
+
+    virtual ECode Write(
+        /* [in] */ Integer byte) = 0;
+
+    virtual ECode Write(
+        /* [in] */ const Array<Byte>& buffer) = 0;
+
+    virtual ECode Write(
+        /* [in] */ const Array<Byte>& buffer,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer size) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IOUTPUTSTREAM_H_GEN__
@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IOUTPUTSTREAMWRITER_H_GEN__
+#define __CCM_IO_IOUTPUTSTREAMWRITER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IOutputStreamWriter;
+
+INTERFACE_ID(3bebf7a8-0001-4ad5-8b5a-b0353070b31d)
+interface IOutputStreamWriter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IOutputStreamWriter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IOutputStreamWriter*)object->Probe(IID_IOutputStreamWriter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IOutputStreamWriter;
+    }
+
+    virtual ECode GetEncoding(
+        /* [out] */ String* name) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IOUTPUTSTREAMWRITER_H_GEN__
@@ -0,0 +1,62 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IPRINTSTREAM_H_GEN__
+#define __CCM_IO_IPRINTSTREAM_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IPrintStream;
+
+INTERFACE_ID(831a7565-e7f6-4b29-af91-f8c0f012f441)
+interface IPrintStream : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IPrintStream* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IPrintStream*)object->Probe(IID_IPrintStream);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IPrintStream;
+    }
+
+    virtual ECode CheckError(
+        /* [out] */ Boolean* hasErrors) = 0;
+
+    virtual ECode Print(
+        /* [in] */ const String& s) = 0;
+
+    virtual ECode Println(
+        /* [in] */ const String& s) = 0;
+
+    virtual ECode Println(
+        /* [in] */ ccm::IInterface* x) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IPRINTSTREAM_H_GEN__
@@ -0,0 +1,127 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IPRINTWRITER_H_GEN__
+#define __CCM_IO_IPRINTWRITER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IPrintWriter;
+
+INTERFACE_ID(680fba48-d41b-4a09-9b10-7077eada7b89)
+interface IPrintWriter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IPrintWriter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IPrintWriter*)object->Probe(IID_IPrintWriter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IPrintWriter;
+    }
+
+    virtual ECode CheckError(
+        /* [out] */ Boolean* hasErrors) = 0;
+
+    virtual ECode Format(
+        /* [in] */ const String& format,
+        /* [in] */ const Array<ccm::IInterface*>* args) = 0;
+
+    virtual ECode Format(
+        /* [in] */ ccm::util::ILocale* l,
+        /* [in] */ const String& format,
+        /* [in] */ const Array<ccm::IInterface*>* args) = 0;
+
+    virtual ECode Print(
+        /* [in] */ Boolean b) = 0;
+
+    virtual ECode PrintChar(
+        /* [in] */ Char c) = 0;
+
+    virtual ECode Print(
+        /* [in] */ Integer i) = 0;
+
+    virtual ECode Print(
+        /* [in] */ Long l) = 0;
+
+    virtual ECode Print(
+        /* [in] */ Float f) = 0;
+
+    virtual ECode Print(
+        /* [in] */ Double d) = 0;
+
+    virtual ECode Print(
+        /* [in] */ const Array<Char>& s) = 0;
+
+    virtual ECode Print(
+        /* [in] */ const String& s) = 0;
+
+    virtual ECode Print(
+        /* [in] */ ccm::IInterface* obj) = 0;
+
+    virtual ECode Printf(
+        /* [in] */ const String& format,
+        /* [in] */ const Array<ccm::IInterface*>* args) = 0;
+
+    virtual ECode Printf(
+        /* [in] */ ccm::util::ILocale* l,
+        /* [in] */ const String& format,
+        /* [in] */ const Array<ccm::IInterface*>* args) = 0;
+
+    virtual ECode Println() = 0;
+
+    virtual ECode Println(
+        /* [in] */ Boolean b) = 0;
+
+    virtual ECode PrintCharln(
+        /* [in] */ Char c) = 0;
+
+    virtual ECode Println(
+        /* [in] */ Integer i) = 0;
+
+    virtual ECode Println(
+        /* [in] */ Long l) = 0;
+
+    virtual ECode Println(
+        /* [in] */ Float f) = 0;
+
+    virtual ECode Println(
+        /* [in] */ Double x) = 0;
+
+    virtual ECode Println(
+        /* [in] */ const Array<Char>& s) = 0;
+
+    virtual ECode Println(
+        /* [in] */ const String& s) = 0;
+
+    virtual ECode Println(
+        /* [in] */ ccm::IInterface* obj) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IPRINTWRITER_H_GEN__
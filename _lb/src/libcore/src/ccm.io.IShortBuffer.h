@@ -0,0 +1,100 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_ISHORTBUFFER_H_GEN__
+#define __CCM_IO_ISHORTBUFFER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IShortBuffer;
+
+INTERFACE_ID(0a781618-7e19-4a2c-8ec1-cf28db24247b)
+interface IShortBuffer : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IShortBuffer* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IShortBuffer*)object->Probe(IID_IShortBuffer);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IShortBuffer;
+    }
+
+    virtual ECode AsReadOnlyBuffer(
+        /* [out] */ ccm::io::IShortBuffer** buffer) = 0;
+
+    virtual ECode Compact() = 0;
+
+    virtual ECode Duplicate(
+        /* [out] */ ccm::io::IShortBuffer** buffer) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Short* s) = 0;
+
+    virtual ECode Get(
+        /* [in] */ Integer index,
+        /* [out] */ Short* s) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Array<Short>& dst) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Array<Short>& dst,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer length) = 0;
+
+    virtual ECode GetOrder(
+        /* [out] */ ccm::io::IByteOrder** bo) = 0;
+
+    virtual ECode HasArray(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Put(
+        /* [in] */ Short s) = 0;
+
+    virtual ECode Put(
+        /* [in] */ Integer index,
+        /* [in] */ Short s) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const Array<Short>& src) = 0;
+
+    virtual ECode Put(
+        /* [in] */ const Array<Short>& src,
+        /* [in] */ Integer offset,
+        /* [in] */ Integer length) = 0;
+
+    virtual ECode Put(
+        /* [in] */ ccm::io::IShortBuffer* src) = 0;
+
+    virtual ECode Slice(
+        /* [out] */ ccm::io::IShortBuffer** buffer) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_ISHORTBUFFER_H_GEN__
@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_ISTRINGWRITER_H_GEN__
+#define __CCM_IO_ISTRINGWRITER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IStringWriter;
+
+INTERFACE_ID(29322ab7-52c0-4dea-afbd-8d6961eb6334)
+interface IStringWriter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStringWriter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStringWriter*)object->Probe(IID_IStringWriter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStringWriter;
+    }
+
+    virtual ECode GetBuffer(
+        /* [out] */ ccm::core::IStringBuffer** buf) = 0;
+
+    virtual ECode ToString(
+        /* [out] */ String* str) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_ISTRINGWRITER_H_GEN__
@@ -0,0 +1,84 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_IWRITER_H_GEN__
+#define __CCM_IO_IWRITER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+
+extern const InterfaceID IID_IWriter;
+
+INTERFACE_ID(cca035d8-6f23-4eac-a581-294d5ff8c41f)
+interface IWriter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IWriter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IWriter*)object->Probe(IID_IWriter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IWriter;
+    }
+
+    virtual ECode Append(
+        /* [in] */ ccm::core::ICharSequence* csq) = 0;
+
+    virtual ECode Append(
+        /* [in] */ ccm::core::ICharSequence* csq,
+        /* [in] */ Integer start,
+        /* [in] */ Integer end) = 0;
+
+    virtual ECode Append(
+        /* [in] */ Char c) = 0;
+
+    virtual ECode Close() = 0;
+
+    virtual ECode Flush() = 0;
+
+    virtual ECode Write(
+        /* [in] */ Integer c) = 0;
+
+    virtual ECode Write(
+        /* [in] */ const Array<Char>& buffer) = 0;
+
+    virtual ECode Write(
+        /* [in] */ const Array<Char>& buffer,
+        /* [in] */ Integer off,
+        /* [in] */ Integer len) = 0;
+
+    virtual ECode Write(
+        /* [in] */ const String& str) = 0;
+
+    virtual ECode Write(
+        /* [in] */ const String& str,
+        /* [in] */ Integer off,
+        /* [in] */ Integer len) = 0;
+};
+
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_IWRITER_H_GEN__
@@ -0,0 +1,58 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_CHANNELS_IDIRECTBUFFER_H_GEN__
+#define __CCM_IO_CHANNELS_IDIRECTBUFFER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+namespace channels {
+
+extern const InterfaceID IID_IDirectBuffer;
+
+INTERFACE_ID(feb0f6eb-d808-4e28-8d3e-f4cf0786dfed)
+interface IDirectBuffer : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDirectBuffer* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDirectBuffer*)object->Probe(IID_IDirectBuffer);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDirectBuffer;
+    }
+
+    virtual ECode GetAddress(
+        /* [out] */ HANDLE* addr) = 0;
+
+    virtual ECode GetAttachment(
+        /* [out] */ ccm::IInterface** attachment) = 0;
+};
+
+} // namespace channels
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_CHANNELS_IDIRECTBUFFER_H_GEN__
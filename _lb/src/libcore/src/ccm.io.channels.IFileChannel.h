@@ -0,0 +1,54 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_CHANNELS_IFILECHANNEL_H_GEN__
+#define __CCM_IO_CHANNELS_IFILECHANNEL_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+namespace channels {
+
+extern const InterfaceID IID_IFileChannel;
+
+INTERFACE_ID(b13cff36-f461-4a6f-807b-66c9a45d6531)
+interface IFileChannel : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFileChannel* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFileChannel*)object->Probe(IID_IFileChannel);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFileChannel;
+    }
+
+    virtual ECode Close() = 0;
+};
+
+} // namespace channels
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_CHANNELS_IFILECHANNEL_H_GEN__
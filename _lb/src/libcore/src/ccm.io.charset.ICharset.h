@@ -0,0 +1,93 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_CHARSET_ICHARSET_H_GEN__
+#define __CCM_IO_CHARSET_ICHARSET_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+namespace charset {
+
+extern const InterfaceID IID_ICharset;
+
+INTERFACE_ID(8f4224e5-badb-44aa-828b-f92bd0ad6740)
+interface ICharset : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICharset* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICharset*)object->Probe(IID_ICharset);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICharset;
+    }
+
+    virtual ECode CanEncode(
+        /* [out] */ Boolean* supported) = 0;
+
+    virtual ECode Contains(
+        /* [in] */ ccm::io::charset::ICharset* cs,
+        /* [out] */ Boolean* contains) = 0;
+
+    virtual ECode Decode(
+        /* [in] */ ccm::io::IByteBuffer* bb,
+        /* [out] */ ccm::io::ICharBuffer** cb) = 0;
+
+    virtual ECode Encode(
+        /* [in] */ const String& str,
+        /* [out] */ ccm::io::IByteBuffer** bb) = 0;
+
+    virtual ECode Encode(
+        /* [in] */ ccm::io::ICharBuffer* cb,
+        /* [out] */ ccm::io::IByteBuffer** bb) = 0;
+
+    virtual ECode GetAliases(
+        /* [out] */ ccm::util::ISet** aliases) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode IsRegistered(
+        /* [out] */ Boolean* registered) = 0;
+
+    virtual ECode NewDecoder(
+        /* [out] */ ccm::io::charset::ICharsetDecoder** decoder) = 0;
+
+    virtual ECode NewEncoder(
+        /* [out] */ ccm::io::charset::ICharsetEncoder** encoder) = 0;
+};
+
+} // namespace charset
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_CHARSET_ICHARSET_H_GEN__
@@ -0,0 +1,104 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_CHARSET_ICHARSETDECODER_H_GEN__
+#define __CCM_IO_CHARSET_ICHARSETDECODER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+namespace charset {
+
+extern const InterfaceID IID_ICharsetDecoder;
+
+INTERFACE_ID(47bf0779-f294-46c6-b8cd-bcd6de278171)
+interface ICharsetDecoder : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICharsetDecoder* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICharsetDecoder*)object->Probe(IID_ICharsetDecoder);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICharsetDecoder;
+    }
+
+    virtual ECode Decode(
+        /* [in] */ ccm::io::IByteBuffer* bb,
+        /* [out] */ ccm::io::ICharBuffer** cb) = 0;
+
+    virtual ECode Decode(
+        /* [in] */ ccm::io::IByteBuffer* bb,
+        /* [out] */ ccm::io::ICharBuffer* cb,
+        /* [in] */ Boolean endOfInput,
+        /* [out] */ ccm::io::charset::ICoderResult** result) = 0;
+
+    virtual ECode Flush(
+        /* [out] */ ccm::io::ICharBuffer* cb,
+        /* [out] */ ccm::io::charset::ICoderResult** result) = 0;
+
+    virtual ECode GetAverageCharsPerByte(
+        /* [out] */ Float* averageCharsPerByte) = 0;
+
+    virtual ECode GetCharset(
+        /* [out] */ ccm::io::charset::ICharset** cs) = 0;
+
+    virtual ECode GetDetectedCharset(
+        /* [out] */ ccm::io::charset::ICharset** cs) = 0;
+
+    virtual ECode GetMalformedInputAction(
+        /* [out] */ ccm::io::charset::ICodingErrorAction** action) = 0;
+
+    virtual ECode GetMaxCharsPerByte(
+        /* [out] */ Float* maxCharsPerByte) = 0;
+
+    virtual ECode GetReplacement(
+        /* [out] */ String* replacement) = 0;
+
+    virtual ECode GetUnmappableCharacterAction(
+        /* [out] */ ccm::io::charset::ICodingErrorAction** action) = 0;
+
+    virtual ECode IsAutoDetecting(
+        /* [out] */ Boolean* autoDetecting) = 0;
+
+    virtual ECode IsCharsetDetected(
+        /* [out] */ Boolean* charsetDetected) = 0;
+
+    virtual ECode OnMalformedInput(
+        /* [in] */ ccm::io::charset::ICodingErrorAction* newAction) = 0;
+
+    virtual ECode OnUnmappableCharacter(
+        /* [in] */ ccm::io::charset::ICodingErrorAction* newAction) = 0;
+
+    virtual ECode ReplaceWith(
+        /* [in] */ const String& newReplacement) = 0;
+
+    virtual ECode Reset() = 0;
+};
+
+} // namespace charset
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_CHARSET_ICHARSETDECODER_H_GEN__
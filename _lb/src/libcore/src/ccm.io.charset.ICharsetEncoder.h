@@ -0,0 +1,107 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_CHARSET_ICHARSETENCODER_H_GEN__
+#define __CCM_IO_CHARSET_ICHARSETENCODER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+namespace charset {
+
+extern const InterfaceID IID_ICharsetEncoder;
+
+INTERFACE_ID(1b6e3b85-c728-4a3f-a840-1d7b0eacc764)
+interface ICharsetEncoder : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICharsetEncoder* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICharsetEncoder*)object->Probe(IID_ICharsetEncoder);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICharsetEncoder;
+    }
+
+    virtual ECode CanEncode(
+        /* [in] */ Char c,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode CanEncode(
+        /* [in] */ ccm::core::ICharSequence* cs,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Encode(
+        /* [in] */ ccm::io::ICharBuffer* cb,
+        /* [out] */ ccm::io::IByteBuffer** bb) = 0;
+
+    virtual ECode Encode(
+        /* [in] */ ccm::io::ICharBuffer* cb,
+        /* [out] */ ccm::io::IByteBuffer* bb,
+        /* [in] */ Boolean endOfInput,
+        /* [out] */ ccm::io::charset::ICoderResult** result) = 0;
+
+    virtual ECode Flush(
+        /* [out] */ ccm::io::IByteBuffer* bb,
+        /* [out] */ ccm::io::charset::ICoderResult** result) = 0;
+
+    virtual ECode GetAverageBytesPerChar(
+        /* [out] */ Float* averageBytesPerChar) = 0;
+
+    virtual ECode GetCharset(
+        /* [out] */ ccm::io::charset::ICharset** cs) = 0;
+
+    virtual ECode GetMalformedInputAction(
+        /* [out] */ ccm::io::charset::ICodingErrorAction** action) = 0;
+
+    virtual ECode GetMaxBytesPerChar(
+        /* [out] */ Float* maxBytesPerChar) = 0;
+
+    virtual ECode GetReplacement(
+        /* [out, callee] */ Array<Byte>* replacement) = 0;
+
+    virtual ECode GetUnmappableCharacterAction(
+        /* [out] */ ccm::io::charset::ICodingErrorAction** action) = 0;
+
+    virtual ECode IsLegalReplacement(
+        /* [in] */ const Array<Byte>& repl,
+        /* [out] */ Boolean* isLegal) = 0;
+
+    virtual ECode OnMalformedInput(
+        /* [in] */ ccm::io::charset::ICodingErrorAction* newAction) = 0;
+
+    virtual ECode OnUnmappableCharacter(
+        /* [in] */ ccm::io::charset::ICodingErrorAction* newAction) = 0;
+
+    virtual ECode ReplaceWith(
+        /* [in] */ const Array<Byte>& newReplacement) = 0;
+
+    virtual ECode Reset() = 0;
+};
+
+} // namespace charset
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_CHARSET_ICHARSETENCODER_H_GEN__
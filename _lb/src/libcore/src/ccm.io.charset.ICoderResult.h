@@ -0,0 +1,72 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_CHARSET_ICODERRESULT_H_GEN__
+#define __CCM_IO_CHARSET_ICODERRESULT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+namespace charset {
+
+extern const InterfaceID IID_ICoderResult;
+
+INTERFACE_ID(038b7c78-8610-4986-8aee-b9e1a56971a5)
+interface ICoderResult : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICoderResult* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICoderResult*)object->Probe(IID_ICoderResult);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICoderResult;
+    }
+
+    virtual ECode GetLength(
+        /* [out] */ Integer* length) = 0;
+
+    virtual ECode IsError(
+        /* [out] */ Boolean* error) = 0;
+
+    virtual ECode IsMalformed(
+        /* [out] */ Boolean* malformed) = 0;
+
+    virtual ECode IsOverflow(
+        /* [out] */ Boolean* overflow) = 0;
+
+    virtual ECode IsUnderflow(
+        /* [out] */ Boolean* underflow) = 0;
+
+    virtual ECode IsUnmappable(
+        /* [out] */ Boolean* unmappable) = 0;
+
+    virtual ECode ThrowException() = 0;
+};
+
+} // namespace charset
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_CHARSET_ICODERRESULT_H_GEN__
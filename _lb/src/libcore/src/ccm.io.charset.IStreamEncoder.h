@@ -0,0 +1,57 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_CHARSET_ISTREAMENCODER_H_GEN__
+#define __CCM_IO_CHARSET_ISTREAMENCODER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+namespace charset {
+
+extern const InterfaceID IID_IStreamEncoder;
+
+INTERFACE_ID(9fb9b9f9-552f-482a-be03-453649bd9232)
+interface IStreamEncoder : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStreamEncoder* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStreamEncoder*)object->Probe(IID_IStreamEncoder);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStreamEncoder;
+    }
+
+    virtual ECode FlushBuffer() = 0;
+
+    virtual ECode GetEncoding(
+        /* [out] */ String* str) = 0;
+};
+
+} // namespace charset
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_CHARSET_ISTREAMENCODER_H_GEN__
@@ -0,0 +1,61 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_IO_CHARSET_SPI_ICHARSETPROVIDER_H_GEN__
+#define __CCM_IO_CHARSET_SPI_ICHARSETPROVIDER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace io {
+namespace charset {
+namespace spi {
+
+extern const InterfaceID IID_ICharsetProvider;
+
+INTERFACE_ID(f91b6b3c-3f96-47ce-bd91-4cde64a84f07)
+interface ICharsetProvider : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICharsetProvider* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICharsetProvider*)object->Probe(IID_ICharsetProvider);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICharsetProvider;
+    }
+
+    virtual ECode Charsets(
+        /* [out] */ ccm::util::IIterator** it) = 0;
+
+    virtual ECode CharsetForName(
+        /* [in] */ const String& charsetName,
+        /* [out] */ ccm::io::charset::ICharset** cs) = 0;
+};
+
+} // namespace spi
+} // namespace charset
+} // namespace io
+} // namespace ccm
+
+#endif // __CCM_IO_CHARSET_SPI_ICHARSETPROVIDER_H_GEN__
@@ -0,0 +1,254 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MATH_IBIGDECIMAL_H_GEN__
+#define __CCM_MATH_IBIGDECIMAL_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace math {
+
+extern const InterfaceID IID_IBigDecimal;
+
+INTERFACE_ID(51317f66-2236-494c-9eef-da37c95a2845)
+interface IBigDecimal : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IBigDecimal* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IBigDecimal*)object->Probe(IID_IBigDecimal);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IBigDecimal;
+    }
+
+    static constexpr Integer ROUND_UP = 0;
+    static constexpr Integer ROUND_DOWN = 1;
+    static constexpr Integer ROUND_CEILING = 2;
+    static constexpr Integer ROUND_FLOOR = 3;
+    static constexpr Integer ROUND_HALF_UP = 4;
+    static constexpr Integer ROUND_HALF_DOWN = 5;
+    static constexpr Integer ROUND_HALF_EVEN = 6;
+    static constexpr Integer ROUND_UNNECESSARY = 7;
+
+    virtual ECode Abs(
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode Abs(
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode Add(
+        /* [in] */ ccm::math::IBigDecimal* augend,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Add(
+        /* [in] */ ccm::math::IBigDecimal* augend,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode ByteValueExact(
+        /* [out] */ Byte* value) = 0;
+
+    virtual ECode Divide(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Divide(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Divide(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [in] */ Integer roundingMode,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Divide(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [in] */ ccm::math::RoundingMode roundingMode,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Divide(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [in] */ Integer scale,
+        /* [in] */ Integer roundingMode,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Divide(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [in] */ Integer scale,
+        /* [in] */ ccm::math::RoundingMode roundingMode,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode DivideAndRemainder(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [out, callee] */ Array<ccm::math::IBigDecimal*>* quotAndRem) = 0;
+
+    virtual ECode DivideAndRemainder(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out, callee] */ Array<ccm::math::IBigDecimal*>* quotAndRem) = 0;
+
+    virtual ECode DivideToIntegralValue(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode DivideToIntegralValue(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode IntegerValueExact(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode LongValueExact(
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode Max(
+        /* [in] */ ccm::math::IBigDecimal* value,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Min(
+        /* [in] */ ccm::math::IBigDecimal* value,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode MovePointLeft(
+        /* [in] */ Integer n,
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode MovePointRight(
+        /* [in] */ Integer n,
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode Multiply(
+        /* [in] */ ccm::math::IBigDecimal* multiplicand,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Multiply(
+        /* [in] */ ccm::math::IBigDecimal* multiplicand,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Negate(
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode Negate(
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Plus(
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode Plus(
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Pow(
+        /* [in] */ Integer n,
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode Pow(
+        /* [in] */ Integer n,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode Precision(
+        /* [out] */ Integer* precision) = 0;
+
+    virtual ECode Remainder(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Remainder(
+        /* [in] */ ccm::math::IBigDecimal* divisor,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Round(
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Scale(
+        /* [out] */ Integer* scale) = 0;
+
+    virtual ECode ScaleByPowerOfTen(
+        /* [in] */ Integer n,
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode SetScale(
+        /* [in] */ Integer newScale,
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode SetScale(
+        /* [in] */ Integer newScale,
+        /* [in] */ Integer roundingMode,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode SetScale(
+        /* [in] */ Integer newScale,
+        /* [in] */ ccm::math::RoundingMode roundingMode,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode ShortValueExact(
+        /* [out] */ Short* value) = 0;
+
+    virtual ECode Signum(
+        /* [out] */ Integer* sign) = 0;
+
+    virtual ECode StripTrailingZeros(
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode Subtract(
+        /* [in] */ ccm::math::IBigDecimal* subtrahend,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode Subtract(
+        /* [in] */ ccm::math::IBigDecimal* subtrahend,
+        /* [in] */ ccm::math::IMathContext* mc,
+        /* [out] */ ccm::math::IBigDecimal** result) = 0;
+
+    virtual ECode ToBigInteger(
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode ToBigIntegerExact(
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode ToEngineeringString(
+        /* [out] */ String* desc) = 0;
+
+    virtual ECode ToPlainString(
+        /* [out] */ String* desc) = 0;
+
+    virtual ECode Ulp(
+        /* [out] */ ccm::math::IBigDecimal** value) = 0;
+
+    virtual ECode UnscaledValue(
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+};
+
+} // namespace math
+} // namespace ccm
+
+#endif // __CCM_MATH_IBIGDECIMAL_H_GEN__
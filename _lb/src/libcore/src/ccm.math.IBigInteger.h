@@ -0,0 +1,178 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MATH_IBIGINTEGER_H_GEN__
+#define __CCM_MATH_IBIGINTEGER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace math {
+
+extern const InterfaceID IID_IBigInteger;
+
+INTERFACE_ID(9860031d-a5ad-446b-a7ef-24b75fe6daa1)
+interface IBigInteger : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IBigInteger* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IBigInteger*)object->Probe(IID_IBigInteger);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IBigInteger;
+    }
+
+    virtual ECode Abs(
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode Add(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode And(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode AndNot(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode BitCount(
+        /* [out] */ Integer* count) = 0;
+
+    virtual ECode BitLength(
+        /* [out] */ Integer* length) = 0;
+
+    virtual ECode ClearBit(
+        /* [in] */ Integer n,
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode Divide(
+        /* [in] */ ccm::math::IBigInteger* divisor,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode DivideAndRemainder(
+        /* [in] */ ccm::math::IBigInteger* divisor,
+        /* [out, callee] */ Array<ccm::math::IBigInteger*>* result) = 0;
+
+    virtual ECode FlipBit(
+        /* [in] */ Integer n,
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode Gcd(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode GetLowestSetBit(
+        /* [out] */ Integer* setBit) = 0;
+
+    virtual ECode IsProbablePrime(
+        /* [in] */ Integer certainty,
+        /* [out] */ Boolean* prime) = 0;
+
+    virtual ECode Max(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode Min(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode Mod(
+        /* [in] */ ccm::math::IBigInteger* m,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode ModInverse(
+        /* [in] */ ccm::math::IBigInteger* m,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode ModPow(
+        /* [in] */ ccm::math::IBigInteger* exponent,
+        /* [in] */ ccm::math::IBigInteger* modulus,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode Multiply(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode Negate(
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode NextProbablePrime(
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode Not(
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode Or(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode Pow(
+        /* [in] */ Integer exp,
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode Remainder(
+        /* [in] */ ccm::math::IBigInteger* divisor,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode SetBit(
+        /* [in] */ Integer n,
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode ShiftLeft(
+        /* [in] */ Integer n,
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode ShiftRight(
+        /* [in] */ Integer n,
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode Signum(
+        /* [out] */ Integer* sign) = 0;
+
+    virtual ECode Subtract(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+
+    virtual ECode TestBit(
+        /* [in] */ Integer n,
+        /* [out] */ Boolean* set) = 0;
+
+    virtual ECode ToByteArray(
+        /* [out, callee] */ Array<Byte>* array) = 0;
+
+    virtual ECode ToString(
+        /* [in] */ Integer radix,
+        /* [out] */ String* value) = 0;
+
+    virtual ECode Xor(
+        /* [in] */ ccm::math::IBigInteger* value,
+        /* [out] */ ccm::math::IBigInteger** result) = 0;
+};
+
+} // namespace math
+} // namespace ccm
+
+#endif // __CCM_MATH_IBIGINTEGER_H_GEN__
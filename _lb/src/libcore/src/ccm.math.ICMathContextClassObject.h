@@ -0,0 +1,66 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MATH_ICMATHCONTEXTCLASSOBJECT_H_GEN__
+#define __CCM_MATH_ICMATHCONTEXTCLASSOBJECT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace math {
+
+extern const InterfaceID IID_ICMathContextClassObject;
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000000)
+interface ICMathContextClassObject : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICMathContextClassObject* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICMathContextClassObject*)object->Probe(IID_ICMathContextClassObject);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICMathContextClassObject;
+    }
+
+    virtual ECode CreateObject(
+        /* [in] */ Integer precision,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+
+    virtual ECode CreateObject(
+        /* [in] */ Integer precision,
+        /* [in] */ ccm::math::RoundingMode roundingMode,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+
+    virtual ECode CreateObject(
+        /* [in] */ const String& s,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+} // namespace math
+} // namespace ccm
+
+#endif // __CCM_MATH_ICMATHCONTEXTCLASSOBJECT_H_GEN__
@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MATH_IMATHCONTEXT_H_GEN__
+#define __CCM_MATH_IMATHCONTEXT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace math {
+
+extern const InterfaceID IID_IMathContext;
+
+INTERFACE_ID(897ee44a-413c-4bd7-981a-f8106bb19648)
+interface IMathContext : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMathContext* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMathContext*)object->Probe(IID_IMathContext);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMathContext;
+    }
+
+    virtual ECode GetRoundingMode(
+        /* [out] */ ccm::math::RoundingMode* roundingMode) = 0;
+
+    virtual ECode GetPrecision(
+        /* [out] */ Integer* precision) = 0;
+};
+
+} // namespace math
+} // namespace ccm
+
+#endif // __CCM_MATH_IMATHCONTEXT_H_GEN__
@@ -0,0 +1,99 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MISC_IFDBIGINTEGER_H_GEN__
+#define __CCM_MISC_IFDBIGINTEGER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace misc {
+
+extern const InterfaceID IID_IFDBigInteger;
+
+INTERFACE_ID(c73b8a00-75d5-4c5b-a2e1-cd34e8c0fb35)
+interface IFDBigInteger : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFDBigInteger* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFDBigInteger*)object->Probe(IID_IFDBigInteger);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFDBigInteger;
+    }
+
+    virtual ECode AddAndCmp(
+        /* [in] */ ccm::misc::IFDBigInteger* x,
+        /* [in] */ ccm::misc::IFDBigInteger* y,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode Cmp(
+        /* [in] */ ccm::misc::IFDBigInteger* other,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode CmpPow52(
+        /* [in] */ Integer p5,
+        /* [in] */ Integer p2,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode GetNormalizationBias(
+        /* [out] */ Integer* bias) = 0;
+
+    virtual ECode LeftInplaceSub(
+        /* [in] */ ccm::misc::IFDBigInteger* subtrahend,
+        /* [out] */ ccm::misc::IFDBigInteger** value) = 0;
+
+    virtual ECode LeftShift(
+        /* [in] */ Integer shift,
+        /* [out] */ ccm::misc::IFDBigInteger** value) = 0;
+
+    virtual ECode MakeImmutable() = 0;
+
+    virtual ECode MultBy10(
+        /* [out] */ ccm::misc::IFDBigInteger** value) = 0;
+
+    virtual ECode MultByPow52(
+        /* [in] */ Integer p5,
+        /* [in] */ Integer p2,
+        /* [out] */ ccm::misc::IFDBigInteger** value) = 0;
+
+    virtual ECode QuoRemIteration(
+        /* [in] */ ccm::misc::IFDBigInteger* s,
+        /* [out] */ Integer* q) = 0;
+
+    virtual ECode RightInplaceSub(
+        /* [in] */ ccm::misc::IFDBigInteger* subtrahend,
+        /* [out] */ ccm::misc::IFDBigInteger** value) = 0;
+
+    virtual ECode ToBigInteger(
+        /* [out] */ ccm::math::IBigInteger** value) = 0;
+
+    virtual ECode ToHexString(
+        /* [out] */ String* str) = 0;
+};
+
+} // namespace misc
+} // namespace ccm
+
+#endif // __CCM_MISC_IFDBIGINTEGER_H_GEN__
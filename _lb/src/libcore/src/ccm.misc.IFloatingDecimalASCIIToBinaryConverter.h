@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MISC_IFLOATINGDECIMALASCIITOBINARYCONVERTER_H_GEN__
+#define __CCM_MISC_IFLOATINGDECIMALASCIITOBINARYCONVERTER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace misc {
+
+extern const InterfaceID IID_IFloatingDecimalASCIIToBinaryConverter;
+
+INTERFACE_ID(691e4ffb-5b88-40de-ae6e-12072672fbbc)
+interface IFloatingDecimalASCIIToBinaryConverter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFloatingDecimalASCIIToBinaryConverter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFloatingDecimalASCIIToBinaryConverter*)object->Probe(IID_IFloatingDecimalASCIIToBinaryConverter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFloatingDecimalASCIIToBinaryConverter;
+    }
+
+    virtual ECode DoubleValue(
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode FloatValue(
+        /* [out] */ Float* value) = 0;
+};
+
+} // namespace misc
+} // namespace ccm
+
+#endif // __CCM_MISC_IFLOATINGDECIMALASCIITOBINARYCONVERTER_H_GEN__
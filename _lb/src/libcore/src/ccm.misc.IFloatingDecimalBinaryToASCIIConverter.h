@@ -0,0 +1,75 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MISC_IFLOATINGDECIMALBINARYTOASCIICONVERTER_H_GEN__
+#define __CCM_MISC_IFLOATINGDECIMALBINARYTOASCIICONVERTER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace misc {
+
+extern const InterfaceID IID_IFloatingDecimalBinaryToASCIIConverter;
+
+INTERFACE_ID(6bb0744f-9dfe-451c-a68b-3e2c3bde5aa3)
+interface IFloatingDecimalBinaryToASCIIConverter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFloatingDecimalBinaryToASCIIConverter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFloatingDecimalBinaryToASCIIConverter*)object->Probe(IID_IFloatingDecimalBinaryToASCIIConverter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFloatingDecimalBinaryToASCIIConverter;
+    }
+
+    virtual ECode AppendTo(
+        /* [in] */ ccm::core::IAppendable* buf) = 0;
+
+    virtual ECode DecimalDigitsExact(
+        /* [out] */ Boolean* exact) = 0;
+
+    virtual ECode DigitsRoundedUp(
+        /* [out] */ Boolean* roundedUp) = 0;
+
+    virtual ECode GetDecimalExponent(
+        /* [out] */ Integer* exponent) = 0;
+
+    virtual ECode GetDigits(
+        /* [out] */ Array<Char>& digits,
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode IsExceptional(
+        /* [out] */ Boolean* exceptional) = 0;
+
+    virtual ECode IsNegative(
+        /* [out] */ Boolean* neg) = 0;
+
+    virtual ECode ToFormatString(
+        /* [out] */ String* str) = 0;
+};
+
+} // namespace misc
+} // namespace ccm
+
+#endif // __CCM_MISC_IFLOATINGDECIMALBINARYTOASCIICONVERTER_H_GEN__
@@ -0,0 +1,59 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_MISC_IFORMATTEDFLOATINGDECIMAL_H_GEN__
+#define __CCM_MISC_IFORMATTEDFLOATINGDECIMAL_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace misc {
+
+extern const InterfaceID IID_IFormattedFloatingDecimal;
+
+INTERFACE_ID(cbc7370a-2d3d-4078-a719-b02b84562a72)
+interface IFormattedFloatingDecimal : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFormattedFloatingDecimal* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFormattedFloatingDecimal*)object->Probe(IID_IFormattedFloatingDecimal);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFormattedFloatingDecimal;
+    }
+
+    virtual ECode GetExponentRounded(
+        /* [out] */ Integer* exponent) = 0;
+
+    virtual ECode GetMantissa(
+        /* [out, callee] */ Array<Char>* mantissa) = 0;
+
+    virtual ECode GetExponent(
+        /* [out, callee] */ Array<Char>* exponent) = 0;
+};
+
+} // namespace misc
+} // namespace ccm
+
+#endif // __CCM_MISC_IFORMATTEDFLOATINGDECIMAL_H_GEN__
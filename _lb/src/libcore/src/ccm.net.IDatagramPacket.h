@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_NET_IDATAGRAMPACKET_H_GEN__
+#define __CCM_NET_IDATAGRAMPACKET_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace net {
+
+extern const InterfaceID IID_IDatagramPacket;
+
+INTERFACE_ID(74feab7b-a39b-47a8-bbc7-6af9897c36e9)
+interface IDatagramPacket : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDatagramPacket* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDatagramPacket*)object->Probe(IID_IDatagramPacket);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDatagramPacket;
+    }
+
+};
+
+} // namespace net
+} // namespace ccm
+
+#endif // __CCM_NET_IDATAGRAMPACKET_H_GEN__
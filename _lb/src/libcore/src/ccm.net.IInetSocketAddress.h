@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_NET_IINETSOCKETADDRESS_H_GEN__
+#define __CCM_NET_IINETSOCKETADDRESS_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace net {
+
+extern const InterfaceID IID_IInetSocketAddress;
+
+INTERFACE_ID(49a9b44d-d53d-4645-a104-fe30b3b3b8b6)
+interface IInetSocketAddress : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IInetSocketAddress* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IInetSocketAddress*)object->Probe(IID_IInetSocketAddress);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IInetSocketAddress;
+    }
+
+};
+
+} // namespace net
+} // namespace ccm
+
+#endif // __CCM_NET_IINETSOCKETADDRESS_H_GEN__
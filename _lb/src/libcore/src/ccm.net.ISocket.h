@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_NET_ISOCKET_H_GEN__
+#define __CCM_NET_ISOCKET_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace net {
+
+extern const InterfaceID IID_ISocket;
+
+INTERFACE_ID(f4fdb078-b1ff-4b56-b035-548922030829)
+interface ISocket : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISocket* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISocket*)object->Probe(IID_ISocket);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ISocket;
+    }
+
+    virtual ECode GetFileDescriptor(
+        /* [out] */ ccm::io::IFileDescriptor** fd) = 0;
+
+    virtual ECode IsClosed(
+        /* [out] */ Boolean* closed) = 0;
+};
+
+} // namespace net
+} // namespace ccm
+
+#endif // __CCM_NET_ISOCKET_H_GEN__
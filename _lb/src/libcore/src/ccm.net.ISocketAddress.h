@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_NET_ISOCKETADDRESS_H_GEN__
+#define __CCM_NET_ISOCKETADDRESS_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace net {
+
+extern const InterfaceID IID_ISocketAddress;
+
+INTERFACE_ID(02ad1b11-b4d3-4a32-bffc-78c8556537c5)
+interface ISocketAddress : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISocketAddress* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISocketAddress*)object->Probe(IID_ISocketAddress);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ISocketAddress;
+    }
+
+};
+
+} // namespace net
+} // namespace ccm
+
+#endif // __CCM_NET_ISOCKETADDRESS_H_GEN__
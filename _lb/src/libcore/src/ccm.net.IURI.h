@@ -0,0 +1,71 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_NET_IURI_H_GEN__
+#define __CCM_NET_IURI_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace net {
+
+extern const InterfaceID IID_IURI;
+
+INTERFACE_ID(fd92ca32-e28f-4fd6-a29c-856b5a58d417)
+interface IURI : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IURI* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IURI*)object->Probe(IID_IURI);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IURI;
+    }
+
+    virtual ECode GetAuthority(
+        /* [out] */ String* authority) = 0;
+
+    virtual ECode GetFragment(
+        /* [out] */ String* fragment) = 0;
+
+    virtual ECode GetPath(
+        /* [out] */ String* path) = 0;
+
+    virtual ECode GetQuery(
+        /* [out] */ String* query) = 0;
+
+    virtual ECode GetScheme(
+        /* [out] */ String* scheme) = 0;
+
+    virtual ECode IsAbsolute(
+        /* [out] */ Boolean* absolute) = 0;
+
+    virtual ECode IsOpaque(
+        /* [out] */ Boolean* opaque) = 0;
+};
+
+} // namespace net
+} // namespace ccm
+
+#endif // __CCM_NET_IURI_H_GEN__
@@ -0,0 +1,66 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_SECURITY_IPERMISSION_H_GEN__
+#define __CCM_SECURITY_IPERMISSION_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+
+extern const InterfaceID IID_IPermission;
+
+INTERFACE_ID(93cc3a78-0afc-4b41-999c-aaa643c6e1a3)
+interface IPermission : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IPermission* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IPermission*)object->Probe(IID_IPermission);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IPermission;
+    }
+
+    virtual ECode CheckGuard(
+        /* [in] */ ccm::IInterface* object) = 0;
+
+    virtual ECode GetActions(
+        /* [out] */ String* actions) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode Implies(
+        /* [in] */ ccm::security::IPermission* permission,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode NewPermissionCollection(
+        /* [out] */ ccm::security::IPermissionCollection** permissions) = 0;
+};
+
+} // namespace security
+} // namespace ccm
+
+#endif // __CCM_SECURITY_IPERMISSION_H_GEN__
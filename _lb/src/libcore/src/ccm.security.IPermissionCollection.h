@@ -0,0 +1,65 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_SECURITY_IPERMISSIONCOLLECTION_H_GEN__
+#define __CCM_SECURITY_IPERMISSIONCOLLECTION_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+
+extern const InterfaceID IID_IPermissionCollection;
+
+INTERFACE_ID(8bdc918c-d6b9-457b-8d4c-24cdb0a4ed42)
+interface IPermissionCollection : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IPermissionCollection* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IPermissionCollection*)object->Probe(IID_IPermissionCollection);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IPermissionCollection;
+    }
+
+    virtual ECode Add(
+        /* [in] */ ccm::security::IPermission* permission) = 0;
+
+    virtual ECode GetElements(
+        /* [out] */ ccm::util::IEnumeration** elements) = 0;
+
+    virtual ECode Implies(
+        /* [in] */ ccm::security::IPermission* permission,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode IsReadOnly(
+        /* [out] */ Boolean* readonly) = 0;
+
+    virtual ECode SetReadOnly() = 0;
+};
+
+} // namespace security
+} // namespace ccm
+
+#endif // __CCM_SECURITY_IPERMISSIONCOLLECTION_H_GEN__
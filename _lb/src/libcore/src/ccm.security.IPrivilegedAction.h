@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_SECURITY_IPRIVILEGEDACTION_H_GEN__
+#define __CCM_SECURITY_IPRIVILEGEDACTION_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+
+extern const InterfaceID IID_IPrivilegedAction;
+
+INTERFACE_ID(69b1afca-4562-40d1-bb20-44c95743e6f9)
+interface IPrivilegedAction : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IPrivilegedAction* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IPrivilegedAction*)object->Probe(IID_IPrivilegedAction);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IPrivilegedAction;
+    }
+
+    virtual ECode Run(
+        /* [out] */ ccm::IInterface** result) = 0;
+};
+
+} // namespace security
+} // namespace ccm
+
+#endif // __CCM_SECURITY_IPRIVILEGEDACTION_H_GEN__
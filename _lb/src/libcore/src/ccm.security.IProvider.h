@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_SECURITY_IPROVIDER_H_GEN__
+#define __CCM_SECURITY_IPROVIDER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+
+extern const InterfaceID IID_IProvider;
+
+INTERFACE_ID(5175ea7f-5a2b-480e-b8c5-37bef4036c6a)
+interface IProvider : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IProvider* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IProvider*)object->Probe(IID_IProvider);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IProvider;
+    }
+
+    virtual ECode GetServices(
+        /* [out] */ ccm::util::ISet** services) = 0;
+};
+
+} // namespace security
+} // namespace ccm
+
+#endif // __CCM_SECURITY_IPROVIDER_H_GEN__
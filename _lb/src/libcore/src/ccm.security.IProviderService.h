@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_SECURITY_IPROVIDERSERVICE_H_GEN__
+#define __CCM_SECURITY_IPROVIDERSERVICE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+
+extern const InterfaceID IID_IProviderService;
+
+INTERFACE_ID(598540a9-9845-4be4-ab0e-36f817026101)
+interface IProviderService : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IProviderService* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IProviderService*)object->Probe(IID_IProviderService);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IProviderService;
+    }
+
+    virtual ECode GetAlgorithm(
+        /* [out] */ String* algorithm) = 0;
+
+    virtual ECode GetType(
+        /* [out] */ String* type) = 0;
+};
+
+} // namespace security
+} // namespace ccm
+
+#endif // __CCM_SECURITY_IPROVIDERSERVICE_H_GEN__
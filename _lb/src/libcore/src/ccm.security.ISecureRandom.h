@@ -0,0 +1,63 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_SECURITY_ISECURERANDOM_H_GEN__
+#define __CCM_SECURITY_ISECURERANDOM_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+
+extern const InterfaceID IID_ISecureRandom;
+
+INTERFACE_ID(a9d0a2ef-0248-448d-ae16-2ff4df8ab0d7)
+interface ISecureRandom : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISecureRandom* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISecureRandom*)object->Probe(IID_ISecureRandom);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ISecureRandom;
+    }
+
+    virtual ECode GenerateSeed(
+        /* [in] */ Integer numBytes,
+        /* [out, callee] */ Array<Byte>* seed) = 0;
+
+    virtual ECode GetAlgorithm(
+        /* [out] */ String* algorithm) = 0;
+
+    virtual ECode GetProvider(
+        /* [out] */ ccm::security::IProvider** provider) = 0;
+
+    virtual ECode SetSeed(
+        /* [in] */ const Array<Byte>& seed) = 0;
+};
+
+} // namespace security
+} // namespace ccm
+
+#endif // __CCM_SECURITY_ISECURERANDOM_H_GEN__
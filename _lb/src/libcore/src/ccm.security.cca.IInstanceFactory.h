@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_SECURITY_CCA_IINSTANCEFACTORY_H_GEN__
+#define __CCM_SECURITY_CCA_IINSTANCEFACTORY_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+namespace cca {
+
+extern const InterfaceID IID_IInstanceFactory;
+
+INTERFACE_ID(b8e28501-8a94-4767-b5e9-60e6793f49f8)
+interface IInstanceFactory : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IInstanceFactory* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IInstanceFactory*)object->Probe(IID_IInstanceFactory);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IInstanceFactory;
+    }
+
+};
+
+} // namespace cca
+} // namespace security
+} // namespace ccm
+
+#endif // __CCM_SECURITY_CCA_IINSTANCEFACTORY_H_GEN__
@@ -0,0 +1,55 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_SECURITY_CCA_IPROVIDERLIST_H_GEN__
+#define __CCM_SECURITY_CCA_IPROVIDERLIST_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace security {
+namespace cca {
+
+extern const InterfaceID IID_IProviderList;
+
+INTERFACE_ID(70795130-9314-4e18-b3a8-4241278b579b)
+interface IProviderList : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IProviderList* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IProviderList*)object->Probe(IID_IProviderList);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IProviderList;
+    }
+
+    virtual ECode Providers(
+        /* [out] */ ccm::util::IList** providers) = 0;
+};
+
+} // namespace cca
+} // namespace security
+} // namespace ccm
+
+#endif // __CCM_SECURITY_CCA_IPROVIDERLIST_H_GEN__
@@ -0,0 +1,104 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IATTRIBUTEDCHARACTERITERATOR_H_GEN__
+#define __CCM_TEXT_IATTRIBUTEDCHARACTERITERATOR_H_GEN__
+
+#include "libcore.h"
+#include "ccm.text.IAttributedCharacterIterator.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IAttributedCharacterIterator;
+
+INTERFACE_ID(6b6208f7-c072-4f70-b8d9-e22962027b59)
+interface IAttributedCharacterIterator : public IInterface
+{
+    static const InterfaceID IID_IAttribute;
+
+    INTERFACE_ID(09d5b6df-58ba-4836-aea3-c6b95c44649f)
+    interface IAttribute : public IInterface
+    {
+        using IInterface::Probe;
+
+        inline static IAttribute* Probe(
+            /* [in] */ IInterface* object)
+        {
+            if (object == nullptr) return nullptr;
+            return (IAttribute*)object->Probe(IID_IAttribute);
+        }
+    
+        inline static const InterfaceID& GetInterfaceID()
+        {
+            return IID_IAttribute;
+        }
+
+    };
+
+    using IInterface::Probe;
+
+    inline static IAttributedCharacterIterator* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IAttributedCharacterIterator*)object->Probe(IID_IAttributedCharacterIterator);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IAttributedCharacterIterator;
+    }
+
+    virtual ECode GetAllAttributeKeys(
+        /* [out] */ ccm::util::ISet** keys) = 0;
+
+    virtual ECode GetAttribute(
+        /* [in] */ ccm::text::IAttributedCharacterIterator::IAttribute* attribute,
+        /* [out] */ ccm::IInterface** value) = 0;
+
+    virtual ECode GetAttributes(
+        /* [out] */ ccm::util::IMap** attributes) = 0;
+
+    virtual ECode GetRunLimit(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetRunLimit(
+        /* [in] */ ccm::text::IAttributedCharacterIterator::IAttribute* attribute,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetRunLimit(
+        /* [in] */ ccm::util::ISet* attributes,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetRunStart(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetRunStart(
+        /* [in] */ ccm::text::IAttributedCharacterIterator::IAttribute* attribute,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetRunStart(
+        /* [in] */ ccm::util::ISet* attributes,
+        /* [out] */ Integer* index) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IATTRIBUTEDCHARACTERITERATOR_H_GEN__
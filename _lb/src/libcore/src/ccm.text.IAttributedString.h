@@ -0,0 +1,79 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IATTRIBUTEDSTRING_H_GEN__
+#define __CCM_TEXT_IATTRIBUTEDSTRING_H_GEN__
+
+#include "libcore.h"
+#include "ccm.text.IAttributedCharacterIterator.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IAttributedString;
+
+INTERFACE_ID(b3004d6b-0223-4bcb-8b6d-7824de3aeb3a)
+interface IAttributedString : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IAttributedString* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IAttributedString*)object->Probe(IID_IAttributedString);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IAttributedString;
+    }
+
+    virtual ECode AddAttribute(
+        /* [in] */ ccm::text::IAttributedCharacterIterator::IAttribute* attribute,
+        /* [in] */ ccm::IInterface* value) = 0;
+
+    virtual ECode AddAttribute(
+        /* [in] */ ccm::text::IAttributedCharacterIterator::IAttribute* attribute,
+        /* [in] */ ccm::IInterface* value,
+        /* [in] */ Integer beginIndex,
+        /* [in] */ Integer endIndex) = 0;
+
+    virtual ECode AddAttributes(
+        /* [in] */ ccm::util::IMap* attributes,
+        /* [in] */ Integer beginIndex,
+        /* [in] */ Integer endIndex) = 0;
+
+    virtual ECode GetIterator(
+        /* [out] */ ccm::text::IAttributedCharacterIterator** it) = 0;
+
+    virtual ECode GetIterator(
+        /* [in] */ const Array<ccm::text::IAttributedCharacterIterator::IAttribute*>& attributes,
+        /* [out] */ ccm::text::IAttributedCharacterIterator** it) = 0;
+
+    virtual ECode GetIterator(
+        /* [in] */ const Array<ccm::text::IAttributedCharacterIterator::IAttribute*>& attributes,
+        /* [in] */ Integer beginIndex,
+        /* [in] */ Integer endIndex,
+        /* [out] */ ccm::text::IAttributedCharacterIterator** it) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IATTRIBUTEDSTRING_H_GEN__
@@ -0,0 +1,80 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_ICHARACTERITERATOR_H_GEN__
+#define __CCM_TEXT_ICHARACTERITERATOR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_ICharacterIterator;
+
+INTERFACE_ID(42437f78-3feb-49cb-94e4-fa4dd4c7ee67)
+interface ICharacterIterator : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICharacterIterator* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICharacterIterator*)object->Probe(IID_ICharacterIterator);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICharacterIterator;
+    }
+
+    static constexpr Char DONE = '';
+
+    virtual ECode Current(
+        /* [out] */ Char* currChar) = 0;
+
+    virtual ECode First(
+        /* [out] */ Char* firstChar) = 0;
+
+    virtual ECode GetBeginIndex(
+        /* [out] */ Integer* beginIndex) = 0;
+
+    virtual ECode GetEndIndex(
+        /* [out] */ Integer* endIndex) = 0;
+
+    virtual ECode GetIndex(
+        /* [out] */ Integer* currIndex) = 0;
+
+    virtual ECode Last(
+        /* [out] */ Char* lastChar) = 0;
+
+    virtual ECode Next(
+        /* [out] */ Char* nextChar) = 0;
+
+    virtual ECode Previous(
+        /* [out] */ Char* prevChar) = 0;
+
+    virtual ECode SetIndex(
+        /* [in] */ Integer position,
+        /* [out] */ Char* currChar = nullptr) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_ICHARACTERITERATOR_H_GEN__
@@ -0,0 +1,76 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_ICHOICEFORMAT_H_GEN__
+#define __CCM_TEXT_ICHOICEFORMAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IChoiceFormat;
+
+INTERFACE_ID(54f82f1f-4aaf-45b6-891d-77083bff1058)
+interface IChoiceFormat : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IChoiceFormat* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IChoiceFormat*)object->Probe(IID_IChoiceFormat);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IChoiceFormat;
+    }
+
+    virtual ECode ApplyPattern(
+        /* [in] */ const String& newPattern) = 0;
+
+    virtual ECode Format(
+        /* [in] */ Long number,
+        /* [out] */ ccm::core::IStringBuffer* toAppendTo,
+        /* [in] */ ccm::text::IFieldPosition* status) = 0;
+
+    virtual ECode Format(
+        /* [in] */ Double number,
+        /* [out] */ ccm::core::IStringBuffer* toAppendTo,
+        /* [in] */ ccm::text::IFieldPosition* status) = 0;
+
+    virtual ECode GetFormats(
+        /* [out, callee] */ Array<String>* formats) = 0;
+
+    virtual ECode GetLimits(
+        /* [out, callee] */ Array<Double>* limits) = 0;
+
+    virtual ECode SetChoices(
+        /* [in] */ const Array<Double>& limits,
+        /* [in] */ const Array<String>& formats) = 0;
+
+    virtual ECode ToPattern(
+        /* [out] */ String* pattern) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_ICHOICEFORMAT_H_GEN__
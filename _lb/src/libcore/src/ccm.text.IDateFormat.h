@@ -0,0 +1,121 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IDATEFORMAT_H_GEN__
+#define __CCM_TEXT_IDATEFORMAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IDateFormat;
+
+INTERFACE_ID(4f4122b6-8d1a-4454-ac93-22e858ec23c8)
+interface IDateFormat : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDateFormat* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDateFormat*)object->Probe(IID_IDateFormat);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDateFormat;
+    }
+
+    static constexpr Integer ERA_FIELD = 0;
+    static constexpr Integer YEAR_FIELD = 1;
+    static constexpr Integer MONTH_FIELD = 2;
+    static constexpr Integer DATE_FIELD = 3;
+    static constexpr Integer HOUR_OF_DAY1_FIELD = 4;
+    static constexpr Integer HOUR_OF_DAY0_FIELD = 5;
+    static constexpr Integer MINUTE_FIELD = 6;
+    static constexpr Integer SECOND_FIELD = 7;
+    static constexpr Integer MILLISECOND_FIELD = 8;
+    static constexpr Integer DAY_OF_WEEK_FIELD = 9;
+    static constexpr Integer DAY_OF_YEAR_FIELD = 10;
+    static constexpr Integer DAY_OF_WEEK_IN_MONTH_FIELD = 11;
+    static constexpr Integer WEEK_OF_YEAR_FIELD = 12;
+    static constexpr Integer WEEK_OF_MONTH_FIELD = 13;
+    static constexpr Integer AM_PM_FIELD = 14;
+    static constexpr Integer HOUR1_FIELD = 15;
+    static constexpr Integer HOUR0_FIELD = 16;
+    static constexpr Integer TIMEZONE_FIELD = 17;
+    static constexpr Integer FULL = 0;
+    static constexpr Integer LONG = 1;
+    static constexpr Integer MEDIUM = 2;
+    static constexpr Integer SHORT = 3;
+    static constexpr Integer DEFAULT = 2;
+
+    virtual ECode Format(
+        /* [in] */ ccm::util::IDate* date,
+        /* [out] */ String* result) = 0;
+
+    virtual ECode Format(
+        /* [in] */ ccm::util::IDate* date,
+        /* [in, out] */ ccm::core::IStringBuffer* toAppendTo,
+        /* [in] */ ccm::text::IFieldPosition* pos) = 0;
+
+    virtual ECode GetCalendar(
+        /* [out] */ ccm::util::ICalendar** calendar) = 0;
+
+    virtual ECode GetNumberFormat(
+        /* [out] */ ccm::text::INumberFormat** format) = 0;
+
+    virtual ECode GetTimeZone(
+        /* [out] */ ccm::util::ITimeZone** timezone) = 0;
+
+    virtual ECode IsLenient(
+        /* [out] */ Boolean* lenient) = 0;
+
+    virtual ECode Parse(
+        /* [in] */ const String& source,
+        /* [out] */ ccm::util::IDate** date) = 0;
+
+    virtual ECode Parse(
+        /* [in] */ const String& source,
+        /* [in] */ ccm::text::IParsePosition* pos,
+        /* [out] */ ccm::util::IDate** date) = 0;
+
+    virtual ECode ParseObject(
+        /* [in] */ const String& source,
+        /* [in] */ ccm::text::IParsePosition* pos,
+        /* [out] */ ccm::IInterface** object) = 0;
+
+    virtual ECode SetCalendar(
+        /* [in] */ ccm::util::ICalendar* newCalendar) = 0;
+
+    virtual ECode SetLenient(
+        /* [in] */ Boolean lenient) = 0;
+
+    virtual ECode SetNumberFormat(
+        /* [in] */ ccm::text::INumberFormat* newNumberFormat) = 0;
+
+    virtual ECode SetTimeZone(
+        /* [in] */ ccm::util::ITimeZone* timezone) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IDATEFORMAT_H_GEN__
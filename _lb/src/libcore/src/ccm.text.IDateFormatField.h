@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IDATEFORMATFIELD_H_GEN__
+#define __CCM_TEXT_IDATEFORMATFIELD_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IDateFormatField;
+
+INTERFACE_ID(09b0ec7d-890c-4dda-80dd-e2c32807eda6)
+interface IDateFormatField : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDateFormatField* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDateFormatField*)object->Probe(IID_IDateFormatField);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDateFormatField;
+    }
+
+    virtual ECode GetCalendarField(
+        /* [out] */ Integer* calendarField) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IDATEFORMATFIELD_H_GEN__
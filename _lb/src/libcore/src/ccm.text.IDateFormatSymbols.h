@@ -0,0 +1,98 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IDATEFORMATSYMBOLS_H_GEN__
+#define __CCM_TEXT_IDATEFORMATSYMBOLS_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IDateFormatSymbols;
+
+INTERFACE_ID(b2e89609-5020-4f1a-ae3b-3406c4021da1)
+interface IDateFormatSymbols : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDateFormatSymbols* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDateFormatSymbols*)object->Probe(IID_IDateFormatSymbols);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDateFormatSymbols;
+    }
+
+    virtual ECode GetAmPmStrings(
+        /* [out, callee] */ Array<String>* ampm) = 0;
+
+    virtual ECode GetEras(
+        /* [out, callee] */ Array<String>* eras) = 0;
+
+    virtual ECode GetLocalPatternChars(
+        /* [out] */ String* localPatternChars) = 0;
+
+    virtual ECode GetMonths(
+        /* [out, callee] */ Array<String>* months) = 0;
+
+    virtual ECode GetShortMonths(
+        /* [out, callee] */ Array<String>* months) = 0;
+
+    virtual ECode GetShortWeekdays(
+        /* [out, callee] */ Array<String>* weekdays) = 0;
+
+    virtual ECode GetWeekdays(
+        /* [out, callee] */ Array<String>* weekdays) = 0;
+
+    virtual ECode GetZoneStrings(
+        /* [out, callee] */ Array<Array<String>>* zoneStrings) = 0;
+
+    virtual ECode SetAmPmStrings(
+        /* [in] */ const Array<String>& newAmpms) = 0;
+
+    virtual ECode SetEras(
+        /* [in] */ const Array<String>& newEras) = 0;
+
+    virtual ECode SetLocalPatternChars(
+        /* [in] */ const String& newLocalPatternChars) = 0;
+
+    virtual ECode SetMonths(
+        /* [in] */ const Array<String>& newMonths) = 0;
+
+    virtual ECode SetShortMonths(
+        /* [in] */ const Array<String>& newShortMonths) = 0;
+
+    virtual ECode SetShortWeekdays(
+        /* [in] */ const Array<String>& newShortWeekdays) = 0;
+
+    virtual ECode SetWeekdays(
+        /* [in] */ const Array<String>& newWeekdays) = 0;
+
+    virtual ECode SetZoneStrings(
+        /* [in] */ const Array<Array<String>>& newZoneStrings) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IDATEFORMATSYMBOLS_H_GEN__
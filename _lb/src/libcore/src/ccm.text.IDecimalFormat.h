@@ -0,0 +1,128 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IDECIMALFORMAT_H_GEN__
+#define __CCM_TEXT_IDECIMALFORMAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IDecimalFormat;
+
+INTERFACE_ID(b1615f6c-db57-44fd-aa14-fd68dcc56992)
+interface IDecimalFormat : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDecimalFormat* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDecimalFormat*)object->Probe(IID_IDecimalFormat);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDecimalFormat;
+    }
+
+    virtual ECode ApplyLocalizedPattern(
+        /* [in] */ const String& pattern) = 0;
+
+    virtual ECode ApplyPattern(
+        /* [in] */ const String& pattern) = 0;
+
+    virtual ECode GetDecimalFormatSymbols(
+        /* [out] */ ccm::text::IDecimalFormatSymbols** symbols) = 0;
+
+    virtual ECode GetGroupingSize(
+        /* [out] */ Integer* size) = 0;
+
+    virtual ECode GetMultiplier(
+        /* [out] */ Integer* multiplier) = 0;
+
+    virtual ECode GetNegativePrefix(
+        /* [out] */ String* prefix) = 0;
+
+    virtual ECode GetNegativeSuffix(
+        /* [out] */ String* suffix) = 0;
+
+    virtual ECode GetPositivePrefix(
+        /* [out] */ String* prefix) = 0;
+
+    virtual ECode GetPositiveSuffix(
+        /* [out] */ String* suffix) = 0;
+
+    virtual ECode IsDecimalSeparatorAlwaysShown(
+        /* [in] */ Boolean* shown) = 0;
+
+    virtual ECode IsGroupingUsed(
+        /* [out] */ Boolean* used) = 0;
+
+    virtual ECode IsParseBigDecimal(
+        /* [out] */ Boolean* value) = 0;
+
+    virtual ECode IsParseIntegerOnly(
+        /* [out] */ Boolean* value) = 0;
+
+    virtual ECode SetDecimalFormatSymbols(
+        /* [in] */ ccm::text::IDecimalFormatSymbols* symbols) = 0;
+
+    virtual ECode SetDecimalSeparatorAlwaysShown(
+        /* [in] */ Boolean shown) = 0;
+
+    virtual ECode SetGroupingSize(
+        /* [in] */ Integer size) = 0;
+
+    virtual ECode SetGroupingUsed(
+        /* [in] */ Boolean used) = 0;
+
+    virtual ECode SetMultiplier(
+        /* [in] */ Integer multiplier) = 0;
+
+    virtual ECode SetNegativePrefix(
+        /* [in] */ const String& prefix) = 0;
+
+    virtual ECode SetNegativeSuffix(
+        /* [in] */ const String& suffix) = 0;
+
+    virtual ECode SetParseBigDecimal(
+        /* [in] */ Boolean value) = 0;
+
+    virtual ECode SetParseIntegerOnly(
+        /* [in] */ Boolean value) = 0;
+
+    virtual ECode SetPositivePrefix(
+        /* [in] */ const String& prefix) = 0;
+
+    virtual ECode SetPositiveSuffix(
+        /* [in] */ const String& suffix) = 0;
+
+    virtual ECode ToLocalizedPattern(
+        /* [out] */ String* pattern) = 0;
+
+    virtual ECode ToPattern(
+        /* [out] */ String* pattern) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IDECIMALFORMAT_H_GEN__
@@ -0,0 +1,146 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IDECIMALFORMATSYMBOLS_H_GEN__
+#define __CCM_TEXT_IDECIMALFORMATSYMBOLS_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IDecimalFormatSymbols;
+
+INTERFACE_ID(e7a8ca7c-5f0b-4d11-b50e-25d3593720d8)
+interface IDecimalFormatSymbols : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDecimalFormatSymbols* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDecimalFormatSymbols*)object->Probe(IID_IDecimalFormatSymbols);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDecimalFormatSymbols;
+    }
+
+    virtual ECode GetCurrency(
+        /* [out] */ ccm::util::ICurrency** currency) = 0;
+
+    virtual ECode GetCurrencySymbol(
+        /* [out] */ String* currency) = 0;
+
+    virtual ECode GetDecimalSeparator(
+        /* [out] */ Char* decimalSeparator) = 0;
+
+    virtual ECode GetDigit(
+        /* [out] */ Char* digit) = 0;
+
+    virtual ECode GetExponentSeparator(
+        /* [out] */ String* exponentSeparator) = 0;
+
+    virtual ECode GetGroupingSeparator(
+        /* [out] */ Char* groupingSeparator) = 0;
+
+    virtual ECode GetInfinity(
+        /* [out] */ String* infinity) = 0;
+
+    virtual ECode GetInternationalCurrencySymbol(
+        /* [out] */ String* currency) = 0;
+
+    virtual ECode GetMinusSign(
+        /* [out] */ Char* minusSign) = 0;
+
+    virtual ECode GetMinusSignString(
+        /* [out] */ String* minusSignStr) = 0;
+
+    virtual ECode GetMonetaryDecimalSeparator(
+        /* [out] */ Char* monetarySeparator) = 0;
+
+    virtual ECode GetNaN(
+        /* [out] */ String* naN) = 0;
+
+    virtual ECode GetPatternSeparator(
+        /* [out] */ Char* patternSeparator) = 0;
+
+    virtual ECode GetPercent(
+        /* [out] */ Char* percent) = 0;
+
+    virtual ECode GetPercentString(
+        /* [out] */ String* percentStr) = 0;
+
+    virtual ECode GetPerMill(
+        /* [out] */ Char* perMill) = 0;
+
+    virtual ECode GetZeroDigit(
+        /* [out] */ Char* zeroDigit) = 0;
+
+    virtual ECode SetCurrency(
+        /* [in] */ ccm::util::ICurrency* currency) = 0;
+
+    virtual ECode SetCurrencySymbol(
+        /* [in] */ const String& currency) = 0;
+
+    virtual ECode SetDecimalSeparator(
+        /* [in] */ Char decimalSeparator) = 0;
+
+    virtual ECode SetDigit(
+        /* [in] */ Char digit) = 0;
+
+    virtual ECode SetExponentSeparator(
+        /* [in] */ const String& exp) = 0;
+
+    virtual ECode SetGroupingSeparator(
+        /* [in] */ Char groupingSeparator) = 0;
+
+    virtual ECode SetInfinity(
+        /* [in] */ const String& infinity) = 0;
+
+    virtual ECode SetInternationalCurrencySymbol(
+        /* [in] */ const String& currency) = 0;
+
+    virtual ECode SetMinusSign(
+        /* [in] */ Char minusSign) = 0;
+
+    virtual ECode SetMonetaryDecimalSeparator(
+        /* [in] */ Char sep) = 0;
+
+    virtual ECode SetNaN(
+        /* [in] */ const String& naN) = 0;
+
+    virtual ECode SetPatternSeparator(
+        /* [in] */ Char patternSeparator) = 0;
+
+    virtual ECode SetPercent(
+        /* [in] */ Char percent) = 0;
+
+    virtual ECode SetPerMill(
+        /* [in] */ Char perMill) = 0;
+
+    virtual ECode SetZeroDigit(
+        /* [in] */ Char zeroDigit) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IDECIMALFORMATSYMBOLS_H_GEN__
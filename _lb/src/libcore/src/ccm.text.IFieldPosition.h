@@ -0,0 +1,71 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IFIELDPOSITION_H_GEN__
+#define __CCM_TEXT_IFIELDPOSITION_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IFieldPosition;
+
+INTERFACE_ID(a847451b-46f3-441e-ba9f-ed0b37e5ebfa)
+interface IFieldPosition : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFieldPosition* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFieldPosition*)object->Probe(IID_IFieldPosition);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFieldPosition;
+    }
+
+    virtual ECode GetBeginIndex(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetEndIndex(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetField(
+        /* [out] */ Integer* field) = 0;
+
+    virtual ECode GetFieldAttribute(
+        /* [out] */ ccm::text::IFormatField** attribute) = 0;
+
+    virtual ECode GetFieldDelegate(
+        /* [out] */ ccm::text::IFormatFieldDelegate** delegate) = 0;
+
+    virtual ECode SetBeginIndex(
+        /* [in] */ Integer index) = 0;
+
+    virtual ECode SetEndIndex(
+        /* [in] */ Integer index) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IFIELDPOSITION_H_GEN__
@@ -0,0 +1,72 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IFORMAT_H_GEN__
+#define __CCM_TEXT_IFORMAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IFormat;
+
+INTERFACE_ID(3ca986f7-ad84-4023-8f5f-b3c836266040)
+interface IFormat : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFormat* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFormat*)object->Probe(IID_IFormat);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFormat;
+    }
+
+    virtual ECode Format(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ String* string) = 0;
+
+    virtual ECode Format(
+        /* [in] */ ccm::IInterface* obj,
+        /* [in, out] */ ccm::core::IStringBuffer* toAppendTo,
+        /* [in] */ ccm::text::IFieldPosition* pos) = 0;
+
+    virtual ECode FormatToCharacterIterator(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ ccm::text::IAttributedCharacterIterator** it) = 0;
+
+    virtual ECode ParseObject(
+        /* [in] */ const String& source,
+        /* [out] */ ccm::IInterface** object) = 0;
+
+    virtual ECode ParseObject(
+        /* [in] */ const String& source,
+        /* [in] */ ccm::text::IParsePosition* pos,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IFORMAT_H_GEN__
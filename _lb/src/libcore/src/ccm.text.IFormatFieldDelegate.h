@@ -0,0 +1,65 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IFORMATFIELDDELEGATE_H_GEN__
+#define __CCM_TEXT_IFORMATFIELDDELEGATE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IFormatFieldDelegate;
+
+INTERFACE_ID(0579f322-5ab7-4c43-84b5-dbc4313db1fd)
+interface IFormatFieldDelegate : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFormatFieldDelegate* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFormatFieldDelegate*)object->Probe(IID_IFormatFieldDelegate);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFormatFieldDelegate;
+    }
+
+    virtual ECode Formatted(
+        /* [in] */ ccm::text::IFormatField* attr,
+        /* [in] */ ccm::IInterface* value,
+        /* [in] */ Integer start,
+        /* [in] */ Integer end,
+        /* [in] */ ccm::core::IStringBuffer* buffer) = 0;
+
+    virtual ECode Formatted(
+        /* [in] */ Integer fieldID,
+        /* [in] */ ccm::text::IFormatField* attr,
+        /* [in] */ ccm::IInterface* value,
+        /* [in] */ Integer start,
+        /* [in] */ Integer end,
+        /* [in] */ ccm::core::IStringBuffer* buffer) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IFORMATFIELDDELEGATE_H_GEN__
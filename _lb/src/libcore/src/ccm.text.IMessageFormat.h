@@ -0,0 +1,110 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IMESSAGEFORMAT_H_GEN__
+#define __CCM_TEXT_IMESSAGEFORMAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IMessageFormat;
+
+INTERFACE_ID(207d608f-1ca5-4ae1-8723-b36e26f25048)
+interface IMessageFormat : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMessageFormat* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMessageFormat*)object->Probe(IID_IMessageFormat);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMessageFormat;
+    }
+
+    virtual ECode ApplyPattern(
+        /* [in] */ const String& pattern) = 0;
+
+    virtual ECode Format(
+        /* [in] */ const Array<ccm::IInterface*>& arguments,
+        /* [out] */ ccm::core::IStringBuffer* result,
+        /* [in] */ ccm::text::IFieldPosition* pos) = 0;
+
+    virtual ECode Format(
+        /* [in] */ ccm::IInterface* arguments,
+        /* [in] */ ccm::core::IStringBuffer* result,
+        /* [in] */ ccm::text::IFieldPosition* pos) = 0;
+
+    virtual ECode FormatToCharacterIterator(
+        /* [in] */ ccm::IInterface* arguments,
+        /* [out] */ ccm::text::IAttributedCharacterIterator** cit) = 0;
+
+    virtual ECode GetFormats(
+        /* [out, callee] */ Array<ccm::text::IFormat*>* formats) = 0;
+
+    virtual ECode GetFormatsByArgumentIndex(
+        /* [out, callee] */ Array<ccm::text::IFormat*>* formats) = 0;
+
+    virtual ECode GetLocale(
+        /* [out] */ ccm::util::ILocale** locale) = 0;
+
+    virtual ECode Parse(
+        /* [in] */ const String& source,
+        /* [out, callee] */ Array<ccm::IInterface*>* result) = 0;
+
+    virtual ECode Parse(
+        /* [in] */ const String& source,
+        /* [in] */ ccm::text::IParsePosition* pos,
+        /* [out, callee] */ Array<ccm::IInterface*>* result) = 0;
+
+    virtual ECode ParseObject(
+        /* [in] */ const String& source,
+        /* [in] */ ccm::text::IParsePosition* pos,
+        /* [out] */ ccm::IInterface** result) = 0;
+
+    virtual ECode SetFormat(
+        /* [in] */ Integer formatElementIndex,
+        /* [in] */ ccm::text::IFormat* newFormat) = 0;
+
+    virtual ECode SetFormatByArgumentIndex(
+        /* [in] */ Integer argumentIndex,
+        /* [in] */ ccm::text::IFormat* newFormat) = 0;
+
+    virtual ECode SetFormats(
+        /* [in] */ const Array<ccm::text::IFormat*>& newFormats) = 0;
+
+    virtual ECode SetFormatsByArgumentIndex(
+        /* [in] */ const Array<ccm::text::IFormat*>& newFormats) = 0;
+
+    virtual ECode SetLocale(
+        /* [in] */ ccm::util::ILocale* locale) = 0;
+
+    virtual ECode ToPattern(
+        /* [out] */ String* pattern) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IMESSAGEFORMAT_H_GEN__
@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IMESSAGEFORMATFIELD_H_GEN__
+#define __CCM_TEXT_IMESSAGEFORMATFIELD_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IMessageFormatField;
+
+INTERFACE_ID(484a7e85-38ac-427a-b6b6-2ec6e6d51176)
+interface IMessageFormatField : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMessageFormatField* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMessageFormatField*)object->Probe(IID_IMessageFormatField);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMessageFormatField;
+    }
+
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IMESSAGEFORMATFIELD_H_GEN__
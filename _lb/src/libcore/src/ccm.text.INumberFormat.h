@@ -0,0 +1,125 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_INUMBERFORMAT_H_GEN__
+#define __CCM_TEXT_INUMBERFORMAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_INumberFormat;
+
+INTERFACE_ID(69ff7998-7fb1-4f1b-940d-30ad8d233113)
+interface INumberFormat : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static INumberFormat* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (INumberFormat*)object->Probe(IID_INumberFormat);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_INumberFormat;
+    }
+
+    virtual ECode Format(
+        /* [in] */ Long number,
+        /* [out] */ String* str) = 0;
+
+    virtual ECode Format(
+        /* [in] */ Double number,
+        /* [out] */ String* str) = 0;
+
+    virtual ECode Format(
+        /* [in] */ Long number,
+        /* [in, out] */ ccm::core::IStringBuffer* toAppendTo,
+        /* [in] */ ccm::text::IFieldPosition* pos) = 0;
+
+    virtual ECode Format(
+        /* [in] */ Double number,
+        /* [in, out] */ ccm::core::IStringBuffer* toAppendTo,
+        /* [in] */ ccm::text::IFieldPosition* pos) = 0;
+
+    virtual ECode GetCurrency(
+        /* [out] */ ccm::util::ICurrency** currency) = 0;
+
+    virtual ECode GetMaximumFractionDigits(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetMinimumFractionDigits(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetMaximumIntegerDigits(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetMinimumIntegerDigits(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetRoundingMode(
+        /* [out] */ ccm::math::RoundingMode* mode) = 0;
+
+    virtual ECode IsGroupingUsed(
+        /* [out] */ Boolean* value) = 0;
+
+    virtual ECode IsParseIntegerOnly(
+        /* [out] */ Boolean* value) = 0;
+
+    virtual ECode Parse(
+        /* [in] */ const String& source,
+        /* [out] */ ccm::core::INumber** number) = 0;
+
+    virtual ECode Parse(
+        /* [in] */ const String& source,
+        /* [in] */ ccm::text::IParsePosition* parsePosition,
+        /* [out] */ ccm::core::INumber** number) = 0;
+
+    virtual ECode SetCurrency(
+        /* [in] */ ccm::util::ICurrency* currency) = 0;
+
+    virtual ECode SetGroupingUsed(
+        /* [in] */ Boolean newValue) = 0;
+
+    virtual ECode SetMaximumFractionDigits(
+        /* [in] */ Integer newValue) = 0;
+
+    virtual ECode SetMinimumFractionDigits(
+        /* [in] */ Integer newValue) = 0;
+
+    virtual ECode SetMaximumIntegerDigits(
+        /* [in] */ Integer newValue) = 0;
+
+    virtual ECode SetMinimumIntegerDigits(
+        /* [in] */ Integer newValue) = 0;
+
+    virtual ECode SetRoundingMode(
+        /* [in] */ ccm::math::RoundingMode mode) = 0;
+
+    virtual ECode SetParseIntegerOnly(
+        /* [in] */ Boolean newValue) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_INUMBERFORMAT_H_GEN__
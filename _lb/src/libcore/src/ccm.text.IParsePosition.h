@@ -0,0 +1,62 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_IPARSEPOSITION_H_GEN__
+#define __CCM_TEXT_IPARSEPOSITION_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_IParsePosition;
+
+INTERFACE_ID(945c1201-ef77-48a8-9e96-6797d1e47c1c)
+interface IParsePosition : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IParsePosition* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IParsePosition*)object->Probe(IID_IParsePosition);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IParsePosition;
+    }
+
+    virtual ECode GetErrorIndex(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetIndex(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode SetErrorIndex(
+        /* [in] */ Integer index) = 0;
+
+    virtual ECode SetIndex(
+        /* [in] */ Integer index) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_IPARSEPOSITION_H_GEN__
@@ -0,0 +1,71 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEXT_ISIMPLEDATEFORMAT_H_GEN__
+#define __CCM_TEXT_ISIMPLEDATEFORMAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace text {
+
+extern const InterfaceID IID_ISimpleDateFormat;
+
+INTERFACE_ID(e2b13317-e567-4a78-96d1-caacffa88817)
+interface ISimpleDateFormat : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISimpleDateFormat* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISimpleDateFormat*)object->Probe(IID_ISimpleDateFormat);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ISimpleDateFormat;
+    }
+
+    virtual ECode ApplyLocalizedPattern(
+        /* [in] */ const String& pattern) = 0;
+
+    virtual ECode ApplyPattern(
+        /* [in] */ const String& pattern) = 0;
+
+    virtual ECode Get2DigitYearStart(
+        /* [out] */ ccm::util::IDate** startDate) = 0;
+
+    virtual ECode Set2DigitYearStart(
+        /* [in] */ ccm::util::IDate* startDate) = 0;
+
+    virtual ECode SetDateFormatSymbols(
+        /* [in] */ ccm::text::IDateFormatSymbols* newFormatSymbols) = 0;
+
+    virtual ECode ToLocalizedPattern(
+        /* [out] */ String* pattern) = 0;
+
+    virtual ECode ToPattern(
+        /* [out] */ String* pattern) = 0;
+};
+
+} // namespace text
+} // namespace ccm
+
+#endif // __CCM_TEXT_ISIMPLEDATEFORMAT_H_GEN__
@@ -0,0 +1,102 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ICSIMPLETIMEZONECLASSOBJECT_H_GEN__
+#define __CCM_UTIL_ICSIMPLETIMEZONECLASSOBJECT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ICSimpleTimeZoneClassObject;
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000000)
+interface ICSimpleTimeZoneClassObject : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICSimpleTimeZoneClassObject* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICSimpleTimeZoneClassObject*)object->Probe(IID_ICSimpleTimeZoneClassObject);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICSimpleTimeZoneClassObject;
+    }
+
+    virtual ECode CreateObject(
+        /* [in] */ Integer rawOffset,
+        /* [in] */ const String& id,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+
+    virtual ECode CreateObject(
+        /* [in] */ Integer rawOffset,
+        /* [in] */ const String& id,
+        /* [in] */ Integer startMonth,
+        /* [in] */ Integer startDay,
+        /* [in] */ Integer startDayOfWeek,
+        /* [in] */ Integer startTime,
+        /* [in] */ Integer endMonth,
+        /* [in] */ Integer endDay,
+        /* [in] */ Integer endDayOfWeek,
+        /* [in] */ Integer endTime,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+
+    virtual ECode CreateObject(
+        /* [in] */ Integer rawOffset,
+        /* [in] */ const String& id,
+        /* [in] */ Integer startMonth,
+        /* [in] */ Integer startDay,
+        /* [in] */ Integer startDayOfWeek,
+        /* [in] */ Integer startTime,
+        /* [in] */ Integer endMonth,
+        /* [in] */ Integer endDay,
+        /* [in] */ Integer endDayOfWeek,
+        /* [in] */ Integer endTime,
+        /* [in] */ Integer dstSavings,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+
+    virtual ECode CreateObject(
+        /* [in] */ Integer rawOffset,
+        /* [in] */ const String& id,
+        /* [in] */ Integer startMonth,
+        /* [in] */ Integer startDay,
+        /* [in] */ Integer startDayOfWeek,
+        /* [in] */ Integer startTime,
+        /* [in] */ Integer startTimeMode,
+        /* [in] */ Integer endMonth,
+        /* [in] */ Integer endDay,
+        /* [in] */ Integer endDayOfWeek,
+        /* [in] */ Integer endTime,
+        /* [in] */ Integer endTimeMode,
+        /* [in] */ Integer dstSavings,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ICSIMPLETIMEZONECLASSOBJECT_H_GEN__
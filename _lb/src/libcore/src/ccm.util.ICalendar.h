@@ -0,0 +1,248 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ICALENDAR_H_GEN__
+#define __CCM_UTIL_ICALENDAR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ICalendar;
+
+INTERFACE_ID(837f48fc-ccf7-4098-90cb-d02a3b83ef2f)
+interface ICalendar : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICalendar* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICalendar*)object->Probe(IID_ICalendar);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICalendar;
+    }
+
+    static constexpr Integer ERA = 0;
+    static constexpr Integer YEAR = 1;
+    static constexpr Integer MONTH = 2;
+    static constexpr Integer WEEK_OF_YEAR = 3;
+    static constexpr Integer WEEK_OF_MONTH = 4;
+    static constexpr Integer DATE = 5;
+    static constexpr Integer DAY_OF_MONTH = 5;
+    static constexpr Integer DAY_OF_YEAR = 6;
+    static constexpr Integer DAY_OF_WEEK = 7;
+    static constexpr Integer DAY_OF_WEEK_IN_MONTH = 8;
+    static constexpr Integer AM_PM = 9;
+    static constexpr Integer HOUR = 10;
+    static constexpr Integer HOUR_OF_DAY = 11;
+    static constexpr Integer MINUTE = 12;
+    static constexpr Integer SECOND = 13;
+    static constexpr Integer MILLISECOND = 14;
+    static constexpr Integer ZONE_OFFSET = 15;
+    static constexpr Integer DST_OFFSET = 16;
+    static constexpr Integer FIELD_COUNT = 17;
+    static constexpr Integer SUNDAY = 1;
+    static constexpr Integer MONDAY = 2;
+    static constexpr Integer TUESDAY = 3;
+    static constexpr Integer WEDNESDAY = 4;
+    static constexpr Integer THURSDAY = 5;
+    static constexpr Integer FRIDAY = 6;
+    static constexpr Integer SATURDAY = 7;
+    static constexpr Integer JANUARY = 0;
+    static constexpr Integer FEBRUARY = 1;
+    static constexpr Integer MARCH = 2;
+    static constexpr Integer APRIL = 3;
+    static constexpr Integer MAY = 4;
+    static constexpr Integer JUNE = 5;
+    static constexpr Integer JULY = 6;
+    static constexpr Integer AUGUST = 7;
+    static constexpr Integer SEPTEMBER = 8;
+    static constexpr Integer OCTOBER = 9;
+    static constexpr Integer NOVEMBER = 10;
+    static constexpr Integer DECEMBER = 11;
+    static constexpr Integer UNDECIMBER = 12;
+    static constexpr Integer AM = 0;
+    static constexpr Integer PM = 1;
+    static constexpr Integer ALL_STYLES = 0;
+    static constexpr Integer STANDALONE_MASK = 0x8000;
+    static constexpr Integer SHORT = 1;
+    static constexpr Integer LONG = 2;
+    static constexpr Integer NARROW_FORMAT = 4;
+    static constexpr Integer NARROW_STANDALONE = 32772;
+    static constexpr Integer SHORT_FORMAT = 1;
+    static constexpr Integer LONG_FORMAT = 2;
+    static constexpr Integer SHORT_STANDALONE = 32769;
+    static constexpr Integer LONG_STANDALONE = 32770;
+
+    virtual ECode Add(
+        /* [in] */ Integer field,
+        /* [in] */ Integer amount) = 0;
+
+    virtual ECode After(
+        /* [in] */ ccm::IInterface* when,
+        /* [out] */ Boolean* after) = 0;
+
+    virtual ECode Before(
+        /* [in] */ ccm::IInterface* when,
+        /* [out] */ Boolean* before) = 0;
+
+    virtual ECode Clear() = 0;
+
+    virtual ECode Clear(
+        /* [in] */ Integer field) = 0;
+
+    virtual ECode Get(
+        /* [in] */ Integer field,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetActualMaximum(
+        /* [in] */ Integer field,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetActualMinimum(
+        /* [in] */ Integer field,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetCalendarType(
+        /* [out] */ String* type) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [in] */ Integer field,
+        /* [in] */ Integer style,
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetDisplayNames(
+        /* [in] */ Integer field,
+        /* [in] */ Integer style,
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ ccm::util::IMap** names) = 0;
+
+    virtual ECode GetFirstDayOfWeek(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetGreatestMinimum(
+        /* [in] */ Integer field,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetLeastMaximum(
+        /* [in] */ Integer field,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetMaximum(
+        /* [in] */ Integer field,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetMinimalDaysInFirstWeek(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetMinimum(
+        /* [in] */ Integer field,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetTime(
+        /* [out] */ ccm::util::IDate** date) = 0;
+
+    virtual ECode GetTimeInMillis(
+        /* [out] */ Long* time) = 0;
+
+    virtual ECode GetTimeZone(
+        /* [out] */ ccm::util::ITimeZone** zone) = 0;
+
+    virtual ECode GetWeeksInWeekYear(
+        /* [out] */ Integer* weeks) = 0;
+
+    virtual ECode GetWeekYear(
+        /* [out] */ Integer* weekYear) = 0;
+
+    virtual ECode IsLenient(
+        /* [out] */ Boolean* lenient) = 0;
+
+    virtual ECode IsSet(
+        /* [in] */ Integer field,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode IsWeekDateSupported(
+        /* [out] */ Boolean* supported) = 0;
+
+    virtual ECode Roll(
+        /* [in] */ Integer field,
+        /* [in] */ Boolean up) = 0;
+
+    virtual ECode Roll(
+        /* [in] */ Integer field,
+        /* [in] */ Integer amount) = 0;
+
+    virtual ECode Set(
+        /* [in] */ Integer field,
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode Set(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer date) = 0;
+
+    virtual ECode Set(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer date,
+        /* [in] */ Integer hourOfDay,
+        /* [in] */ Integer minute) = 0;
+
+    virtual ECode Set(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer date,
+        /* [in] */ Integer hourOfDay,
+        /* [in] */ Integer minute,
+        /* [in] */ Integer second) = 0;
+
+    virtual ECode SetFirstDayOfWeek(
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode SetLenient(
+        /* [in] */ Boolean lenient) = 0;
+
+    virtual ECode SetMinimalDaysInFirstWeek(
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode SetTime(
+        /* [in] */ ccm::util::IDate* date) = 0;
+
+    virtual ECode SetTimeInMillis(
+        /* [in] */ Long millis) = 0;
+
+    virtual ECode SetTimeZone(
+        /* [in] */ ccm::util::ITimeZone* zone) = 0;
+
+    virtual ECode SetWeekDate(
+        /* [in] */ Integer weekYear,
+        /* [in] */ Integer weekOfYear,
+        /* [in] */ Integer dayOfWeek) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ICALENDAR_H_GEN__
@@ -0,0 +1,59 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ICOMPARATOR_H_GEN__
+#define __CCM_UTIL_ICOMPARATOR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IComparator;
+
+INTERFACE_ID(c548a9de-f3d8-4acb-83f3-00c65c1b56b2)
+interface IComparator : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IComparator* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IComparator*)object->Probe(IID_IComparator);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IComparator;
+    }
+
+    virtual ECode Compare(
+        /* [in] */ ccm::IInterface* o1,
+        /* [in] */ ccm::IInterface* o2,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode Equals(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* isEqual) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ICOMPARATOR_H_GEN__
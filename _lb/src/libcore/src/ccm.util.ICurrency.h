@@ -0,0 +1,73 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ICURRENCY_H_GEN__
+#define __CCM_UTIL_ICURRENCY_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ICurrency;
+
+INTERFACE_ID(23187573-410c-46a8-b371-ebe00ab19fcc)
+interface ICurrency : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICurrency* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICurrency*)object->Probe(IID_ICurrency);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICurrency;
+    }
+
+    virtual ECode GetCurrencyCode(
+        /* [out] */ String* currency) = 0;
+
+    virtual ECode GetDefaultFractionDigits(
+        /* [out] */ Integer* digits) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [out] */ String* displayName) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* displayName) = 0;
+
+    virtual ECode GetNumericCode(
+        /* [out] */ Integer* numericCode) = 0;
+
+    virtual ECode GetSymbol(
+        /* [out] */ String* symbol) = 0;
+
+    virtual ECode GetSymbol(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* symbol) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ICURRENCY_H_GEN__
@@ -0,0 +1,112 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IDATE_H_GEN__
+#define __CCM_UTIL_IDATE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IDate;
+
+INTERFACE_ID(6a87e3db-c2aa-470c-9638-4a2d31dfdd35)
+interface IDate : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDate* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDate*)object->Probe(IID_IDate);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDate;
+    }
+
+    virtual ECode After(
+        /* [in] */ ccm::util::IDate* when,
+        /* [out] */ Boolean* after) = 0;
+
+    virtual ECode Before(
+        /* [in] */ ccm::util::IDate* when,
+        /* [out] */ Boolean* before) = 0;
+
+    virtual ECode GetDate(
+        /* [out] */ Integer* date) = 0;
+
+    virtual ECode GetDay(
+        /* [out] */ Integer* day) = 0;
+
+    virtual ECode GetHours(
+        /* [out] */ Integer* hours) = 0;
+
+    virtual ECode GetMinutes(
+        /* [out] */ Integer* minutes) = 0;
+
+    virtual ECode GetMonth(
+        /* [out] */ Integer* month) = 0;
+
+    virtual ECode GetSeconds(
+        /* [out] */ Integer* seconds) = 0;
+
+    virtual ECode GetTime(
+        /* [out] */ Long* time) = 0;
+
+    virtual ECode GetTimezoneOffset(
+        /* [out] */ Integer* tzOffset) = 0;
+
+    virtual ECode GetYear(
+        /* [out] */ Integer* year) = 0;
+
+    virtual ECode SetDate(
+        /* [in] */ Integer date) = 0;
+
+    virtual ECode SetHours(
+        /* [in] */ Integer hours) = 0;
+
+    virtual ECode SetMinutes(
+        /* [in] */ Integer minutes) = 0;
+
+    virtual ECode SetMonth(
+        /* [in] */ Integer month) = 0;
+
+    virtual ECode SetSeconds(
+        /* [in] */ Integer seconds) = 0;
+
+    virtual ECode SetTime(
+        /* [in] */ Long time) = 0;
+
+    virtual ECode SetYear(
+        /* [in] */ Integer year) = 0;
+
+    virtual ECode ToGMTString(
+        /* [out] */ String* str) = 0;
+
+    virtual ECode ToLocaleString(
+        /* [out] */ String* str) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IDATE_H_GEN__
@@ -0,0 +1,135 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IDEQUE_H_GEN__
+#define __CCM_UTIL_IDEQUE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IDeque;
+
+INTERFACE_ID(1e4c819a-2017-4394-b0f4-75bbdd19e58a)
+interface IDeque : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDeque* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDeque*)object->Probe(IID_IDeque);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDeque;
+    }
+
+    virtual ECode Add(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode AddFirst(
+        /* [in] */ ccm::IInterface* e) = 0;
+
+    virtual ECode AddLast(
+        /* [in] */ ccm::IInterface* e) = 0;
+
+    virtual ECode Contains(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Element(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode GetDescendingIterator(
+        /* [out] */ ccm::util::IIterator** it) = 0;
+
+    virtual ECode GetFirst(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode GetIterator(
+        /* [out] */ ccm::util::IIterator** it) = 0;
+
+    virtual ECode GetLast(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode GetSize(
+        /* [out] */ Integer* size) = 0;
+
+    virtual ECode Offer(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode OfferFirst(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode OfferLast(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode Peek(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode PeekFirst(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode PeekLast(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode Poll(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode PollFirst(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode PollLast(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode Pop(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode Push(
+        /* [in] */ ccm::IInterface* e) = 0;
+
+    virtual ECode Remove(
+        /* [out] */ ccm::IInterface** e = nullptr) = 0;
+
+    virtual ECode RemoveFirst(
+        /* [out] */ ccm::IInterface** e = nullptr) = 0;
+
+    virtual ECode RemoveFirstOccurrence(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode RemoveLast(
+        /* [out] */ ccm::IInterface** e = nullptr) = 0;
+
+    virtual ECode RemoveLastOccurrence(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IDEQUE_H_GEN__
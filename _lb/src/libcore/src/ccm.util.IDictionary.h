@@ -0,0 +1,75 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IDICTIONARY_H_GEN__
+#define __CCM_UTIL_IDICTIONARY_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IDictionary;
+
+INTERFACE_ID(6e0f6eb5-6c0e-4f31-b042-d5cd18cf8a23)
+interface IDictionary : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IDictionary* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IDictionary*)object->Probe(IID_IDictionary);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IDictionary;
+    }
+
+    virtual ECode Get(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::IInterface** value) = 0;
+
+    virtual ECode GetElements(
+        /* [out] */ ccm::util::IEnumeration** elements) = 0;
+
+    virtual ECode GetKeys(
+        /* [out] */ ccm::util::IEnumeration** keys) = 0;
+
+    virtual ECode GetSize(
+        /* [out] */ Integer* size) = 0;
+
+    virtual ECode IsEmpty(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Put(
+        /* [in] */ ccm::IInterface* key,
+        /* [in] */ ccm::IInterface* value,
+        /* [out] */ ccm::IInterface** prevValue = nullptr) = 0;
+
+    virtual ECode Remove(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::IInterface** prevValue = nullptr) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IDICTIONARY_H_GEN__
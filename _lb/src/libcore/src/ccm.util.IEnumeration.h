@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IENUMERATION_H_GEN__
+#define __CCM_UTIL_IENUMERATION_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IEnumeration;
+
+INTERFACE_ID(63be1916-f500-4d5b-bf81-9fc21e9bee32)
+interface IEnumeration : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IEnumeration* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IEnumeration*)object->Probe(IID_IEnumeration);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IEnumeration;
+    }
+
+    virtual ECode HasMoreElements(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode NextElement(
+        /* [out] */ ccm::IInterface** object = nullptr) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IENUMERATION_H_GEN__
@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IFORMATTABLE_H_GEN__
+#define __CCM_UTIL_IFORMATTABLE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IFormattable;
+
+INTERFACE_ID(a509a4a4-6b8d-43fa-8364-e748406d9b5a)
+interface IFormattable : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFormattable* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFormattable*)object->Probe(IID_IFormattable);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFormattable;
+    }
+
+    virtual ECode FormatTo(
+        /* [in] */ ccm::util::IFormatter* formatter,
+        /* [in] */ Integer flags,
+        /* [in] */ Integer width,
+        /* [in] */ Integer precision) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IFORMATTABLE_H_GEN__
@@ -0,0 +1,75 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IFORMATTER_H_GEN__
+#define __CCM_UTIL_IFORMATTER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IFormatter;
+
+INTERFACE_ID(20aae661-0408-4d5e-a0ef-77e433774fac)
+interface IFormatter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFormatter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFormatter*)object->Probe(IID_IFormatter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFormatter;
+    }
+
+    virtual ECode Close() = 0;
+
+    virtual ECode Flush() = 0;
+
+    virtual ECode Format(
+        /* [in] */ const String& format,
+        /* [in] */ const Array<ccm::IInterface*>* args) = 0;
+
+    virtual ECode Format(
+        /* [in] */ ccm::util::ILocale* l,
+        /* [in] */ const String& format,
+        /* [in] */ const Array<ccm::IInterface*>* args) = 0;
+
+    virtual ECode GetIoException(
+        /* [out] */ ECode* ec) = 0;
+
+    virtual ECode GetLocale(
+        /* [out] */ ccm::util::ILocale** locale) = 0;
+
+    virtual ECode GetOut(
+        /* [out] */ ccm::core::IAppendable** output) = 0;
+
+    virtual ECode ToString(
+        /* [out] */ String* str) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IFORMATTER_H_GEN__
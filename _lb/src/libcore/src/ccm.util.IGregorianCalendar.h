@@ -0,0 +1,63 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IGREGORIANCALENDAR_H_GEN__
+#define __CCM_UTIL_IGREGORIANCALENDAR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IGregorianCalendar;
+
+INTERFACE_ID(d6e54cfc-072f-4dba-98c3-b73d0931a53b)
+interface IGregorianCalendar : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IGregorianCalendar* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IGregorianCalendar*)object->Probe(IID_IGregorianCalendar);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IGregorianCalendar;
+    }
+
+    static constexpr Integer BC = 0;
+    static constexpr Integer AD = 1;
+
+    virtual ECode GetGregorianChange(
+        /* [out] */ ccm::util::IDate** date) = 0;
+
+    virtual ECode IsLeapYear(
+        /* [in] */ Integer year,
+        /* [out] */ Boolean* leap) = 0;
+
+    virtual ECode SetGregorianChange(
+        /* [in] */ ccm::util::IDate* date) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IGREGORIANCALENDAR_H_GEN__
@@ -0,0 +1,108 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IHASHTABLE_H_GEN__
+#define __CCM_UTIL_IHASHTABLE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IHashtable;
+
+INTERFACE_ID(b60ce103-12d2-4b1f-ae56-b5d5feec23d2)
+interface IHashtable : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IHashtable* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IHashtable*)object->Probe(IID_IHashtable);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IHashtable;
+    }
+
+    virtual ECode Clear() = 0;
+
+    virtual ECode Contains(
+        /* [in] */ ccm::IInterface* value,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode ContainsKey(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode ContainsValue(
+        /* [in] */ ccm::IInterface* value,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Equals(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Get(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::IInterface** value) = 0;
+
+    virtual ECode GetElements(
+        /* [out] */ ccm::util::IEnumeration** elements) = 0;
+
+    virtual ECode GetEntrySet(
+        /* [out] */ ccm::util::ISet** entries) = 0;
+
+    virtual ECode GetHashCode(
+        /* [out] */ Integer* hash) = 0;
+
+    virtual ECode GetKeys(
+        /* [out] */ ccm::util::IEnumeration** keys) = 0;
+
+    virtual ECode GetValues(
+        /* [out] */ ccm::util::ICollection** values) = 0;
+
+    virtual ECode GetKeySet(
+        /* [out] */ ccm::util::ISet** keys) = 0;
+
+    virtual ECode GetSize(
+        /* [out] */ Integer* size) = 0;
+
+    virtual ECode IsEmpty(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Put(
+        /* [in] */ ccm::IInterface* key,
+        /* [in] */ ccm::IInterface* value,
+        /* [out] */ ccm::IInterface** prevValue = nullptr) = 0;
+
+    virtual ECode PutAll(
+        /* [in] */ ccm::util::IMap* m) = 0;
+
+    virtual ECode Remove(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::IInterface** prevValue = nullptr) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IHASHTABLE_H_GEN__
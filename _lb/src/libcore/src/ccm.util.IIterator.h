@@ -0,0 +1,58 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IITERATOR_H_GEN__
+#define __CCM_UTIL_IITERATOR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IIterator;
+
+INTERFACE_ID(7f59e8cb-ee27-4e7c-9d1a-98c8e7371fde)
+interface IIterator : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IIterator* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IIterator*)object->Probe(IID_IIterator);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IIterator;
+    }
+
+    virtual ECode Next(
+        /* [out] */ ccm::IInterface** object = nullptr) = 0;
+
+    virtual ECode HasNext(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Remove() = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IITERATOR_H_GEN__
@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IJAPANESEIMPERIALCALENDAR_H_GEN__
+#define __CCM_UTIL_IJAPANESEIMPERIALCALENDAR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IJapaneseImperialCalendar;
+
+INTERFACE_ID(7eab4e43-ab92-4309-a542-55d17a8dd6da)
+interface IJapaneseImperialCalendar : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IJapaneseImperialCalendar* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IJapaneseImperialCalendar*)object->Probe(IID_IJapaneseImperialCalendar);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IJapaneseImperialCalendar;
+    }
+
+    static constexpr Integer BEFORE_MEIJI = 0;
+    static constexpr Integer MEIJI = 1;
+    static constexpr Integer TAISHO = 2;
+    static constexpr Integer SHOWA = 3;
+    static constexpr Integer HEISEI = 4;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IJAPANESEIMPERIALCALENDAR_H_GEN__
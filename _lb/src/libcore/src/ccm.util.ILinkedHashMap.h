@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ILINKEDHASHMAP_H_GEN__
+#define __CCM_UTIL_ILINKEDHASHMAP_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ILinkedHashMap;
+
+INTERFACE_ID(b916c8bb-1d3e-4c7b-9d68-794c586a5e46)
+interface ILinkedHashMap : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ILinkedHashMap* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ILinkedHashMap*)object->Probe(IID_ILinkedHashMap);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ILinkedHashMap;
+    }
+
+    virtual ECode GetEldest(
+        /* [out] */ ccm::util::IMapEntry** entry) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ILINKEDHASHMAP_H_GEN__
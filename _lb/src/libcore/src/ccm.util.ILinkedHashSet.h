@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ILINKEDHASHSET_H_GEN__
+#define __CCM_UTIL_ILINKEDHASHSET_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ILinkedHashSet;
+
+INTERFACE_ID(15609b01-e234-4f70-ab52-1c2fdb3561eb)
+interface ILinkedHashSet : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ILinkedHashSet* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ILinkedHashSet*)object->Probe(IID_ILinkedHashSet);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ILinkedHashSet;
+    }
+
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ILINKEDHASHSET_H_GEN__
@@ -0,0 +1,145 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ILIST_H_GEN__
+#define __CCM_UTIL_ILIST_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IList;
+
+INTERFACE_ID(1e687607-efae-42a7-8ce2-24e51c81a616)
+interface IList : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IList* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IList*)object->Probe(IID_IList);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IList;
+    }
+
+    virtual ECode Add(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* result = nullptr) = 0;
+
+    virtual ECode Add(
+        /* [in] */ Integer index,
+        /* [in] */ ccm::IInterface* obj) = 0;
+
+    virtual ECode AddAll(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [out] */ Boolean* result = nullptr) = 0;
+
+    virtual ECode AddAll(
+        /* [in] */ Integer index,
+        /* [in] */ ccm::util::ICollection* c,
+        /* [out] */ Boolean* result = nullptr) = 0;
+
+    virtual ECode Clear() = 0;
+
+    virtual ECode Contains(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode ContainsAll(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Equals(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Get(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::IInterface** obj) = 0;
+
+    virtual ECode GetHashCode(
+        /* [out] */ Integer* hash) = 0;
+
+    virtual ECode GetIterator(
+        /* [out] */ ccm::util::IIterator** it) = 0;
+
+    virtual ECode GetListIterator(
+        /* [out] */ ccm::util::IListIterator** it) = 0;
+
+    virtual ECode GetListIterator(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::util::IListIterator** it) = 0;
+
+    virtual ECode GetSize(
+        /* [out] */ Integer* size) = 0;
+
+    virtual ECode IndexOf(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode IsEmpty(
+        /* [out] */ Boolean* empty) = 0;
+
+    virtual ECode LastIndexOf(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode Remove(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* result = nullptr) = 0;
+
+    virtual ECode Remove(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::IInterface** obj = nullptr) = 0;
+
+    virtual ECode RemoveAll(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [out] */ Boolean* result = nullptr) = 0;
+
+    virtual ECode RetainAll(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [out] */ Boolean* result = nullptr) = 0;
+
+    virtual ECode Set(
+        /* [in] */ Integer index,
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ ccm::IInterface** prevObj = nullptr) = 0;
+
+    virtual ECode SubList(
+        /* [in] */ Integer fromIndex,
+        /* [in] */ Integer toIndex,
+        /* [out] */ ccm::util::IList** subList) = 0;
+
+    virtual ECode ToArray(
+        /* [out, callee] */ Array<ccm::IInterface*>* objs) = 0;
+
+    virtual ECode ToArray(
+        /* [in] */ const InterfaceID& iid,
+        /* [out, callee] */ Array<ccm::IInterface*>* objs) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ILIST_H_GEN__
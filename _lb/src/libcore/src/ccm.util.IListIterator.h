@@ -0,0 +1,76 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ILISTITERATOR_H_GEN__
+#define __CCM_UTIL_ILISTITERATOR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IListIterator;
+
+INTERFACE_ID(e8665718-bf0d-4054-850c-a30098de04b8)
+interface IListIterator : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IListIterator* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IListIterator*)object->Probe(IID_IListIterator);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IListIterator;
+    }
+
+    virtual ECode Add(
+        /* [in] */ ccm::IInterface* object) = 0;
+
+    virtual ECode GetNextIndex(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetPreviousIndex(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode HasNext(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode HasPrevious(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Next(
+        /* [out] */ ccm::IInterface** object = nullptr) = 0;
+
+    virtual ECode Previous(
+        /* [out] */ ccm::IInterface** object = nullptr) = 0;
+
+    virtual ECode Remove() = 0;
+
+    virtual ECode Set(
+        /* [in] */ ccm::IInterface* object) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ILISTITERATOR_H_GEN__
@@ -0,0 +1,123 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ILOCALE_H_GEN__
+#define __CCM_UTIL_ILOCALE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ILocale;
+
+INTERFACE_ID(e23a921a-6d45-4b08-89e3-f09778118022)
+interface ILocale : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ILocale* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ILocale*)object->Probe(IID_ILocale);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ILocale;
+    }
+
+    virtual ECode GetCountry(
+        /* [out] */ String* country) = 0;
+
+    virtual ECode GetDisplayCountry(
+        /* [out] */ String* country) = 0;
+
+    virtual ECode GetDisplayCountry(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* country) = 0;
+
+    virtual ECode GetDisplayLanguage(
+        /* [out] */ String* language) = 0;
+
+    virtual ECode GetDisplayLanguage(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* language) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetDisplayScript(
+        /* [out] */ String* script) = 0;
+
+    virtual ECode GetDisplayScript(
+        /* [in] */ ccm::util::ILocale* inLocale,
+        /* [out] */ String* script) = 0;
+
+    virtual ECode GetDisplayVariant(
+        /* [out] */ String* variant) = 0;
+
+    virtual ECode GetDisplayVariant(
+        /* [in] */ ccm::util::ILocale* inLocale,
+        /* [out] */ String* variant) = 0;
+
+    virtual ECode GetExtension(
+        /* [in] */ Char key,
+        /* [out] */ String* extension) = 0;
+
+    virtual ECode GetExtensionKeys(
+        /* [out] */ ccm::util::ISet** keys) = 0;
+
+    virtual ECode GetISO3Country(
+        /* [out] */ String* country) = 0;
+
+    virtual ECode GetISO3Language(
+        /* [out] */ String* language) = 0;
+
+    virtual ECode GetLanguage(
+        /* [out] */ String* language) = 0;
+
+    virtual ECode GetScript(
+        /* [out] */ String* script) = 0;
+
+    virtual ECode GetUnicodeLocaleAttributes(
+        /* [out] */ ccm::util::ISet** attrs) = 0;
+
+    virtual ECode GetUnicodeLocaleKeys(
+        /* [out] */ ccm::util::ISet** keys) = 0;
+
+    virtual ECode GetUnicodeLocaleType(
+        /* [in] */ const String& key,
+        /* [out] */ String* type) = 0;
+
+    virtual ECode GetVariant(
+        /* [out] */ String* variant) = 0;
+
+    virtual ECode ToLanguageTag(
+        /* [out] */ String* langTag) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ILOCALE_H_GEN__
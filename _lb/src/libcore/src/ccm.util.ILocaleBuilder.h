@@ -0,0 +1,89 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ILOCALEBUILDER_H_GEN__
+#define __CCM_UTIL_ILOCALEBUILDER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ILocaleBuilder;
+
+INTERFACE_ID(533f5611-bdc2-4c2a-a6f7-07a9267080c2)
+interface ILocaleBuilder : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ILocaleBuilder* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ILocaleBuilder*)object->Probe(IID_ILocaleBuilder);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ILocaleBuilder;
+    }
+
+    virtual ECode AddUnicodeLocaleAttribute(
+        /* [in] */ const String& attribute) = 0;
+
+    virtual ECode Build(
+        /* [out] */ ccm::util::ILocale** locale) = 0;
+
+    virtual ECode Clear() = 0;
+
+    virtual ECode ClearExtensions() = 0;
+
+    virtual ECode RemoveUnicodeLocaleAttribute(
+        /* [in] */ const String& attribute) = 0;
+
+    virtual ECode SetExtension(
+        /* [in] */ Char key,
+        /* [in] */ const String& value) = 0;
+
+    virtual ECode SetLanguage(
+        /* [in] */ const String& language) = 0;
+
+    virtual ECode SetLanguageTag(
+        /* [in] */ const String& languageTag) = 0;
+
+    virtual ECode SetLocale(
+        /* [in] */ ccm::util::ILocale* locale) = 0;
+
+    virtual ECode SetRegion(
+        /* [in] */ const String& region) = 0;
+
+    virtual ECode SetScript(
+        /* [in] */ const String& script) = 0;
+
+    virtual ECode SetUnicodeLocaleKeyword(
+        /* [in] */ const String& key,
+        /* [in] */ const String& type) = 0;
+
+    virtual ECode SetVariant(
+        /* [in] */ const String& variant) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ILOCALEBUILDER_H_GEN__
@@ -0,0 +1,62 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ILOCALECATEGORY_H_GEN__
+#define __CCM_UTIL_ILOCALECATEGORY_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ILocaleCategory;
+
+INTERFACE_ID(b77f3ad5-3301-486b-a529-24fe27caa151)
+interface ILocaleCategory : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ILocaleCategory* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ILocaleCategory*)object->Probe(IID_ILocaleCategory);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ILocaleCategory;
+    }
+
+    virtual ECode GetLanguageKey(
+        /* [out] */ String* key) = 0;
+
+    virtual ECode GetScriptKey(
+        /* [out] */ String* key) = 0;
+
+    virtual ECode GetCountryKey(
+        /* [out] */ String* key) = 0;
+
+    virtual ECode GetVariantKey(
+        /* [out] */ String* key) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ILOCALECATEGORY_H_GEN__
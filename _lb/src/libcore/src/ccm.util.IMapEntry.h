@@ -0,0 +1,67 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IMAPENTRY_H_GEN__
+#define __CCM_UTIL_IMAPENTRY_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IMapEntry;
+
+INTERFACE_ID(7eb63931-9e1d-4a39-b51f-a8e793aa98d7)
+interface IMapEntry : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMapEntry* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMapEntry*)object->Probe(IID_IMapEntry);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMapEntry;
+    }
+
+    virtual ECode Equals(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode GetHashCode(
+        /* [out] */ Integer* hash) = 0;
+
+    virtual ECode GetKey(
+        /* [out] */ ccm::IInterface** key) = 0;
+
+    virtual ECode GetValue(
+        /* [out] */ ccm::IInterface** value) = 0;
+
+    virtual ECode SetValue(
+        /* [in] */ ccm::IInterface* value,
+        /* [out] */ ccm::IInterface** prevValue = nullptr) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IMAPENTRY_H_GEN__
@@ -0,0 +1,133 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_INAVIGABLEMAP_H_GEN__
+#define __CCM_UTIL_INAVIGABLEMAP_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_INavigableMap;
+
+INTERFACE_ID(db174312-1174-4777-8e66-e6f72359d0b8)
+interface INavigableMap : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static INavigableMap* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (INavigableMap*)object->Probe(IID_INavigableMap);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_INavigableMap;
+    }
+
+    virtual ECode CeilingEntry(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::util::IMapEntry** entry) = 0;
+
+    virtual ECode CeilingKey(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::IInterface** ceilingkey) = 0;
+
+    virtual ECode DescendingKeySet(
+        /* [out] */ ccm::util::INavigableSet** keyset) = 0;
+
+    virtual ECode DescendingMap(
+        /* [out] */ ccm::util::INavigableMap** map) = 0;
+
+    virtual ECode FirstEntry(
+        /* [out] */ ccm::util::IMapEntry** entry) = 0;
+
+    virtual ECode FloorEntry(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::util::IMapEntry** entry) = 0;
+
+    virtual ECode FloorKey(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::IInterface** floorkey) = 0;
+
+    virtual ECode HeadMap(
+        /* [in] */ ccm::IInterface* toKey,
+        /* [out] */ ccm::util::ISortedMap** headmap) = 0;
+
+    virtual ECode HeadMap(
+        /* [in] */ ccm::IInterface* key,
+        /* [in] */ Boolean inclusive,
+        /* [out] */ ccm::util::INavigableMap** headmap) = 0;
+
+    virtual ECode HigherEntry(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::util::IMapEntry** entry) = 0;
+
+    virtual ECode HigherKey(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::IInterface** higherkey) = 0;
+
+    virtual ECode LastEntry(
+        /* [out] */ ccm::util::IMapEntry** entry) = 0;
+
+    virtual ECode LowerEntry(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::util::IMapEntry** entry) = 0;
+
+    virtual ECode LowerKey(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::IInterface** lowerkey) = 0;
+
+    virtual ECode NavigableKeySet(
+        /* [out] */ ccm::util::INavigableSet** keyset) = 0;
+
+    virtual ECode PollFirstEntry(
+        /* [out] */ ccm::util::IMapEntry** entry) = 0;
+
+    virtual ECode PollLastEntry(
+        /* [out] */ ccm::util::IMapEntry** entry) = 0;
+
+    virtual ECode SubMap(
+        /* [in] */ ccm::IInterface* fromKey,
+        /* [in] */ ccm::IInterface* toKey,
+        /* [out] */ ccm::util::ISortedMap** submap) = 0;
+
+    virtual ECode SubMap(
+        /* [in] */ ccm::IInterface* fromKey,
+        /* [in] */ Boolean fromInclusive,
+        /* [in] */ ccm::IInterface* toKey,
+        /* [in] */ Boolean toInclusive,
+        /* [out] */ ccm::util::INavigableMap** submap) = 0;
+
+    virtual ECode TailMap(
+        /* [in] */ ccm::IInterface* fromKey,
+        /* [out] */ ccm::util::ISortedMap** tailmap) = 0;
+
+    virtual ECode TailMap(
+        /* [in] */ ccm::IInterface* fromKey,
+        /* [in] */ Boolean inclusive,
+        /* [out] */ ccm::util::INavigableMap** tailmap) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_INAVIGABLEMAP_H_GEN__
@@ -0,0 +1,111 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_INAVIGABLESET_H_GEN__
+#define __CCM_UTIL_INAVIGABLESET_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_INavigableSet;
+
+INTERFACE_ID(d9a99667-b9b3-43bb-94dc-7645f7313c57)
+interface INavigableSet : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static INavigableSet* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (INavigableSet*)object->Probe(IID_INavigableSet);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_INavigableSet;
+    }
+
+    virtual ECode Ceiling(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ ccm::IInterface** ceilingE) = 0;
+
+    virtual ECode GetDescendingIterator(
+        /* [out] */ ccm::util::IIterator** it) = 0;
+
+    virtual ECode DescendingSet(
+        /* [out] */ ccm::util::INavigableSet** set) = 0;
+
+    virtual ECode Floor(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ ccm::IInterface** floorE) = 0;
+
+    virtual ECode GetIterator(
+        /* [out] */ ccm::util::IIterator** it) = 0;
+
+    virtual ECode HeadSet(
+        /* [in] */ ccm::IInterface* toElement,
+        /* [out] */ ccm::util::ISortedSet** headset) = 0;
+
+    virtual ECode HeadSet(
+        /* [in] */ ccm::IInterface* toElement,
+        /* [in] */ Boolean inclusive,
+        /* [out] */ ccm::util::INavigableSet** headset) = 0;
+
+    virtual ECode Higher(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ ccm::IInterface** higherE) = 0;
+
+    virtual ECode Lower(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ ccm::IInterface** lowerE) = 0;
+
+    virtual ECode PollFirst(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode PollLast(
+        /* [out] */ ccm::IInterface** e) = 0;
+
+    virtual ECode SubSet(
+        /* [in] */ ccm::IInterface* fromElement,
+        /* [in] */ ccm::IInterface* toElement,
+        /* [out] */ ccm::util::ISortedSet** subset) = 0;
+
+    virtual ECode SubSet(
+        /* [in] */ ccm::IInterface* fromElement,
+        /* [in] */ Boolean fromInclusive,
+        /* [in] */ ccm::IInterface* toElement,
+        /* [in] */ Boolean toInclusive,
+        /* [out] */ ccm::util::INavigableSet** subset) = 0;
+
+    virtual ECode TailSet(
+        /* [in] */ ccm::IInterface* fromElement,
+        /* [out] */ ccm::util::ISortedSet** tailset) = 0;
+
+    virtual ECode TailSet(
+        /* [in] */ ccm::IInterface* fromElement,
+        /* [in] */ Boolean inclusive,
+        /* [out] */ ccm::util::INavigableSet** tailset) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_INAVIGABLESET_H_GEN__
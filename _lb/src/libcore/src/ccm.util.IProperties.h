@@ -0,0 +1,106 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IPROPERTIES_H_GEN__
+#define __CCM_UTIL_IPROPERTIES_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IProperties;
+
+INTERFACE_ID(417c6542-16e1-4542-b387-3f5075d73bee)
+interface IProperties : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IProperties* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IProperties*)object->Probe(IID_IProperties);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IProperties;
+    }
+
+    virtual ECode GetProperty(
+        /* [in] */ const String& key,
+        /* [out] */ String* value) = 0;
+
+    virtual ECode GetProperty(
+        /* [in] */ const String& key,
+        /* [in] */ const String& defaultValue,
+        /* [out] */ String* value) = 0;
+
+    virtual ECode List(
+        /* [in] */ ccm::io::IPrintStream* outstream) = 0;
+
+    virtual ECode List(
+        /* [in] */ ccm::io::IPrintWriter* outwriter) = 0;
+
+    virtual ECode Load(
+        /* [in] */ ccm::io::IInputStream* instream) = 0;
+
+    virtual ECode Load(
+        /* [in] */ ccm::io::IReader* reader) = 0;
+
+    virtual ECode LoadFromXML(
+        /* [in] */ ccm::io::IInputStream* instream) = 0;
+
+    virtual ECode PropertyNames(
+        /* [out] */ ccm::util::IEnumeration** names) = 0;
+
+    virtual ECode Save(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ const String& comments) = 0;
+
+    virtual ECode SetProperty(
+        /* [in] */ const String& key,
+        /* [in] */ const String& value,
+        /* [out] */ String* prevValue = nullptr) = 0;
+
+    virtual ECode StringPropertyNames(
+        /* [out] */ ccm::util::ISet** names) = 0;
+
+    virtual ECode Store(
+        /* [in] */ ccm::io::IOutputStream* outstream,
+        /* [in] */ const String& comment) = 0;
+
+    virtual ECode Store(
+        /* [in] */ ccm::io::IWriter* writer,
+        /* [in] */ const String& comment) = 0;
+
+    virtual ECode StoreToXML(
+        /* [in] */ ccm::io::IOutputStream* os,
+        /* [in] */ const String& comment) = 0;
+
+    virtual ECode StoreToXML(
+        /* [in] */ ccm::io::IOutputStream* os,
+        /* [in] */ const String& comment,
+        /* [in] */ const String& encoding) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IPROPERTIES_H_GEN__
@@ -0,0 +1,70 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IQUEUE_H_GEN__
+#define __CCM_UTIL_IQUEUE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IQueue;
+
+INTERFACE_ID(361efe2d-dc2c-4234-aaa3-275ff00515f5)
+interface IQueue : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IQueue* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IQueue*)object->Probe(IID_IQueue);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IQueue;
+    }
+
+    virtual ECode Add(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode Element(
+        /* [out] */ ccm::IInterface** head) = 0;
+
+    virtual ECode Offer(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode Peek(
+        /* [out] */ ccm::IInterface** head) = 0;
+
+    virtual ECode Poll(
+        /* [out] */ ccm::IInterface** head = nullptr) = 0;
+
+    virtual ECode Remove(
+        /* [out] */ ccm::IInterface** head = nullptr) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IQUEUE_H_GEN__
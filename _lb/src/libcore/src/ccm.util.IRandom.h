@@ -0,0 +1,78 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IRANDOM_H_GEN__
+#define __CCM_UTIL_IRANDOM_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IRandom;
+
+INTERFACE_ID(b262d480-e46b-49c2-acba-98478d810a12)
+interface IRandom : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IRandom* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IRandom*)object->Probe(IID_IRandom);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IRandom;
+    }
+
+    virtual ECode NextBoolean(
+        /* [out] */ Boolean* value) = 0;
+
+    virtual ECode NextBytes(
+        /* [out] */ Array<Byte>& bytes) = 0;
+
+    virtual ECode NextDouble(
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode NextFloat(
+        /* [out] */ Float* value) = 0;
+
+    virtual ECode NextGaussian(
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode NextInteger(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode NextInteger(
+        /* [in] */ Integer bound,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode NextLong(
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode SetSeed(
+        /* [in] */ Long seed) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IRANDOM_H_GEN__
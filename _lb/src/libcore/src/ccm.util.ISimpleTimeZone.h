@@ -0,0 +1,96 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ISIMPLETIMEZONE_H_GEN__
+#define __CCM_UTIL_ISIMPLETIMEZONE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ISimpleTimeZone;
+
+INTERFACE_ID(2a48ddd4-009a-4f55-86bd-825b421ead3c)
+interface ISimpleTimeZone : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISimpleTimeZone* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISimpleTimeZone*)object->Probe(IID_ISimpleTimeZone);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ISimpleTimeZone;
+    }
+
+    static constexpr Integer WALL_TIME = 0;
+    static constexpr Integer STANDARD_TIME = 1;
+    static constexpr Integer UTC_TIME = 2;
+
+    virtual ECode SetDSTSavings(
+        /* [in] */ Integer millisSavedDuringDST) = 0;
+
+    virtual ECode SetEndRule(
+        /* [in] */ Integer endMonth,
+        /* [in] */ Integer endDay,
+        /* [in] */ Integer endTime) = 0;
+
+    virtual ECode SetEndRule(
+        /* [in] */ Integer endMonth,
+        /* [in] */ Integer endDay,
+        /* [in] */ Integer endDayOfWeek,
+        /* [in] */ Integer endTime) = 0;
+
+    virtual ECode SetEndRule(
+        /* [in] */ Integer endMonth,
+        /* [in] */ Integer endDay,
+        /* [in] */ Integer endDayOfWeek,
+        /* [in] */ Integer endTime,
+        /* [in] */ Boolean after) = 0;
+
+    virtual ECode SetStartRule(
+        /* [in] */ Integer startMonth,
+        /* [in] */ Integer startDay,
+        /* [in] */ Integer startTime) = 0;
+
+    virtual ECode SetStartRule(
+        /* [in] */ Integer startMonth,
+        /* [in] */ Integer startDay,
+        /* [in] */ Integer startDayOfWeek,
+        /* [in] */ Integer startTime) = 0;
+
+    virtual ECode SetStartRule(
+        /* [in] */ Integer startMonth,
+        /* [in] */ Integer startDay,
+        /* [in] */ Integer startDayOfWeek,
+        /* [in] */ Integer startTime,
+        /* [in] */ Boolean after) = 0;
+
+    virtual ECode SetStartYear(
+        /* [in] */ Integer year) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ISIMPLETIMEZONE_H_GEN__
@@ -0,0 +1,72 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ISORTEDMAP_H_GEN__
+#define __CCM_UTIL_ISORTEDMAP_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ISortedMap;
+
+INTERFACE_ID(d29b6732-8fdc-45ed-93c1-3fe8207030e1)
+interface ISortedMap : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISortedMap* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISortedMap*)object->Probe(IID_ISortedMap);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ISortedMap;
+    }
+
+    virtual ECode Comparator(
+        /* [out] */ ccm::util::IComparator** comparator) = 0;
+
+    virtual ECode FirstKey(
+        /* [out] */ ccm::IInterface** key) = 0;
+
+    virtual ECode HeadMap(
+        /* [in] */ ccm::IInterface* toKey,
+        /* [out] */ ccm::util::ISortedMap** headmap) = 0;
+
+    virtual ECode LastKey(
+        /* [out] */ ccm::IInterface** key) = 0;
+
+    virtual ECode SubMap(
+        /* [in] */ ccm::IInterface* fromKey,
+        /* [in] */ ccm::IInterface* toKey,
+        /* [out] */ ccm::util::ISortedMap** submap) = 0;
+
+    virtual ECode TailMap(
+        /* [in] */ ccm::IInterface* fromKey,
+        /* [out] */ ccm::util::ISortedMap** tailmap) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ISORTEDMAP_H_GEN__
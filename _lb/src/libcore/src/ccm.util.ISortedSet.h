@@ -0,0 +1,79 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ISORTEDSET_H_GEN__
+#define __CCM_UTIL_ISORTEDSET_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ISortedSet;
+
+INTERFACE_ID(87972ee6-547a-4ae5-b17d-a7e8f8ec794a)
+interface ISortedSet : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISortedSet* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISortedSet*)object->Probe(IID_ISortedSet);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ISortedSet;
+    }
+
+    virtual ECode Add(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* modified = nullptr) = 0;
+
+    virtual ECode Comparator(
+        /* [out] */ ccm::util::IComparator** comparator) = 0;
+
+    virtual ECode First(
+        /* [out] */ ccm::IInterface** element) = 0;
+
+    virtual ECode GetIterator(
+        /* [out] */ ccm::util::IIterator** it) = 0;
+
+    virtual ECode HeadSet(
+        /* [in] */ ccm::IInterface* toElement,
+        /* [out] */ ccm::util::ISortedSet** headset) = 0;
+
+    virtual ECode Last(
+        /* [out] */ ccm::IInterface** element) = 0;
+
+    virtual ECode SubSet(
+        /* [in] */ ccm::IInterface* fromElement,
+        /* [in] */ ccm::IInterface* toElement,
+        /* [out] */ ccm::util::ISortedSet** subset) = 0;
+
+    virtual ECode TailSet(
+        /* [in] */ ccm::IInterface* fromElement,
+        /* [out] */ ccm::util::ISortedSet** tailset) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ISORTEDSET_H_GEN__
@@ -0,0 +1,69 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ISTRINGTOKENIZER_H_GEN__
+#define __CCM_UTIL_ISTRINGTOKENIZER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IStringTokenizer;
+
+INTERFACE_ID(8283c934-d3ce-4a7b-ad50-a97f757ce121)
+interface IStringTokenizer : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStringTokenizer* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStringTokenizer*)object->Probe(IID_IStringTokenizer);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStringTokenizer;
+    }
+
+    virtual ECode CountTokens(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode HasMoreElements(
+        /* [out] */ Boolean* hasMore) = 0;
+
+    virtual ECode HasMoreTokens(
+        /* [out] */ Boolean* hasMore) = 0;
+
+    virtual ECode NextElement(
+        /* [out] */ ccm::IInterface** element = nullptr) = 0;
+
+    virtual ECode NextToken(
+        /* [out] */ String* token = nullptr) = 0;
+
+    virtual ECode NextToken(
+        /* [in] */ const String& delim,
+        /* [out] */ String* token = nullptr) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ISTRINGTOKENIZER_H_GEN__
@@ -0,0 +1,113 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_ITIMEZONE_H_GEN__
+#define __CCM_UTIL_ITIMEZONE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_ITimeZone;
+
+INTERFACE_ID(d1094f3a-c45b-4188-a973-266a5ad2e84a)
+interface ITimeZone : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ITimeZone* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ITimeZone*)object->Probe(IID_ITimeZone);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ITimeZone;
+    }
+
+    static constexpr Integer SHORT = 0;
+    static constexpr Integer LONG = 1;
+
+    virtual ECode GetID(
+        /* [out] */ String* id) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [in] */ Boolean daylight,
+        /* [in] */ Integer style,
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [in] */ Boolean daylightTime,
+        /* [in] */ Integer style,
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetDSTSavings(
+        /* [out] */ Integer* savingTime) = 0;
+
+    virtual ECode GetOffset(
+        /* [in] */ Long date,
+        /* [out] */ Integer* offset) = 0;
+
+    virtual ECode GetOffset(
+        /* [in] */ Integer era,
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer day,
+        /* [in] */ Integer dayOfWeek,
+        /* [in] */ Integer milliseconds,
+        /* [out] */ Integer* offset) = 0;
+
+    virtual ECode GetRawOffset(
+        /* [out] */ Integer* offset) = 0;
+
+    virtual ECode HasSameRules(
+        /* [in] */ ccm::util::ITimeZone* other,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode InDaylightTime(
+        /* [in] */ ccm::util::IDate* date,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode ObservesDaylightTime(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode SetID(
+        /* [in] */ const String& ID) = 0;
+
+    virtual ECode SetRawOffset(
+        /* [in] */ Integer offsetMillis) = 0;
+
+    virtual ECode UseDaylightTime(
+        /* [out] */ Boolean* result) = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_ITIMEZONE_H_GEN__
@@ -0,0 +1,195 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_IVECTOR_H_GEN__
+#define __CCM_UTIL_IVECTOR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+
+extern const InterfaceID IID_IVector;
+
+INTERFACE_ID(496d3da5-9000-439e-bd01-3cf04a043f44)
+interface IVector : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IVector* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IVector*)object->Probe(IID_IVector);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IVector;
+    }
+
+    virtual ECode Add(
+        /* [in] */ ccm::IInterface* e,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode Add(
+        /* [in] */ Integer index,
+        /* [in] */ ccm::IInterface* obj) = 0;
+
+    virtual ECode AddAll(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode AddAll(
+        /* [in] */ Integer index,
+        /* [in] */ ccm::util::ICollection* c,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode AddElement(
+        /* [in] */ ccm::IInterface* e) = 0;
+
+    virtual ECode Clear() = 0;
+
+    virtual ECode Contains(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode ContainsAll(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode CopyInto(
+        /* [out] */ Array<ccm::IInterface*>& anArray) = 0;
+
+    virtual ECode EnsureCapacity(
+        /* [in] */ Integer minCapacity) = 0;
+
+    virtual ECode Get(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::IInterface** obj) = 0;
+
+    virtual ECode GetCapacity(
+        /* [out] */ Integer* capacity) = 0;
+
+    virtual ECode GetElementAt(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::IInterface** element) = 0;
+
+    virtual ECode GetElements(
+        /* [out] */ ccm::util::IEnumeration** elements) = 0;
+
+    virtual ECode GetFirstElement(
+        /* [out] */ ccm::IInterface** element) = 0;
+
+    virtual ECode GetIterator(
+        /* [out] */ ccm::util::IIterator** it) = 0;
+
+    virtual ECode GetLastElement(
+        /* [out] */ ccm::IInterface** element) = 0;
+
+    virtual ECode GetListIterator(
+        /* [out] */ ccm::util::IListIterator** it) = 0;
+
+    virtual ECode GetListIterator(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::util::IListIterator** it) = 0;
+
+    virtual ECode GetSize(
+        /* [out] */ Integer* size) = 0;
+
+    virtual ECode IndexOf(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode IndexOf(
+        /* [in] */ ccm::IInterface* obj,
+        /* [in] */ Integer fromIndex,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode InsertElementAt(
+        /* [in] */ ccm::IInterface* obj,
+        /* [in] */ Integer index) = 0;
+
+    virtual ECode IsEmpty(
+        /* [out] */ Boolean* empty) = 0;
+
+    virtual ECode LastIndexOf(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode LastIndexOf(
+        /* [in] */ ccm::IInterface* obj,
+        /* [in] */ Integer fromIndex,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode Remove(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode Remove(
+        /* [in] */ Integer index,
+        /* [out] */ ccm::IInterface** obj = nullptr) = 0;
+
+    virtual ECode RemoveAll(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode RemoveAllElements() = 0;
+
+    virtual ECode RemoveElement(
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode RemoveElementAt(
+        /* [in] */ Integer index) = 0;
+
+    virtual ECode RetainAll(
+        /* [in] */ ccm::util::ICollection* c,
+        /* [out] */ Boolean* changed = nullptr) = 0;
+
+    virtual ECode Set(
+        /* [in] */ Integer index,
+        /* [in] */ ccm::IInterface* obj,
+        /* [out] */ ccm::IInterface** prevObj = nullptr) = 0;
+
+    virtual ECode SetElementAt(
+        /* [in] */ ccm::IInterface* obj,
+        /* [in] */ Integer index) = 0;
+
+    virtual ECode SetSize(
+        /* [in] */ Integer newSize) = 0;
+
+    virtual ECode SubList(
+        /* [in] */ Integer fromIndex,
+        /* [in] */ Integer toIndex,
+        /* [out] */ ccm::util::IList** subList) = 0;
+
+    virtual ECode ToArray(
+        /* [out, callee] */ Array<ccm::IInterface*>* objs) = 0;
+
+    virtual ECode ToArray(
+        /* [in] */ const InterfaceID& iid,
+        /* [out, callee] */ Array<ccm::IInterface*>* objs) = 0;
+
+    virtual ECode TrimToSize() = 0;
+};
+
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_IVECTOR_H_GEN__
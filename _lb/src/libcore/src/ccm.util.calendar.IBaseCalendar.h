@@ -0,0 +1,99 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CALENDAR_IBASECALENDAR_H_GEN__
+#define __CCM_UTIL_CALENDAR_IBASECALENDAR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+extern const InterfaceID IID_IBaseCalendar;
+
+INTERFACE_ID(6fcbaf39-7d01-4928-8647-002fadd1c00d)
+interface IBaseCalendar : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IBaseCalendar* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IBaseCalendar*)object->Probe(IID_IBaseCalendar);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IBaseCalendar;
+    }
+
+    static constexpr Integer JANUARY = 1;
+    static constexpr Integer FEBRUARY = 2;
+    static constexpr Integer MARCH = 3;
+    static constexpr Integer APRIL = 4;
+    static constexpr Integer MAY = 5;
+    static constexpr Integer JUNE = 6;
+    static constexpr Integer JULY = 7;
+    static constexpr Integer AUGUST = 8;
+    static constexpr Integer SEPTEMBER = 9;
+    static constexpr Integer OCTOBER = 10;
+    static constexpr Integer NOVEMBER = 11;
+    static constexpr Integer DECEMBER = 12;
+    static constexpr Integer SUNDAY = 1;
+    static constexpr Integer MONDAY = 2;
+    static constexpr Integer TUESDAY = 3;
+    static constexpr Integer WEDNESDAY = 4;
+    static constexpr Integer THURSDAY = 5;
+    static constexpr Integer FRIDAY = 6;
+    static constexpr Integer SATURDAY = 7;
+
+    virtual ECode GetCalendarDateFromFixedDate(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [in] */ Long fixedDate) = 0;
+
+    virtual ECode GetDayOfWeek(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [out] */ Integer* days) = 0;
+
+    virtual ECode GetDayOfYear(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [out] */ Long* days) = 0;
+
+    virtual ECode GetFixedDate(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [out] */ Long* fraction) = 0;
+
+    virtual ECode GetFixedDate(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer dayOfMonth,
+        /* [in] */ ccm::util::calendar::IBaseCalendarDate* cache,
+        /* [out] */ Long* fraction) = 0;
+
+    virtual ECode GetYearFromFixedDate(
+        /* [in] */ Long fixedDate,
+        /* [out] */ Integer* year) = 0;
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CALENDAR_IBASECALENDAR_H_GEN__
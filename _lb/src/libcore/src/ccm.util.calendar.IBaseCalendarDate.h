@@ -0,0 +1,63 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CALENDAR_IBASECALENDARDATE_H_GEN__
+#define __CCM_UTIL_CALENDAR_IBASECALENDARDATE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+extern const InterfaceID IID_IBaseCalendarDate;
+
+INTERFACE_ID(30757418-7756-453b-9f1f-c88de7ef583c)
+interface IBaseCalendarDate : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IBaseCalendarDate* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IBaseCalendarDate*)object->Probe(IID_IBaseCalendarDate);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IBaseCalendarDate;
+    }
+
+    virtual ECode GetNormalizedYear(
+        /* [out] */ Integer* normalizedYear) = 0;
+
+    virtual ECode SetNormalizedDate(
+        /* [in] */ Integer normalizedYear,
+        /* [in] */ Integer month,
+        /* [in] */ Integer dayOfMonth) = 0;
+
+    virtual ECode SetNormalizedYear(
+        /* [in] */ Integer normalizedYear) = 0;
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CALENDAR_IBASECALENDARDATE_H_GEN__
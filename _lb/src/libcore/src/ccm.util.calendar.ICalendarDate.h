@@ -0,0 +1,201 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CALENDAR_ICALENDARDATE_H_GEN__
+#define __CCM_UTIL_CALENDAR_ICALENDARDATE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+extern const InterfaceID IID_ICalendarDate;
+
+INTERFACE_ID(251aa366-dca8-48c5-b0d7-27a33657ae75)
+interface ICalendarDate : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICalendarDate* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICalendarDate*)object->Probe(IID_ICalendarDate);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICalendarDate;
+    }
+
+    static constexpr Integer FIELD_UNDEFINED = 0x80000000;
+    static constexpr Long TIME_UNDEFINED = 0x8000000000000000ll;
+
+    virtual ECode AddDate(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer dayOfMonth) = 0;
+
+    virtual ECode AddDayOfMonth(
+        /* [in] */ Integer n) = 0;
+
+    virtual ECode AddHours(
+        /* [in] */ Integer n) = 0;
+
+    virtual ECode AddMillis(
+        /* [in] */ Integer n) = 0;
+
+    virtual ECode AddMinutes(
+        /* [in] */ Integer n) = 0;
+
+    virtual ECode AddMonth(
+        /* [in] */ Integer n) = 0;
+
+    virtual ECode AddSeconds(
+        /* [in] */ Integer n) = 0;
+
+    virtual ECode AddTimeOfDay(
+        /* [in] */ Integer hours,
+        /* [in] */ Integer minutes,
+        /* [in] */ Integer seconds,
+        /* [in] */ Integer millis) = 0;
+
+    virtual ECode AddYear(
+        /* [in] */ Integer n) = 0;
+
+    virtual ECode GetDaylightSaving(
+        /* [out] */ Integer* ds) = 0;
+
+    virtual ECode GetDayOfMonth(
+        /* [out] */ Integer* date) = 0;
+
+    virtual ECode GetDayOfWeek(
+        /* [out] */ Integer* date) = 0;
+
+    virtual ECode GetEra(
+        /* [out] */ ccm::util::calendar::IEra** era) = 0;
+
+    virtual ECode GetHours(
+        /* [out] */ Integer* hours) = 0;
+
+    virtual ECode GetMillis(
+        /* [out] */ Integer* millis) = 0;
+
+    virtual ECode GetMinutes(
+        /* [out] */ Integer* minutes) = 0;
+
+    virtual ECode GetMonth(
+        /* [out] */ Integer* month) = 0;
+
+    virtual ECode GetSeconds(
+        /* [out] */ Integer* seconds) = 0;
+
+    virtual ECode GetTimeOfDay(
+        /* [out] */ Long* date) = 0;
+
+    virtual ECode GetYear(
+        /* [out] */ Integer* year) = 0;
+
+    virtual ECode GetZone(
+        /* [out] */ ccm::util::ITimeZone** zone) = 0;
+
+    virtual ECode GetZoneOffset(
+        /* [out] */ Integer* offset) = 0;
+
+    virtual ECode IsDaylightTime(
+        /* [out] */ Boolean* daylightTime) = 0;
+
+    virtual ECode IsLeapYear(
+        /* [out] */ Boolean* leapYear) = 0;
+
+    virtual ECode IsNormalized(
+        /* [out] */ Boolean* normalized) = 0;
+
+    virtual ECode IsSameDate(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [out] */ Boolean* same) = 0;
+
+    virtual ECode IsStandardTime(
+        /* [out] */ Boolean* standardTime) = 0;
+
+    virtual ECode SetDate(
+        /* [in] */ Integer year,
+        /* [in] */ Integer month,
+        /* [in] */ Integer dayOfMonth) = 0;
+
+    virtual ECode SetDaylightSaving(
+        /* [in] */ Integer daylightSaving) = 0;
+
+    virtual ECode SetDayOfMonth(
+        /* [in] */ Integer date) = 0;
+
+    virtual ECode SetDayOfWeek(
+        /* [in] */ Integer dayOfWeek) = 0;
+
+    virtual ECode SetEra(
+        /* [in] */ ccm::util::calendar::IEra* era) = 0;
+
+    virtual ECode SetHours(
+        /* [in] */ Integer hours) = 0;
+
+    virtual ECode SetLeapYear(
+        /* [in] */ Boolean leapYear) = 0;
+
+    virtual ECode SetMillis(
+        /* [in] */ Integer millis) = 0;
+
+    virtual ECode SetMinutes(
+        /* [in] */ Integer minutes) = 0;
+
+    virtual ECode SetMonth(
+        /* [in] */ Integer month) = 0;
+
+    virtual ECode SetNormalized(
+        /* [in] */ Boolean normalized) = 0;
+
+    virtual ECode SetSeconds(
+        /* [in] */ Integer seconds) = 0;
+
+    virtual ECode SetStandardTime(
+        /* [in] */ Boolean standardTime) = 0;
+
+    virtual ECode SetTimeOfDay(
+        /* [in] */ Long fraction) = 0;
+
+    virtual ECode SetTimeOfDay(
+        /* [in] */ Integer hours,
+        /* [in] */ Integer minutes,
+        /* [in] */ Integer seconds,
+        /* [in] */ Integer millis) = 0;
+
+    virtual ECode SetYear(
+        /* [in] */ Integer year) = 0;
+
+    virtual ECode SetZone(
+        /* [in] */ ccm::util::ITimeZone* zoneinfo) = 0;
+
+    virtual ECode SetZoneOffset(
+        /* [in] */ Integer offset) = 0;
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CALENDAR_ICALENDARDATE_H_GEN__
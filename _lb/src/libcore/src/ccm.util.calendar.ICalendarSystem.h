@@ -0,0 +1,126 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CALENDAR_ICALENDARSYSTEM_H_GEN__
+#define __CCM_UTIL_CALENDAR_ICALENDARSYSTEM_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+extern const InterfaceID IID_ICalendarSystem;
+
+INTERFACE_ID(203ce39d-2cb3-45ec-a618-5f674a2494b8)
+interface ICalendarSystem : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICalendarSystem* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICalendarSystem*)object->Probe(IID_ICalendarSystem);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICalendarSystem;
+    }
+
+    virtual ECode GetEra(
+        /* [in] */ const String& eraName,
+        /* [out] */ ccm::util::calendar::IEra** era) = 0;
+
+    virtual ECode GetEras(
+        /* [out, callee] */ Array<ccm::util::calendar::IEra*>* eras) = 0;
+
+    virtual ECode GetCalendarDate(
+        /* [out] */ ccm::util::calendar::ICalendarDate** date) = 0;
+
+    virtual ECode GetCalendarDate(
+        /* [in] */ Long millis,
+        /* [out] */ ccm::util::calendar::ICalendarDate** date) = 0;
+
+    virtual ECode GetCalendarDate(
+        /* [in] */ Long millis,
+        /* [in] */ ccm::util::calendar::ICalendarDate* date) = 0;
+
+    virtual ECode GetCalendarDate(
+        /* [in] */ Long millis,
+        /* [in] */ ccm::util::ITimeZone* zone,
+        /* [out] */ ccm::util::calendar::ICalendarDate** date) = 0;
+
+    virtual ECode GetMonthLength(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [out] */ Integer* days) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetNthDayOfWeek(
+        /* [in] */ Integer nth,
+        /* [in] */ Integer dayOfWeek,
+        /* [in] */ ccm::util::calendar::ICalendarDate* inDate,
+        /* [out] */ ccm::util::calendar::ICalendarDate** outDate) = 0;
+
+    virtual ECode GetTime(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [out] */ Long* time = nullptr) = 0;
+
+    virtual ECode GetWeekLength(
+        /* [out] */ Integer* weeks) = 0;
+
+    virtual ECode GetYearLength(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [out] */ Integer* days) = 0;
+
+    virtual ECode GetYearLengthInMonths(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [out] */ Integer* months) = 0;
+
+    virtual ECode NewCalendarDate(
+        /* [out] */ ccm::util::calendar::ICalendarDate** date) = 0;
+
+    virtual ECode NewCalendarDate(
+        /* [in] */ ccm::util::ITimeZone* zone,
+        /* [out] */ ccm::util::calendar::ICalendarDate** date) = 0;
+
+    virtual ECode Normalize(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [out] */ Boolean* result = nullptr) = 0;
+
+    virtual ECode SetEra(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [in] */ const String& eraName) = 0;
+
+    virtual ECode SetTimeOfDay(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [in] */ Integer timeOfDay) = 0;
+
+    virtual ECode Validate(
+        /* [in] */ ccm::util::calendar::ICalendarDate* date,
+        /* [out] */ Boolean* result) = 0;
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CALENDAR_ICALENDARSYSTEM_H_GEN__
@@ -0,0 +1,76 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CALENDAR_IERA_H_GEN__
+#define __CCM_UTIL_CALENDAR_IERA_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+extern const InterfaceID IID_IEra;
+
+INTERFACE_ID(38c2ed16-4b95-4936-8eab-d418362dd202)
+interface IEra : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IEra* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IEra*)object->Probe(IID_IEra);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IEra;
+    }
+
+    virtual ECode GetAbbreviation(
+        /* [out] */ String* abbr) = 0;
+
+    virtual ECode GetDiaplayAbbreviation(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* abbr) = 0;
+
+    virtual ECode GetDisplayName(
+        /* [in] */ ccm::util::ILocale* locale,
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetName(
+        /* [out] */ String* name) = 0;
+
+    virtual ECode GetSince(
+        /* [in] */ ccm::util::ITimeZone* zone,
+        /* [out] */ Long* time) = 0;
+
+    virtual ECode GetSinceDate(
+        /* [out] */ ccm::util::calendar::ICalendarDate** date) = 0;
+
+    virtual ECode IsLocalTime(
+        /* [out] */ Boolean* result) = 0;
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CALENDAR_IERA_H_GEN__
@@ -0,0 +1,61 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CALENDAR_ILOCALGREGORIANCALENDAR_H_GEN__
+#define __CCM_UTIL_CALENDAR_ILOCALGREGORIANCALENDAR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+extern const InterfaceID IID_ILocalGregorianCalendar;
+
+INTERFACE_ID(56b39c04-1748-42e8-901d-64449245f389)
+interface ILocalGregorianCalendar : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ILocalGregorianCalendar* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ILocalGregorianCalendar*)object->Probe(IID_ILocalGregorianCalendar);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ILocalGregorianCalendar;
+    }
+
+    virtual ECode IsLeapYear(
+        /* [in] */ Integer gregorianYear,
+        /* [out] */ Boolean* leapYear) = 0;
+
+    virtual ECode IsLeapYear(
+        /* [in] */ ccm::util::calendar::IEra* era,
+        /* [in] */ Integer year,
+        /* [out] */ Boolean* leapYear) = 0;
+};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CALENDAR_ILOCALGREGORIANCALENDAR_H_GEN__
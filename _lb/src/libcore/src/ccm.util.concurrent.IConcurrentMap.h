@@ -0,0 +1,73 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CONCURRENT_ICONCURRENTMAP_H_GEN__
+#define __CCM_UTIL_CONCURRENT_ICONCURRENTMAP_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+
+extern const InterfaceID IID_IConcurrentMap;
+
+INTERFACE_ID(5de1af5c-b22b-4789-ae3f-9b3a6d1e578f)
+interface IConcurrentMap : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IConcurrentMap* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IConcurrentMap*)object->Probe(IID_IConcurrentMap);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IConcurrentMap;
+    }
+
+    virtual ECode PutIfAbsent(
+        /* [in] */ ccm::IInterface* key,
+        /* [in] */ ccm::IInterface* value,
+        /* [out] */ ccm::IInterface** prevValue = nullptr) = 0;
+
+    virtual ECode Remove(
+        /* [in] */ ccm::IInterface* key,
+        /* [in] */ ccm::IInterface* value,
+        /* [out] */ Boolean* result = nullptr) = 0;
+
+    virtual ECode Replace(
+        /* [in] */ ccm::IInterface* key,
+        /* [in] */ ccm::IInterface* value,
+        /* [out] */ ccm::IInterface** prevValue = nullptr) = 0;
+
+    virtual ECode Replace(
+        /* [in] */ ccm::IInterface* key,
+        /* [in] */ ccm::IInterface* oldValue,
+        /* [in] */ ccm::IInterface* newValue,
+        /* [out] */ Boolean* result = nullptr) = 0;
+};
+
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CONCURRENT_ICONCURRENTMAP_H_GEN__
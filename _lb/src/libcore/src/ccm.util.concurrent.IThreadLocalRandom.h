@@ -0,0 +1,75 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CONCURRENT_ITHREADLOCALRANDOM_H_GEN__
+#define __CCM_UTIL_CONCURRENT_ITHREADLOCALRANDOM_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+
+extern const InterfaceID IID_IThreadLocalRandom;
+
+INTERFACE_ID(100a074a-b631-4d9f-80a8-f83c67655f5a)
+interface IThreadLocalRandom : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IThreadLocalRandom* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IThreadLocalRandom*)object->Probe(IID_IThreadLocalRandom);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IThreadLocalRandom;
+    }
+
+    virtual ECode NextDouble(
+        /* [in] */ Double bound,
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode NextDouble(
+        /* [in] */ Double origin,
+        /* [in] */ Double bound,
+        /* [out] */ Double* value) = 0;
+
+    virtual ECode NextInteger(
+        /* [in] */ Integer origin,
+        /* [in] */ Integer bound,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode NextLong(
+        /* [in] */ Long bound,
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode NextLong(
+        /* [in] */ Long origin,
+        /* [in] */ Long bound,
+        /* [out] */ Long* value) = 0;
+};
+
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CONCURRENT_ITHREADLOCALRANDOM_H_GEN__
@@ -0,0 +1,77 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CONCURRENT_ATOMIC_IATOMICBOOLEAN_H_GEN__
+#define __CCM_UTIL_CONCURRENT_ATOMIC_IATOMICBOOLEAN_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+namespace atomic {
+
+extern const InterfaceID IID_IAtomicBoolean;
+
+INTERFACE_ID(2251febf-a611-4962-9d23-b6e505a3d4d8)
+interface IAtomicBoolean : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IAtomicBoolean* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IAtomicBoolean*)object->Probe(IID_IAtomicBoolean);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IAtomicBoolean;
+    }
+
+    virtual ECode CompareAndSet(
+        /* [in] */ Boolean expect,
+        /* [in] */ Boolean update,
+        /* [out] */ Boolean* succeeded = nullptr) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Boolean* value) = 0;
+
+    virtual ECode GetAndSet(
+        /* [in] */ Boolean newValue,
+        /* [out] */ Boolean* prevValue) = 0;
+
+    virtual ECode LzaySet(
+        /* [in] */ Boolean value) = 0;
+
+    virtual ECode Set(
+        /* [in] */ Boolean value) = 0;
+
+    virtual ECode WeakCompareAndSet(
+        /* [in] */ Boolean expect,
+        /* [in] */ Boolean update,
+        /* [out] */ Boolean* succeeded = nullptr) = 0;
+};
+
+} // namespace atomic
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CONCURRENT_ATOMIC_IATOMICBOOLEAN_H_GEN__
@@ -0,0 +1,97 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CONCURRENT_ATOMIC_IATOMICINTEGER_H_GEN__
+#define __CCM_UTIL_CONCURRENT_ATOMIC_IATOMICINTEGER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+namespace atomic {
+
+extern const InterfaceID IID_IAtomicInteger;
+
+INTERFACE_ID(5c214cc0-991c-45a8-936b-fe940b668d5e)
+interface IAtomicInteger : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IAtomicInteger* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IAtomicInteger*)object->Probe(IID_IAtomicInteger);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IAtomicInteger;
+    }
+
+    virtual ECode AddAndGet(
+        /* [in] */ Integer delta,
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode CompareAndSet(
+        /* [in] */ Integer expect,
+        /* [in] */ Integer update,
+        /* [out] */ Boolean* succeeded = nullptr) = 0;
+
+    virtual ECode DecrementAndGet(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode GetAndAdd(
+        /* [in] */ Integer delta,
+        /* [out] */ Integer* prevValue) = 0;
+
+    virtual ECode GetAndDecrement(
+        /* [out] */ Integer* prevValue) = 0;
+
+    virtual ECode GetAndIncrement(
+        /* [out] */ Integer* prevValue) = 0;
+
+    virtual ECode GetAndSet(
+        /* [in] */ Integer newValue,
+        /* [out] */ Integer* prevValue) = 0;
+
+    virtual ECode IncrementAndGet(
+        /* [out] */ Integer* value) = 0;
+
+    virtual ECode LzaySet(
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode Set(
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode WeakCompareAndSet(
+        /* [in] */ Integer expect,
+        /* [in] */ Integer update,
+        /* [out] */ Boolean* succeeded = nullptr) = 0;
+};
+
+} // namespace atomic
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CONCURRENT_ATOMIC_IATOMICINTEGER_H_GEN__
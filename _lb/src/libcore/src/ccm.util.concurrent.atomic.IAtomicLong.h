@@ -0,0 +1,97 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_CONCURRENT_ATOMIC_IATOMICLONG_H_GEN__
+#define __CCM_UTIL_CONCURRENT_ATOMIC_IATOMICLONG_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+namespace atomic {
+
+extern const InterfaceID IID_IAtomicLong;
+
+INTERFACE_ID(991e8db3-d281-4acc-926b-ad1b1e3e2688)
+interface IAtomicLong : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IAtomicLong* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IAtomicLong*)object->Probe(IID_IAtomicLong);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IAtomicLong;
+    }
+
+    virtual ECode AddAndGet(
+        /* [in] */ Long delta,
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode CompareAndSet(
+        /* [in] */ Long expect,
+        /* [in] */ Long update,
+        /* [out] */ Boolean* succeeded = nullptr) = 0;
+
+    virtual ECode DecrementAndGet(
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode Get(
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode GetAndAdd(
+        /* [in] */ Long delta,
+        /* [out] */ Long* prevValue) = 0;
+
+    virtual ECode GetAndDecrement(
+        /* [out] */ Long* prevValue) = 0;
+
+    virtual ECode GetAndIncrement(
+        /* [out] */ Long* prevValue) = 0;
+
+    virtual ECode GetAndSet(
+        /* [in] */ Long newValue,
+        /* [out] */ Long* prevValue) = 0;
+
+    virtual ECode IncrementAndGet(
+        /* [out] */ Long* value) = 0;
+
+    virtual ECode LzaySet(
+        /* [in] */ Long value) = 0;
+
+    virtual ECode Set(
+        /* [in] */ Long value) = 0;
+
+    virtual ECode WeakCompareAndSet(
+        /* [in] */ Long expect,
+        /* [in] */ Long update,
+        /* [out] */ Boolean* succeeded = nullptr) = 0;
+};
+
+} // namespace atomic
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_CONCURRENT_ATOMIC_IATOMICLONG_H_GEN__
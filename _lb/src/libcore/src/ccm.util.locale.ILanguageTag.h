@@ -0,0 +1,78 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_LOCALE_ILANGUAGETAG_H_GEN__
+#define __CCM_UTIL_LOCALE_ILANGUAGETAG_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace locale {
+
+extern const InterfaceID IID_ILanguageTag;
+
+INTERFACE_ID(527ad6e7-ef79-4133-8fc1-a38b614827ba)
+interface ILanguageTag : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ILanguageTag* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ILanguageTag*)object->Probe(IID_ILanguageTag);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ILanguageTag;
+    }
+
+    static const String PRIVATEUSE;
+    static const String PRIVUSE_VARIANT_PREFIX;
+    static const String SEP;
+    static const String UNDETERMINED;
+
+    virtual ECode GetExtensions(
+        /* [out] */ ccm::util::IList** extensions) = 0;
+
+    virtual ECode GetExtlangs(
+        /* [out] */ ccm::util::IList** extlangs) = 0;
+
+    virtual ECode GetLanguage(
+        /* [out] */ String* language) = 0;
+
+    virtual ECode GetPrivateuse(
+        /* [out] */ String* privateuse) = 0;
+
+    virtual ECode GetRegion(
+        /* [out] */ String* region) = 0;
+
+    virtual ECode GetScript(
+        /* [out] */ String* script) = 0;
+
+    virtual ECode GetVariants(
+        /* [out] */ ccm::util::IList** variants) = 0;
+};
+
+} // namespace locale
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_LOCALE_ILANGUAGETAG_H_GEN__
@@ -0,0 +1,76 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_REGEX_IMATCHRESULT_H_GEN__
+#define __CCM_UTIL_REGEX_IMATCHRESULT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace regex {
+
+extern const InterfaceID IID_IMatchResult;
+
+INTERFACE_ID(37d33b90-45d9-4b01-88e8-982e7e830c21)
+interface IMatchResult : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMatchResult* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMatchResult*)object->Probe(IID_IMatchResult);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMatchResult;
+    }
+
+    virtual ECode End(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode End(
+        /* [in] */ Integer group,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode Group(
+        /* [out] */ String* subseq) = 0;
+
+    virtual ECode Group(
+        /* [in] */ Integer group,
+        /* [out] */ String* subseq) = 0;
+
+    virtual ECode GroupCount(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode Start(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode Start(
+        /* [in] */ Integer group,
+        /* [out] */ Integer* index) = 0;
+};
+
+} // namespace regex
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_REGEX_IMATCHRESULT_H_GEN__
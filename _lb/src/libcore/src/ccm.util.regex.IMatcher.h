@@ -0,0 +1,158 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_REGEX_IMATCHER_H_GEN__
+#define __CCM_UTIL_REGEX_IMATCHER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace regex {
+
+extern const InterfaceID IID_IMatcher;
+
+INTERFACE_ID(59e2bbf1-fc3a-4525-9eb0-cfa32d7c75c7)
+interface IMatcher : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMatcher* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMatcher*)object->Probe(IID_IMatcher);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMatcher;
+    }
+
+    virtual ECode AppendReplacement(
+        /* [in] */ ccm::core::IStringBuffer* sb,
+        /* [in] */ const String& replacement) = 0;
+
+    virtual ECode AppendTail(
+        /* [in] */ ccm::core::IStringBuffer* sb) = 0;
+
+    virtual ECode End(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode End(
+        /* [in] */ Integer group,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode End(
+        /* [in] */ const String& name,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode Find(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Find(
+        /* [in] */ Integer start,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Group(
+        /* [out] */ String* subseq) = 0;
+
+    virtual ECode Group(
+        /* [in] */ Integer group,
+        /* [out] */ String* subseq) = 0;
+
+    virtual ECode Group(
+        /* [in] */ const String& name,
+        /* [out] */ String* subseq) = 0;
+
+    virtual ECode GroupCount(
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode HasAnchoringBounds(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode HasTransparentBounds(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode HitEnd(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode LookingAt(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Matches(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Pattern(
+        /* [out] */ ccm::util::regex::IPattern** pattern) = 0;
+
+    virtual ECode Region(
+        /* [in] */ Integer start,
+        /* [in] */ Integer end) = 0;
+
+    virtual ECode RegionStart(
+        /* [out] */ Integer* start) = 0;
+
+    virtual ECode RegionEnd(
+        /* [out] */ Integer* end) = 0;
+
+    virtual ECode ReplaceAll(
+        /* [in] */ const String& replacement,
+        /* [out] */ String* str) = 0;
+
+    virtual ECode ReplaceFirst(
+        /* [in] */ const String& replacement,
+        /* [out] */ String* str) = 0;
+
+    virtual ECode RequireEnd(
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Reset() = 0;
+
+    virtual ECode Reset(
+        /* [in] */ ccm::core::ICharSequence* input) = 0;
+
+    virtual ECode Start(
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode Start(
+        /* [in] */ Integer group,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode Start(
+        /* [in] */ const String& name,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode ToMatchResult(
+        /* [out] */ ccm::util::regex::IMatchResult** result) = 0;
+
+    virtual ECode UseAnchoringBounds(
+        /* [in] */ Boolean value) = 0;
+
+    virtual ECode UsePattern(
+        /* [in] */ ccm::util::regex::IPattern* newPattern) = 0;
+
+    virtual ECode UseTransparentBounds(
+        /* [in] */ Boolean value) = 0;
+};
+
+} // namespace regex
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_REGEX_IMATCHER_H_GEN__
@@ -0,0 +1,83 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_UTIL_REGEX_IPATTERN_H_GEN__
+#define __CCM_UTIL_REGEX_IPATTERN_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace util {
+namespace regex {
+
+extern const InterfaceID IID_IPattern;
+
+INTERFACE_ID(89258176-0af5-40ce-80bb-0b661dde40bf)
+interface IPattern : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IPattern* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IPattern*)object->Probe(IID_IPattern);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IPattern;
+    }
+
+    static constexpr Integer UNIX_LINES = 0x1;
+    static constexpr Integer CASE_INSENSITIVE = 0x2;
+    static constexpr Integer COMMENTS = 0x4;
+    static constexpr Integer MULTILINE = 0x8;
+    static constexpr Integer LITERAL = 0x10;
+    static constexpr Integer DOTALL = 0x20;
+    static constexpr Integer UNICODE_CASE = 0x40;
+    static constexpr Integer CANON_EQ = 0x80;
+
+    virtual ECode Flags(
+        /* [out] */ Integer* flags) = 0;
+
+    virtual ECode Matcher(
+        /* [in] */ ccm::core::ICharSequence* input,
+        /* [out] */ ccm::util::regex::IMatcher** matcher) = 0;
+
+    virtual ECode GetPattern(
+        /* [out] */ String* pattStr) = 0;
+
+    virtual ECode Split(
+        /* [in] */ ccm::core::ICharSequence* input,
+        /* [in] */ Integer limit,
+        /* [out, callee] */ Array<String>* strArray) = 0;
+
+    virtual ECode Split(
+        /* [in] */ ccm::core::ICharSequence* input,
+        /* [out, callee] */ Array<String>* strArray) = 0;
+
+    virtual ECode ToString(
+        /* [out] */ String* pattStr) = 0;
+};
+
+} // namespace regex
+} // namespace util
+} // namespace ccm
+
+#endif // __CCM_UTIL_REGEX_IPATTERN_H_GEN__
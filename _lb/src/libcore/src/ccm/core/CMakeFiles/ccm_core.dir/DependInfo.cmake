@@ -0,0 +1,72 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/core/AbstractStringBuilder.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/AbstractStringBuilder.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/AbstractStringBuilder.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/ArrayHolder.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/ArrayHolder.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/ArrayHolder.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CArray.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CArray.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CArray.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CBoolean.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CBoolean.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CBoolean.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CByte.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CByte.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CByte.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CChar.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CChar.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CChar.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CDouble.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CDouble.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CDouble.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CFloat.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CFloat.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CFloat.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CInteger.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CInteger.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CInteger.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CLong.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CLong.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CLong.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CShort.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CShort.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CShort.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CString.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CString.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CString.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CStringBuffer.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CStringBuffer.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CStringBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CStringBuilder.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CStringBuilder.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CStringBuilder.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CSystem.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CSystem.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CSystem.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/Character.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/Character.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/Character.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/ClassLoader.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/ClassLoader.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/ClassLoader.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/CoreUtils.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CoreUtils.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/CoreUtils.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/HardcodedSystemProperties.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/HardcodedSystemProperties.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/HardcodedSystemProperties.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/HexStringParser.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/HexStringParser.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/HexStringParser.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/Math.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/Math.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/Math.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeBacktrace.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeBacktrace.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeBacktrace.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeFaultHandler.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeFaultHandler.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeFaultHandler.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeLockWord.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeLockWord.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeLockWord.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeMapData.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeMapData.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeMapData.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeMonitor.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeMonitor.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeMonitor.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeMonitorPool.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeMonitorPool.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeMonitorPool.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeMutex.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeMutex.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeMutex.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeObject.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeObject.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeObject.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeRuntime.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeRuntime.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeRuntime.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeRuntimeCallbacks.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeRuntimeCallbacks.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeRuntimeCallbacks.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeScopedThreadStateChange.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeScopedThreadStateChange.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeScopedThreadStateChange.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeThread.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeThread.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeThread.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeThreadList.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeThreadList.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeThreadList.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/NativeTimeUtils.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeTimeUtils.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/NativeTimeUtils.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/RealToString.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/RealToString.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/RealToString.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/Runnable.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/Runnable.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/Runnable.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/Runtime.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/Runtime.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/Runtime.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/RuntimeFactory.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/RuntimeFactory.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/RuntimeFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/StackTrace.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StackTrace.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StackTrace.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/StackTraceElement.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StackTraceElement.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StackTraceElement.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/StrictMath.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StrictMath.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StrictMath.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/StringFactory.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StringFactory.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StringFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/StringToReal.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StringToReal.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StringToReal.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/StringUtils.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StringUtils.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/StringUtils.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/SyncObject.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/SyncObject.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/SyncObject.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/System.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/System.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/System.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/Thread.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/Thread.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/Thread.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/ThreadGroup.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/ThreadGroup.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/ThreadGroup.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/ThreadLocal.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/ThreadLocal.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/ThreadLocal.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/cbigint.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/cbigint.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/cbigint.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/core.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/core.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/core.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/init.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/init.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/init.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/core/nativeapi.cpp" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/nativeapi.cpp.o" "gcc" "src/libcore/src/ccm/core/CMakeFiles/ccm_core.dir/nativeapi.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
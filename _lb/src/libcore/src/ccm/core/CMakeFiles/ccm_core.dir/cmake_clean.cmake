@@ -0,0 +1,117 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_core.dir/AbstractStringBuilder.cpp.o"
+  "CMakeFiles/ccm_core.dir/AbstractStringBuilder.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/ArrayHolder.cpp.o"
+  "CMakeFiles/ccm_core.dir/ArrayHolder.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CArray.cpp.o"
+  "CMakeFiles/ccm_core.dir/CArray.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CBoolean.cpp.o"
+  "CMakeFiles/ccm_core.dir/CBoolean.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CByte.cpp.o"
+  "CMakeFiles/ccm_core.dir/CByte.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CChar.cpp.o"
+  "CMakeFiles/ccm_core.dir/CChar.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CDouble.cpp.o"
+  "CMakeFiles/ccm_core.dir/CDouble.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CFloat.cpp.o"
+  "CMakeFiles/ccm_core.dir/CFloat.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CInteger.cpp.o"
+  "CMakeFiles/ccm_core.dir/CInteger.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CLong.cpp.o"
+  "CMakeFiles/ccm_core.dir/CLong.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CShort.cpp.o"
+  "CMakeFiles/ccm_core.dir/CShort.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CString.cpp.o"
+  "CMakeFiles/ccm_core.dir/CString.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CStringBuffer.cpp.o"
+  "CMakeFiles/ccm_core.dir/CStringBuffer.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CStringBuilder.cpp.o"
+  "CMakeFiles/ccm_core.dir/CStringBuilder.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CSystem.cpp.o"
+  "CMakeFiles/ccm_core.dir/CSystem.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/Character.cpp.o"
+  "CMakeFiles/ccm_core.dir/Character.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/ClassLoader.cpp.o"
+  "CMakeFiles/ccm_core.dir/ClassLoader.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/CoreUtils.cpp.o"
+  "CMakeFiles/ccm_core.dir/CoreUtils.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/HardcodedSystemProperties.cpp.o"
+  "CMakeFiles/ccm_core.dir/HardcodedSystemProperties.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/HexStringParser.cpp.o"
+  "CMakeFiles/ccm_core.dir/HexStringParser.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/Math.cpp.o"
+  "CMakeFiles/ccm_core.dir/Math.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeBacktrace.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeBacktrace.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeFaultHandler.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeFaultHandler.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeLockWord.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeLockWord.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeMapData.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeMapData.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeMonitor.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeMonitor.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeMonitorPool.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeMonitorPool.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeMutex.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeMutex.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeObject.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeObject.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeRuntime.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeRuntime.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeRuntimeCallbacks.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeRuntimeCallbacks.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeScopedThreadStateChange.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeScopedThreadStateChange.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeThread.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeThread.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeThreadList.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeThreadList.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/NativeTimeUtils.cpp.o"
+  "CMakeFiles/ccm_core.dir/NativeTimeUtils.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/RealToString.cpp.o"
+  "CMakeFiles/ccm_core.dir/RealToString.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/Runnable.cpp.o"
+  "CMakeFiles/ccm_core.dir/Runnable.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/Runtime.cpp.o"
+  "CMakeFiles/ccm_core.dir/Runtime.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/RuntimeFactory.cpp.o"
+  "CMakeFiles/ccm_core.dir/RuntimeFactory.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/StackTrace.cpp.o"
+  "CMakeFiles/ccm_core.dir/StackTrace.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/StackTraceElement.cpp.o"
+  "CMakeFiles/ccm_core.dir/StackTraceElement.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/StrictMath.cpp.o"
+  "CMakeFiles/ccm_core.dir/StrictMath.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/StringFactory.cpp.o"
+  "CMakeFiles/ccm_core.dir/StringFactory.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/StringToReal.cpp.o"
+  "CMakeFiles/ccm_core.dir/StringToReal.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/StringUtils.cpp.o"
+  "CMakeFiles/ccm_core.dir/StringUtils.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/SyncObject.cpp.o"
+  "CMakeFiles/ccm_core.dir/SyncObject.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/System.cpp.o"
+  "CMakeFiles/ccm_core.dir/System.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/Thread.cpp.o"
+  "CMakeFiles/ccm_core.dir/Thread.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/ThreadGroup.cpp.o"
+  "CMakeFiles/ccm_core.dir/ThreadGroup.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/ThreadLocal.cpp.o"
+  "CMakeFiles/ccm_core.dir/ThreadLocal.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/cbigint.cpp.o"
+  "CMakeFiles/ccm_core.dir/cbigint.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/core.cpp.o"
+  "CMakeFiles/ccm_core.dir/core.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/init.cpp.o"
+  "CMakeFiles/ccm_core.dir/init.cpp.o.d"
+  "CMakeFiles/ccm_core.dir/nativeapi.cpp.o"
+  "CMakeFiles/ccm_core.dir/nativeapi.cpp.o.d"
+  "ccm_core.a"
+  "ccm_core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
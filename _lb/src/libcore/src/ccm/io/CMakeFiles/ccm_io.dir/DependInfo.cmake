@@ -0,0 +1,64 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/io/Bits.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/Bits.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/Bits.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/Buffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/Buffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/Buffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/BufferedWriter.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/BufferedWriter.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/BufferedWriter.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ByteArrayOutputStream.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteArrayOutputStream.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteArrayOutputStream.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ByteBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ByteBufferAsCharBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsCharBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsCharBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ByteBufferAsDoubleBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsDoubleBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsDoubleBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ByteBufferAsFloatBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsFloatBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsFloatBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ByteBufferAsIntegerBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsIntegerBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsIntegerBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ByteBufferAsLongBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsLongBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsLongBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ByteBufferAsShortBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsShortBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferAsShortBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ByteBufferFactory.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferFactory.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteBufferFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ByteOrder.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteOrder.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ByteOrder.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/CharBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/CharBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/CharBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/DeleteOnExitHook.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/DeleteOnExitHook.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/DeleteOnExitHook.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/DirectByteBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/DirectByteBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/DirectByteBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/DoubleBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/DoubleBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/DoubleBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ExpiringCache.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ExpiringCache.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ExpiringCache.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/File.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/File.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/File.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/FileDescriptor.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/FileDescriptor.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/FileDescriptor.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/FileInputStream.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/FileInputStream.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/FileInputStream.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/FileOutputStream.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/FileOutputStream.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/FileOutputStream.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/FileSystem.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/FileSystem.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/FileSystem.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/FloatBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/FloatBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/FloatBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/HeapByteBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapByteBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapByteBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/HeapCharBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapCharBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapCharBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/HeapDoubleBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapDoubleBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapDoubleBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/HeapFloatBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapFloatBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapFloatBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/HeapIntegerBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapIntegerBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapIntegerBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/HeapLongBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapLongBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapLongBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/HeapShortBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapShortBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/HeapShortBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/InputStream.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/InputStream.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/InputStream.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/IntegerBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/IntegerBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/IntegerBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/LongBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/LongBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/LongBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/MappedByteBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/MappedByteBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/MappedByteBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/OutputStream.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/OutputStream.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/OutputStream.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/OutputStreamWriter.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/OutputStreamWriter.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/OutputStreamWriter.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/PrintWriter.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/PrintWriter.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/PrintWriter.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/ShortBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ShortBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/ShortBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/StringCharBuffer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/StringCharBuffer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/StringCharBuffer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/StringWriter.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/StringWriter.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/StringWriter.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/UnixFileSystem.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/UnixFileSystem.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/UnixFileSystem.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/Writer.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/Writer.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/Writer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/canonicalize_md.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/canonicalize_md.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/canonicalize_md.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/io.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/io.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/io.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/io_util_md.cpp" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/io_util_md.cpp.o" "gcc" "src/libcore/src/ccm/io/CMakeFiles/ccm_io.dir/io_util_md.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
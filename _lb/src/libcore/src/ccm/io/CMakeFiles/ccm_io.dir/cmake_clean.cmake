@@ -0,0 +1,101 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_io.dir/Bits.cpp.o"
+  "CMakeFiles/ccm_io.dir/Bits.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/Buffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/Buffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/BufferedWriter.cpp.o"
+  "CMakeFiles/ccm_io.dir/BufferedWriter.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ByteArrayOutputStream.cpp.o"
+  "CMakeFiles/ccm_io.dir/ByteArrayOutputStream.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ByteBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/ByteBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsCharBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsCharBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsDoubleBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsDoubleBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsFloatBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsFloatBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsIntegerBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsIntegerBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsLongBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsLongBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsShortBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/ByteBufferAsShortBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ByteBufferFactory.cpp.o"
+  "CMakeFiles/ccm_io.dir/ByteBufferFactory.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ByteOrder.cpp.o"
+  "CMakeFiles/ccm_io.dir/ByteOrder.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/CharBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/CharBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/DeleteOnExitHook.cpp.o"
+  "CMakeFiles/ccm_io.dir/DeleteOnExitHook.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/DirectByteBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/DirectByteBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/DoubleBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/DoubleBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ExpiringCache.cpp.o"
+  "CMakeFiles/ccm_io.dir/ExpiringCache.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/File.cpp.o"
+  "CMakeFiles/ccm_io.dir/File.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/FileDescriptor.cpp.o"
+  "CMakeFiles/ccm_io.dir/FileDescriptor.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/FileInputStream.cpp.o"
+  "CMakeFiles/ccm_io.dir/FileInputStream.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/FileOutputStream.cpp.o"
+  "CMakeFiles/ccm_io.dir/FileOutputStream.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/FileSystem.cpp.o"
+  "CMakeFiles/ccm_io.dir/FileSystem.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/FloatBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/FloatBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/HeapByteBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/HeapByteBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/HeapCharBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/HeapCharBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/HeapDoubleBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/HeapDoubleBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/HeapFloatBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/HeapFloatBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/HeapIntegerBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/HeapIntegerBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/HeapLongBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/HeapLongBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/HeapShortBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/HeapShortBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/InputStream.cpp.o"
+  "CMakeFiles/ccm_io.dir/InputStream.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/IntegerBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/IntegerBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/LongBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/LongBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/MappedByteBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/MappedByteBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/OutputStream.cpp.o"
+  "CMakeFiles/ccm_io.dir/OutputStream.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/OutputStreamWriter.cpp.o"
+  "CMakeFiles/ccm_io.dir/OutputStreamWriter.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/PrintWriter.cpp.o"
+  "CMakeFiles/ccm_io.dir/PrintWriter.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/ShortBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/ShortBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/StringCharBuffer.cpp.o"
+  "CMakeFiles/ccm_io.dir/StringCharBuffer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/StringWriter.cpp.o"
+  "CMakeFiles/ccm_io.dir/StringWriter.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/UnixFileSystem.cpp.o"
+  "CMakeFiles/ccm_io.dir/UnixFileSystem.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/Writer.cpp.o"
+  "CMakeFiles/ccm_io.dir/Writer.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/canonicalize_md.cpp.o"
+  "CMakeFiles/ccm_io.dir/canonicalize_md.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/io.cpp.o"
+  "CMakeFiles/ccm_io.dir/io.cpp.o.d"
+  "CMakeFiles/ccm_io.dir/io_util_md.cpp.o"
+  "CMakeFiles/ccm_io.dir/io_util_md.cpp.o.d"
+  "ccm_io.a"
+  "ccm_io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_io_ch.dir/FileChannelImpl.cpp.o"
+  "CMakeFiles/ccm_io_ch.dir/FileChannelImpl.cpp.o.d"
+  "ccm_io_ch.a"
+  "ccm_io_ch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_io_ch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
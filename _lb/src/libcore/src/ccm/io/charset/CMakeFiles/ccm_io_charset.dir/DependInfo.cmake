@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/io/charset/Charset.cpp" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/Charset.cpp.o" "gcc" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/Charset.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/charset/CharsetDecoder.cpp" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetDecoder.cpp.o" "gcc" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetDecoder.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/charset/CharsetDecoderICU.cpp" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetDecoderICU.cpp.o" "gcc" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetDecoderICU.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/charset/CharsetEncoder.cpp" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetEncoder.cpp.o" "gcc" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetEncoder.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/charset/CharsetEncoderICU.cpp" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetEncoderICU.cpp.o" "gcc" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetEncoderICU.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/charset/CharsetFactory.cpp" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetFactory.cpp.o" "gcc" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/charset/CharsetICU.cpp" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetICU.cpp.o" "gcc" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CharsetICU.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/charset/CoderResult.cpp" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CoderResult.cpp.o" "gcc" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/CoderResult.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/charset/StandardCharsets.cpp" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/StandardCharsets.cpp.o" "gcc" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/StandardCharsets.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/io/charset/StreamEncoder.cpp" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/StreamEncoder.cpp.o" "gcc" "src/libcore/src/ccm/io/charset/CMakeFiles/ccm_io_charset.dir/StreamEncoder.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
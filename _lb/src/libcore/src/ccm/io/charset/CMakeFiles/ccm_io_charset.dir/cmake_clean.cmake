@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_io_charset.dir/Charset.cpp.o"
+  "CMakeFiles/ccm_io_charset.dir/Charset.cpp.o.d"
+  "CMakeFiles/ccm_io_charset.dir/CharsetDecoder.cpp.o"
+  "CMakeFiles/ccm_io_charset.dir/CharsetDecoder.cpp.o.d"
+  "CMakeFiles/ccm_io_charset.dir/CharsetDecoderICU.cpp.o"
+  "CMakeFiles/ccm_io_charset.dir/CharsetDecoderICU.cpp.o.d"
+  "CMakeFiles/ccm_io_charset.dir/CharsetEncoder.cpp.o"
+  "CMakeFiles/ccm_io_charset.dir/CharsetEncoder.cpp.o.d"
+  "CMakeFiles/ccm_io_charset.dir/CharsetEncoderICU.cpp.o"
+  "CMakeFiles/ccm_io_charset.dir/CharsetEncoderICU.cpp.o.d"
+  "CMakeFiles/ccm_io_charset.dir/CharsetFactory.cpp.o"
+  "CMakeFiles/ccm_io_charset.dir/CharsetFactory.cpp.o.d"
+  "CMakeFiles/ccm_io_charset.dir/CharsetICU.cpp.o"
+  "CMakeFiles/ccm_io_charset.dir/CharsetICU.cpp.o.d"
+  "CMakeFiles/ccm_io_charset.dir/CoderResult.cpp.o"
+  "CMakeFiles/ccm_io_charset.dir/CoderResult.cpp.o.d"
+  "CMakeFiles/ccm_io_charset.dir/StandardCharsets.cpp.o"
+  "CMakeFiles/ccm_io_charset.dir/StandardCharsets.cpp.o.d"
+  "CMakeFiles/ccm_io_charset.dir/StreamEncoder.cpp.o"
+  "CMakeFiles/ccm_io_charset.dir/StreamEncoder.cpp.o.d"
+  "ccm_io_charset.a"
+  "ccm_io_charset.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_io_charset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
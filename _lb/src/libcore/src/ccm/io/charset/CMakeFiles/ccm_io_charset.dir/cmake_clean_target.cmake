@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "ccm_io_charset.a"
+)
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/math/BigDecimal.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BigDecimal.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BigDecimal.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/BigDecimalFactory.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BigDecimalFactory.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BigDecimalFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/BigInt.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BigInt.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BigInt.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/BigInteger.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BigInteger.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BigInteger.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/BigIntegerFactory.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BigIntegerFactory.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BigIntegerFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/BitLevel.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BitLevel.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/BitLevel.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/Conversion.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/Conversion.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/Conversion.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/Division.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/Division.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/Division.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/Logical.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/Logical.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/Logical.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/MathContext.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/MathContext.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/MathContext.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/Multiplication.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/Multiplication.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/Multiplication.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/Primality.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/Primality.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/Primality.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/math/math.cpp" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/math.cpp.o" "gcc" "src/libcore/src/ccm/math/CMakeFiles/ccm_math.dir/math.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_math.dir/BigDecimal.cpp.o"
+  "CMakeFiles/ccm_math.dir/BigDecimal.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/BigDecimalFactory.cpp.o"
+  "CMakeFiles/ccm_math.dir/BigDecimalFactory.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/BigInt.cpp.o"
+  "CMakeFiles/ccm_math.dir/BigInt.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/BigInteger.cpp.o"
+  "CMakeFiles/ccm_math.dir/BigInteger.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/BigIntegerFactory.cpp.o"
+  "CMakeFiles/ccm_math.dir/BigIntegerFactory.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/BitLevel.cpp.o"
+  "CMakeFiles/ccm_math.dir/BitLevel.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/Conversion.cpp.o"
+  "CMakeFiles/ccm_math.dir/Conversion.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/Division.cpp.o"
+  "CMakeFiles/ccm_math.dir/Division.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/Logical.cpp.o"
+  "CMakeFiles/ccm_math.dir/Logical.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/MathContext.cpp.o"
+  "CMakeFiles/ccm_math.dir/MathContext.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/Multiplication.cpp.o"
+  "CMakeFiles/ccm_math.dir/Multiplication.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/Primality.cpp.o"
+  "CMakeFiles/ccm_math.dir/Primality.cpp.o.d"
+  "CMakeFiles/ccm_math.dir/math.cpp.o"
+  "CMakeFiles/ccm_math.dir/math.cpp.o.d"
+  "ccm_math.a"
+  "ccm_math.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_math.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/misc/DoubleConsts.cpp" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/DoubleConsts.cpp.o" "gcc" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/DoubleConsts.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/misc/FDBigInteger.cpp" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/FDBigInteger.cpp.o" "gcc" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/FDBigInteger.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/misc/FloatConsts.cpp" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/FloatConsts.cpp.o" "gcc" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/FloatConsts.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/misc/FloatingDecimal.cpp" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/FloatingDecimal.cpp.o" "gcc" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/FloatingDecimal.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/misc/FormattedFloatingDecimal.cpp" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/FormattedFloatingDecimal.cpp.o" "gcc" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/FormattedFloatingDecimal.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/misc/misc.cpp" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/misc.cpp.o" "gcc" "src/libcore/src/ccm/misc/CMakeFiles/ccm_misc.dir/misc.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_misc.dir/DoubleConsts.cpp.o"
+  "CMakeFiles/ccm_misc.dir/DoubleConsts.cpp.o.d"
+  "CMakeFiles/ccm_misc.dir/FDBigInteger.cpp.o"
+  "CMakeFiles/ccm_misc.dir/FDBigInteger.cpp.o.d"
+  "CMakeFiles/ccm_misc.dir/FloatConsts.cpp.o"
+  "CMakeFiles/ccm_misc.dir/FloatConsts.cpp.o.d"
+  "CMakeFiles/ccm_misc.dir/FloatingDecimal.cpp.o"
+  "CMakeFiles/ccm_misc.dir/FloatingDecimal.cpp.o.d"
+  "CMakeFiles/ccm_misc.dir/FormattedFloatingDecimal.cpp.o"
+  "CMakeFiles/ccm_misc.dir/FormattedFloatingDecimal.cpp.o.d"
+  "CMakeFiles/ccm_misc.dir/misc.cpp.o"
+  "CMakeFiles/ccm_misc.dir/misc.cpp.o.d"
+  "ccm_misc.a"
+  "ccm_misc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/security/AccessController.cpp" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/AccessController.cpp.o" "gcc" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/AccessController.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/security/BasicPermission.cpp" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/BasicPermission.cpp.o" "gcc" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/BasicPermission.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/security/Permission.cpp" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/Permission.cpp.o" "gcc" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/Permission.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/security/PermissionCollection.cpp" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/PermissionCollection.cpp.o" "gcc" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/PermissionCollection.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/security/Permissions.cpp" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/Permissions.cpp.o" "gcc" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/Permissions.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/security/SecureRandom.cpp" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/SecureRandom.cpp.o" "gcc" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/SecureRandom.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/security/action/GetPropertyAction.cpp" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/action/GetPropertyAction.cpp.o" "gcc" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/action/GetPropertyAction.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/security/cca/InstanceFactory.cpp" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/cca/InstanceFactory.cpp.o" "gcc" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/cca/InstanceFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/security/cca/Providers.cpp" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/cca/Providers.cpp.o" "gcc" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/cca/Providers.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/security/security.cpp" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/security.cpp.o" "gcc" "src/libcore/src/ccm/security/CMakeFiles/ccm_security.dir/security.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
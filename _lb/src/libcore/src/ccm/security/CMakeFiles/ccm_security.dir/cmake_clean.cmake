@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_security.dir/AccessController.cpp.o"
+  "CMakeFiles/ccm_security.dir/AccessController.cpp.o.d"
+  "CMakeFiles/ccm_security.dir/BasicPermission.cpp.o"
+  "CMakeFiles/ccm_security.dir/BasicPermission.cpp.o.d"
+  "CMakeFiles/ccm_security.dir/Permission.cpp.o"
+  "CMakeFiles/ccm_security.dir/Permission.cpp.o.d"
+  "CMakeFiles/ccm_security.dir/PermissionCollection.cpp.o"
+  "CMakeFiles/ccm_security.dir/PermissionCollection.cpp.o.d"
+  "CMakeFiles/ccm_security.dir/Permissions.cpp.o"
+  "CMakeFiles/ccm_security.dir/Permissions.cpp.o.d"
+  "CMakeFiles/ccm_security.dir/SecureRandom.cpp.o"
+  "CMakeFiles/ccm_security.dir/SecureRandom.cpp.o.d"
+  "CMakeFiles/ccm_security.dir/action/GetPropertyAction.cpp.o"
+  "CMakeFiles/ccm_security.dir/action/GetPropertyAction.cpp.o.d"
+  "CMakeFiles/ccm_security.dir/cca/InstanceFactory.cpp.o"
+  "CMakeFiles/ccm_security.dir/cca/InstanceFactory.cpp.o.d"
+  "CMakeFiles/ccm_security.dir/cca/Providers.cpp.o"
+  "CMakeFiles/ccm_security.dir/cca/Providers.cpp.o.d"
+  "CMakeFiles/ccm_security.dir/security.cpp.o"
+  "CMakeFiles/ccm_security.dir/security.cpp.o.d"
+  "ccm_security.a"
+  "ccm_security.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_security.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/text/AttributedCharacterIteratorAttribute.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/AttributedCharacterIteratorAttribute.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/AttributedCharacterIteratorAttribute.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/AttributedCharacterIteratorAttributeFactory.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/AttributedCharacterIteratorAttributeFactory.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/AttributedCharacterIteratorAttributeFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/AttributedString.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/AttributedString.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/AttributedString.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/CalendarBuilder.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/CalendarBuilder.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/CalendarBuilder.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/CharacterIteratorFieldDelegate.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/CharacterIteratorFieldDelegate.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/CharacterIteratorFieldDelegate.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/ChoiceFormat.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/ChoiceFormat.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/ChoiceFormat.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/DateFormat.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DateFormat.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DateFormat.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/DateFormatSymbols.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DateFormatSymbols.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DateFormatSymbols.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/DecimalFormat.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DecimalFormat.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DecimalFormat.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/DecimalFormatSymbols.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DecimalFormatSymbols.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DecimalFormatSymbols.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/DontCareFieldPosition.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DontCareFieldPosition.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/DontCareFieldPosition.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/FieldPosition.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/FieldPosition.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/FieldPosition.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/Format.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/Format.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/Format.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/MessageFormat.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/MessageFormat.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/MessageFormat.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/NumberFormat.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/NumberFormat.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/NumberFormat.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/NumberFormatFactory.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/NumberFormatFactory.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/NumberFormatFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/ParsePosition.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/ParsePosition.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/ParsePosition.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/SimpleDateFormat.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/SimpleDateFormat.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/SimpleDateFormat.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/text/text.cpp" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/text.cpp.o" "gcc" "src/libcore/src/ccm/text/CMakeFiles/ccm_text.dir/text.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_text.dir/AttributedCharacterIteratorAttribute.cpp.o"
+  "CMakeFiles/ccm_text.dir/AttributedCharacterIteratorAttribute.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/AttributedCharacterIteratorAttributeFactory.cpp.o"
+  "CMakeFiles/ccm_text.dir/AttributedCharacterIteratorAttributeFactory.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/AttributedString.cpp.o"
+  "CMakeFiles/ccm_text.dir/AttributedString.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/CalendarBuilder.cpp.o"
+  "CMakeFiles/ccm_text.dir/CalendarBuilder.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/CharacterIteratorFieldDelegate.cpp.o"
+  "CMakeFiles/ccm_text.dir/CharacterIteratorFieldDelegate.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/ChoiceFormat.cpp.o"
+  "CMakeFiles/ccm_text.dir/ChoiceFormat.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/DateFormat.cpp.o"
+  "CMakeFiles/ccm_text.dir/DateFormat.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/DateFormatSymbols.cpp.o"
+  "CMakeFiles/ccm_text.dir/DateFormatSymbols.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/DecimalFormat.cpp.o"
+  "CMakeFiles/ccm_text.dir/DecimalFormat.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/DecimalFormatSymbols.cpp.o"
+  "CMakeFiles/ccm_text.dir/DecimalFormatSymbols.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/DontCareFieldPosition.cpp.o"
+  "CMakeFiles/ccm_text.dir/DontCareFieldPosition.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/FieldPosition.cpp.o"
+  "CMakeFiles/ccm_text.dir/FieldPosition.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/Format.cpp.o"
+  "CMakeFiles/ccm_text.dir/Format.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/MessageFormat.cpp.o"
+  "CMakeFiles/ccm_text.dir/MessageFormat.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/NumberFormat.cpp.o"
+  "CMakeFiles/ccm_text.dir/NumberFormat.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/NumberFormatFactory.cpp.o"
+  "CMakeFiles/ccm_text.dir/NumberFormatFactory.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/ParsePosition.cpp.o"
+  "CMakeFiles/ccm_text.dir/ParsePosition.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/SimpleDateFormat.cpp.o"
+  "CMakeFiles/ccm_text.dir/SimpleDateFormat.cpp.o.d"
+  "CMakeFiles/ccm_text.dir/text.cpp.o"
+  "CMakeFiles/ccm_text.dir/text.cpp.o.d"
+  "ccm_text.a"
+  "ccm_text.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_text.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,56 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/util/AbstractCollection.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractCollection.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractCollection.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/AbstractList.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractList.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractList.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/AbstractMap.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractMap.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractMap.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/AbstractQueue.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractQueue.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractQueue.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/AbstractSequentialList.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractSequentialList.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractSequentialList.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/AbstractSet.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractSet.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/AbstractSet.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/ArrayList.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/ArrayList.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/ArrayList.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Arrays.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Arrays.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Arrays.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Calendar.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Calendar.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Calendar.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/CalendarFactory.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/CalendarFactory.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/CalendarFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Collections.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Collections.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Collections.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Currency.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Currency.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Currency.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Date.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Date.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Date.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/EmptyArray.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/EmptyArray.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/EmptyArray.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Formatter.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Formatter.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Formatter.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/GregorianCalendar.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/GregorianCalendar.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/GregorianCalendar.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/HashMap.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/HashMap.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/HashMap.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/HashSet.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/HashSet.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/HashSet.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Hashtable.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Hashtable.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Hashtable.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/JapaneseImperialCalendar.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/JapaneseImperialCalendar.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/JapaneseImperialCalendar.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/LinkedHashMap.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/LinkedHashMap.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/LinkedHashMap.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/LinkedHashSet.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/LinkedHashSet.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/LinkedHashSet.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/LinkedList.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/LinkedList.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/LinkedList.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Locale.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Locale.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Locale.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/LocaleFactory.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/LocaleFactory.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/LocaleFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Properties.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Properties.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Properties.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Random.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Random.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Random.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/SimpleTimeZone.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/SimpleTimeZone.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/SimpleTimeZone.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/StringTokenizer.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/StringTokenizer.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/StringTokenizer.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/TimeZone.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TimeZone.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TimeZone.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/TimeZoneFactory.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TimeZoneFactory.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TimeZoneFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/TimeZoneGetter.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TimeZoneGetter.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TimeZoneGetter.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/TreeMap.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TreeMap.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TreeMap.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/TreeNode.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TreeNode.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TreeNode.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/TreeSet.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TreeSet.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/TreeSet.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/Vector.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Vector.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/Vector.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/XMLUtils.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/XMLUtils.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/XMLUtils.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/util.cpp" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/util.cpp.o" "gcc" "src/libcore/src/ccm/util/CMakeFiles/ccm_util.dir/util.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
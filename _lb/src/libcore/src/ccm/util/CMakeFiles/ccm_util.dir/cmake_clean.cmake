@@ -0,0 +1,85 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_util.dir/AbstractCollection.cpp.o"
+  "CMakeFiles/ccm_util.dir/AbstractCollection.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/AbstractList.cpp.o"
+  "CMakeFiles/ccm_util.dir/AbstractList.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/AbstractMap.cpp.o"
+  "CMakeFiles/ccm_util.dir/AbstractMap.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/AbstractQueue.cpp.o"
+  "CMakeFiles/ccm_util.dir/AbstractQueue.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/AbstractSequentialList.cpp.o"
+  "CMakeFiles/ccm_util.dir/AbstractSequentialList.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/AbstractSet.cpp.o"
+  "CMakeFiles/ccm_util.dir/AbstractSet.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/ArrayList.cpp.o"
+  "CMakeFiles/ccm_util.dir/ArrayList.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Arrays.cpp.o"
+  "CMakeFiles/ccm_util.dir/Arrays.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Calendar.cpp.o"
+  "CMakeFiles/ccm_util.dir/Calendar.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/CalendarFactory.cpp.o"
+  "CMakeFiles/ccm_util.dir/CalendarFactory.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Collections.cpp.o"
+  "CMakeFiles/ccm_util.dir/Collections.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Currency.cpp.o"
+  "CMakeFiles/ccm_util.dir/Currency.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Date.cpp.o"
+  "CMakeFiles/ccm_util.dir/Date.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/EmptyArray.cpp.o"
+  "CMakeFiles/ccm_util.dir/EmptyArray.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Formatter.cpp.o"
+  "CMakeFiles/ccm_util.dir/Formatter.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/GregorianCalendar.cpp.o"
+  "CMakeFiles/ccm_util.dir/GregorianCalendar.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/HashMap.cpp.o"
+  "CMakeFiles/ccm_util.dir/HashMap.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/HashSet.cpp.o"
+  "CMakeFiles/ccm_util.dir/HashSet.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Hashtable.cpp.o"
+  "CMakeFiles/ccm_util.dir/Hashtable.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/JapaneseImperialCalendar.cpp.o"
+  "CMakeFiles/ccm_util.dir/JapaneseImperialCalendar.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/LinkedHashMap.cpp.o"
+  "CMakeFiles/ccm_util.dir/LinkedHashMap.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/LinkedHashSet.cpp.o"
+  "CMakeFiles/ccm_util.dir/LinkedHashSet.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/LinkedList.cpp.o"
+  "CMakeFiles/ccm_util.dir/LinkedList.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Locale.cpp.o"
+  "CMakeFiles/ccm_util.dir/Locale.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/LocaleFactory.cpp.o"
+  "CMakeFiles/ccm_util.dir/LocaleFactory.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Properties.cpp.o"
+  "CMakeFiles/ccm_util.dir/Properties.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Random.cpp.o"
+  "CMakeFiles/ccm_util.dir/Random.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/SimpleTimeZone.cpp.o"
+  "CMakeFiles/ccm_util.dir/SimpleTimeZone.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/StringTokenizer.cpp.o"
+  "CMakeFiles/ccm_util.dir/StringTokenizer.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/TimeZone.cpp.o"
+  "CMakeFiles/ccm_util.dir/TimeZone.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/TimeZoneFactory.cpp.o"
+  "CMakeFiles/ccm_util.dir/TimeZoneFactory.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/TimeZoneGetter.cpp.o"
+  "CMakeFiles/ccm_util.dir/TimeZoneGetter.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/TreeMap.cpp.o"
+  "CMakeFiles/ccm_util.dir/TreeMap.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/TreeNode.cpp.o"
+  "CMakeFiles/ccm_util.dir/TreeNode.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/TreeSet.cpp.o"
+  "CMakeFiles/ccm_util.dir/TreeSet.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/Vector.cpp.o"
+  "CMakeFiles/ccm_util.dir/Vector.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/XMLUtils.cpp.o"
+  "CMakeFiles/ccm_util.dir/XMLUtils.cpp.o.d"
+  "CMakeFiles/ccm_util.dir/util.cpp.o"
+  "CMakeFiles/ccm_util.dir/util.cpp.o.d"
+  "ccm_util.a"
+  "ccm_util.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/util/calendar/AbstractCalendar.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/AbstractCalendar.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/AbstractCalendar.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/calendar/BaseCalendar.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/BaseCalendar.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/BaseCalendar.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/calendar/CalendarDate.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/CalendarDate.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/CalendarDate.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/calendar/CalendarSystem.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/CalendarSystem.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/CalendarSystem.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/calendar/CalendarSystemFactory.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/CalendarSystemFactory.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/CalendarSystemFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/calendar/CalendarUtils.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/CalendarUtils.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/CalendarUtils.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/calendar/Era.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/Era.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/Era.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/calendar/Gregorian.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/Gregorian.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/Gregorian.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/calendar/ImmutableGregorianDate.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/ImmutableGregorianDate.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/ImmutableGregorianDate.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/calendar/JulianCalendar.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/JulianCalendar.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/JulianCalendar.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/calendar/LocalGregorianCalendar.cpp" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/LocalGregorianCalendar.cpp.o" "gcc" "src/libcore/src/ccm/util/calendar/CMakeFiles/ccm_util_calendar.dir/LocalGregorianCalendar.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
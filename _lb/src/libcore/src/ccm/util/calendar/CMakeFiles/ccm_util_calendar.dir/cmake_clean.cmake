@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_util_calendar.dir/AbstractCalendar.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/AbstractCalendar.cpp.o.d"
+  "CMakeFiles/ccm_util_calendar.dir/BaseCalendar.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/BaseCalendar.cpp.o.d"
+  "CMakeFiles/ccm_util_calendar.dir/CalendarDate.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/CalendarDate.cpp.o.d"
+  "CMakeFiles/ccm_util_calendar.dir/CalendarSystem.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/CalendarSystem.cpp.o.d"
+  "CMakeFiles/ccm_util_calendar.dir/CalendarSystemFactory.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/CalendarSystemFactory.cpp.o.d"
+  "CMakeFiles/ccm_util_calendar.dir/CalendarUtils.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/CalendarUtils.cpp.o.d"
+  "CMakeFiles/ccm_util_calendar.dir/Era.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/Era.cpp.o.d"
+  "CMakeFiles/ccm_util_calendar.dir/Gregorian.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/Gregorian.cpp.o.d"
+  "CMakeFiles/ccm_util_calendar.dir/ImmutableGregorianDate.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/ImmutableGregorianDate.cpp.o.d"
+  "CMakeFiles/ccm_util_calendar.dir/JulianCalendar.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/JulianCalendar.cpp.o.d"
+  "CMakeFiles/ccm_util_calendar.dir/LocalGregorianCalendar.cpp.o"
+  "CMakeFiles/ccm_util_calendar.dir/LocalGregorianCalendar.cpp.o.d"
+  "ccm_util_calendar.a"
+  "ccm_util_calendar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_util_calendar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
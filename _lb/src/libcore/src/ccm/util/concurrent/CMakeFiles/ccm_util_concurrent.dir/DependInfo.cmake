@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/util/concurrent/ConcurrentHashMap.cpp" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/ConcurrentHashMap.cpp.o" "gcc" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/ConcurrentHashMap.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/concurrent/ConcurrentLinkedQueue.cpp" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/ConcurrentLinkedQueue.cpp.o" "gcc" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/ConcurrentLinkedQueue.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/concurrent/Helpers.cpp" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/Helpers.cpp.o" "gcc" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/Helpers.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/concurrent/ThreadLocalRandom.cpp" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/ThreadLocalRandom.cpp.o" "gcc" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/ThreadLocalRandom.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/concurrent/atomic/AtomicBoolean.cpp" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicBoolean.cpp.o" "gcc" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicBoolean.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/concurrent/atomic/AtomicInteger.cpp" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicInteger.cpp.o" "gcc" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicInteger.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/concurrent/atomic/AtomicLong.cpp" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicLong.cpp.o" "gcc" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicLong.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/concurrent/locks/LockSupport.cpp" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/locks/LockSupport.cpp.o" "gcc" "src/libcore/src/ccm/util/concurrent/CMakeFiles/ccm_util_concurrent.dir/locks/LockSupport.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
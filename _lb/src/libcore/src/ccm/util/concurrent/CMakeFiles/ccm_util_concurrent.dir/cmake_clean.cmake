@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_util_concurrent.dir/ConcurrentHashMap.cpp.o"
+  "CMakeFiles/ccm_util_concurrent.dir/ConcurrentHashMap.cpp.o.d"
+  "CMakeFiles/ccm_util_concurrent.dir/ConcurrentLinkedQueue.cpp.o"
+  "CMakeFiles/ccm_util_concurrent.dir/ConcurrentLinkedQueue.cpp.o.d"
+  "CMakeFiles/ccm_util_concurrent.dir/Helpers.cpp.o"
+  "CMakeFiles/ccm_util_concurrent.dir/Helpers.cpp.o.d"
+  "CMakeFiles/ccm_util_concurrent.dir/ThreadLocalRandom.cpp.o"
+  "CMakeFiles/ccm_util_concurrent.dir/ThreadLocalRandom.cpp.o.d"
+  "CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicBoolean.cpp.o"
+  "CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicBoolean.cpp.o.d"
+  "CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicInteger.cpp.o"
+  "CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicInteger.cpp.o.d"
+  "CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicLong.cpp.o"
+  "CMakeFiles/ccm_util_concurrent.dir/atomic/AtomicLong.cpp.o.d"
+  "CMakeFiles/ccm_util_concurrent.dir/locks/LockSupport.cpp.o"
+  "CMakeFiles/ccm_util_concurrent.dir/locks/LockSupport.cpp.o.d"
+  "ccm_util_concurrent.a"
+  "ccm_util_concurrent.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_util_concurrent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "ccm_util_concurrent.a"
+)
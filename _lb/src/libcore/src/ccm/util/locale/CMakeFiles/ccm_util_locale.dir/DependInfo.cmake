@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/util/locale/BaseLocale.cpp" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/BaseLocale.cpp.o" "gcc" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/BaseLocale.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/locale/Extension.cpp" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/Extension.cpp.o" "gcc" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/Extension.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/locale/InternalLocaleBuilder.cpp" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/InternalLocaleBuilder.cpp.o" "gcc" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/InternalLocaleBuilder.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/locale/LanguageTag.cpp" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/LanguageTag.cpp.o" "gcc" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/LanguageTag.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/locale/LocaleExtensions.cpp" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/LocaleExtensions.cpp.o" "gcc" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/LocaleExtensions.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/locale/LocaleObjectCache.cpp" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/LocaleObjectCache.cpp.o" "gcc" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/LocaleObjectCache.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/locale/LocaleUtils.cpp" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/LocaleUtils.cpp.o" "gcc" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/LocaleUtils.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/locale/StringTokenIterator.cpp" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/StringTokenIterator.cpp.o" "gcc" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/StringTokenIterator.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/locale/UnicodeLocaleExtension.cpp" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/UnicodeLocaleExtension.cpp.o" "gcc" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/UnicodeLocaleExtension.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/locale/provider/CalendarDataUtility.cpp" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/provider/CalendarDataUtility.cpp.o" "gcc" "src/libcore/src/ccm/util/locale/CMakeFiles/ccm_util_locale.dir/provider/CalendarDataUtility.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_util_locale.dir/BaseLocale.cpp.o"
+  "CMakeFiles/ccm_util_locale.dir/BaseLocale.cpp.o.d"
+  "CMakeFiles/ccm_util_locale.dir/Extension.cpp.o"
+  "CMakeFiles/ccm_util_locale.dir/Extension.cpp.o.d"
+  "CMakeFiles/ccm_util_locale.dir/InternalLocaleBuilder.cpp.o"
+  "CMakeFiles/ccm_util_locale.dir/InternalLocaleBuilder.cpp.o.d"
+  "CMakeFiles/ccm_util_locale.dir/LanguageTag.cpp.o"
+  "CMakeFiles/ccm_util_locale.dir/LanguageTag.cpp.o.d"
+  "CMakeFiles/ccm_util_locale.dir/LocaleExtensions.cpp.o"
+  "CMakeFiles/ccm_util_locale.dir/LocaleExtensions.cpp.o.d"
+  "CMakeFiles/ccm_util_locale.dir/LocaleObjectCache.cpp.o"
+  "CMakeFiles/ccm_util_locale.dir/LocaleObjectCache.cpp.o.d"
+  "CMakeFiles/ccm_util_locale.dir/LocaleUtils.cpp.o"
+  "CMakeFiles/ccm_util_locale.dir/LocaleUtils.cpp.o.d"
+  "CMakeFiles/ccm_util_locale.dir/StringTokenIterator.cpp.o"
+  "CMakeFiles/ccm_util_locale.dir/StringTokenIterator.cpp.o.d"
+  "CMakeFiles/ccm_util_locale.dir/UnicodeLocaleExtension.cpp.o"
+  "CMakeFiles/ccm_util_locale.dir/UnicodeLocaleExtension.cpp.o.d"
+  "CMakeFiles/ccm_util_locale.dir/provider/CalendarDataUtility.cpp.o"
+  "CMakeFiles/ccm_util_locale.dir/provider/CalendarDataUtility.cpp.o.d"
+  "ccm_util_locale.a"
+  "ccm_util_locale.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_util_locale.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
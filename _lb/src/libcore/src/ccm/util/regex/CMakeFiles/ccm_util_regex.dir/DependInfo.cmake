@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccm/util/regex/Matcher.cpp" "src/libcore/src/ccm/util/regex/CMakeFiles/ccm_util_regex.dir/Matcher.cpp.o" "gcc" "src/libcore/src/ccm/util/regex/CMakeFiles/ccm_util_regex.dir/Matcher.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/regex/Pattern.cpp" "src/libcore/src/ccm/util/regex/CMakeFiles/ccm_util_regex.dir/Pattern.cpp.o" "gcc" "src/libcore/src/ccm/util/regex/CMakeFiles/ccm_util_regex.dir/Pattern.cpp.o.d"
+  "/root/repo/src/libcore/src/ccm/util/regex/PatternFactory.cpp" "src/libcore/src/ccm/util/regex/CMakeFiles/ccm_util_regex.dir/PatternFactory.cpp.o" "gcc" "src/libcore/src/ccm/util/regex/CMakeFiles/ccm_util_regex.dir/PatternFactory.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccm_util_regex.dir/Matcher.cpp.o"
+  "CMakeFiles/ccm_util_regex.dir/Matcher.cpp.o.d"
+  "CMakeFiles/ccm_util_regex.dir/Pattern.cpp.o"
+  "CMakeFiles/ccm_util_regex.dir/Pattern.cpp.o.d"
+  "CMakeFiles/ccm_util_regex.dir/PatternFactory.cpp.o"
+  "CMakeFiles/ccm_util_regex.dir/PatternFactory.cpp.o.d"
+  "ccm_util_regex.a"
+  "ccm_util_regex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccm_util_regex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,67 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCMRT_SYSTEM_IBLOCKGUARD_H_GEN__
+#define __CCMRT_SYSTEM_IBLOCKGUARD_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccmrt {
+namespace system {
+
+extern const InterfaceID IID_IBlockGuard;
+
+INTERFACE_ID(eca31f7d-c4f5-4bb4-af3e-c015af278c29)
+interface IBlockGuard : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IBlockGuard* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IBlockGuard*)object->Probe(IID_IBlockGuard);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IBlockGuard;
+    }
+
+    static constexpr Integer DISALLOW_DISK_WRITE = 0x1;
+    static constexpr Integer DISALLOW_DISK_READ = 0x2;
+    static constexpr Integer DISALLOW_NETWORK = 0x4;
+    static constexpr Integer PASS_RESTRICTIONS_VIA_RPC = 0x8;
+    static constexpr Integer PENALTY_LOG = 0x10;
+    static constexpr Integer PENALTY_DIALOG = 0x20;
+    static constexpr Integer PENALTY_DEATH = 0x40;
+
+    virtual ECode GetLaxPolicy(
+        /* [out] */ ccmrt::system::IBlockGuardPolicy** policy) = 0;
+
+    virtual ECode GetThreadPolicy(
+        /* [out] */ ccmrt::system::IBlockGuardPolicy** policy) = 0;
+
+    virtual ECode SetThreadPolicy(
+        /* [in] */ ccmrt::system::IBlockGuardPolicy* policy) = 0;
+};
+
+} // namespace system
+} // namespace ccmrt
+
+#endif // __CCMRT_SYSTEM_IBLOCKGUARD_H_GEN__
@@ -0,0 +1,61 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCMRT_SYSTEM_IBLOCKGUARDPOLICY_H_GEN__
+#define __CCMRT_SYSTEM_IBLOCKGUARDPOLICY_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccmrt {
+namespace system {
+
+extern const InterfaceID IID_IBlockGuardPolicy;
+
+INTERFACE_ID(17faccd7-40f0-43ba-a68a-b127bf175642)
+interface IBlockGuardPolicy : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IBlockGuardPolicy* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IBlockGuardPolicy*)object->Probe(IID_IBlockGuardPolicy);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IBlockGuardPolicy;
+    }
+
+    virtual ECode OnWriteToDisk() = 0;
+
+    virtual ECode OnReadFromDisk() = 0;
+
+    virtual ECode OnNetwork() = 0;
+
+    virtual ECode OnUnbufferedIO() = 0;
+
+    virtual ECode GetPolicyMask(
+        /* [out] */ Integer* mask) = 0;
+};
+
+} // namespace system
+} // namespace ccmrt
+
+#endif // __CCMRT_SYSTEM_IBLOCKGUARDPOLICY_H_GEN__
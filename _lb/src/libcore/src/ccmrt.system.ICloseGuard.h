@@ -0,0 +1,57 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCMRT_SYSTEM_ICLOSEGUARD_H_GEN__
+#define __CCMRT_SYSTEM_ICLOSEGUARD_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccmrt {
+namespace system {
+
+extern const InterfaceID IID_ICloseGuard;
+
+INTERFACE_ID(40008bce-3e40-4fe0-bfc7-fe3be7585246)
+interface ICloseGuard : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICloseGuard* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICloseGuard*)object->Probe(IID_ICloseGuard);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICloseGuard;
+    }
+
+    virtual ECode Close() = 0;
+
+    virtual ECode Open(
+        /* [in] */ const String& closer) = 0;
+
+    virtual ECode WarnIfOpen() = 0;
+};
+
+} // namespace system
+} // namespace ccmrt
+
+#endif // __CCMRT_SYSTEM_ICLOSEGUARD_H_GEN__
@@ -0,0 +1,54 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCMRT_SYSTEM_ICLOSEGUARDREPORTER_H_GEN__
+#define __CCMRT_SYSTEM_ICLOSEGUARDREPORTER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccmrt {
+namespace system {
+
+extern const InterfaceID IID_ICloseGuardReporter;
+
+INTERFACE_ID(c2d11c90-b701-4375-81aa-87a5d7c6d3d8)
+interface ICloseGuardReporter : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICloseGuardReporter* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICloseGuardReporter*)object->Probe(IID_ICloseGuardReporter);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICloseGuardReporter;
+    }
+
+    virtual ECode Report(
+        /* [in] */ const String& message,
+        /* [in] */ ccm::core::IStackTrace* allocationSite) = 0;
+};
+
+} // namespace system
+} // namespace ccmrt
+
+#endif // __CCMRT_SYSTEM_ICLOSEGUARDREPORTER_H_GEN__
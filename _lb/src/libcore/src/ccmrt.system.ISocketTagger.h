@@ -0,0 +1,68 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCMRT_SYSTEM_ISOCKETTAGGER_H_GEN__
+#define __CCMRT_SYSTEM_ISOCKETTAGGER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace ccmrt {
+namespace system {
+
+extern const InterfaceID IID_ISocketTagger;
+
+INTERFACE_ID(bcf86319-3e1c-4c50-93cd-daea5797f296)
+interface ISocketTagger : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISocketTagger* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISocketTagger*)object->Probe(IID_ISocketTagger);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ISocketTagger;
+    }
+
+    virtual ECode Tag(
+        /* [in] */ ccm::io::IFileDescriptor* socketDescriptor) = 0;
+
+    virtual ECode Tag(
+        /* [in] */ ccm::net::IDatagramSocket* socket) = 0;
+
+    virtual ECode Tag(
+        /* [in] */ ccm::net::ISocket* socket) = 0;
+
+    virtual ECode Untag(
+        /* [in] */ ccm::io::IFileDescriptor* socketDescriptor) = 0;
+
+    virtual ECode Untag(
+        /* [in] */ ccm::net::IDatagramSocket* socket) = 0;
+
+    virtual ECode Untag(
+        /* [in] */ ccm::net::ISocket* socket) = 0;
+};
+
+} // namespace system
+} // namespace ccmrt
+
+#endif // __CCMRT_SYSTEM_ISOCKETTAGGER_H_GEN__
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/ccmrt/system/BlockGuard.cpp" "src/libcore/src/ccmrt/system/CMakeFiles/ccmrt_system.dir/BlockGuard.cpp.o" "gcc" "src/libcore/src/ccmrt/system/CMakeFiles/ccmrt_system.dir/BlockGuard.cpp.o.d"
+  "/root/repo/src/libcore/src/ccmrt/system/CPathClassLoader.cpp" "src/libcore/src/ccmrt/system/CMakeFiles/ccmrt_system.dir/CPathClassLoader.cpp.o" "gcc" "src/libcore/src/ccmrt/system/CMakeFiles/ccmrt_system.dir/CPathClassLoader.cpp.o.d"
+  "/root/repo/src/libcore/src/ccmrt/system/CloseGuard.cpp" "src/libcore/src/ccmrt/system/CMakeFiles/ccmrt_system.dir/CloseGuard.cpp.o" "gcc" "src/libcore/src/ccmrt/system/CMakeFiles/ccmrt_system.dir/CloseGuard.cpp.o.d"
+  "/root/repo/src/libcore/src/ccmrt/system/SocketTagger.cpp" "src/libcore/src/ccmrt/system/CMakeFiles/ccmrt_system.dir/SocketTagger.cpp.o" "gcc" "src/libcore/src/ccmrt/system/CMakeFiles/ccmrt_system.dir/SocketTagger.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccmrt_system.dir/BlockGuard.cpp.o"
+  "CMakeFiles/ccmrt_system.dir/BlockGuard.cpp.o.d"
+  "CMakeFiles/ccmrt_system.dir/CPathClassLoader.cpp.o"
+  "CMakeFiles/ccmrt_system.dir/CPathClassLoader.cpp.o.d"
+  "CMakeFiles/ccmrt_system.dir/CloseGuard.cpp.o"
+  "CMakeFiles/ccmrt_system.dir/CloseGuard.cpp.o.d"
+  "CMakeFiles/ccmrt_system.dir/SocketTagger.cpp.o"
+  "CMakeFiles/ccmrt_system.dir/SocketTagger.cpp.o.d"
+  "ccmrt_system.a"
+  "ccmrt_system.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccmrt_system.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,665 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_H_GEN__
+#define __LIBCORE_H_GEN__
+
+#include <ccmtypes.h>
+
+using namespace ccm;
+
+extern const ComponentID CID_libcore;
+
+namespace ccm {
+namespace core {
+
+constexpr Integer E_INTERNAL_ERROR = 0x80010000;
+constexpr Integer E_ASSERTION_ERROR = 0x80010001;
+constexpr Integer E_ILLEGAL_MONITOR_STATE_EXCEPTION = 0x80010100;
+constexpr Integer E_INTERRUPTED_EXCEPTION = 0x80010101;
+constexpr Integer E_NULL_POINTER_EXCEPTION = 0x80010102;
+constexpr Integer E_ILLEGAL_THREAD_STATE_EXCEPTION = 0x80010103;
+constexpr Integer E_STRING_INDEX_OUT_OF_BOUNDS_EXCEPTION = 0x80010104;
+constexpr Integer E_INDEX_OUT_OF_BOUNDS_EXCEPTION = 0x80010105;
+constexpr Integer E_NUMBER_FORMAT_EXCEPTION = 0x80010106;
+constexpr Integer E_ILLEGAL_STATE_EXCEPTION = 0x80010107;
+constexpr Integer E_ARRAY_INDEX_OUT_OF_BOUNDS_EXCEPTION = 0x80010108;
+constexpr Integer E_ARITHMETIC_EXCEPTION = 0x80010109;
+constexpr Integer E_CLASS_CAST_EXCEPTION = 0x8001010a;
+
+enum class ThreadState;
+
+interface IAnnotation;
+interface IAppendable;
+interface IArray;
+interface IArrayHolder;
+interface IAutoCloseable;
+interface IBoolean;
+interface IByte;
+interface IChar;
+interface ICharSequence;
+interface ICloneable;
+interface IComparable;
+interface IDouble;
+interface IFloat;
+interface IInteger;
+interface IIterable;
+interface ILong;
+interface INumber;
+interface IReadable;
+interface IRunnable;
+interface IRuntime;
+interface ISecurityManager;
+interface IShort;
+interface IStackTrace;
+interface IStackTraceElement;
+interface IString;
+interface IStringBuffer;
+interface IStringBuilder;
+interface ISynchronize;
+interface ISystem;
+interface IThread;
+interface IThreadGroup;
+interface IThreadLocal;
+interface ICArrayClassObject;
+interface ICArrayHolderClassObject;
+interface ICThreadClassObject;
+interface ICThreadGroupClassObject;
+interface ICBooleanClassObject;
+interface ICByteClassObject;
+interface ICCharClassObject;
+interface ICDoubleClassObject;
+interface ICFloatClassObject;
+interface ICIntegerClassObject;
+interface ICLongClassObject;
+interface ICShortClassObject;
+interface ICStackTraceClassObject;
+interface ICStackTraceElementClassObject;
+interface ICStringClassObject;
+interface ICStringBufferClassObject;
+interface ICStringBuilderClassObject;
+interface ICRuntimePermissionClassObject;
+
+} // namespace core
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+
+constexpr Integer E_NO_SUCH_ELEMENT_EXCEPTION = 0x80010900;
+constexpr Integer E_CONCURRENT_MODIFICATION_EXCEPTION = 0x80010901;
+constexpr Integer E_FORMATTER_CLOSED_EXCEPTION = 0x80010902;
+constexpr Integer E_MISSING_FORMAT_ARGUMENT_EXCEPTION = 0x80010903;
+constexpr Integer E_ILLEGAL_FORMAT_PRECISION_EXCEPTION = 0x80010904;
+constexpr Integer E_UNKNOWN_FORMAT_CONVERSION_EXCEPTION = 0x80010905;
+constexpr Integer E_ILLEGAL_FORMAT_WIDTH_EXCEPTION = 0x80010906;
+constexpr Integer E_ILLEGAL_FORMAT_CODE_POINT_EXCEPTION = 0x80010907;
+constexpr Integer E_MISSING_FORMAT_WIDTH_EXCEPTION = 0x80010908;
+constexpr Integer E_ILLEGAL_FORMAT_FLAGS_EXCEPTION = 0x80010909;
+constexpr Integer E_FORMAT_FLAGS_CONVERSION_MISMATCH_EXCEPTION = 0x8001090a;
+constexpr Integer E_ILLEGAL_FORMAT_CONVERSION_EXCEPTION = 0x8001090b;
+constexpr Integer E_DUPLICATE_FORMAT_FLAGS_EXCEPTION = 0x8001090c;
+constexpr Integer E_UNKNOWN_FORMAT_FLAGS_EXCEPTION = 0x8001090d;
+constexpr Integer E_MISSING_RESOURCE_EXCEPTION = 0x8001090e;
+constexpr Integer E_ILLFORMED_LOCALE_EXCEPTION = 0x8001090f;
+constexpr Integer E_LOCALE_SYNTAX_EXCEPTION = 0x80010910;
+
+enum class FormatterBigDecimalLayoutForm;
+
+interface IArrayList;
+interface ICalendar;
+interface ICollection;
+interface IComparator;
+interface ICurrency;
+interface IDate;
+interface IDeque;
+interface IDictionary;
+interface IEnumeration;
+interface IFormattable;
+interface IFormatter;
+interface IGregorianCalendar;
+interface IHashtable;
+interface IHashMap;
+interface IHashSet;
+interface IIterator;
+interface IJapaneseImperialCalendar;
+interface ILinkedHashMap;
+interface ILinkedHashSet;
+interface ILinkedList;
+interface IList;
+interface IListIterator;
+interface ILocaleCategory;
+interface ILocaleBuilder;
+interface ILocale;
+interface IMapEntry;
+interface IMap;
+interface INavigableMap;
+interface INavigableSet;
+interface IProperties;
+interface IQueue;
+interface IRandom;
+interface IRandomAccess;
+interface IServiceLoader;
+interface ISet;
+interface ISimpleTimeZone;
+interface ISortedMap;
+interface ISortedSet;
+interface IStringTokenizer;
+interface ITimeZone;
+interface ITimeZoneGetter;
+interface ITreeMap;
+interface ITreeSet;
+interface IVector;
+interface ICArrayListClassObject;
+interface ICDateClassObject;
+interface ICFormatterClassObject;
+interface ICGregorianCalendarClassObject;
+interface ICHashMapClassObject;
+interface ICHashSetClassObject;
+interface ICHashtableClassObject;
+interface ICLinkedHashMapClassObject;
+interface ICLinkedHashSetClassObject;
+interface ICLinkedListClassObject;
+interface ICLocaleClassObject;
+interface ICPropertiesClassObject;
+interface ICPropertyPermissionClassObject;
+interface ICRandomClassObject;
+interface ICSimpleEntryClassObject;
+interface ICSimpleImmutableEntryClassObject;
+interface ICSimpleTimeZoneClassObject;
+interface ICStringTokenizerClassObject;
+interface ICTreeMapClassObject;
+interface ICTreeSetClassObject;
+interface ICVectorClassObject;
+
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace io {
+
+constexpr Integer E_CODER_MALFUNCTION_ERROR = 0x80010200;
+constexpr Integer E_IO_EXCEPTION = 0x80010300;
+constexpr Integer E_IO_SYNC_FAILED_EXCEPTION = 0x80010301;
+constexpr Integer E_FILE_NOT_FOUND_EXCEPTION = 0x80010302;
+constexpr Integer E_USE_MANUAL_SKIP_EXCEPTION = 0x80010303;
+constexpr Integer E_INTERRUPTED_IO_EXCEPTION = 0x80010304;
+constexpr Integer E_UNSUPPORTED_ENCODING_EXCEPTION = 0x80010305;
+constexpr Integer E_INVALID_OBJECT_EXCEPTION = 0x80010306;
+constexpr Integer E_INVALID_MARK_EXCEPTION = 0x80010307;
+constexpr Integer E_BUFFER_UNDERFLOW_EXCEPTION = 0x80010308;
+constexpr Integer E_BUFFER_OVERFLOW_EXCEPTION = 0x80010309;
+constexpr Integer E_READ_ONLY_BUFFER_EXCEPTION = 0x8001030a;
+constexpr Integer E_UNSUPPORTED_CHARSET_EXCEPTION = 0x8001030b;
+constexpr Integer E_ILLEGAL_CHARSET_NAME_EXCEPTION = 0x8001030c;
+constexpr Integer E_MALFORMED_INPUT_EXCEPTION = 0x8001030d;
+constexpr Integer E_UNMAPPABLE_CHARACTER_EXCEPTION = 0x8001030e;
+
+interface IBuffer;
+interface IBufferedWriter;
+interface IByteArrayOutputStream;
+interface IByteBuffer;
+interface IByteOrder;
+interface ICharBuffer;
+interface ICloseable;
+interface IDataInput;
+interface IDoubleBuffer;
+interface IFile;
+interface IFileDescriptor;
+interface IFileFilter;
+interface IFileInputStream;
+interface IFileOutputStream;
+interface IFilenameFilter;
+interface IFloatBuffer;
+interface IFlushable;
+interface IInputStream;
+interface IIntegerBuffer;
+interface IInterruptible;
+interface ILongBuffer;
+interface IMappedByteBuffer;
+interface IObjectInput;
+interface IObjectInputStream;
+interface IOutputStream;
+interface IOutputStreamWriter;
+interface IPrintStream;
+interface IPrintWriter;
+interface IReader;
+interface ISerializable;
+interface IShortBuffer;
+interface IStringWriter;
+interface IWriter;
+interface ICBufferedWriterClassObject;
+interface ICByteArrayOutputStreamClassObject;
+interface ICDirectByteBufferClassObject;
+interface ICFileClassObject;
+interface ICFileDescriptorClassObject;
+interface ICFileInputStreamClassObject;
+interface ICFileOutputStreamClassObject;
+interface ICOutputStreamWriterClassObject;
+interface ICPrintWriterClassObject;
+interface ICStringWriterClassObject;
+
+} // namespace io
+} // namespace ccm
+
+namespace ccm {
+namespace security {
+
+interface IGuard;
+interface IPermission;
+interface IPermissionCollection;
+interface IPrivilegedAction;
+interface IProviderService;
+interface IProvider;
+interface ISecureRandom;
+interface ISecureRandomSpi;
+interface ICSecureRandomClassObject;
+
+} // namespace security
+} // namespace ccm
+
+namespace ccm {
+namespace net {
+
+interface IDatagramPacket;
+interface IDatagramSocket;
+interface IInetAddress;
+interface IInetSocketAddress;
+interface ISocket;
+interface ISocketAddress;
+interface IURI;
+interface IURL;
+
+} // namespace net
+} // namespace ccm
+
+namespace ccm {
+namespace io {
+namespace channels {
+
+interface IDirectBuffer;
+interface IFileChannel;
+
+} // namespace channels
+} // namespace io
+} // namespace ccm
+
+namespace ccm {
+namespace io {
+namespace charset {
+
+interface ICharset;
+interface ICharsetDecoder;
+interface ICharsetEncoder;
+interface ICodingErrorAction;
+interface ICoderResult;
+interface IStreamEncoder;
+
+} // namespace charset
+} // namespace io
+} // namespace ccm
+
+namespace ccm {
+namespace io {
+namespace charset {
+namespace spi {
+
+interface ICharsetProvider;
+
+} // namespace spi
+} // namespace charset
+} // namespace io
+} // namespace ccm
+
+namespace ccm {
+namespace math {
+
+enum class RoundingMode;
+
+interface IBigDecimal;
+interface IBigInteger;
+interface IMathContext;
+interface ICBigDecimalClassObject;
+interface ICBigIntegerClassObject;
+interface ICMathContextClassObject;
+
+} // namespace math
+} // namespace ccm
+
+namespace ccm {
+namespace misc {
+
+enum class FormattedFloatingDecimalForm;
+
+interface IFDBigInteger;
+interface IFloatingDecimalBinaryToASCIIConverter;
+interface IFloatingDecimalASCIIToBinaryConverter;
+interface IFormattedFloatingDecimal;
+interface ICFDBigIntegerClassObject;
+
+} // namespace misc
+} // namespace ccm
+
+namespace ccm {
+namespace security {
+namespace cca {
+
+interface IInstance;
+interface IInstanceFactory;
+interface IProviderList;
+
+} // namespace cca
+} // namespace security
+} // namespace ccm
+
+namespace ccm {
+namespace security {
+namespace action {
+
+interface ICGetPropertyActionClassObject;
+
+} // namespace action
+} // namespace security
+} // namespace ccm
+
+namespace ccm {
+namespace text {
+
+constexpr Integer E_PARSE_EXCEPTION = 0x80010800;
+
+interface IAttributedCharacterIterator;
+interface IAttributedString;
+interface ICharacterIterator;
+interface IChoiceFormat;
+interface IDateFormatField;
+interface IDateFormat;
+interface IDateFormatSymbols;
+interface IDecimalFormat;
+interface IDecimalFormatSymbols;
+interface IFieldPosition;
+interface IFormatField;
+interface IFormatFieldDelegate;
+interface IFormat;
+interface IMessageFormatField;
+interface IMessageFormat;
+interface INumberFormatField;
+interface INumberFormat;
+interface IParsePosition;
+interface ISimpleDateFormat;
+interface ICAttributedStringClassObject;
+interface ICChoiceFormatClassObject;
+interface ICDateFormatSymbolsClassObject;
+interface ICDecimalFormatClassObject;
+interface ICDecimalFormatSymbolsClassObject;
+interface ICFieldPositionClassObject;
+interface ICMessageFormatClassObject;
+interface ICParsePositionClassObject;
+interface ICSimpleDateFormatClassObject;
+
+} // namespace text
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+namespace calendar {
+
+interface IBaseCalendarDate;
+interface IBaseCalendar;
+interface ICalendarDate;
+interface ICalendarSystem;
+interface IEra;
+interface IGregorian;
+interface IJulianCalendar;
+interface ILocalGregorianCalendar;
+interface ICEraClassObject;
+interface ICLocalGregorianCalendarClassObject;
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+
+interface IConcurrentHashMap;
+interface IConcurrentLinkedQueue;
+interface IConcurrentMap;
+interface IThreadLocalRandom;
+interface ICConcurrentLinkedQueueClassObject;
+interface ICConcurrentHashMapClassObject;
+
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+namespace atomic {
+
+interface IAtomicBoolean;
+interface IAtomicInteger;
+interface IAtomicLong;
+interface ICAtomicBooleanClassObject;
+interface ICAtomicIntegerClassObject;
+interface ICAtomicLongClassObject;
+
+} // namespace atomic
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+namespace locale {
+
+interface ILanguageTag;
+
+} // namespace locale
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+namespace regex {
+
+constexpr Integer E_PATTERN_SYNTAX_EXCEPTION = 0x80010a00;
+
+interface IMatcher;
+interface IMatchResult;
+interface IPattern;
+
+} // namespace regex
+} // namespace util
+} // namespace ccm
+
+namespace ccmrt {
+namespace system {
+
+interface IBlockGuardPolicy;
+interface IBlockGuard;
+interface ICloseGuardReporter;
+interface ICloseGuardTracker;
+interface ICloseGuard;
+interface ISocketTagger;
+interface ICPathClassLoaderClassObject;
+
+} // namespace system
+} // namespace ccmrt
+
+namespace libcore {
+namespace icu {
+
+interface IICU;
+interface ILocaleData;
+
+} // namespace icu
+} // namespace libcore
+
+namespace libcore {
+namespace io {
+
+interface IBufferIterator;
+interface IoBridge;
+interface ILibcore;
+interface IMemoryMappedFile;
+interface IOs;
+interface ICMemoryMappedFileClassObject;
+
+} // namespace io
+} // namespace libcore
+
+namespace pisces {
+namespace system {
+
+constexpr Integer E_ERRNO_EXCEPTION = 0x8001e000;
+
+interface IStructAddrinfo;
+interface IStructCapUserData;
+interface IStructCapUserHeader;
+interface IStructFlock;
+interface IStructGroupReq;
+interface IStructGroupSourceReq;
+interface IStructIfaddrs;
+interface IStructLinger;
+interface IStructPasswd;
+interface IStructPollfd;
+interface IStructStat;
+interface IStructStatVfs;
+interface IStructTimeval;
+interface IStructUcred;
+interface IStructUtsname;
+interface ICStructStatClassObject;
+
+} // namespace system
+} // namespace pisces
+
+namespace libcore {
+namespace util {
+
+interface IBasicLruCache;
+interface IZoneInfo;
+interface IZoneInfoWallTime;
+interface IZoneInfoDB;
+interface IZoneInfoDBTzData;
+
+} // namespace util
+} // namespace libcore
+
+namespace pisces {
+namespace icu {
+namespace text {
+
+enum class ITimeZoneNamesNameType;
+
+interface ITimeZoneNames;
+
+} // namespace text
+} // namespace icu
+} // namespace pisces
+
+
+namespace ccm {
+namespace core {
+
+enum class ThreadState
+{
+    NEW,
+    RUNNABLE,
+    BLOCKED,
+    WAITING,
+    TIMED_WAITING,
+    TERMINATED
+};
+
+
+} // namespace core
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+
+enum class FormatterBigDecimalLayoutForm
+{
+    SCIENTIFIC,
+    DECIMAL_FLOAT
+};
+
+
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace math {
+
+enum class RoundingMode
+{
+    UP,
+    DOWN,
+    CEILING,
+    FLOOR,
+    HALF_UP,
+    HALF_DOWN,
+    HALF_EVEN,
+    UNNECESSARY
+};
+
+
+} // namespace math
+} // namespace ccm
+
+namespace ccm {
+namespace misc {
+
+enum class FormattedFloatingDecimalForm
+{
+    SCIENTIFIC,
+    COMPATIBLE,
+    DECIMAL_FLOAT,
+    GENERAL
+};
+
+
+} // namespace misc
+} // namespace ccm
+
+namespace pisces {
+namespace icu {
+namespace text {
+
+enum class ITimeZoneNamesNameType
+{
+    ONG_GENERIC,
+    LONG_STANDARD,
+    LONG_DAYLIGHT,
+    SHORT_GENERIC,
+    SHORT_STANDARD,
+    SHORT_DAYLIGHT,
+    EXEMPLAR_LOCATION
+};
+
+
+} // namespace text
+} // namespace icu
+} // namespace pisces
+
+extern void AddComponentCount();
+extern void ReleaseComponentCount();
+extern ccm::IMetaComponent* GetComponentMetadata();
+extern void SetComponentMetadata(ccm::IMetaComponent* component);
+
+#endif // __LIBCORE_H_GEN__
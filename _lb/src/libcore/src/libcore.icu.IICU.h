@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_ICU_IICU_H_GEN__
+#define __LIBCORE_ICU_IICU_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace icu {
+
+extern const InterfaceID IID_IICU;
+
+INTERFACE_ID(dc68f94d-21c9-4b4c-942d-277a012a5bc9)
+interface IICU : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IICU* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IICU*)object->Probe(IID_IICU);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IICU;
+    }
+
+};
+
+} // namespace icu
+} // namespace libcore
+
+#endif // __LIBCORE_ICU_IICU_H_GEN__
@@ -0,0 +1,154 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_ICU_ILOCALEDATA_H_GEN__
+#define __LIBCORE_ICU_ILOCALEDATA_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace icu {
+
+extern const InterfaceID IID_ILocaleData;
+
+INTERFACE_ID(b3ead832-20d3-43cd-9246-7654f4626ae4)
+interface ILocaleData : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ILocaleData* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ILocaleData*)object->Probe(IID_ILocaleData);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ILocaleData;
+    }
+
+    virtual ECode GetAmPm(
+        /* [out, callee] */ Array<String>* ampm) = 0;
+
+    virtual ECode GetCurrencyPattern(
+        /* [out] */ String* pattern) = 0;
+
+    virtual ECode GetCurrencySymbol(
+        /* [out] */ String* currencySymbol) = 0;
+
+    virtual ECode GetDateFormat(
+        /* [in] */ Integer style,
+        /* [out] */ String* dateFormat) = 0;
+
+    virtual ECode GetDecimalSeparator(
+        /* [out] */ Char* decSeparator) = 0;
+
+    virtual ECode GetEras(
+        /* [out, callee] */ Array<String>* eras) = 0;
+
+    virtual ECode GetExponentSeparator(
+        /* [out] */ String* expSeparator) = 0;
+
+    virtual ECode GetGroupingSeparator(
+        /* [out] */ Char* grpSeparator) = 0;
+
+    virtual ECode GetFirstDayOfWeek(
+        /* [out] */ ccm::core::IInteger** day) = 0;
+
+    virtual ECode GetInfinity(
+        /* [out] */ String* infinity) = 0;
+
+    virtual ECode GetIntegerPattern(
+        /* [out] */ String* pattern) = 0;
+
+    virtual ECode GetInternationalCurrencySymbol(
+        /* [out] */ String* intlCurrencySymbol) = 0;
+
+    virtual ECode GetLongMonthNames(
+        /* [out, callee] */ Array<String>* longMonthNames) = 0;
+
+    virtual ECode GetLongStandAloneMonthNames(
+        /* [out, callee] */ Array<String>* longStandAloneMonthNames) = 0;
+
+    virtual ECode GetLongStandAloneWeekdayNames(
+        /* [out, callee] */ Array<String>* longStandAloneWeekdayNames) = 0;
+
+    virtual ECode GetLongWeekdayNames(
+        /* [out, callee] */ Array<String>* longWeekdayNames) = 0;
+
+    virtual ECode GetMinimalDaysInFirstWeek(
+        /* [out] */ ccm::core::IInteger** days) = 0;
+
+    virtual ECode GetMinusSign(
+        /* [out] */ String* sign) = 0;
+
+    virtual ECode GetNaN(
+        /* [out] */ String* nan) = 0;
+
+    virtual ECode GetNumberPattern(
+        /* [out] */ String* pattern) = 0;
+
+    virtual ECode GetPatternSeparator(
+        /* [out] */ Char* patSeparator) = 0;
+
+    virtual ECode GetPercent(
+        /* [out] */ String* percent) = 0;
+
+    virtual ECode GetPercentPattern(
+        /* [out] */ String* pattern) = 0;
+
+    virtual ECode GetPerMill(
+        /* [out] */ Char* perMill) = 0;
+
+    virtual ECode GetShortMonthNames(
+        /* [out, callee] */ Array<String>* shortMonthNames) = 0;
+
+    virtual ECode GetShortStandAloneMonthNames(
+        /* [out, callee] */ Array<String>* shortStandAloneMonthNames) = 0;
+
+    virtual ECode GetShortStandAloneWeekdayNames(
+        /* [out, callee] */ Array<String>* shortStandAloneWeekdayNames) = 0;
+
+    virtual ECode GetShortWeekdayNames(
+        /* [out, callee] */ Array<String>* shortWeekdayNames) = 0;
+
+    virtual ECode GetTimeFormat(
+        /* [in] */ Integer style,
+        /* [out] */ String* timeFormat) = 0;
+
+    virtual ECode GetTinyMonthNames(
+        /* [out, callee] */ Array<String>* tinyMonthNames) = 0;
+
+    virtual ECode GetTinyStandAloneMonthNames(
+        /* [out, callee] */ Array<String>* tinyStandAloneMonthNames) = 0;
+
+    virtual ECode GetTinyStandAloneWeekdayNames(
+        /* [out, callee] */ Array<String>* tinyStandAloneWeekdayNames) = 0;
+
+    virtual ECode GetTinyWeekdayNames(
+        /* [out, callee] */ Array<String>* tinyWeekdayNames) = 0;
+
+    virtual ECode GetZeroDigit(
+        /* [out] */ Char* zeroDigit) = 0;
+};
+
+} // namespace icu
+} // namespace libcore
+
+#endif // __LIBCORE_ICU_ILOCALEDATA_H_GEN__
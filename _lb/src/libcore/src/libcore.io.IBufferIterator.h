@@ -0,0 +1,78 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_IO_IBUFFERITERATOR_H_GEN__
+#define __LIBCORE_IO_IBUFFERITERATOR_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace io {
+
+extern const InterfaceID IID_IBufferIterator;
+
+INTERFACE_ID(c76aba68-5070-4475-9dea-232106fa27ea)
+interface IBufferIterator : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IBufferIterator* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IBufferIterator*)object->Probe(IID_IBufferIterator);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IBufferIterator;
+    }
+
+    virtual ECode Pos(
+        /* [out] */ Integer* offset) = 0;
+
+    virtual ECode ReadByte(
+        /* [out] */ Byte* result) = 0;
+
+    virtual ECode ReadByteArray(
+        /* [out] */ Array<Byte>& dst,
+        /* [in] */ Integer dstOffset,
+        /* [in] */ Integer byteCount) = 0;
+
+    virtual ECode ReadInteger(
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode ReadIntegerArray(
+        /* [out] */ Array<Integer>& dst,
+        /* [in] */ Integer dstOffset,
+        /* [in] */ Integer intCount) = 0;
+
+    virtual ECode ReadShort(
+        /* [out] */ Short* result) = 0;
+
+    virtual ECode Seek(
+        /* [in] */ Integer offset) = 0;
+
+    virtual ECode Skip(
+        /* [in] */ Integer byteCount) = 0;
+};
+
+} // namespace io
+} // namespace libcore
+
+#endif // __LIBCORE_IO_IBUFFERITERATOR_H_GEN__
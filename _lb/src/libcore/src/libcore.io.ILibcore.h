@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_IO_ILIBCORE_H_GEN__
+#define __LIBCORE_IO_ILIBCORE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace io {
+
+extern const InterfaceID IID_ILibcore;
+
+INTERFACE_ID(f3f6610a-f7dc-40e0-a25d-daa20e1829bf)
+interface ILibcore : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ILibcore* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ILibcore*)object->Probe(IID_ILibcore);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ILibcore;
+    }
+
+    virtual ECode GetRawOs(
+        /* [out] */ libcore::io::IOs** os) = 0;
+
+    virtual ECode GetOs(
+        /* [out] */ libcore::io::IOs** os) = 0;
+};
+
+} // namespace io
+} // namespace libcore
+
+#endif // __LIBCORE_IO_ILIBCORE_H_GEN__
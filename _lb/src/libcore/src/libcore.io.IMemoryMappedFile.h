@@ -0,0 +1,62 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_IO_IMEMORYMAPPEDFILE_H_GEN__
+#define __LIBCORE_IO_IMEMORYMAPPEDFILE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace io {
+
+extern const InterfaceID IID_IMemoryMappedFile;
+
+INTERFACE_ID(c3142383-5fa7-4fe7-a98e-c5e5bf321c58)
+interface IMemoryMappedFile : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IMemoryMappedFile* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IMemoryMappedFile*)object->Probe(IID_IMemoryMappedFile);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IMemoryMappedFile;
+    }
+
+    virtual ECode BigEndianIterator(
+        /* [out] */ libcore::io::IBufferIterator** it) = 0;
+
+    virtual ECode IsClosed(
+        /* [out] */ Boolean* closed) = 0;
+
+    virtual ECode LittleEndianIterator(
+        /* [out] */ libcore::io::IBufferIterator** it) = 0;
+
+    virtual ECode GetSize(
+        /* [out] */ Integer* size) = 0;
+};
+
+} // namespace io
+} // namespace libcore
+
+#endif // __LIBCORE_IO_IMEMORYMAPPEDFILE_H_GEN__
@@ -0,0 +1,687 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_IO_IOS_H_GEN__
+#define __LIBCORE_IO_IOS_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace io {
+
+extern const InterfaceID IID_IOs;
+
+INTERFACE_ID(4ed1247b-e111-490f-88a9-b5caa0f4d4bb)
+interface IOs : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IOs* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IOs*)object->Probe(IID_IOs);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IOs;
+    }
+
+    virtual ECode Accept(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::net::ISocketAddress* peerAddress,
+        /* [out] */ ccm::io::IFileDescriptor** retFd) = 0;
+
+    virtual ECode Access(
+        /* [in] */ const String& path,
+        /* [in] */ Integer mode,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode Bind(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::net::IInetAddress* address,
+        /* [in] */ Integer port) = 0;
+
+    virtual ECode Bind(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::net::ISocketAddress* address) = 0;
+
+    virtual ECode Capget(
+        /* [in] */ pisces::system::IStructCapUserHeader* hdr,
+        /* [out, callee] */ Array<pisces::system::IStructCapUserData*>* data) = 0;
+
+    virtual ECode Capset(
+        /* [in] */ pisces::system::IStructCapUserHeader* hdr,
+        /* [in] */ const Array<pisces::system::IStructCapUserData*>& data) = 0;
+
+    virtual ECode Chmod(
+        /* [in] */ const String& path,
+        /* [in] */ Integer mode) = 0;
+
+    virtual ECode Chown(
+        /* [in] */ const String& path,
+        /* [in] */ Integer uid,
+        /* [in] */ Integer gid) = 0;
+
+    virtual ECode Close(
+        /* [in] */ ccm::io::IFileDescriptor* fd) = 0;
+
+    virtual ECode Connect(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::net::IInetAddress* address,
+        /* [in] */ Integer port) = 0;
+
+    virtual ECode Connect(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::net::ISocketAddress* address) = 0;
+
+    virtual ECode Dup(
+        /* [in] */ ccm::io::IFileDescriptor* oldFd,
+        /* [out] */ ccm::io::IFileDescriptor** retFd) = 0;
+
+    virtual ECode Dup2(
+        /* [in] */ ccm::io::IFileDescriptor* oldFd,
+        /* [in] */ Integer newFd,
+        /* [out] */ ccm::io::IFileDescriptor** retFd) = 0;
+
+    virtual ECode Environ(
+        /* [out, callee] */ Array<String>* env) = 0;
+
+    virtual ECode Execv(
+        /* [in] */ const String& filename,
+        /* [in] */ const Array<String>& argv) = 0;
+
+    virtual ECode Execve(
+        /* [in] */ const String& filename,
+        /* [in] */ const Array<String>& argv,
+        /* [in] */ const Array<String>& envp) = 0;
+
+    virtual ECode Fchmod(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer mode) = 0;
+
+    virtual ECode Fchown(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer uid,
+        /* [in] */ Integer gid) = 0;
+
+    virtual ECode FcntlFlock(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer cmd,
+        /* [in] */ pisces::system::IStructFlock* arg,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode FcntlInt(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer cmd,
+        /* [in] */ Integer arg,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode FcntlVoid(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer cmd,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode Fdatasync(
+        /* [in] */ ccm::io::IFileDescriptor* fd) = 0;
+
+    virtual ECode Fstat(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ pisces::system::IStructStat** stat) = 0;
+
+    virtual ECode Fstatvfs(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ pisces::system::IStructStatVfs** statVfs) = 0;
+
+    virtual ECode Fsync(
+        /* [in] */ ccm::io::IFileDescriptor* fd) = 0;
+
+    virtual ECode Ftruncate(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Long length) = 0;
+
+    virtual ECode Gai_Strerror(
+        /* [in] */ Integer error,
+        /* [out] */ String* strerror) = 0;
+
+    virtual ECode Getegid(
+        /* [out] */ Integer* egid) = 0;
+
+    virtual ECode Geteuid(
+        /* [out] */ Integer* euid) = 0;
+
+    virtual ECode Getgid(
+        /* [out] */ Integer* gid) = 0;
+
+    virtual ECode Getenv(
+        /* [in] */ const String& name,
+        /* [out] */ String* value) = 0;
+
+    virtual ECode Getnameinfo(
+        /* [in] */ ccm::net::IInetAddress* address,
+        /* [in] */ Integer flags,
+        /* [out] */ String* info) = 0;
+
+    virtual ECode Getpeername(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ ccm::net::ISocketAddress** name) = 0;
+
+    virtual ECode Getpgid(
+        /* [in] */ Integer pid,
+        /* [out] */ Integer* pgid) = 0;
+
+    virtual ECode Getpid(
+        /* [out] */ Integer* pid) = 0;
+
+    virtual ECode Getppid(
+        /* [out] */ Integer* ppid) = 0;
+
+    virtual ECode Getpwnam(
+        /* [in] */ const String& name,
+        /* [out] */ pisces::system::IStructPasswd** pwnam) = 0;
+
+    virtual ECode Getpwuid(
+        /* [in] */ Integer uid,
+        /* [out] */ pisces::system::IStructPasswd** pwuid) = 0;
+
+    virtual ECode Getsockname(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ ccm::net::ISocketAddress** socket) = 0;
+
+    virtual ECode GetsockoptByte(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [out] */ Integer* sockopt) = 0;
+
+    virtual ECode GetsockoptInAddr(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [out] */ ccm::net::IInetAddress** addr) = 0;
+
+    virtual ECode GetsockoptInt(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [out] */ Integer* sockopt) = 0;
+
+    virtual ECode GetsockoptLinger(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [out] */ pisces::system::IStructLinger** linger) = 0;
+
+    virtual ECode GetsockoptTimeval(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [out] */ pisces::system::IStructTimeval** timeval) = 0;
+
+    virtual ECode GetsockoptUcred(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [out] */ pisces::system::IStructUcred** ucred) = 0;
+
+    virtual ECode Gettid(
+        /* [out] */ Integer* tid) = 0;
+
+    virtual ECode Getuid(
+        /* [out] */ Integer* uid) = 0;
+
+    virtual ECode Getxattr(
+        /* [in] */ const String& path,
+        /* [in] */ const String& name,
+        /* [out, callee] */ Array<Byte>* attr) = 0;
+
+    virtual ECode Getifaddrs(
+        /* [out, callee] */ Array<pisces::system::IStructIfaddrs*>* addrs) = 0;
+
+    virtual ECode If_indextoname(
+        /* [in] */ Integer index,
+        /* [out] */ String* name) = 0;
+
+    virtual ECode If_nametoindex(
+        /* [in] */ const String& name,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode Inet_pton(
+        /* [in] */ Integer family,
+        /* [in] */ const String& address,
+        /* [out] */ ccm::net::IInetAddress** addr) = 0;
+
+    virtual ECode IoctlInetAddress(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer cmd,
+        /* [in] */ const String& interfaceName,
+        /* [out] */ ccm::net::IInetAddress** addr) = 0;
+
+    virtual ECode IoctlInt(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer cmd,
+        /* [in, out] */ Integer* arg,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode IoctlMTU(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ const String& interfaceName,
+        /* [out] */ Integer* mtu) = 0;
+
+    virtual ECode Isatty(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ Boolean* isatty) = 0;
+
+    virtual ECode Kill(
+        /* [in] */ Integer pid,
+        /* [in] */ Integer signal) = 0;
+
+    virtual ECode Lchown(
+        /* [in] */ const String& path,
+        /* [in] */ Integer uid,
+        /* [in] */ Integer gid) = 0;
+
+    virtual ECode Link(
+        /* [in] */ const String& oldPath,
+        /* [in] */ const String& newPath) = 0;
+
+    virtual ECode Listen(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer backlog) = 0;
+
+    virtual ECode Listxattr(
+        /* [in] */ const String& path,
+        /* [out, callee] */ Array<String>* attr) = 0;
+
+    virtual ECode Lseek(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Long offset,
+        /* [in] */ Integer whence,
+        /* [out] */ Long* result) = 0;
+
+    virtual ECode Lstat(
+        /* [in] */ const String& path,
+        /* [out] */ pisces::system::IStructStat** stat) = 0;
+
+    virtual ECode Mincore(
+        /* [in] */ HANDLE address,
+        /* [in] */ Long byteCount,
+        /* [in] */ const Array<Byte>& vector) = 0;
+
+    virtual ECode Mkdir(
+        /* [in] */ const String& path,
+        /* [in] */ Integer mode) = 0;
+
+    virtual ECode Mkfifo(
+        /* [in] */ const String& path,
+        /* [in] */ Integer mode) = 0;
+
+    virtual ECode Mlock(
+        /* [in] */ HANDLE address,
+        /* [in] */ Long byteCount) = 0;
+
+    virtual ECode Mmap(
+        /* [in] */ HANDLE address,
+        /* [in] */ Long byteCount,
+        /* [in] */ Integer prot,
+        /* [in] */ Integer flags,
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Long offset,
+        /* [out] */ HANDLE* result) = 0;
+
+    virtual ECode Msync(
+        /* [in] */ HANDLE address,
+        /* [in] */ Long byteCount,
+        /* [in] */ Integer flags) = 0;
+
+    virtual ECode Munlock(
+        /* [in] */ HANDLE address,
+        /* [in] */ Long byteCount) = 0;
+
+    virtual ECode Munmap(
+        /* [in] */ HANDLE address,
+        /* [in] */ Long byteCount) = 0;
+
+    virtual ECode Open(
+        /* [in] */ const String& path,
+        /* [in] */ Integer flags,
+        /* [in] */ Integer mode,
+        /* [out] */ ccm::io::IFileDescriptor** fd) = 0;
+
+    virtual ECode Pipe2(
+        /* [in] */ Integer flags,
+        /* [out, callee] */ Array<ccm::io::IFileDescriptor*>* fds) = 0;
+
+    virtual ECode Pisces_Getaddrinfo(
+        /* [in] */ const String& node,
+        /* [in] */ pisces::system::IStructAddrinfo* hints,
+        /* [in] */ Integer netId,
+        /* [out, callee] */ Array<ccm::net::IInetAddress*>* infos) = 0;
+
+    virtual ECode Poll(
+        /* [in] */ const Array<pisces::system::IStructPollfd*>& fds,
+        /* [in] */ Integer timeoutMs,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode Posix_fallocate(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Long offset,
+        /* [in] */ Long length) = 0;
+
+    virtual ECode Prctl(
+        /* [in] */ Integer option,
+        /* [in] */ Long arg2,
+        /* [in] */ Long arg3,
+        /* [in] */ Long arg4,
+        /* [in] */ Long arg5,
+        /* [out] */ Integer* prctl) = 0;
+
+    virtual ECode Pread(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount,
+        /* [in] */ Long offset,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Pread(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::io::IByteBuffer* buffer,
+        /* [in] */ Long offset,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Pwrite(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ const Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount,
+        /* [in] */ Long offset,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Pwrite(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::io::IByteBuffer* buffer,
+        /* [in] */ Long offset,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Read(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Read(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::io::IByteBuffer* buffer,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Readlink(
+        /* [in] */ const String& path,
+        /* [out] */ String* link) = 0;
+
+    virtual ECode Realpath(
+        /* [in] */ const String& path,
+        /* [out] */ String* realpath) = 0;
+
+    virtual ECode Readv(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ Array<ccm::IInterface*>& buffers,
+        /* [out] */ Array<Integer>& offsets,
+        /* [out] */ Array<Integer>& byteCounts,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Recvfrom(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount,
+        /* [in] */ Integer flags,
+        /* [in] */ ccm::net::IInetSocketAddress* srcAddress,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Recvfrom(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::io::IByteBuffer* buffer,
+        /* [in] */ Integer flags,
+        /* [in] */ ccm::net::IInetSocketAddress* srcAddress,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Remove(
+        /* [in] */ const String& path) = 0;
+
+    virtual ECode Removexattr(
+        /* [in] */ const String& path,
+        /* [in] */ const String& name) = 0;
+
+    virtual ECode Rename(
+        /* [in] */ const String& oldPath,
+        /* [in] */ const String& newPath) = 0;
+
+    virtual ECode Sendto(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ const Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount,
+        /* [in] */ Integer flags,
+        /* [in] */ ccm::net::IInetAddress* inetAddress,
+        /* [in] */ Integer port,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode Sendto(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ const Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount,
+        /* [in] */ Integer flags,
+        /* [in] */ ccm::net::ISocketAddress* address,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode Sendto(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::io::IByteBuffer* buffer,
+        /* [in] */ Integer flags,
+        /* [in] */ ccm::net::IInetAddress* inetAddress,
+        /* [in] */ Integer port,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode Sendfile(
+        /* [in] */ ccm::io::IFileDescriptor* outFd,
+        /* [in] */ ccm::io::IFileDescriptor* inFd,
+        /* [in, out] */ Long* inOffset,
+        /* [in] */ Long byteCount,
+        /* [out] */ Long* result) = 0;
+
+    virtual ECode Setegid(
+        /* [in] */ Integer egid) = 0;
+
+    virtual ECode Setenv(
+        /* [in] */ const String& name,
+        /* [in] */ const String& value,
+        /* [in] */ Boolean overwrite) = 0;
+
+    virtual ECode Seteuid(
+        /* [in] */ Integer euid) = 0;
+
+    virtual ECode Setgid(
+        /* [in] */ Integer gid) = 0;
+
+    virtual ECode Setpgid(
+        /* [in] */ Integer pid,
+        /* [in] */ Integer pgid) = 0;
+
+    virtual ECode Setregid(
+        /* [in] */ Integer rgid,
+        /* [in] */ Integer egid) = 0;
+
+    virtual ECode Setreuid(
+        /* [in] */ Integer ruid,
+        /* [in] */ Integer euid) = 0;
+
+    virtual ECode Setsid(
+        /* [out] */ Integer* sid) = 0;
+
+    virtual ECode SetsockoptByte(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode SetsockoptIfreq(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [in] */ const String& value) = 0;
+
+    virtual ECode SetsockoptInt(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode SetsockoptIpMreqn(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [in] */ Integer value) = 0;
+
+    virtual ECode SetsockoptGroupReq(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [in] */ pisces::system::IStructGroupReq* value) = 0;
+
+    virtual ECode SetsockoptGroupSourceReq(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [in] */ pisces::system::IStructGroupSourceReq* value) = 0;
+
+    virtual ECode SetsockoptLinger(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [in] */ pisces::system::IStructLinger* value) = 0;
+
+    virtual ECode SetsockoptTimeval(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer level,
+        /* [in] */ Integer option,
+        /* [in] */ pisces::system::IStructTimeval* value) = 0;
+
+    virtual ECode Setuid(
+        /* [in] */ Integer uid) = 0;
+
+    virtual ECode Setxattr(
+        /* [in] */ const String& path,
+        /* [in] */ const String& name,
+        /* [in] */ const Array<Byte>& value,
+        /* [in] */ Integer flags) = 0;
+
+    virtual ECode Shutdown(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer how) = 0;
+
+    virtual ECode Socket(
+        /* [in] */ Integer socketDomain,
+        /* [in] */ Integer type,
+        /* [in] */ Integer protocol,
+        /* [out] */ ccm::io::IFileDescriptor** fd) = 0;
+
+    virtual ECode Socketpair(
+        /* [in] */ Integer socketDomain,
+        /* [in] */ Integer type,
+        /* [in] */ Integer protocol,
+        /* [in] */ ccm::io::IFileDescriptor* fd1,
+        /* [in] */ ccm::io::IFileDescriptor* fd2) = 0;
+
+    virtual ECode Stat(
+        /* [in] */ const String& path,
+        /* [out] */ pisces::system::IStructStat** stat) = 0;
+
+    virtual ECode StatVfs(
+        /* [in] */ const String& path,
+        /* [out] */ pisces::system::IStructStatVfs** statfs) = 0;
+
+    virtual ECode Strerror(
+        /* [in] */ Integer errnum,
+        /* [out] */ String* strerr) = 0;
+
+    virtual ECode Strsignal(
+        /* [in] */ Integer signal,
+        /* [out] */ String* strSignal) = 0;
+
+    virtual ECode Symlink(
+        /* [in] */ const String& oldPath,
+        /* [in] */ const String& newPath) = 0;
+
+    virtual ECode Sysconf(
+        /* [in] */ Integer name,
+        /* [out] */ Long* result) = 0;
+
+    virtual ECode Tcdrain(
+        /* [in] */ ccm::io::IFileDescriptor* fd) = 0;
+
+    virtual ECode Tcsendbreak(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer duration) = 0;
+
+    virtual ECode Umask(
+        /* [in] */ Integer mask,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode Uname(
+        /* [out] */ pisces::system::IStructUtsname** uname) = 0;
+
+    virtual ECode Unlink(
+        /* [in] */ const String& pathname) = 0;
+
+    virtual ECode Unsetenv(
+        /* [in] */ const String& name) = 0;
+
+    virtual ECode Waitpid(
+        /* [in] */ Integer pid,
+        /* [in, out] */ Integer* status,
+        /* [in] */ Integer options,
+        /* [out] */ Integer* result) = 0;
+
+    virtual ECode Write(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ const Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Write(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::io::IByteBuffer* buffer,
+        /* [out] */ Integer* num) = 0;
+
+    virtual ECode Writev(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ const Array<ccm::IInterface*>& buffers,
+        /* [in] */ const Array<Integer>& offsets,
+        /* [in] */ const Array<Integer>& byteCounts,
+        /* [out] */ Integer* result) = 0;
+};
+
+} // namespace io
+} // namespace libcore
+
+#endif // __LIBCORE_IO_IOS_H_GEN__
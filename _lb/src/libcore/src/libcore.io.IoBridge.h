@@ -0,0 +1,162 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_IO_IOBRIDGE_H_GEN__
+#define __LIBCORE_IO_IOBRIDGE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace io {
+
+extern const InterfaceID IID_IoBridge;
+
+INTERFACE_ID(e20a68e0-d3fa-4415-ba77-b6e663f1ac8c)
+interface IoBridge : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IoBridge* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IoBridge*)object->Probe(IID_IoBridge);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IoBridge;
+    }
+
+    virtual ECode Available(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode Bind(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::net::IInetAddress* address,
+        /* [in] */ Integer port) = 0;
+
+    virtual ECode Connect(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::net::IInetAddress* inetAddress,
+        /* [in] */ Integer port) = 0;
+
+    virtual ECode Connect(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::net::IInetAddress* inetAddress,
+        /* [in] */ Integer port,
+        /* [in] */ Integer timeoutMs) = 0;
+
+    virtual ECode CloseAndSignalBlockedThreads(
+        /* [in] */ ccm::io::IFileDescriptor* fd) = 0;
+
+    virtual ECode IsConnected(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::net::IInetAddress* inetAddress,
+        /* [in] */ Integer port,
+        /* [in] */ Integer timeoutMs,
+        /* [in] */ Integer remainingTimeoutMs,
+        /* [out] */ Boolean connected) = 0;
+
+    virtual ECode GetLocalInetSocketAddress(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ ccm::net::IInetSocketAddress** socket) = 0;
+
+    virtual ECode GetSocketOption(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer option,
+        /* [out] */ ccm::IInterface** socket) = 0;
+
+    virtual ECode Open(
+        /* [in] */ const String& path,
+        /* [in] */ Integer flags,
+        /* [out] */ ccm::io::IFileDescriptor** fd) = 0;
+
+    virtual ECode Poll(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer events,
+        /* [in] */ Integer timeout) = 0;
+
+    virtual ECode Read(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount,
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode Recvfrom(
+        /* [in] */ Boolean isRead,
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [out] */ Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount,
+        /* [in] */ Integer flags,
+        /* [in] */ ccm::net::IDatagramPacket* packet,
+        /* [in] */ Boolean isConnected,
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode Recvfrom(
+        /* [in] */ Boolean isRead,
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::io::IByteBuffer* buffer,
+        /* [in] */ Integer flags,
+        /* [in] */ ccm::net::IDatagramPacket* packet,
+        /* [in] */ Boolean isConnected,
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode Sendto(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ const Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount,
+        /* [in] */ Integer flags,
+        /* [in] */ ccm::net::IInetAddress* inetAddress,
+        /* [in] */ Integer port,
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode Sendto(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ ccm::io::IByteBuffer* buffer,
+        /* [in] */ Integer flags,
+        /* [in] */ ccm::net::IInetAddress* inetAddress,
+        /* [in] */ Integer port,
+        /* [out] */ Integer* number) = 0;
+
+    virtual ECode SetSocketOption(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ Integer option,
+        /* [in] */ ccm::IInterface* value) = 0;
+
+    virtual ECode Socket(
+        /* [in] */ Integer domain,
+        /* [in] */ Integer type,
+        /* [in] */ Integer protocol,
+        /* [out] */ ccm::io::IFileDescriptor** fd) = 0;
+
+    virtual ECode Write(
+        /* [in] */ ccm::io::IFileDescriptor* fd,
+        /* [in] */ const Array<Byte>& bytes,
+        /* [in] */ Integer byteOffset,
+        /* [in] */ Integer byteCount) = 0;
+};
+
+} // namespace io
+} // namespace libcore
+
+#endif // __LIBCORE_IO_IOBRIDGE_H_GEN__
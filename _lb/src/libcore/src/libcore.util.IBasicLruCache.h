@@ -0,0 +1,64 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_UTIL_IBASICLRUCACHE_H_GEN__
+#define __LIBCORE_UTIL_IBASICLRUCACHE_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace util {
+
+extern const InterfaceID IID_IBasicLruCache;
+
+INTERFACE_ID(d37e56e3-e7c2-43f8-bbc1-aefb351ba869)
+interface IBasicLruCache : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IBasicLruCache* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IBasicLruCache*)object->Probe(IID_IBasicLruCache);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IBasicLruCache;
+    }
+
+    virtual ECode EvictAll() = 0;
+
+    virtual ECode Get(
+        /* [in] */ ccm::IInterface* key,
+        /* [out] */ ccm::IInterface** value) = 0;
+
+    virtual ECode Put(
+        /* [in] */ ccm::IInterface* key,
+        /* [in] */ ccm::IInterface* value,
+        /* [out] */ ccm::IInterface** prevValue = nullptr) = 0;
+
+    virtual ECode Snapshot(
+        /* [out] */ ccm::util::IMap** snapshot) = 0;
+};
+
+} // namespace util
+} // namespace libcore
+
+#endif // __LIBCORE_UTIL_IBASICLRUCACHE_H_GEN__
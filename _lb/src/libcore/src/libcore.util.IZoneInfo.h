@@ -0,0 +1,59 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_UTIL_IZONEINFO_H_GEN__
+#define __LIBCORE_UTIL_IZONEINFO_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace util {
+
+extern const InterfaceID IID_IZoneInfo;
+
+INTERFACE_ID(b06cc99d-8828-4e83-bb05-3ab04ac4b77b)
+interface IZoneInfo : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IZoneInfo* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IZoneInfo*)object->Probe(IID_IZoneInfo);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IZoneInfo;
+    }
+
+    virtual ECode FindTransitionIndex(
+        /* [in] */ Long seconds,
+        /* [out] */ Integer* index) = 0;
+
+    virtual ECode GetOffsetsByUtcTime(
+        /* [in] */ Long utcTimeInMillis,
+        /* [out] */ Array<Integer>& offsets,
+        /* [out] */ Integer* total = nullptr) = 0;
+};
+
+} // namespace util
+} // namespace libcore
+
+#endif // __LIBCORE_UTIL_IZONEINFO_H_GEN__
@@ -0,0 +1,52 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_UTIL_IZONEINFODB_H_GEN__
+#define __LIBCORE_UTIL_IZONEINFODB_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace util {
+
+extern const InterfaceID IID_IZoneInfoDB;
+
+INTERFACE_ID(c2f5daa8-9f22-480b-8c63-fb9e79b7719b)
+interface IZoneInfoDB : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IZoneInfoDB* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IZoneInfoDB*)object->Probe(IID_IZoneInfoDB);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IZoneInfoDB;
+    }
+
+    static const String TZDATA_FILE;
+};
+
+} // namespace util
+} // namespace libcore
+
+#endif // __LIBCORE_UTIL_IZONEINFODB_H_GEN__
@@ -0,0 +1,79 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_UTIL_IZONEINFODBTZDATA_H_GEN__
+#define __LIBCORE_UTIL_IZONEINFODBTZDATA_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace util {
+
+extern const InterfaceID IID_IZoneInfoDBTzData;
+
+INTERFACE_ID(0ab77469-0ac6-4ced-bbc2-2c7eb0478a0e)
+interface IZoneInfoDBTzData : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IZoneInfoDBTzData* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IZoneInfoDBTzData*)object->Probe(IID_IZoneInfoDBTzData);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IZoneInfoDBTzData;
+    }
+
+    virtual ECode Close() = 0;
+
+    virtual ECode GetAvailableIDs(
+        /* [out, callee] */ Array<String>* ids) = 0;
+
+    virtual ECode GetAvailableIDs(
+        /* [in] */ Integer rawUtcOffset,
+        /* [out, callee] */ Array<String>* ids) = 0;
+
+    virtual ECode GetBufferIterator(
+        /* [in] */ const String& id,
+        /* [out] */ libcore::io::IBufferIterator** it) = 0;
+
+    virtual ECode GetVersion(
+        /* [out] */ String* ver) = 0;
+
+    virtual ECode GetZoneTab(
+        /* [out] */ String* zoneTab) = 0;
+
+    virtual ECode HasTimeZone(
+        /* [in] */ const String& id,
+        /* [out] */ Boolean* result) = 0;
+
+    virtual ECode MakeTimeZone(
+        /* [in] */ const String& id,
+        /* [out] */ libcore::util::IZoneInfo** zone) = 0;
+
+    virtual ECode Validate() = 0;
+};
+
+} // namespace util
+} // namespace libcore
+
+#endif // __LIBCORE_UTIL_IZONEINFODBTZDATA_H_GEN__
@@ -0,0 +1,118 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __LIBCORE_UTIL_IZONEINFOWALLTIME_H_GEN__
+#define __LIBCORE_UTIL_IZONEINFOWALLTIME_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace libcore {
+namespace util {
+
+extern const InterfaceID IID_IZoneInfoWallTime;
+
+INTERFACE_ID(0b21624c-3400-44e0-84bc-d44dea940c9b)
+interface IZoneInfoWallTime : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IZoneInfoWallTime* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IZoneInfoWallTime*)object->Probe(IID_IZoneInfoWallTime);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IZoneInfoWallTime;
+    }
+
+    virtual ECode GetGmtOffset(
+        /* [out] */ Integer* gmtoff) = 0;
+
+    virtual ECode GetHour(
+        /* [out] */ Integer* hour) = 0;
+
+    virtual ECode GetIsDst(
+        /* [out] */ Integer* isDst) = 0;
+
+    virtual ECode GetMinute(
+        /* [out] */ Integer* minute) = 0;
+
+    virtual ECode GetMonth(
+        /* [out] */ Integer* month) = 0;
+
+    virtual ECode GetMonthDay(
+        /* [out] */ Integer* monthDay) = 0;
+
+    virtual ECode GetSecond(
+        /* [out] */ Integer* second) = 0;
+
+    virtual ECode GetWeekDay(
+        /* [out] */ Integer* weekDay) = 0;
+
+    virtual ECode GetYear(
+        /* [out] */ Integer* year) = 0;
+
+    virtual ECode GetYearDay(
+        /* [out] */ Integer* yearDay) = 0;
+
+    virtual ECode Localtime(
+        /* [in] */ Integer timeSeconds,
+        /* [in] */ libcore::util::IZoneInfo* zoneInfo) = 0;
+
+    virtual ECode Mktime(
+        /* [in] */ libcore::util::IZoneInfo* zoneInfo,
+        /* [out] */ Integer* time) = 0;
+
+    virtual ECode SetGmtOffset(
+        /* [in] */ Integer gmtoff) = 0;
+
+    virtual ECode SetHour(
+        /* [in] */ Integer hour) = 0;
+
+    virtual ECode SetIsDst(
+        /* [in] */ Integer isDst) = 0;
+
+    virtual ECode SetMinute(
+        /* [in] */ Integer minute) = 0;
+
+    virtual ECode SetMonth(
+        /* [in] */ Integer month) = 0;
+
+    virtual ECode SetMonthDay(
+        /* [in] */ Integer monthDay) = 0;
+
+    virtual ECode SetSecond(
+        /* [in] */ Integer second) = 0;
+
+    virtual ECode SetWeekDay(
+        /* [in] */ Integer weekDay) = 0;
+
+    virtual ECode SetYear(
+        /* [in] */ Integer year) = 0;
+
+    virtual ECode SetYearDay(
+        /* [in] */ Integer yearDay) = 0;
+};
+
+} // namespace util
+} // namespace libcore
+
+#endif // __LIBCORE_UTIL_IZONEINFOWALLTIME_H_GEN__
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/libcore/icu/ICU.cpp" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/ICU.cpp.o" "gcc" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/ICU.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/icu/LocaleData.cpp" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/LocaleData.cpp.o" "gcc" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/LocaleData.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/icu/NativeConverter.cpp" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/NativeConverter.cpp.o" "gcc" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/NativeConverter.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/icu/NativeDecimalFormat.cpp" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/NativeDecimalFormat.cpp.o" "gcc" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/NativeDecimalFormat.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/icu/TimeZoneNames.cpp" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/TimeZoneNames.cpp.o" "gcc" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/TimeZoneNames.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/icu/UStringEnumeration.cpp" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/UStringEnumeration.cpp.o" "gcc" "src/libcore/src/libcore/icu/CMakeFiles/libcore_icu.dir/UStringEnumeration.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
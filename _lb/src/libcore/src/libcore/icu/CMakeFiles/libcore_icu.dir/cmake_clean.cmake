@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libcore_icu.dir/ICU.cpp.o"
+  "CMakeFiles/libcore_icu.dir/ICU.cpp.o.d"
+  "CMakeFiles/libcore_icu.dir/LocaleData.cpp.o"
+  "CMakeFiles/libcore_icu.dir/LocaleData.cpp.o.d"
+  "CMakeFiles/libcore_icu.dir/NativeConverter.cpp.o"
+  "CMakeFiles/libcore_icu.dir/NativeConverter.cpp.o.d"
+  "CMakeFiles/libcore_icu.dir/NativeDecimalFormat.cpp.o"
+  "CMakeFiles/libcore_icu.dir/NativeDecimalFormat.cpp.o.d"
+  "CMakeFiles/libcore_icu.dir/TimeZoneNames.cpp.o"
+  "CMakeFiles/libcore_icu.dir/TimeZoneNames.cpp.o.d"
+  "CMakeFiles/libcore_icu.dir/UStringEnumeration.cpp.o"
+  "CMakeFiles/libcore_icu.dir/UStringEnumeration.cpp.o.d"
+  "libcore_icu.a"
+  "libcore_icu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libcore_icu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/libcore/io/AsynchronousCloseMonitor.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/AsynchronousCloseMonitor.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/AsynchronousCloseMonitor.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/BlockGuardOs.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/BlockGuardOs.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/BlockGuardOs.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/CLibcore.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/CLibcore.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/CLibcore.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/ForwardingOs.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/ForwardingOs.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/ForwardingOs.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/IoBridge.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/IoBridge.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/IoBridge.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/IoTracker.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/IoTracker.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/IoTracker.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/IoUtils.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/IoUtils.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/IoUtils.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/Libcore.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/Libcore.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/Libcore.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/Linux.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/Linux.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/Linux.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/Memory.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/Memory.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/Memory.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/MemoryMappedFile.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/MemoryMappedFile.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/MemoryMappedFile.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/NioBufferIterator.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/NioBufferIterator.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/NioBufferIterator.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/io/io.cpp" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/io.cpp.o" "gcc" "src/libcore/src/libcore/io/CMakeFiles/libcore_io.dir/io.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
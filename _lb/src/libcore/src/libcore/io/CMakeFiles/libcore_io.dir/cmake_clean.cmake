@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libcore_io.dir/AsynchronousCloseMonitor.cpp.o"
+  "CMakeFiles/libcore_io.dir/AsynchronousCloseMonitor.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/BlockGuardOs.cpp.o"
+  "CMakeFiles/libcore_io.dir/BlockGuardOs.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/CLibcore.cpp.o"
+  "CMakeFiles/libcore_io.dir/CLibcore.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/ForwardingOs.cpp.o"
+  "CMakeFiles/libcore_io.dir/ForwardingOs.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/IoBridge.cpp.o"
+  "CMakeFiles/libcore_io.dir/IoBridge.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/IoTracker.cpp.o"
+  "CMakeFiles/libcore_io.dir/IoTracker.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/IoUtils.cpp.o"
+  "CMakeFiles/libcore_io.dir/IoUtils.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/Libcore.cpp.o"
+  "CMakeFiles/libcore_io.dir/Libcore.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/Linux.cpp.o"
+  "CMakeFiles/libcore_io.dir/Linux.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/Memory.cpp.o"
+  "CMakeFiles/libcore_io.dir/Memory.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/MemoryMappedFile.cpp.o"
+  "CMakeFiles/libcore_io.dir/MemoryMappedFile.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/NioBufferIterator.cpp.o"
+  "CMakeFiles/libcore_io.dir/NioBufferIterator.cpp.o.d"
+  "CMakeFiles/libcore_io.dir/io.cpp.o"
+  "CMakeFiles/libcore_io.dir/io.cpp.o.d"
+  "libcore_io.a"
+  "libcore_io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libcore_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
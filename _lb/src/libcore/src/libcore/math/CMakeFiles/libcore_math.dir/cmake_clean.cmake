@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libcore_math.dir/MathUtils.cpp.o"
+  "CMakeFiles/libcore_math.dir/MathUtils.cpp.o.d"
+  "libcore_math.a"
+  "libcore_math.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libcore_math.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
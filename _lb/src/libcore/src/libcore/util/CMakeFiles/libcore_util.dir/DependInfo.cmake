@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libcore/src/libcore/util/BasicLruCache.cpp" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/BasicLruCache.cpp.o" "gcc" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/BasicLruCache.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/util/CharsetUtils.cpp" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/CharsetUtils.cpp.o" "gcc" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/CharsetUtils.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/util/TimeZoneDataFiles.cpp" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/TimeZoneDataFiles.cpp.o" "gcc" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/TimeZoneDataFiles.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/util/ZoneInfo.cpp" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/ZoneInfo.cpp.o" "gcc" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/ZoneInfo.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/util/ZoneInfoDB.cpp" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/ZoneInfoDB.cpp.o" "gcc" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/ZoneInfoDB.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/util/ZoneInfoDBFactory.cpp" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/ZoneInfoDBFactory.cpp.o" "gcc" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/ZoneInfoDBFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/util/ZoneInfoFactory.cpp" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/ZoneInfoFactory.cpp.o" "gcc" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/ZoneInfoFactory.cpp.o.d"
+  "/root/repo/src/libcore/src/libcore/util/util.cpp" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/util.cpp.o" "gcc" "src/libcore/src/libcore/util/CMakeFiles/libcore_util.dir/util.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
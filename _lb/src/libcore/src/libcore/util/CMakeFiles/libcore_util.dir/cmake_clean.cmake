@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libcore_util.dir/BasicLruCache.cpp.o"
+  "CMakeFiles/libcore_util.dir/BasicLruCache.cpp.o.d"
+  "CMakeFiles/libcore_util.dir/CharsetUtils.cpp.o"
+  "CMakeFiles/libcore_util.dir/CharsetUtils.cpp.o.d"
+  "CMakeFiles/libcore_util.dir/TimeZoneDataFiles.cpp.o"
+  "CMakeFiles/libcore_util.dir/TimeZoneDataFiles.cpp.o.d"
+  "CMakeFiles/libcore_util.dir/ZoneInfo.cpp.o"
+  "CMakeFiles/libcore_util.dir/ZoneInfo.cpp.o.d"
+  "CMakeFiles/libcore_util.dir/ZoneInfoDB.cpp.o"
+  "CMakeFiles/libcore_util.dir/ZoneInfoDB.cpp.o.d"
+  "CMakeFiles/libcore_util.dir/ZoneInfoDBFactory.cpp.o"
+  "CMakeFiles/libcore_util.dir/ZoneInfoDBFactory.cpp.o.d"
+  "CMakeFiles/libcore_util.dir/ZoneInfoFactory.cpp.o"
+  "CMakeFiles/libcore_util.dir/ZoneInfoFactory.cpp.o.d"
+  "CMakeFiles/libcore_util.dir/util.cpp.o"
+  "CMakeFiles/libcore_util.dir/util.cpp.o.d"
+  "libcore_util.a"
+  "libcore_util.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libcore_util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,1773 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "ccm.core.IDouble.h"
+#include "ccm.core.IFloat.h"
+#include "ccm.text.IAttributedCharacterIterator.h"
+#include "ccm.util.locale.ILanguageTag.h"
+#include "libcore.util.IZoneInfoDB.h"
+#include "libcore.h"
+#include <ccmcomponent.h>
+#include <ccmrefbase.h>
+
+#include <atomic>
+
+using namespace ccm;
+
+extern const ComponentID CID_libcore =
+        {{0x3657416d,0x4638,0x4843,0xa0b9,{0xe,0xb,0x7,0xe,0xf,0x1,0x7,0x9,0x4,0x4,0x9,0x5}},
+        "http://ccm.org/component/library/libcore.so"};
+
+namespace ccm {
+namespace core {
+
+
+const Double IDouble::POSITIVE_INFINITY = 1.0d / 0.0d;
+const Double IDouble::NEGATIVE_INFINITY = -1.0d / 0.0d;
+const Double IDouble::NaN = 0.0d / 0.0d;
+const Float IFloat::POSITIVE_INFINITY = 1.0f / 0.0f;
+const Float IFloat::NEGATIVE_INFINITY = -1.0f / 0.0f;
+const Float IFloat::NaN = 0.0f / 0.0f;
+
+extern const InterfaceID IID_IAnnotation =
+        {{0xd9b99d63,0x23d3,0x4c79,0x85bd,{0x2,0x8,0x2,0x8,0xa,0x6,0x3,0x3,0xa,0xe,0x7,0x4}}, &CID_libcore};
+extern const InterfaceID IID_IAppendable =
+        {{0x46d6e833,0xcb8a,0x4b12,0x9e3c,{0xb,0xf,0xc,0x2,0x5,0xb,0xf,0x7,0xc,0x8,0xf,0x7}}, &CID_libcore};
+extern const InterfaceID IID_IArray =
+        {{0x0a5ffe64,0xd284,0x4772,0x852c,{0x9,0x6,0x2,0xc,0xe,0xe,0x7,0xa,0x9,0x6,0x0,0x4}}, &CID_libcore};
+extern const InterfaceID IID_IArrayHolder =
+        {{0x9549d2b9,0x6356,0x42fa,0x92bd,{0x5,0xd,0x8,0xe,0xa,0x6,0x5,0x7,0xe,0x5,0xe,0x6}}, &CID_libcore};
+extern const InterfaceID IID_IAutoCloseable =
+        {{0x8aa5bea0,0x252a,0x454a,0x8089,{0x9,0x4,0xa,0xa,0x5,0x3,0x4,0x7,0x8,0x5,0xb,0xc}}, &CID_libcore};
+extern const InterfaceID IID_IBoolean =
+        {{0x0092917c,0xba7e,0x4c8b,0x9212,{0xe,0x9,0x4,0x5,0x6,0xf,0xa,0xe,0xd,0x2,0xd,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IByte =
+        {{0xaff422d9,0xb895,0x444e,0x9c5c,{0x6,0x8,0x8,0x8,0x9,0x3,0xd,0xa,0x1,0x4,0xd,0x4}}, &CID_libcore};
+extern const InterfaceID IID_IChar =
+        {{0x6fa00f5d,0x080c,0x422d,0xa1ac,{0x4,0xf,0x0,0x5,0x1,0xb,0xe,0x6,0xe,0x1,0xf,0x7}}, &CID_libcore};
+extern const InterfaceID IID_ICharSequence =
+        {{0x21107670,0xc69c,0x4bab,0xb7a2,{0x4,0x7,0x6,0x4,0x6,0x9,0x2,0x7,0x1,0x7,0x8,0x6}}, &CID_libcore};
+extern const InterfaceID IID_ICloneable =
+        {{0x5ff88e9d,0xb164,0x4ac5,0xb923,{0x1,0x9,0x4,0xb,0xa,0x8,0xd,0xe,0x7,0xd,0x3,0xb}}, &CID_libcore};
+extern const InterfaceID IID_IComparable =
+        {{0x0a64e9a5,0x54ac,0x4cbd,0xa638,{0x4,0x5,0x2,0xe,0xe,0x2,0xd,0x1,0x3,0x4,0xb,0xd}}, &CID_libcore};
+extern const InterfaceID IID_IDouble =
+        {{0x6aeffb3e,0xf757,0x44b6,0xa71f,{0x2,0xd,0xd,0xc,0x6,0x0,0x7,0xf,0x1,0x1,0xc,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IFloat =
+        {{0xb39e1aff,0x9fc5,0x45b2,0x850b,{0xa,0x0,0xc,0x0,0x7,0x0,0x1,0x6,0x7,0x9,0x1,0x6}}, &CID_libcore};
+extern const InterfaceID IID_IInteger =
+        {{0x2108de07,0x543c,0x4cc5,0x9a59,{0xd,0x2,0x5,0x1,0x2,0x1,0xb,0x4,0x5,0x6,0x8,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IIterable =
+        {{0xdd6c303a,0x21c3,0x487f,0xb431,{0x9,0x0,0x6,0xb,0x2,0x8,0x6,0xf,0x0,0x0,0xf,0x5}}, &CID_libcore};
+extern const InterfaceID IID_ILong =
+        {{0xb0acf41b,0xe045,0x461e,0x88a4,{0x6,0x4,0xc,0x1,0x4,0x8,0x6,0xa,0xc,0x7,0x8,0xa}}, &CID_libcore};
+extern const InterfaceID IID_INumber =
+        {{0x0098d083,0xe425,0x45a0,0xb842,{0x2,0xf,0x7,0x6,0x8,0x6,0x9,0xf,0x7,0xc,0x7,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IReadable =
+        {{0x8cfda583,0xfcd6,0x4532,0x9674,{0xe,0x2,0xe,0xc,0xd,0x5,0x3,0x6,0xa,0x1,0x7,0xa}}, &CID_libcore};
+extern const InterfaceID IID_IRunnable =
+        {{0xc6c344d7,0x4fb3,0x4221,0x852e,{0x4,0x8,0x3,0x5,0x6,0xc,0x6,0xb,0xf,0x7,0x8,0xd}}, &CID_libcore};
+extern const InterfaceID IID_IRuntime =
+        {{0x22b24f1e,0x45ec,0x4669,0x86c8,{0xa,0x7,0x5,0xc,0xd,0x6,0xa,0xf,0x7,0xe,0x2,0xa}}, &CID_libcore};
+extern const InterfaceID IID_ISecurityManager =
+        {{0xa8d886cf,0xa4f1,0x4733,0xb5ff,{0xa,0x6,0x7,0x0,0x7,0x8,0x9,0xb,0x9,0xc,0x2,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IShort =
+        {{0x5490fcf3,0xa943,0x4aef,0xb290,{0xc,0xe,0xd,0x2,0x9,0x3,0x7,0xa,0xf,0x5,0x6,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IStackTrace =
+        {{0xb03ae37d,0x1d06,0x4a25,0x8d44,{0x9,0x7,0x9,0x0,0xd,0x2,0x9,0x2,0xc,0x9,0xb,0xf}}, &CID_libcore};
+extern const InterfaceID IID_IStackTraceElement =
+        {{0x96e68b21,0x4a8c,0x4f7b,0xb0db,{0xa,0xc,0x5,0x4,0xe,0x3,0xe,0xa,0xa,0x2,0x6,0x7}}, &CID_libcore};
+extern const InterfaceID IID_IString =
+        {{0xd676d0a0,0x4708,0x49b6,0x9b97,{0xa,0x0,0xa,0x6,0xb,0xe,0x4,0x2,0x2,0x3,0xc,0xd}}, &CID_libcore};
+extern const InterfaceID IID_IStringBuffer =
+        {{0x6491e4b7,0x83a3,0x4218,0x828d,{0x5,0x2,0x9,0xe,0x1,0xf,0x8,0x0,0x2,0x6,0x4,0xf}}, &CID_libcore};
+extern const InterfaceID IID_IStringBuilder =
+        {{0x29904f3a,0x9219,0x4613,0xb6b2,{0x1,0xf,0xc,0x4,0x2,0xa,0xc,0x7,0x5,0xe,0xb,0x9}}, &CID_libcore};
+extern const InterfaceID IID_ISynchronize =
+        {{0x7ddf21a8,0x3891,0x484e,0xa23b,{0x2,0xa,0xd,0x9,0xc,0xe,0xd,0xa,0xb,0xf,0x1,0x7}}, &CID_libcore};
+extern const InterfaceID IID_ISystem =
+        {{0xd71de27f,0x2b2d,0x4df3,0xb57f,{0xf,0x2,0x0,0xd,0x1,0x6,0x9,0xe,0x8,0x3,0x6,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IThread =
+        {{0xfb0ec407,0xbaa3,0x47ed,0x9a3f,{0xf,0xe,0x6,0x6,0x6,0xe,0xe,0x9,0xf,0xc,0xa,0x0}}, &CID_libcore};
+extern const InterfaceID IID_IThreadGroup =
+        {{0xb25cfd17,0x1013,0x406e,0xb0cd,{0x7,0x4,0xb,0xe,0x7,0x6,0x3,0x7,0x5,0x7,0x1,0xc}}, &CID_libcore};
+extern const InterfaceID IID_IThreadLocal =
+        {{0x8d3b5361,0x18be,0x40a4,0x8a8d,{0x7,0xd,0xe,0xd,0x4,0xa,0xc,0x1,0x8,0x2,0x4,0xf}}, &CID_libcore};
+extern const InterfaceID IID_ICArrayClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICArrayHolderClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICThreadClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICThreadGroupClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICBooleanClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICByteClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICCharClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICDoubleClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICFloatClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICIntegerClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICLongClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICShortClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICStackTraceClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICStackTraceElementClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICStringClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICStringBufferClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICStringBuilderClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICRuntimePermissionClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CArray =
+        {{0xbc5be123,0x34ab,0x4373,0xab98,{0x3,0x1,0xc,0x3,0xe,0x3,0xc,0x6,0x8,0xb,0x1,0xb}}, &CID_libcore};
+extern const CoclassID CID_CArrayHolder =
+        {{0xf608b0cd,0xd0af,0x4adb,0xa2a4,{0x6,0xf,0x2,0x4,0x1,0x1,0x3,0x6,0xb,0x9,0x9,0x2}}, &CID_libcore};
+extern const CoclassID CID_CSystem =
+        {{0x6cdec0e6,0xee66,0x4ba3,0xb167,{0xe,0x8,0xd,0x4,0x5,0xe,0x0,0x2,0x9,0xf,0xb,0xd}}, &CID_libcore};
+extern const CoclassID CID_CThread =
+        {{0x339a8069,0x7448,0x4d12,0x9c50,{0xd,0x4,0x5,0x4,0x9,0x7,0xf,0xb,0x2,0x4,0x5,0xb}}, &CID_libcore};
+extern const CoclassID CID_CThreadGroup =
+        {{0x730c7375,0x05c3,0x4b86,0x933c,{0xa,0xb,0x2,0x8,0x0,0x8,0x1,0x6,0x4,0x2,0x8,0x0}}, &CID_libcore};
+extern const CoclassID CID_CThreadLocal =
+        {{0xdce1a0c3,0xb23d,0x4b89,0xbdaf,{0x8,0xa,0x1,0xb,0xf,0x5,0x8,0x1,0xe,0xe,0x4,0x4}}, &CID_libcore};
+extern const CoclassID CID_CBoolean =
+        {{0xdf471c09,0x381f,0x40c4,0x9e24,{0xc,0x9,0x2,0xb,0x3,0x1,0xd,0xd,0x9,0x1,0x4,0x6}}, &CID_libcore};
+extern const CoclassID CID_CByte =
+        {{0xbdf665c0,0x8a7a,0x4621,0xba55,{0xe,0x6,0xa,0x0,0x9,0x7,0xd,0xf,0xc,0x8,0x5,0xd}}, &CID_libcore};
+extern const CoclassID CID_CChar =
+        {{0xf30fd610,0xee65,0x4fc0,0x8191,{0xe,0x8,0x4,0x0,0xc,0x7,0xf,0x7,0x3,0x1,0x2,0x5}}, &CID_libcore};
+extern const CoclassID CID_CDouble =
+        {{0x38abe6d2,0x1428,0x4a97,0x8177,{0xb,0x2,0x4,0xd,0x0,0x9,0x5,0x9,0x3,0xd,0x1,0x5}}, &CID_libcore};
+extern const CoclassID CID_CFloat =
+        {{0x569b10e8,0x38d5,0x41f6,0xa89a,{0x3,0x6,0xf,0xc,0xd,0xe,0x4,0x4,0x9,0x4,0x1,0x3}}, &CID_libcore};
+extern const CoclassID CID_CInteger =
+        {{0x55469170,0xd13e,0x4567,0x9435,{0x3,0xb,0xf,0x4,0xc,0x5,0xe,0xb,0xf,0x1,0xe,0x4}}, &CID_libcore};
+extern const CoclassID CID_CLong =
+        {{0xbc8830e2,0x23f7,0x4a25,0xb61e,{0xd,0xb,0xc,0x9,0xc,0xc,0xe,0x3,0x8,0x5,0xb,0x2}}, &CID_libcore};
+extern const CoclassID CID_CShort =
+        {{0xcdff023b,0xba1b,0x4e14,0xbf1b,{0x8,0xe,0xb,0xf,0x9,0xf,0xe,0x8,0x0,0x2,0x1,0x4}}, &CID_libcore};
+extern const CoclassID CID_CStackTrace =
+        {{0x16a75841,0xffee,0x43a5,0xbd5c,{0x4,0xf,0x8,0x3,0x6,0x2,0x3,0x6,0x1,0xb,0x3,0x5}}, &CID_libcore};
+extern const CoclassID CID_CStackTraceElement =
+        {{0xc2fee305,0xa2bb,0x453a,0x9248,{0x4,0x7,0x3,0xb,0xb,0xe,0xf,0x5,0x5,0xf,0xd,0x0}}, &CID_libcore};
+extern const CoclassID CID_CString =
+        {{0x10e6419e,0xb8d0,0x44be,0xb309,{0x5,0x4,0x0,0x8,0x6,0xe,0xb,0x3,0xe,0x5,0x6,0x0}}, &CID_libcore};
+extern const CoclassID CID_CStringBuffer =
+        {{0x8c3a55f1,0x63c5,0x4abd,0xb68c,{0x4,0x6,0x7,0x7,0x3,0x8,0x7,0x7,0xa,0x6,0x5,0x5}}, &CID_libcore};
+extern const CoclassID CID_CStringBuilder =
+        {{0xcbc6b55a,0xc06e,0x4ddc,0xb7f8,{0xf,0x0,0xc,0xc,0x0,0xb,0xf,0x9,0x4,0xf,0xf,0x9}}, &CID_libcore};
+extern const CoclassID CID_CRuntimePermission =
+        {{0x106e254e,0x0909,0x4238,0x8db4,{0x2,0xe,0x3,0x4,0x3,0x7,0x1,0x5,0xc,0x9,0xa,0xd}}, &CID_libcore};
+
+} // namespace core
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+
+
+
+extern const InterfaceID IID_IArrayList =
+        {{0xd0dcbefa,0xd6ac,0x4f0e,0x96b7,{0xe,0x7,0x6,0x9,0x7,0x6,0x0,0x6,0xf,0x8,0x7,0x7}}, &CID_libcore};
+extern const InterfaceID IID_ICalendar =
+        {{0x837f48fc,0xccf7,0x4098,0x90cb,{0xd,0x0,0x2,0xa,0x3,0xb,0x8,0x3,0xe,0xf,0x2,0xf}}, &CID_libcore};
+extern const InterfaceID IID_ICollection =
+        {{0x2618a380,0x071b,0x440b,0x84b7,{0xd,0x3,0xa,0xc,0x4,0xa,0x3,0xd,0xe,0x3,0xa,0xd}}, &CID_libcore};
+extern const InterfaceID IID_IComparator =
+        {{0xc548a9de,0xf3d8,0x4acb,0x83f3,{0x0,0x0,0xc,0x6,0x5,0xc,0x1,0xb,0x5,0x6,0xb,0x2}}, &CID_libcore};
+extern const InterfaceID IID_ICurrency =
+        {{0x23187573,0x410c,0x46a8,0xb371,{0xe,0xb,0xe,0x0,0x0,0xa,0xb,0x1,0x9,0xf,0xc,0xc}}, &CID_libcore};
+extern const InterfaceID IID_IDate =
+        {{0x6a87e3db,0xc2aa,0x470c,0x9638,{0x4,0xa,0x2,0xd,0x3,0x1,0xd,0xf,0xd,0xd,0x3,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IDeque =
+        {{0x1e4c819a,0x2017,0x4394,0xb0f4,{0x7,0x5,0xb,0xb,0xd,0xd,0x1,0x9,0xe,0x5,0x8,0xa}}, &CID_libcore};
+extern const InterfaceID IID_IDictionary =
+        {{0x6e0f6eb5,0x6c0e,0x4f31,0xb042,{0xd,0x5,0xc,0xd,0x1,0x8,0xc,0xf,0x8,0xa,0x2,0x3}}, &CID_libcore};
+extern const InterfaceID IID_IEnumeration =
+        {{0x63be1916,0xf500,0x4d5b,0xbf81,{0x9,0xf,0xc,0x2,0x1,0xe,0x9,0xb,0xe,0xe,0x3,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IFormattable =
+        {{0xa509a4a4,0x6b8d,0x43fa,0x8364,{0xe,0x7,0x4,0x8,0x4,0x0,0x6,0xd,0x9,0xb,0x5,0xa}}, &CID_libcore};
+extern const InterfaceID IID_IFormatter =
+        {{0x20aae661,0x0408,0x4d5e,0xa0ef,{0x7,0x7,0xe,0x4,0x3,0x3,0x7,0x7,0x4,0xf,0xa,0xc}}, &CID_libcore};
+extern const InterfaceID IID_IGregorianCalendar =
+        {{0xd6e54cfc,0x072f,0x4dba,0x98c3,{0xb,0x7,0x3,0xd,0x0,0x9,0x3,0x1,0xa,0x5,0x3,0xb}}, &CID_libcore};
+extern const InterfaceID IID_IHashtable =
+        {{0xb60ce103,0x12d2,0x4b1f,0xae56,{0xb,0x5,0xd,0x5,0xf,0xe,0xe,0xc,0x2,0x3,0xd,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IHashMap =
+        {{0x3b25617c,0x5ccc,0x428c,0x8daf,{0x1,0xb,0xd,0xc,0x8,0x5,0x5,0xc,0xe,0x1,0xa,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IHashSet =
+        {{0x4f2e0d90,0x13b0,0x4ac9,0x857a,{0xc,0xa,0xa,0xf,0x3,0x2,0x8,0xe,0x4,0x2,0x1,0x6}}, &CID_libcore};
+extern const InterfaceID IID_IIterator =
+        {{0x7f59e8cb,0xee27,0x4e7c,0x9d1a,{0x9,0x8,0xc,0x8,0xe,0x7,0x3,0x7,0x1,0xf,0xd,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IJapaneseImperialCalendar =
+        {{0x7eab4e43,0xab92,0x4309,0xa542,{0x5,0x5,0xd,0x1,0x7,0xa,0x8,0xd,0xd,0x6,0xd,0xa}}, &CID_libcore};
+extern const InterfaceID IID_ILinkedHashMap =
+        {{0xb916c8bb,0x1d3e,0x4c7b,0x9d68,{0x7,0x9,0x4,0xc,0x5,0x8,0x6,0xa,0x5,0xe,0x4,0x6}}, &CID_libcore};
+extern const InterfaceID IID_ILinkedHashSet =
+        {{0x15609b01,0xe234,0x4f70,0xab52,{0x1,0xc,0x2,0xf,0xd,0xb,0x3,0x5,0x6,0x1,0xe,0xb}}, &CID_libcore};
+extern const InterfaceID IID_ILinkedList =
+        {{0x116514aa,0x3d9b,0x480a,0xa3f1,{0x7,0x7,0xb,0x8,0xc,0xf,0xa,0xb,0x8,0xa,0xe,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IList =
+        {{0x1e687607,0xefae,0x42a7,0x8ce2,{0x2,0x4,0xe,0x5,0x1,0xc,0x8,0x1,0xa,0x6,0x1,0x6}}, &CID_libcore};
+extern const InterfaceID IID_IListIterator =
+        {{0xe8665718,0xbf0d,0x4054,0x850c,{0xa,0x3,0x0,0x0,0x9,0x8,0xd,0xe,0x0,0x4,0xb,0x8}}, &CID_libcore};
+extern const InterfaceID IID_ILocaleCategory =
+        {{0xb77f3ad5,0x3301,0x486b,0xa529,{0x2,0x4,0xf,0xe,0x2,0x7,0xc,0xa,0xa,0x1,0x5,0x1}}, &CID_libcore};
+extern const InterfaceID IID_ILocaleBuilder =
+        {{0x533f5611,0xbdc2,0x4c2a,0xa6f7,{0x0,0x7,0xa,0x9,0x2,0x6,0x7,0x0,0x8,0x0,0xc,0x2}}, &CID_libcore};
+extern const InterfaceID IID_ILocale =
+        {{0xe23a921a,0x6d45,0x4b08,0x89e3,{0xf,0x0,0x9,0x7,0x7,0x8,0x1,0x1,0x8,0x0,0x2,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IMapEntry =
+        {{0x7eb63931,0x9e1d,0x4a39,0xb51f,{0xa,0x8,0xe,0x7,0x9,0x3,0xa,0xa,0x9,0x8,0xd,0x7}}, &CID_libcore};
+extern const InterfaceID IID_IMap =
+        {{0x76e49571,0x40d6,0x45f2,0xbb74,{0x1,0x7,0x0,0x4,0x5,0xd,0x6,0x7,0xe,0x6,0x4,0xf}}, &CID_libcore};
+extern const InterfaceID IID_INavigableMap =
+        {{0xdb174312,0x1174,0x4777,0x8e66,{0xe,0x6,0xf,0x7,0x2,0x3,0x5,0x9,0xd,0x0,0xb,0x8}}, &CID_libcore};
+extern const InterfaceID IID_INavigableSet =
+        {{0xd9a99667,0xb9b3,0x43bb,0x94dc,{0x7,0x6,0x4,0x5,0xf,0x7,0x3,0x1,0x3,0xc,0x5,0x7}}, &CID_libcore};
+extern const InterfaceID IID_IProperties =
+        {{0x417c6542,0x16e1,0x4542,0xb387,{0x3,0xf,0x5,0x0,0x7,0x5,0xd,0x7,0x3,0xb,0xe,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IQueue =
+        {{0x361efe2d,0xdc2c,0x4234,0xaaa3,{0x2,0x7,0x5,0xf,0xf,0x0,0x0,0x5,0x1,0x5,0xf,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IRandom =
+        {{0xb262d480,0xe46b,0x49c2,0xacba,{0x9,0x8,0x4,0x7,0x8,0xd,0x8,0x1,0x0,0xa,0x1,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IRandomAccess =
+        {{0x071151aa,0xf5e7,0x44df,0xa448,{0x0,0xa,0xa,0xf,0x9,0x2,0x0,0x4,0x5,0x9,0x5,0xc}}, &CID_libcore};
+extern const InterfaceID IID_IServiceLoader =
+        {{0x37267664,0x24c7,0x460b,0x9a4f,{0x4,0xb,0xe,0xb,0x7,0xe,0xa,0x7,0x2,0x2,0x7,0x6}}, &CID_libcore};
+extern const InterfaceID IID_ISet =
+        {{0x163ff32d,0xc566,0x4666,0x8b18,{0x7,0x3,0xb,0x5,0x0,0x6,0x2,0x7,0x5,0x1,0xc,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ISimpleTimeZone =
+        {{0x2a48ddd4,0x009a,0x4f55,0x86bd,{0x8,0x2,0x5,0xb,0x4,0x2,0x1,0xe,0xa,0xd,0x3,0xc}}, &CID_libcore};
+extern const InterfaceID IID_ISortedMap =
+        {{0xd29b6732,0x8fdc,0x45ed,0x93c1,{0x3,0xf,0xe,0x8,0x2,0x0,0x7,0x0,0x3,0x0,0xe,0x1}}, &CID_libcore};
+extern const InterfaceID IID_ISortedSet =
+        {{0x87972ee6,0x547a,0x4ae5,0xb17d,{0xa,0x7,0xe,0x8,0xf,0x8,0xe,0xc,0x7,0x9,0x4,0xa}}, &CID_libcore};
+extern const InterfaceID IID_IStringTokenizer =
+        {{0x8283c934,0xd3ce,0x4a7b,0xad50,{0xa,0x9,0x7,0xf,0x7,0x5,0x7,0xc,0xe,0x1,0x2,0x1}}, &CID_libcore};
+extern const InterfaceID IID_ITimeZone =
+        {{0xd1094f3a,0xc45b,0x4188,0xa973,{0x2,0x6,0x6,0xa,0x5,0xa,0xd,0x2,0xe,0x8,0x4,0xa}}, &CID_libcore};
+extern const InterfaceID IID_ITimeZoneGetter =
+        {{0xce78effd,0xc715,0x4669,0x96bc,{0x1,0x8,0xd,0x4,0xd,0xd,0x2,0x7,0x8,0xd,0x7,0x7}}, &CID_libcore};
+extern const InterfaceID IID_ITreeMap =
+        {{0xae691caf,0x3a86,0x4ef7,0xbc4e,{0xb,0x8,0x8,0xa,0x6,0x5,0x9,0xe,0x1,0xc,0x3,0x7}}, &CID_libcore};
+extern const InterfaceID IID_ITreeSet =
+        {{0xb5f35c25,0x6d72,0x4112,0xa137,{0x9,0xf,0x6,0x8,0x1,0x6,0xd,0x7,0x8,0xe,0x7,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IVector =
+        {{0x496d3da5,0x9000,0x439e,0xbd01,{0x3,0xc,0xf,0x0,0x4,0xa,0x0,0x4,0x3,0xf,0x4,0x4}}, &CID_libcore};
+extern const InterfaceID IID_ICArrayListClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICDateClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICFormatterClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICGregorianCalendarClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICHashMapClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICHashSetClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICHashtableClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICLinkedHashMapClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICLinkedHashSetClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICLinkedListClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICLocaleClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICPropertiesClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICPropertyPermissionClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICRandomClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICSimpleEntryClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICSimpleImmutableEntryClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICSimpleTimeZoneClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICStringTokenizerClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICTreeMapClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICTreeSetClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICVectorClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CArrayList =
+        {{0x7dbd4e0a,0x4bf2,0x4ccb,0xa4e9,{0xb,0xf,0xe,0x2,0x3,0x2,0xb,0x4,0x0,0xb,0xa,0x4}}, &CID_libcore};
+extern const CoclassID CID_CDate =
+        {{0x57b9bd7b,0xd0d5,0x42c5,0x9784,{0x2,0x0,0x2,0x6,0x1,0x4,0x5,0x1,0x7,0xa,0x4,0xf}}, &CID_libcore};
+extern const CoclassID CID_CFormatter =
+        {{0xca21100d,0x664d,0x4cf1,0xaf77,{0x4,0x8,0xc,0x2,0x5,0x2,0xd,0xe,0xf,0x9,0xa,0x2}}, &CID_libcore};
+extern const CoclassID CID_CGregorianCalendar =
+        {{0xe3a4ed7a,0xc706,0x4a8a,0x9116,{0x2,0xc,0x9,0xf,0xc,0xf,0xe,0x9,0x7,0xa,0x2,0x5}}, &CID_libcore};
+extern const CoclassID CID_CHashMap =
+        {{0xafe87a5a,0x0e0b,0x4c33,0x975e,{0x2,0xe,0xc,0x5,0xc,0xa,0xa,0x6,0x0,0xa,0xf,0xc}}, &CID_libcore};
+extern const CoclassID CID_CHashSet =
+        {{0x3b1f6a9d,0x3d2b,0x43ab,0xb61f,{0xc,0xa,0xa,0x7,0x6,0x6,0xe,0x8,0x4,0x3,0x0,0x3}}, &CID_libcore};
+extern const CoclassID CID_CHashtable =
+        {{0x10c87f0c,0x91e6,0x4fa1,0x905e,{0x8,0xc,0xe,0x9,0xf,0x5,0x1,0x3,0x3,0x1,0x8,0xf}}, &CID_libcore};
+extern const CoclassID CID_CLinkedHashMap =
+        {{0x737c1ff9,0xc4b3,0x4d55,0xa67f,{0x1,0x6,0x0,0xa,0x4,0x1,0x1,0xd,0x2,0x8,0x9,0xb}}, &CID_libcore};
+extern const CoclassID CID_CLinkedHashSet =
+        {{0x2a5b0a37,0x7877,0x4ee5,0x9b3a,{0x4,0x3,0x9,0x5,0x3,0x8,0xf,0x7,0x0,0x3,0x5,0x4}}, &CID_libcore};
+extern const CoclassID CID_CLinkedList =
+        {{0x60934bce,0x6b73,0x44c8,0xbff3,{0x5,0x0,0x9,0x1,0x6,0x2,0x7,0x5,0xd,0xb,0x2,0x3}}, &CID_libcore};
+extern const CoclassID CID_CLocale =
+        {{0xd64e331d,0x41f4,0x40b1,0xb71b,{0x7,0x4,0x9,0x2,0xf,0xf,0xc,0x7,0xf,0x5,0xb,0x2}}, &CID_libcore};
+extern const CoclassID CID_CLocaleBuilder =
+        {{0x755282d7,0x1444,0x44e3,0xbe80,{0x6,0x2,0x6,0x0,0x5,0x0,0x8,0x8,0x7,0x5,0xd,0x3}}, &CID_libcore};
+extern const CoclassID CID_CProperties =
+        {{0x2f6a7390,0x6aed,0x4f7d,0x863e,{0x3,0xf,0x0,0x0,0x7,0x6,0x3,0x5,0xb,0xa,0x1,0x4}}, &CID_libcore};
+extern const CoclassID CID_CPropertyPermission =
+        {{0x0ce2245f,0xc9d7,0x4a24,0x8fda,{0x5,0x6,0xa,0xb,0x5,0xd,0x3,0x8,0xe,0xa,0x1,0x8}}, &CID_libcore};
+extern const CoclassID CID_CRandom =
+        {{0x1d590d6f,0x70ee,0x497a,0xb8a9,{0xe,0x9,0x9,0x2,0x1,0x2,0xe,0x0,0x4,0xf,0x5,0x3}}, &CID_libcore};
+extern const CoclassID CID_CSimpleEntry =
+        {{0x4a6bdbee,0xa9dc,0x4269,0xb4dc,{0xb,0x1,0x8,0xd,0xf,0x8,0x0,0xf,0xd,0x8,0xa,0x2}}, &CID_libcore};
+extern const CoclassID CID_CSimpleImmutableEntry =
+        {{0x0546ef75,0x6292,0x4d8d,0xa227,{0x5,0xe,0x5,0x3,0xf,0x1,0x1,0x4,0x1,0x9,0xa,0xe}}, &CID_libcore};
+extern const CoclassID CID_CSimpleTimeZone =
+        {{0x23da10ba,0x6998,0x4274,0x9e3e,{0xf,0x4,0x4,0xb,0xf,0xb,0xe,0xa,0xf,0x2,0x7,0xb}}, &CID_libcore};
+extern const CoclassID CID_CStringTokenizer =
+        {{0x6858c0ba,0xe3a0,0x48fd,0x8f22,{0xb,0xb,0xd,0xc,0x4,0x5,0x0,0x3,0xd,0x8,0x3,0xd}}, &CID_libcore};
+extern const CoclassID CID_CTreeMap =
+        {{0x3ef0ae4d,0xd83b,0x453f,0xaeee,{0x6,0x4,0x6,0xd,0x8,0x4,0xb,0x7,0x5,0x3,0x8,0xb}}, &CID_libcore};
+extern const CoclassID CID_CTreeSet =
+        {{0x22c0eedd,0xc096,0x4a9e,0xbe93,{0x0,0xb,0x9,0xe,0x6,0x2,0x6,0x1,0xf,0xd,0x3,0x9}}, &CID_libcore};
+extern const CoclassID CID_CVector =
+        {{0xa2ff11fd,0xca23,0x4c88,0xb8c9,{0x3,0x8,0x0,0x2,0xa,0xb,0x8,0x9,0x3,0x5,0xd,0xe}}, &CID_libcore};
+
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace io {
+
+
+
+extern const InterfaceID IID_IBuffer =
+        {{0x73dcfab7,0xea7a,0x4bab,0xaf32,{0x4,0xc,0x3,0xd,0x0,0xa,0xd,0x6,0xb,0x9,0x8,0x6}}, &CID_libcore};
+extern const InterfaceID IID_IBufferedWriter =
+        {{0xf4aadb4e,0x6469,0x49e1,0x9987,{0x8,0xa,0x4,0x6,0xa,0x7,0x3,0xf,0x7,0x9,0x2,0x3}}, &CID_libcore};
+extern const InterfaceID IID_IByteArrayOutputStream =
+        {{0x266680ff,0x0a52,0x4a45,0x8222,{0x1,0x0,0xd,0xa,0x4,0xc,0x4,0xb,0x9,0x1,0x7,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IByteBuffer =
+        {{0x0a78992f,0xb55e,0x40bc,0x933b,{0xf,0x3,0x5,0xb,0x1,0x0,0x4,0x6,0xc,0xc,0x4,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IByteOrder =
+        {{0x079172f5,0x93a1,0x40bb,0xbeae,{0xa,0x0,0x8,0x7,0x8,0x6,0xd,0x9,0xb,0x9,0xa,0xa}}, &CID_libcore};
+extern const InterfaceID IID_ICharBuffer =
+        {{0xc1f712ff,0xc3af,0x4ac8,0x9ffa,{0x1,0x4,0x3,0x9,0xd,0x8,0x1,0x8,0x3,0x1,0xc,0x8}}, &CID_libcore};
+extern const InterfaceID IID_ICloseable =
+        {{0xdcd6e9cb,0xb6b5,0x4840,0x9e62,{0x9,0xc,0xb,0x2,0x5,0xb,0x1,0x7,0xf,0x0,0x7,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IDataInput =
+        {{0x7feae7f1,0xd729,0x413f,0xa0ce,{0xf,0xb,0x2,0x1,0x2,0xb,0xe,0xb,0x2,0x0,0x1,0x0}}, &CID_libcore};
+extern const InterfaceID IID_IDoubleBuffer =
+        {{0x23485c78,0x6782,0x4d5f,0x8d30,{0x5,0x5,0xc,0xf,0x6,0xa,0x6,0xe,0x5,0xd,0xd,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IFile =
+        {{0x64d64034,0x3b89,0x4cc0,0xb446,{0xd,0x2,0x0,0xc,0x3,0xa,0x6,0xa,0x0,0xf,0x8,0xf}}, &CID_libcore};
+extern const InterfaceID IID_IFileDescriptor =
+        {{0x1a03d7ff,0xb6c9,0x4cb2,0xa30a,{0xa,0xf,0x6,0xa,0x5,0xc,0x6,0x7,0x3,0x3,0xe,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IFileFilter =
+        {{0x5135c5a7,0x1174,0x430b,0x93f6,{0x5,0x4,0x8,0xb,0x1,0x7,0xa,0x4,0x3,0x6,0xc,0xf}}, &CID_libcore};
+extern const InterfaceID IID_IFileInputStream =
+        {{0x4062b7ff,0x4bea,0x4200,0xa9f6,{0x8,0xd,0x2,0xb,0x7,0x0,0x6,0x9,0x5,0x6,0xf,0xc}}, &CID_libcore};
+extern const InterfaceID IID_IFileOutputStream =
+        {{0x49e5fe1b,0xc934,0x4730,0x9be1,{0xd,0xc,0x1,0xe,0xc,0x4,0x9,0x5,0xe,0x7,0x0,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IFilenameFilter =
+        {{0x0b2dca26,0x5399,0x4264,0xb1cb,{0xa,0xf,0x2,0x9,0x5,0x6,0x9,0x4,0x9,0x2,0x5,0xb}}, &CID_libcore};
+extern const InterfaceID IID_IFloatBuffer =
+        {{0x6cac7adc,0x080b,0x417f,0xab85,{0xd,0x0,0x8,0x2,0x1,0xb,0xf,0x8,0x8,0x4,0x2,0x3}}, &CID_libcore};
+extern const InterfaceID IID_IFlushable =
+        {{0xcd28eb63,0xcfb9,0x4123,0x9f7f,{0x6,0xc,0x9,0x2,0x0,0x3,0xd,0x6,0x5,0x3,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_IInputStream =
+        {{0xffea83b0,0xbb5d,0x4a13,0xb9e8,{0x9,0xa,0x4,0x3,0x0,0xb,0x9,0x7,0xe,0x8,0x5,0x4}}, &CID_libcore};
+extern const InterfaceID IID_IIntegerBuffer =
+        {{0x017a5ce6,0xc447,0x4245,0xb1da,{0xf,0xc,0x0,0xd,0x4,0x1,0xc,0x4,0xe,0x2,0x5,0x6}}, &CID_libcore};
+extern const InterfaceID IID_IInterruptible =
+        {{0xf6e25f86,0x4f88,0x4e18,0xbd93,{0xe,0x1,0xd,0xe,0xa,0x5,0xb,0xc,0xf,0x9,0x4,0x6}}, &CID_libcore};
+extern const InterfaceID IID_ILongBuffer =
+        {{0xe0f0ef95,0xb242,0x4716,0xbae7,{0xd,0x4,0xe,0x0,0x4,0x7,0xf,0xd,0xa,0x5,0x5,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IMappedByteBuffer =
+        {{0xbaf614cd,0xd39d,0x4b89,0x8e62,{0xf,0xd,0xd,0x5,0x7,0x1,0xc,0x5,0x6,0xd,0x8,0x0}}, &CID_libcore};
+extern const InterfaceID IID_IObjectInput =
+        {{0xbd7676a1,0x7d70,0x4404,0x9df0,{0xd,0x3,0x3,0xe,0xd,0x8,0x1,0x2,0xe,0x9,0x0,0x3}}, &CID_libcore};
+extern const InterfaceID IID_IObjectInputStream =
+        {{0x4ee12392,0x6cb7,0x445c,0xbfce,{0xa,0x3,0xf,0x2,0x4,0x1,0x5,0x0,0xe,0x2,0xd,0xf}}, &CID_libcore};
+extern const InterfaceID IID_IOutputStream =
+        {{0x46274ade,0xa4d4,0x4200,0x8d95,{0x5,0x9,0xb,0x4,0x0,0x1,0x6,0x0,0xc,0xf,0x6,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IOutputStreamWriter =
+        {{0x3bebf7a8,0x0001,0x4ad5,0x8b5a,{0xb,0x0,0x3,0x5,0x3,0x0,0x7,0x0,0xb,0x3,0x1,0xd}}, &CID_libcore};
+extern const InterfaceID IID_IPrintStream =
+        {{0x831a7565,0xe7f6,0x4b29,0xaf91,{0xf,0x8,0xc,0x0,0xf,0x0,0x1,0x2,0xf,0x4,0x4,0x1}}, &CID_libcore};
+extern const InterfaceID IID_IPrintWriter =
+        {{0x680fba48,0xd41b,0x4a09,0x9b10,{0x7,0x0,0x7,0x7,0xe,0xa,0xd,0xa,0x7,0xb,0x8,0x9}}, &CID_libcore};
+extern const InterfaceID IID_IReader =
+        {{0x04cb516b,0xee71,0x448c,0xb78d,{0x0,0x0,0xb,0x2,0x0,0x8,0x3,0x0,0x8,0xa,0xb,0x6}}, &CID_libcore};
+extern const InterfaceID IID_ISerializable =
+        {{0x2baa70ff,0x2124,0x477e,0x9b1e,{0xf,0x1,0x6,0xb,0xc,0x1,0x9,0x0,0x9,0xe,0x6,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IShortBuffer =
+        {{0x0a781618,0x7e19,0x4a2c,0x8ec1,{0xc,0xf,0x2,0x8,0xd,0xb,0x2,0x4,0x2,0x4,0x7,0xb}}, &CID_libcore};
+extern const InterfaceID IID_IStringWriter =
+        {{0x29322ab7,0x52c0,0x4dea,0xafbd,{0x8,0xd,0x6,0x9,0x6,0x1,0xe,0xb,0x6,0x3,0x3,0x4}}, &CID_libcore};
+extern const InterfaceID IID_IWriter =
+        {{0xcca035d8,0x6f23,0x4eac,0xa581,{0x2,0x9,0x4,0xd,0x5,0xf,0xf,0x8,0xc,0x4,0x1,0xf}}, &CID_libcore};
+extern const InterfaceID IID_ICBufferedWriterClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICByteArrayOutputStreamClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICDirectByteBufferClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICFileClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICFileDescriptorClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICFileInputStreamClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICFileOutputStreamClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICOutputStreamWriterClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICPrintWriterClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICStringWriterClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CBufferedWriter =
+        {{0xcf7b3ffb,0x46ce,0x44fc,0x9057,{0xd,0x8,0xe,0xc,0x0,0x3,0xc,0x8,0x2,0x0,0xb,0x7}}, &CID_libcore};
+extern const CoclassID CID_CByteArrayOutputStream =
+        {{0x69455e4d,0x56b1,0x43b1,0x98b1,{0xe,0x4,0x9,0x0,0x7,0xe,0x3,0x3,0x2,0xa,0x4,0xf}}, &CID_libcore};
+extern const CoclassID CID_CDirectByteBuffer =
+        {{0x160997fd,0x1165,0x46dd,0xa47a,{0x8,0xa,0x0,0x0,0x0,0xb,0xc,0xd,0x1,0x9,0x1,0x6}}, &CID_libcore};
+extern const CoclassID CID_CFile =
+        {{0x0d9c5571,0x7eaa,0x44e1,0x815f,{0xc,0x6,0xa,0xf,0x4,0x2,0x1,0xc,0x7,0x8,0x0,0xd}}, &CID_libcore};
+extern const CoclassID CID_CFileDescriptor =
+        {{0x3e291dd3,0x0c31,0x4526,0x8ef9,{0xf,0xe,0x6,0x1,0xb,0xc,0x1,0xe,0x5,0x0,0x8,0xe}}, &CID_libcore};
+extern const CoclassID CID_CFileInputStream =
+        {{0x28063bc3,0x48b2,0x43f4,0xb159,{0xc,0x4,0xc,0x6,0x5,0x4,0x7,0x5,0xb,0x8,0x4,0x4}}, &CID_libcore};
+extern const CoclassID CID_CFileOutputStream =
+        {{0x6d5f9b98,0xce5c,0x4e30,0xa5ca,{0xc,0x0,0xc,0x7,0x4,0xe,0x0,0xd,0xc,0x8,0xf,0xd}}, &CID_libcore};
+extern const CoclassID CID_COutputStreamWriter =
+        {{0x3f1442a5,0xce76,0x40b3,0x8889,{0xc,0x9,0x4,0x3,0x1,0xc,0x8,0x1,0x0,0xc,0x1,0xd}}, &CID_libcore};
+extern const CoclassID CID_CPrintWriter =
+        {{0x5de87670,0xf240,0x43cd,0xb06d,{0xa,0x7,0x5,0x8,0xb,0x4,0x9,0x1,0x4,0xe,0x7,0x6}}, &CID_libcore};
+extern const CoclassID CID_CStringWriter =
+        {{0x2a886435,0x1ec8,0x4311,0xbe20,{0x0,0x3,0xc,0xf,0xf,0x4,0x5,0xb,0x0,0xd,0xc,0x8}}, &CID_libcore};
+
+} // namespace io
+} // namespace ccm
+
+namespace ccm {
+namespace security {
+
+
+extern const InterfaceID IID_IGuard =
+        {{0xc00bdb94,0x3e39,0x4c44,0xb87e,{0xd,0x6,0x0,0x2,0xf,0x0,0xa,0x9,0x5,0x8,0x1,0xf}}, &CID_libcore};
+extern const InterfaceID IID_IPermission =
+        {{0x93cc3a78,0x0afc,0x4b41,0x999c,{0xa,0xa,0xa,0x6,0x4,0x3,0xc,0x6,0xe,0x1,0xa,0x3}}, &CID_libcore};
+extern const InterfaceID IID_IPermissionCollection =
+        {{0x8bdc918c,0xd6b9,0x457b,0x8d4c,{0x2,0x4,0xc,0xd,0xb,0x0,0xa,0x4,0xe,0xd,0x4,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IPrivilegedAction =
+        {{0x69b1afca,0x4562,0x40d1,0xbb20,{0x4,0x4,0xc,0x9,0x5,0x7,0x4,0x3,0xe,0x6,0xf,0x9}}, &CID_libcore};
+extern const InterfaceID IID_IProviderService =
+        {{0x598540a9,0x9845,0x4be4,0xab0e,{0x3,0x6,0xf,0x8,0x1,0x7,0x0,0x2,0x6,0x1,0x0,0x1}}, &CID_libcore};
+extern const InterfaceID IID_IProvider =
+        {{0x5175ea7f,0x5a2b,0x480e,0xb8c5,{0x3,0x7,0xb,0xe,0xf,0x4,0x0,0x3,0x6,0xc,0x6,0xa}}, &CID_libcore};
+extern const InterfaceID IID_ISecureRandom =
+        {{0xa9d0a2ef,0x0248,0x448d,0xae16,{0x2,0xf,0xf,0x4,0xd,0xf,0x8,0xa,0xb,0x0,0xd,0x7}}, &CID_libcore};
+extern const InterfaceID IID_ISecureRandomSpi =
+        {{0x0af71205,0x21f9,0x4a74,0x8e20,{0xf,0x7,0x7,0x8,0xb,0xa,0x6,0x5,0x6,0x3,0x8,0xa}}, &CID_libcore};
+extern const InterfaceID IID_ICSecureRandomClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CPermissions =
+        {{0xc9a89c69,0x63a6,0x4636,0xb77a,{0x9,0x7,0xc,0x8,0x3,0xb,0xa,0x3,0x8,0x0,0xe,0xe}}, &CID_libcore};
+extern const CoclassID CID_CSecureRandom =
+        {{0x16dff384,0x5829,0x41c6,0x9b2e,{0x7,0x1,0xd,0x3,0xc,0xc,0xd,0x7,0xb,0xd,0x9,0x7}}, &CID_libcore};
+
+} // namespace security
+} // namespace ccm
+
+namespace ccm {
+namespace net {
+
+
+extern const InterfaceID IID_IDatagramPacket =
+        {{0x74feab7b,0xa39b,0x47a8,0xbbc7,{0x6,0xa,0xf,0x9,0x8,0x9,0x7,0xc,0x3,0x6,0xe,0x9}}, &CID_libcore};
+extern const InterfaceID IID_IDatagramSocket =
+        {{0xd3590256,0xae75,0x46e9,0xa0d6,{0x9,0x4,0x0,0xe,0xc,0x8,0xe,0x9,0x4,0x6,0x4,0x9}}, &CID_libcore};
+extern const InterfaceID IID_IInetAddress =
+        {{0x390d3888,0x705a,0x4934,0x9752,{0x9,0x0,0x7,0x1,0xc,0x3,0xb,0xb,0xa,0xa,0xe,0x1}}, &CID_libcore};
+extern const InterfaceID IID_IInetSocketAddress =
+        {{0x49a9b44d,0xd53d,0x4645,0xa104,{0xf,0xe,0x3,0x0,0xb,0x3,0xb,0x3,0xb,0x8,0xb,0x6}}, &CID_libcore};
+extern const InterfaceID IID_ISocket =
+        {{0xf4fdb078,0xb1ff,0x4b56,0xb035,{0x5,0x4,0x8,0x9,0x2,0x2,0x0,0x3,0x0,0x8,0x2,0x9}}, &CID_libcore};
+extern const InterfaceID IID_ISocketAddress =
+        {{0x02ad1b11,0xb4d3,0x4a32,0xbffc,{0x7,0x8,0xc,0x8,0x5,0x5,0x6,0x5,0x3,0x7,0xc,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IURI =
+        {{0xfd92ca32,0xe28f,0x4fd6,0xa29c,{0x8,0x5,0x6,0xb,0x5,0xa,0x5,0x8,0xd,0x4,0x1,0x7}}, &CID_libcore};
+extern const InterfaceID IID_IURL =
+        {{0x2e31c79e,0xae8b,0x4124,0x8705,{0x2,0x2,0x6,0x7,0xc,0x7,0xf,0xe,0x6,0x1,0x5,0x9}}, &CID_libcore};
+
+} // namespace net
+} // namespace ccm
+
+namespace ccm {
+namespace io {
+namespace channels {
+
+
+extern const InterfaceID IID_IDirectBuffer =
+        {{0xfeb0f6eb,0xd808,0x4e28,0x8d3e,{0xf,0x4,0xc,0xf,0x0,0x7,0x8,0x6,0xd,0xf,0xe,0xd}}, &CID_libcore};
+extern const InterfaceID IID_IFileChannel =
+        {{0xb13cff36,0xf461,0x4a6f,0x807b,{0x6,0x6,0xc,0x9,0xa,0x4,0x5,0xd,0x6,0x5,0x3,0x1}}, &CID_libcore};
+
+} // namespace channels
+} // namespace io
+} // namespace ccm
+
+namespace ccm {
+namespace io {
+namespace charset {
+
+
+extern const InterfaceID IID_ICharset =
+        {{0x8f4224e5,0xbadb,0x44aa,0x828b,{0xf,0x9,0x2,0xb,0xd,0x0,0xa,0xd,0x6,0x7,0x4,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICharsetDecoder =
+        {{0x47bf0779,0xf294,0x46c6,0xb8cd,{0xb,0xc,0xd,0x6,0xd,0xe,0x2,0x7,0x8,0x1,0x7,0x1}}, &CID_libcore};
+extern const InterfaceID IID_ICharsetEncoder =
+        {{0x1b6e3b85,0xc728,0x4a3f,0xa840,{0x1,0xd,0x7,0xb,0x0,0xe,0xa,0xc,0xc,0x7,0x6,0x4}}, &CID_libcore};
+extern const InterfaceID IID_ICodingErrorAction =
+        {{0x332505d1,0x4cc1,0x444f,0xb9b2,{0xa,0xa,0xa,0x9,0x8,0x9,0x2,0x8,0x7,0x4,0x4,0x2}}, &CID_libcore};
+extern const InterfaceID IID_ICoderResult =
+        {{0x038b7c78,0x8610,0x4986,0x8aee,{0xb,0x9,0xe,0x1,0xa,0x5,0x6,0x9,0x7,0x1,0xa,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IStreamEncoder =
+        {{0x9fb9b9f9,0x552f,0x482a,0xbe03,{0x4,0x5,0x3,0x6,0x4,0x9,0xb,0xd,0x9,0x2,0x3,0x2}}, &CID_libcore};
+
+} // namespace charset
+} // namespace io
+} // namespace ccm
+
+namespace ccm {
+namespace io {
+namespace charset {
+namespace spi {
+
+
+extern const InterfaceID IID_ICharsetProvider =
+        {{0xf91b6b3c,0x3f96,0x47ce,0xbd91,{0x4,0xc,0xd,0xe,0x6,0x4,0xa,0x8,0x4,0xf,0x0,0x7}}, &CID_libcore};
+
+} // namespace spi
+} // namespace charset
+} // namespace io
+} // namespace ccm
+
+namespace ccm {
+namespace math {
+
+
+extern const InterfaceID IID_IBigDecimal =
+        {{0x51317f66,0x2236,0x494c,0x9eef,{0xd,0xa,0x3,0x7,0xc,0x9,0x5,0xa,0x2,0x8,0x4,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IBigInteger =
+        {{0x9860031d,0xa5ad,0x446b,0xa7ef,{0x2,0x4,0xb,0x7,0x5,0xf,0xe,0x6,0xd,0xa,0xa,0x1}}, &CID_libcore};
+extern const InterfaceID IID_IMathContext =
+        {{0x897ee44a,0x413c,0x4bd7,0x981a,{0xf,0x8,0x1,0x0,0x6,0xb,0xb,0x1,0x9,0x6,0x4,0x8}}, &CID_libcore};
+extern const InterfaceID IID_ICBigDecimalClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICBigIntegerClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICMathContextClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CBigDecimal =
+        {{0xc0f44da4,0x575b,0x44e6,0xb234,{0x2,0x2,0x0,0x8,0xa,0x2,0x8,0x5,0x8,0x2,0xa,0xe}}, &CID_libcore};
+extern const CoclassID CID_CBigInteger =
+        {{0x7a1ab981,0xac06,0x4343,0x9746,{0xd,0xb,0x1,0x4,0x6,0x8,0x7,0x6,0xd,0x3,0xa,0xc}}, &CID_libcore};
+extern const CoclassID CID_CMathContext =
+        {{0x5542bfb6,0xc4d8,0x4fb2,0xa9b9,{0x9,0x6,0x8,0x3,0xc,0x6,0x1,0xa,0xd,0x1,0x7,0x0}}, &CID_libcore};
+
+} // namespace math
+} // namespace ccm
+
+namespace ccm {
+namespace misc {
+
+
+extern const InterfaceID IID_IFDBigInteger =
+        {{0xc73b8a00,0x75d5,0x4c5b,0xa2e1,{0xc,0xd,0x3,0x4,0xe,0x8,0xc,0x0,0xf,0xb,0x3,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IFloatingDecimalBinaryToASCIIConverter =
+        {{0x6bb0744f,0x9dfe,0x451c,0xa68b,{0x3,0xe,0x2,0xc,0x3,0xb,0xd,0xe,0x5,0xa,0xa,0x3}}, &CID_libcore};
+extern const InterfaceID IID_IFloatingDecimalASCIIToBinaryConverter =
+        {{0x691e4ffb,0x5b88,0x40de,0xae6e,{0x1,0x2,0x0,0x7,0x2,0x6,0x7,0x2,0xf,0xb,0xb,0xc}}, &CID_libcore};
+extern const InterfaceID IID_IFormattedFloatingDecimal =
+        {{0xcbc7370a,0x2d3d,0x4078,0xa719,{0xb,0x0,0x2,0xb,0x8,0x4,0x5,0x6,0x2,0xa,0x7,0x2}}, &CID_libcore};
+extern const InterfaceID IID_ICFDBigIntegerClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CFDBigInteger =
+        {{0xe8cd20cc,0x761f,0x4006,0x9741,{0xf,0xe,0x8,0xc,0xf,0x7,0x0,0x1,0xc,0x0,0x0,0x9}}, &CID_libcore};
+
+} // namespace misc
+} // namespace ccm
+
+namespace ccm {
+namespace security {
+namespace cca {
+
+
+extern const InterfaceID IID_IInstance =
+        {{0x2c685889,0xe192,0x41fe,0x953b,{0x2,0xd,0xb,0xf,0xf,0xc,0x5,0x4,0x2,0x0,0x3,0xa}}, &CID_libcore};
+extern const InterfaceID IID_IInstanceFactory =
+        {{0xb8e28501,0x8a94,0x4767,0xb5e9,{0x6,0x0,0xe,0x6,0x7,0x9,0x3,0xf,0x4,0x9,0xf,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IProviderList =
+        {{0x70795130,0x9314,0x4e18,0xb3a8,{0x4,0x2,0x4,0x1,0x2,0x7,0x8,0xb,0x5,0x7,0x9,0xb}}, &CID_libcore};
+
+} // namespace cca
+} // namespace security
+} // namespace ccm
+
+namespace ccm {
+namespace security {
+namespace action {
+
+
+extern const InterfaceID IID_ICGetPropertyActionClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CGetPropertyAction =
+        {{0xb2412c80,0xec7f,0x46de,0xa4de,{0x6,0xa,0xd,0xe,0x7,0x6,0x5,0x8,0x1,0x4,0xd,0xa}}, &CID_libcore};
+
+} // namespace action
+} // namespace security
+} // namespace ccm
+
+namespace ccm {
+namespace text {
+
+
+
+extern const InterfaceID IID_IAttributedCharacterIterator =
+        {{0x6b6208f7,0xc072,0x4f70,0xb8d9,{0xe,0x2,0x2,0x9,0x6,0x2,0x0,0x2,0x7,0xb,0x5,0x9}}, &CID_libcore};
+extern const InterfaceID IID_IAttributedString =
+        {{0xb3004d6b,0x0223,0x4bcb,0x8b6d,{0x7,0x8,0x2,0x4,0xd,0xe,0x3,0xa,0xe,0xb,0x3,0xa}}, &CID_libcore};
+extern const InterfaceID IID_ICharacterIterator =
+        {{0x42437f78,0x3feb,0x49cb,0x94e4,{0xf,0xa,0x4,0xd,0xd,0x4,0xc,0x7,0xe,0xe,0x6,0x7}}, &CID_libcore};
+extern const InterfaceID IID_IChoiceFormat =
+        {{0x54f82f1f,0x4aaf,0x45b6,0x891d,{0x7,0x7,0x0,0x8,0x3,0xb,0xf,0xf,0x1,0x0,0x5,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IDateFormatField =
+        {{0x09b0ec7d,0x890c,0x4dda,0x80dd,{0xe,0x2,0xc,0x3,0x2,0x8,0x0,0x7,0xe,0xd,0xa,0x6}}, &CID_libcore};
+extern const InterfaceID IID_IDateFormat =
+        {{0x4f4122b6,0x8d1a,0x4454,0xac93,{0x2,0x2,0xe,0x8,0x5,0x8,0xe,0xc,0x2,0x3,0xc,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IDateFormatSymbols =
+        {{0xb2e89609,0x5020,0x4f1a,0xae3b,{0x3,0x4,0x0,0x6,0xc,0x4,0x0,0x2,0x1,0xd,0xa,0x1}}, &CID_libcore};
+extern const InterfaceID IID_IDecimalFormat =
+        {{0xb1615f6c,0xdb57,0x44fd,0xaa14,{0xf,0xd,0x6,0x8,0xd,0xc,0xc,0x5,0x6,0x9,0x9,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IDecimalFormatSymbols =
+        {{0xe7a8ca7c,0x5f0b,0x4d11,0xb50e,{0x2,0x5,0xd,0x3,0x5,0x9,0x3,0x7,0x2,0x0,0xd,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IFieldPosition =
+        {{0xa847451b,0x46f3,0x441e,0xba9f,{0xe,0xd,0x0,0xb,0x3,0x7,0xe,0x5,0xe,0xb,0xf,0xa}}, &CID_libcore};
+extern const InterfaceID IID_IFormatField =
+        {{0xe895ef85,0xdd19,0x4c51,0x849a,{0xf,0x9,0x4,0xb,0x0,0xc,0x2,0x1,0xa,0xe,0x4,0xb}}, &CID_libcore};
+extern const InterfaceID IID_IFormatFieldDelegate =
+        {{0x0579f322,0x5ab7,0x4c43,0x84b5,{0xd,0xb,0xc,0x4,0x3,0x1,0x3,0xd,0xb,0x1,0xf,0xd}}, &CID_libcore};
+extern const InterfaceID IID_IFormat =
+        {{0x3ca986f7,0xad84,0x4023,0x8f5f,{0xb,0x3,0xc,0x8,0x3,0x6,0x2,0x6,0x6,0x0,0x4,0x0}}, &CID_libcore};
+extern const InterfaceID IID_IMessageFormatField =
+        {{0x484a7e85,0x38ac,0x427a,0xb6b6,{0x2,0xe,0xc,0x6,0xe,0x6,0xd,0x5,0x1,0x1,0x7,0x6}}, &CID_libcore};
+extern const InterfaceID IID_IMessageFormat =
+        {{0x207d608f,0x1ca5,0x4ae1,0x8723,{0xb,0x3,0x6,0xe,0x2,0x6,0xf,0x2,0x5,0x0,0x4,0x8}}, &CID_libcore};
+extern const InterfaceID IID_INumberFormatField =
+        {{0xac155c23,0x610f,0x4673,0x9597,{0xe,0x1,0xf,0x1,0x8,0xf,0x8,0x5,0x2,0x8,0x8,0xc}}, &CID_libcore};
+extern const InterfaceID IID_INumberFormat =
+        {{0x69ff7998,0x7fb1,0x4f1b,0x940d,{0x3,0x0,0xa,0xd,0x8,0xd,0x2,0x3,0x3,0x1,0x1,0x3}}, &CID_libcore};
+extern const InterfaceID IID_IParsePosition =
+        {{0x945c1201,0xef77,0x48a8,0x9e96,{0x6,0x7,0x9,0x7,0xd,0x1,0xe,0x4,0x7,0xc,0x1,0xc}}, &CID_libcore};
+extern const InterfaceID IID_ISimpleDateFormat =
+        {{0xe2b13317,0xe567,0x4a78,0x96d1,{0xc,0xa,0xa,0xc,0xf,0xf,0xa,0x8,0x8,0x8,0x1,0x7}}, &CID_libcore};
+extern const InterfaceID IID_ICAttributedStringClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICChoiceFormatClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICDateFormatSymbolsClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICDecimalFormatClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICDecimalFormatSymbolsClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICFieldPositionClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICMessageFormatClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICParsePositionClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICSimpleDateFormatClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CAttributedCharacterIteratorAttribute =
+        {{0x812928e8,0xcbef,0x4bbe,0xa33d,{0x7,0x9,0x2,0x3,0x4,0x1,0xc,0x3,0xd,0x6,0x8,0x1}}, &CID_libcore};
+extern const CoclassID CID_CAttributedString =
+        {{0xd90f0463,0x63bb,0x43dd,0x8ae6,{0x6,0x9,0x1,0x5,0x2,0xb,0x0,0xf,0xc,0xb,0xd,0x1}}, &CID_libcore};
+extern const CoclassID CID_CChoiceFormat =
+        {{0x026a67bd,0x0d05,0x4263,0x8612,{0xb,0x5,0xa,0xc,0xc,0xc,0x4,0x8,0x0,0xe,0xc,0x5}}, &CID_libcore};
+extern const CoclassID CID_CDateFormatField =
+        {{0x43ac1b62,0xc9d8,0x4345,0xa293,{0xf,0x2,0x7,0xc,0xf,0x4,0x9,0x4,0x2,0x7,0xf,0x0}}, &CID_libcore};
+extern const CoclassID CID_CDateFormatSymbols =
+        {{0x352faae6,0x83f5,0x4544,0x81fc,{0x8,0xc,0x7,0xd,0x4,0x4,0xb,0xa,0x3,0x0,0x3,0x8}}, &CID_libcore};
+extern const CoclassID CID_CDecimalFormat =
+        {{0x5eade1e5,0x5963,0x4f1b,0xbfc1,{0x9,0xf,0x1,0xf,0x9,0xa,0xe,0x4,0xb,0x5,0x2,0xf}}, &CID_libcore};
+extern const CoclassID CID_CDecimalFormatSymbols =
+        {{0x81e790a2,0xa790,0x4776,0xb726,{0x8,0x5,0x0,0x2,0xd,0x7,0x2,0x7,0x1,0x0,0x0,0x0}}, &CID_libcore};
+extern const CoclassID CID_CFieldPosition =
+        {{0x6081b56d,0x7a1b,0x4676,0x8122,{0xf,0x2,0x8,0xf,0x2,0xe,0x3,0x1,0x9,0xc,0x4,0x9}}, &CID_libcore};
+extern const CoclassID CID_CMessageFormat =
+        {{0xc74cde6a,0x9a42,0x4772,0x8c23,{0x7,0x6,0x0,0xa,0x8,0x3,0xa,0x6,0x8,0x4,0x2,0x9}}, &CID_libcore};
+extern const CoclassID CID_CParsePosition =
+        {{0x5dd60879,0x0252,0x4319,0xa926,{0x7,0x0,0x5,0x1,0x7,0xa,0x5,0x4,0x8,0x4,0xe,0x1}}, &CID_libcore};
+extern const CoclassID CID_CSimpleDateFormat =
+        {{0xabcdea41,0x9127,0x42d0,0xa5e0,{0xa,0xc,0x4,0xf,0x1,0xb,0xb,0x9,0xd,0x2,0x4,0x9}}, &CID_libcore};
+
+} // namespace text
+} // namespace ccm
+
+namespace ccm {
+namespace text {
+
+const InterfaceID IAttributedCharacterIterator::IID_IAttribute =
+        {{0x09d5b6df,0x58ba,0x4836,0xaea3,{0xc,0x6,0xb,0x9,0x5,0xc,0x4,0x4,0x6,0x4,0x9,0xf}}, &CID_libcore};
+
+} // namespace text
+} // namespace ccm
+namespace ccm {
+namespace util {
+namespace calendar {
+
+
+extern const InterfaceID IID_IBaseCalendarDate =
+        {{0x30757418,0x7756,0x453b,0x9f1f,{0xc,0x8,0x8,0xd,0xe,0x7,0xe,0xf,0x5,0x8,0x3,0xc}}, &CID_libcore};
+extern const InterfaceID IID_IBaseCalendar =
+        {{0x6fcbaf39,0x7d01,0x4928,0x8647,{0x0,0x0,0x2,0xf,0xa,0xd,0xd,0x1,0xc,0x0,0x0,0xd}}, &CID_libcore};
+extern const InterfaceID IID_ICalendarDate =
+        {{0x251aa366,0xdca8,0x48c5,0xb0d7,{0x2,0x7,0xa,0x3,0x3,0x6,0x5,0x7,0xa,0xe,0x7,0x5}}, &CID_libcore};
+extern const InterfaceID IID_ICalendarSystem =
+        {{0x203ce39d,0x2cb3,0x45ec,0xa618,{0x5,0xf,0x6,0x7,0x4,0xa,0x2,0x4,0x9,0x4,0xb,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IEra =
+        {{0x38c2ed16,0x4b95,0x4936,0x8eab,{0xd,0x4,0x1,0x8,0x3,0x6,0x2,0xd,0xd,0x2,0x0,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IGregorian =
+        {{0x3a5186e5,0x3c8f,0x434b,0x909d,{0x0,0x2,0x5,0xd,0xf,0xf,0x3,0x6,0x4,0xf,0x7,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IJulianCalendar =
+        {{0x20fc4e96,0x408a,0x40e6,0x9cbf,{0x0,0x3,0x6,0xc,0xc,0xd,0x1,0x8,0x9,0x3,0x0,0x7}}, &CID_libcore};
+extern const InterfaceID IID_ILocalGregorianCalendar =
+        {{0x56b39c04,0x1748,0x42e8,0x901d,{0x6,0x4,0x4,0x4,0x9,0x2,0x4,0x5,0xf,0x3,0x8,0x9}}, &CID_libcore};
+extern const InterfaceID IID_ICEraClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICLocalGregorianCalendarClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CEra =
+        {{0x40eab8b9,0x84da,0x4399,0xa171,{0xc,0xe,0x2,0x6,0x0,0xa,0x1,0x7,0x2,0x0,0x4,0xa}}, &CID_libcore};
+extern const CoclassID CID_CGregorian =
+        {{0xf726de31,0xd4f4,0x440b,0xb8a5,{0xd,0xf,0xb,0x2,0x5,0xf,0xe,0xa,0x8,0x8,0xd,0x2}}, &CID_libcore};
+extern const CoclassID CID_CJulianCalendar =
+        {{0xd6038b88,0x1454,0x4a8a,0xa17d,{0xd,0xb,0xf,0x1,0x6,0x1,0x5,0x1,0xa,0x3,0x6,0xb}}, &CID_libcore};
+extern const CoclassID CID_CLocalGregorianCalendar =
+        {{0x4b4a5802,0x2e14,0x45cf,0x9894,{0x2,0xc,0x9,0x6,0x4,0x5,0x9,0x7,0x2,0xa,0x5,0xc}}, &CID_libcore};
+
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+
+
+extern const InterfaceID IID_IConcurrentHashMap =
+        {{0x7f68ef50,0xb944,0x403d,0xa1d3,{0x1,0xf,0xe,0x5,0xc,0x8,0x1,0xc,0x0,0x9,0x4,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IConcurrentLinkedQueue =
+        {{0x685b592e,0xda44,0x4fc4,0x96c8,{0x4,0x2,0x5,0x8,0x5,0xd,0x9,0x2,0xd,0x8,0x6,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IConcurrentMap =
+        {{0x5de1af5c,0xb22b,0x4789,0xae3f,{0x9,0xb,0x3,0xa,0x6,0xd,0x1,0xe,0x5,0x7,0x8,0xf}}, &CID_libcore};
+extern const InterfaceID IID_IThreadLocalRandom =
+        {{0x100a074a,0xb631,0x4d9f,0x80a8,{0xf,0x8,0x3,0xc,0x6,0x7,0x6,0x5,0x5,0xf,0x5,0xa}}, &CID_libcore};
+extern const InterfaceID IID_ICConcurrentLinkedQueueClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICConcurrentHashMapClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CConcurrentLinkedQueue =
+        {{0xeb235f4e,0x904f,0x4534,0x97a8,{0xe,0x5,0xa,0x7,0x0,0xc,0xe,0xe,0x8,0x8,0x4,0x6}}, &CID_libcore};
+extern const CoclassID CID_CConcurrentHashMap =
+        {{0x37a99b95,0x311c,0x45b0,0x8033,{0xc,0x6,0xe,0x0,0xa,0xc,0xa,0x4,0xc,0x5,0x0,0x2}}, &CID_libcore};
+
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+namespace concurrent {
+namespace atomic {
+
+
+extern const InterfaceID IID_IAtomicBoolean =
+        {{0x2251febf,0xa611,0x4962,0x9d23,{0xb,0x6,0xe,0x5,0x0,0x5,0xa,0x3,0xd,0x4,0xd,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IAtomicInteger =
+        {{0x5c214cc0,0x991c,0x45a8,0x936b,{0xf,0xe,0x9,0x4,0x0,0xb,0x6,0x6,0x8,0xd,0x5,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IAtomicLong =
+        {{0x991e8db3,0xd281,0x4acc,0x926b,{0xa,0xd,0x1,0xb,0x1,0xe,0x3,0xe,0x2,0x6,0x8,0x8}}, &CID_libcore};
+extern const InterfaceID IID_ICAtomicBooleanClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICAtomicIntegerClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+extern const InterfaceID IID_ICAtomicLongClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CAtomicBoolean =
+        {{0xc3571f5c,0x0aa7,0x4a5c,0x9347,{0xd,0x6,0x4,0x4,0x6,0xc,0x1,0x7,0x5,0x2,0x7,0x1}}, &CID_libcore};
+extern const CoclassID CID_CAtomicInteger =
+        {{0x37e94445,0x0ee6,0x460f,0x9105,{0x4,0xa,0xf,0xe,0xd,0x5,0x9,0xd,0x6,0x5,0x8,0x6}}, &CID_libcore};
+extern const CoclassID CID_CAtomicLong =
+        {{0x067d7bcc,0xd79c,0x43be,0xada6,{0x4,0x5,0x9,0xa,0xd,0xf,0x0,0x4,0x6,0x1,0x9,0xe}}, &CID_libcore};
+
+} // namespace atomic
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+namespace locale {
+
+const String ILanguageTag::PRIVATEUSE("x");
+const String ILanguageTag::PRIVUSE_VARIANT_PREFIX("lvariant");
+const String ILanguageTag::SEP("-");
+const String ILanguageTag::UNDETERMINED("und");
+
+extern const InterfaceID IID_ILanguageTag =
+        {{0x527ad6e7,0xef79,0x4133,0x8fc1,{0xa,0x3,0x8,0xb,0x6,0x1,0x4,0x8,0x2,0x7,0xb,0xa}}, &CID_libcore};
+
+} // namespace locale
+} // namespace util
+} // namespace ccm
+
+namespace ccm {
+namespace util {
+namespace regex {
+
+
+
+extern const InterfaceID IID_IMatcher =
+        {{0x59e2bbf1,0xfc3a,0x4525,0x9eb0,{0xc,0xf,0xa,0x3,0x2,0xd,0x7,0xc,0x7,0x5,0xc,0x7}}, &CID_libcore};
+extern const InterfaceID IID_IMatchResult =
+        {{0x37d33b90,0x45d9,0x4b01,0x88e8,{0x9,0x8,0x2,0xe,0x7,0xe,0x8,0x3,0x0,0xc,0x2,0x1}}, &CID_libcore};
+extern const InterfaceID IID_IPattern =
+        {{0x89258176,0x0af5,0x40ce,0x80bb,{0x0,0xb,0x6,0x6,0x1,0xd,0xd,0xe,0x4,0x0,0xb,0xf}}, &CID_libcore};
+
+} // namespace regex
+} // namespace util
+} // namespace ccm
+
+namespace ccmrt {
+namespace system {
+
+
+extern const InterfaceID IID_IBlockGuardPolicy =
+        {{0x17faccd7,0x40f0,0x43ba,0xa68a,{0xb,0x1,0x2,0x7,0xb,0xf,0x1,0x7,0x5,0x6,0x4,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IBlockGuard =
+        {{0xeca31f7d,0xc4f5,0x4bb4,0xaf3e,{0xc,0x0,0x1,0x5,0xa,0xf,0x2,0x7,0x8,0xc,0x2,0x9}}, &CID_libcore};
+extern const InterfaceID IID_ICloseGuardReporter =
+        {{0xc2d11c90,0xb701,0x4375,0x81aa,{0x8,0x7,0xa,0x5,0xd,0x7,0xc,0x6,0xd,0x3,0xd,0x8}}, &CID_libcore};
+extern const InterfaceID IID_ICloseGuardTracker =
+        {{0x34ef05c4,0x3333,0x4275,0x848c,{0xf,0x3,0x3,0xb,0x0,0xd,0x7,0xd,0x0,0xa,0x5,0x6}}, &CID_libcore};
+extern const InterfaceID IID_ICloseGuard =
+        {{0x40008bce,0x3e40,0x4fe0,0xbfc7,{0xf,0xe,0x3,0xb,0xe,0x7,0x5,0x8,0x5,0x2,0x4,0x6}}, &CID_libcore};
+extern const InterfaceID IID_ISocketTagger =
+        {{0xbcf86319,0x3e1c,0x4c50,0x93cd,{0xd,0xa,0xe,0xa,0x5,0x7,0x9,0x7,0xf,0x2,0x9,0x6}}, &CID_libcore};
+extern const InterfaceID IID_ICPathClassLoaderClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CPathClassLoader =
+        {{0xdfa48353,0x9f1b,0x453d,0xa227,{0x0,0x0,0xf,0x2,0x3,0x9,0x0,0xa,0xb,0xe,0x4,0x4}}, &CID_libcore};
+
+} // namespace system
+} // namespace ccmrt
+
+namespace libcore {
+namespace icu {
+
+
+extern const InterfaceID IID_IICU =
+        {{0xdc68f94d,0x21c9,0x4b4c,0x942d,{0x2,0x7,0x7,0xa,0x0,0x1,0x2,0xa,0x5,0xb,0xc,0x9}}, &CID_libcore};
+extern const InterfaceID IID_ILocaleData =
+        {{0xb3ead832,0x20d3,0x43cd,0x9246,{0x7,0x6,0x5,0x4,0xf,0x4,0x6,0x2,0x6,0xa,0xe,0x4}}, &CID_libcore};
+
+} // namespace icu
+} // namespace libcore
+
+namespace libcore {
+namespace io {
+
+
+extern const InterfaceID IID_IBufferIterator =
+        {{0xc76aba68,0x5070,0x4475,0x9dea,{0x2,0x3,0x2,0x1,0x0,0x6,0xf,0xa,0x2,0x7,0xe,0xa}}, &CID_libcore};
+extern const InterfaceID IID_IoBridge =
+        {{0xe20a68e0,0xd3fa,0x4415,0xba77,{0xb,0x6,0xe,0x6,0x6,0x3,0xf,0x1,0xa,0xc,0x8,0xc}}, &CID_libcore};
+extern const InterfaceID IID_ILibcore =
+        {{0xf3f6610a,0xf7dc,0x40e0,0xa25d,{0xd,0xa,0xa,0x2,0x0,0xe,0x1,0x8,0x2,0x9,0xb,0xf}}, &CID_libcore};
+extern const InterfaceID IID_IMemoryMappedFile =
+        {{0xc3142383,0x5fa7,0x4fe7,0xa98e,{0xc,0x5,0xe,0x5,0xb,0xf,0x3,0x2,0x1,0xc,0x5,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IOs =
+        {{0x4ed1247b,0xe111,0x490f,0x88a9,{0xb,0x5,0xc,0xa,0xa,0x0,0xf,0x4,0xd,0x4,0xb,0xb}}, &CID_libcore};
+extern const InterfaceID IID_ICMemoryMappedFileClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CLibcore =
+        {{0xcfaed610,0x0e3c,0x4e2a,0xa533,{0x2,0xf,0xc,0xc,0xc,0x5,0x0,0xa,0xe,0x5,0x4,0x1}}, &CID_libcore};
+extern const CoclassID CID_CMemoryMappedFile =
+        {{0x4fd4ee55,0x6fc3,0x4dd2,0xaf89,{0xe,0x1,0xa,0x5,0x6,0x0,0xc,0xf,0x7,0x0,0x7,0xc}}, &CID_libcore};
+
+} // namespace io
+} // namespace libcore
+
+namespace pisces {
+namespace system {
+
+
+
+extern const InterfaceID IID_IStructAddrinfo =
+        {{0xbe7dda3e,0x0349,0x4fa0,0x987b,{0xa,0x3,0xa,0xd,0x7,0x2,0xf,0x4,0x2,0x6,0xd,0xf}}, &CID_libcore};
+extern const InterfaceID IID_IStructCapUserData =
+        {{0x08e3c5ea,0xc864,0x4be1,0x9fa7,{0xa,0x2,0xf,0x8,0x6,0xf,0x6,0x1,0x2,0x1,0x8,0xb}}, &CID_libcore};
+extern const InterfaceID IID_IStructCapUserHeader =
+        {{0x5505012a,0xd88d,0x44f9,0xa1fe,{0x7,0xa,0x2,0xd,0x1,0x2,0xe,0x2,0xd,0xf,0xf,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IStructFlock =
+        {{0xfb748f0e,0x2fb2,0x4ff6,0xb346,{0xf,0xe,0x1,0xd,0xe,0xc,0x4,0xa,0x8,0xc,0xf,0x7}}, &CID_libcore};
+extern const InterfaceID IID_IStructGroupReq =
+        {{0x471ca61f,0xf0b8,0x4295,0xbaa7,{0x0,0x0,0x1,0x9,0x9,0xb,0x0,0x4,0xb,0x4,0x7,0x2}}, &CID_libcore};
+extern const InterfaceID IID_IStructGroupSourceReq =
+        {{0xeacfe43a,0x2ee8,0x4a73,0xbe66,{0xd,0xc,0x4,0x7,0xf,0x9,0x5,0x4,0xe,0x8,0x1,0xe}}, &CID_libcore};
+extern const InterfaceID IID_IStructIfaddrs =
+        {{0x7cdd3d82,0xf1c3,0x4baf,0xaa92,{0x0,0x5,0xa,0x4,0x8,0xb,0xb,0xe,0x4,0x0,0x4,0x6}}, &CID_libcore};
+extern const InterfaceID IID_IStructLinger =
+        {{0x8fa6e1d2,0x7213,0x478c,0x91b0,{0x5,0x8,0x6,0xd,0xf,0x0,0x9,0xa,0x4,0xf,0xa,0x9}}, &CID_libcore};
+extern const InterfaceID IID_IStructPasswd =
+        {{0x55bc7374,0xa37a,0x4a69,0xa3a8,{0x4,0xb,0x5,0xe,0x3,0xe,0x9,0x2,0xe,0x2,0xa,0x3}}, &CID_libcore};
+extern const InterfaceID IID_IStructPollfd =
+        {{0xb427cd6b,0x831b,0x49f2,0x846b,{0x0,0xc,0x0,0xb,0xf,0x9,0x9,0xe,0xd,0x6,0x7,0x7}}, &CID_libcore};
+extern const InterfaceID IID_IStructStat =
+        {{0xc5e4c12c,0xe52d,0x44d5,0xbbb3,{0x5,0x5,0xf,0xd,0xa,0x2,0xd,0x9,0xe,0xe,0xa,0x8}}, &CID_libcore};
+extern const InterfaceID IID_IStructStatVfs =
+        {{0x972141c2,0x82c3,0x418f,0xb759,{0xc,0xd,0xe,0xa,0x5,0xf,0x5,0x3,0x0,0xb,0x9,0x5}}, &CID_libcore};
+extern const InterfaceID IID_IStructTimeval =
+        {{0xd6a55e7f,0x280a,0x4229,0x8c28,{0xc,0xd,0xb,0x6,0x0,0x9,0xd,0xc,0x4,0xf,0xe,0xd}}, &CID_libcore};
+extern const InterfaceID IID_IStructUcred =
+        {{0x176d0c7f,0x8e3d,0x42ef,0x96da,{0x1,0xc,0xe,0x3,0x2,0xf,0x1,0x0,0xd,0x1,0x3,0x3}}, &CID_libcore};
+extern const InterfaceID IID_IStructUtsname =
+        {{0x6bed66a8,0x4da9,0x4b24,0x9454,{0xc,0x6,0x4,0xd,0xb,0xa,0x2,0x8,0x0,0x8,0x8,0x9}}, &CID_libcore};
+extern const InterfaceID IID_ICStructStatClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_libcore};
+
+extern const CoclassID CID_CStructStat =
+        {{0x37213cfe,0x2bfc,0x4572,0xb06e,{0xe,0x2,0xf,0xb,0xa,0x3,0x8,0x3,0x7,0xc,0x3,0x6}}, &CID_libcore};
+
+} // namespace system
+} // namespace pisces
+
+namespace libcore {
+namespace util {
+
+const String IZoneInfoDB::TZDATA_FILE("tzdata");
+
+extern const InterfaceID IID_IBasicLruCache =
+        {{0xd37e56e3,0xe7c2,0x43f8,0xbbc1,{0xa,0xe,0xf,0xb,0x3,0x5,0x1,0xb,0xa,0x8,0x6,0x9}}, &CID_libcore};
+extern const InterfaceID IID_IZoneInfo =
+        {{0xb06cc99d,0x8828,0x4e83,0xbb05,{0x3,0xa,0xb,0x0,0x4,0xa,0xc,0x4,0xb,0x7,0x7,0xb}}, &CID_libcore};
+extern const InterfaceID IID_IZoneInfoWallTime =
+        {{0x0b21624c,0x3400,0x44e0,0x84bc,{0xd,0x4,0x4,0xd,0xe,0xa,0x9,0x4,0x0,0xc,0x9,0xb}}, &CID_libcore};
+extern const InterfaceID IID_IZoneInfoDB =
+        {{0xc2f5daa8,0x9f22,0x480b,0x8c63,{0xf,0xb,0x9,0xe,0x7,0x9,0xb,0x7,0x7,0x1,0x9,0xb}}, &CID_libcore};
+extern const InterfaceID IID_IZoneInfoDBTzData =
+        {{0x0ab77469,0x0ac6,0x4ced,0xbbc2,{0x2,0xc,0x7,0xe,0xb,0x0,0x4,0x7,0x8,0xa,0x0,0xe}}, &CID_libcore};
+
+extern const CoclassID CID_CZoneInfoWallTime =
+        {{0xb9bc96e1,0xbabc,0x46c0,0x86f4,{0x7,0x9,0xc,0x9,0x1,0x4,0xe,0x0,0x6,0xe,0xf,0x9}}, &CID_libcore};
+
+} // namespace util
+} // namespace libcore
+
+namespace pisces {
+namespace icu {
+namespace text {
+
+
+extern const InterfaceID IID_ITimeZoneNames =
+        {{0xb1f01233,0x3da2,0x4b26,0xa041,{0x5,0x1,0x9,0x3,0x1,0x7,0x1,0x3,0x7,0xc,0xf,0x7}}, &CID_libcore};
+
+} // namespace text
+} // namespace icu
+} // namespace pisces
+
+namespace ccm {
+namespace core {
+
+extern ECode GetCArrayClassObject(IClassObject** classObject);
+extern void ReleaseCArrayClassObjectCache();
+extern ECode GetCArrayHolderClassObject(IClassObject** classObject);
+extern void ReleaseCArrayHolderClassObjectCache();
+extern ECode GetCSystemClassObject(IClassObject** classObject);
+extern void ReleaseCSystemClassObjectCache();
+extern ECode GetCThreadClassObject(IClassObject** classObject);
+extern void ReleaseCThreadClassObjectCache();
+extern ECode GetCThreadGroupClassObject(IClassObject** classObject);
+extern void ReleaseCThreadGroupClassObjectCache();
+extern ECode GetCThreadLocalClassObject(IClassObject** classObject);
+extern void ReleaseCThreadLocalClassObjectCache();
+extern ECode GetCBooleanClassObject(IClassObject** classObject);
+extern void ReleaseCBooleanClassObjectCache();
+extern ECode GetCByteClassObject(IClassObject** classObject);
+extern void ReleaseCByteClassObjectCache();
+extern ECode GetCCharClassObject(IClassObject** classObject);
+extern void ReleaseCCharClassObjectCache();
+extern ECode GetCDoubleClassObject(IClassObject** classObject);
+extern void ReleaseCDoubleClassObjectCache();
+extern ECode GetCFloatClassObject(IClassObject** classObject);
+extern void ReleaseCFloatClassObjectCache();
+extern ECode GetCIntegerClassObject(IClassObject** classObject);
+extern void ReleaseCIntegerClassObjectCache();
+extern ECode GetCLongClassObject(IClassObject** classObject);
+extern void ReleaseCLongClassObjectCache();
+extern ECode GetCShortClassObject(IClassObject** classObject);
+extern void ReleaseCShortClassObjectCache();
+extern ECode GetCStackTraceClassObject(IClassObject** classObject);
+extern void ReleaseCStackTraceClassObjectCache();
+extern ECode GetCStackTraceElementClassObject(IClassObject** classObject);
+extern void ReleaseCStackTraceElementClassObjectCache();
+extern ECode GetCStringClassObject(IClassObject** classObject);
+extern void ReleaseCStringClassObjectCache();
+extern ECode GetCStringBufferClassObject(IClassObject** classObject);
+extern void ReleaseCStringBufferClassObjectCache();
+extern ECode GetCStringBuilderClassObject(IClassObject** classObject);
+extern void ReleaseCStringBuilderClassObjectCache();
+extern ECode GetCRuntimePermissionClassObject(IClassObject** classObject);
+extern void ReleaseCRuntimePermissionClassObjectCache();
+} // namespace core
+} // namespace ccm
+namespace ccm {
+namespace util {
+
+extern ECode GetCArrayListClassObject(IClassObject** classObject);
+extern void ReleaseCArrayListClassObjectCache();
+extern ECode GetCDateClassObject(IClassObject** classObject);
+extern void ReleaseCDateClassObjectCache();
+extern ECode GetCFormatterClassObject(IClassObject** classObject);
+extern void ReleaseCFormatterClassObjectCache();
+extern ECode GetCGregorianCalendarClassObject(IClassObject** classObject);
+extern void ReleaseCGregorianCalendarClassObjectCache();
+extern ECode GetCHashMapClassObject(IClassObject** classObject);
+extern void ReleaseCHashMapClassObjectCache();
+extern ECode GetCHashSetClassObject(IClassObject** classObject);
+extern void ReleaseCHashSetClassObjectCache();
+extern ECode GetCHashtableClassObject(IClassObject** classObject);
+extern void ReleaseCHashtableClassObjectCache();
+extern ECode GetCLinkedHashMapClassObject(IClassObject** classObject);
+extern void ReleaseCLinkedHashMapClassObjectCache();
+extern ECode GetCLinkedHashSetClassObject(IClassObject** classObject);
+extern void ReleaseCLinkedHashSetClassObjectCache();
+extern ECode GetCLinkedListClassObject(IClassObject** classObject);
+extern void ReleaseCLinkedListClassObjectCache();
+extern ECode GetCLocaleClassObject(IClassObject** classObject);
+extern void ReleaseCLocaleClassObjectCache();
+extern ECode GetCLocaleBuilderClassObject(IClassObject** classObject);
+extern void ReleaseCLocaleBuilderClassObjectCache();
+extern ECode GetCPropertiesClassObject(IClassObject** classObject);
+extern void ReleaseCPropertiesClassObjectCache();
+extern ECode GetCPropertyPermissionClassObject(IClassObject** classObject);
+extern void ReleaseCPropertyPermissionClassObjectCache();
+extern ECode GetCRandomClassObject(IClassObject** classObject);
+extern void ReleaseCRandomClassObjectCache();
+extern ECode GetCSimpleEntryClassObject(IClassObject** classObject);
+extern void ReleaseCSimpleEntryClassObjectCache();
+extern ECode GetCSimpleImmutableEntryClassObject(IClassObject** classObject);
+extern void ReleaseCSimpleImmutableEntryClassObjectCache();
+extern ECode GetCSimpleTimeZoneClassObject(IClassObject** classObject);
+extern void ReleaseCSimpleTimeZoneClassObjectCache();
+extern ECode GetCStringTokenizerClassObject(IClassObject** classObject);
+extern void ReleaseCStringTokenizerClassObjectCache();
+extern ECode GetCTreeMapClassObject(IClassObject** classObject);
+extern void ReleaseCTreeMapClassObjectCache();
+extern ECode GetCTreeSetClassObject(IClassObject** classObject);
+extern void ReleaseCTreeSetClassObjectCache();
+extern ECode GetCVectorClassObject(IClassObject** classObject);
+extern void ReleaseCVectorClassObjectCache();
+} // namespace util
+} // namespace ccm
+namespace ccm {
+namespace io {
+
+extern ECode GetCBufferedWriterClassObject(IClassObject** classObject);
+extern void ReleaseCBufferedWriterClassObjectCache();
+extern ECode GetCByteArrayOutputStreamClassObject(IClassObject** classObject);
+extern void ReleaseCByteArrayOutputStreamClassObjectCache();
+extern ECode GetCDirectByteBufferClassObject(IClassObject** classObject);
+extern void ReleaseCDirectByteBufferClassObjectCache();
+extern ECode GetCFileClassObject(IClassObject** classObject);
+extern void ReleaseCFileClassObjectCache();
+extern ECode GetCFileDescriptorClassObject(IClassObject** classObject);
+extern void ReleaseCFileDescriptorClassObjectCache();
+extern ECode GetCFileInputStreamClassObject(IClassObject** classObject);
+extern void ReleaseCFileInputStreamClassObjectCache();
+extern ECode GetCFileOutputStreamClassObject(IClassObject** classObject);
+extern void ReleaseCFileOutputStreamClassObjectCache();
+extern ECode GetCOutputStreamWriterClassObject(IClassObject** classObject);
+extern void ReleaseCOutputStreamWriterClassObjectCache();
+extern ECode GetCPrintWriterClassObject(IClassObject** classObject);
+extern void ReleaseCPrintWriterClassObjectCache();
+extern ECode GetCStringWriterClassObject(IClassObject** classObject);
+extern void ReleaseCStringWriterClassObjectCache();
+} // namespace io
+} // namespace ccm
+namespace ccm {
+namespace security {
+
+extern ECode GetCPermissionsClassObject(IClassObject** classObject);
+extern void ReleaseCPermissionsClassObjectCache();
+extern ECode GetCSecureRandomClassObject(IClassObject** classObject);
+extern void ReleaseCSecureRandomClassObjectCache();
+} // namespace security
+} // namespace ccm
+namespace ccm {
+namespace math {
+
+extern ECode GetCBigDecimalClassObject(IClassObject** classObject);
+extern void ReleaseCBigDecimalClassObjectCache();
+extern ECode GetCBigIntegerClassObject(IClassObject** classObject);
+extern void ReleaseCBigIntegerClassObjectCache();
+extern ECode GetCMathContextClassObject(IClassObject** classObject);
+extern void ReleaseCMathContextClassObjectCache();
+} // namespace math
+} // namespace ccm
+namespace ccm {
+namespace misc {
+
+extern ECode GetCFDBigIntegerClassObject(IClassObject** classObject);
+extern void ReleaseCFDBigIntegerClassObjectCache();
+} // namespace misc
+} // namespace ccm
+namespace ccm {
+namespace security {
+namespace action {
+
+extern ECode GetCGetPropertyActionClassObject(IClassObject** classObject);
+extern void ReleaseCGetPropertyActionClassObjectCache();
+} // namespace action
+} // namespace security
+} // namespace ccm
+namespace ccm {
+namespace text {
+
+extern ECode GetCAttributedCharacterIteratorAttributeClassObject(IClassObject** classObject);
+extern void ReleaseCAttributedCharacterIteratorAttributeClassObjectCache();
+extern ECode GetCAttributedStringClassObject(IClassObject** classObject);
+extern void ReleaseCAttributedStringClassObjectCache();
+extern ECode GetCChoiceFormatClassObject(IClassObject** classObject);
+extern void ReleaseCChoiceFormatClassObjectCache();
+extern ECode GetCDateFormatFieldClassObject(IClassObject** classObject);
+extern void ReleaseCDateFormatFieldClassObjectCache();
+extern ECode GetCDateFormatSymbolsClassObject(IClassObject** classObject);
+extern void ReleaseCDateFormatSymbolsClassObjectCache();
+extern ECode GetCDecimalFormatClassObject(IClassObject** classObject);
+extern void ReleaseCDecimalFormatClassObjectCache();
+extern ECode GetCDecimalFormatSymbolsClassObject(IClassObject** classObject);
+extern void ReleaseCDecimalFormatSymbolsClassObjectCache();
+extern ECode GetCFieldPositionClassObject(IClassObject** classObject);
+extern void ReleaseCFieldPositionClassObjectCache();
+extern ECode GetCMessageFormatClassObject(IClassObject** classObject);
+extern void ReleaseCMessageFormatClassObjectCache();
+extern ECode GetCParsePositionClassObject(IClassObject** classObject);
+extern void ReleaseCParsePositionClassObjectCache();
+extern ECode GetCSimpleDateFormatClassObject(IClassObject** classObject);
+extern void ReleaseCSimpleDateFormatClassObjectCache();
+} // namespace text
+} // namespace ccm
+namespace ccm {
+namespace util {
+namespace calendar {
+
+extern ECode GetCEraClassObject(IClassObject** classObject);
+extern void ReleaseCEraClassObjectCache();
+extern ECode GetCGregorianClassObject(IClassObject** classObject);
+extern void ReleaseCGregorianClassObjectCache();
+extern ECode GetCJulianCalendarClassObject(IClassObject** classObject);
+extern void ReleaseCJulianCalendarClassObjectCache();
+extern ECode GetCLocalGregorianCalendarClassObject(IClassObject** classObject);
+extern void ReleaseCLocalGregorianCalendarClassObjectCache();
+} // namespace calendar
+} // namespace util
+} // namespace ccm
+namespace ccm {
+namespace util {
+namespace concurrent {
+
+extern ECode GetCConcurrentLinkedQueueClassObject(IClassObject** classObject);
+extern void ReleaseCConcurrentLinkedQueueClassObjectCache();
+extern ECode GetCConcurrentHashMapClassObject(IClassObject** classObject);
+extern void ReleaseCConcurrentHashMapClassObjectCache();
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+namespace ccm {
+namespace util {
+namespace concurrent {
+namespace atomic {
+
+extern ECode GetCAtomicBooleanClassObject(IClassObject** classObject);
+extern void ReleaseCAtomicBooleanClassObjectCache();
+extern ECode GetCAtomicIntegerClassObject(IClassObject** classObject);
+extern void ReleaseCAtomicIntegerClassObjectCache();
+extern ECode GetCAtomicLongClassObject(IClassObject** classObject);
+extern void ReleaseCAtomicLongClassObjectCache();
+} // namespace atomic
+} // namespace concurrent
+} // namespace util
+} // namespace ccm
+namespace ccmrt {
+namespace system {
+
+extern ECode GetCPathClassLoaderClassObject(IClassObject** classObject);
+extern void ReleaseCPathClassLoaderClassObjectCache();
+} // namespace system
+} // namespace ccmrt
+namespace libcore {
+namespace io {
+
+extern ECode GetCLibcoreClassObject(IClassObject** classObject);
+extern void ReleaseCLibcoreClassObjectCache();
+extern ECode GetCMemoryMappedFileClassObject(IClassObject** classObject);
+extern void ReleaseCMemoryMappedFileClassObjectCache();
+} // namespace io
+} // namespace libcore
+namespace pisces {
+namespace system {
+
+extern ECode GetCStructStatClassObject(IClassObject** classObject);
+extern void ReleaseCStructStatClassObjectCache();
+} // namespace system
+} // namespace pisces
+namespace libcore {
+namespace util {
+
+extern ECode GetCZoneInfoWallTimeClassObject(IClassObject** classObject);
+extern void ReleaseCZoneInfoWallTimeClassObjectCache();
+} // namespace util
+} // namespace libcore
+
+static ClassObjectGetter colibcoreGetters[84] = {
+        {{0xbc5be123,0x34ab,0x4373,0xab98,{0x3,0x1,0xc,0x3,0xe,0x3,0xc,0x6,0x8,0xb,0x1,0xb}}, ccm::core::GetCArrayClassObject},
+        {{0xf608b0cd,0xd0af,0x4adb,0xa2a4,{0x6,0xf,0x2,0x4,0x1,0x1,0x3,0x6,0xb,0x9,0x9,0x2}}, ccm::core::GetCArrayHolderClassObject},
+        {{0x6cdec0e6,0xee66,0x4ba3,0xb167,{0xe,0x8,0xd,0x4,0x5,0xe,0x0,0x2,0x9,0xf,0xb,0xd}}, ccm::core::GetCSystemClassObject},
+        {{0x339a8069,0x7448,0x4d12,0x9c50,{0xd,0x4,0x5,0x4,0x9,0x7,0xf,0xb,0x2,0x4,0x5,0xb}}, ccm::core::GetCThreadClassObject},
+        {{0x730c7375,0x05c3,0x4b86,0x933c,{0xa,0xb,0x2,0x8,0x0,0x8,0x1,0x6,0x4,0x2,0x8,0x0}}, ccm::core::GetCThreadGroupClassObject},
+        {{0xdce1a0c3,0xb23d,0x4b89,0xbdaf,{0x8,0xa,0x1,0xb,0xf,0x5,0x8,0x1,0xe,0xe,0x4,0x4}}, ccm::core::GetCThreadLocalClassObject},
+        {{0xcf7b3ffb,0x46ce,0x44fc,0x9057,{0xd,0x8,0xe,0xc,0x0,0x3,0xc,0x8,0x2,0x0,0xb,0x7}}, ccm::io::GetCBufferedWriterClassObject},
+        {{0x69455e4d,0x56b1,0x43b1,0x98b1,{0xe,0x4,0x9,0x0,0x7,0xe,0x3,0x3,0x2,0xa,0x4,0xf}}, ccm::io::GetCByteArrayOutputStreamClassObject},
+        {{0x160997fd,0x1165,0x46dd,0xa47a,{0x8,0xa,0x0,0x0,0x0,0xb,0xc,0xd,0x1,0x9,0x1,0x6}}, ccm::io::GetCDirectByteBufferClassObject},
+        {{0x0d9c5571,0x7eaa,0x44e1,0x815f,{0xc,0x6,0xa,0xf,0x4,0x2,0x1,0xc,0x7,0x8,0x0,0xd}}, ccm::io::GetCFileClassObject},
+        {{0x3e291dd3,0x0c31,0x4526,0x8ef9,{0xf,0xe,0x6,0x1,0xb,0xc,0x1,0xe,0x5,0x0,0x8,0xe}}, ccm::io::GetCFileDescriptorClassObject},
+        {{0x28063bc3,0x48b2,0x43f4,0xb159,{0xc,0x4,0xc,0x6,0x5,0x4,0x7,0x5,0xb,0x8,0x4,0x4}}, ccm::io::GetCFileInputStreamClassObject},
+        {{0x6d5f9b98,0xce5c,0x4e30,0xa5ca,{0xc,0x0,0xc,0x7,0x4,0xe,0x0,0xd,0xc,0x8,0xf,0xd}}, ccm::io::GetCFileOutputStreamClassObject},
+        {{0x3f1442a5,0xce76,0x40b3,0x8889,{0xc,0x9,0x4,0x3,0x1,0xc,0x8,0x1,0x0,0xc,0x1,0xd}}, ccm::io::GetCOutputStreamWriterClassObject},
+        {{0x5de87670,0xf240,0x43cd,0xb06d,{0xa,0x7,0x5,0x8,0xb,0x4,0x9,0x1,0x4,0xe,0x7,0x6}}, ccm::io::GetCPrintWriterClassObject},
+        {{0x2a886435,0x1ec8,0x4311,0xbe20,{0x0,0x3,0xc,0xf,0xf,0x4,0x5,0xb,0x0,0xd,0xc,0x8}}, ccm::io::GetCStringWriterClassObject},
+        {{0xdf471c09,0x381f,0x40c4,0x9e24,{0xc,0x9,0x2,0xb,0x3,0x1,0xd,0xd,0x9,0x1,0x4,0x6}}, ccm::core::GetCBooleanClassObject},
+        {{0xbdf665c0,0x8a7a,0x4621,0xba55,{0xe,0x6,0xa,0x0,0x9,0x7,0xd,0xf,0xc,0x8,0x5,0xd}}, ccm::core::GetCByteClassObject},
+        {{0xf30fd610,0xee65,0x4fc0,0x8191,{0xe,0x8,0x4,0x0,0xc,0x7,0xf,0x7,0x3,0x1,0x2,0x5}}, ccm::core::GetCCharClassObject},
+        {{0x38abe6d2,0x1428,0x4a97,0x8177,{0xb,0x2,0x4,0xd,0x0,0x9,0x5,0x9,0x3,0xd,0x1,0x5}}, ccm::core::GetCDoubleClassObject},
+        {{0x569b10e8,0x38d5,0x41f6,0xa89a,{0x3,0x6,0xf,0xc,0xd,0xe,0x4,0x4,0x9,0x4,0x1,0x3}}, ccm::core::GetCFloatClassObject},
+        {{0x55469170,0xd13e,0x4567,0x9435,{0x3,0xb,0xf,0x4,0xc,0x5,0xe,0xb,0xf,0x1,0xe,0x4}}, ccm::core::GetCIntegerClassObject},
+        {{0xbc8830e2,0x23f7,0x4a25,0xb61e,{0xd,0xb,0xc,0x9,0xc,0xc,0xe,0x3,0x8,0x5,0xb,0x2}}, ccm::core::GetCLongClassObject},
+        {{0xcdff023b,0xba1b,0x4e14,0xbf1b,{0x8,0xe,0xb,0xf,0x9,0xf,0xe,0x8,0x0,0x2,0x1,0x4}}, ccm::core::GetCShortClassObject},
+        {{0x16a75841,0xffee,0x43a5,0xbd5c,{0x4,0xf,0x8,0x3,0x6,0x2,0x3,0x6,0x1,0xb,0x3,0x5}}, ccm::core::GetCStackTraceClassObject},
+        {{0xc2fee305,0xa2bb,0x453a,0x9248,{0x4,0x7,0x3,0xb,0xb,0xe,0xf,0x5,0x5,0xf,0xd,0x0}}, ccm::core::GetCStackTraceElementClassObject},
+        {{0x10e6419e,0xb8d0,0x44be,0xb309,{0x5,0x4,0x0,0x8,0x6,0xe,0xb,0x3,0xe,0x5,0x6,0x0}}, ccm::core::GetCStringClassObject},
+        {{0x8c3a55f1,0x63c5,0x4abd,0xb68c,{0x4,0x6,0x7,0x7,0x3,0x8,0x7,0x7,0xa,0x6,0x5,0x5}}, ccm::core::GetCStringBufferClassObject},
+        {{0xcbc6b55a,0xc06e,0x4ddc,0xb7f8,{0xf,0x0,0xc,0xc,0x0,0xb,0xf,0x9,0x4,0xf,0xf,0x9}}, ccm::core::GetCStringBuilderClassObject},
+        {{0xc0f44da4,0x575b,0x44e6,0xb234,{0x2,0x2,0x0,0x8,0xa,0x2,0x8,0x5,0x8,0x2,0xa,0xe}}, ccm::math::GetCBigDecimalClassObject},
+        {{0x7a1ab981,0xac06,0x4343,0x9746,{0xd,0xb,0x1,0x4,0x6,0x8,0x7,0x6,0xd,0x3,0xa,0xc}}, ccm::math::GetCBigIntegerClassObject},
+        {{0x5542bfb6,0xc4d8,0x4fb2,0xa9b9,{0x9,0x6,0x8,0x3,0xc,0x6,0x1,0xa,0xd,0x1,0x7,0x0}}, ccm::math::GetCMathContextClassObject},
+        {{0xe8cd20cc,0x761f,0x4006,0x9741,{0xf,0xe,0x8,0xc,0xf,0x7,0x0,0x1,0xc,0x0,0x0,0x9}}, ccm::misc::GetCFDBigIntegerClassObject},
+        {{0xc9a89c69,0x63a6,0x4636,0xb77a,{0x9,0x7,0xc,0x8,0x3,0xb,0xa,0x3,0x8,0x0,0xe,0xe}}, ccm::security::GetCPermissionsClassObject},
+        {{0x16dff384,0x5829,0x41c6,0x9b2e,{0x7,0x1,0xd,0x3,0xc,0xc,0xd,0x7,0xb,0xd,0x9,0x7}}, ccm::security::GetCSecureRandomClassObject},
+        {{0xb2412c80,0xec7f,0x46de,0xa4de,{0x6,0xa,0xd,0xe,0x7,0x6,0x5,0x8,0x1,0x4,0xd,0xa}}, ccm::security::action::GetCGetPropertyActionClassObject},
+        {{0x106e254e,0x0909,0x4238,0x8db4,{0x2,0xe,0x3,0x4,0x3,0x7,0x1,0x5,0xc,0x9,0xa,0xd}}, ccm::core::GetCRuntimePermissionClassObject},
+        {{0x812928e8,0xcbef,0x4bbe,0xa33d,{0x7,0x9,0x2,0x3,0x4,0x1,0xc,0x3,0xd,0x6,0x8,0x1}}, ccm::text::GetCAttributedCharacterIteratorAttributeClassObject},
+        {{0xd90f0463,0x63bb,0x43dd,0x8ae6,{0x6,0x9,0x1,0x5,0x2,0xb,0x0,0xf,0xc,0xb,0xd,0x1}}, ccm::text::GetCAttributedStringClassObject},
+        {{0x026a67bd,0x0d05,0x4263,0x8612,{0xb,0x5,0xa,0xc,0xc,0xc,0x4,0x8,0x0,0xe,0xc,0x5}}, ccm::text::GetCChoiceFormatClassObject},
+        {{0x43ac1b62,0xc9d8,0x4345,0xa293,{0xf,0x2,0x7,0xc,0xf,0x4,0x9,0x4,0x2,0x7,0xf,0x0}}, ccm::text::GetCDateFormatFieldClassObject},
+        {{0x352faae6,0x83f5,0x4544,0x81fc,{0x8,0xc,0x7,0xd,0x4,0x4,0xb,0xa,0x3,0x0,0x3,0x8}}, ccm::text::GetCDateFormatSymbolsClassObject},
+        {{0x5eade1e5,0x5963,0x4f1b,0xbfc1,{0x9,0xf,0x1,0xf,0x9,0xa,0xe,0x4,0xb,0x5,0x2,0xf}}, ccm::text::GetCDecimalFormatClassObject},
+        {{0x81e790a2,0xa790,0x4776,0xb726,{0x8,0x5,0x0,0x2,0xd,0x7,0x2,0x7,0x1,0x0,0x0,0x0}}, ccm::text::GetCDecimalFormatSymbolsClassObject},
+        {{0x6081b56d,0x7a1b,0x4676,0x8122,{0xf,0x2,0x8,0xf,0x2,0xe,0x3,0x1,0x9,0xc,0x4,0x9}}, ccm::text::GetCFieldPositionClassObject},
+        {{0xc74cde6a,0x9a42,0x4772,0x8c23,{0x7,0x6,0x0,0xa,0x8,0x3,0xa,0x6,0x8,0x4,0x2,0x9}}, ccm::text::GetCMessageFormatClassObject},
+        {{0x5dd60879,0x0252,0x4319,0xa926,{0x7,0x0,0x5,0x1,0x7,0xa,0x5,0x4,0x8,0x4,0xe,0x1}}, ccm::text::GetCParsePositionClassObject},
+        {{0xabcdea41,0x9127,0x42d0,0xa5e0,{0xa,0xc,0x4,0xf,0x1,0xb,0xb,0x9,0xd,0x2,0x4,0x9}}, ccm::text::GetCSimpleDateFormatClassObject},
+        {{0x7dbd4e0a,0x4bf2,0x4ccb,0xa4e9,{0xb,0xf,0xe,0x2,0x3,0x2,0xb,0x4,0x0,0xb,0xa,0x4}}, ccm::util::GetCArrayListClassObject},
+        {{0x57b9bd7b,0xd0d5,0x42c5,0x9784,{0x2,0x0,0x2,0x6,0x1,0x4,0x5,0x1,0x7,0xa,0x4,0xf}}, ccm::util::GetCDateClassObject},
+        {{0xca21100d,0x664d,0x4cf1,0xaf77,{0x4,0x8,0xc,0x2,0x5,0x2,0xd,0xe,0xf,0x9,0xa,0x2}}, ccm::util::GetCFormatterClassObject},
+        {{0xe3a4ed7a,0xc706,0x4a8a,0x9116,{0x2,0xc,0x9,0xf,0xc,0xf,0xe,0x9,0x7,0xa,0x2,0x5}}, ccm::util::GetCGregorianCalendarClassObject},
+        {{0xafe87a5a,0x0e0b,0x4c33,0x975e,{0x2,0xe,0xc,0x5,0xc,0xa,0xa,0x6,0x0,0xa,0xf,0xc}}, ccm::util::GetCHashMapClassObject},
+        {{0x3b1f6a9d,0x3d2b,0x43ab,0xb61f,{0xc,0xa,0xa,0x7,0x6,0x6,0xe,0x8,0x4,0x3,0x0,0x3}}, ccm::util::GetCHashSetClassObject},
+        {{0x10c87f0c,0x91e6,0x4fa1,0x905e,{0x8,0xc,0xe,0x9,0xf,0x5,0x1,0x3,0x3,0x1,0x8,0xf}}, ccm::util::GetCHashtableClassObject},
+        {{0x737c1ff9,0xc4b3,0x4d55,0xa67f,{0x1,0x6,0x0,0xa,0x4,0x1,0x1,0xd,0x2,0x8,0x9,0xb}}, ccm::util::GetCLinkedHashMapClassObject},
+        {{0x2a5b0a37,0x7877,0x4ee5,0x9b3a,{0x4,0x3,0x9,0x5,0x3,0x8,0xf,0x7,0x0,0x3,0x5,0x4}}, ccm::util::GetCLinkedHashSetClassObject},
+        {{0x60934bce,0x6b73,0x44c8,0xbff3,{0x5,0x0,0x9,0x1,0x6,0x2,0x7,0x5,0xd,0xb,0x2,0x3}}, ccm::util::GetCLinkedListClassObject},
+        {{0xd64e331d,0x41f4,0x40b1,0xb71b,{0x7,0x4,0x9,0x2,0xf,0xf,0xc,0x7,0xf,0x5,0xb,0x2}}, ccm::util::GetCLocaleClassObject},
+        {{0x755282d7,0x1444,0x44e3,0xbe80,{0x6,0x2,0x6,0x0,0x5,0x0,0x8,0x8,0x7,0x5,0xd,0x3}}, ccm::util::GetCLocaleBuilderClassObject},
+        {{0x2f6a7390,0x6aed,0x4f7d,0x863e,{0x3,0xf,0x0,0x0,0x7,0x6,0x3,0x5,0xb,0xa,0x1,0x4}}, ccm::util::GetCPropertiesClassObject},
+        {{0x0ce2245f,0xc9d7,0x4a24,0x8fda,{0x5,0x6,0xa,0xb,0x5,0xd,0x3,0x8,0xe,0xa,0x1,0x8}}, ccm::util::GetCPropertyPermissionClassObject},
+        {{0x1d590d6f,0x70ee,0x497a,0xb8a9,{0xe,0x9,0x9,0x2,0x1,0x2,0xe,0x0,0x4,0xf,0x5,0x3}}, ccm::util::GetCRandomClassObject},
+        {{0x4a6bdbee,0xa9dc,0x4269,0xb4dc,{0xb,0x1,0x8,0xd,0xf,0x8,0x0,0xf,0xd,0x8,0xa,0x2}}, ccm::util::GetCSimpleEntryClassObject},
+        {{0x0546ef75,0x6292,0x4d8d,0xa227,{0x5,0xe,0x5,0x3,0xf,0x1,0x1,0x4,0x1,0x9,0xa,0xe}}, ccm::util::GetCSimpleImmutableEntryClassObject},
+        {{0x23da10ba,0x6998,0x4274,0x9e3e,{0xf,0x4,0x4,0xb,0xf,0xb,0xe,0xa,0xf,0x2,0x7,0xb}}, ccm::util::GetCSimpleTimeZoneClassObject},
+        {{0x6858c0ba,0xe3a0,0x48fd,0x8f22,{0xb,0xb,0xd,0xc,0x4,0x5,0x0,0x3,0xd,0x8,0x3,0xd}}, ccm::util::GetCStringTokenizerClassObject},
+        {{0x3ef0ae4d,0xd83b,0x453f,0xaeee,{0x6,0x4,0x6,0xd,0x8,0x4,0xb,0x7,0x5,0x3,0x8,0xb}}, ccm::util::GetCTreeMapClassObject},
+        {{0x22c0eedd,0xc096,0x4a9e,0xbe93,{0x0,0xb,0x9,0xe,0x6,0x2,0x6,0x1,0xf,0xd,0x3,0x9}}, ccm::util::GetCTreeSetClassObject},
+        {{0xa2ff11fd,0xca23,0x4c88,0xb8c9,{0x3,0x8,0x0,0x2,0xa,0xb,0x8,0x9,0x3,0x5,0xd,0xe}}, ccm::util::GetCVectorClassObject},
+        {{0x40eab8b9,0x84da,0x4399,0xa171,{0xc,0xe,0x2,0x6,0x0,0xa,0x1,0x7,0x2,0x0,0x4,0xa}}, ccm::util::calendar::GetCEraClassObject},
+        {{0xf726de31,0xd4f4,0x440b,0xb8a5,{0xd,0xf,0xb,0x2,0x5,0xf,0xe,0xa,0x8,0x8,0xd,0x2}}, ccm::util::calendar::GetCGregorianClassObject},
+        {{0xd6038b88,0x1454,0x4a8a,0xa17d,{0xd,0xb,0xf,0x1,0x6,0x1,0x5,0x1,0xa,0x3,0x6,0xb}}, ccm::util::calendar::GetCJulianCalendarClassObject},
+        {{0x4b4a5802,0x2e14,0x45cf,0x9894,{0x2,0xc,0x9,0x6,0x4,0x5,0x9,0x7,0x2,0xa,0x5,0xc}}, ccm::util::calendar::GetCLocalGregorianCalendarClassObject},
+        {{0xeb235f4e,0x904f,0x4534,0x97a8,{0xe,0x5,0xa,0x7,0x0,0xc,0xe,0xe,0x8,0x8,0x4,0x6}}, ccm::util::concurrent::GetCConcurrentLinkedQueueClassObject},
+        {{0x37a99b95,0x311c,0x45b0,0x8033,{0xc,0x6,0xe,0x0,0xa,0xc,0xa,0x4,0xc,0x5,0x0,0x2}}, ccm::util::concurrent::GetCConcurrentHashMapClassObject},
+        {{0xc3571f5c,0x0aa7,0x4a5c,0x9347,{0xd,0x6,0x4,0x4,0x6,0xc,0x1,0x7,0x5,0x2,0x7,0x1}}, ccm::util::concurrent::atomic::GetCAtomicBooleanClassObject},
+        {{0x37e94445,0x0ee6,0x460f,0x9105,{0x4,0xa,0xf,0xe,0xd,0x5,0x9,0xd,0x6,0x5,0x8,0x6}}, ccm::util::concurrent::atomic::GetCAtomicIntegerClassObject},
+        {{0x067d7bcc,0xd79c,0x43be,0xada6,{0x4,0x5,0x9,0xa,0xd,0xf,0x0,0x4,0x6,0x1,0x9,0xe}}, ccm::util::concurrent::atomic::GetCAtomicLongClassObject},
+        {{0xdfa48353,0x9f1b,0x453d,0xa227,{0x0,0x0,0xf,0x2,0x3,0x9,0x0,0xa,0xb,0xe,0x4,0x4}}, ccmrt::system::GetCPathClassLoaderClassObject},
+        {{0xcfaed610,0x0e3c,0x4e2a,0xa533,{0x2,0xf,0xc,0xc,0xc,0x5,0x0,0xa,0xe,0x5,0x4,0x1}}, libcore::io::GetCLibcoreClassObject},
+        {{0x4fd4ee55,0x6fc3,0x4dd2,0xaf89,{0xe,0x1,0xa,0x5,0x6,0x0,0xc,0xf,0x7,0x0,0x7,0xc}}, libcore::io::GetCMemoryMappedFileClassObject},
+        {{0xb9bc96e1,0xbabc,0x46c0,0x86f4,{0x7,0x9,0xc,0x9,0x1,0x4,0xe,0x0,0x6,0xe,0xf,0x9}}, libcore::util::GetCZoneInfoWallTimeClassObject},
+        {{0x37213cfe,0x2bfc,0x4572,0xb06e,{0xe,0x2,0xf,0xb,0xa,0x3,0x8,0x3,0x7,0xc,0x3,0x6}}, pisces::system::GetCStructStatClassObject}};
+
+EXTERN_C COM_PUBLIC ClassObjectGetter* soGetAllClassObjects(int* size)
+{
+    *size = sizeof(colibcoreGetters) / sizeof(ClassObjectGetter);
+    return colibcoreGetters;
+}
+
+EXTERN_C COM_PUBLIC ECode soGetClassObject(const CoclassID& cid, IClassObject** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    if (ccm::core::CID_CArray == cid) {
+        return ccm::core::GetCArrayClassObject(object);
+    }
+    else if (ccm::core::CID_CArrayHolder == cid) {
+        return ccm::core::GetCArrayHolderClassObject(object);
+    }
+    else if (ccm::core::CID_CSystem == cid) {
+        return ccm::core::GetCSystemClassObject(object);
+    }
+    else if (ccm::core::CID_CThread == cid) {
+        return ccm::core::GetCThreadClassObject(object);
+    }
+    else if (ccm::core::CID_CThreadGroup == cid) {
+        return ccm::core::GetCThreadGroupClassObject(object);
+    }
+    else if (ccm::core::CID_CThreadLocal == cid) {
+        return ccm::core::GetCThreadLocalClassObject(object);
+    }
+    else if (ccm::io::CID_CBufferedWriter == cid) {
+        return ccm::io::GetCBufferedWriterClassObject(object);
+    }
+    else if (ccm::io::CID_CByteArrayOutputStream == cid) {
+        return ccm::io::GetCByteArrayOutputStreamClassObject(object);
+    }
+    else if (ccm::io::CID_CDirectByteBuffer == cid) {
+        return ccm::io::GetCDirectByteBufferClassObject(object);
+    }
+    else if (ccm::io::CID_CFile == cid) {
+        return ccm::io::GetCFileClassObject(object);
+    }
+    else if (ccm::io::CID_CFileDescriptor == cid) {
+        return ccm::io::GetCFileDescriptorClassObject(object);
+    }
+    else if (ccm::io::CID_CFileInputStream == cid) {
+        return ccm::io::GetCFileInputStreamClassObject(object);
+    }
+    else if (ccm::io::CID_CFileOutputStream == cid) {
+        return ccm::io::GetCFileOutputStreamClassObject(object);
+    }
+    else if (ccm::io::CID_COutputStreamWriter == cid) {
+        return ccm::io::GetCOutputStreamWriterClassObject(object);
+    }
+    else if (ccm::io::CID_CPrintWriter == cid) {
+        return ccm::io::GetCPrintWriterClassObject(object);
+    }
+    else if (ccm::io::CID_CStringWriter == cid) {
+        return ccm::io::GetCStringWriterClassObject(object);
+    }
+    else if (ccm::core::CID_CBoolean == cid) {
+        return ccm::core::GetCBooleanClassObject(object);
+    }
+    else if (ccm::core::CID_CByte == cid) {
+        return ccm::core::GetCByteClassObject(object);
+    }
+    else if (ccm::core::CID_CChar == cid) {
+        return ccm::core::GetCCharClassObject(object);
+    }
+    else if (ccm::core::CID_CDouble == cid) {
+        return ccm::core::GetCDoubleClassObject(object);
+    }
+    else if (ccm::core::CID_CFloat == cid) {
+        return ccm::core::GetCFloatClassObject(object);
+    }
+    else if (ccm::core::CID_CInteger == cid) {
+        return ccm::core::GetCIntegerClassObject(object);
+    }
+    else if (ccm::core::CID_CLong == cid) {
+        return ccm::core::GetCLongClassObject(object);
+    }
+    else if (ccm::core::CID_CShort == cid) {
+        return ccm::core::GetCShortClassObject(object);
+    }
+    else if (ccm::core::CID_CStackTrace == cid) {
+        return ccm::core::GetCStackTraceClassObject(object);
+    }
+    else if (ccm::core::CID_CStackTraceElement == cid) {
+        return ccm::core::GetCStackTraceElementClassObject(object);
+    }
+    else if (ccm::core::CID_CString == cid) {
+        return ccm::core::GetCStringClassObject(object);
+    }
+    else if (ccm::core::CID_CStringBuffer == cid) {
+        return ccm::core::GetCStringBufferClassObject(object);
+    }
+    else if (ccm::core::CID_CStringBuilder == cid) {
+        return ccm::core::GetCStringBuilderClassObject(object);
+    }
+    else if (ccm::math::CID_CBigDecimal == cid) {
+        return ccm::math::GetCBigDecimalClassObject(object);
+    }
+    else if (ccm::math::CID_CBigInteger == cid) {
+        return ccm::math::GetCBigIntegerClassObject(object);
+    }
+    else if (ccm::math::CID_CMathContext == cid) {
+        return ccm::math::GetCMathContextClassObject(object);
+    }
+    else if (ccm::misc::CID_CFDBigInteger == cid) {
+        return ccm::misc::GetCFDBigIntegerClassObject(object);
+    }
+    else if (ccm::security::CID_CPermissions == cid) {
+        return ccm::security::GetCPermissionsClassObject(object);
+    }
+    else if (ccm::security::CID_CSecureRandom == cid) {
+        return ccm::security::GetCSecureRandomClassObject(object);
+    }
+    else if (ccm::security::action::CID_CGetPropertyAction == cid) {
+        return ccm::security::action::GetCGetPropertyActionClassObject(object);
+    }
+    else if (ccm::core::CID_CRuntimePermission == cid) {
+        return ccm::core::GetCRuntimePermissionClassObject(object);
+    }
+    else if (ccm::text::CID_CAttributedCharacterIteratorAttribute == cid) {
+        return ccm::text::GetCAttributedCharacterIteratorAttributeClassObject(object);
+    }
+    else if (ccm::text::CID_CAttributedString == cid) {
+        return ccm::text::GetCAttributedStringClassObject(object);
+    }
+    else if (ccm::text::CID_CChoiceFormat == cid) {
+        return ccm::text::GetCChoiceFormatClassObject(object);
+    }
+    else if (ccm::text::CID_CDateFormatField == cid) {
+        return ccm::text::GetCDateFormatFieldClassObject(object);
+    }
+    else if (ccm::text::CID_CDateFormatSymbols == cid) {
+        return ccm::text::GetCDateFormatSymbolsClassObject(object);
+    }
+    else if (ccm::text::CID_CDecimalFormat == cid) {
+        return ccm::text::GetCDecimalFormatClassObject(object);
+    }
+    else if (ccm::text::CID_CDecimalFormatSymbols == cid) {
+        return ccm::text::GetCDecimalFormatSymbolsClassObject(object);
+    }
+    else if (ccm::text::CID_CFieldPosition == cid) {
+        return ccm::text::GetCFieldPositionClassObject(object);
+    }
+    else if (ccm::text::CID_CMessageFormat == cid) {
+        return ccm::text::GetCMessageFormatClassObject(object);
+    }
+    else if (ccm::text::CID_CParsePosition == cid) {
+        return ccm::text::GetCParsePositionClassObject(object);
+    }
+    else if (ccm::text::CID_CSimpleDateFormat == cid) {
+        return ccm::text::GetCSimpleDateFormatClassObject(object);
+    }
+    else if (ccm::util::CID_CArrayList == cid) {
+        return ccm::util::GetCArrayListClassObject(object);
+    }
+    else if (ccm::util::CID_CDate == cid) {
+        return ccm::util::GetCDateClassObject(object);
+    }
+    else if (ccm::util::CID_CFormatter == cid) {
+        return ccm::util::GetCFormatterClassObject(object);
+    }
+    else if (ccm::util::CID_CGregorianCalendar == cid) {
+        return ccm::util::GetCGregorianCalendarClassObject(object);
+    }
+    else if (ccm::util::CID_CHashMap == cid) {
+        return ccm::util::GetCHashMapClassObject(object);
+    }
+    else if (ccm::util::CID_CHashSet == cid) {
+        return ccm::util::GetCHashSetClassObject(object);
+    }
+    else if (ccm::util::CID_CHashtable == cid) {
+        return ccm::util::GetCHashtableClassObject(object);
+    }
+    else if (ccm::util::CID_CLinkedHashMap == cid) {
+        return ccm::util::GetCLinkedHashMapClassObject(object);
+    }
+    else if (ccm::util::CID_CLinkedHashSet == cid) {
+        return ccm::util::GetCLinkedHashSetClassObject(object);
+    }
+    else if (ccm::util::CID_CLinkedList == cid) {
+        return ccm::util::GetCLinkedListClassObject(object);
+    }
+    else if (ccm::util::CID_CLocale == cid) {
+        return ccm::util::GetCLocaleClassObject(object);
+    }
+    else if (ccm::util::CID_CLocaleBuilder == cid) {
+        return ccm::util::GetCLocaleBuilderClassObject(object);
+    }
+    else if (ccm::util::CID_CProperties == cid) {
+        return ccm::util::GetCPropertiesClassObject(object);
+    }
+    else if (ccm::util::CID_CPropertyPermission == cid) {
+        return ccm::util::GetCPropertyPermissionClassObject(object);
+    }
+    else if (ccm::util::CID_CRandom == cid) {
+        return ccm::util::GetCRandomClassObject(object);
+    }
+    else if (ccm::util::CID_CSimpleEntry == cid) {
+        return ccm::util::GetCSimpleEntryClassObject(object);
+    }
+    else if (ccm::util::CID_CSimpleImmutableEntry == cid) {
+        return ccm::util::GetCSimpleImmutableEntryClassObject(object);
+    }
+    else if (ccm::util::CID_CSimpleTimeZone == cid) {
+        return ccm::util::GetCSimpleTimeZoneClassObject(object);
+    }
+    else if (ccm::util::CID_CStringTokenizer == cid) {
+        return ccm::util::GetCStringTokenizerClassObject(object);
+    }
+    else if (ccm::util::CID_CTreeMap == cid) {
+        return ccm::util::GetCTreeMapClassObject(object);
+    }
+    else if (ccm::util::CID_CTreeSet == cid) {
+        return ccm::util::GetCTreeSetClassObject(object);
+    }
+    else if (ccm::util::CID_CVector == cid) {
+        return ccm::util::GetCVectorClassObject(object);
+    }
+    else if (ccm::util::calendar::CID_CEra == cid) {
+        return ccm::util::calendar::GetCEraClassObject(object);
+    }
+    else if (ccm::util::calendar::CID_CGregorian == cid) {
+        return ccm::util::calendar::GetCGregorianClassObject(object);
+    }
+    else if (ccm::util::calendar::CID_CJulianCalendar == cid) {
+        return ccm::util::calendar::GetCJulianCalendarClassObject(object);
+    }
+    else if (ccm::util::calendar::CID_CLocalGregorianCalendar == cid) {
+        return ccm::util::calendar::GetCLocalGregorianCalendarClassObject(object);
+    }
+    else if (ccm::util::concurrent::CID_CConcurrentLinkedQueue == cid) {
+        return ccm::util::concurrent::GetCConcurrentLinkedQueueClassObject(object);
+    }
+    else if (ccm::util::concurrent::CID_CConcurrentHashMap == cid) {
+        return ccm::util::concurrent::GetCConcurrentHashMapClassObject(object);
+    }
+    else if (ccm::util::concurrent::atomic::CID_CAtomicBoolean == cid) {
+        return ccm::util::concurrent::atomic::GetCAtomicBooleanClassObject(object);
+    }
+    else if (ccm::util::concurrent::atomic::CID_CAtomicInteger == cid) {
+        return ccm::util::concurrent::atomic::GetCAtomicIntegerClassObject(object);
+    }
+    else if (ccm::util::concurrent::atomic::CID_CAtomicLong == cid) {
+        return ccm::util::concurrent::atomic::GetCAtomicLongClassObject(object);
+    }
+    else if (ccmrt::system::CID_CPathClassLoader == cid) {
+        return ccmrt::system::GetCPathClassLoaderClassObject(object);
+    }
+    else if (libcore::io::CID_CLibcore == cid) {
+        return libcore::io::GetCLibcoreClassObject(object);
+    }
+    else if (libcore::io::CID_CMemoryMappedFile == cid) {
+        return libcore::io::GetCMemoryMappedFileClassObject(object);
+    }
+    else if (libcore::util::CID_CZoneInfoWallTime == cid) {
+        return libcore::util::GetCZoneInfoWallTimeClassObject(object);
+    }
+    else if (pisces::system::CID_CStructStat == cid) {
+        return pisces::system::GetCStructStatClassObject(object);
+    }
+
+    *object = nullptr;
+    return NOERROR;
+}
+
+class Clibcore
+    : public LightRefBase
+{
+public:
+    Clibcore();
+};
+Clibcore::Clibcore()
+{
+    AddRef();
+}
+
+static __attribute__ ((init_priority (200))) Clibcore sComponentObject;
+
+// Lets the coclasses of this component create their objects without
+// the class loader. The class objects they cache are dropped when
+// the loader asks whether the component can be unloaded.
+static std::atomic<IMetaComponent*> sComponentMetadata(nullptr);
+
+EXTERN_C COM_PUBLIC Boolean soCanUnload()
+{
+    sComponentMetadata.store(nullptr, std::memory_order_release);
+    ccm::core::ReleaseCArrayClassObjectCache();
+    ccm::core::ReleaseCArrayHolderClassObjectCache();
+    ccm::core::ReleaseCSystemClassObjectCache();
+    ccm::core::ReleaseCThreadClassObjectCache();
+    ccm::core::ReleaseCThreadGroupClassObjectCache();
+    ccm::core::ReleaseCThreadLocalClassObjectCache();
+    ccm::io::ReleaseCBufferedWriterClassObjectCache();
+    ccm::io::ReleaseCByteArrayOutputStreamClassObjectCache();
+    ccm::io::ReleaseCDirectByteBufferClassObjectCache();
+    ccm::io::ReleaseCFileClassObjectCache();
+    ccm::io::ReleaseCFileDescriptorClassObjectCache();
+    ccm::io::ReleaseCFileInputStreamClassObjectCache();
+    ccm::io::ReleaseCFileOutputStreamClassObjectCache();
+    ccm::io::ReleaseCOutputStreamWriterClassObjectCache();
+    ccm::io::ReleaseCPrintWriterClassObjectCache();
+    ccm::io::ReleaseCStringWriterClassObjectCache();
+    ccm::core::ReleaseCBooleanClassObjectCache();
+    ccm::core::ReleaseCByteClassObjectCache();
+    ccm::core::ReleaseCCharClassObjectCache();
+    ccm::core::ReleaseCDoubleClassObjectCache();
+    ccm::core::ReleaseCFloatClassObjectCache();
+    ccm::core::ReleaseCIntegerClassObjectCache();
+    ccm::core::ReleaseCLongClassObjectCache();
+    ccm::core::ReleaseCShortClassObjectCache();
+    ccm::core::ReleaseCStackTraceClassObjectCache();
+    ccm::core::ReleaseCStackTraceElementClassObjectCache();
+    ccm::core::ReleaseCStringClassObjectCache();
+    ccm::core::ReleaseCStringBufferClassObjectCache();
+    ccm::core::ReleaseCStringBuilderClassObjectCache();
+    ccm::math::ReleaseCBigDecimalClassObjectCache();
+    ccm::math::ReleaseCBigIntegerClassObjectCache();
+    ccm::math::ReleaseCMathContextClassObjectCache();
+    ccm::misc::ReleaseCFDBigIntegerClassObjectCache();
+    ccm::security::ReleaseCPermissionsClassObjectCache();
+    ccm::security::ReleaseCSecureRandomClassObjectCache();
+    ccm::security::action::ReleaseCGetPropertyActionClassObjectCache();
+    ccm::core::ReleaseCRuntimePermissionClassObjectCache();
+    ccm::text::ReleaseCAttributedCharacterIteratorAttributeClassObjectCache();
+    ccm::text::ReleaseCAttributedStringClassObjectCache();
+    ccm::text::ReleaseCChoiceFormatClassObjectCache();
+    ccm::text::ReleaseCDateFormatFieldClassObjectCache();
+    ccm::text::ReleaseCDateFormatSymbolsClassObjectCache();
+    ccm::text::ReleaseCDecimalFormatClassObjectCache();
+    ccm::text::ReleaseCDecimalFormatSymbolsClassObjectCache();
+    ccm::text::ReleaseCFieldPositionClassObjectCache();
+    ccm::text::ReleaseCMessageFormatClassObjectCache();
+    ccm::text::ReleaseCParsePositionClassObjectCache();
+    ccm::text::ReleaseCSimpleDateFormatClassObjectCache();
+    ccm::util::ReleaseCArrayListClassObjectCache();
+    ccm::util::ReleaseCDateClassObjectCache();
+    ccm::util::ReleaseCFormatterClassObjectCache();
+    ccm::util::ReleaseCGregorianCalendarClassObjectCache();
+    ccm::util::ReleaseCHashMapClassObjectCache();
+    ccm::util::ReleaseCHashSetClassObjectCache();
+    ccm::util::ReleaseCHashtableClassObjectCache();
+    ccm::util::ReleaseCLinkedHashMapClassObjectCache();
+    ccm::util::ReleaseCLinkedHashSetClassObjectCache();
+    ccm::util::ReleaseCLinkedListClassObjectCache();
+    ccm::util::ReleaseCLocaleClassObjectCache();
+    ccm::util::ReleaseCLocaleBuilderClassObjectCache();
+    ccm::util::ReleaseCPropertiesClassObjectCache();
+    ccm::util::ReleaseCPropertyPermissionClassObjectCache();
+    ccm::util::ReleaseCRandomClassObjectCache();
+    ccm::util::ReleaseCSimpleEntryClassObjectCache();
+    ccm::util::ReleaseCSimpleImmutableEntryClassObjectCache();
+    ccm::util::ReleaseCSimpleTimeZoneClassObjectCache();
+    ccm::util::ReleaseCStringTokenizerClassObjectCache();
+    ccm::util::ReleaseCTreeMapClassObjectCache();
+    ccm::util::ReleaseCTreeSetClassObjectCache();
+    ccm::util::ReleaseCVectorClassObjectCache();
+    ccm::util::calendar::ReleaseCEraClassObjectCache();
+    ccm::util::calendar::ReleaseCGregorianClassObjectCache();
+    ccm::util::calendar::ReleaseCJulianCalendarClassObjectCache();
+    ccm::util::calendar::ReleaseCLocalGregorianCalendarClassObjectCache();
+    ccm::util::concurrent::ReleaseCConcurrentLinkedQueueClassObjectCache();
+    ccm::util::concurrent::ReleaseCConcurrentHashMapClassObjectCache();
+    ccm::util::concurrent::atomic::ReleaseCAtomicBooleanClassObjectCache();
+    ccm::util::concurrent::atomic::ReleaseCAtomicIntegerClassObjectCache();
+    ccm::util::concurrent::atomic::ReleaseCAtomicLongClassObjectCache();
+    ccmrt::system::ReleaseCPathClassLoaderClassObjectCache();
+    libcore::io::ReleaseCLibcoreClassObjectCache();
+    libcore::io::ReleaseCMemoryMappedFileClassObjectCache();
+    libcore::util::ReleaseCZoneInfoWallTimeClassObjectCache();
+    pisces::system::ReleaseCStructStatClassObjectCache();
+    return sComponentObject.GetStrongCount() == 1;
+}
+
+void AddComponentCount()
+{
+    sComponentObject.AddRef();
+}
+
+void ReleaseComponentCount()
+{
+    sComponentObject.Release();
+}
+
+IMetaComponent* GetComponentMetadata()
+{
+    return sComponentMetadata.load(std::memory_order_acquire);
+}
+
+void SetComponentMetadata(IMetaComponent* component)
+{
+    sComponentMetadata.store(component, std::memory_order_release);
+}
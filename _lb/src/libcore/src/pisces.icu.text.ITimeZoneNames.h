@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __PISCES_ICU_TEXT_ITIMEZONENAMES_H_GEN__
+#define __PISCES_ICU_TEXT_ITIMEZONENAMES_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace pisces {
+namespace icu {
+namespace text {
+
+extern const InterfaceID IID_ITimeZoneNames;
+
+INTERFACE_ID(b1f01233-3da2-4b26-a041-519317137cf7)
+interface ITimeZoneNames : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ITimeZoneNames* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ITimeZoneNames*)object->Probe(IID_ITimeZoneNames);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ITimeZoneNames;
+    }
+
+};
+
+} // namespace text
+} // namespace icu
+} // namespace pisces
+
+#endif // __PISCES_ICU_TEXT_ITIMEZONENAMES_H_GEN__
@@ -0,0 +1,67 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __PISCES_SYSTEM_ICSTRUCTSTATCLASSOBJECT_H_GEN__
+#define __PISCES_SYSTEM_ICSTRUCTSTATCLASSOBJECT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace pisces {
+namespace system {
+
+extern const InterfaceID IID_ICStructStatClassObject;
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000000)
+interface ICStructStatClassObject : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICStructStatClassObject* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICStructStatClassObject*)object->Probe(IID_ICStructStatClassObject);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICStructStatClassObject;
+    }
+
+    virtual ECode CreateObject(
+        /* [in] */ Long st_dev,
+        /* [in] */ Long st_ino,
+        /* [in] */ Integer st_mode,
+        /* [in] */ Long st_nlink,
+        /* [in] */ Integer st_uid,
+        /* [in] */ Integer st_gid,
+        /* [in] */ Long st_rdev,
+        /* [in] */ Long st_size,
+        /* [in] */ Long st_atime,
+        /* [in] */ Long st_mtime,
+        /* [in] */ Long st_ctime,
+        /* [in] */ Long st_blksize,
+        /* [in] */ Long st_blocks,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+} // namespace system
+} // namespace pisces
+
+#endif // __PISCES_SYSTEM_ICSTRUCTSTATCLASSOBJECT_H_GEN__
@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __PISCES_SYSTEM_ISTRUCTIFADDRS_H_GEN__
+#define __PISCES_SYSTEM_ISTRUCTIFADDRS_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace pisces {
+namespace system {
+
+extern const InterfaceID IID_IStructIfaddrs;
+
+INTERFACE_ID(7cdd3d82-f1c3-4baf-aa92-05a48bbe4046)
+interface IStructIfaddrs : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStructIfaddrs* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStructIfaddrs*)object->Probe(IID_IStructIfaddrs);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStructIfaddrs;
+    }
+
+};
+
+} // namespace system
+} // namespace pisces
+
+#endif // __PISCES_SYSTEM_ISTRUCTIFADDRS_H_GEN__
@@ -0,0 +1,59 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __PISCES_SYSTEM_ISTRUCTLINGER_H_GEN__
+#define __PISCES_SYSTEM_ISTRUCTLINGER_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace pisces {
+namespace system {
+
+extern const InterfaceID IID_IStructLinger;
+
+INTERFACE_ID(8fa6e1d2-7213-478c-91b0-586df09a4fa9)
+interface IStructLinger : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStructLinger* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStructLinger*)object->Probe(IID_IStructLinger);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStructLinger;
+    }
+
+    virtual ECode GetLinger(
+        /* [out] */ Integer* linger) = 0;
+
+    virtual ECode GetOnoff(
+        /* [out] */ Integer* onoff) = 0;
+
+    virtual ECode IsOn(
+        /* [out] */ Boolean* on) = 0;
+};
+
+} // namespace system
+} // namespace pisces
+
+#endif // __PISCES_SYSTEM_ISTRUCTLINGER_H_GEN__
@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __PISCES_SYSTEM_ISTRUCTPASSWD_H_GEN__
+#define __PISCES_SYSTEM_ISTRUCTPASSWD_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace pisces {
+namespace system {
+
+extern const InterfaceID IID_IStructPasswd;
+
+INTERFACE_ID(55bc7374-a37a-4a69-a3a8-4b5e3e92e2a3)
+interface IStructPasswd : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStructPasswd* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStructPasswd*)object->Probe(IID_IStructPasswd);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStructPasswd;
+    }
+
+};
+
+} // namespace system
+} // namespace pisces
+
+#endif // __PISCES_SYSTEM_ISTRUCTPASSWD_H_GEN__
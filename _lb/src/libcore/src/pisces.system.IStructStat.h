@@ -0,0 +1,89 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __PISCES_SYSTEM_ISTRUCTSTAT_H_GEN__
+#define __PISCES_SYSTEM_ISTRUCTSTAT_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace pisces {
+namespace system {
+
+extern const InterfaceID IID_IStructStat;
+
+INTERFACE_ID(c5e4c12c-e52d-44d5-bbb3-55fda2d9eea8)
+interface IStructStat : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStructStat* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStructStat*)object->Probe(IID_IStructStat);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStructStat;
+    }
+
+    virtual ECode GetAtime(
+        /* [out] */ Long* atime) = 0;
+
+    virtual ECode GetBlksize(
+        /* [out] */ Long* blksize) = 0;
+
+    virtual ECode GetBlocks(
+        /* [out] */ Long* blocks) = 0;
+
+    virtual ECode GetCtime(
+        /* [out] */ Long* ctime) = 0;
+
+    virtual ECode GetDev(
+        /* [out] */ Long* dev) = 0;
+
+    virtual ECode GetGid(
+        /* [out] */ Integer* gid) = 0;
+
+    virtual ECode GetIno(
+        /* [out] */ Long* ino) = 0;
+
+    virtual ECode GetMode(
+        /* [out] */ Integer* mode) = 0;
+
+    virtual ECode GetMtime(
+        /* [out] */ Long* mtime) = 0;
+
+    virtual ECode GetNlink(
+        /* [out] */ Long* nlink) = 0;
+
+    virtual ECode GetRdev(
+        /* [out] */ Long* rdev) = 0;
+
+    virtual ECode GetSize(
+        /* [out] */ Long* size) = 0;
+
+    virtual ECode GetUid(
+        /* [out] */ Integer* uid) = 0;
+};
+
+} // namespace system
+} // namespace pisces
+
+#endif // __PISCES_SYSTEM_ISTRUCTSTAT_H_GEN__
@@ -0,0 +1,51 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __PISCES_SYSTEM_ISTRUCTUTSNAME_H_GEN__
+#define __PISCES_SYSTEM_ISTRUCTUTSNAME_H_GEN__
+
+#include "libcore.h"
+
+using namespace ccm;
+
+namespace pisces {
+namespace system {
+
+extern const InterfaceID IID_IStructUtsname;
+
+INTERFACE_ID(6bed66a8-4da9-4b24-9454-c64dba280889)
+interface IStructUtsname : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IStructUtsname* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IStructUtsname*)object->Probe(IID_IStructUtsname);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IStructUtsname;
+    }
+
+};
+
+} // namespace system
+} // namespace pisces
+
+#endif // __PISCES_SYSTEM_ISTRUCTUTSNAME_H_GEN__
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pisces_system.dir/CStructStat.cpp.o"
+  "CMakeFiles/pisces_system.dir/CStructStat.cpp.o.d"
+  "CMakeFiles/pisces_system.dir/OsConstants.cpp.o"
+  "CMakeFiles/pisces_system.dir/OsConstants.cpp.o.d"
+  "pisces_system.a"
+  "pisces_system.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pisces_system.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/runtime/ccmids.cpp" "src/runtime/CMakeFiles/ccmrt.dir/ccmids.cpp.o" "gcc" "src/runtime/CMakeFiles/ccmrt.dir/ccmids.cpp.o.d"
+  "/root/repo/src/runtime/runtime.cpp" "src/runtime/CMakeFiles/ccmrt.dir/runtime.cpp.o" "gcc" "src/runtime/CMakeFiles/ccmrt.dir/runtime.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_lb/src/runtime/cdl/CMakeFiles/cdl.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/runtime/component/CMakeFiles/component.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/runtime/reflection/CMakeFiles/reflection.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/runtime/rpc/CMakeFiles/rpc.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/runtime/rpc/dbus/CMakeFiles/rpc-dbus.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/runtime/type/CMakeFiles/type.dir/DependInfo.cmake"
+  "/root/repo/_lb/src/runtime/util/CMakeFiles/util.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ccmrt.dir/ccmids.cpp.o"
+  "CMakeFiles/ccmrt.dir/ccmids.cpp.o.d"
+  "CMakeFiles/ccmrt.dir/runtime.cpp.o"
+  "CMakeFiles/ccmrt.dir/runtime.cpp.o.d"
+  "ccmrt.pdb"
+  "ccmrt.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ccmrt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
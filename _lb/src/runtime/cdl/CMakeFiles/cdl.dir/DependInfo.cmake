@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_lb/obj/MetadataWrapper.cpp" "src/runtime/cdl/CMakeFiles/cdl.dir/__/__/__/obj/MetadataWrapper.cpp.o" "gcc" "src/runtime/cdl/CMakeFiles/cdl.dir/__/__/__/obj/MetadataWrapper.cpp.o.d"
+  "/root/repo/_lb/obj/ccmids.cpp" "src/runtime/cdl/CMakeFiles/cdl.dir/__/__/__/obj/ccmids.cpp.o" "gcc" "src/runtime/cdl/CMakeFiles/cdl.dir/__/__/__/obj/ccmids.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_lb/obj/MetadataWrapper.cpp" "/root/repo/_lb/obj/ccmids.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
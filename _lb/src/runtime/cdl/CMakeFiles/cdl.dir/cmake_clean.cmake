@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../obj/MetadataWrapper.cpp"
+  "../../../obj/ccmids.cpp"
+  "CMakeFiles/cdl.dir/__/__/__/obj/MetadataWrapper.cpp.o"
+  "CMakeFiles/cdl.dir/__/__/__/obj/MetadataWrapper.cpp.o.d"
+  "CMakeFiles/cdl.dir/__/__/__/obj/ccmids.cpp.o"
+  "CMakeFiles/cdl.dir/__/__/__/obj/ccmids.cpp.o.d"
+  "cdl.a"
+  "cdl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/runtime/component/CBootClassLoader.cpp" "src/runtime/component/CMakeFiles/component.dir/CBootClassLoader.cpp.o" "gcc" "src/runtime/component/CMakeFiles/component.dir/CBootClassLoader.cpp.o.d"
+  "/root/repo/src/runtime/component/ccmobjectapi.cpp" "src/runtime/component/CMakeFiles/component.dir/ccmobjectapi.cpp.o" "gcc" "src/runtime/component/CMakeFiles/component.dir/ccmobjectapi.cpp.o.d"
+  "/root/repo/src/runtime/component/componentfile.cpp" "src/runtime/component/CMakeFiles/component.dir/componentfile.cpp.o" "gcc" "src/runtime/component/CMakeFiles/component.dir/componentfile.cpp.o.d"
+  "/root/repo/src/runtime/component/componentindex.cpp" "src/runtime/component/CMakeFiles/component.dir/componentindex.cpp.o" "gcc" "src/runtime/component/CMakeFiles/component.dir/componentindex.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
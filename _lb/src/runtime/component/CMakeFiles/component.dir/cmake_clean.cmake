@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/component.dir/CBootClassLoader.cpp.o"
+  "CMakeFiles/component.dir/CBootClassLoader.cpp.o.d"
+  "CMakeFiles/component.dir/ccmobjectapi.cpp.o"
+  "CMakeFiles/component.dir/ccmobjectapi.cpp.o.d"
+  "CMakeFiles/component.dir/componentfile.cpp.o"
+  "CMakeFiles/component.dir/componentfile.cpp.o.d"
+  "CMakeFiles/component.dir/componentindex.cpp.o"
+  "CMakeFiles/component.dir/componentindex.cpp.o.d"
+  "component.a"
+  "component.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/component.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/runtime/reflection/CArgumentList.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CArgumentList.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CArgumentList.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaCoclass.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaCoclass.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaCoclass.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaComponent.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaComponent.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaComponent.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaConstant.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaConstant.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaConstant.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaConstructor.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaConstructor.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaConstructor.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaEnumeration.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaEnumeration.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaEnumeration.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaEnumerator.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaEnumerator.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaEnumerator.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaInterface.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaInterface.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaInterface.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaMethod.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaMethod.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaMethod.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaParameter.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaParameter.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaParameter.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaType.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaType.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaType.cpp.o.d"
+  "/root/repo/src/runtime/reflection/CMetaValue.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaValue.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/CMetaValue.cpp.o.d"
+  "/root/repo/src/runtime/reflection/invoke.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/invoke.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/invoke.cpp.o.d"
+  "/root/repo/src/runtime/reflection/reflection.cpp" "src/runtime/reflection/CMakeFiles/reflection.dir/reflection.cpp.o" "gcc" "src/runtime/reflection/CMakeFiles/reflection.dir/reflection.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reflection.dir/CArgumentList.cpp.o"
+  "CMakeFiles/reflection.dir/CArgumentList.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaCoclass.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaCoclass.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaComponent.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaComponent.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaConstant.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaConstant.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaConstructor.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaConstructor.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaEnumeration.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaEnumeration.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaEnumerator.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaEnumerator.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaInterface.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaInterface.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaMethod.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaMethod.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaParameter.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaParameter.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaType.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaType.cpp.o.d"
+  "CMakeFiles/reflection.dir/CMetaValue.cpp.o"
+  "CMakeFiles/reflection.dir/CMetaValue.cpp.o.d"
+  "CMakeFiles/reflection.dir/invoke.cpp.o"
+  "CMakeFiles/reflection.dir/invoke.cpp.o.d"
+  "CMakeFiles/reflection.dir/reflection.cpp.o"
+  "CMakeFiles/reflection.dir/reflection.cpp.o.d"
+  "reflection.a"
+  "reflection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reflection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/runtime/rpc/CProxy.cpp" "src/runtime/rpc/CMakeFiles/rpc.dir/CProxy.cpp.o" "gcc" "src/runtime/rpc/CMakeFiles/rpc.dir/CProxy.cpp.o.d"
+  "/root/repo/src/runtime/rpc/CStub.cpp" "src/runtime/rpc/CMakeFiles/rpc.dir/CStub.cpp.o" "gcc" "src/runtime/rpc/CMakeFiles/rpc.dir/CStub.cpp.o.d"
+  "/root/repo/src/runtime/rpc/ccmrpc.cpp" "src/runtime/rpc/CMakeFiles/rpc.dir/ccmrpc.cpp.o" "gcc" "src/runtime/rpc/CMakeFiles/rpc.dir/ccmrpc.cpp.o.d"
+  "/root/repo/src/runtime/rpc/invocationfuture.cpp" "src/runtime/rpc/CMakeFiles/rpc.dir/invocationfuture.cpp.o" "gcc" "src/runtime/rpc/CMakeFiles/rpc.dir/invocationfuture.cpp.o.d"
+  "/root/repo/src/runtime/rpc/registry.cpp" "src/runtime/rpc/CMakeFiles/rpc.dir/registry.cpp.o" "gcc" "src/runtime/rpc/CMakeFiles/rpc.dir/registry.cpp.o.d"
+  "/root/repo/src/runtime/rpc/rpcstatistics.cpp" "src/runtime/rpc/CMakeFiles/rpc.dir/rpcstatistics.cpp.o" "gcc" "src/runtime/rpc/CMakeFiles/rpc.dir/rpcstatistics.cpp.o.d"
+  "/root/repo/src/runtime/rpc/threadpoolexecutor.cpp" "src/runtime/rpc/CMakeFiles/rpc.dir/threadpoolexecutor.cpp.o" "gcc" "src/runtime/rpc/CMakeFiles/rpc.dir/threadpoolexecutor.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rpc.dir/CProxy.cpp.o"
+  "CMakeFiles/rpc.dir/CProxy.cpp.o.d"
+  "CMakeFiles/rpc.dir/CStub.cpp.o"
+  "CMakeFiles/rpc.dir/CStub.cpp.o.d"
+  "CMakeFiles/rpc.dir/ccmrpc.cpp.o"
+  "CMakeFiles/rpc.dir/ccmrpc.cpp.o.d"
+  "CMakeFiles/rpc.dir/invocationfuture.cpp.o"
+  "CMakeFiles/rpc.dir/invocationfuture.cpp.o.d"
+  "CMakeFiles/rpc.dir/registry.cpp.o"
+  "CMakeFiles/rpc.dir/registry.cpp.o.d"
+  "CMakeFiles/rpc.dir/rpcstatistics.cpp.o"
+  "CMakeFiles/rpc.dir/rpcstatistics.cpp.o.d"
+  "CMakeFiles/rpc.dir/threadpoolexecutor.cpp.o"
+  "CMakeFiles/rpc.dir/threadpoolexecutor.cpp.o.d"
+  "rpc.a"
+  "rpc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rpc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
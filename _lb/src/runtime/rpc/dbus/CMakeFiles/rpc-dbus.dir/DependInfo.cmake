@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/runtime/rpc/dbus/CDBusChannel.cpp" "src/runtime/rpc/dbus/CMakeFiles/rpc-dbus.dir/CDBusChannel.cpp.o" "gcc" "src/runtime/rpc/dbus/CMakeFiles/rpc-dbus.dir/CDBusChannel.cpp.o.d"
+  "/root/repo/src/runtime/rpc/dbus/CDBusChannelFactory.cpp" "src/runtime/rpc/dbus/CMakeFiles/rpc-dbus.dir/CDBusChannelFactory.cpp.o" "gcc" "src/runtime/rpc/dbus/CMakeFiles/rpc-dbus.dir/CDBusChannelFactory.cpp.o.d"
+  "/root/repo/src/runtime/rpc/dbus/CDBusParcel.cpp" "src/runtime/rpc/dbus/CMakeFiles/rpc-dbus.dir/CDBusParcel.cpp.o" "gcc" "src/runtime/rpc/dbus/CMakeFiles/rpc-dbus.dir/CDBusParcel.cpp.o.d"
+  "/root/repo/src/runtime/rpc/dbus/InterfacePack.cpp" "src/runtime/rpc/dbus/CMakeFiles/rpc-dbus.dir/InterfacePack.cpp.o" "gcc" "src/runtime/rpc/dbus/CMakeFiles/rpc-dbus.dir/InterfacePack.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
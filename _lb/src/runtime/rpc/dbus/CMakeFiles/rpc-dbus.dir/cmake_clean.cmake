@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rpc-dbus.dir/CDBusChannel.cpp.o"
+  "CMakeFiles/rpc-dbus.dir/CDBusChannel.cpp.o.d"
+  "CMakeFiles/rpc-dbus.dir/CDBusChannelFactory.cpp.o"
+  "CMakeFiles/rpc-dbus.dir/CDBusChannelFactory.cpp.o.d"
+  "CMakeFiles/rpc-dbus.dir/CDBusParcel.cpp.o"
+  "CMakeFiles/rpc-dbus.dir/CDBusParcel.cpp.o.d"
+  "CMakeFiles/rpc-dbus.dir/InterfacePack.cpp.o"
+  "CMakeFiles/rpc-dbus.dir/InterfacePack.cpp.o.d"
+  "rpc-dbus.a"
+  "rpc-dbus.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rpc-dbus.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
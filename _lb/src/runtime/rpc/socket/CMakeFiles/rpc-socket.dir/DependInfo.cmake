@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/runtime/rpc/socket/CSocketChannel.cpp" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/CSocketChannel.cpp.o" "gcc" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/CSocketChannel.cpp.o.d"
+  "/root/repo/src/runtime/rpc/socket/CSocketChannelFactory.cpp" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/CSocketChannelFactory.cpp.o" "gcc" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/CSocketChannelFactory.cpp.o.d"
+  "/root/repo/src/runtime/rpc/socket/CSocketParcel.cpp" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/CSocketParcel.cpp.o" "gcc" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/CSocketParcel.cpp.o.d"
+  "/root/repo/src/runtime/rpc/socket/SocketInterfacePack.cpp" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/SocketInterfacePack.cpp.o" "gcc" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/SocketInterfacePack.cpp.o.d"
+  "/root/repo/src/runtime/rpc/socket/shmlane.cpp" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/shmlane.cpp.o" "gcc" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/shmlane.cpp.o.d"
+  "/root/repo/src/runtime/rpc/socket/socketconnection.cpp" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/socketconnection.cpp.o" "gcc" "src/runtime/rpc/socket/CMakeFiles/rpc-socket.dir/socketconnection.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rpc-socket.dir/CSocketChannel.cpp.o"
+  "CMakeFiles/rpc-socket.dir/CSocketChannel.cpp.o.d"
+  "CMakeFiles/rpc-socket.dir/CSocketChannelFactory.cpp.o"
+  "CMakeFiles/rpc-socket.dir/CSocketChannelFactory.cpp.o.d"
+  "CMakeFiles/rpc-socket.dir/CSocketParcel.cpp.o"
+  "CMakeFiles/rpc-socket.dir/CSocketParcel.cpp.o.d"
+  "CMakeFiles/rpc-socket.dir/SocketInterfacePack.cpp.o"
+  "CMakeFiles/rpc-socket.dir/SocketInterfacePack.cpp.o.d"
+  "CMakeFiles/rpc-socket.dir/shmlane.cpp.o"
+  "CMakeFiles/rpc-socket.dir/shmlane.cpp.o.d"
+  "CMakeFiles/rpc-socket.dir/socketconnection.cpp.o"
+  "CMakeFiles/rpc-socket.dir/socketconnection.cpp.o.d"
+  "rpc-socket.a"
+  "rpc-socket.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rpc-socket.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
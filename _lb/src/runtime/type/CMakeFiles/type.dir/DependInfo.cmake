@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/runtime/type/ccmarray.cpp" "src/runtime/type/CMakeFiles/type.dir/ccmarray.cpp.o" "gcc" "src/runtime/type/CMakeFiles/type.dir/ccmarray.cpp.o.d"
+  "/root/repo/src/runtime/type/ccmsharedbuffer.cpp" "src/runtime/type/CMakeFiles/type.dir/ccmsharedbuffer.cpp.o" "gcc" "src/runtime/type/CMakeFiles/type.dir/ccmsharedbuffer.cpp.o.d"
+  "/root/repo/src/runtime/type/ccmstring.cpp" "src/runtime/type/CMakeFiles/type.dir/ccmstring.cpp.o" "gcc" "src/runtime/type/CMakeFiles/type.dir/ccmstring.cpp.o.d"
+  "/root/repo/src/runtime/type/ccmstringbuilder.cpp" "src/runtime/type/CMakeFiles/type.dir/ccmstringbuilder.cpp.o" "gcc" "src/runtime/type/CMakeFiles/type.dir/ccmstringbuilder.cpp.o.d"
+  "/root/repo/src/runtime/type/ccmutf8.cpp" "src/runtime/type/CMakeFiles/type.dir/ccmutf8.cpp.o" "gcc" "src/runtime/type/CMakeFiles/type.dir/ccmutf8.cpp.o.d"
+  "/root/repo/src/runtime/type/ccmuuid.cpp" "src/runtime/type/CMakeFiles/type.dir/ccmuuid.cpp.o" "gcc" "src/runtime/type/CMakeFiles/type.dir/ccmuuid.cpp.o.d"
+  "/root/repo/src/runtime/type/ucase.cpp" "src/runtime/type/CMakeFiles/type.dir/ucase.cpp.o" "gcc" "src/runtime/type/CMakeFiles/type.dir/ucase.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
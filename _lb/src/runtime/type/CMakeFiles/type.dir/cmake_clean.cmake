@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/type.dir/ccmarray.cpp.o"
+  "CMakeFiles/type.dir/ccmarray.cpp.o.d"
+  "CMakeFiles/type.dir/ccmsharedbuffer.cpp.o"
+  "CMakeFiles/type.dir/ccmsharedbuffer.cpp.o.d"
+  "CMakeFiles/type.dir/ccmstring.cpp.o"
+  "CMakeFiles/type.dir/ccmstring.cpp.o.d"
+  "CMakeFiles/type.dir/ccmstringbuilder.cpp.o"
+  "CMakeFiles/type.dir/ccmstringbuilder.cpp.o.d"
+  "CMakeFiles/type.dir/ccmutf8.cpp.o"
+  "CMakeFiles/type.dir/ccmutf8.cpp.o.d"
+  "CMakeFiles/type.dir/ccmuuid.cpp.o"
+  "CMakeFiles/type.dir/ccmuuid.cpp.o.d"
+  "CMakeFiles/type.dir/ucase.cpp.o"
+  "CMakeFiles/type.dir/ucase.cpp.o.d"
+  "type.a"
+  "type.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/type.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/runtime/util/arena.cpp" "src/runtime/util/CMakeFiles/util.dir/arena.cpp.o" "gcc" "src/runtime/util/CMakeFiles/util.dir/arena.cpp.o.d"
+  "/root/repo/src/runtime/util/ccmclassobject.cpp" "src/runtime/util/CMakeFiles/util.dir/ccmclassobject.cpp.o" "gcc" "src/runtime/util/CMakeFiles/util.dir/ccmclassobject.cpp.o.d"
+  "/root/repo/src/runtime/util/ccmlogger.cpp" "src/runtime/util/CMakeFiles/util.dir/ccmlogger.cpp.o" "gcc" "src/runtime/util/CMakeFiles/util.dir/ccmlogger.cpp.o.d"
+  "/root/repo/src/runtime/util/ccmobject.cpp" "src/runtime/util/CMakeFiles/util.dir/ccmobject.cpp.o" "gcc" "src/runtime/util/CMakeFiles/util.dir/ccmobject.cpp.o.d"
+  "/root/repo/src/runtime/util/ccmrefbase.cpp" "src/runtime/util/CMakeFiles/util.dir/ccmrefbase.cpp.o" "gcc" "src/runtime/util/CMakeFiles/util.dir/ccmrefbase.cpp.o.d"
+  "/root/repo/src/runtime/util/ccmspinlock.cpp" "src/runtime/util/CMakeFiles/util.dir/ccmspinlock.cpp.o" "gcc" "src/runtime/util/CMakeFiles/util.dir/ccmspinlock.cpp.o.d"
+  "/root/repo/src/runtime/util/mutex.cpp" "src/runtime/util/CMakeFiles/util.dir/mutex.cpp.o" "gcc" "src/runtime/util/CMakeFiles/util.dir/mutex.cpp.o.d"
+  "/root/repo/src/runtime/util/perfecthash.cpp" "src/runtime/util/CMakeFiles/util.dir/perfecthash.cpp.o" "gcc" "src/runtime/util/CMakeFiles/util.dir/perfecthash.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
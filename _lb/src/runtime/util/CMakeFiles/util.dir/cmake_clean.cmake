@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/util.dir/arena.cpp.o"
+  "CMakeFiles/util.dir/arena.cpp.o.d"
+  "CMakeFiles/util.dir/ccmclassobject.cpp.o"
+  "CMakeFiles/util.dir/ccmclassobject.cpp.o.d"
+  "CMakeFiles/util.dir/ccmlogger.cpp.o"
+  "CMakeFiles/util.dir/ccmlogger.cpp.o.d"
+  "CMakeFiles/util.dir/ccmobject.cpp.o"
+  "CMakeFiles/util.dir/ccmobject.cpp.o.d"
+  "CMakeFiles/util.dir/ccmrefbase.cpp.o"
+  "CMakeFiles/util.dir/ccmrefbase.cpp.o.d"
+  "CMakeFiles/util.dir/ccmspinlock.cpp.o"
+  "CMakeFiles/util.dir/ccmspinlock.cpp.o.d"
+  "CMakeFiles/util.dir/mutex.cpp.o"
+  "CMakeFiles/util.dir/mutex.cpp.o.d"
+  "CMakeFiles/util.dir/perfecthash.cpp.o"
+  "CMakeFiles/util.dir/perfecthash.cpp.o.d"
+  "util.a"
+  "util.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
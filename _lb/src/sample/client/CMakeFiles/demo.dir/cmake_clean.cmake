@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/demo.dir/FooBarDemo.cpp.o"
+  "CMakeFiles/demo.dir/FooBarDemo.cpp.o.d"
+  "CMakeFiles/demo.dir/main.cpp.o"
+  "CMakeFiles/demo.dir/main.cpp.o.d"
+  "FooBarDemo.cpp"
+  "demo"
+  "demo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/demo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,79 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "FooBarDemo.h"
+#include "ccm.demo.CFoo.h"
+#include "ccm.demo.CFooBar.h"
+#include "ccm.demo.ICFooBarClassObject.h"
+
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+
+using namespace ccm;
+
+extern const ComponentID CID_FooBarDemo =
+        {{0x6a07eff9,0x9090,0x41a9,0xbfc3,{0x6,0x7,0xe,0xb,0x3,0xe,0xd,0x8,0x0,0xf,0x4,0x9}},
+        "http://ccm.org/component/sample/FooBarDemo.so"};
+
+namespace ccm {
+namespace demo {
+
+const String MODULE_NAME("FooBarDemo");
+
+
+extern const InterfaceID IID_IFoo =
+        {{0x6e7582c4,0xe0ec,0x4474,0x9046,{0x7,0x0,0x2,0x7,0x3,0x2,0xe,0x1,0xe,0x9,0x6,0xd}}, &CID_FooBarDemo};
+extern const InterfaceID IID_IBar =
+        {{0xef1b8367,0xe32d,0x4dc0,0xb320,{0x6,0x8,0x8,0xc,0xf,0x4,0xd,0x9,0xb,0xd,0xe,0xc}}, &CID_FooBarDemo};
+extern const InterfaceID IID_ICFooBarClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_FooBarDemo};
+
+extern const CoclassID CID_CFoo =
+        {{0xb150ddc0,0x530b,0x411f,0x8462,{0xb,0x0,0x4,0x2,0x5,0x2,0xf,0xd,0x0,0x1,0x2,0xb}}, &CID_FooBarDemo};
+extern const CoclassID CID_CFooBar =
+        {{0x855db520,0x7f7a,0x4ad1,0xa60a,{0x7,0xd,0x8,0xd,0x3,0x4,0x6,0x1,0xb,0xe,0x7,0xb}}, &CID_FooBarDemo};
+
+// CFoo
+ECode CFoo::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    return CoCreateObjectInstance(CID_CFoo, iid, nullptr, object);
+};
+
+
+// CFooBar
+ECode CFooBar::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    return CoCreateObjectInstance(CID_CFooBar, iid, nullptr, object);
+};
+
+ECode CFooBar::New(
+    /* [in] */ Long data,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFooBar, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFooBarClassObject::Probe(clsObject)->CreateObject(data, iid, object);
+};
+
+
+} // namespace demo
+} // namespace ccm
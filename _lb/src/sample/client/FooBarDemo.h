@@ -0,0 +1,40 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __FOOBARDEMO_H_GEN__
+#define __FOOBARDEMO_H_GEN__
+
+#include <ccmtypes.h>
+
+using namespace ccm;
+
+extern const ComponentID CID_FooBarDemo;
+
+namespace ccm {
+namespace demo {
+
+constexpr Long SERIALIZE_NUMBER = 0x123456789abcdefll;
+extern const String MODULE_NAME;
+
+interface IFoo;
+interface IBar;
+interface ICFooBarClassObject;
+
+} // namespace demo
+} // namespace ccm
+
+
+#endif // __FOOBARDEMO_H_GEN__
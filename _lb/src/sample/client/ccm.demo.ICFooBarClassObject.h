@@ -0,0 +1,59 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_DEMO_ICFOOBARCLASSOBJECT_H_GEN__
+#define __CCM_DEMO_ICFOOBARCLASSOBJECT_H_GEN__
+
+#include "FooBarDemo.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace demo {
+
+extern const InterfaceID IID_ICFooBarClassObject;
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000000)
+interface ICFooBarClassObject : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICFooBarClassObject* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICFooBarClassObject*)object->Probe(IID_ICFooBarClassObject);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICFooBarClassObject;
+    }
+
+    virtual ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+
+    virtual ECode CreateObject(
+        /* [in] */ Long data,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+} // namespace demo
+} // namespace ccm
+
+#endif // __CCM_DEMO_ICFOOBARCLASSOBJECT_H_GEN__
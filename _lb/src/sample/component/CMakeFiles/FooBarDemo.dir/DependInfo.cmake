@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/sample/component/CFoo.cpp" "src/sample/component/CMakeFiles/FooBarDemo.dir/CFoo.cpp.o" "gcc" "src/sample/component/CMakeFiles/FooBarDemo.dir/CFoo.cpp.o.d"
+  "/root/repo/src/sample/component/CFooBar.cpp" "src/sample/component/CMakeFiles/FooBarDemo.dir/CFooBar.cpp.o" "gcc" "src/sample/component/CMakeFiles/FooBarDemo.dir/CFooBar.cpp.o.d"
+  "/root/repo/_lb/src/sample/component/FooBarDemoPub.cpp" "src/sample/component/CMakeFiles/FooBarDemo.dir/FooBarDemoPub.cpp.o" "gcc" "src/sample/component/CMakeFiles/FooBarDemo.dir/FooBarDemoPub.cpp.o.d"
+  "/root/repo/_lb/src/sample/component/MetadataWrapper.cpp" "src/sample/component/CMakeFiles/FooBarDemo.dir/MetadataWrapper.cpp.o" "gcc" "src/sample/component/CMakeFiles/FooBarDemo.dir/MetadataWrapper.cpp.o.d"
+  "/root/repo/_lb/src/sample/component/_ccm_demo_CFoo.cpp" "src/sample/component/CMakeFiles/FooBarDemo.dir/_ccm_demo_CFoo.cpp.o" "gcc" "src/sample/component/CMakeFiles/FooBarDemo.dir/_ccm_demo_CFoo.cpp.o.d"
+  "/root/repo/_lb/src/sample/component/_ccm_demo_CFooBar.cpp" "src/sample/component/CMakeFiles/FooBarDemo.dir/_ccm_demo_CFooBar.cpp.o" "gcc" "src/sample/component/CMakeFiles/FooBarDemo.dir/_ccm_demo_CFooBar.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_lb/src/sample/component/FooBarDemoPub.cpp" "/root/repo/_lb/src/sample/component/_ccm_demo_CFoo.cpp"
+  "/root/repo/_lb/src/sample/component/MetadataWrapper.cpp" "/root/repo/_lb/src/sample/component/_ccm_demo_CFoo.cpp"
+  "/root/repo/_lb/src/sample/component/_ccm_demo_CFooBar.cpp" "/root/repo/_lb/src/sample/component/_ccm_demo_CFoo.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FooBarDemo.dir/CFoo.cpp.o"
+  "CMakeFiles/FooBarDemo.dir/CFoo.cpp.o.d"
+  "CMakeFiles/FooBarDemo.dir/CFooBar.cpp.o"
+  "CMakeFiles/FooBarDemo.dir/CFooBar.cpp.o.d"
+  "CMakeFiles/FooBarDemo.dir/FooBarDemoPub.cpp.o"
+  "CMakeFiles/FooBarDemo.dir/FooBarDemoPub.cpp.o.d"
+  "CMakeFiles/FooBarDemo.dir/MetadataWrapper.cpp.o"
+  "CMakeFiles/FooBarDemo.dir/MetadataWrapper.cpp.o.d"
+  "CMakeFiles/FooBarDemo.dir/_ccm_demo_CFoo.cpp.o"
+  "CMakeFiles/FooBarDemo.dir/_ccm_demo_CFoo.cpp.o.d"
+  "CMakeFiles/FooBarDemo.dir/_ccm_demo_CFooBar.cpp.o"
+  "CMakeFiles/FooBarDemo.dir/_ccm_demo_CFooBar.cpp.o.d"
+  "FooBarDemo.pdb"
+  "FooBarDemo.so"
+  "FooBarDemoPub.cpp"
+  "MetadataWrapper.cpp"
+  "_ccm_demo_CFoo.cpp"
+  "_ccm_demo_CFooBar.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FooBarDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,129 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "FooBarDemo.h"
+#include <ccmcomponent.h>
+#include <ccmrefbase.h>
+
+#include <atomic>
+
+using namespace ccm;
+
+extern const ComponentID CID_FooBarDemo =
+        {{0x6a07eff9,0x9090,0x41a9,0xbfc3,{0x6,0x7,0xe,0xb,0x3,0xe,0xd,0x8,0x0,0xf,0x4,0x9}},
+        "http://ccm.org/component/sample/FooBarDemo.so"};
+
+namespace ccm {
+namespace demo {
+
+const String MODULE_NAME("FooBarDemo");
+
+
+extern const InterfaceID IID_IFoo =
+        {{0x6e7582c4,0xe0ec,0x4474,0x9046,{0x7,0x0,0x2,0x7,0x3,0x2,0xe,0x1,0xe,0x9,0x6,0xd}}, &CID_FooBarDemo};
+extern const InterfaceID IID_IBar =
+        {{0xef1b8367,0xe32d,0x4dc0,0xb320,{0x6,0x8,0x8,0xc,0xf,0x4,0xd,0x9,0xb,0xd,0xe,0xc}}, &CID_FooBarDemo};
+extern const InterfaceID IID_ICFooBarClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_FooBarDemo};
+
+extern const CoclassID CID_CFoo =
+        {{0xb150ddc0,0x530b,0x411f,0x8462,{0xb,0x0,0x4,0x2,0x5,0x2,0xf,0xd,0x0,0x1,0x2,0xb}}, &CID_FooBarDemo};
+extern const CoclassID CID_CFooBar =
+        {{0x855db520,0x7f7a,0x4ad1,0xa60a,{0x7,0xd,0x8,0xd,0x3,0x4,0x6,0x1,0xb,0xe,0x7,0xb}}, &CID_FooBarDemo};
+
+} // namespace demo
+} // namespace ccm
+
+namespace ccm {
+namespace demo {
+
+extern ECode GetCFooClassObject(IClassObject** classObject);
+extern void ReleaseCFooClassObjectCache();
+extern ECode GetCFooBarClassObject(IClassObject** classObject);
+extern void ReleaseCFooBarClassObjectCache();
+} // namespace demo
+} // namespace ccm
+
+static ClassObjectGetter coFooBarDemoGetters[2] = {
+        {{0xb150ddc0,0x530b,0x411f,0x8462,{0xb,0x0,0x4,0x2,0x5,0x2,0xf,0xd,0x0,0x1,0x2,0xb}}, ccm::demo::GetCFooClassObject},
+        {{0x855db520,0x7f7a,0x4ad1,0xa60a,{0x7,0xd,0x8,0xd,0x3,0x4,0x6,0x1,0xb,0xe,0x7,0xb}}, ccm::demo::GetCFooBarClassObject}};
+
+EXTERN_C COM_PUBLIC ClassObjectGetter* soGetAllClassObjects(int* size)
+{
+    *size = sizeof(coFooBarDemoGetters) / sizeof(ClassObjectGetter);
+    return coFooBarDemoGetters;
+}
+
+EXTERN_C COM_PUBLIC ECode soGetClassObject(const CoclassID& cid, IClassObject** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    if (ccm::demo::CID_CFoo == cid) {
+        return ccm::demo::GetCFooClassObject(object);
+    }
+    else if (ccm::demo::CID_CFooBar == cid) {
+        return ccm::demo::GetCFooBarClassObject(object);
+    }
+
+    *object = nullptr;
+    return NOERROR;
+}
+
+class CFooBarDemo
+    : public LightRefBase
+{
+public:
+    CFooBarDemo();
+};
+CFooBarDemo::CFooBarDemo()
+{
+    AddRef();
+}
+
+static __attribute__ ((init_priority (200))) CFooBarDemo sComponentObject;
+
+// Lets the coclasses of this component create their objects without
+// the class loader. The class objects they cache are dropped when
+// the loader asks whether the component can be unloaded.
+static std::atomic<IMetaComponent*> sComponentMetadata(nullptr);
+
+EXTERN_C COM_PUBLIC Boolean soCanUnload()
+{
+    sComponentMetadata.store(nullptr, std::memory_order_release);
+    ccm::demo::ReleaseCFooClassObjectCache();
+    ccm::demo::ReleaseCFooBarClassObjectCache();
+    return sComponentObject.GetStrongCount() == 1;
+}
+
+void AddComponentCount()
+{
+    sComponentObject.AddRef();
+}
+
+void ReleaseComponentCount()
+{
+    sComponentObject.Release();
+}
+
+IMetaComponent* GetComponentMetadata()
+{
+    return sComponentMetadata.load(std::memory_order_acquire);
+}
+
+void SetComponentMetadata(IMetaComponent* component)
+{
+    sComponentMetadata.store(component, std::memory_order_release);
+}
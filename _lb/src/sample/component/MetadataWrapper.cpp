@@ -0,0 +1,263 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include <ccmdef.h>
+#include <stdint.h>
+
+struct MetadataWrapper
+{
+    int             mSize;
+    unsigned char   mMetadata[3736] __attribute__ ((aligned (8)));
+};
+
+static const MetadataWrapper comMetadata __attribute__ ((used,__section__ (".metadata"))) = {
+    3736, {
+    0xfd,0x20,0x2e,0x01,0x98,0x0e,0x00,0x00,0x02,0x00,0x00,0x00,0xf9,0xef,0x07,0x6a,
+    0x90,0x90,0xa9,0x41,0xc3,0xbf,0x06,0x07,0x0e,0x0b,0x03,0x0e,0x0d,0x08,0x00,0x0f,
+    0x04,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0xb1,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb4,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x09,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe8,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf8,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x28,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x88,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x98,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb8,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x6f,0x6f,0x42,0x61,0x72,0x44,
+    0x65,0x6d,0x6f,0x00,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x63,0x63,0x6d,0x2e,0x6f,
+    0x72,0x67,0x2f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x2f,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x2f,0x46,0x6f,0x6f,0x42,0x61,0x72,0x44,0x65,0x6d,0x6f,0x2e,0x73,
+    0x6f,0x00,0x63,0x63,0x6d,0x3a,0x3a,0x00,0x63,0x63,0x6d,0x3a,0x3a,0x64,0x65,0x6d,
+    0x6f,0x3a,0x3a,0x00,0x53,0x45,0x52,0x49,0x41,0x4c,0x49,0x5a,0x45,0x5f,0x4e,0x55,
+    0x4d,0x42,0x45,0x52,0x00,0x4d,0x4f,0x44,0x55,0x4c,0x45,0x5f,0x4e,0x41,0x4d,0x45,
+    0x00,0x43,0x46,0x6f,0x6f,0x00,0x43,0x46,0x6f,0x6f,0x42,0x61,0x72,0x00,0x49,0x49,
+    0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x00,0x50,0x72,0x6f,0x62,0x65,0x00,0x28,
+    0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,
+    0x29,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,
+    0x3b,0x2a,0x00,0x69,0x69,0x64,0x00,0x41,0x64,0x64,0x52,0x65,0x66,0x00,0x28,0x48,
+    0x29,0x49,0x00,0x69,0x64,0x00,0x52,0x65,0x6c,0x65,0x61,0x73,0x65,0x00,0x47,0x65,
+    0x74,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x49,0x44,0x00,0x28,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,0x2a,0x55,
+    0x2a,0x29,0x45,0x00,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x49,0x46,0x6f,0x6f,0x00,
+    0x46,0x6f,0x6f,0x00,0x28,0x49,0x29,0x45,0x00,0x64,0x61,0x74,0x61,0x00,0x49,0x42,
+    0x61,0x72,0x00,0x42,0x61,0x72,0x00,0x28,0x54,0x29,0x45,0x00,0x49,0x43,0x6c,0x61,
+    0x73,0x73,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x41,0x74,0x74,0x61,0x63,0x68,0x4d,
+    0x65,0x74,0x61,0x64,0x61,0x74,0x61,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,
+    0x65,0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x3b,0x2a,0x29,0x45,
+    0x00,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x00,0x47,0x65,0x74,0x4d,0x65,
+    0x74,0x61,0x64,0x61,0x74,0x65,0x00,0x28,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,
+    0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x3b,0x2a,0x2a,0x29,0x45,
+    0x00,0x43,0x72,0x65,0x61,0x74,0x65,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x28,0x55,
+    0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,
+    0x2a,0x2a,0x29,0x45,0x00,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,
+    0x65,0x6e,0x74,0x00,0x49,0x43,0x46,0x6f,0x6f,0x42,0x61,0x72,0x43,0x6c,0x61,0x73,
+    0x73,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x28,0x29,0x45,0x00,0x28,0x4c,0x29,0x45,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x22,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x74,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xef,0xcd,0xab,0x89,0x67,0x45,0x23,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x65,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf9,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc0,0xdd,0x50,0xb1,0x0b,0x53,0x1f,0x41,0x62,0x84,0x0b,0x00,0x04,0x02,0x05,0x02,
+    0x0f,0x0d,0x00,0x01,0x02,0x0b,0x00,0x00,0x39,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x08,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0xb5,0x5d,0x85,0x7a,0x7f,0xd1,0x4a,
+    0x0a,0xa6,0x07,0x0d,0x08,0x0d,0x03,0x04,0x06,0x01,0x0b,0x0e,0x07,0x0b,0x00,0x00,
+    0xf6,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xae,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0x6a,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x4f,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x27,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0x26,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xce,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8e,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x18,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x13,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc4,0x82,0x75,0x6e,0xec,0xe0,0x74,0x44,
+    0x46,0x90,0x07,0x00,0x02,0x07,0x03,0x02,0x0e,0x01,0x0e,0x09,0x06,0x0d,0x00,0x00,
+    0x1b,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0x60,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd0,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xcc,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x18,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa9,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x83,0x1b,0xef,0x2d,0xe3,0xc0,0x4d,
+    0x20,0xb3,0x06,0x08,0x08,0x0c,0x0f,0x04,0x0d,0x09,0x0b,0x0d,0x0e,0x0c,0x00,0x00,
+    0x6e,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x23,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x18,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe9,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,
+    0xbc,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xda,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x69,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0x70,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x18,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x61,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x47,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0x18,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x11,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0x16,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x18,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x24,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x95,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x2a,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x44,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb9,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xf8,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb3,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcc,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x31,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0x74,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x79,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xf5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x14,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00}};
+
+COM_PUBLIC extern const uintptr_t soMetadataHandle = reinterpret_cast<uintptr_t>(&comMetadata);
@@ -0,0 +1,176 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CFoo.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace demo {
+
+class CFooClassObject
+    : public ClassObject
+{
+public:
+    CFooClassObject();
+
+    ~CFooClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CFooClassObject* sCFooClassObject = nullptr;
+static std::atomic<CFooClassObject*> sCFooCachedClassObject(nullptr);
+static Spinlock& GetCFooClassObjectLock()
+{
+    static Spinlock sCFooClassObjectLock;
+    return sCFooClassObjectLock;
+}
+
+CFooClassObject::CFooClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CFooClassObject::~CFooClassObject()
+{
+    Spinlock& lock = GetCFooClassObjectLock();
+    lock.Lock();
+    sCFooClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CFooClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CFooClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFoo), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFoo* _obj = new(addr) CFoo();
+    _obj->AttachMetadata(mComponent, "ccm::demo::CFoo");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCFooClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCFooClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCFooClassObject == nullptr) {
+        sCFooClassObject = new CFooClassObject();
+    }
+    else if (sCFooClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCFooClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCFooClassObject;
+    return NOERROR;
+}
+
+static CFooClassObject* GetCachedCFooClassObject()
+{
+    CFooClassObject* clsObject = sCFooCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCFooClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCFooCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCFooClassObject == nullptr) {
+            sCFooClassObject = new CFooClassObject();
+        }
+        else if (sCFooClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCFooClassObject;
+        clsObject->AddRef();
+        sCFooCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCFooClassObjectCache()
+{
+    Spinlock& lock = GetCFooClassObjectLock();
+    lock.Lock();
+    CFooClassObject* clsObject = sCFooCachedClassObject.load(std::memory_order_relaxed);
+    sCFooCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CFoo::_CFoo()
+{
+    sCFooClassObject->AddRef();
+}
+
+_CFoo::~_CFoo()
+{
+    sCFooClassObject->Release();
+}
+
+ECode _CFoo::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFooClassObject* cachedClsObject = GetCachedCFooClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CFoo, iid, nullptr, object);
+};
+
+} // namespace demo
+} // namespace ccm
@@ -0,0 +1,45 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_DEMO_CFOO_H_GEN__
+#define __CCM_DEMO_CFOO_H_GEN__
+
+#include "FooBarDemo.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace demo {
+
+extern const CoclassID CID_CFoo;
+
+COCLASS_ID(b150ddc0-530b-411f-8462-b04252fd012b)
+class _CFoo
+{
+public:
+    _CFoo();
+
+    virtual ~_CFoo();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace demo
+} // namespace ccm
+
+#endif // __CCM_DEMO_CFOO_H_GEN__
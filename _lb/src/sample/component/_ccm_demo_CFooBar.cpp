@@ -0,0 +1,230 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CFooBar.h"
+#include "ccm.demo.ICFooBarClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace demo {
+
+class CFooBarClassObject
+    : public ClassObject
+    , public ICFooBarClassObject
+{
+public:
+    CFooBarClassObject();
+
+    ~CFooBarClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ Long data,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CFooBarClassObject* sCFooBarClassObject = nullptr;
+static std::atomic<CFooBarClassObject*> sCFooBarCachedClassObject(nullptr);
+static Spinlock& GetCFooBarClassObjectLock()
+{
+    static Spinlock sCFooBarClassObjectLock;
+    return sCFooBarClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CFooBarClassObject, ClassObject, ICFooBarClassObject);
+
+CFooBarClassObject::CFooBarClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CFooBarClassObject::~CFooBarClassObject()
+{
+    Spinlock& lock = GetCFooBarClassObjectLock();
+    lock.Lock();
+    sCFooBarClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CFooBarClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CFooBarClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFooBar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFooBar* _obj = new(addr) CFooBar();
+    ECode ec = _obj->Constructor();
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::demo::CFooBar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode CFooBarClassObject::CreateObject(
+    /* [in] */ Long data,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CFooBar), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CFooBar* _obj = new(addr) CFooBar();
+    ECode ec = _obj->Constructor(data);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::demo::CFooBar");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCFooBarClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCFooBarClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCFooBarClassObject == nullptr) {
+        sCFooBarClassObject = new CFooBarClassObject();
+    }
+    else if (sCFooBarClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCFooBarClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCFooBarClassObject;
+    return NOERROR;
+}
+
+static CFooBarClassObject* GetCachedCFooBarClassObject()
+{
+    CFooBarClassObject* clsObject = sCFooBarCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCFooBarClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCFooBarCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCFooBarClassObject == nullptr) {
+            sCFooBarClassObject = new CFooBarClassObject();
+        }
+        else if (sCFooBarClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCFooBarClassObject;
+        clsObject->AddRef();
+        sCFooBarCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCFooBarClassObjectCache()
+{
+    Spinlock& lock = GetCFooBarClassObjectLock();
+    lock.Lock();
+    CFooBarClassObject* clsObject = sCFooBarCachedClassObject.load(std::memory_order_relaxed);
+    sCFooBarCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CFooBar::_CFooBar()
+{
+    sCFooBarClassObject->AddRef();
+}
+
+_CFooBar::~_CFooBar()
+{
+    sCFooBarClassObject->Release();
+}
+
+ECode _CFooBar::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFooBarClassObject* cachedClsObject = GetCachedCFooBarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CFooBar, iid, nullptr, object);
+};
+
+ECode _CFooBar::New(
+    /* [in] */ Long data,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CFooBarClassObject* cachedClsObject = GetCachedCFooBarClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(data, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CFooBar, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICFooBarClassObject::Probe(clsObject)->CreateObject(data, iid, object);
+};
+
+} // namespace demo
+} // namespace ccm
@@ -0,0 +1,50 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_DEMO_CFOOBAR_H_GEN__
+#define __CCM_DEMO_CFOOBAR_H_GEN__
+
+#include "FooBarDemo.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace demo {
+
+extern const CoclassID CID_CFooBar;
+
+COCLASS_ID(855db520-7f7a-4ad1-a60a-7d8d3461be7b)
+class _CFooBar
+{
+public:
+    _CFooBar();
+
+    virtual ~_CFooBar();
+
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    static ECode New(
+        /* [in] */ Long data,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace demo
+} // namespace ccm
+
+#endif // __CCM_DEMO_CFOOBAR_H_GEN__
@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_DEMO_IBAR_H_GEN__
+#define __CCM_DEMO_IBAR_H_GEN__
+
+#include "FooBarDemo.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace demo {
+
+extern const InterfaceID IID_IBar;
+
+INTERFACE_ID(ef1b8367-e32d-4dc0-b320-688cf4d9bdec)
+interface IBar : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IBar* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IBar*)object->Probe(IID_IBar);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IBar;
+    }
+
+    virtual ECode Bar(
+        /* [in] */ const String& data) = 0;
+};
+
+} // namespace demo
+} // namespace ccm
+
+#endif // __CCM_DEMO_IBAR_H_GEN__
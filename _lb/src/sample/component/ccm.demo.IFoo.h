@@ -0,0 +1,53 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_DEMO_IFOO_H_GEN__
+#define __CCM_DEMO_IFOO_H_GEN__
+
+#include "FooBarDemo.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace demo {
+
+extern const InterfaceID IID_IFoo;
+
+INTERFACE_ID(6e7582c4-e0ec-4474-9046-702732e1e96d)
+interface IFoo : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IFoo* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IFoo*)object->Probe(IID_IFoo);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IFoo;
+    }
+
+    virtual ECode Foo(
+        /* [in] */ Integer data) = 0;
+};
+
+} // namespace demo
+} // namespace ccm
+
+#endif // __CCM_DEMO_IFOO_H_GEN__
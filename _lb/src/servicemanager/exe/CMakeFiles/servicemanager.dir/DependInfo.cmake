@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/servicemanager/exe/ServiceManager.cpp" "src/servicemanager/exe/CMakeFiles/servicemanager.dir/ServiceManager.cpp.o" "gcc" "src/servicemanager/exe/CMakeFiles/servicemanager.dir/ServiceManager.cpp.o.d"
+  "/root/repo/src/servicemanager/exe/main.cpp" "src/servicemanager/exe/CMakeFiles/servicemanager.dir/main.cpp.o" "gcc" "src/servicemanager/exe/CMakeFiles/servicemanager.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/servicemanager.dir/ServiceManager.cpp.o"
+  "CMakeFiles/servicemanager.dir/ServiceManager.cpp.o.d"
+  "CMakeFiles/servicemanager.dir/main.cpp.o"
+  "CMakeFiles/servicemanager.dir/main.cpp.o.d"
+  "servicemanager"
+  "servicemanager.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/servicemanager.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libservicemanager.dir/ServiceManager.cpp.o"
+  "CMakeFiles/libservicemanager.dir/ServiceManager.cpp.o.d"
+  "libservicemanager.pdb"
+  "libservicemanager.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libservicemanager.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
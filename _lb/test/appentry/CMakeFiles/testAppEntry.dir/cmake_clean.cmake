@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testAppEntry.dir/libcore.cpp.o"
+  "CMakeFiles/testAppEntry.dir/libcore.cpp.o.d"
+  "CMakeFiles/testAppEntry.dir/main.cpp.o"
+  "CMakeFiles/testAppEntry.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testAppEntry"
+  "testAppEntry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testAppEntry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
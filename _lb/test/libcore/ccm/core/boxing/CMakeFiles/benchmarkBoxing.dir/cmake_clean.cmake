@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarkBoxing.dir/libcore.cpp.o"
+  "CMakeFiles/benchmarkBoxing.dir/libcore.cpp.o.d"
+  "CMakeFiles/benchmarkBoxing.dir/main.cpp.o"
+  "CMakeFiles/benchmarkBoxing.dir/main.cpp.o.d"
+  "benchmarkBoxing"
+  "benchmarkBoxing.pdb"
+  "libcore.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarkBoxing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
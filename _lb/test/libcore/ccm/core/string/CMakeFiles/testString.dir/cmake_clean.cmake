@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testString.dir/libcore.cpp.o"
+  "CMakeFiles/testString.dir/libcore.cpp.o.d"
+  "CMakeFiles/testString.dir/main.cpp.o"
+  "CMakeFiles/testString.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testString"
+  "testString.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testString.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
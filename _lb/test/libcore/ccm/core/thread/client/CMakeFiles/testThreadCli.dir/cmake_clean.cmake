@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testThreadCli.dir/libcore.cpp.o"
+  "CMakeFiles/testThreadCli.dir/libcore.cpp.o.d"
+  "CMakeFiles/testThreadCli.dir/main.cpp.o"
+  "CMakeFiles/testThreadCli.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testThreadCli"
+  "testThreadCli.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testThreadCli.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCharset.dir/libcore.cpp.o"
+  "CMakeFiles/testCharset.dir/libcore.cpp.o.d"
+  "CMakeFiles/testCharset.dir/main.cpp.o"
+  "CMakeFiles/testCharset.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testCharset"
+  "testCharset.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCharset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
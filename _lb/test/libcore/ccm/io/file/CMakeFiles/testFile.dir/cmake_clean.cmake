@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testFile.dir/libcore.cpp.o"
+  "CMakeFiles/testFile.dir/libcore.cpp.o.d"
+  "CMakeFiles/testFile.dir/main.cpp.o"
+  "CMakeFiles/testFile.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testFile"
+  "testFile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testFile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testFileInputStream.dir/libcore.cpp.o"
+  "CMakeFiles/testFileInputStream.dir/libcore.cpp.o.d"
+  "CMakeFiles/testFileInputStream.dir/main.cpp.o"
+  "CMakeFiles/testFileInputStream.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testFileInputStream"
+  "testFileInputStream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testFileInputStream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBigDecimal.dir/libcore.cpp.o"
+  "CMakeFiles/testBigDecimal.dir/libcore.cpp.o.d"
+  "CMakeFiles/testBigDecimal.dir/main.cpp.o"
+  "CMakeFiles/testBigDecimal.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testBigDecimal"
+  "testBigDecimal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBigDecimal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
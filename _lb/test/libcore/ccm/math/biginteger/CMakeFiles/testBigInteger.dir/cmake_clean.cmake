@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBigInteger.dir/libcore.cpp.o"
+  "CMakeFiles/testBigInteger.dir/libcore.cpp.o.d"
+  "CMakeFiles/testBigInteger.dir/main.cpp.o"
+  "CMakeFiles/testBigInteger.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testBigInteger"
+  "testBigInteger.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBigInteger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
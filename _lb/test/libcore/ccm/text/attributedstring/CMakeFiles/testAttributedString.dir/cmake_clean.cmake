@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testAttributedString.dir/libcore.cpp.o"
+  "CMakeFiles/testAttributedString.dir/libcore.cpp.o.d"
+  "CMakeFiles/testAttributedString.dir/main.cpp.o"
+  "CMakeFiles/testAttributedString.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testAttributedString"
+  "testAttributedString.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testAttributedString.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
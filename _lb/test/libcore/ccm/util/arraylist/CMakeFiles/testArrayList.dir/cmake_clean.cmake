@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArrayList.dir/libcore.cpp.o"
+  "CMakeFiles/testArrayList.dir/libcore.cpp.o.d"
+  "CMakeFiles/testArrayList.dir/main.cpp.o"
+  "CMakeFiles/testArrayList.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testArrayList"
+  "testArrayList.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArrayList.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCalendar.dir/libcore.cpp.o"
+  "CMakeFiles/testCalendar.dir/libcore.cpp.o.d"
+  "CMakeFiles/testCalendar.dir/main.cpp.o"
+  "CMakeFiles/testCalendar.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testCalendar"
+  "testCalendar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCalendar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testConcurrentHashMap.dir/libcore.cpp.o"
+  "CMakeFiles/testConcurrentHashMap.dir/libcore.cpp.o.d"
+  "CMakeFiles/testConcurrentHashMap.dir/main.cpp.o"
+  "CMakeFiles/testConcurrentHashMap.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testConcurrentHashMap"
+  "testConcurrentHashMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testConcurrentHashMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
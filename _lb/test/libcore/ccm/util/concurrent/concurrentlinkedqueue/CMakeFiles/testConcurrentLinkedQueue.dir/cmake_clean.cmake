@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testConcurrentLinkedQueue.dir/libcore.cpp.o"
+  "CMakeFiles/testConcurrentLinkedQueue.dir/libcore.cpp.o.d"
+  "CMakeFiles/testConcurrentLinkedQueue.dir/main.cpp.o"
+  "CMakeFiles/testConcurrentLinkedQueue.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testConcurrentLinkedQueue"
+  "testConcurrentLinkedQueue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testConcurrentLinkedQueue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
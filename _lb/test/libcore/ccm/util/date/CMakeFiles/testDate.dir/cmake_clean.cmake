@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDate.dir/libcore.cpp.o"
+  "CMakeFiles/testDate.dir/libcore.cpp.o.d"
+  "CMakeFiles/testDate.dir/main.cpp.o"
+  "CMakeFiles/testDate.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testDate"
+  "testDate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
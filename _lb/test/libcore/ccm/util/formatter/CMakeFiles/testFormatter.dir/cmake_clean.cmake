@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testFormatter.dir/libcore.cpp.o"
+  "CMakeFiles/testFormatter.dir/libcore.cpp.o.d"
+  "CMakeFiles/testFormatter.dir/main.cpp.o"
+  "CMakeFiles/testFormatter.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testFormatter"
+  "testFormatter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testFormatter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testHashMap.dir/libcore.cpp.o"
+  "CMakeFiles/testHashMap.dir/libcore.cpp.o.d"
+  "CMakeFiles/testHashMap.dir/main.cpp.o"
+  "CMakeFiles/testHashMap.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testHashMap"
+  "testHashMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testHashMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
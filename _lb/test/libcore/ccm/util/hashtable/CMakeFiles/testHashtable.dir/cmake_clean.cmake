@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testHashtable.dir/libcore.cpp.o"
+  "CMakeFiles/testHashtable.dir/libcore.cpp.o.d"
+  "CMakeFiles/testHashtable.dir/main.cpp.o"
+  "CMakeFiles/testHashtable.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testHashtable"
+  "testHashtable.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testHashtable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
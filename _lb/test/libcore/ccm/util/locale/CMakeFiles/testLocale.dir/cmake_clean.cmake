@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLocale.dir/libcore.cpp.o"
+  "CMakeFiles/testLocale.dir/libcore.cpp.o.d"
+  "CMakeFiles/testLocale.dir/main.cpp.o"
+  "CMakeFiles/testLocale.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testLocale"
+  "testLocale.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLocale.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testRandom.dir/libcore.cpp.o"
+  "CMakeFiles/testRandom.dir/libcore.cpp.o.d"
+  "CMakeFiles/testRandom.dir/main.cpp.o"
+  "CMakeFiles/testRandom.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testRandom"
+  "testRandom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testRandom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
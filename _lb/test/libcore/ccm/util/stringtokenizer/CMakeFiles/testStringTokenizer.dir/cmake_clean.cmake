@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testStringTokenizer.dir/libcore.cpp.o"
+  "CMakeFiles/testStringTokenizer.dir/libcore.cpp.o.d"
+  "CMakeFiles/testStringTokenizer.dir/main.cpp.o"
+  "CMakeFiles/testStringTokenizer.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testStringTokenizer"
+  "testStringTokenizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testStringTokenizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
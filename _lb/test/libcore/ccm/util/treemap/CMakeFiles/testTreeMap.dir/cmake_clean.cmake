@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testTreeMap.dir/libcore.cpp.o"
+  "CMakeFiles/testTreeMap.dir/libcore.cpp.o.d"
+  "CMakeFiles/testTreeMap.dir/main.cpp.o"
+  "CMakeFiles/testTreeMap.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testTreeMap"
+  "testTreeMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testTreeMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testVector.dir/libcore.cpp.o"
+  "CMakeFiles/testVector.dir/libcore.cpp.o.d"
+  "CMakeFiles/testVector.dir/main.cpp.o"
+  "CMakeFiles/testVector.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testVector"
+  "testVector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testVector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
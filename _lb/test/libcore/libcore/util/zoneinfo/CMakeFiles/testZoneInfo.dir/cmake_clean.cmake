@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testZoneInfo.dir/ZoneInfoTestHelper.cpp.o"
+  "CMakeFiles/testZoneInfo.dir/ZoneInfoTestHelper.cpp.o.d"
+  "CMakeFiles/testZoneInfo.dir/libcore.cpp.o"
+  "CMakeFiles/testZoneInfo.dir/libcore.cpp.o.d"
+  "CMakeFiles/testZoneInfo.dir/main.cpp.o"
+  "CMakeFiles/testZoneInfo.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testZoneInfo"
+  "testZoneInfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testZoneInfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
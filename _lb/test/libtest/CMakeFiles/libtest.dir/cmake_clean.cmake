@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libtest.dir/libcore.cpp.o"
+  "CMakeFiles/libtest.dir/libcore.cpp.o.d"
+  "CMakeFiles/libtest.dir/wrapper.cpp.o"
+  "CMakeFiles/libtest.dir/wrapper.cpp.o.d"
+  "libcore.cpp"
+  "libtest.a"
+  "libtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
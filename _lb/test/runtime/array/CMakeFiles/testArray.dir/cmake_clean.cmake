@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArray.dir/libcore.cpp.o"
+  "CMakeFiles/testArray.dir/libcore.cpp.o.d"
+  "CMakeFiles/testArray.dir/main.cpp.o"
+  "CMakeFiles/testArray.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testArray"
+  "testArray.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArray.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
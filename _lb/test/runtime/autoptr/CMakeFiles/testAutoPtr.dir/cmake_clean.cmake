@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testAutoPtr.dir/main.cpp.o"
+  "CMakeFiles/testAutoPtr.dir/main.cpp.o.d"
+  "testAutoPtr"
+  "testAutoPtr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testAutoPtr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
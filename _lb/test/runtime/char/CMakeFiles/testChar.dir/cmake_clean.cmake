@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testChar.dir/libcore.cpp.o"
+  "CMakeFiles/testChar.dir/libcore.cpp.o.d"
+  "CMakeFiles/testChar.dir/main.cpp.o"
+  "CMakeFiles/testChar.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testChar"
+  "testChar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testChar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
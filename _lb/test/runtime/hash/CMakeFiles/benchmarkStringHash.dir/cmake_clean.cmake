@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarkStringHash.dir/main.cpp.o"
+  "CMakeFiles/benchmarkStringHash.dir/main.cpp.o.d"
+  "benchmarkStringHash"
+  "benchmarkStringHash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarkStringHash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLocalStaticVariable.dir/libcore.cpp.o"
+  "CMakeFiles/testLocalStaticVariable.dir/libcore.cpp.o.d"
+  "CMakeFiles/testLocalStaticVariable.dir/main.cpp.o"
+  "CMakeFiles/testLocalStaticVariable.dir/main.cpp.o.d"
+  "libcore.cpp"
+  "testLocalStaticVariable"
+  "testLocalStaticVariable.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLocalStaticVariable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMacro.dir/main.cpp.o"
+  "CMakeFiles/testMacro.dir/main.cpp.o.d"
+  "testMacro"
+  "testMacro.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMacro.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
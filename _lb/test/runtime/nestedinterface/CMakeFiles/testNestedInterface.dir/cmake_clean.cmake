@@ -0,0 +1,22 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testNestedInterface.dir/CFooBar.cpp.o"
+  "CMakeFiles/testNestedInterface.dir/CFooBar.cpp.o.d"
+  "CMakeFiles/testNestedInterface.dir/MetadataWrapper.cpp.o"
+  "CMakeFiles/testNestedInterface.dir/MetadataWrapper.cpp.o.d"
+  "CMakeFiles/testNestedInterface.dir/NestedInterfaceTestPub.cpp.o"
+  "CMakeFiles/testNestedInterface.dir/NestedInterfaceTestPub.cpp.o.d"
+  "CMakeFiles/testNestedInterface.dir/_ccm_test_CFooBar.cpp.o"
+  "CMakeFiles/testNestedInterface.dir/_ccm_test_CFooBar.cpp.o.d"
+  "CMakeFiles/testNestedInterface.dir/main.cpp.o"
+  "CMakeFiles/testNestedInterface.dir/main.cpp.o.d"
+  "MetadataWrapper.cpp"
+  "NestedInterfaceTestPub.cpp"
+  "_ccm_test_CFooBar.cpp"
+  "testNestedInterface"
+  "testNestedInterface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testNestedInterface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
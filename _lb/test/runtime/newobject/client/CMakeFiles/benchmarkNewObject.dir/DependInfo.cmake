@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_lb/test/runtime/newobject/client/NewObjectTestUnit.cpp" "test/runtime/newobject/client/CMakeFiles/benchmarkNewObject.dir/NewObjectTestUnit.cpp.o" "gcc" "test/runtime/newobject/client/CMakeFiles/benchmarkNewObject.dir/NewObjectTestUnit.cpp.o.d"
+  "/root/repo/test/runtime/newobject/client/main.cpp" "test/runtime/newobject/client/CMakeFiles/benchmarkNewObject.dir/main.cpp.o" "gcc" "test/runtime/newobject/client/CMakeFiles/benchmarkNewObject.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarkNewObject.dir/NewObjectTestUnit.cpp.o"
+  "CMakeFiles/benchmarkNewObject.dir/NewObjectTestUnit.cpp.o.d"
+  "CMakeFiles/benchmarkNewObject.dir/main.cpp.o"
+  "CMakeFiles/benchmarkNewObject.dir/main.cpp.o.d"
+  "NewObjectTestUnit.cpp"
+  "benchmarkNewObject"
+  "benchmarkNewObject.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarkNewObject.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,69 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "NewObjectTestUnit.h"
+
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+
+using namespace ccm;
+
+extern const ComponentID CID_NewObjectTestUnit =
+        {{0x41381e71,0xd859,0x46f9,0xad6a,{0x4,0xa,0x6,0x1,0x9,0x7,0x7,0xb,0x6,0x5,0x3,0xd}},
+        "http://ccm.org/component/test/newobject/NewObjectTestUnit.so"};
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+
+extern const InterfaceID IID_IValue =
+        {{0xdf65af6b,0xbb24,0x4566,0x8c18,{0x3,0x1,0x0,0x2,0x2,0x3,0xa,0xc,0xa,0x1,0xa,0x8}}, &CID_NewObjectTestUnit};
+extern const InterfaceID IID_IValueFactory =
+        {{0xaed5926c,0x40dd,0x4b02,0xaa07,{0x5,0x0,0xd,0x6,0xb,0xa,0xe,0x3,0x0,0xf,0x9,0x7}}, &CID_NewObjectTestUnit};
+extern const InterfaceID IID_ICValueClassObject =
+        {{0x00000000,0x0000,0x0000,0x0000,{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}, &CID_NewObjectTestUnit};
+
+extern const CoclassID CID_CValue =
+        {{0x39d1a97a,0x9ac5,0x4942,0xb618,{0xc,0x6,0xe,0xd,0xb,0xa,0x2,0x6,0x2,0x9,0x1,0xc}}, &CID_NewObjectTestUnit};
+extern const CoclassID CID_CValueFactory =
+        {{0x1cfb6f4d,0x4901,0x4f4b,0x8e8f,{0xb,0xc,0x9,0x3,0xd,0x1,0x5,0xd,0x2,0x3,0x4,0x3}}, &CID_NewObjectTestUnit};
+
+// CValue
+ECode CValue::New(
+    /* [in] */ Integer value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CValue, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICValueClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+
+// CValueFactory
+ECode CValueFactory::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    return CoCreateObjectInstance(CID_CValueFactory, iid, nullptr, object);
+};
+
+
+} // namespace newobject
+} // namespace test
+} // namespace ccm
@@ -0,0 +1,145 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __NEWOBJECTTESTUNIT_H_GEN__
+#define __NEWOBJECTTESTUNIT_H_GEN__
+
+#include <ccmtypes.h>
+
+using namespace ccm;
+
+extern const ComponentID CID_NewObjectTestUnit;
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+extern const InterfaceID IID_IValue;
+extern const InterfaceID IID_IValueFactory;
+extern const InterfaceID IID_ICValueClassObject;
+interface IValue;
+interface IValueFactory;
+interface ICValueClassObject;
+
+} // namespace newobject
+} // namespace test
+} // namespace ccm
+
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+INTERFACE_ID(df65af6b-bb24-4566-8c18-310223aca1a8)
+interface IValue : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IValue* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IValue*)object->Probe(IID_IValue);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IValue;
+    }
+
+    virtual ECode GetValue(
+        /* [out] */ Integer* value) = 0;
+};
+
+
+INTERFACE_ID(aed5926c-40dd-4b02-aa07-50d6bae30f97)
+interface IValueFactory : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IValueFactory* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IValueFactory*)object->Probe(IID_IValueFactory);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IValueFactory;
+    }
+
+    virtual ECode Create(
+        /* [in] */ Integer value,
+        /* [out] */ ccm::test::newobject::IValue** object) = 0;
+};
+
+
+INTERFACE_ID(00000000-0000-0000-0000-000000000000)
+interface ICValueClassObject : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ICValueClassObject* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ICValueClassObject*)object->Probe(IID_ICValueClassObject);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_ICValueClassObject;
+    }
+
+    virtual ECode CreateObject(
+        /* [in] */ Integer value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object) = 0;
+};
+
+
+extern const CoclassID CID_CValue;
+
+COCLASS_ID(39d1a97a-9ac5-4942-b618-c6edba26291c)
+class CValue
+{
+public:
+    static ECode New(
+        /* [in] */ Integer value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+
+extern const CoclassID CID_CValueFactory;
+
+COCLASS_ID(1cfb6f4d-4901-4f4b-8e8f-bc93d15d2343)
+class CValueFactory
+{
+public:
+    static ECode New(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+
+} // namespace newobject
+} // namespace test
+} // namespace ccm
+
+
+#endif // __NEWOBJECTTESTUNIT_H_GEN__
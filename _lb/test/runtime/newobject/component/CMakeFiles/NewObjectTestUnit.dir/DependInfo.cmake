@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/runtime/newobject/component/CValue.cpp" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/CValue.cpp.o" "gcc" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/CValue.cpp.o.d"
+  "/root/repo/test/runtime/newobject/component/CValueFactory.cpp" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/CValueFactory.cpp.o" "gcc" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/CValueFactory.cpp.o.d"
+  "/root/repo/_lb/test/runtime/newobject/component/MetadataWrapper.cpp" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/MetadataWrapper.cpp.o" "gcc" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/MetadataWrapper.cpp.o.d"
+  "/root/repo/_lb/test/runtime/newobject/component/NewObjectTestUnitPub.cpp" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/NewObjectTestUnitPub.cpp.o" "gcc" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/NewObjectTestUnitPub.cpp.o.d"
+  "/root/repo/_lb/test/runtime/newobject/component/_ccm_test_newobject_CValue.cpp" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/_ccm_test_newobject_CValue.cpp.o" "gcc" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/_ccm_test_newobject_CValue.cpp.o.d"
+  "/root/repo/_lb/test/runtime/newobject/component/_ccm_test_newobject_CValueFactory.cpp" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/_ccm_test_newobject_CValueFactory.cpp.o" "gcc" "test/runtime/newobject/component/CMakeFiles/NewObjectTestUnit.dir/_ccm_test_newobject_CValueFactory.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_lb/test/runtime/newobject/component/MetadataWrapper.cpp" "/root/repo/_lb/test/runtime/newobject/component/_ccm_test_newobject_CValue.cpp"
+  "/root/repo/_lb/test/runtime/newobject/component/NewObjectTestUnitPub.cpp" "/root/repo/_lb/test/runtime/newobject/component/_ccm_test_newobject_CValue.cpp"
+  "/root/repo/_lb/test/runtime/newobject/component/_ccm_test_newobject_CValueFactory.cpp" "/root/repo/_lb/test/runtime/newobject/component/_ccm_test_newobject_CValue.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
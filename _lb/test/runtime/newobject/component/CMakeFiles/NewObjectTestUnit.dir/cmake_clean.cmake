@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NewObjectTestUnit.dir/CValue.cpp.o"
+  "CMakeFiles/NewObjectTestUnit.dir/CValue.cpp.o.d"
+  "CMakeFiles/NewObjectTestUnit.dir/CValueFactory.cpp.o"
+  "CMakeFiles/NewObjectTestUnit.dir/CValueFactory.cpp.o.d"
+  "CMakeFiles/NewObjectTestUnit.dir/MetadataWrapper.cpp.o"
+  "CMakeFiles/NewObjectTestUnit.dir/MetadataWrapper.cpp.o.d"
+  "CMakeFiles/NewObjectTestUnit.dir/NewObjectTestUnitPub.cpp.o"
+  "CMakeFiles/NewObjectTestUnit.dir/NewObjectTestUnitPub.cpp.o.d"
+  "CMakeFiles/NewObjectTestUnit.dir/_ccm_test_newobject_CValue.cpp.o"
+  "CMakeFiles/NewObjectTestUnit.dir/_ccm_test_newobject_CValue.cpp.o.d"
+  "CMakeFiles/NewObjectTestUnit.dir/_ccm_test_newobject_CValueFactory.cpp.o"
+  "CMakeFiles/NewObjectTestUnit.dir/_ccm_test_newobject_CValueFactory.cpp.o.d"
+  "MetadataWrapper.cpp"
+  "NewObjectTestUnit.pdb"
+  "NewObjectTestUnit.so"
+  "NewObjectTestUnitPub.cpp"
+  "_ccm_test_newobject_CValue.cpp"
+  "_ccm_test_newobject_CValueFactory.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NewObjectTestUnit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
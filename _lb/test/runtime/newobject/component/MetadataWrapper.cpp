@@ -0,0 +1,263 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include <ccmdef.h>
+#include <stdint.h>
+
+struct MetadataWrapper
+{
+    int             mSize;
+    unsigned char   mMetadata[3736] __attribute__ ((aligned (8)));
+};
+
+static const MetadataWrapper comMetadata __attribute__ ((used,__section__ (".metadata"))) = {
+    3736, {
+    0xfd,0x20,0x2e,0x01,0x98,0x0e,0x00,0x00,0x02,0x00,0x00,0x00,0x71,0x1e,0x38,0x41,
+    0x59,0xd8,0xf9,0x46,0x6a,0xad,0x04,0x0a,0x06,0x01,0x09,0x07,0x07,0x0b,0x06,0x05,
+    0x03,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0xb9,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x60,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x88,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xc8,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd8,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe8,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf8,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x28,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x58,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x88,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x98,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa8,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x4e,0x65,0x77,0x4f,0x62,0x6a,0x65,0x63,0x74,0x54,0x65,0x73,0x74,0x55,0x6e,
+    0x69,0x74,0x00,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x63,0x63,0x6d,0x2e,0x6f,0x72,
+    0x67,0x2f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x2f,0x74,0x65,0x73,0x74,
+    0x2f,0x6e,0x65,0x77,0x6f,0x62,0x6a,0x65,0x63,0x74,0x2f,0x4e,0x65,0x77,0x4f,0x62,
+    0x6a,0x65,0x63,0x74,0x54,0x65,0x73,0x74,0x55,0x6e,0x69,0x74,0x2e,0x73,0x6f,0x00,
+    0x63,0x63,0x6d,0x3a,0x3a,0x00,0x63,0x63,0x6d,0x3a,0x3a,0x74,0x65,0x73,0x74,0x3a,
+    0x3a,0x00,0x63,0x63,0x6d,0x3a,0x3a,0x74,0x65,0x73,0x74,0x3a,0x3a,0x6e,0x65,0x77,
+    0x6f,0x62,0x6a,0x65,0x63,0x74,0x3a,0x3a,0x00,0x43,0x56,0x61,0x6c,0x75,0x65,0x00,
+    0x43,0x56,0x61,0x6c,0x75,0x65,0x46,0x61,0x63,0x74,0x6f,0x72,0x79,0x00,0x49,0x49,
+    0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x00,0x50,0x72,0x6f,0x62,0x65,0x00,0x28,
+    0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,
+    0x29,0x4c,0x63,0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,
+    0x3b,0x2a,0x00,0x69,0x69,0x64,0x00,0x41,0x64,0x64,0x52,0x65,0x66,0x00,0x28,0x48,
+    0x29,0x49,0x00,0x69,0x64,0x00,0x52,0x65,0x6c,0x65,0x61,0x73,0x65,0x00,0x47,0x65,
+    0x74,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x49,0x44,0x00,0x28,0x4c,0x63,
+    0x63,0x6d,0x2f,0x49,0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,0x2a,0x55,
+    0x2a,0x29,0x45,0x00,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x49,0x56,0x61,0x6c,0x75,
+    0x65,0x00,0x47,0x65,0x74,0x56,0x61,0x6c,0x75,0x65,0x00,0x28,0x49,0x2a,0x29,0x45,
+    0x00,0x76,0x61,0x6c,0x75,0x65,0x00,0x49,0x56,0x61,0x6c,0x75,0x65,0x46,0x61,0x63,
+    0x74,0x6f,0x72,0x79,0x00,0x43,0x72,0x65,0x61,0x74,0x65,0x00,0x28,0x49,0x4c,0x63,
+    0x63,0x6d,0x2f,0x74,0x65,0x73,0x74,0x2f,0x6e,0x65,0x77,0x6f,0x62,0x6a,0x65,0x63,
+    0x74,0x2f,0x49,0x56,0x61,0x6c,0x75,0x65,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x49,0x43,
+    0x56,0x61,0x6c,0x75,0x65,0x43,0x6c,0x61,0x73,0x73,0x4f,0x62,0x6a,0x65,0x63,0x74,
+    0x00,0x43,0x72,0x65,0x61,0x74,0x65,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x28,0x49,
+    0x29,0x45,0x00,0x49,0x43,0x6c,0x61,0x73,0x73,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,
+    0x41,0x74,0x74,0x61,0x63,0x68,0x4d,0x65,0x74,0x61,0x64,0x61,0x74,0x61,0x00,0x28,
+    0x4c,0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,
+    0x65,0x6e,0x74,0x3b,0x2a,0x29,0x45,0x00,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+    0x74,0x00,0x47,0x65,0x74,0x4d,0x65,0x74,0x61,0x64,0x61,0x74,0x65,0x00,0x28,0x4c,
+    0x63,0x63,0x6d,0x2f,0x49,0x4d,0x65,0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,
+    0x6e,0x74,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x28,0x55,0x4c,0x63,0x63,0x6d,0x2f,0x49,
+    0x49,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3b,0x2a,0x2a,0x29,0x45,0x00,0x49,
+    0x4d,0x65,0x74,0x61,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x00,0x00,0x00,
+    0xf0,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xa6,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6a,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7a,0xa9,0xd1,0x39,0xc5,0x9a,0x42,0x49,
+    0x18,0xb6,0x0c,0x06,0x0e,0x0d,0x0b,0x0a,0x02,0x06,0x02,0x09,0x01,0x0c,0x00,0x00,
+    0x09,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xea,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x4d,0x6f,0xfb,0x1c,0x01,0x49,0x4b,0x4f,0x8f,0x8e,0x0b,0x0c,0x09,0x03,0x0d,0x01,
+    0x05,0x0d,0x02,0x03,0x04,0x03,0x00,0x00,0xc8,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xa2,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x8e,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0x48,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x2f,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x07,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0x06,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe3,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xae,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8b,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6e,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0x75,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xf3,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0xaf,0x65,0xdf,0x24,0xbb,0x66,0x45,
+    0x18,0x8c,0x03,0x01,0x00,0x02,0x02,0x03,0x0a,0x0c,0x0a,0x01,0x0a,0x08,0x00,0x00,
+    0xfb,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0x4a,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb2,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xb3,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x91,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0x92,0xd5,0xae,0xdd,0x40,0x02,0x4b,
+    0x07,0xaa,0x05,0x00,0x0d,0x06,0x0b,0x0a,0x0e,0x03,0x00,0x0f,0x09,0x07,0x00,0x00,
+    0x57,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0x8a,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x15,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x84,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x9e,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0x9a,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x61,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0x66,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x03,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xd1,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x64,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,
+    0xa3,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x68,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x50,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x57,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x16,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2a,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x2e,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x1b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x02,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x81,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9b,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb4,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6f,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xb8,0xf5,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00}};
+
+COM_PUBLIC extern const uintptr_t soMetadataHandle = reinterpret_cast<uintptr_t>(&comMetadata);
@@ -0,0 +1,44 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __NEWOBJECTTESTUNIT_H_GEN__
+#define __NEWOBJECTTESTUNIT_H_GEN__
+
+#include <ccmtypes.h>
+
+using namespace ccm;
+
+extern const ComponentID CID_NewObjectTestUnit;
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+interface IValue;
+interface IValueFactory;
+interface ICValueClassObject;
+
+} // namespace newobject
+} // namespace test
+} // namespace ccm
+
+
+extern void AddComponentCount();
+extern void ReleaseComponentCount();
+extern ccm::IMetaComponent* GetComponentMetadata();
+extern void SetComponentMetadata(ccm::IMetaComponent* component);
+
+#endif // __NEWOBJECTTESTUNIT_H_GEN__
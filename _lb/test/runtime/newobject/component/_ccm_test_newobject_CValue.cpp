@@ -0,0 +1,208 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CValue.h"
+#include "ccm.test.newobject.ICValueClassObject.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+class CValueClassObject
+    : public ClassObject
+    , public ICValueClassObject
+{
+public:
+    CValueClassObject();
+
+    ~CValueClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    CCM_INTERFACE_DECL();
+
+    ECode CreateObject(
+        /* [in] */ Integer value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+};
+
+static CValueClassObject* sCValueClassObject = nullptr;
+static std::atomic<CValueClassObject*> sCValueCachedClassObject(nullptr);
+static Spinlock& GetCValueClassObjectLock()
+{
+    static Spinlock sCValueClassObjectLock;
+    return sCValueClassObjectLock;
+}
+
+CCM_INTERFACE_IMPL_1(CValueClassObject, ClassObject, ICValueClassObject);
+
+CValueClassObject::CValueClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CValueClassObject::~CValueClassObject()
+{
+    Spinlock& lock = GetCValueClassObjectLock();
+    lock.Lock();
+    sCValueClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CValueClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CValueClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    *object = nullptr;
+    return E_UNSUPPORTED_OPERATION_EXCEPTION;
+}
+
+ECode CValueClassObject::CreateObject(
+    /* [in] */ Integer value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CValue), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CValue* _obj = new(addr) CValue();
+    ECode ec = _obj->Constructor(value);
+    if (FAILED(ec)) {
+        free(addr);
+        return ec;
+    }
+    _obj->AttachMetadata(mComponent, "ccm::test::newobject::CValue");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCValueClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCValueClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCValueClassObject == nullptr) {
+        sCValueClassObject = new CValueClassObject();
+    }
+    else if (sCValueClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCValueClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCValueClassObject;
+    return NOERROR;
+}
+
+static CValueClassObject* GetCachedCValueClassObject()
+{
+    CValueClassObject* clsObject = sCValueCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCValueClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCValueCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCValueClassObject == nullptr) {
+            sCValueClassObject = new CValueClassObject();
+        }
+        else if (sCValueClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCValueClassObject;
+        clsObject->AddRef();
+        sCValueCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCValueClassObjectCache()
+{
+    Spinlock& lock = GetCValueClassObjectLock();
+    lock.Lock();
+    CValueClassObject* clsObject = sCValueCachedClassObject.load(std::memory_order_relaxed);
+    sCValueCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CValue::_CValue()
+{
+    sCValueClassObject->AddRef();
+}
+
+_CValue::~_CValue()
+{
+    sCValueClassObject->Release();
+}
+
+ECode _CValue::New(
+    /* [in] */ Integer value,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CValueClassObject* cachedClsObject = GetCachedCValueClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(value, iid, object);
+    }
+
+    AutoPtr<IClassObject> clsObject;
+    ECode ec = CoAcquireClassFactory(CID_CValue, nullptr, &clsObject);
+    if (FAILED(ec)) return ec;
+    return ICValueClassObject::Probe(clsObject)->CreateObject(value, iid, object);
+};
+
+} // namespace newobject
+} // namespace test
+} // namespace ccm
@@ -0,0 +1,48 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEST_NEWOBJECT_CVALUE_H_GEN__
+#define __CCM_TEST_NEWOBJECT_CVALUE_H_GEN__
+
+#include "NewObjectTestUnit.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+extern const CoclassID CID_CValue;
+
+COCLASS_ID(39d1a97a-9ac5-4942-b618-c6edba26291c)
+class _CValue
+{
+public:
+    _CValue();
+
+    virtual ~_CValue();
+
+    static ECode New(
+        /* [in] */ Integer value,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+} // namespace newobject
+} // namespace test
+} // namespace ccm
+
+#endif // __CCM_TEST_NEWOBJECT_CVALUE_H_GEN__
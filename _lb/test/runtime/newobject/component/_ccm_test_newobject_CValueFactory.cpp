@@ -0,0 +1,178 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CValueFactory.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmclassobject.h>
+#include <ccmobject.h>
+#include <ccmspinlock.h>
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+using namespace ccm;
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+class CValueFactoryClassObject
+    : public ClassObject
+{
+public:
+    CValueFactoryClassObject();
+
+    ~CValueFactoryClassObject();
+
+    ECode AttachMetadata(
+        /* [in] */ IMetaComponent* component) override;
+
+    ECode CreateObject(
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ ccm::IInterface** object);
+};
+
+static CValueFactoryClassObject* sCValueFactoryClassObject = nullptr;
+static std::atomic<CValueFactoryClassObject*> sCValueFactoryCachedClassObject(nullptr);
+static Spinlock& GetCValueFactoryClassObjectLock()
+{
+    static Spinlock sCValueFactoryClassObjectLock;
+    return sCValueFactoryClassObjectLock;
+}
+
+CValueFactoryClassObject::CValueFactoryClassObject()
+{
+    mComponent = GetComponentMetadata();
+    AddComponentCount();
+}
+
+CValueFactoryClassObject::~CValueFactoryClassObject()
+{
+    Spinlock& lock = GetCValueFactoryClassObjectLock();
+    lock.Lock();
+    sCValueFactoryClassObject = nullptr;
+    lock.Unlock();
+    ReleaseComponentCount();
+}
+
+ECode CValueFactoryClassObject::AttachMetadata(
+    /* [in] */ IMetaComponent* component)
+{
+    SetComponentMetadata(component);
+    return ClassObject::AttachMetadata(component);
+}
+
+ECode CValueFactoryClassObject::CreateObject(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    VALIDATE_NOT_NULL(object);
+
+    void* addr = calloc(sizeof(CValueFactory), 1);
+    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;
+
+    CValueFactory* _obj = new(addr) CValueFactory();
+    _obj->AttachMetadata(mComponent, "ccm::test::newobject::CValueFactory");
+    *object = _obj->Probe(iid);
+    REFCOUNT_ADD(*object);
+    return NOERROR;
+}
+
+ECode GetCValueFactoryClassObject(IClassObject** classObject)
+{
+    VALIDATE_NOT_NULL(classObject);
+
+    Spinlock& lock = GetCValueFactoryClassObjectLock();
+AGAIN:
+    lock.Lock();
+    if (sCValueFactoryClassObject == nullptr) {
+        sCValueFactoryClassObject = new CValueFactoryClassObject();
+    }
+    else if (sCValueFactoryClassObject->GetStrongCount() == 0) {
+        lock.Unlock();
+        goto AGAIN;
+    }
+    sCValueFactoryClassObject->AddRef();
+    lock.Unlock();
+    *classObject = (IClassObject*)sCValueFactoryClassObject;
+    return NOERROR;
+}
+
+static CValueFactoryClassObject* GetCachedCValueFactoryClassObject()
+{
+    CValueFactoryClassObject* clsObject = sCValueFactoryCachedClassObject.load(std::memory_order_acquire);
+    if (clsObject != nullptr) return clsObject;
+    if (GetComponentMetadata() == nullptr) return nullptr;
+
+    Spinlock& lock = GetCValueFactoryClassObjectLock();
+AGAIN:
+    lock.Lock();
+    clsObject = sCValueFactoryCachedClassObject.load(std::memory_order_relaxed);
+    if (clsObject == nullptr) {
+        if (sCValueFactoryClassObject == nullptr) {
+            sCValueFactoryClassObject = new CValueFactoryClassObject();
+        }
+        else if (sCValueFactoryClassObject->GetStrongCount() == 0) {
+            lock.Unlock();
+            goto AGAIN;
+        }
+        clsObject = sCValueFactoryClassObject;
+        clsObject->AddRef();
+        sCValueFactoryCachedClassObject.store(clsObject, std::memory_order_release);
+    }
+    lock.Unlock();
+    return clsObject;
+}
+
+void ReleaseCValueFactoryClassObjectCache()
+{
+    Spinlock& lock = GetCValueFactoryClassObjectLock();
+    lock.Lock();
+    CValueFactoryClassObject* clsObject = sCValueFactoryCachedClassObject.load(std::memory_order_relaxed);
+    sCValueFactoryCachedClassObject.store(nullptr, std::memory_order_relaxed);
+    lock.Unlock();
+    if (clsObject != nullptr) {
+        clsObject->Release();
+    }
+}
+
+_CValueFactory::_CValueFactory()
+{
+    sCValueFactoryClassObject->AddRef();
+}
+
+_CValueFactory::~_CValueFactory()
+{
+    sCValueFactoryClassObject->Release();
+}
+
+ECode _CValueFactory::New(
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ ccm::IInterface** object)
+{
+    CValueFactoryClassObject* cachedClsObject = GetCachedCValueFactoryClassObject();
+    if (cachedClsObject != nullptr) {
+        return cachedClsObject->CreateObject(iid, object);
+    }
+
+    return CoCreateObjectInstance(CID_CValueFactory, iid, nullptr, object);
+};
+
+} // namespace newobject
+} // namespace test
+} // namespace ccm
@@ -0,0 +1,55 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEST_NEWOBJECT_IVALUE_H_GEN__
+#define __CCM_TEST_NEWOBJECT_IVALUE_H_GEN__
+
+#include "NewObjectTestUnit.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+extern const InterfaceID IID_IValue;
+
+INTERFACE_ID(df65af6b-bb24-4566-8c18-310223aca1a8)
+interface IValue : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IValue* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IValue*)object->Probe(IID_IValue);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IValue;
+    }
+
+    virtual ECode GetValue(
+        /* [out] */ Integer* value) = 0;
+};
+
+} // namespace newobject
+} // namespace test
+} // namespace ccm
+
+#endif // __CCM_TEST_NEWOBJECT_IVALUE_H_GEN__
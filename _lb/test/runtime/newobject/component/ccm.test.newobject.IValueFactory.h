@@ -0,0 +1,56 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEST_NEWOBJECT_IVALUEFACTORY_H_GEN__
+#define __CCM_TEST_NEWOBJECT_IVALUEFACTORY_H_GEN__
+
+#include "NewObjectTestUnit.h"
+
+using namespace ccm;
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+extern const InterfaceID IID_IValueFactory;
+
+INTERFACE_ID(aed5926c-40dd-4b02-aa07-50d6bae30f97)
+interface IValueFactory : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static IValueFactory* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (IValueFactory*)object->Probe(IID_IValueFactory);
+    }
+
+    inline static const InterfaceID& GetInterfaceID()
+    {
+        return IID_IValueFactory;
+    }
+
+    virtual ECode Create(
+        /* [in] */ Integer value,
+        /* [out] */ ccm::test::newobject::IValue** object) = 0;
+};
+
+} // namespace newobject
+} // namespace test
+} // namespace ccm
+
+#endif // __CCM_TEST_NEWOBJECT_IVALUEFACTORY_H_GEN__
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/runtime/outreferencetype/CFooBar.cpp" "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/CFooBar.cpp.o" "gcc" "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/CFooBar.cpp.o.d"
+  "/root/repo/_lb/test/runtime/outreferencetype/MetadataWrapper.cpp" "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/MetadataWrapper.cpp.o" "gcc" "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/MetadataWrapper.cpp.o.d"
+  "/root/repo/_lb/test/runtime/outreferencetype/ReferenceTypeTestPub.cpp" "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/ReferenceTypeTestPub.cpp.o" "gcc" "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/ReferenceTypeTestPub.cpp.o.d"
+  "/root/repo/_lb/test/runtime/outreferencetype/_ccm_test_CFooBar.cpp" "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/_ccm_test_CFooBar.cpp.o" "gcc" "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/_ccm_test_CFooBar.cpp.o.d"
+  "/root/repo/test/runtime/outreferencetype/main.cpp" "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/main.cpp.o" "gcc" "test/runtime/outreferencetype/CMakeFiles/testReferenceType.dir/main.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_lb/test/runtime/outreferencetype/MetadataWrapper.cpp" "/root/repo/_lb/test/runtime/outreferencetype/_ccm_test_CFooBar.cpp"
+  "/root/repo/_lb/test/runtime/outreferencetype/ReferenceTypeTestPub.cpp" "/root/repo/_lb/test/runtime/outreferencetype/_ccm_test_CFooBar.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
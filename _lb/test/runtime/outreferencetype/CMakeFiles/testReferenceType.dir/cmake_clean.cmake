@@ -0,0 +1,22 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testReferenceType.dir/CFooBar.cpp.o"
+  "CMakeFiles/testReferenceType.dir/CFooBar.cpp.o.d"
+  "CMakeFiles/testReferenceType.dir/MetadataWrapper.cpp.o"
+  "CMakeFiles/testReferenceType.dir/MetadataWrapper.cpp.o.d"
+  "CMakeFiles/testReferenceType.dir/ReferenceTypeTestPub.cpp.o"
+  "CMakeFiles/testReferenceType.dir/ReferenceTypeTestPub.cpp.o.d"
+  "CMakeFiles/testReferenceType.dir/_ccm_test_CFooBar.cpp.o"
+  "CMakeFiles/testReferenceType.dir/_ccm_test_CFooBar.cpp.o.d"
+  "CMakeFiles/testReferenceType.dir/main.cpp.o"
+  "CMakeFiles/testReferenceType.dir/main.cpp.o.d"
+  "MetadataWrapper.cpp"
+  "ReferenceTypeTestPub.cpp"
+  "_ccm_test_CFooBar.cpp"
+  "testReferenceType"
+  "testReferenceType.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testReferenceType.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarkProbe.dir/main.cpp.o"
+  "CMakeFiles/benchmarkProbe.dir/main.cpp.o.d"
+  "benchmarkProbe"
+  "benchmarkProbe.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarkProbe.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarkRefCount.dir/main.cpp.o"
+  "CMakeFiles/benchmarkRefCount.dir/main.cpp.o.d"
+  "benchmarkRefCount"
+  "benchmarkRefCount.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarkRefCount.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testReflection.dir/ReflectionTestUnit.cpp.o"
+  "CMakeFiles/testReflection.dir/ReflectionTestUnit.cpp.o.d"
+  "CMakeFiles/testReflection.dir/main.cpp.o"
+  "CMakeFiles/testReflection.dir/main.cpp.o.d"
+  "ReflectionTestUnit.cpp"
+  "testReflection"
+  "testReflection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testReflection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
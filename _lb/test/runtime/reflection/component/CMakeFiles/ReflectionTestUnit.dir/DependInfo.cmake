@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/runtime/reflection/component/CMethodTester.cpp" "test/runtime/reflection/component/CMakeFiles/ReflectionTestUnit.dir/CMethodTester.cpp.o" "gcc" "test/runtime/reflection/component/CMakeFiles/ReflectionTestUnit.dir/CMethodTester.cpp.o.d"
+  "/root/repo/_lb/test/runtime/reflection/component/MetadataWrapper.cpp" "test/runtime/reflection/component/CMakeFiles/ReflectionTestUnit.dir/MetadataWrapper.cpp.o" "gcc" "test/runtime/reflection/component/CMakeFiles/ReflectionTestUnit.dir/MetadataWrapper.cpp.o.d"
+  "/root/repo/_lb/test/runtime/reflection/component/ReflectionTestUnitPub.cpp" "test/runtime/reflection/component/CMakeFiles/ReflectionTestUnit.dir/ReflectionTestUnitPub.cpp.o" "gcc" "test/runtime/reflection/component/CMakeFiles/ReflectionTestUnit.dir/ReflectionTestUnitPub.cpp.o.d"
+  "/root/repo/_lb/test/runtime/reflection/component/_ccm_test_reflection_CMethodTester.cpp" "test/runtime/reflection/component/CMakeFiles/ReflectionTestUnit.dir/_ccm_test_reflection_CMethodTester.cpp.o" "gcc" "test/runtime/reflection/component/CMakeFiles/ReflectionTestUnit.dir/_ccm_test_reflection_CMethodTester.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_lb/test/runtime/reflection/component/MetadataWrapper.cpp" "/root/repo/_lb/test/runtime/reflection/component/_ccm_test_reflection_CMethodTester.cpp"
+  "/root/repo/_lb/test/runtime/reflection/component/ReflectionTestUnitPub.cpp" "/root/repo/_lb/test/runtime/reflection/component/_ccm_test_reflection_CMethodTester.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
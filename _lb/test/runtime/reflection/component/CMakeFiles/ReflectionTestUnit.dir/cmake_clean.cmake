@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ReflectionTestUnit.dir/CMethodTester.cpp.o"
+  "CMakeFiles/ReflectionTestUnit.dir/CMethodTester.cpp.o.d"
+  "CMakeFiles/ReflectionTestUnit.dir/MetadataWrapper.cpp.o"
+  "CMakeFiles/ReflectionTestUnit.dir/MetadataWrapper.cpp.o.d"
+  "CMakeFiles/ReflectionTestUnit.dir/ReflectionTestUnitPub.cpp.o"
+  "CMakeFiles/ReflectionTestUnit.dir/ReflectionTestUnitPub.cpp.o.d"
+  "CMakeFiles/ReflectionTestUnit.dir/_ccm_test_reflection_CMethodTester.cpp.o"
+  "CMakeFiles/ReflectionTestUnit.dir/_ccm_test_reflection_CMethodTester.cpp.o.d"
+  "MetadataWrapper.cpp"
+  "ReflectionTestUnit.pdb"
+  "ReflectionTestUnit.so"
+  "ReflectionTestUnitPub.cpp"
+  "_ccm_test_reflection_CMethodTester.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ReflectionTestUnit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
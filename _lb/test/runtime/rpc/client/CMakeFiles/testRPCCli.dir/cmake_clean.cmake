@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testRPCCli.dir/RPCTestUnit.cpp.o"
+  "CMakeFiles/testRPCCli.dir/RPCTestUnit.cpp.o.d"
+  "CMakeFiles/testRPCCli.dir/main.cpp.o"
+  "CMakeFiles/testRPCCli.dir/main.cpp.o.d"
+  "RPCTestUnit.cpp"
+  "testRPCCli"
+  "testRPCCli.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testRPCCli.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
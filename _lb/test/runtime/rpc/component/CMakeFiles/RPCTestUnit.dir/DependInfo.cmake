@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/runtime/rpc/component/CService.cpp" "test/runtime/rpc/component/CMakeFiles/RPCTestUnit.dir/CService.cpp.o" "gcc" "test/runtime/rpc/component/CMakeFiles/RPCTestUnit.dir/CService.cpp.o.d"
+  "/root/repo/_lb/test/runtime/rpc/component/MetadataWrapper.cpp" "test/runtime/rpc/component/CMakeFiles/RPCTestUnit.dir/MetadataWrapper.cpp.o" "gcc" "test/runtime/rpc/component/CMakeFiles/RPCTestUnit.dir/MetadataWrapper.cpp.o.d"
+  "/root/repo/_lb/test/runtime/rpc/component/RPCTestUnitPub.cpp" "test/runtime/rpc/component/CMakeFiles/RPCTestUnit.dir/RPCTestUnitPub.cpp.o" "gcc" "test/runtime/rpc/component/CMakeFiles/RPCTestUnit.dir/RPCTestUnitPub.cpp.o.d"
+  "/root/repo/_lb/test/runtime/rpc/component/_ccm_test_rpc_CService.cpp" "test/runtime/rpc/component/CMakeFiles/RPCTestUnit.dir/_ccm_test_rpc_CService.cpp.o" "gcc" "test/runtime/rpc/component/CMakeFiles/RPCTestUnit.dir/_ccm_test_rpc_CService.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_lb/test/runtime/rpc/component/MetadataWrapper.cpp" "/root/repo/_lb/test/runtime/rpc/component/_ccm_test_rpc_CService.cpp"
+  "/root/repo/_lb/test/runtime/rpc/component/RPCTestUnitPub.cpp" "/root/repo/_lb/test/runtime/rpc/component/_ccm_test_rpc_CService.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
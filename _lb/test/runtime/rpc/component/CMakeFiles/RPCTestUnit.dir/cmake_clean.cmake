@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RPCTestUnit.dir/CService.cpp.o"
+  "CMakeFiles/RPCTestUnit.dir/CService.cpp.o.d"
+  "CMakeFiles/RPCTestUnit.dir/MetadataWrapper.cpp.o"
+  "CMakeFiles/RPCTestUnit.dir/MetadataWrapper.cpp.o.d"
+  "CMakeFiles/RPCTestUnit.dir/RPCTestUnitPub.cpp.o"
+  "CMakeFiles/RPCTestUnit.dir/RPCTestUnitPub.cpp.o.d"
+  "CMakeFiles/RPCTestUnit.dir/_ccm_test_rpc_CService.cpp.o"
+  "CMakeFiles/RPCTestUnit.dir/_ccm_test_rpc_CService.cpp.o.d"
+  "MetadataWrapper.cpp"
+  "RPCTestUnit.pdb"
+  "RPCTestUnit.so"
+  "RPCTestUnitPub.cpp"
+  "_ccm_test_rpc_CService.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RPCTestUnit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testRPCSrv.dir/RPCTestUnit.cpp.o"
+  "CMakeFiles/testRPCSrv.dir/RPCTestUnit.cpp.o.d"
+  "CMakeFiles/testRPCSrv.dir/main.cpp.o"
+  "CMakeFiles/testRPCSrv.dir/main.cpp.o.d"
+  "RPCTestUnit.cpp"
+  "testRPCSrv"
+  "testRPCSrv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testRPCSrv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
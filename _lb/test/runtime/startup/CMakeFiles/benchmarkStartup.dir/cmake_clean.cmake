@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarkStartup.dir/main.cpp.o"
+  "CMakeFiles/benchmarkStartup.dir/main.cpp.o.d"
+  "benchmarkStartup"
+  "benchmarkStartup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarkStartup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarkStringPool.dir/main.cpp.o"
+  "CMakeFiles/benchmarkStringPool.dir/main.cpp.o.d"
+  "benchmarkStringPool"
+  "benchmarkStringPool.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarkStringPool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
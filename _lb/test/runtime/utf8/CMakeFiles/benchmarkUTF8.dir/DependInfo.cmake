@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/runtime/type/ccmutf8.cpp" "test/runtime/utf8/CMakeFiles/benchmarkUTF8.dir/__/__/__/src/runtime/type/ccmutf8.cpp.o" "gcc" "test/runtime/utf8/CMakeFiles/benchmarkUTF8.dir/__/__/__/src/runtime/type/ccmutf8.cpp.o.d"
+  "/root/repo/test/runtime/utf8/main.cpp" "test/runtime/utf8/CMakeFiles/benchmarkUTF8.dir/main.cpp.o" "gcc" "test/runtime/utf8/CMakeFiles/benchmarkUTF8.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarkUTF8.dir/__/__/__/src/runtime/type/ccmutf8.cpp.o"
+  "CMakeFiles/benchmarkUTF8.dir/__/__/__/src/runtime/type/ccmutf8.cpp.o.d"
+  "CMakeFiles/benchmarkUTF8.dir/main.cpp.o"
+  "CMakeFiles/benchmarkUTF8.dir/main.cpp.o.d"
+  "benchmarkUTF8"
+  "benchmarkUTF8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarkUTF8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
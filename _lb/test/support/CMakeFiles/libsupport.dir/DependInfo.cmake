@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/support/Support_CollectionTest.cpp" "test/support/CMakeFiles/libsupport.dir/Support_CollectionTest.cpp.o" "gcc" "test/support/CMakeFiles/libsupport.dir/Support_CollectionTest.cpp.o.d"
+  "/root/repo/test/support/Support_ListTest.cpp" "test/support/CMakeFiles/libsupport.dir/Support_ListTest.cpp.o" "gcc" "test/support/CMakeFiles/libsupport.dir/Support_ListTest.cpp.o.d"
+  "/root/repo/test/support/Support_UnmodifiableCollectionTest.cpp" "test/support/CMakeFiles/libsupport.dir/Support_UnmodifiableCollectionTest.cpp.o" "gcc" "test/support/CMakeFiles/libsupport.dir/Support_UnmodifiableCollectionTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
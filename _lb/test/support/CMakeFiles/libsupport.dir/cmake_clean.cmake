@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libsupport.dir/Support_CollectionTest.cpp.o"
+  "CMakeFiles/libsupport.dir/Support_CollectionTest.cpp.o.d"
+  "CMakeFiles/libsupport.dir/Support_ListTest.cpp.o"
+  "CMakeFiles/libsupport.dir/Support_ListTest.cpp.o.d"
+  "CMakeFiles/libsupport.dir/Support_UnmodifiableCollectionTest.cpp.o"
+  "CMakeFiles/libsupport.dir/Support_UnmodifiableCollectionTest.cpp.o.d"
+  "ccm.util.IList.h"
+  "libsupport.a"
+  "libsupport.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libsupport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -17,6 +17,7 @@
 #include "ccm/core/RuntimeFactory.h"
 #include "ccm.core.IRuntime.h"
 #include <ccmautoptr.h>
+#include <ccmobjectapi.h>
 
 using namespace ccm;
 using ccm::core::RuntimeFactory;
@@ -26,6 +27,8 @@ extern ECode Main(Array<String>& args);
 
 int main(int argv, char** argc)
 {
+    CoPreloadComponents(nullptr, false);
+
     Array<String> args(argv);
 
     for (int i = 0; i < argv; i++) {
@@ -25,10 +25,17 @@ namespace ast {
 class Attribute
 {
 public:
+    Attribute()
+        : mOneway(false)
+        , mThreadConfined(false)
+    {}
+
     String mUuid;
     String mVersion;
     String mDescription;
     String mUrl;
+    bool mOneway;
+    bool mThreadConfined;
 };
 
 }
@@ -24,6 +24,7 @@ namespace ast {
 Coclass::Coclass()
     : mConstructorDefault(false)
     , mConstructorDeleted(false)
+    , mThreadConfined(false)
     , mConstructors(5, false)
     , mInterfaces(10, false)
 {}
@@ -41,6 +42,7 @@ void Coclass::SetAttribute(
     mUuid.Parse(attr.mUuid);
     mVersion = attr.mVersion;
     mDescription = attr.mDescription;
+    mThreadConfined = attr.mThreadConfined;
 }
 
 bool Coclass::IsCoclassType()
@@ -66,6 +66,8 @@ public:
     inline void SetConstructorDeleted(
         /* [in] */ bool deleted);
 
+    inline bool IsThreadConfined();
+
     bool AddInterface(
         /* [in] */ Interface* interface);
 
@@ -85,6 +87,7 @@ private:
     String mDescription;
     bool mConstructorDefault;
     bool mConstructorDeleted;
+    bool mThreadConfined;
     ArrayList<Method*> mConstructors;
     ArrayList<Interface*> mInterfaces;
 };
@@ -127,6 +130,11 @@ void Coclass::SetConstructorDeleted(
     mConstructorDeleted = deleted;
 }
 
+bool Coclass::IsThreadConfined()
+{
+    return mThreadConfined;
+}
+
 int Coclass::GetInterfaceNumber()
 {
     return mInterfaces.GetSize();
@@ -25,6 +25,7 @@ Method::Method()
     : mReturnType(nullptr)
     , mDeleted(false)
     , mReference(false)
+    , mOneway(false)
 {}
 
 String Method::GetSignature()
@@ -67,6 +68,7 @@ void Method::DeepCopy(
 {
     mName = source->mName;
     mSignature = source->mSignature;
+    mOneway = source->mOneway;
     if (source->mReturnType != nullptr) {
         mReturnType = pool->FindType(source->mReturnType->ToString());
         if (mReturnType == nullptr) {
@@ -63,6 +63,11 @@ public:
 
     inline bool IsReference();
 
+    inline void SetOneway(
+        /* [in] */ bool oneway);
+
+    inline bool IsOneway();
+
     void DeepCopy(
         /* [in] */ Method* source,
         /* [in] */ Pool* pool);
@@ -82,6 +87,7 @@ private:
     ArrayList<Parameter*> mParameters;
     bool mDeleted;
     bool mReference;
+    bool mOneway;
 };
 
 String Method::GetName()
@@ -139,6 +145,17 @@ bool Method::IsReference()
     return mReference;
 }
 
+void Method::SetOneway(
+    /* [in] */ bool oneway)
+{
+    mOneway = oneway;
+}
+
+bool Method::IsOneway()
+{
+    return mOneway;
+}
+
 }
 }
 
@@ -20,7 +20,6 @@
 #include "../util/Logger.h"
 #include "../util/StringBuilder.h"
 #include "../util/Uuid.h"
-#include "../../runtime/metadata/MetaSerializer.h"
 
 #include <set>
 #include <stdlib.h>
@@ -32,7 +31,6 @@ using ccm::CcmTypeKind;
 using ccm::metadata::MetaCoclass;
 using ccm::metadata::MetaEnumerator;
 using ccm::metadata::MetaNamespace;
-using ccm::metadata::MetaSerializer;
 
 namespace ccdl {
 namespace codegen {
@@ -142,7 +140,7 @@ void CodeGenerator::GenConstantsAndTypesOnCcmrtMode()
                    "\n");
 
     MetaComponent* mc = mMetaComponent;
-    builder.AppendFormat("COM_PUBLIC extern const ComponentID CID_%s;\n\n", mc->mName);
+    builder.AppendFormat("COM_PUBLIC extern const ComponentID CID_%s;\n\n", mc->mName.Get());
     for (int i = 0; i < mc->mNamespaceNumber; i++) {
         MetaNamespace* mn = mc->mNamespaces[i];
         builder.Append(GenConstantsInHeader(mn));
@@ -228,11 +226,11 @@ String CodeGenerator::GenConstant(
     MetaType* mt = mMetaComponent->mTypes[mc->mTypeIndex];
     if (mt->mKind == CcmTypeKind::String) {
         builder.AppendFormat("extern const %s %s;\n", GenType(mt).string(),
-                mc->mName);
+                mc->mName.Get());
     }
     else {
         builder.AppendFormat("constexpr %s %s = %s;\n", GenType(mt).string(),
-                mc->mName, GenValue(mt, mc->mValue).string());
+                mc->mName.Get(), GenValue(mt, mc->mValue).string());
     }
 
     return builder.ToString();
@@ -248,7 +246,7 @@ String CodeGenerator::GenEnumerationPredeclarations(
     for (int i = 0; i < mn->mEnumerationNumber; i++) {
         MetaEnumeration* me = mMetaComponent->mEnumerations[mn->mEnumerationIndexes[i]];
         if (me->mExternal) continue;
-        builder.AppendFormat("enum class %s;\n", me->mName);
+        builder.AppendFormat("enum class %s;\n", me->mName.Get());
     }
     builder.Append("\n");
 
@@ -278,7 +276,7 @@ String CodeGenerator::GenEnumerationDeclaration(
 {
     StringBuilder builder;
 
-    builder.AppendFormat("enum class %s\n{\n", me->mName);
+    builder.AppendFormat("enum class %s\n{\n", me->mName.Get());
     int j = 0;
     for (int i = 0; i < me->mEnumeratorNumber; i++, j++) {
         MetaEnumerator* mr = me->mEnumerators[i];
@@ -307,7 +305,7 @@ String CodeGenerator::GenInterfaceIDPredeclarations(
     for (int i = 0; i < mn->mInterfaceNumber; i++) {
         MetaInterface* mi = mMetaComponent->mInterfaces[mn->mInterfaceIndexes[i]];
         if (mi->mExternal) continue;
-        builder.AppendFormat("extern const InterfaceID IID_%s;\n", mi->mName);
+        builder.AppendFormat("extern const InterfaceID IID_%s;\n", mi->mName.Get());
     }
 
     return builder.ToString();
@@ -325,7 +323,7 @@ String CodeGenerator::GenInterfacePredeclarations(
     for (int i = 0; i < mn->mInterfaceNumber; i++) {
         MetaInterface* mi = mMetaComponent->mInterfaces[mn->mInterfaceIndexes[i]];
         if (mi->mExternal) continue;
-        builder.AppendFormat("interface %s;\n", mi->mName);
+        builder.AppendFormat("interface %s;\n", mi->mName.Get());
     }
     builder.Append("\n");
 
@@ -359,26 +357,26 @@ String CodeGenerator::GenInterfaceDeclaration(
     StringBuilder builder;
 
     builder.Append(prefix).AppendFormat("INTERFACE_ID(%s)\n", Uuid(mi->mUuid).Dump().string());
-    builder.Append(prefix).AppendFormat("interface %s : public ", mi->mName);
+    builder.Append(prefix).AppendFormat("interface %s : public ", mi->mName.Get());
     builder.Append(
             mMetaComponent->mInterfaces[mi->mBaseInterfaceIndex]->mName).Append("\n");
     builder.Append(prefix).Append("{\n");
     for (int i = 0; i < mi->mNestedInterfaceNumber; i++) {
         MetaInterface* nmi = mMetaComponent->mInterfaces[mi->mNestedInterfaceIndexes[i]];
-        builder.Append(prefix + TAB).AppendFormat("static const InterfaceID IID_%s;\n\n", nmi->mName);
+        builder.Append(prefix + TAB).AppendFormat("static const InterfaceID IID_%s;\n\n", nmi->mName.Get());
         builder.Append(GenInterfaceDeclaration(nmi, prefix + TAB));
     }
     builder.Append(prefix).Append("    using IInterface::Probe;\n\n");
-    builder.Append(prefix).AppendFormat("    inline static %s* Probe(\n", mi->mName);
+    builder.Append(prefix).AppendFormat("    inline static %s* Probe(\n", mi->mName.Get());
     builder.Append(prefix).Append("        /* [in] */ IInterface* object)\n");
     builder.Append(prefix).Append("    {\n");
     builder.Append(prefix).Append("        if (object == nullptr) return nullptr;\n");
-    builder.Append(prefix).AppendFormat("        return (%s*)object->Probe(IID_%s);\n", mi->mName, mi->mName);
+    builder.Append(prefix).AppendFormat("        return (%s*)object->Probe(IID_%s);\n", mi->mName.Get(), mi->mName.Get());
     builder.Append(prefix).Append("    }\n");
     builder.Append(prefix).Append("\n");
     builder.Append(prefix).Append("    inline static const InterfaceID& GetInterfaceID()\n");
     builder.Append(prefix).Append("    {\n");
-    builder.Append(prefix).AppendFormat("        return IID_%s;\n", mi->mName);
+    builder.Append(prefix).AppendFormat("        return IID_%s;\n", mi->mName.Get());
     builder.Append(prefix).Append("    }\n");
     builder.Append("\n");
     for (int i = 0; i < mi->mConstantNumber; i++) {
@@ -405,11 +403,11 @@ String CodeGenerator::GenInterfaceConstant(
             ((mt->mKind == CcmTypeKind::Float || mt->mKind == CcmTypeKind::Double) &&
             (mc->mValue.mAttributes & FP_MASK))) {
         builder.Append(prefix).AppendFormat("static const %s %s;\n", GenType(mt).string(),
-                mc->mName);
+                mc->mName.Get());
     }
     else {
         builder.Append(prefix).AppendFormat("static constexpr %s %s = %s;\n", GenType(mt).string(),
-                mc->mName, GenValue(mt, mc->mValue).string());
+                mc->mName.Get(), GenValue(mt, mc->mValue).string());
     }
 
     return builder.ToString();
@@ -421,7 +419,7 @@ String CodeGenerator::GenInterfaceMethod(
 {
     StringBuilder builder;
 
-    builder.Append(prefix).AppendFormat("virtual ECode %s(", mm->mName);
+    builder.Append(prefix).AppendFormat("virtual ECode %s(", mm->mName.Get());
     for (int i = 0; i < mm->mParameterNumber; i++) {
         builder.Append("\n");
         builder.Append(prefix).AppendFormat("    %s", GenParameter(mm->mParameters[i]).string());
@@ -454,7 +452,7 @@ String CodeGenerator::GenParameter(
         }
     }
     MetaType* mt = mMetaComponent->mTypes[mp->mTypeIndex];
-    builder.AppendFormat("%s %s", GenType(mt, mp->mAttribute).string(), mp->mName);
+    builder.AppendFormat("%s %s", GenType(mt, mp->mAttribute).string(), mp->mName.Get());
     if (mp->mHasDefaultValue) {
         builder.AppendFormat(" = %s", GenValue(mt, mp->mDefaultValue).string());
     }
@@ -535,8 +533,8 @@ String CodeGenerator::GenType(
             break;
         case CcmTypeKind::Enum:
             builder.AppendFormat("%s%s",
-                    mc->mEnumerations[mt->mIndex]->mNamespace,
-                    mc->mEnumerations[mt->mIndex]->mName);
+                    mc->mEnumerations[mt->mIndex]->mNamespace.Get(),
+                    mc->mEnumerations[mt->mIndex]->mName.Get());
             break;
         case CcmTypeKind::Array:
             if ((attr & Parameter::ATTR_MASK) == Parameter::IN) {
@@ -573,13 +571,13 @@ String CodeGenerator::GenType(
         case CcmTypeKind::Interface:
             if (!mt->mReference) {
                 builder.AppendFormat("%s%s",
-                        mc->mInterfaces[mt->mIndex]->mNamespace,
-                        mc->mInterfaces[mt->mIndex]->mName);
+                        mc->mInterfaces[mt->mIndex]->mNamespace.Get(),
+                        mc->mInterfaces[mt->mIndex]->mName.Get());
             }
             else {
                 builder.AppendFormat("AutoPtr<%s%s>",
-                        mc->mInterfaces[mt->mIndex]->mNamespace,
-                        mc->mInterfaces[mt->mIndex]->mName);
+                        mc->mInterfaces[mt->mIndex]->mNamespace.Get(),
+                        mc->mInterfaces[mt->mIndex]->mName.Get());
             }
             break;
         case CcmTypeKind::Triple:
@@ -674,9 +672,9 @@ String CodeGenerator::GenValue(
         case CcmTypeKind::Boolean:
             return mv.mBoolean ? String("true") : String("false");
         case CcmTypeKind::String:
-            return String::Format("\"%s\"", mv.mString);
+            return String::Format("\"%s\"", mv.mString.Get());
         case CcmTypeKind::Enum:
-            return String::Format("%s::%s", GenType(mt).string(), mv.mString);
+            return String::Format("%s::%s", GenType(mt).string(), mv.mString.Get());
         case CcmTypeKind::ECode:
             return String::Format("0x%08x", mv.mInteger);
         case CcmTypeKind::HANDLE:
@@ -736,8 +734,8 @@ String CodeGenerator::GenComponentID()
     builder.AppendFormat("extern const ComponentID CID_%s =\n"
                          "        {%s,\n"
                          "        \"%s\"};\n",
-            mc->mName, Uuid(mc->mUuid).ToString().string(),
-            mc->mUrl);
+            mc->mName.Get(), Uuid(mc->mUuid).ToString().string(),
+            mc->mUrl.Get());
 
     return builder.ToString();
 }
@@ -754,8 +752,8 @@ String CodeGenerator::GenInterfaceIDsOnCcmrtMode(
         if (mi->mExternal) continue;
         builder.AppendFormat("COM_PUBLIC extern const InterfaceID IID_%s =\n"
                              "        {%s, &CID_%s};\n",
-                mi->mName, Uuid(mi->mUuid).ToString().string(),
-                mMetaComponent->mName);
+                mi->mName.Get(), Uuid(mi->mUuid).ToString().string(),
+                mMetaComponent->mName.Get());
     }
     builder.Append("\n");
 
@@ -766,10 +764,10 @@ void CodeGenerator::GenConstantsAndTypesOnComponentMode()
 {
     MetaComponent* mc = mMetaComponent;
     String filePath = String::Format("%s/%s.h",
-            mDirectory.string(), mc->mName);
+            mDirectory.string(), mc->mName.Get());
     File file(filePath, File::WRITE);
 
-    String defMacro = String::Format("__%s_H_GEN__", mc->mName).ToUpperCase();
+    String defMacro = String::Format("__%s_H_GEN__", mc->mName.Get()).ToUpperCase();
 
     StringBuilder builder;
 
@@ -780,7 +778,7 @@ void CodeGenerator::GenConstantsAndTypesOnComponentMode()
     builder.Append("#include <ccmtypes.h>\n\n");
     builder.Append("using namespace ccm;\n\n");
 
-    builder.AppendFormat("extern const ComponentID CID_%s;\n\n", mc->mName);
+    builder.AppendFormat("extern const ComponentID CID_%s;\n\n", mc->mName.Get());
     if (!mSparseMode) {
         for (int i = 0; i < mc->mNamespaceNumber; i++) {
             MetaNamespace* mn = mc->mNamespaces[i];
@@ -843,7 +841,9 @@ void CodeGenerator::GenConstantsAndTypesOnComponentMode()
         }
     }
     builder.Append("extern void AddComponentCount();\n"
-                   "extern void ReleaseComponentCount();\n\n");
+                   "extern void ReleaseComponentCount();\n"
+                   "extern ccm::IMetaComponent* GetComponentMetadata();\n"
+                   "extern void SetComponentMetadata(ccm::IMetaComponent* component);\n\n");
     builder.AppendFormat("#endif // %s\n", defMacro.string());
 
     String data = builder.ToString();
@@ -904,7 +904,7 @@ void CodeGenerator::GenInterfaceDeclarationSparsely(
     /* [in] */ MetaInterface* mi)
 {
     String filePath = String::Format("%s/%s%s.h", mDirectory.string(),
-            String(mi->mNamespace).Replace("::", ".").string(), mi->mName);
+            String(mi->mNamespace.Get()).Replace("::", ".").string(), mi->mName.Get());
     File file(filePath, File::WRITE);
 
     StringBuilder builder;
@@ -913,14 +913,14 @@ void CodeGenerator::GenInterfaceDeclarationSparsely(
     builder.Append("\n");
 
     String defMacro = GenDefineMacro(
-            String::Format("%s%s_H_GEN", mi->mNamespace, mi->mName));
+            String::Format("%s%s_H_GEN", mi->mNamespace.Get(), mi->mName.Get()));
     builder.AppendFormat("#ifndef %s\n", defMacro.string());
     builder.AppendFormat("#define %s\n\n", defMacro.string());
-    builder.AppendFormat("#include \"%s.h\"\n", mMetaComponent->mName);
+    builder.AppendFormat("#include \"%s.h\"\n", mMetaComponent->mName.Get());
     MetaInterface* bmi = mMetaComponent->mInterfaces[mi->mBaseInterfaceIndex];
     if (!String("IInterface").Equals(bmi->mName)) {
         String bfilePath = String::Format("%s%s.h",
-                String(bmi->mNamespace).Replace("::", ".").string(), bmi->mName);
+                String(bmi->mNamespace.Get()).Replace("::", ".").string(), bmi->mName.Get());
         builder.AppendFormat("#include \"%s\"\n", bfilePath.string());
     }
 
@@ -930,7 +930,7 @@ void CodeGenerator::GenInterfaceDeclarationSparsely(
     builder.Append("\nusing namespace ccm;\n\n");
 
     builder.Append(GenNamespaceBegin(String(mi->mNamespace)));
-    builder.AppendFormat("extern const InterfaceID IID_%s;\n\n", mi->mName);
+    builder.AppendFormat("extern const InterfaceID IID_%s;\n\n", mi->mName.Get());
     builder.Append(GenInterfaceDeclaration(mi, String("")));
     builder.Append(GenNamespaceEnd(String(mi->mNamespace)));
 
@@ -967,7 +967,7 @@ String CodeGenerator::GenIncludeForUsingNestedInterface(
                         mmi = mMetaComponent->mInterfaces[mmi->mOuterInterfaceIndex];
                     }
                     String include = String::Format("#include \"%s%s.h\"\n",
-                            String(mmi->mNamespace).Replace("::", ".").string(), mmi->mName);
+                            String(mmi->mNamespace.Get()).Replace("::", ".").string(), mmi->mName.Get());
                     includes.insert(include);
                 }
             }
@@ -1020,7 +1020,7 @@ void CodeGenerator::GenCoclassHeader(
 {
     String filePath =
             String::Format("%s/_%s%s.h", mDirectory.string(),
-            String(mk->mNamespace).Replace("::", "_").string(), mk->mName);
+            String(mk->mNamespace.Get()).Replace("::", "_").string(), mk->mName.Get());
     File file(filePath, File::WRITE);
 
     MetaInterface* mi = mMetaComponent->mInterfaces[mk->mInterfaceIndexes[mk->mInterfaceNumber - 1]];
@@ -1033,10 +1033,10 @@ void CodeGenerator::GenCoclassHeader(
     builder.Append("\n");
 
     String defMacro = GenDefineMacro(
-            String::Format("%s%s_H_GEN", mk->mNamespace, mk->mName));
+            String::Format("%s%s_H_GEN", mk->mNamespace.Get(), mk->mName.Get()));
     builder.AppendFormat("#ifndef %s\n", defMacro.string());
     builder.AppendFormat("#define %s\n\n", defMacro.string());
-    builder.AppendFormat("#include \"%s.h\"\n", mMetaComponent->mName);
+    builder.AppendFormat("#include \"%s.h\"\n", mMetaComponent->mName.Get());
 
     std::set<String, CompareFunc> includes;
 
@@ -1056,7 +1056,7 @@ void CodeGenerator::GenCoclassHeader(
                         mmi = mMetaComponent->mInterfaces[mmi->mOuterInterfaceIndex];
                     }
                     String include = String::Format("#include \"%s%s.h\"\n",
-                            String(mmi->mNamespace).Replace("::", ".").string(), mmi->mName);
+                            String(mmi->mNamespace.Get()).Replace("::", ".").string(), mmi->mName.Get());
                     includes.insert(include);
                 }
             }
@@ -1082,13 +1082,13 @@ void CodeGenerator::GenCoclassHeader(
     builder.Append("using namespace ccm;\n\n");
 
     builder.Append(GenNamespaceBegin(String(mk->mNamespace)));
-    builder.AppendFormat("extern const CoclassID CID_%s;\n\n", mk->mName);
+    builder.AppendFormat("extern const CoclassID CID_%s;\n\n", mk->mName.Get());
     builder.AppendFormat("COCLASS_ID(%s)\n", Uuid(mk->mUuid).Dump().string());
-    builder.AppendFormat("class _%s\n", mk->mName);
+    builder.AppendFormat("class _%s\n", mk->mName.Get());
     builder.AppendFormat("{\n"
                          "public:\n"
                          "    _%s();\n\n"
-                         "    virtual ~_%s();\n\n", mk->mName, mk->mName);
+                         "    virtual ~_%s();\n\n", mk->mName.Get(), mk->mName.Get());
 
     for (int i = start; i < mi->mMethodNumber; i++) {
         MetaMethod* mm = mi->mMethods[i];
@@ -1117,19 +1117,19 @@ void CodeGenerator::GenCoclassCpp(
 {
     String filePath =
             String::Format("%s/_%s%s.cpp", mDirectory.string(),
-            String(mk->mNamespace).Replace("::", "_").string(), mk->mName);
+            String(mk->mNamespace.Get()).Replace("::", "_").string(), mk->mName.Get());
     File file(filePath, File::WRITE);
 
     StringBuilder builder;
 
     builder.Append(mLicense);
     builder.Append("\n");
-    builder.AppendFormat("#include \"%s.h\"\n", mk->mName);
+    builder.AppendFormat("#include \"%s.h\"\n", mk->mName.Get());
     MetaInterface* mi = mMetaComponent->mInterfaces[mk->mInterfaceIndexes[mk->mInterfaceNumber - 1]];
     bool isIClassObject = String("IClassObject").Equals(mi->mName);
     if (!isIClassObject) {
         String classObjectInterfaceHeader = String::Format("%s%s.h",
-                String(mi->mNamespace).Replace("::", ".").string(), mi->mName);
+                String(mi->mNamespace.Get()).Replace("::", ".").string(), mi->mName.Get());
         builder.AppendFormat("#include \"%s\"\n", classObjectInterfaceHeader.string());
     }
     builder.Append("#include <ccmapi.h>\n"
@@ -1138,6 +1138,7 @@ void CodeGenerator::GenCoclassCpp(
                    "#include <ccmobject.h>\n"
                    "#include <ccmspinlock.h>\n\n"
                    "#include <stdlib.h>\n"
+                   "#include <atomic>\n"
                    "#include <new>\n\n");
     builder.Append("using namespace ccm;\n\n");
 
@@ -1157,17 +1158,19 @@ String CodeGenerator::GenCoclassObject(
 {
     StringBuilder builder;
 
-    builder.AppendFormat("class %sClassObject\n", mk->mName);
+    builder.AppendFormat("class %sClassObject\n", mk->mName.Get());
     builder.Append("    : public ClassObject\n");
     MetaInterface* mi = mMetaComponent->mInterfaces[mk->mInterfaceIndexes[mk->mInterfaceNumber - 1]];
     bool isIClassObject = String("IClassObject").Equals(mi->mName);
     if (!isIClassObject) {
-        builder.AppendFormat("    , public %s\n", mi->mName);
+        builder.AppendFormat("    , public %s\n", mi->mName.Get());
     }
     builder.Append("{\n");
     builder.AppendFormat("public:\n"
                          "    %sClassObject();\n\n"
-                         "    ~%sClassObject();\n\n", mk->mName, mk->mName);
+                         "    ~%sClassObject();\n\n"
+                         "    ECode AttachMetadata(\n"
+                         "        /* [in] */ IMetaComponent* component) override;\n\n", mk->mName.Get(), mk->mName.Get());
     if (!isIClassObject) {
         builder.Append("    CCM_INTERFACE_DECL();\n\n");
     }
@@ -1176,7 +1179,7 @@ String CodeGenerator::GenCoclassObject(
     for (int i = start; i < mi->mMethodNumber; i++) {
         MetaMethod* mm = mi->mMethods[i];
         if (mm->mParameterNumber == 2) hasConstructorWithoutArgu = true;
-        builder.AppendFormat("    ECode %s(\n", mm->mName);
+        builder.AppendFormat("    ECode %s(\n", mm->mName.Get());
         for (int j = 0; j < mm->mParameterNumber; j++) {
             builder.AppendFormat("        %s", GenParameter(mm->mParameters[j]).string());
             if (j != mm->mParameterNumber - 1) builder.Append(",\n");
@@ -1190,20 +1193,22 @@ String CodeGenerator::GenCoclassObject(
                        "        /* [out] */ IInterface** object);\n\n");
     }
     builder.Append("};\n\n");
-    builder.AppendFormat("static %sClassObject* s%sClassObject = nullptr;\n", mk->mName, mk->mName);
-    builder.AppendFormat("static Spinlock& Get%sClassObjectLock()\n"
+    builder.AppendFormat("static %sClassObject* s%sClassObject = nullptr;\n", mk->mName.Get(), mk->mName.Get());
+    builder.AppendFormat("static std::atomic<%sClassObject*> s%sCachedClassObject(nullptr);\n", mk->mName.Get(), mk->mName.Get());
+    builder.AppendFormat("Spinlock& Get%sClassObjectLock()\n"
                          "{\n"
                          "    static Spinlock s%sClassObjectLock;\n"
                          "    return s%sClassObjectLock;\n"
-                         "}\n\n", mk->mName, mk->mName, mk->mName);
+                         "}\n\n", mk->mName.Get(), mk->mName.Get(), mk->mName.Get());
     if (!isIClassObject) {
         builder.AppendFormat("CCM_INTERFACE_IMPL_1(%sClassObject, ClassObject, %s);\n\n",
-                mk->mName, mi->mName);
+                mk->mName.Get(), mi->mName.Get());
     }
     builder.AppendFormat("%sClassObject::%sClassObject()\n"
                          "{\n"
+                         "    mComponent = GetComponentMetadata();\n"
                          "    AddComponentCount();\n"
-                         "}\n\n", mk->mName, mk->mName);
+                         "}\n\n", mk->mName.Get(), mk->mName.Get());
     builder.AppendFormat("%sClassObject::~%sClassObject()\n"
                          "{\n"
                          "    Spinlock& lock = Get%sClassObjectLock();\n"
@@ -1211,11 +1216,17 @@ String CodeGenerator::GenCoclassObject(
                          "    s%sClassObject = nullptr;\n"
                          "    lock.Unlock();\n"
                          "    ReleaseComponentCount();\n"
-                         "}\n\n", mk->mName, mk->mName, mk->mName, mk->mName);
+                         "}\n\n", mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get());
+    builder.AppendFormat("ECode %sClassObject::AttachMetadata(\n"
+                         "    /* [in] */ IMetaComponent* component)\n"
+                         "{\n"
+                         "    SetComponentMetadata(component);\n"
+                         "    return ClassObject::AttachMetadata(component);\n"
+                         "}\n\n", mk->mName.Get());
     if (!isIClassObject && !hasConstructorWithoutArgu) {
         builder.AppendFormat("ECode %sClassObject::CreateObject(\n"
                              "    /* [in] */ const InterfaceID& iid,\n"
-                             "    /* [out] */ IInterface** object)\n", mk->mName);
+                             "    /* [out] */ IInterface** object)\n", mk->mName.Get());
         builder.Append("{\n"
                        "    *object = nullptr;\n"
                        "    return E_UNSUPPORTED_OPERATION_EXCEPTION;\n"
@@ -1224,7 +1235,7 @@ String CodeGenerator::GenCoclassObject(
     for (int i = start; i < mi->mMethodNumber; i++) {
         MetaMethod* mm = mi->mMethods[i];
         if (!mm->mReference) {
-            builder.AppendFormat("ECode %sClassObject::%s(\n", mk->mName, mm->mName);
+            builder.AppendFormat("ECode %sClassObject::%s(\n", mk->mName.Get(), mm->mName.Get());
             for (int j = 0; j < mm->mParameterNumber; j++) {
                 builder.AppendFormat("    %s", GenParameter(mm->mParameters[j]).string());
                 if (j != mm->mParameterNumber - 1) builder.Append(",\n");
@@ -1236,9 +1247,12 @@ String CodeGenerator::GenCoclassObject(
                 builder.Append("    *object = nullptr;\n");
             }
             else {
-                builder.AppendFormat("    void* addr = calloc(sizeof(%s), 1);\n", mk->mName);
+                builder.AppendFormat("    void* addr = calloc(sizeof(%s), 1);\n", mk->mName.Get());
                 builder.Append("    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;\n\n");
-                builder.AppendFormat("    %s* _obj = new(addr) %s();\n", mk->mName, mk->mName);
+                builder.AppendFormat("    %s* _obj = new(addr) %s();\n", mk->mName.Get(), mk->mName.Get());
+                if (mk->mThreadConfined) {
+                    builder.Append("    _obj->ConfineToThread();\n");
+                }
                 if (mm->mParameterNumber != 2 || !mk->mConstructorDefault) {
                     builder.Append("    ECode ec = _obj->Constructor(");
                     for (int i = 0; i < mm->mParameterNumber - 2; i++) {
@@ -1251,17 +1265,17 @@ String CodeGenerator::GenCoclassObject(
                                    "        return ec;\n"
                                    "    }\n");
                 }
-                builder.AppendFormat("    _obj->AttachMetadata(mComponent, String(\"%s%s\"));\n",
-                        mk->mNamespace, mk->mName);
+                builder.AppendFormat("    _obj->AttachMetadata(mComponent, \"%s%s\");\n",
+                        mk->mNamespace.Get(), mk->mName.Get());
                 builder.AppendFormat("    *object = _obj->Probe(%s);\n"
                                      "    REFCOUNT_ADD(*object);\n",
-                                     mm->mParameters[mm->mParameterNumber - 2]->mName);
+                                     mm->mParameters[mm->mParameterNumber - 2]->mName.Get());
             }
             builder.Append("    return NOERROR;\n");
             builder.Append("}\n\n");
         }
         else {
-            builder.AppendFormat("ECode %sClassObject::%s(\n", mk->mName, mm->mName);
+            builder.AppendFormat("ECode %sClassObject::%s(\n", mk->mName.Get(), mm->mName.Get());
             for (int j = 0; j < mm->mParameterNumber; j++) {
                 builder.AppendFormat("    %s", GenParameter(mm->mParameters[j]).string());
                 if (j != mm->mParameterNumber - 1) builder.Append(",\n");
@@ -1272,9 +1286,12 @@ String CodeGenerator::GenCoclassObject(
                 builder.Append("    object = nullptr;\n");
             }
             else {
-                builder.AppendFormat("    void* addr = calloc(sizeof(%s), 1);\n", mk->mName);
+                builder.AppendFormat("    void* addr = calloc(sizeof(%s), 1);\n", mk->mName.Get());
                 builder.Append("    if (addr == nullptr) return E_OUT_OF_MEMORY_ERROR;\n\n");
-                builder.AppendFormat("    %s* _obj = new(addr) %s();\n", mk->mName, mk->mName);
+                builder.AppendFormat("    %s* _obj = new(addr) %s();\n", mk->mName.Get(), mk->mName.Get());
+                if (mk->mThreadConfined) {
+                    builder.Append("    _obj->ConfineToThread();\n");
+                }
                 if (mm->mParameterNumber != 2 || !mk->mConstructorDefault) {
                     builder.Append("    ECode ec = _obj->Constructor(");
                     for (int i = 0; i < mm->mParameterNumber - 2; i++) {
@@ -1287,10 +1304,10 @@ String CodeGenerator::GenCoclassObject(
                                    "        return ec;\n"
                                    "    }\n");
                 }
-                builder.AppendFormat("    _obj->AttachMetadata(mComponent, String(\"%s%s\"));\n",
-                        mk->mNamespace, mk->mName);
+                builder.AppendFormat("    _obj->AttachMetadata(mComponent, \"%s%s\");\n",
+                        mk->mNamespace.Get(), mk->mName.Get());
                 builder.AppendFormat("    object = _obj->Probe(%s);\n",
-                                     mm->mParameters[mm->mParameterNumber - 2]->mName);
+                                     mm->mParameters[mm->mParameterNumber - 2]->mName.Get());
             }
             builder.Append("    return NOERROR;\n");
             builder.Append("}\n\n");
@@ -1314,7 +1331,40 @@ String CodeGenerator::GenCoclassObject(
                          "    lock.Unlock();\n"
                          "    *classObject = (IClassObject*)s%sClassObject;\n"
                          "    return NOERROR;\n"
-                         "}\n\n", mk->mName, mk->mName, mk->mName, mk->mName, mk->mName, mk->mName, mk->mName, mk->mName);
+                         "}\n\n", mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get());
+    builder.AppendFormat("static %sClassObject* GetCached%sClassObject()\n"
+                         "{\n"
+                         "    %sClassObject* clsObject = s%sCachedClassObject.load(std::memory_order_acquire);\n"
+                         "    if (clsObject != nullptr) return clsObject;\n"
+                         "    if (GetComponentMetadata() == nullptr) return nullptr;\n\n"
+                         "    Spinlock& lock = Get%sClassObjectLock();\n"
+                         "AGAIN:\n"
+                         "    lock.Lock();\n"
+                         "    clsObject = s%sCachedClassObject.load(std::memory_order_relaxed);\n"
+                         "    if (clsObject == nullptr && GetComponentMetadata() != nullptr) {\n"
+                         "        if (s%sClassObject == nullptr) {\n"
+                         "            s%sClassObject = new %sClassObject();\n"
+                         "        }\n"
+                         "        else if (s%sClassObject->GetStrongCount() == 0) {\n"
+                         "            lock.Unlock();\n"
+                         "            goto AGAIN;\n"
+                         "        }\n"
+                         "        clsObject = s%sClassObject;\n"
+                         "        clsObject->AddRef();\n"
+                         "        s%sCachedClassObject.store(clsObject, std::memory_order_release);\n"
+                         "    }\n"
+                         "    lock.Unlock();\n"
+                         "    return clsObject;\n"
+                         "}\n\n", mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(),
+                         mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get());
+    builder.AppendFormat("ClassObject* Detach%sClassObjectCache()\n"
+                         "{\n"
+                         "    return s%sCachedClassObject.exchange(nullptr);\n"
+                         "}\n\n"
+                         "void Attach%sClassObjectCache(ClassObject* clsObject)\n"
+                         "{\n"
+                         "    s%sCachedClassObject.store(static_cast<%sClassObject*>(clsObject), std::memory_order_release);\n"
+                         "}\n\n", mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get());
 
     return builder.ToString();
 }
@@ -1332,35 +1382,49 @@ String CodeGenerator::GenCoclassMethods(
                          "_%s::~_%s()\n"
                          "{\n"
                          "    s%sClassObject->Release();\n"
-                         "}\n\n", mk->mName, mk->mName, mk->mName, mk->mName, mk->mName, mk->mName);
+                         "}\n\n", mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get(), mk->mName.Get());
     MetaInterface* mi = mMetaComponent->mInterfaces[mk->mInterfaceIndexes[mk->mInterfaceNumber - 1]];
     bool isIClassObject = String("IClassObject").Equals(mi->mName);
     int start = isIClassObject ? 2 : 0;
     for (int i = start; i < mi->mMethodNumber; i++) {
         MetaMethod* mm = mi->mMethods[i];
         if (mm->mDeleted || (!mk->mConstructorDefault && mk->mConstructorDeleted)) continue;
-        builder.AppendFormat("ECode _%s::New(\n", mk->mName);
+        builder.AppendFormat("ECode _%s::New(\n", mk->mName.Get());
         for (int j = 0; j < mm->mParameterNumber; j++) {
             builder.AppendFormat("    %s", GenParameter(mm->mParameters[j]).string());
             if (j != mm->mParameterNumber - 1) builder.Append(",\n");
         }
         builder.Append(")\n"
                        "{\n");
+        builder.AppendFormat("    AddComponentCount();\n"
+                             "    std::atomic_thread_fence(std::memory_order_seq_cst);\n"
+                             "    %sClassObject* cachedClsObject = GetCached%sClassObject();\n"
+                             "    if (cachedClsObject != nullptr) {\n"
+                             "        ECode ec = cachedClsObject->%s(", mk->mName.Get(), mk->mName.Get(), mm->mName.Get());
+        for (int j = 0; j < mm->mParameterNumber; j++) {
+            builder.AppendFormat("%s", mm->mParameters[j]->mName.Get());
+            if (j != mm->mParameterNumber - 1) builder.Append(", ");
+        }
+        builder.Append(");\n"
+                       "        ReleaseComponentCount();\n"
+                       "        return ec;\n"
+                       "    }\n"
+                       "    ReleaseComponentCount();\n\n");
         if (mm->mParameterNumber > 2) {
             builder.Append("    AutoPtr<IClassObject> clsObject;\n");
             builder.AppendFormat("    ECode ec = CoAcquireClassFactory(CID_%s, nullptr, &clsObject);\n",
-                    mk->mName);
+                    mk->mName.Get());
             builder.Append("    if (FAILED(ec)) return ec;\n");
-            builder.AppendFormat("    return %s::Probe(clsObject)->CreateObject(", mi->mName);
+            builder.AppendFormat("    return %s::Probe(clsObject)->CreateObject(", mi->mName.Get());
             for (int j = 0; j < mm->mParameterNumber; j++) {
-                builder.AppendFormat("%s", mm->mParameters[j]->mName);
+                builder.AppendFormat("%s", mm->mParameters[j]->mName.Get());
                 if (j != mm->mParameterNumber - 1) builder.Append(", ");
             }
             builder.Append(");\n");
         }
         else {
             builder.AppendFormat("    return CoCreateObjectInstance(CID_%s, %s, nullptr, %s);\n",
-                    mk->mName, mm->mParameters[0]->mName, mm->mParameters[1]->mName);
+                    mk->mName.Get(), mm->mParameters[0]->mName.Get(), mm->mParameters[1]->mName.Get());
         }
         builder.Append("};\n\n");
     }
@@ -1371,7 +1435,7 @@ String CodeGenerator::GenCoclassMethods(
 void CodeGenerator::GenComponentCpp()
 {
     String filePath =
-            String::Format("%s/%sPub.cpp", mDirectory.string(), mMetaComponent->mName);
+            String::Format("%s/%sPub.cpp", mDirectory.string(), mMetaComponent->mName.Get());
     File file(filePath, File::WRITE);
 
     StringBuilder builder;
@@ -1388,20 +1452,23 @@ void CodeGenerator::GenComponentCpp()
                         ((mt->mKind == CcmTypeKind::Float || mt->mKind == CcmTypeKind::Double) &&
                         (mc->mValue.mAttributes & FP_MASK))) {
                     builder.AppendFormat("#include \"%s%s.h\"\n",
-                            String(mi->mNamespace).Replace("::", ".").string(), mi->mName);
+                            String(mi->mNamespace.Get()).Replace("::", ".").string(), mi->mName.Get());
                     break;
                 }
             }
             if (mi->mNestedInterfaceNumber > 0) {
                 builder.AppendFormat("#include \"%s%s.h\"\n",
-                        String(mi->mNamespace).Replace("::", ".").string(), mi->mName);
+                        String(mi->mNamespace.Get()).Replace("::", ".").string(), mi->mName.Get());
             }
         }
     }
     builder.AppendFormat("#include \"%s.h\"\n"
+                         "#include <ccmclassobject.h>\n"
                          "#include <ccmcomponent.h>\n"
-                         "#include <ccmrefbase.h>\n\n"
-                         "using namespace ccm;\n\n", mMetaComponent->mName);
+                         "#include <ccmrefbase.h>\n"
+                         "#include <ccmspinlock.h>\n\n"
+                         "#include <atomic>\n\n"
+                         "using namespace ccm;\n\n", mMetaComponent->mName.Get());
 
     MetaComponent* mc = mMetaComponent;
     builder.Append(GenComponentID());
@@ -1455,7 +1522,7 @@ String CodeGenerator::GenConstantsInCpp(
         MetaType* mt = mMetaComponent->mTypes[mc->mTypeIndex];
         if (mt->mKind == CcmTypeKind::String) {
             builder.AppendFormat("const %s %s(%s);\n", GenType(mt).string(),
-                    mc->mName, GenValue(mt, mc->mValue).string());
+                    mc->mName.Get(), GenValue(mt, mc->mValue).string());
         }
     }
     builder.Append("\n");
@@ -1478,12 +1545,12 @@ String CodeGenerator::GenInterfaceConstantsInCpp(
             MetaType* mt = mMetaComponent->mTypes[mc->mTypeIndex];
             if (mt->mKind == CcmTypeKind::String) {
                 builder.AppendFormat("const %s %s::%s(%s);\n", GenType(mt).string(),
-                        mi->mName, mc->mName, GenValue(mt, mc->mValue).string());
+                        mi->mName.Get(), mc->mName.Get(), GenValue(mt, mc->mValue).string());
             }
             else if ((mt->mKind == CcmTypeKind::Float || mt->mKind == CcmTypeKind::Double) &&
                     (mc->mValue.mAttributes & FP_MASK)) {
                 builder.AppendFormat("const %s %s::%s = %s;\n", GenType(mt).string(),
-                        mi->mName, mc->mName, GenValue(mt, mc->mValue).string());
+                        mi->mName.Get(), mc->mName.Get(), GenValue(mt, mc->mValue).string());
             }
         }
     }
@@ -1505,16 +1572,16 @@ String CodeGenerator::GenInterfaceIDsInCpp(
         if (mn->mInterfaceWrappedIndex == -1) {
             builder.AppendFormat("extern const InterfaceID IID_%s =\n"
                                  "        {%s, &CID_%s};\n",
-                    mi->mName, Uuid(mi->mUuid).ToString().string(),
-                    mMetaComponent->mName);
+                    mi->mName.Get(), Uuid(mi->mUuid).ToString().string(),
+                    mMetaComponent->mName.Get());
         }
         else {
             String ns(mn->mName);
             ns = ns.Substring(ns.LastIndexOf("::", ns.GetLength() - 3) + 2, ns.GetLength() - 3);
             builder.AppendFormat("const InterfaceID %s::IID_%s =\n"
                                  "        {%s, &CID_%s};\n",
-                    ns.string(), mi->mName, Uuid(mi->mUuid).ToString().string(),
-                    mMetaComponent->mName);
+                    ns.string(), mi->mName.Get(), Uuid(mi->mUuid).ToString().string(),
+                    mMetaComponent->mName.Get());
         }
     }
     builder.Append("\n");
@@ -1533,8 +1600,8 @@ String CodeGenerator::GenCoclassIDsInCpp(
         MetaCoclass* mc = mMetaComponent->mCoclasses[mn->mCoclassIndexes[i]];
         builder.AppendFormat("extern const CoclassID CID_%s =\n"
                              "        {%s, &CID_%s};\n",
-                mc->mName, Uuid(mc->mUuid).ToString().string(),
-                mMetaComponent->mName);
+                mc->mName.Get(), Uuid(mc->mUuid).ToString().string(),
+                mMetaComponent->mName.Get());
     }
     builder.Append("\n");
 
@@ -1555,16 +1622,19 @@ String CodeGenerator::GenClassObjectGetterArray()
         builder.Append(GenNamespaceBegin(String(mn->mName)));
         for (int i = 0; i < mn->mCoclassNumber; i++) {
             MetaCoclass* mk = mc->mCoclasses[mn->mCoclassIndexes[i]];
-            builder.AppendFormat("extern ECode Get%sClassObject(IClassObject** classObject);\n", mk->mName);
+            builder.AppendFormat("extern ECode Get%sClassObject(IClassObject** classObject);\n", mk->mName.Get());
+            builder.AppendFormat("extern Spinlock& Get%sClassObjectLock();\n", mk->mName.Get());
+            builder.AppendFormat("extern ClassObject* Detach%sClassObjectCache();\n", mk->mName.Get());
+            builder.AppendFormat("extern void Attach%sClassObjectCache(ClassObject* clsObject);\n", mk->mName.Get());
         }
         builder.Append(GenNamespaceEnd(String(mn->mName)));
     }
     builder.Append("\n");
-    builder.AppendFormat("static ClassObjectGetter co%sGetters[%d] = {\n", mc->mName, mc->mCoclassNumber);
+    builder.AppendFormat("static ClassObjectGetter co%sGetters[%d] = {\n", mc->mName.Get(), mc->mCoclassNumber);
     for (int i = 0; i < mc->mCoclassNumber; i++) {
         MetaCoclass* mk = mc->mCoclasses[i];
         builder.AppendFormat("        {%s, %sGet%sClassObject}",
-                Uuid(mk->mUuid).ToString().string(), mk->mNamespace, mk->mName);
+                Uuid(mk->mUuid).ToString().string(), mk->mNamespace.Get(), mk->mName.Get());
         if (i != mc->mCoclassNumber - 1) builder.Append(",\n");
     }
     builder.Append("};\n\n");
@@ -1581,7 +1651,7 @@ String CodeGenerator::GenSoGetAllClassObjects()
                          "{\n"
                          "    *size = sizeof(co%sGetters) / sizeof(ClassObjectGetter);\n"
                          "    return co%sGetters;\n"
-                         "}\n", mMetaComponent->mName, mMetaComponent->mName);
+                         "}\n", mMetaComponent->mName.Get(), mMetaComponent->mName.Get());
 
     return builder.ToString();
 }
@@ -1600,12 +1670,12 @@ String CodeGenerator::GenSoGetClassObject()
         if (i == 0) {
             builder.AppendFormat("    if (%sCID_%s == cid) {\n"
                                  "        return %sGet%sClassObject(object);\n"
-                                 "    }\n", mk->mNamespace, mk->mName, mk->mNamespace, mk->mName);
+                                 "    }\n", mk->mNamespace.Get(), mk->mName.Get(), mk->mNamespace.Get(), mk->mName.Get());
         }
         else {
             builder.AppendFormat("    else if (%sCID_%s == cid) {\n"
                                  "        return %sGet%sClassObject(object);\n"
-                                 "    }\n", mk->mNamespace, mk->mName, mk->mNamespace, mk->mName);
+                                 "    }\n", mk->mNamespace.Get(), mk->mName.Get(), mk->mNamespace.Get(), mk->mName.Get());
         }
     }
     builder.Append("\n    *object = nullptr;\n"
@@ -1628,15 +1698,78 @@ String CodeGenerator::GenComponentObject()
                          "{\n"
                          "    AddRef();\n"
                          "}\n\n",
-                         mMetaComponent->mName, mMetaComponent->mName,
-                         mMetaComponent->mName, mMetaComponent->mName);
-    builder.AppendFormat("static __attribute__ ((init_priority (200))) C%s sComponentObject;\n\n", mMetaComponent->mName);
-    builder.Append("EXTERN_C COM_PUBLIC Boolean soCanUnload()\n"
-                   "{\n"
-                   "    return sComponentObject.GetStrongCount() == 1;\n"
-                   "}\n"
-                   "\n"
-                   "void AddComponentCount()\n"
+                         mMetaComponent->mName.Get(), mMetaComponent->mName.Get(),
+                         mMetaComponent->mName.Get(), mMetaComponent->mName.Get());
+    builder.AppendFormat("static __attribute__ ((init_priority (200))) C%s sComponentObject;\n\n", mMetaComponent->mName.Get());
+    builder.Append("// Lets the coclasses of this component create their objects without\n"
+                   "// the class loader. The class objects they cache are dropped only\n"
+                   "// when the component can be unloaded.\n"
+                   "static std::atomic<IMetaComponent*> sComponentMetadata(nullptr);\n"
+                   "\n");
+    MetaComponent* mc = mMetaComponent;
+    if (mc->mCoclassNumber == 0) {
+        builder.Append("EXTERN_C COM_PUBLIC Boolean soCanUnload()\n"
+                       "{\n"
+                       "    return sComponentObject.GetStrongCount() == 1;\n"
+                       "}\n"
+                       "\n");
+    }
+    else {
+        // The caches are taken out under the locks of their class objects,
+        // so nothing fills them while the component is checked. A New() on
+        // a cached class object holds a component count, which the check
+        // then sees. When the component is still in use the caches are
+        // put back.
+        builder.AppendFormat("EXTERN_C COM_PUBLIC Boolean soCanUnload()\n"
+                             "{\n"
+                             "    Spinlock* locks[%d] = {\n", mc->mCoclassNumber);
+        for (int i = 0; i < mc->mCoclassNumber; i++) {
+            MetaCoclass* mk = mc->mCoclasses[i];
+            builder.AppendFormat("            &%sGet%sClassObjectLock()", mk->mNamespace.Get(), mk->mName.Get());
+            if (i != mc->mCoclassNumber - 1) builder.Append(",\n");
+        }
+        builder.AppendFormat("};\n\n"
+                             "    ClassObject* cached[%d];\n"
+                             "    Integer cachedNumber = 0;\n"
+                             "    Boolean inUse = false;\n"
+                             "    for (int i = 0; i < %d; i++) {\n"
+                             "        locks[i]->Lock();\n"
+                             "    }\n", mc->mCoclassNumber, mc->mCoclassNumber);
+        for (int i = 0; i < mc->mCoclassNumber; i++) {
+            MetaCoclass* mk = mc->mCoclasses[i];
+            builder.AppendFormat("    cached[%d] = %sDetach%sClassObjectCache();\n", i, mk->mNamespace.Get(), mk->mName.Get());
+        }
+        builder.AppendFormat("    for (int i = 0; i < %d; i++) {\n"
+                             "        if (cached[i] != nullptr) {\n"
+                             "            cachedNumber++;\n"
+                             "            if (cached[i]->GetStrongCount() != 1) inUse = true;\n"
+                             "        }\n"
+                             "    }\n"
+                             "    std::atomic_thread_fence(std::memory_order_seq_cst);\n"
+                             "    Boolean canUnload = !inUse &&\n"
+                             "            sComponentObject.GetStrongCount() == 1 + cachedNumber;\n"
+                             "    if (canUnload) {\n"
+                             "        sComponentMetadata.store(nullptr, std::memory_order_release);\n"
+                             "    }\n"
+                             "    else {\n", mc->mCoclassNumber);
+        for (int i = 0; i < mc->mCoclassNumber; i++) {
+            MetaCoclass* mk = mc->mCoclasses[i];
+            builder.AppendFormat("        %sAttach%sClassObjectCache(cached[%d]);\n", mk->mNamespace.Get(), mk->mName.Get(), i);
+        }
+        builder.AppendFormat("    }\n"
+                             "    for (int i = 0; i < %d; i++) {\n"
+                             "        locks[i]->Unlock();\n"
+                             "    }\n"
+                             "    if (canUnload) {\n"
+                             "        for (int i = 0; i < %d; i++) {\n"
+                             "            REFCOUNT_RELEASE(cached[i]);\n"
+                             "        }\n"
+                             "    }\n"
+                             "    return canUnload;\n"
+                             "}\n"
+                             "\n", mc->mCoclassNumber, mc->mCoclassNumber);
+    }
+    builder.Append("void AddComponentCount()\n"
                    "{\n"
                    "    sComponentObject.AddRef();\n"
                    "}\n"
@@ -1644,6 +1777,16 @@ String CodeGenerator::GenComponentObject()
                    "void ReleaseComponentCount()\n"
                    "{\n"
                    "    sComponentObject.Release();\n"
+                   "}\n"
+                   "\n"
+                   "IMetaComponent* GetComponentMetadata()\n"
+                   "{\n"
+                   "    return sComponentMetadata.load(std::memory_order_acquire);\n"
+                   "}\n"
+                   "\n"
+                   "void SetComponentMetadata(IMetaComponent* component)\n"
+                   "{\n"
+                   "    sComponentMetadata.store(component, std::memory_order_release);\n"
                    "}\n");
     return builder.ToString();
 }
@@ -1652,10 +1795,10 @@ void CodeGenerator::GenConstantsAndTypesOnUserMode()
 {
     MetaComponent* mc = mMetaComponent;
     String filePath = String::Format("%s/%s.h",
-            mDirectory.string(), mc->mName);
+            mDirectory.string(), mc->mName.Get());
     File file(filePath, File::WRITE);
 
-    String defMacro = String::Format("__%s_H_GEN__", mc->mName).ToUpperCase();
+    String defMacro = String::Format("__%s_H_GEN__", mc->mName.Get()).ToUpperCase();
 
     StringBuilder builder;
 
@@ -1666,7 +1809,7 @@ void CodeGenerator::GenConstantsAndTypesOnUserMode()
     builder.Append("#include <ccmtypes.h>\n\n");
     builder.Append("using namespace ccm;\n\n");
 
-    builder.AppendFormat("extern const ComponentID CID_%s;\n\n", mc->mName);
+    builder.AppendFormat("extern const ComponentID CID_%s;\n\n", mc->mName.Get());
     if (!mSparseMode) {
         for (int i = 0; i < mc->mNamespaceNumber; i++) {
             MetaNamespace* mn = mc->mNamespaces[i];
@@ -1760,9 +1903,9 @@ String CodeGenerator::GenCoclassDeclaration(
 {
     StringBuilder builder;
 
-    builder.AppendFormat("extern const CoclassID CID_%s;\n\n", mc->mName);
+    builder.AppendFormat("extern const CoclassID CID_%s;\n\n", mc->mName.Get());
     builder.AppendFormat("COCLASS_ID(%s)\n", Uuid(mc->mUuid).Dump().string());
-    builder.AppendFormat("class %s\n", mc->mName);
+    builder.AppendFormat("class %s\n", mc->mName.Get());
     builder.Append("{\n"
                    "public:\n");
     MetaInterface* mi = mMetaComponent->mInterfaces[mc->mInterfaceIndexes[mc->mInterfaceNumber - 1]];
@@ -1796,7 +1939,7 @@ void CodeGenerator::GenCoclassDeclarationSparselyOnUserMode(
     /* [in] */ MetaCoclass* mc)
 {
     String filePath = String::Format("%s/%s%s.h", mDirectory.string(),
-            String(mc->mNamespace).Replace("::", ".").string(), mc->mName);
+            String(mc->mNamespace.Get()).Replace("::", ".").string(), mc->mName.Get());
     File file(filePath, File::WRITE);
 
     MetaInterface* mi = mMetaComponent->mInterfaces[mc->mInterfaceIndexes[mc->mInterfaceNumber - 1]];
@@ -1809,10 +1952,10 @@ void CodeGenerator::GenCoclassDeclarationSparselyOnUserMode(
     builder.Append("\n");
 
     String defMacro = GenDefineMacro(
-            String::Format("%s%s_H_GEN", mc->mNamespace, mc->mName));
+            String::Format("%s%s_H_GEN", mc->mNamespace.Get(), mc->mName.Get()));
     builder.AppendFormat("#ifndef %s\n", defMacro.string());
     builder.AppendFormat("#define %s\n\n", defMacro.string());
-    builder.AppendFormat("#include \"%s.h\"\n", mMetaComponent->mName);
+    builder.AppendFormat("#include \"%s.h\"\n", mMetaComponent->mName.Get());
 
     std::set<String, CompareFunc> includes;
 
@@ -1832,7 +1975,7 @@ void CodeGenerator::GenCoclassDeclarationSparselyOnUserMode(
                         mmi = mMetaComponent->mInterfaces[mmi->mOuterInterfaceIndex];
                     }
                     String include = String::Format("#include \"%s%s.h\"\n",
-                            String(mmi->mNamespace).Replace("::", ".").string(), mmi->mName);
+                            String(mmi->mNamespace.Get()).Replace("::", ".").string(), mmi->mName.Get());
                     includes.insert(include);
                 }
             }
@@ -1874,19 +2017,19 @@ void CodeGenerator::GenComponentCppOnUserMode()
     MetaComponent* mc = mMetaComponent;
 
     String filePath =
-            String::Format("%s/%s.cpp", mDirectory.string(), mc->mName);
+            String::Format("%s/%s.cpp", mDirectory.string(), mc->mName.Get());
     File file(filePath, File::WRITE);
 
     StringBuilder builder;
 
     builder.Append(mLicense);
     builder.Append("\n");
-    builder.AppendFormat("#include \"%s.h\"\n", mc->mName);
+    builder.AppendFormat("#include \"%s.h\"\n", mc->mName.Get());
     if (mSparseMode) {
         for (int i = 0; i < mc->mCoclassNumber; i++) {
             MetaCoclass* mk = mc->mCoclasses[i];
             String clsHeader = String::Format("%s%s.h",
-                    String(mk->mNamespace).Replace("::", ".").string(), mk->mName);
+                    String(mk->mNamespace.Get()).Replace("::", ".").string(), mk->mName.Get());
             builder.AppendFormat("#include \"%s\"\n", clsHeader.string());
         }
         for (int i = 0; i < mc->mInterfaceNumber; i++) {
@@ -1900,7 +2043,7 @@ void CodeGenerator::GenComponentCppOnUserMode()
                             ((mt->mKind == CcmTypeKind::Float || mt->mKind == CcmTypeKind::Double) &&
                             (mc->mValue.mAttributes & FP_MASK))) {
                         String intfHeader = String::Format("%s%s.h",
-                                String(mi->mNamespace).Replace("::", ".").string(), mi->mName);
+                                String(mi->mNamespace.Get()).Replace("::", ".").string(), mi->mName.Get());
                         builder.AppendFormat("#include \"%s\"\n", intfHeader.string());
                         break;
                     }
@@ -1908,7 +2051,7 @@ void CodeGenerator::GenComponentCppOnUserMode()
             }
             else {
                 String intfHeader = String::Format("%s%s.h",
-                        String(mi->mNamespace).Replace("::", ".").string(), mi->mName);
+                        String(mi->mNamespace.Get()).Replace("::", ".").string(), mi->mName.Get());
                 builder.AppendFormat("#include \"%s\"\n", intfHeader.string());
             }
         }
@@ -1972,13 +2115,13 @@ String CodeGenerator::GenCoclassOnUserMode(
 {
     StringBuilder builder;
 
-    builder.AppendFormat("// %s\n", mc->mName);
+    builder.AppendFormat("// %s\n", mc->mName.Get());
     MetaInterface* mi = mMetaComponent->mInterfaces[mc->mInterfaceIndexes[mc->mInterfaceNumber - 1]];
     bool isIClassObject = String("IClassObject").Equals(mi->mName);
     int start = isIClassObject ? 2 : 0;
     for (int i = start; i < mi->mMethodNumber; i++) {
         MetaMethod* mm = mi->mMethods[i];
-        builder.AppendFormat("ECode %s::New(\n", mc->mName);
+        builder.AppendFormat("ECode %s::New(\n", mc->mName.Get());
         for (int j = 0; j < mm->mParameterNumber; j++) {
             builder.AppendFormat("    %s", GenParameter(mm->mParameters[j]).string());
             if (j != mm->mParameterNumber - 1) builder.Append(",\n");
@@ -1988,18 +2131,18 @@ String CodeGenerator::GenCoclassOnUserMode(
         if (mm->mParameterNumber > 2) {
             builder.Append("    AutoPtr<IClassObject> clsObject;\n");
             builder.AppendFormat("    ECode ec = CoAcquireClassFactory(CID_%s, nullptr, &clsObject);\n",
-                    mc->mName);
+                    mc->mName.Get());
             builder.Append("    if (FAILED(ec)) return ec;\n");
-            builder.AppendFormat("    return %s::Probe(clsObject)->CreateObject(", mi->mName);
+            builder.AppendFormat("    return %s::Probe(clsObject)->CreateObject(", mi->mName.Get());
             for (int j = 0; j < mm->mParameterNumber; j++) {
-                builder.AppendFormat("%s", mm->mParameters[j]->mName);
+                builder.AppendFormat("%s", mm->mParameters[j]->mName.Get());
                 if (j != mm->mParameterNumber - 1) builder.Append(", ");
             }
             builder.Append(");\n");
         }
         else {
             builder.AppendFormat("    return CoCreateObjectInstance(CID_%s, %s, nullptr, %s);\n",
-                    mc->mName, mm->mParameters[0]->mName, mm->mParameters[1]->mName);
+                    mc->mName.Get(), mm->mParameters[0]->mName.Get(), mm->mParameters[1]->mName.Get());
         }
         builder.Append("};\n");
         if (i != mi->mMethodNumber - 1) builder.Append("\n");
@@ -2029,18 +2172,16 @@ void CodeGenerator::GenMetadataWrapper()
     builder.Append(mLicense);
     builder.Append("\n");
 
-    MetaSerializer serializer(mMetaComponent);
-    serializer.Serialize();
-    int dataSize = serializer.GetDataSize();
-    uintptr_t data = serializer.GetData();
+    int dataSize = mMetaComponent->mSize;
+    uintptr_t data = reinterpret_cast<uintptr_t>(mMetaComponent);
 
     builder.Append("#include <ccmdef.h>\n");
     builder.Append("#include <stdint.h>\n\n");
     builder.AppendFormat("struct MetadataWrapper\n"
                    "{\n"
                    "    int             mSize;\n"
-                   "    unsigned char   mMetadata[%d];\n"
-                   "};\n\n", dataSize);
+                   "    unsigned char   mMetadata[%d] __attribute__ ((aligned (%d)));\n"
+                   "};\n\n", dataSize, CCM_METADATA_OFFSET);
     builder.Append("static const MetadataWrapper comMetadata __attribute__ ((used,__section__ (\".metadata\"))) = {\n");
     builder.AppendFormat("    %d, {\n", dataSize);
     int lineSize = 0;
@@ -9,7 +9,6 @@
 #include "util/MetadataUtils.h"
 #include "util/String.h"
 #include "../runtime/metadata/Component.h"
-#include "../runtime/metadata/MetaSerializer.h"
 
 #include <memory>
 
@@ -23,7 +22,6 @@ using ccdl::codegen::CodeGenerator;
 using ccdl::metadata::MetaBuilder;
 using ccdl::metadata::MetaDumper;
 using ccm::metadata::MetaComponent;
-using ccm::metadata::MetaSerializer;
 
 int main(int argc, char** argv)
 {
@@ -63,12 +61,7 @@ int main(int argc, char** argv)
                 return -1;
             }
 
-            MetaSerializer serializer(comMetadata.get());
-            serializer.Serialize();
-            int dataSize = serializer.GetDataSize();
-            uintptr_t data = serializer.GetData();
-
-            file.Write(reinterpret_cast<void*>(data), dataSize);
+            file.Write(comMetadata.get(), comMetadata->mSize);
             file.Flush();
             file.Close();
         }
@@ -95,8 +88,6 @@ int main(int argc, char** argv)
                 return -1;
             }
 
-            MetaSerializer serializer;
-            serializer.Deserialize(reinterpret_cast<uintptr_t>(newData));
             comMetadata.reset((MetaComponent*)newData);
         }
 
@@ -123,17 +123,17 @@ void MetaBuilder::CalculateMetaComponent(
     // mNamespaces's address
     mBasePtr = ALIGN(mBasePtr + sizeof(MetaComponent));
     // mConstatns's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaNamespace*) * NS_NUM);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaNamespace>) * NS_NUM);
     // mCoclasses's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaConstant*) * CONST_NUM);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaConstant>) * CONST_NUM);
     // mEnumerations's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaCoclass*) * CLS_NUM);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaCoclass>) * CLS_NUM);
     // mInterfaces's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaEnumeration*) * ENUMN_NUM);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaEnumeration>) * ENUMN_NUM);
     // mTypes's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaInterface*) * ITF_NUM);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaInterface>) * ITF_NUM);
     // mStringPool's address
-    mBasePtr = mBasePtr + sizeof(MetaType*) * TP_NUM;
+    mBasePtr = mBasePtr + sizeof(MetaPointer<MetaType>) * TP_NUM;
 
     for (int i = 0; i < NS_NUM; i++) {
         CalculateMetaNamespace(module->GetNamespace(i));
@@ -194,7 +194,7 @@ void MetaBuilder::CalculateMetaEnumeration(
     // mEnumerators's address
     mBasePtr = ALIGN(mBasePtr + sizeof(MetaEnumeration));
     // end address
-    mBasePtr = mBasePtr + sizeof(MetaEnumerator*) * ENUMR_NUM;
+    mBasePtr = mBasePtr + sizeof(MetaPointer<MetaEnumerator>) * ENUMR_NUM;
 
     for (int i = 0; i < ENUMR_NUM; i++) {
         CalculateMetaEnumerator(enumn->GetEnumerator(i));
@@ -230,9 +230,9 @@ void MetaBuilder::CalculateMetaInterface(
     // mConstants's address
     mBasePtr = ALIGN(mBasePtr + sizeof(int) * NEST_ITF_NUM);
     // mMethods's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaConstant*) * CONST_NUM);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaConstant>) * CONST_NUM);
     // end address
-    mBasePtr = mBasePtr + sizeof(MetaMethod*) * MTH_NUM;
+    mBasePtr = mBasePtr + sizeof(MetaPointer<MetaMethod>) * MTH_NUM;
 
     for (int i = 0; i < CONST_NUM; i++) {
         CalculateMetaConstant(itf->GetConstant(i));
@@ -275,7 +275,7 @@ void MetaBuilder::CalculateMetaMethod(
     // mParameters's address
     mBasePtr = ALIGN(mBasePtr + sizeof(MetaMethod));
     // end address
-    mBasePtr = mBasePtr + sizeof(MetaParameter*) * PARAM_NUM;
+    mBasePtr = mBasePtr + sizeof(MetaPointer<MetaParameter>) * PARAM_NUM;
 
     for (int i = 0; i < PARAM_NUM; i++) {
         CalculateMetaParameter(method->GetParameter(i));
@@ -354,6 +354,7 @@ void MetaBuilder::WriteMetaComponent(
     MetaComponent* mc = reinterpret_cast<MetaComponent*>(mBasePtr);
     mc->mMagic = CCM_MAGIC;
     mc->mSize = mSize;
+    mc->mVersion = CCM_METADATA_VERSION;
     module->GetUuid().Assign(mc->mUuid);
     mc->mNamespaceNumber = NS_NUM;
     mc->mConstantNumber = CONST_NUM;
@@ -365,24 +366,24 @@ void MetaBuilder::WriteMetaComponent(
     mc->mTypeNumber = TP_NUM;
     // mNamespaces's address
     mBasePtr = ALIGN(mBasePtr + sizeof(MetaComponent));
-    mc->mNamespaces = reinterpret_cast<MetaNamespace**>(mBasePtr);
+    mc->mNamespaces = reinterpret_cast<MetaPointer<MetaNamespace>*>(mBasePtr);
     // mConstants's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaNamespace*) * NS_NUM);
-    mc->mConstants = reinterpret_cast<MetaConstant**>(mBasePtr);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaNamespace>) * NS_NUM);
+    mc->mConstants = reinterpret_cast<MetaPointer<MetaConstant>*>(mBasePtr);
     // mCoclasses's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaConstant*) * CONST_NUM);
-    mc->mCoclasses = reinterpret_cast<MetaCoclass**>(mBasePtr);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaConstant>) * CONST_NUM);
+    mc->mCoclasses = reinterpret_cast<MetaPointer<MetaCoclass>*>(mBasePtr);
     // mEnumerations's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaCoclass*) * CLS_NUM);
-    mc->mEnumerations = reinterpret_cast<MetaEnumeration**>(mBasePtr);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaCoclass>) * CLS_NUM);
+    mc->mEnumerations = reinterpret_cast<MetaPointer<MetaEnumeration>*>(mBasePtr);
     // mInterfaces's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaEnumeration*) * ENUMN_NUM);
-    mc->mInterfaces = reinterpret_cast<MetaInterface**>(mBasePtr);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaEnumeration>) * ENUMN_NUM);
+    mc->mInterfaces = reinterpret_cast<MetaPointer<MetaInterface>*>(mBasePtr);
     // mTypes's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaInterface*) * ITF_NUM);
-    mc->mTypes = reinterpret_cast<MetaType**>(mBasePtr);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaInterface>) * ITF_NUM);
+    mc->mTypes = reinterpret_cast<MetaPointer<MetaType>*>(mBasePtr);
     // mStringPool's address
-    mBasePtr = mBasePtr + sizeof(MetaType*) * TP_NUM;
+    mBasePtr = mBasePtr + sizeof(MetaPointer<MetaType>) * TP_NUM;
     mc->mStringPool = reinterpret_cast<char*>(mBasePtr);
     // end address
     mBasePtr = mBasePtr + mStringPool.GetSize();
@@ -435,6 +436,7 @@ MetaCoclass* MetaBuilder::WriteMetaCoclass(
     mc->mInterfaceIndexes = reinterpret_cast<int*>(mBasePtr);
     mc->mConstructorDefault = klass->HasDefaultConstructor();
     mc->mConstructorDeleted = klass->IsConstructorDeleted();
+    mc->mThreadConfined = klass->IsThreadConfined();
     // end address
     mBasePtr = mBasePtr + sizeof(int) * ITF_NUM;
 
@@ -529,10 +531,10 @@ MetaEnumeration* MetaBuilder::WriteMetaEnumeration(
     me->mEnumeratorNumber = ENUMR_NUM;
     // mEnumerators's address
     mBasePtr = ALIGN(mBasePtr + sizeof(MetaEnumeration));
-    me->mEnumerators = reinterpret_cast<MetaEnumerator**>(mBasePtr);
+    me->mEnumerators = reinterpret_cast<MetaPointer<MetaEnumerator>*>(mBasePtr);
     me->mExternal = enumn->IsExternal();
     // end address
-    mBasePtr = mBasePtr + sizeof(MetaEnumerator*) * ENUMR_NUM;
+    mBasePtr = mBasePtr + sizeof(MetaPointer<MetaEnumerator>) * ENUMR_NUM;
 
     for (int i = 0; i < ENUMR_NUM; i++) {
         me->mEnumerators[i] = WriteMetaEnumerator(enumn->GetEnumerator(i));
@@ -583,12 +585,12 @@ MetaInterface* MetaBuilder::WriteMetaInterface(
     mi->mNestedInterfaceIndexes = reinterpret_cast<int*>(mBasePtr);
     // mConstants's address
     mBasePtr = ALIGN(mBasePtr + sizeof(int) * NEST_ITF_NUM);
-    mi->mConstants = reinterpret_cast<MetaConstant**>(mBasePtr);
+    mi->mConstants = reinterpret_cast<MetaPointer<MetaConstant>*>(mBasePtr);
     // mMethods's address
-    mBasePtr = ALIGN(mBasePtr + sizeof(MetaConstant*) * CONST_NUM);
-    mi->mMethods = reinterpret_cast<MetaMethod**>(mBasePtr);
+    mBasePtr = ALIGN(mBasePtr + sizeof(MetaPointer<MetaConstant>) * CONST_NUM);
+    mi->mMethods = reinterpret_cast<MetaPointer<MetaMethod>*>(mBasePtr);
     // end address
-    mBasePtr = mBasePtr + sizeof(MetaMethod*) * MTH_NUM;
+    mBasePtr = mBasePtr + sizeof(MetaPointer<MetaMethod>) * MTH_NUM;
     for (int i = 0; i < NEST_ITF_NUM; i++) {
         mi->mNestedInterfaceIndexes[i] = mModule->IndexOf(itf->GetNestedInterface(i));
     }
@@ -618,11 +620,12 @@ MetaMethod* MetaBuilder::WriteMetaMethod(
     mm->mParameterNumber = PARAM_NUM;
     // mParameters's address
     mBasePtr = ALIGN(mBasePtr + sizeof(MetaMethod));
-    mm->mParameters = reinterpret_cast<MetaParameter**>(mBasePtr);
+    mm->mParameters = reinterpret_cast<MetaPointer<MetaParameter>*>(mBasePtr);
     mm->mDeleted = method->IsDeleted();
     mm->mReference = method->IsReference();
+    mm->mOneway = method->IsOneway();
     // end address
-    mBasePtr = mBasePtr + sizeof(MetaParameter*) * PARAM_NUM;
+    mBasePtr = mBasePtr + sizeof(MetaPointer<MetaParameter>) * PARAM_NUM;
 
     for (int i = 0; i < PARAM_NUM; i++) {
         mm->mParameters[i] = WriteMetaParameter(method->GetParameter(i));
@@ -51,6 +51,7 @@ using ccm::metadata::MetaInterface;
 using ccm::metadata::MetaMethod;
 using ccm::metadata::MetaNamespace;
 using ccm::metadata::MetaParameter;
+using ccm::metadata::MetaPointer;
 using ccm::metadata::MetaType;
 
 namespace ccdl {
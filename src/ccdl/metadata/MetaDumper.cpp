@@ -48,6 +48,7 @@ String MetaDumper::DumpMetaComponent(
     builder.Append(prefix).Append("{\n");
     builder.Append(prefix).AppendFormat("    mMagic:0x%x\n", mc->mMagic);
     builder.Append(prefix).AppendFormat("    mSize:%d\n", mc->mSize);
+    builder.Append(prefix).AppendFormat("    mVersion:%d\n", mc->mVersion);
     builder.Append(prefix).Append("    mUuid:").Append(Uuid(mc->mUuid).Dump()).Append("\n");
     builder.Append(prefix).Append("    mName:").Append(mc->mName).Append("\n");
     builder.Append(prefix).Append("    mUrl:").Append(mc->mUrl).Append("\n");
@@ -100,7 +101,7 @@ String MetaDumper::DumpMetaCoclass(
     builder.Append(prefix).AppendFormat("    mInterfaceNumber:%d\n", mc->mInterfaceNumber);
     for (int i = 0; i < mc->mInterfaceNumber; i++) {
         builder.Append(prefix).AppendFormat("        %s\n",
-                mMetaComponet->mInterfaces[mc->mInterfaceIndexes[i]]->mName);
+                mMetaComponet->mInterfaces[mc->mInterfaceIndexes[i]]->mName.Get());
     }
     builder.Append(prefix).Append("}\n");
 
@@ -186,7 +187,7 @@ String MetaDumper::DumpMetaEnumeration(
     builder.Append(prefix).AppendFormat("    mEnumeratorNumber:%d\n", me->mEnumeratorNumber);
     for (int i = 0; i < me->mEnumeratorNumber; i++) {
         builder.Append(prefix).AppendFormat("        %s = %d\n",
-                me->mEnumerators[i]->mName, me->mEnumerators[i]->mValue);
+                me->mEnumerators[i]->mName.Get(), me->mEnumerators[i]->mValue);
     }
     builder.Append(prefix).Append("}\n");
 
@@ -210,7 +211,7 @@ String MetaDumper::DumpMetaInterface(
 
     for (int i = 0; i < mi->mNestedInterfaceNumber; i++) {
         builder.Append(prefix).AppendFormat("        %s\n",
-                mMetaComponet->mInterfaces[mi->mNestedInterfaceIndexes[i]]->mName);
+                mMetaComponet->mInterfaces[mi->mNestedInterfaceIndexes[i]]->mName.Get());
     }
 
     for (int i = 0; i < mi->mConstantNumber; i++) {
@@ -241,6 +242,7 @@ String MetaDumper::DumpMetaMethod(
         builder.Append(prefix).AppendFormat("        %s\n",
                 DumpMetaParameter(mm->mParameters[i]).string());
     }
+    builder.Append(prefix).AppendFormat("    mOneway:%s\n", mm->mOneway ? "true" : "false");
     builder.Append(prefix).Append("}\n");
 
     return builder.ToString();
@@ -258,17 +260,17 @@ String MetaDumper::DumpMetaNamespace(
     builder.Append(prefix).AppendFormat("    mCoclassNumber:%d\n", mn->mCoclassNumber);
     for (int i = 0; i < mn->mCoclassNumber; i++) {
         builder.Append(prefix).AppendFormat("        %s\n",
-                mMetaComponet->mCoclasses[mn->mCoclassIndexes[i]]->mName);
+                mMetaComponet->mCoclasses[mn->mCoclassIndexes[i]]->mName.Get());
     }
     builder.Append(prefix).AppendFormat("    mEnumerationNumber:%d\n", mn->mEnumerationNumber);
     for (int i = 0; i < mn->mEnumerationNumber; i++) {
         builder.Append(prefix).AppendFormat("        %s\n",
-                mMetaComponet->mEnumerations[mn->mEnumerationIndexes[i]]->mName);
+                mMetaComponet->mEnumerations[mn->mEnumerationIndexes[i]]->mName.Get());
     }
     builder.Append(prefix).AppendFormat("    mInterfaceNumber:%d\n", mn->mInterfaceNumber);
     for (int i = 0; i < mn->mInterfaceNumber; i++) {
         builder.Append(prefix).AppendFormat("        %s\n",
-                mMetaComponet->mInterfaces[mn->mInterfaceIndexes[i]]->mName);
+                mMetaComponet->mInterfaces[mn->mInterfaceIndexes[i]]->mName.Get());
     }
     builder.Append(prefix).Append("}\n");
 
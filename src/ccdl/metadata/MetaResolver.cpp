@@ -133,7 +133,7 @@ Type* MetaResolver::BuildInterface(
     interface->SetExternal(mi->mExternal);
     if (mi->mBaseInterfaceIndex != -1) {
         MetaInterface* baseMi = mMetaComponent->mInterfaces[mi->mBaseInterfaceIndex];
-        String baseIntfFullName = String::Format("%s%s", baseMi->mNamespace, baseMi->mName);
+        String baseIntfFullName = String::Format("%s%s", baseMi->mNamespace.Get(), baseMi->mName.Get());
         Interface* baseIntf = mPool->FindInterface(baseIntfFullName);
         if (baseIntf == nullptr) {
             Type* type = Resolve(baseIntfFullName);
@@ -174,6 +174,7 @@ Method* MetaResolver::BuildMethod(
     method->SetName(String(mm->mName));
     Type* type = BuildType(mMetaComponent->mTypes[mm->mReturnTypeIndex]);
     method->SetReturnType(type);
+    method->SetOneway(mm->mOneway);
 
     for (int i = 0; i < mm->mParameterNumber; i++) {
         Parameter* param = BuildParameter(mm->mParameters[i]);
@@ -243,7 +244,7 @@ Type* MetaResolver::BuildType(
             break;
         case CcmTypeKind::Enum: {
             MetaEnumeration* me = mMetaComponent->mEnumerations[mt->mIndex];
-            typeStr = String::Format("%s%s", me->mNamespace, me->mName);
+            typeStr = String::Format("%s%s", me->mNamespace.Get(), me->mName.Get());
             break;
         }
         case CcmTypeKind::Array: {
@@ -254,7 +255,7 @@ Type* MetaResolver::BuildType(
         }
         case CcmTypeKind::Interface: {
             MetaInterface* mi = mMetaComponent->mInterfaces[mt->mIndex];
-            typeStr = String::Format("%s%s", mi->mNamespace, mi->mName);
+            typeStr = String::Format("%s%s", mi->mNamespace.Get(), mi->mName.Get());
             break;
         }
         case CcmTypeKind::Triple:
@@ -22,7 +22,6 @@
 #include "../util/Logger.h"
 #include "../util/MetadataUtils.h"
 #include "../../runtime/metadata/Component.h"
-#include "../../runtime/metadata/MetaSerializer.h"
 
 #include <memory.h>
 #include <stdlib.h>
@@ -33,8 +32,6 @@ using ccdl::ast::PointerType;
 using ccdl::ast::ReferenceType;
 using ccdl::metadata::MetaResolver;
 
-using ccm::metadata::MetaSerializer;
-
 namespace ccdl {
 
 template<>
@@ -180,8 +177,6 @@ void Parser::LoadCcmrtMetadata()
     void* newData = MetadataUtils::ReadMetadataFromElf64(
             rtpath + "/ccmrt.so");
     if (newData == nullptr) return;
-    MetaSerializer serializer;
-    serializer.Deserialize(reinterpret_cast<uintptr_t>(newData));
     Module* externalModule = new Module(newData);
     MetaResolver resolver(externalModule, newData);
     resolver.InitializeModule();
@@ -341,6 +336,18 @@ bool Parser::ParseAttribute(
                 parseResult = ParseUrl(attr) && parseResult;
                 break;
             }
+            case Tokenizer::Token::ONEWAY: {
+                // read "oneway"
+                mTokenizer.GetToken();
+                attr.mOneway = true;
+                break;
+            }
+            case Tokenizer::Token::THREAD_CONFINED: {
+                // read "thread-confined"
+                mTokenizer.GetToken();
+                attr.mThreadConfined = true;
+                break;
+            }
             default: {
                 String message = String::Format("\"%s\" is not expected.",
                         mTokenizer.DumpToken(token));
@@ -552,6 +559,16 @@ bool Parser::ParseInterface(
         LogError(token, message);
         parseResult = false;
     }
+    else if (attr->mOneway) {
+        String message = String::Format("Interface %s can not be oneway.", itfName.string());
+        LogError(token, message);
+        parseResult = false;
+    }
+    else if (attr->mThreadConfined) {
+        String message = String::Format("Interface %s can not be thread-confined.", itfName.string());
+        LogError(token, message);
+        parseResult = false;
+    }
 
     Interface* interface = nullptr;
 
@@ -711,6 +728,11 @@ bool Parser::ParseNestedInterface(
             mCurrNamespace = mCurrNamespace->GetOuterNamespace();
             break;
         }
+        case Tokenizer::Token::IDENTIFIER: {
+            // a method with attributes, such as [oneway]
+            parseResult = ParseMethod(outer, &attr) && parseResult;
+            break;
+        }
         default: {
             String message = String::Format("%s is not expected.", mTokenizer.DumpToken(token));
             LogError(token, message);
@@ -723,7 +745,8 @@ bool Parser::ParseNestedInterface(
 }
 
 bool Parser::ParseMethod(
-    /* [in] */ Interface* interface)
+    /* [in] */ Interface* interface,
+    /* [in] */ Attribute* attr)
 {
     bool parseResult = true;
 
@@ -741,6 +764,9 @@ bool Parser::ParseMethod(
     Method* method = new Method();
     method->SetName(mTokenizer.GetIdentifier());
     method->SetReturnType(mPool->FindType(String("ccm::ECode")));
+    if (attr != nullptr) {
+        method->SetOneway(attr->mOneway);
+    }
 
     token = mTokenizer.GetToken();
     if (token != Tokenizer::Token::PARENTHESES_OPEN) {
@@ -779,6 +805,26 @@ bool Parser::ParseMethod(
         return false;
     }
 
+    if (parseResult && attr != nullptr && (!attr->mUuid.IsNullOrEmpty() ||
+            !attr->mVersion.IsNullOrEmpty() || !attr->mDescription.IsNullOrEmpty() ||
+            !attr->mUrl.IsNullOrEmpty() || attr->mThreadConfined)) {
+        LogError(token, String::Format("The method \"%s\" only accepts the oneway attribute.",
+                method->GetName().string()));
+        parseResult = false;
+    }
+
+    if (parseResult && method->IsOneway()) {
+        // Nobody waits for the results of a oneway call.
+        for (int i = 0; i < method->GetParameterNumber(); i++) {
+            if (method->GetParameter(i)->GetAttribute() & Parameter::OUT) {
+                LogError(token, String::Format("The oneway method \"%s\" has out parameters.",
+                        method->GetName().string()));
+                parseResult = false;
+                break;
+            }
+        }
+    }
+
     if (parseResult) {
         if (interface->FindMethod(method->GetName(), method->GetSignature()) != nullptr) {
             LogError(token, String::Format("The method \"%s\" is redeclared.",
@@ -1672,6 +1718,11 @@ bool Parser::ParseCoclass(
         LogError(token, message);
         parseResult = false;
     }
+    else if (attr->mOneway) {
+        String message = String::Format("Coclass %s can not be oneway.", className.string());
+        LogError(token, message);
+        parseResult = false;
+    }
 
     Coclass* klass = new Coclass();
     klass->SetName(className);
@@ -146,7 +146,8 @@ private:
         /* [in] */ Interface* interface);
 
     bool ParseMethod(
-        /* [in] */ Interface* interface);
+        /* [in] */ Interface* interface,
+        /* [in] */ Attribute* attr = nullptr);
 
     bool ParseParameter(
         /* [in] */ Method* method);
@@ -24,7 +24,7 @@ struct KV
     String mKey;
     Tokenizer::Token mValue;
 }
-sKeywords[35] =
+sKeywords[37] =
 {
     { String("Array"), Tokenizer::Token::ARRAY },
     { String("Boolean"), Tokenizer::Token::BOOLEAN },
@@ -53,9 +53,11 @@ sKeywords[35] =
     { String("module"), Tokenizer::Token::MODULE },
     { String("namespace"), Tokenizer::Token::NAMESPACE },
     { String("nullptr"), Tokenizer::Token::NULLPTR },
+    { String("oneway"), Tokenizer::Token::ONEWAY },
     { String("out"), Tokenizer::Token::OUT },
     { String("Short"), Tokenizer::Token::SHORT },
     { String("String"), Tokenizer::Token::STRING },
+    { String("thread-confined"), Tokenizer::Token::THREAD_CONFINED },
     { String("Triple"), Tokenizer::Token::TRIPLE },
     { String("true"), Tokenizer::Token::TRUE },
     { String("url"), Tokenizer::Token::URL },
@@ -894,6 +896,8 @@ const char* Tokenizer::DumpToken(
             return mNumberString.string();
         case Token::NUMBER_FLOATINGPOINT:
             return mNumberString.string();
+        case Token::ONEWAY:
+            return "oneway";
         case Token::OUT:
             return "out";
         case Token::PARENTHESES_OPEN:
@@ -918,6 +922,8 @@ const char* Tokenizer::DumpToken(
             return "String";
         case Token::STRING_LITERAL:
             return mString.string();
+        case Token::THREAD_CONFINED:
+            return "thread-confined";
         case Token::TRIPLE:
             return "Triple";
         case Token::TRUE:
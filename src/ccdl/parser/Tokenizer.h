@@ -61,50 +61,52 @@ public:
         MODULE,                 // 28)
         NAMESPACE,              // 29)
         NULLPTR,                // 30)
-        OUT,                    // 31)
-        TRUE,                   // 32)
-        URL,                    // 33)
-        UUID,                   // 34)
-        VERSION,                // 35)
+        ONEWAY,                 // 31)
+        OUT,                    // 32)
+        THREAD_CONFINED,        // 33)
+        TRUE,                   // 34)
+        URL,                    // 35)
+        UUID,                   // 36)
+        VERSION,                // 37)
         // symbol
-        AMPERSAND,              // 36)  '&'
-        ANGLE_BRACKETS_OPEN,    // 37)  '<'
-        ANGLE_BRACKETS_CLOSE,   // 38)  '>'
-        ASSIGNMENT,             // 39)  '='
-        ASTERISK,               // 40)  '*'
-        BRACES_OPEN,            // 41)  '{'
-        BRACES_CLOSE,           // 42)  '}'
-        BRACKETS_OPEN,          // 43)  '['
-        BRACKETS_CLOSE,         // 44)  ']'
-        COLON,                  // 45)  ':'
-        COMMA,                  // 46)  ','
-        COMPLIMENT,             // 47)  '~'
-        DIVIDE,                 // 48)  '/'
-        END_OF_LINE,            // 49)  '\n'
-        EXCLUSIVE_OR,           // 50)  '^'
-        INCLUSIVE_OR,           // 51)  '|'
-        MINUS,                  // 52)  '-'
-        MODULO,                 // 53)  '%'
-        NOT,                    // 54)  '!'
-        PARENTHESES_OPEN,       // 55)  '('
-        PARENTHESES_CLOSE,      // 56)  ')'
-        PERIOD,                 // 57)  '.'
-        PLUS,                   // 58)  '+'
-        SEMICOLON,              // 59)  ';'
+        AMPERSAND,              // 38)  '&'
+        ANGLE_BRACKETS_OPEN,    // 39)  '<'
+        ANGLE_BRACKETS_CLOSE,   // 40)  '>'
+        ASSIGNMENT,             // 41)  '='
+        ASTERISK,               // 42)  '*'
+        BRACES_OPEN,            // 43)  '{'
+        BRACES_CLOSE,           // 44)  '}'
+        BRACKETS_OPEN,          // 45)  '['
+        BRACKETS_CLOSE,         // 46)  ']'
+        COLON,                  // 47)  ':'
+        COMMA,                  // 48)  ','
+        COMPLIMENT,             // 49)  '~'
+        DIVIDE,                 // 50)  '/'
+        END_OF_LINE,            // 51)  '\n'
+        EXCLUSIVE_OR,           // 52)  '^'
+        INCLUSIVE_OR,           // 53)  '|'
+        MINUS,                  // 54)  '-'
+        MODULO,                 // 55)  '%'
+        NOT,                    // 56)  '!'
+        PARENTHESES_OPEN,       // 57)  '('
+        PARENTHESES_CLOSE,      // 58)  ')'
+        PERIOD,                 // 59)  '.'
+        PLUS,                   // 60)  '+'
+        SEMICOLON,              // 61)  ';'
         // other
-        CHARACTER,              // 60)
-        COMMENT_BLOCK,          // 61)
-        COMMENT_LINE,           // 62)
-        END_OF_FILE,            // 63)
-        IDENTIFIER,             // 64)
-        NUMBER_INTEGRAL,        // 65)
-        NUMBER_FLOATINGPOINT,   // 66)
-        SHIFT_LEFT,             // 67)  "<<"
-        SHIFT_RIGHT,            // 68)  ">>"
-        SHIFT_RIGHT_UNSIGNED,   // 69)  ">>>"
-        STRING_LITERAL,         // 70)
-        UUID_NUMBER,            // 71)
-        VERSION_NUMBER,         // 72)
+        CHARACTER,              // 62)
+        COMMENT_BLOCK,          // 63)
+        COMMENT_LINE,           // 64)
+        END_OF_FILE,            // 65)
+        IDENTIFIER,             // 66)
+        NUMBER_INTEGRAL,        // 67)
+        NUMBER_FLOATINGPOINT,   // 68)
+        SHIFT_LEFT,             // 69)  "<<"
+        SHIFT_RIGHT,            // 70)  ">>"
+        SHIFT_RIGHT_UNSIGNED,   // 71)  ">>>"
+        STRING_LITERAL,         // 72)
+        UUID_NUMBER,            // 73)
+        VERSION_NUMBER,         // 74)
     };
 
 private:
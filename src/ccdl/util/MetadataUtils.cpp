@@ -109,7 +109,7 @@ void* MetadataUtils::ReadMetadataFromElf64(
         return nullptr;
     }
 
-    if (fseek(fd, mdSec->sh_offset + sizeof(int), SEEK_SET) < 0) {
+    if (fseek(fd, mdSec->sh_offset + CCM_METADATA_OFFSET, SEEK_SET) < 0) {
         Logger::E("MetadataUtils", "Seek \"%s\" file failed.", comPath);
         free(shdrs);
         free(strTable);
@@ -132,7 +132,14 @@ void* MetadataUtils::ReadMetadataFromElf64(
         return nullptr;
     }
 
-    if (fseek(fd, mdSec->sh_offset + sizeof(int), SEEK_SET) < 0) {
+    if (metadata.mVersion != CCM_METADATA_VERSION) {
+        Logger::E("MetadataUtils", "The metadata version %d of \"%s\" file is not supported.",
+                metadata.mVersion, comPath);
+        free(shdrs);
+        return nullptr;
+    }
+
+    if (fseek(fd, mdSec->sh_offset + CCM_METADATA_OFFSET, SEEK_SET) < 0) {
         Logger::E("MetadataUtils", "Seek \"%s\" file failed.", comPath);
         free(shdrs);
         return nullptr;
@@ -186,6 +193,12 @@ void* MetadataUtils::ReadMetadataFromFile(
         return nullptr;
     }
 
+    if (metadata.mVersion != CCM_METADATA_VERSION) {
+        Logger::E("MetadataUtils", "The metadata version %d of \"%s\" file is not supported.",
+                metadata.mVersion, comPath);
+        return nullptr;
+    }
+
     if (fseek(fd, 0, SEEK_SET) == -1) {
         Logger::E("MetadataUtils", "Seek \"%s\" file failed.", comPath);
         return nullptr;
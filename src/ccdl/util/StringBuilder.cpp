@@ -101,15 +101,21 @@ StringBuilder& StringBuilder::AppendFormat(
     va_start(args, format);
     va_copy(args1, args);
 
-    int len = vsnprintf(nullptr, 0, format, args);
+    // Print into the spare capacity first, most formats fit in it.
+    int spare = mCapacity - mPosition;
+    int len = vsnprintf(mBuffer != nullptr ? mBuffer + mPosition : nullptr,
+            spare, format, args);
     va_end(args);
 
-    if (mPosition + len + 1 >= mCapacity) {
-        if (!Enlarge(len + 1)) return *this;
+    if (len >= spare) {
+        if (!Enlarge(len + 1)) {
+            va_end(args1);
+            return *this;
+        }
+        vsnprintf(mBuffer + mPosition, len + 1, format, args1);
     }
-
-    vsnprintf(mBuffer + mPosition, len + 1, format, args1);
-    mPosition += len;
+    if (len > 0) mPosition += len;
+    else if (spare > 0) mBuffer[mPosition] = '\0';
     va_end(args1);
 
     return *this;
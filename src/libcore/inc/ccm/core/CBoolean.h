@@ -22,6 +22,7 @@
 #include "ccm.core.IComparable.h"
 #include "ccm.io.ISerializable.h"
 #include "_ccm_core_CBoolean.h"
+#include <ccmspinlock.h>
 
 using ccm::io::ISerializable;
 
@@ -42,6 +43,15 @@ public:
     ECode Constructor(
         /* [in] */ Boolean value);
 
+    COM_PUBLIC static AutoPtr<IBoolean> GetTRUE();
+
+    COM_PUBLIC static AutoPtr<IBoolean> GetFALSE();
+
+    COM_PUBLIC static AutoPtr<IBoolean> ValueOf(
+        /* [in] */ Boolean value);
+
+    static void ReleaseCache();
+
     ECode GetValue(
         /* [out] */ Boolean* value) override;
 
@@ -60,6 +70,9 @@ public:
         /* [out] */ String* str) override;
 
 private:
+    static IBoolean* sCache[2];
+    static Spinlock sCacheLock;
+
     Boolean mValue;
 };
 
@@ -22,6 +22,7 @@
 #include "ccm.io.ISerializable.h"
 #include "_ccm_core_CChar.h"
 #include "ccm/core/SyncObject.h"
+#include <ccmspinlock.h>
 
 using ccm::io::ISerializable;
 
@@ -42,6 +43,12 @@ public:
     ECode Constructor(
         /* [in] */ Char value);
 
+    // Every ASCII char has one shared object.
+    COM_PUBLIC static AutoPtr<IChar> ValueOf(
+        /* [in] */ Char value);
+
+    static void ReleaseCache();
+
     ECode GetValue(
         /* [out] */ Char* value) override;
 
@@ -60,6 +67,12 @@ public:
         /* [out] */ String* str) override;
 
 private:
+    static constexpr Char CACHE_LOW = 0;
+    static constexpr Char CACHE_HIGH = 127;
+
+    static IChar* sCache[CACHE_HIGH - CACHE_LOW + 1];
+    static Spinlock sCacheLock;
+
     Char mValue;
 };
 
@@ -23,6 +23,7 @@
 #include "ccm.io.ISerializable.h"
 #include "_ccm_core_CInteger.h"
 #include "ccm/core/SyncObject.h"
+#include <ccmspinlock.h>
 
 using ccm::io::ISerializable;
 
@@ -44,6 +45,15 @@ public:
     ECode Constructor(
         /* [in] */ Integer value);
 
+    // Values from -128 to 127 are boxed far more often than the others,
+    // so each of them has one shared object.
+    COM_PUBLIC static AutoPtr<IInteger> ValueOf(
+        /* [in] */ Integer value);
+
+    // Drops the shared objects, which would keep the component from
+    // being unloaded. They are made again when next asked for.
+    static void ReleaseCache();
+
     ECode ByteValue(
         /* [out] */ Byte* value) override;
 
@@ -80,6 +90,12 @@ public:
         /* [out] */ String* str) override;
 
 private:
+    static constexpr Integer CACHE_LOW = -128;
+    static constexpr Integer CACHE_HIGH = 127;
+
+    static IInteger* sCache[CACHE_HIGH - CACHE_LOW + 1];
+    static Spinlock sCacheLock;
+
     Integer mValue;
 };
 
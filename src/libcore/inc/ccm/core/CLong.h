@@ -23,6 +23,7 @@
 #include "ccm.io.ISerializable.h"
 #include "_ccm_core_CLong.h"
 #include "ccm/core/SyncObject.h"
+#include <ccmspinlock.h>
 
 using ccm::io::ISerializable;
 
@@ -44,6 +45,12 @@ public:
     ECode Constructor(
         /* [in] */ Long value);
 
+    // Like CInteger::ValueOf(), small values share one object.
+    COM_PUBLIC static AutoPtr<ILong> ValueOf(
+        /* [in] */ Long value);
+
+    static void ReleaseCache();
+
     ECode ByteValue(
         /* [out] */ Byte* value) override;
 
@@ -80,6 +87,12 @@ public:
         /* [out] */ String* str) override;
 
 private:
+    static constexpr Long CACHE_LOW = -128;
+    static constexpr Long CACHE_HIGH = 127;
+
+    static ILong* sCache[CACHE_HIGH - CACHE_LOW + 1];
+    static Spinlock sCacheLock;
+
     Long mValue;
 };
 
@@ -90,7 +90,7 @@ private:
     static constexpr Long sAddend = 0xBll;
     static constexpr Long sMask = (1ll << 48) - 1;
 
-    static constexpr Double DOUBLE_UNIT = 0x1.0p-53;
+    static constexpr Double DOUBLE_UNIT = 1.0 / (1ll << 53);
 
     Double mNextNextGaussian = 0;
     Boolean mHaveNextNextGaussian = false;
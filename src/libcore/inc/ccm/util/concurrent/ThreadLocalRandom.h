@@ -149,8 +149,8 @@ private:
     static constexpr Long SEEDER_INCREMENT = 0xbb67ae8584caa73bll;
 
     // Constants from SplittableRandom
-    static constexpr Double DOUBLE_UNIT = 0x1.0p-53;  // 1.0  / (1L << 53)
-    static constexpr Float FLOAT_UNIT  = 0x1.0p-24f; // 1.0f / (1 << 24)
+    static constexpr Double DOUBLE_UNIT = 1.0 / (1ll << 53);
+    static constexpr Float FLOAT_UNIT  = 1.0f / (1 << 24);
 };
 
 inline ThreadLocalRandom::ThreadLocalRandom()
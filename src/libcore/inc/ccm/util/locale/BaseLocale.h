@@ -128,6 +128,8 @@ public:
 private:
     static Cache* Get_CACHE();
 
+    // Only the constant locales are made this way, so their fields are
+    // interned. Others are not, as the pool never gives entries back.
     BaseLocale(
         /* [in] */ const String& language,
         /* [in] */ const String& region);
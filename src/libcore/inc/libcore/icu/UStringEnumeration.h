@@ -27,7 +27,7 @@ namespace icu {
  * A wrapper to make a UEnumeration into a StringEnumeration.  The
  * wrapper adopts the UEnumeration is wraps.
  */
-class UStringEnumeration : public StringEnumeration {
+class UStringEnumeration : public ::icu::StringEnumeration {
 
 public:
     /**
@@ -61,7 +61,7 @@ public:
      * @param status the error code.
      * @return a pointer to the string, or NULL.
      */
-    virtual const UnicodeString* snext(UErrorCode& status);
+    virtual const ::icu::UnicodeString* snext(UErrorCode& status);
 
     /**
      * Resets the iterator.
@@ -32,6 +32,62 @@ ECode CBoolean::Constructor(
     return NOERROR;
 }
 
+IBoolean* CBoolean::sCache[2];
+Spinlock CBoolean::sCacheLock;
+
+AutoPtr<IBoolean> CBoolean::GetTRUE()
+{
+    return ValueOf(true);
+}
+
+AutoPtr<IBoolean> CBoolean::GetFALSE()
+{
+    return ValueOf(false);
+}
+
+AutoPtr<IBoolean> CBoolean::ValueOf(
+    /* [in] */ Boolean value)
+{
+    AutoPtr<IBoolean> obj;
+
+    // ReleaseCache() may drop a cached object at any time, so the
+    // reference to it is taken under the cache lock.
+    IBoolean** slot = &sCache[value ? 1 : 0];
+    sCacheLock.Lock();
+    obj = *slot;
+    sCacheLock.Unlock();
+    if (obj != nullptr) {
+        return obj;
+    }
+
+    CBoolean::New(value, IID_IBoolean, (IInterface**)&obj);
+    AutoPtr<IBoolean> cached;
+    sCacheLock.Lock();
+    if (*slot == nullptr) {
+        *slot = obj;
+        REFCOUNT_ADD(*slot);
+    }
+    else {
+        cached = *slot;
+    }
+    sCacheLock.Unlock();
+    return cached != nullptr ? cached : obj;
+}
+
+void CBoolean::ReleaseCache()
+{
+    IBoolean* cache[2];
+    sCacheLock.Lock();
+    for (Integer i = 0; i < 2; i++) {
+        cache[i] = sCache[i];
+        sCache[i] = nullptr;
+    }
+    sCacheLock.Unlock();
+    for (Integer i = 0; i < 2; i++) {
+        REFCOUNT_RELEASE(cache[i]);
+    }
+}
+
 ECode CBoolean::GetValue(
     /* [out] */ Boolean* value)
 {
@@ -32,6 +32,56 @@ ECode CChar::Constructor(
     return NOERROR;
 }
 
+IChar* CChar::sCache[CACHE_HIGH - CACHE_LOW + 1];
+Spinlock CChar::sCacheLock;
+
+AutoPtr<IChar> CChar::ValueOf(
+    /* [in] */ Char value)
+{
+    AutoPtr<IChar> obj;
+    if (value < CACHE_LOW || value > CACHE_HIGH) {
+        CChar::New(value, IID_IChar, (IInterface**)&obj);
+        return obj;
+    }
+
+    // ReleaseCache() may drop a cached object at any time, so the
+    // reference to it is taken under the cache lock.
+    IChar** slot = &sCache[value - CACHE_LOW];
+    sCacheLock.Lock();
+    obj = *slot;
+    sCacheLock.Unlock();
+    if (obj != nullptr) {
+        return obj;
+    }
+
+    CChar::New(value, IID_IChar, (IInterface**)&obj);
+    AutoPtr<IChar> cached;
+    sCacheLock.Lock();
+    if (*slot == nullptr) {
+        *slot = obj;
+        REFCOUNT_ADD(*slot);
+    }
+    else {
+        cached = *slot;
+    }
+    sCacheLock.Unlock();
+    return cached != nullptr ? cached : obj;
+}
+
+void CChar::ReleaseCache()
+{
+    IChar* cache[CACHE_HIGH - CACHE_LOW + 1];
+    sCacheLock.Lock();
+    for (Integer i = 0; i < CACHE_HIGH - CACHE_LOW + 1; i++) {
+        cache[i] = sCache[i];
+        sCache[i] = nullptr;
+    }
+    sCacheLock.Unlock();
+    for (Integer i = 0; i < CACHE_HIGH - CACHE_LOW + 1; i++) {
+        REFCOUNT_RELEASE(cache[i]);
+    }
+}
+
 ECode CChar::GetValue(
     /* [out] */ Char* value)
 {
@@ -32,6 +32,56 @@ ECode CInteger::Constructor(
     return NOERROR;
 }
 
+IInteger* CInteger::sCache[CACHE_HIGH - CACHE_LOW + 1];
+Spinlock CInteger::sCacheLock;
+
+AutoPtr<IInteger> CInteger::ValueOf(
+    /* [in] */ Integer value)
+{
+    AutoPtr<IInteger> obj;
+    if (value < CACHE_LOW || value > CACHE_HIGH) {
+        CInteger::New(value, IID_IInteger, (IInterface**)&obj);
+        return obj;
+    }
+
+    // ReleaseCache() may drop a cached object at any time, so the
+    // reference to it is taken under the cache lock.
+    IInteger** slot = &sCache[value - CACHE_LOW];
+    sCacheLock.Lock();
+    obj = *slot;
+    sCacheLock.Unlock();
+    if (obj != nullptr) {
+        return obj;
+    }
+
+    CInteger::New(value, IID_IInteger, (IInterface**)&obj);
+    AutoPtr<IInteger> cached;
+    sCacheLock.Lock();
+    if (*slot == nullptr) {
+        *slot = obj;
+        REFCOUNT_ADD(*slot);
+    }
+    else {
+        cached = *slot;
+    }
+    sCacheLock.Unlock();
+    return cached != nullptr ? cached : obj;
+}
+
+void CInteger::ReleaseCache()
+{
+    IInteger* cache[CACHE_HIGH - CACHE_LOW + 1];
+    sCacheLock.Lock();
+    for (Integer i = 0; i < CACHE_HIGH - CACHE_LOW + 1; i++) {
+        cache[i] = sCache[i];
+        sCache[i] = nullptr;
+    }
+    sCacheLock.Unlock();
+    for (Integer i = 0; i < CACHE_HIGH - CACHE_LOW + 1; i++) {
+        REFCOUNT_RELEASE(cache[i]);
+    }
+}
+
 ECode CInteger::ByteValue(
     /* [out] */ Byte* value)
 {
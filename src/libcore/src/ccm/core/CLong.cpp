@@ -32,6 +32,56 @@ ECode CLong::Constructor(
     return NOERROR;
 }
 
+ILong* CLong::sCache[CACHE_HIGH - CACHE_LOW + 1];
+Spinlock CLong::sCacheLock;
+
+AutoPtr<ILong> CLong::ValueOf(
+    /* [in] */ Long value)
+{
+    AutoPtr<ILong> obj;
+    if (value < CACHE_LOW || value > CACHE_HIGH) {
+        CLong::New(value, IID_ILong, (IInterface**)&obj);
+        return obj;
+    }
+
+    // ReleaseCache() may drop a cached object at any time, so the
+    // reference to it is taken under the cache lock.
+    ILong** slot = &sCache[value - CACHE_LOW];
+    sCacheLock.Lock();
+    obj = *slot;
+    sCacheLock.Unlock();
+    if (obj != nullptr) {
+        return obj;
+    }
+
+    CLong::New(value, IID_ILong, (IInterface**)&obj);
+    AutoPtr<ILong> cached;
+    sCacheLock.Lock();
+    if (*slot == nullptr) {
+        *slot = obj;
+        REFCOUNT_ADD(*slot);
+    }
+    else {
+        cached = *slot;
+    }
+    sCacheLock.Unlock();
+    return cached != nullptr ? cached : obj;
+}
+
+void CLong::ReleaseCache()
+{
+    ILong* cache[CACHE_HIGH - CACHE_LOW + 1];
+    sCacheLock.Lock();
+    for (Integer i = 0; i < CACHE_HIGH - CACHE_LOW + 1; i++) {
+        cache[i] = sCache[i];
+        sCache[i] = nullptr;
+    }
+    sCacheLock.Unlock();
+    for (Integer i = 0; i < CACHE_HIGH - CACHE_LOW + 1; i++) {
+        REFCOUNT_RELEASE(cache[i]);
+    }
+}
+
 ECode CLong::ByteValue(
     /* [out] */ Byte* value)
 {
@@ -31,33 +31,25 @@ namespace core {
 AutoPtr<IChar> CoreUtils::Box(
     /* [in] */ Char c)
 {
-    AutoPtr<IChar> ch;
-    CChar::New(c, IID_IChar, (IInterface**)&ch);
-    return ch;
+    return CChar::ValueOf(c);
 }
 
 AutoPtr<IBoolean> CoreUtils::Box(
     /* [in] */ Boolean b)
 {
-    AutoPtr<IBoolean> bo;
-    CBoolean::New(b, IID_IBoolean, (IInterface**)&bo);
-    return bo;
+    return CBoolean::ValueOf(b);
 }
 
 AutoPtr<IInteger> CoreUtils::Box(
     /* [in] */ Integer i)
 {
-    AutoPtr<IInteger> io;
-    CInteger::New(i, IID_IInteger, (IInterface**)&io);
-    return io;
+    return CInteger::ValueOf(i);
 }
 
 AutoPtr<ILong> CoreUtils::Box(
     /* [in] */ Long l)
 {
-    AutoPtr<ILong> lo;
-    CLong::New(l, IID_ILong, (IInterface**)&lo);
-    return lo;
+    return CLong::ValueOf(l);
 }
 
 AutoPtr<IDouble> CoreUtils::Box(
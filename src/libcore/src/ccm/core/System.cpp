@@ -91,7 +91,7 @@ AutoPtr<IProperties> System::InitUnchangeableSystemProperties()
 
     Integer N = ArrayLength(HardcodedSystemProperties::STATIC_PROPERTIES);
     for (Integer i = 0; i < N; i++) {
-        String pair[2] = HardcodedSystemProperties::STATIC_PROPERTIES[i];
+        const String* pair = HardcodedSystemProperties::STATIC_PROPERTIES[i];
         Boolean contains;
         if (p->ContainsKey(CoreUtils::Box(pair[0]), &contains), contains) {
             LogE(String("Ignoring command line argument: -D") + pair[0]);
@@ -14,6 +14,10 @@
 // limitations under the License.
 //=========================================================================
 
+#include "ccm/core/CBoolean.h"
+#include "ccm/core/CChar.h"
+#include "ccm/core/CInteger.h"
+#include "ccm/core/CLong.h"
 #include "ccm/core/NativeRuntime.h"
 #include <ccmlogger.h>
 #include <ccmtypes.h>
@@ -36,5 +40,15 @@ void CoreStartup()
     }
 }
 
+// The class loader calls this before it checks whether the component
+// can be unloaded, as the objects cached here would keep it loaded.
+EXTERN_C COM_PUBLIC void soReleaseCaches()
+{
+    CBoolean::ReleaseCache();
+    CChar::ReleaseCache();
+    CInteger::ReleaseCache();
+    CLong::ReleaseCache();
+}
+
 }
 }
\ No newline at end of file
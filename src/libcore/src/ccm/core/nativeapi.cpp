@@ -18,6 +18,7 @@
 #include "ccm/core/NativeObject.h"
 #include "ccm/core/NativeThread.h"
 #include <ccmlogger.h>
+#include <errno.h>
 
 namespace ccm {
 namespace core {
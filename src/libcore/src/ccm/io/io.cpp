@@ -57,7 +57,7 @@ ECode CDirectByteBuffer::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::io::CDirectByteBuffer"));
+    _obj->AttachMetadata(comp, "ccm::io::CDirectByteBuffer");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -86,7 +86,7 @@ ECode CDirectByteBuffer::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::io::CDirectByteBuffer"));
+    _obj->AttachMetadata(comp, "ccm::io::CDirectByteBuffer");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -119,7 +119,7 @@ ECode CDirectByteBuffer::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::io::CDirectByteBuffer"));
+    _obj->AttachMetadata(comp, "ccm::io::CDirectByteBuffer");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -153,7 +153,7 @@ ECode CDirectByteBuffer::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::io::CDirectByteBuffer"));
+    _obj->AttachMetadata(comp, "ccm::io::CDirectByteBuffer");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
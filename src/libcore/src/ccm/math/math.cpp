@@ -45,7 +45,7 @@ ECode CBigDecimal::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::math::CBigDecimal"));
+    _obj->AttachMetadata(comp, "ccm::math::CBigDecimal");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -72,7 +72,7 @@ ECode CBigDecimal::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::math::CBigDecimal"));
+    _obj->AttachMetadata(comp, "ccm::math::CBigDecimal");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -99,7 +99,7 @@ ECode CBigInteger::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::math::CBigInteger"));
+    _obj->AttachMetadata(comp, "ccm::math::CBigInteger");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -126,7 +126,7 @@ ECode CBigInteger::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::math::CBigInteger"));
+    _obj->AttachMetadata(comp, "ccm::math::CBigInteger");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -154,7 +154,7 @@ ECode CBigInteger::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::math::CBigInteger"));
+    _obj->AttachMetadata(comp, "ccm::math::CBigInteger");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
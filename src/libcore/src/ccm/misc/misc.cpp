@@ -45,7 +45,7 @@ ECode CFDBigInteger::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::misc::CFDBigInteger"));
+    _obj->AttachMetadata(comp, "ccm::misc::CFDBigInteger");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -48,7 +48,7 @@ ECode CSecureRandom::New(
 
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::security::CSecureRandom"));
+    _obj->AttachMetadata(comp, "ccm::security::CSecureRandom");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -52,7 +52,7 @@ ECode CAttributedCharacterIteratorAttribute::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::text::CAttributedCharacterIteratorAttribute"));
+    _obj->AttachMetadata(comp, "ccm::text::CAttributedCharacterIteratorAttribute");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -81,7 +81,7 @@ ECode CAttributedString::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::text::CAttributedString"));
+    _obj->AttachMetadata(comp, "ccm::text::CAttributedString");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -109,7 +109,7 @@ ECode CChoiceFormat::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    cfObj->AttachMetadata(comp, String("ccm::text::CChoiceFormat"));
+    cfObj->AttachMetadata(comp, "ccm::text::CChoiceFormat");
     *obj = cfObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -137,7 +137,7 @@ ECode CDateFormatField::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::text::CDateFormatField"));
+    _obj->AttachMetadata(comp, "ccm::text::CDateFormatField");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -165,7 +165,7 @@ ECode CDateFormatSymbols::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    dfsObj->AttachMetadata(comp, String("ccm::text::CDateFormatSymbols"));
+    dfsObj->AttachMetadata(comp, "ccm::text::CDateFormatSymbols");
     *obj = dfsObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -193,7 +193,7 @@ ECode CDecimalFormat::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    dfObj->AttachMetadata(comp, String("ccm::text::CDecimalFormat"));
+    dfObj->AttachMetadata(comp, "ccm::text::CDecimalFormat");
     *obj = dfObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -221,7 +221,7 @@ ECode CDecimalFormatSymbols::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    dfsObj->AttachMetadata(comp, String("ccm::text::CDecimalFormatSymbols"));
+    dfsObj->AttachMetadata(comp, "ccm::text::CDecimalFormatSymbols");
     *obj = dfsObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -251,7 +251,7 @@ ECode CMessageFormat::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    mfObj->AttachMetadata(comp, String("ccm::text::CMessageFormat"));
+    mfObj->AttachMetadata(comp, "ccm::text::CMessageFormat");
     *obj = mfObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -282,7 +282,7 @@ ECode CSimpleDateFormat::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    sdfObj->AttachMetadata(comp, String("ccm::text::CSimpleDateFormat"));
+    sdfObj->AttachMetadata(comp, "ccm::text::CSimpleDateFormat");
     *object = sdfObj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -309,7 +309,7 @@ ECode CSimpleDateFormat::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    sdfObj->AttachMetadata(comp, String("ccm::text::CSimpleDateFormat"));
+    sdfObj->AttachMetadata(comp, "ccm::text::CSimpleDateFormat");
     *obj = sdfObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -42,9 +42,9 @@ BaseLocale::Cache* BaseLocale::Get_CACHE()
 BaseLocale::BaseLocale(
     /* [in] */ const String& language,
     /* [in] */ const String& region)
-    : mLanguage(language)
+    : mLanguage(language.Intern())
     , mScript("")
-    , mRegion(region)
+    , mRegion(region.Intern())
     , mVariant("")
 {}
 
@@ -74,7 +74,7 @@ ECode CArrayList::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CArrayList"));
+    newObj->AttachMetadata(comp, "ccm::util::CArrayList");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -102,7 +102,7 @@ ECode CDate::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CDate"));
+    newObj->AttachMetadata(comp, "ccm::util::CDate");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -132,7 +132,7 @@ ECode CGregorianCalendar::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CGregorianCalendar"));
+    newObj->AttachMetadata(comp, "ccm::util::CGregorianCalendar");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -166,7 +166,7 @@ ECode CGregorianCalendar::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::util::CGregorianCalendar"));
+    _obj->AttachMetadata(comp, "ccm::util::CGregorianCalendar");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -196,7 +196,7 @@ ECode CGregorianCalendar::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::util::CGregorianCalendar"));
+    _obj->AttachMetadata(comp, "ccm::util::CGregorianCalendar");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -224,7 +224,7 @@ ECode CGregorianCalendar::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::util::CGregorianCalendar"));
+    _obj->AttachMetadata(comp, "ccm::util::CGregorianCalendar");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -252,7 +252,7 @@ ECode CHashMap::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CHashMap"));
+    newObj->AttachMetadata(comp, "ccm::util::CHashMap");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -280,7 +280,7 @@ ECode CHashSet::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CHashSet"));
+    newObj->AttachMetadata(comp, "ccm::util::CHashSet");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -308,7 +308,7 @@ ECode CHashtable::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CHashtable"));
+    newObj->AttachMetadata(comp, "ccm::util::CHashtable");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -336,7 +336,7 @@ ECode CLinkedHashMap::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CLinkedHashMap"));
+    newObj->AttachMetadata(comp, "ccm::util::CLinkedHashMap");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -364,7 +364,7 @@ ECode CLinkedHashSet::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CLinkedHashSet"));
+    newObj->AttachMetadata(comp, "ccm::util::CLinkedHashSet");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -392,7 +392,7 @@ ECode CLinkedList::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CLinkedList"));
+    newObj->AttachMetadata(comp, "ccm::util::CLinkedList");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -420,7 +420,7 @@ ECode CLocale::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CLocale"));
+    newObj->AttachMetadata(comp, "ccm::util::CLocale");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -441,7 +441,7 @@ ECode CLocale::New(
 
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::util::CLocale"));
+    _obj->AttachMetadata(comp, "ccm::util::CLocale");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -468,7 +468,7 @@ ECode CLocale::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::util::CLocale"));
+    _obj->AttachMetadata(comp, "ccm::util::CLocale");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -498,7 +498,7 @@ ECode CProperties::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CProperties"));
+    newObj->AttachMetadata(comp, "ccm::util::CProperties");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -531,7 +531,7 @@ ECode CSimpleTimeZone::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CSimpleTimeZone"));
+    newObj->AttachMetadata(comp, "ccm::util::CSimpleTimeZone");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -552,7 +552,7 @@ ECode CSimpleTimeZone::New(
 
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::util::CSimpleTimeZone"));
+    _obj->AttachMetadata(comp, "ccm::util::CSimpleTimeZone");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -582,7 +582,7 @@ ECode CTreeMap::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CTreeMap"));
+    newObj->AttachMetadata(comp, "ccm::util::CTreeMap");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -610,7 +610,7 @@ ECode CTreeSet::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CTreeSet"));
+    newObj->AttachMetadata(comp, "ccm::util::CTreeSet");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
@@ -636,7 +636,7 @@ ECode CTreeSet::New(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    _obj->AttachMetadata(comp, String("ccm::util::CTreeSet"));
+    _obj->AttachMetadata(comp, "ccm::util::CTreeSet");
     *object = _obj->Probe(iid);
     REFCOUNT_ADD(*object);
     return NOERROR;
@@ -664,7 +664,7 @@ ECode CVector::Clone(
     }
     AutoPtr<IMetaComponent> comp;
     clsObject->GetMetadate(&comp);
-    newObj->AttachMetadata(comp, String("ccm::util::CVector"));
+    newObj->AttachMetadata(comp, "ccm::util::CVector");
     *obj = newObj->Probe(iid);
     REFCOUNT_ADD(*obj);
     return NOERROR;
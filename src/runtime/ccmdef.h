@@ -38,6 +38,7 @@ namespace ccm {
 
 #define COM_PUBLIC      __attribute__ ((visibility ("default")))
 #define COM_LOCAL       __attribute__ ((visibility ("hidden")))
+#define ALWAYS_INLINE   __attribute__ ((always_inline))
 
 #define INIT_PROI_1 __attribute__ ((init_priority (500)))
 #define INIT_PROI_2 __attribute__ ((init_priority (1000)))
@@ -164,6 +165,17 @@ inline int ArrayLength(const T (&)[N])
         /* [out] */ InterfaceID* iid) override;
 #endif
 
+#ifndef CCM_INTERFACE_PROBE_SUPER
+#define CCM_INTERFACE_PROBE_SUPER(SuperClassName)               \
+    static ProbeCache sProbeCache;                              \
+    IInterface* object;                                         \
+    if (!sProbeCache.Find(this, iid, &object)) {                \
+        object = SuperClassName::Probe(iid);                    \
+        sProbeCache.Put(this, sizeof(*this), iid, object);      \
+    }                                                           \
+    return object
+#endif
+
 #ifndef CCM_INTERFACE_IMPL_1
 #define CCM_INTERFACE_IMPL_1(ClassName, SuperClassName, InterfaceName)       \
     Integer ClassName::AddRef(                             \
@@ -187,7 +199,7 @@ inline int ArrayLength(const T (&)[N])
         else if (iid == IID_##InterfaceName) {             \
             return (InterfaceName*)this;                   \
         }                                                  \
-        return SuperClassName::Probe(iid);                 \
+        CCM_INTERFACE_PROBE_SUPER(SuperClassName);         \
     }                                                      \
                                                            \
     ECode ClassName::GetInterfaceID(                       \
@@ -230,7 +242,7 @@ inline int ArrayLength(const T (&)[N])
         else if (iid == IID_##Interface2) {                     \
             return (Interface2*)this;                           \
         }                                                       \
-        return SuperClassName::Probe(iid);                      \
+        CCM_INTERFACE_PROBE_SUPER(SuperClassName);              \
     }                                                           \
                                                                 \
     ECode ClassName::GetInterfaceID(                            \
@@ -281,7 +293,7 @@ inline int ArrayLength(const T (&)[N])
         else if (iid == IID_##Interface3) {                     \
             return (Interface3*)this;                           \
         }                                                       \
-        return SuperClassName::Probe(iid);                      \
+        CCM_INTERFACE_PROBE_SUPER(SuperClassName);              \
     }                                                           \
                                                                 \
     ECode ClassName::GetInterfaceID(                            \
@@ -338,7 +350,7 @@ inline int ArrayLength(const T (&)[N])
         else if (iid == IID_##Interface4) {                     \
             return (Interface4*)this;                           \
         }                                                       \
-        return SuperClassName::Probe(iid);                      \
+        CCM_INTERFACE_PROBE_SUPER(SuperClassName);              \
     }                                                           \
                                                                 \
     ECode ClassName::GetInterfaceID(                            \
@@ -401,7 +413,7 @@ inline int ArrayLength(const T (&)[N])
         else if (iid == IID_##Interface5) {                     \
             return (Interface5*)this;                           \
         }                                                       \
-        return SuperClassName::Probe(iid);                      \
+        CCM_INTERFACE_PROBE_SUPER(SuperClassName);              \
     }                                                           \
                                                                 \
     ECode ClassName::GetInterfaceID(                            \
@@ -470,7 +482,7 @@ inline int ArrayLength(const T (&)[N])
         else if (iid == IID_##Interface6) {                     \
             return (Interface6*)this;                           \
         }                                                       \
-        return SuperClassName::Probe(iid);                      \
+        CCM_INTERFACE_PROBE_SUPER(SuperClassName);              \
     }                                                           \
                                                                 \
     ECode ClassName::GetInterfaceID(                            \
@@ -545,7 +557,7 @@ inline int ArrayLength(const T (&)[N])
         else if (iid == IID_##Interface7) {                     \
             return (Interface7*)this;                           \
         }                                                       \
-        return SuperClassName::Probe(iid);                      \
+        CCM_INTERFACE_PROBE_SUPER(SuperClassName);              \
     }                                                           \
                                                                 \
     ECode ClassName::GetInterfaceID(                            \
@@ -710,7 +722,7 @@ inline int ArrayLength(const T (&)[N])
 
 #ifndef CCM_INTERFACE_PROBE_END
 #define CCM_INTERFACE_PROBE_END(SuperClassName)                 \
-        return SuperClassName::Probe(iid);                      \
+        CCM_INTERFACE_PROBE_SUPER(SuperClassName);              \
     }
 #endif
 
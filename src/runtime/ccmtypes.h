@@ -44,18 +44,18 @@ struct CoclassID
     static const CoclassID Null;
 };
 
-inline bool operator==(
+ALWAYS_INLINE inline bool operator==(
     /* [in] */ const CoclassID& cid1,
     /* [in] */ const CoclassID& cid2)
 {
-    return !memcmp(&cid1.mUuid, &cid2.mUuid, sizeof(Uuid));
+    return cid1.mUuid == cid2.mUuid;
 }
 
-inline bool operator!=(
+ALWAYS_INLINE inline bool operator!=(
     /* [in] */ const CoclassID& cid1,
     /* [in] */ const CoclassID& cid2)
 {
-    return memcmp(&cid1.mUuid, &cid2.mUuid, sizeof(Uuid));
+    return cid1.mUuid != cid2.mUuid;
 }
 
 struct InterfaceID
@@ -66,18 +66,18 @@ struct InterfaceID
     static const InterfaceID Null;
 };
 
-inline bool operator==(
+ALWAYS_INLINE inline bool operator==(
     /* [in] */ const InterfaceID& iid1,
     /* [in] */ const InterfaceID& iid2)
 {
-    return !memcmp(&iid1.mUuid, &iid2.mUuid, sizeof(Uuid));
+    return iid1.mUuid == iid2.mUuid;
 }
 
-inline bool operator!=(
+ALWAYS_INLINE inline bool operator!=(
     /* [in] */ const InterfaceID& iid1,
     /* [in] */ const InterfaceID& iid2)
 {
-    return memcmp(&iid1.mUuid, &iid2.mUuid, sizeof(Uuid));
+    return iid1.mUuid != iid2.mUuid;
 }
 
 struct ComponentID
@@ -86,18 +86,18 @@ struct ComponentID
     const char*         mUrl;
 };
 
-inline bool operator==(
+ALWAYS_INLINE inline bool operator==(
     /* [in] */ const ComponentID& cid1,
     /* [in] */ const ComponentID& cid2)
 {
-    return !memcmp(&cid1.mUuid, &cid2.mUuid, sizeof(Uuid));
+    return cid1.mUuid == cid2.mUuid;
 }
 
-inline bool operator!=(
+ALWAYS_INLINE inline bool operator!=(
     /* [in] */ const ComponentID& cid1,
     /* [in] */ const ComponentID& cid2)
 {
-    return memcmp(&cid1.mUuid, &cid2.mUuid, sizeof(Uuid));
+    return cid1.mUuid != cid2.mUuid;
 }
 
 }
@@ -571,5 +571,6 @@ struct HashFunc<Uuid>
 }
 
 #include "ccmarray.h"
+#include "ccmstringbuilder.h"
 
 #endif // __CCM_CCMTYPE_H__
@@ -15,18 +15,16 @@
 //=========================================================================
 
 #include "CBootClassLoader.h"
+#include "componentfile.h"
 #include "reflection/ccmreflectionapi.h"
 #include "reflection/CMetaComponent.h"
-#include "metadata/Component.h"
 #include "util/ccmlogger.h"
-#include "util/elf.h"
 #include <dlfcn.h>
 #include <errno.h>
-#include <stdio.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
-using ccm::metadata::MetaComponent;
-
 namespace ccm {
 
 const CoclassID CID_CBootClassLoader =
@@ -38,8 +36,71 @@ const String CBootClassLoader::TAG("CBootClassLoader");
 CCM_OBJECT_IMPL(CBootClassLoader);
 CCM_INTERFACE_IMPL_1(CBootClassLoader, Object, IClassLoader);
 
+class CBootClassLoader::PreloadJob
+    : public LightRefBase
+{
+public:
+    PreloadJob(
+        /* [in] */ Integer taskNumber)
+        : mDoneCond(mLock)
+        , mTaskNumber(taskNumber)
+    {}
+
+    void Done()
+    {
+        Mutex::AutoLock lock(mLock);
+        if (--mTaskNumber == 0) {
+            mDoneCond.SignalAll();
+        }
+    }
+
+    void Wait()
+    {
+        Mutex::AutoLock lock(mLock);
+        while (mTaskNumber > 0) {
+            mDoneCond.Wait();
+        }
+    }
+
+private:
+    Mutex mLock;
+    Condition mDoneCond;
+    Integer mTaskNumber;
+};
+
+class CBootClassLoader::PreloadTask
+    : public ThreadPoolExecutor::Runnable
+{
+public:
+    PreloadTask(
+        /* [in] */ CBootClassLoader* owner,
+        /* [in] */ const String& path,
+        /* [in] */ PreloadJob* job)
+        : mOwner(owner)
+        , mPath(path)
+        , mJob(job)
+    {}
+
+    ECode Run() override
+    {
+        AutoPtr<IMetaComponent> component;
+        ECode ec = mOwner->LoadComponent(mPath, &component);
+        if (FAILED(ec)) {
+            Logger::W(TAG, "Preload \"%s\" component failed.", mPath.string());
+        }
+        mJob->Done();
+        return ec;
+    }
+
+private:
+    AutoPtr<CBootClassLoader> mOwner;
+    String mPath;
+    AutoPtr<PreloadJob> mJob;
+};
+
 CBootClassLoader::CBootClassLoader()
     : mDebug(false)
+    , mEnvPreloaded(false)
 {
     InitComponentPath();
 }
@@ -85,23 +146,7 @@ ECode CBootClassLoader::LoadComponent(
         }
     }
 
-    ECode ec = CoGetComponentMetadataFromFile(
-            reinterpret_cast<HANDLE>(handle), this, component);
-    if (FAILED(ec)) {
-        dlclose(handle);
-        return ec;
-    }
-
-    ComponentID compId;
-    (*component)->GetComponentID(&compId);
-
-    {
-        Mutex::AutoLock lock(mComponentsLock);
-        mComponents.Put(compId.mUuid, *component);
-        mComponentPathMap.Put(path, *component);
-    }
-
-    return NOERROR;
+    return AddComponent(path, handle, component);
 }
 
 ECode CBootClassLoader::LoadComponent(
@@ -146,19 +191,40 @@ ECode CBootClassLoader::LoadComponent(
         }
     }
 
-    ec = CoGetComponentMetadataFromFile(
+    return AddComponent(compPath, handle, component);
+}
+
+ECode CBootClassLoader::AddComponent(
+    /* [in] */ const String& path,
+    /* [in] */ void* handle,
+    /* [out] */ IMetaComponent** component)
+{
+    ECode ec = CoGetComponentMetadataFromFile(
             reinterpret_cast<HANDLE>(handle), this, component);
     if (FAILED(ec)) {
         dlclose(handle);
         return ec;
     }
 
-    {
-        Mutex::AutoLock lock(mComponentsLock);
-        mComponents.Put(compId.mUuid, *component);
-        mComponentPathMap.Put(compPath, *component);
-    }
+    ComponentID compId;
+    (*component)->GetComponentID(&compId);
 
+    Mutex::AutoLock lock(mComponentsLock);
+    IMetaComponent* mc = mComponents.Get(compId.mUuid);
+    if (mc != nullptr) {
+        // Another thread, e.g. a preloading one, has loaded the same
+        // component meanwhile. Keep the one registered first.
+        (*component)->Release();
+        dlclose(handle);
+        *component = mc;
+        REFCOUNT_ADD(*component);
+        if (mComponentPathMap.Get(path) == nullptr) {
+            mComponentPathMap.Put(path, mc);
+        }
+        return NOERROR;
+    }
+    mComponents.Put(compId.mUuid, *component);
+    mComponentPathMap.Put(path, *component);
     return NOERROR;
 }
 
@@ -182,11 +248,14 @@ ECode CBootClassLoader::FindComponent(
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    FILE* fd = nullptr;
+    if (mComponentIndex.Find(mComponentPath, compId.mUuid, compFile, compPath)) {
+        return NOERROR;
+    }
+
+    ComponentFile file;
     for (Long i = 0; i < mComponentPath.GetSize(); i++) {
         String filePath = mComponentPath.Get(i) + "/" + compFile;
-        fd = fopen(filePath.string(), "rb");
-        if (fd != nullptr) {
+        if (file.Open(filePath) != E_COMPONENT_NOT_FOUND_EXCEPTION) {
             if (mDebug) {
                 Logger::D(TAG, "Find \"%\" component in directory \"%s\".",
                         compFile.string(), mComponentPath.Get(i).string());
@@ -195,121 +264,22 @@ ECode CBootClassLoader::FindComponent(
             break;
         }
     }
-    if (fd == nullptr) {
+    if (compPath->IsNull()) {
         Logger::E(TAG, "Cannot find \"%s\" component.", compFile.string());
-        *compPath = nullptr;
         return E_COMPONENT_NOT_FOUND_EXCEPTION;
     }
 
-    if (fseek(fd, 0, SEEK_SET) == -1) {
-        Logger::E(TAG, "Seek \"%s\" file failed.", compFile.string());
-        fclose(fd);
-        *compPath = nullptr;
-        return E_COMPONENT_IO_EXCEPTION;
-    }
-
-    Elf64_Ehdr ehdr;
-
-    if (fread((void *)&ehdr, sizeof(Elf64_Ehdr), 1, fd) < 1) {
-        Logger::E(TAG, "Read \"%s\" file failed.", compFile.string());
-        fclose(fd);
-        *compPath = nullptr;
-        return E_COMPONENT_IO_EXCEPTION;
-    }
-
-    if (fseek(fd, ehdr.e_shoff, SEEK_SET) == -1) {
-        Logger::E(TAG, "Seek \"%s\" file failed.", compFile.string());
-        fclose(fd);
-        *compPath = nullptr;
-        return E_COMPONENT_IO_EXCEPTION;
-    }
-
-    Elf64_Shdr* shdrs = (Elf64_Shdr *)malloc(sizeof(Elf64_Shdr) * ehdr.e_shnum);
-    if (shdrs == nullptr) {
-        Logger::E(TAG, "Malloc Elf64_Shdr failed.");
-        fclose(fd);
-        *compPath = nullptr;
-        return E_COMPONENT_IO_EXCEPTION;
-    }
-
-    if (fread((void*)shdrs, sizeof(Elf64_Shdr), ehdr.e_shnum, fd) < ehdr.e_shnum) {
-        Logger::E(TAG, "Read \"%s\" file failed.", compFile.string());
-        free(shdrs);
-        fclose(fd);
-        *compPath = nullptr;
-        return E_COMPONENT_IO_EXCEPTION;
-    }
-
-    Elf64_Shdr* strShdr = shdrs + ehdr.e_shstrndx;
-    char* strTable = (char *)malloc(strShdr->sh_size);
-    if (strTable == nullptr) {
-        Logger::E(TAG, "Malloc string table failed.");
-        free(shdrs);
-        fclose(fd);
-        *compPath = nullptr;
-        return E_OUT_OF_MEMORY_ERROR;
-    }
-
-    if (fseek(fd, strShdr->sh_offset, SEEK_SET) == -1) {
-        Logger::E(TAG, "Seek \"%s\" file failed.", compFile.string());
-        free(shdrs);
-        free(strTable);
-        fclose(fd);
-        *compPath = nullptr;
-        return E_COMPONENT_IO_EXCEPTION;
-    }
-
-    if (fread((void*)strTable, 1, strShdr->sh_size, fd) < strShdr->sh_size) {
-        Logger::E(TAG, "Read \"%s\" file failed.", compFile.string());
-        free(shdrs);
-        free(strTable);
-        fclose(fd);
-        *compPath = nullptr;
-        return E_COMPONENT_IO_EXCEPTION;
-    }
-
-    Elf64_Shdr* mdSec = nullptr;
-    for (int i = 0; i < ehdr.e_shnum; i++) {
-        const char* secName = strTable + shdrs[i].sh_name;
-        if (!strncmp(secName, ".metadata", 9)) {
-            mdSec = shdrs + i;
-            break;
-        }
-    }
-
-    if (mdSec == nullptr) {
+    Uuid uuid;
+    Long metadataOffset;
+    ECode ec = file.GetComponentId(&uuid, &metadataOffset);
+    if (FAILED(ec)) {
         Logger::E(TAG, "Find .metadata section of \"%s\" file failed.", compFile.string());
-        free(shdrs);
-        free(strTable);
-        fclose(fd);
-        *compPath = nullptr;
-        return E_COMPONENT_IO_EXCEPTION;
-    }
-
-    if (fseek(fd, mdSec->sh_offset + sizeof(int), SEEK_SET) < 0) {
-        Logger::E(TAG, "Seek \"%s\" file failed.", compFile.string());
-        free(shdrs);
-        free(strTable);
-        fclose(fd);
-        *compPath = nullptr;
-        return E_COMPONENT_IO_EXCEPTION;
-    }
-
-    free(shdrs);
-    free(strTable);
-
-    MetaComponent metadata;
-
-    if (fread((void*)&metadata, sizeof(MetaComponent), 1, fd) < 1) {
-        Logger::E(TAG, "Read \"%s\" file failed.", compFile.string());
-        fclose(fd);
         *compPath = nullptr;
-        return E_COMPONENT_IO_EXCEPTION;
+        return ec;
     }
 
-    fclose(fd);
-
-    if (memcmp(&metadata.mUuid, &compId.mUuid, sizeof(Uuid)) == 0) {
+    if (memcmp(&uuid, &compId.mUuid, sizeof(Uuid)) == 0) {
+        mComponentIndex.Put(uuid, *compPath, file.GetStat(), metadataOffset);
         return NOERROR;
     }
     else {
@@ -324,13 +294,23 @@ ECode CBootClassLoader::UnloadComponent(
     Mutex::AutoLock lock(mComponentsLock);
     CMetaComponent* mcObj = (CMetaComponent*)mComponents.Get(compId.mUuid);
     if (mcObj == nullptr) return E_COMPONENT_NOT_FOUND_EXCEPTION;
+    // Objects a component caches for itself would count as in use, so
+    // the caches are dropped before the check. A component takes the
+    // references it hands out under the lock of its cache, so dropping
+    // them is safe while the component is in use, and the caches fill
+    // again if it stays.
+    if (mcObj->mComponent->mSoReleaseCaches != nullptr) {
+        mcObj->mComponent->mSoReleaseCaches();
+    }
     Boolean canUnload;
     mcObj->CanUnload(&canUnload);
     if (canUnload) {
         int ret = dlclose(mcObj->mComponent->mSoHandle);
         if (ret == 0) {
+            // The paths map is keyed by the files the component was
+            // loaded from, which its url does not name.
             mComponents.Remove(compId.mUuid);
-            mComponentPathMap.Remove(mcObj->mUrl);
+            mComponentPathMap.RemoveValue(mcObj);
             return NOERROR;
         }
     }
@@ -384,6 +364,147 @@ ECode CBootClassLoader::GetParent(
     return NOERROR;
 }
 
+ECode CBootClassLoader::PreloadComponents(
+    /* [in] */ const String& components,
+    /* [in] */ Boolean wait)
+{
+    ArrayList<String> candidates;
+    Integer begin = 0;
+    while (begin < components.GetLength()) {
+        Integer end = components.IndexOf(':', begin);
+        if (end == -1) {
+            end = components.GetLength();
+        }
+        String name = components.Substring(begin, end);
+        begin = end + 1;
+        if (name.IsEmpty()) {
+            continue;
+        }
+        String path;
+        if (FAILED(ResolveComponent(name, &path))) {
+            Logger::W(TAG, "Cannot find \"%s\" component to preload.", name.string());
+            continue;
+        }
+        candidates.Add(path);
+    }
+    Long listedNumber = candidates.GetSize();
+
+    // Loading a component loads the libraries it is linked with, so the
+    // components among them are preloaded too. The ones mapped already,
+    // like ccmrt.so, are left alone.
+    ArrayList<String> paths;
+    for (Long i = 0; i < candidates.GetSize(); i++) {
+        String path = candidates.Get(i);
+        ComponentFile file;
+        Uuid uuid;
+        Long metadataOffset;
+        if (FAILED(file.Open(path)) || FAILED(file.GetComponentId(&uuid, &metadataOffset))) {
+            if (i < listedNumber) {
+                Logger::W(TAG, "\"%s\" is not a component.", path.string());
+            }
+            continue;
+        }
+        {
+            Mutex::AutoLock lock(mComponentsLock);
+            if (mComponents.Get(uuid) != nullptr) {
+                continue;
+            }
+        }
+        paths.Add(path);
+
+        ArrayList<String> libraries;
+        file.GetNeededLibraries(libraries);
+        for (Long j = 0; j < libraries.GetSize(); j++) {
+            String libPath;
+            if (FAILED(ResolveComponent(libraries.Get(j), &libPath))) {
+                continue;
+            }
+            Boolean found = false;
+            for (Long k = 0; k < candidates.GetSize() && !found; k++) {
+                found = candidates.Get(k).Equals(libPath);
+            }
+            if (found) {
+                continue;
+            }
+            void* handle = dlopen(libPath.string(), RTLD_NOW | RTLD_NOLOAD);
+            if (handle != nullptr) {
+                dlclose(handle);
+                continue;
+            }
+            candidates.Add(libPath);
+        }
+    }
+
+    if (paths.GetSize() == 0) {
+        return NOERROR;
+    }
+
+    // The loading has a pool of its own, so it never holds up the
+    // workers which serve the remote calls.
+    AutoPtr<ThreadPoolExecutor> executor;
+    {
+        Mutex::AutoLock lock(mComponentsLock);
+        if (mPreloadExecutor == nullptr) {
+            mPreloadExecutor = new ThreadPoolExecutor(PRELOAD_THREAD_NUMBER);
+        }
+        executor = mPreloadExecutor;
+    }
+
+    AutoPtr<PreloadJob> job = new PreloadJob((Integer)paths.GetSize());
+    ECode ec = NOERROR;
+    for (Long i = 0; i < paths.GetSize(); i++) {
+        AutoPtr<PreloadTask> task = new PreloadTask(this, paths.Get(i), job);
+        // RunTask queues nothing when it fails, so the task runs here
+        // once and only once.
+        if (FAILED(executor->RunTask(task))) {
+            ECode taskEc = task->Run();
+            if (FAILED(taskEc)) {
+                ec = taskEc;
+            }
+        }
+    }
+
+    if (wait) {
+        job->Wait();
+    }
+    return ec;
+}
+
+ECode CBootClassLoader::PreloadEnvComponents(
+    /* [in] */ Boolean wait)
+{
+    if (mEnvPreloaded.load(std::memory_order_acquire) ||
+            mEnvPreloaded.exchange(true)) {
+        return NOERROR;
+    }
+
+    String components(getenv("CCM_PRELOAD"));
+    if (components.IsNullOrEmpty()) {
+        return NOERROR;
+    }
+    return PreloadComponents(components, wait);
+}
+
+ECode CBootClassLoader::ResolveComponent(
+    /* [in] */ const String& name,
+    /* [out] */ String* compPath)
+{
+    if (name.Contains("/")) {
+        *compPath = name;
+        return access(name.string(), R_OK) == 0 ?
+                NOERROR : E_COMPONENT_NOT_FOUND_EXCEPTION;
+    }
+
+    for (Long i = 0; i < mComponentPath.GetSize(); i++) {
+        String filePath = mComponentPath.Get(i) + "/" + name;
+        if (access(filePath.string(), R_OK) == 0) {
+            *compPath = filePath;
+            return NOERROR;
+        }
+    }
+    return E_COMPONENT_NOT_FOUND_EXCEPTION;
+}
+
 void CBootClassLoader::InitComponentPath()
 {
     String cpath(getenv("COMPONENT_PATH"));
@@ -20,8 +20,11 @@
 #include "arraylist.h"
 #include "ccmautoptr.h"
 #include "ccmobject.h"
+#include "componentindex.h"
+#include "rpc/threadpoolexecutor.h"
 #include "util/hashmap.h"
 #include "util/mutex.h"
+#include <atomic>
 
 namespace ccm {
 
@@ -61,7 +64,24 @@ public:
     ECode GetParent(
         /* [out] */ IClassLoader** parent) override;
 
+    // Loads the components listed in |components|, separated by ':',
+    // and the components they are linked with, on a thread pool kept
+    // for preloading. A component is given by its file name in the
+    // component path or by a path. When |wait| is false this returns
+    // as soon as the loading is started.
+    ECode PreloadComponents(
+        /* [in] */ const String& components,
+        /* [in] */ Boolean wait);
+
+    // Preloads the components in $CCM_PRELOAD, the first time only.
+    // Loading a component does not call this; CoPreloadComponents does.
+    ECode PreloadEnvComponents(
+        /* [in] */ Boolean wait);
+
 private:
+    class PreloadJob;
+    class PreloadTask;
+
     CBootClassLoader();
 
     void InitComponentPath();
@@ -70,14 +90,27 @@ private:
         /* [in] */ const ComponentID& compId,
         /* [out] */ String* compPath);
 
+    ECode ResolveComponent(
+        /* [in] */ const String& name,
+        /* [out] */ String* compPath);
+
+    ECode AddComponent(
+        /* [in] */ const String& path,
+        /* [in] */ void* handle,
+        /* [out] */ IMetaComponent** component);
+
 private:
     static AutoPtr<IClassLoader> sInstance;
     static const String TAG;
+    static constexpr Integer PRELOAD_THREAD_NUMBER = 4;
     Boolean mDebug;
     ArrayList<String> mComponentPath;
+    ComponentIndex mComponentIndex;
     HashMap<Uuid, IMetaComponent*> mComponents;
     HashMap<String, IMetaComponent*> mComponentPathMap;
     Mutex mComponentsLock;
+    std::atomic<bool> mEnvPreloaded;
+    AutoPtr<ThreadPoolExecutor> mPreloadExecutor;
 };
 
 }
@@ -32,11 +32,12 @@ struct ClassObjectGetter
 typedef ECode (*GetClassObjectPtr)(const CoclassID&, IClassObject**);
 typedef ClassObjectGetter* (*GetAllClassObjectsPtr)(int* size);
 typedef Boolean (*CanUnloadPtr)();
+typedef void (*ReleaseCachesPtr)();
 
 struct MetadataWrapper
 {
     int             mSize;
-    unsigned char   mMetadata[0];
+    unsigned char   mMetadata[0] __attribute__ ((aligned (8)));
 };
 
 struct CcmComponent
@@ -45,6 +46,8 @@ struct CcmComponent
     GetClassObjectPtr       mSoGetClassObject;
     GetAllClassObjectsPtr   mSoGetAllClassObjects;
     CanUnloadPtr            mSoCanUnload;
+    // Optional, drops what the component caches before it is unloaded.
+    ReleaseCachesPtr        mSoReleaseCaches;
     MetadataWrapper*        mMetadataWrapper;
 };
 
@@ -75,4 +75,15 @@ AutoPtr<IClassLoader> CoGetBootClassLoader()
     return CBootClassLoader::GetInstance();
 }
 
+ECode CoPreloadComponents(
+    /* [in] */ const char* components,
+    /* [in] */ Boolean wait)
+{
+    CBootClassLoader* loader = (CBootClassLoader*)CBootClassLoader::GetInstance().Get();
+    if (components == nullptr) {
+        return loader->PreloadEnvComponents(wait);
+    }
+    return loader->PreloadComponents(String(components), wait);
+}
+
 }
@@ -35,6 +35,14 @@ EXTERN_C COM_PUBLIC ECode CoAcquireClassFactory(
 
 EXTERN_C COM_PUBLIC AutoPtr<IClassLoader> CoGetBootClassLoader();
 
+// Loads |components|, a ':' separated list of component file names or
+// paths, and the components they are linked with, in parallel. A null
+// list means the one in $CCM_PRELOAD, which is preloaded the first time
+// only. Loading a component never starts this by itself.
+EXTERN_C COM_PUBLIC ECode CoPreloadComponents(
+    /* [in] */ const char* components,
+    /* [in] */ Boolean wait);
+
 } // namespace ccm
 
 #endif // __CCM_CCMOBJECTAPI_H__
@@ -0,0 +1,164 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "componentfile.h"
+#include "metadata/Component.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using ccm::metadata::MetaComponent;
+
+namespace ccm {
+
+ComponentFile::ComponentFile()
+    : mData(nullptr)
+    , mSize(0)
+{
+    memset(&mStat, 0, sizeof(struct stat));
+}
+
+ComponentFile::~ComponentFile()
+{
+    if (mData != nullptr) {
+        munmap(const_cast<Byte*>(mData), mSize);
+        mData = nullptr;
+    }
+}
+
+ECode ComponentFile::Open(
+    /* [in] */ const String& path)
+{
+    int fd = open(path.string(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return E_COMPONENT_NOT_FOUND_EXCEPTION;
+    }
+
+    if (fstat(fd, &mStat) == -1 || mStat.st_size < (off_t)sizeof(Elf64_Ehdr)) {
+        close(fd);
+        return E_COMPONENT_IO_EXCEPTION;
+    }
+
+    mSize = mStat.st_size;
+    void* base = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        mSize = 0;
+        return E_COMPONENT_IO_EXCEPTION;
+    }
+    mData = reinterpret_cast<const Byte*>(base);
+    return NOERROR;
+}
+
+ECode ComponentFile::GetComponentId(
+    /* [out] */ Uuid* uuid,
+    /* [out] */ Long* metadataOffset)
+{
+    Integer number;
+    const Elf64_Shdr* shdrs = GetSectionHeaders(&number);
+    if (shdrs == nullptr) {
+        return E_COMPONENT_IO_EXCEPTION;
+    }
+
+    const Elf64_Shdr* strShdr = shdrs + reinterpret_cast<const Elf64_Ehdr*>(mData)->e_shstrndx;
+    if (!IsInFile(strShdr->sh_offset, strShdr->sh_size)) {
+        return E_COMPONENT_IO_EXCEPTION;
+    }
+
+    static const char METADATA_SECTION[] = ".metadata";
+    const char* strTable = reinterpret_cast<const char*>(mData + strShdr->sh_offset);
+    for (Integer i = 0; i < number; i++) {
+        if (strShdr->sh_size < sizeof(METADATA_SECTION) ||
+                shdrs[i].sh_name > strShdr->sh_size - sizeof(METADATA_SECTION) ||
+                memcmp(strTable + shdrs[i].sh_name, METADATA_SECTION,
+                        sizeof(METADATA_SECTION)) != 0) {
+            continue;
+        }
+        uint64_t offset = shdrs[i].sh_offset + CCM_METADATA_OFFSET;
+        if (!IsInFile(offset, sizeof(MetaComponent))) {
+            break;
+        }
+        const MetaComponent* mc = reinterpret_cast<const MetaComponent*>(mData + offset);
+        if (mc->mMagic != CCM_MAGIC || mc->mVersion != CCM_METADATA_VERSION) {
+            break;
+        }
+        *uuid = mc->mUuid;
+        *metadataOffset = offset;
+        return NOERROR;
+    }
+    return E_COMPONENT_IO_EXCEPTION;
+}
+
+void ComponentFile::GetNeededLibraries(
+    /* [out] */ ArrayList<String>& libraries)
+{
+    Integer number;
+    const Elf64_Shdr* shdrs = GetSectionHeaders(&number);
+    if (shdrs == nullptr) {
+        return;
+    }
+
+    for (Integer i = 0; i < number; i++) {
+        if (shdrs[i].sh_type != SHT_DYNAMIC || shdrs[i].sh_link >= (Elf64_Word)number) {
+            continue;
+        }
+        // The names are in the string table the dynamic section links to.
+        const Elf64_Shdr* strShdr = shdrs + shdrs[i].sh_link;
+        if (!IsInFile(shdrs[i].sh_offset, shdrs[i].sh_size) ||
+                !IsInFile(strShdr->sh_offset, strShdr->sh_size)) {
+            return;
+        }
+        const char* strTable = reinterpret_cast<const char*>(mData + strShdr->sh_offset);
+        const Elf64_Dyn* dyns = reinterpret_cast<const Elf64_Dyn*>(mData + shdrs[i].sh_offset);
+        uint64_t dynNumber = shdrs[i].sh_size / sizeof(Elf64_Dyn);
+        for (uint64_t j = 0; j < dynNumber && dyns[j].d_tag != DT_NULL; j++) {
+            if (dyns[j].d_tag != DT_NEEDED || dyns[j].d_un.d_val >= strShdr->sh_size) {
+                continue;
+            }
+            const char* name = strTable + dyns[j].d_un.d_val;
+            if (memchr(name, '\0', strShdr->sh_size - dyns[j].d_un.d_val) != nullptr) {
+                libraries.Add(String(name));
+            }
+        }
+        return;
+    }
+}
+
+const Elf64_Shdr* ComponentFile::GetSectionHeaders(
+    /* [out] */ Integer* number)
+{
+    if (mData == nullptr) {
+        return nullptr;
+    }
+
+    const Elf64_Ehdr* ehdr = reinterpret_cast<const Elf64_Ehdr*>(mData);
+    if (!ehdr->CheckMagic() || ehdr->e_shstrndx >= ehdr->e_shnum ||
+            !IsInFile(ehdr->e_shoff, (uint64_t)ehdr->e_shnum * sizeof(Elf64_Shdr))) {
+        return nullptr;
+    }
+    *number = ehdr->e_shnum;
+    return reinterpret_cast<const Elf64_Shdr*>(mData + ehdr->e_shoff);
+}
+
+Boolean ComponentFile::IsInFile(
+    /* [in] */ uint64_t offset,
+    /* [in] */ uint64_t size)
+{
+    return offset <= mSize && size <= mSize - offset;
+}
+
+}
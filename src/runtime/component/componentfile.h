@@ -0,0 +1,74 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#ifndef __CCM_COMPONENTFILE_H__
+#define __CCM_COMPONENTFILE_H__
+
+#include "ccmtypes.h"
+#include "util/arraylist.h"
+#include "util/elf.h"
+#include <sys/stat.h>
+
+namespace ccm {
+
+// A read-only mapping of a component file, to look into its sections
+// without having the dynamic linker load it.
+class ComponentFile
+{
+public:
+    ComponentFile();
+
+    ~ComponentFile();
+
+    ECode Open(
+        /* [in] */ const String& path);
+
+    inline const struct stat& GetStat();
+
+    // Returns the id of the component and where its metadata starts
+    // in the file.
+    ECode GetComponentId(
+        /* [out] */ Uuid* uuid,
+        /* [out] */ Long* metadataOffset);
+
+    // Adds the file names of the libraries the dynamic linker loads
+    // together with this one.
+    void GetNeededLibraries(
+        /* [out] */ ArrayList<String>& libraries);
+
+private:
+    const Elf64_Shdr* GetSectionHeaders(
+        /* [out] */ Integer* number);
+
+    Boolean IsInFile(
+        /* [in] */ uint64_t offset,
+        /* [in] */ uint64_t size);
+
+private:
+    const Byte* mData;
+    size_t mSize;
+    struct stat mStat;
+};
+
+const struct stat& ComponentFile::GetStat()
+{
+    return mStat;
+}
+
+}
+
+#endif // __CCM_COMPONENTFILE_H__
@@ -0,0 +1,337 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "componentindex.h"
+#include "metadata/Component.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+using ccm::metadata::MetaComponent;
+
+namespace ccm {
+
+static Boolean ReadData(
+    /* [in] */ const Byte** pos,
+    /* [in] */ const Byte* end,
+    /* [out] */ void* value,
+    /* [in] */ size_t size)
+{
+    if ((size_t)(end - *pos) < size) {
+        return false;
+    }
+    memcpy(value, *pos, size);
+    *pos += size;
+    return true;
+}
+
+static Boolean ReadString(
+    /* [in] */ const Byte** pos,
+    /* [in] */ const Byte* end,
+    /* [out] */ String* string)
+{
+    Integer length;
+    if (!ReadData(pos, end, &length, sizeof(Integer)) ||
+            length < 0 || end - *pos < length) {
+        return false;
+    }
+    *string = String(reinterpret_cast<const char*>(*pos), length);
+    *pos += length;
+    return true;
+}
+
+static void WriteData(
+    /* [in] */ Byte** pos,
+    /* [in] */ const void* value,
+    /* [in] */ size_t size)
+{
+    memcpy(*pos, value, size);
+    *pos += size;
+}
+
+static void WriteString(
+    /* [in] */ Byte** pos,
+    /* [in] */ const String& string)
+{
+    Integer length = string.GetByteLength();
+    WriteData(pos, &length, sizeof(Integer));
+    WriteData(pos, string.string(), length);
+}
+
+ComponentIndex::ComponentIndex()
+    : mLoaded(false)
+    , mDirectories(nullptr)
+    , mDirectoryNumber(0)
+    , mEntries(nullptr)
+    , mEntryNumber(0)
+    , mEntryCapacity(0)
+{}
+
+ComponentIndex::~ComponentIndex()
+{
+    delete[] mDirectories;
+    delete[] mEntries;
+}
+
+Boolean ComponentIndex::Find(
+    /* [in] */ ArrayList<String>& componentPath,
+    /* [in] */ const Uuid& uuid,
+    /* [in] */ const String& compFile,
+    /* [out] */ String* compPath)
+{
+    Mutex::AutoLock lock(mLock);
+
+    if (!mLoaded) {
+        Load(componentPath);
+        mLoaded = true;
+    }
+
+    Entry* entry = Get(uuid);
+    if (entry == nullptr || !entry->mPath.EndsWith(String("/") + compFile)) {
+        return false;
+    }
+
+    struct stat st;
+    if (stat(entry->mPath.string(), &st) == -1 ||
+            GetMtime(st) != entry->mMtime || st.st_size != entry->mSize) {
+        return false;
+    }
+
+    // Only the head of the metadata, up to the id, is read.
+    int fd = open(entry->mPath.string(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return false;
+    }
+    MetaComponent header;
+    ssize_t size = offsetof(MetaComponent, mUuid) + sizeof(Uuid);
+    ssize_t n = pread(fd, &header, size, entry->mMetadataOffset);
+    close(fd);
+    if (n != size || header.mMagic != CCM_MAGIC ||
+            header.mVersion != CCM_METADATA_VERSION ||
+            memcmp(&header.mUuid, &uuid, sizeof(Uuid)) != 0) {
+        return false;
+    }
+
+    *compPath = entry->mPath;
+    return true;
+}
+
+void ComponentIndex::Put(
+    /* [in] */ const Uuid& uuid,
+    /* [in] */ const String& compPath,
+    /* [in] */ const struct stat& st,
+    /* [in] */ Long metadataOffset)
+{
+    Mutex::AutoLock lock(mLock);
+
+    if (!mLoaded) {
+        return;
+    }
+
+    Entry* entry = Get(uuid);
+    if (entry == nullptr) {
+        entry = Add();
+        entry->mUuid = uuid;
+    }
+    entry->mPath = compPath;
+    entry->mMtime = GetMtime(st);
+    entry->mSize = st.st_size;
+    entry->mMetadataOffset = metadataOffset;
+
+    Save();
+}
+
+void ComponentIndex::Load(
+    /* [in] */ ArrayList<String>& componentPath)
+{
+    mDirectoryNumber = componentPath.GetSize();
+    mDirectories = new Directory[mDirectoryNumber];
+    for (Integer i = 0; i < mDirectoryNumber; i++) {
+        struct stat st;
+        mDirectories[i].mPath = componentPath.Get(i);
+        mDirectories[i].mMtime = stat(mDirectories[i].mPath.string(), &st) == 0 ?
+                GetMtime(st) : -1;
+    }
+
+    mIndexFile = GetIndexFile();
+    if (mIndexFile.IsNullOrEmpty()) {
+        return;
+    }
+
+    int fd = open(mIndexFile.string(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0 && st.st_size <= MAX_FILE_SIZE) {
+        Byte* data = (Byte*)malloc(st.st_size);
+        if (data != nullptr) {
+            if (read(fd, data, st.st_size) != st.st_size || !Parse(data, st.st_size)) {
+                mEntryNumber = 0;
+            }
+            free(data);
+        }
+    }
+    close(fd);
+}
+
+Boolean ComponentIndex::Parse(
+    /* [in] */ const Byte* data,
+    /* [in] */ Long size)
+{
+    const Byte* pos = data;
+    const Byte* end = data + size;
+
+    Integer magic, version, directoryNumber, entryNumber;
+    if (!ReadData(&pos, end, &magic, sizeof(Integer)) ||
+            !ReadData(&pos, end, &version, sizeof(Integer)) ||
+            !ReadData(&pos, end, &directoryNumber, sizeof(Integer)) ||
+            !ReadData(&pos, end, &entryNumber, sizeof(Integer))) {
+        return false;
+    }
+    if (magic != MAGIC || version != VERSION ||
+            directoryNumber != mDirectoryNumber || entryNumber < 0) {
+        return false;
+    }
+
+    for (Integer i = 0; i < directoryNumber; i++) {
+        String path;
+        Long mtime;
+        if (!ReadString(&pos, end, &path) ||
+                !ReadData(&pos, end, &mtime, sizeof(Long))) {
+            return false;
+        }
+        if (mtime == -1 || mtime != mDirectories[i].mMtime ||
+                !path.Equals(mDirectories[i].mPath)) {
+            return false;
+        }
+    }
+
+    for (Integer i = 0; i < entryNumber; i++) {
+        Entry* entry = Add();
+        if (!ReadData(&pos, end, &entry->mUuid, sizeof(Uuid)) ||
+                !ReadData(&pos, end, &entry->mMtime, sizeof(Long)) ||
+                !ReadData(&pos, end, &entry->mSize, sizeof(Long)) ||
+                !ReadData(&pos, end, &entry->mMetadataOffset, sizeof(Long)) ||
+                !ReadString(&pos, end, &entry->mPath)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ComponentIndex::Save()
+{
+    if (mIndexFile.IsNullOrEmpty()) {
+        return;
+    }
+
+    size_t size = sizeof(Integer) * 4;
+    for (Integer i = 0; i < mDirectoryNumber; i++) {
+        size += sizeof(Integer) + mDirectories[i].mPath.GetByteLength() + sizeof(Long);
+    }
+    for (Integer i = 0; i < mEntryNumber; i++) {
+        size += sizeof(Uuid) + sizeof(Long) * 3 +
+                sizeof(Integer) + mEntries[i].mPath.GetByteLength();
+    }
+    if (size > MAX_FILE_SIZE) {
+        return;
+    }
+
+    Byte* data = (Byte*)malloc(size);
+    if (data == nullptr) {
+        return;
+    }
+    Byte* pos = data;
+    Integer header[] = { MAGIC, VERSION, mDirectoryNumber, mEntryNumber };
+    WriteData(&pos, header, sizeof(header));
+    for (Integer i = 0; i < mDirectoryNumber; i++) {
+        WriteString(&pos, mDirectories[i].mPath);
+        WriteData(&pos, &mDirectories[i].mMtime, sizeof(Long));
+    }
+    for (Integer i = 0; i < mEntryNumber; i++) {
+        Entry& entry = mEntries[i];
+        WriteData(&pos, &entry.mUuid, sizeof(Uuid));
+        WriteData(&pos, &entry.mMtime, sizeof(Long));
+        WriteData(&pos, &entry.mSize, sizeof(Long));
+        WriteData(&pos, &entry.mMetadataOffset, sizeof(Long));
+        WriteString(&pos, entry.mPath);
+    }
+
+    // Other processes may read the file at any time, so it is replaced
+    // as a whole.
+    String tmpFile = String::Format("%s.%d", mIndexFile.string(), getpid());
+    int fd = open(tmpFile.string(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd == -1 && errno == ENOENT) {
+        Integer index = mIndexFile.IndexOf("/", 1);
+        while (index != -1) {
+            mkdir(mIndexFile.Substring(0, index).string(), 0755);
+            index = mIndexFile.IndexOf("/", index + 1);
+        }
+        fd = open(tmpFile.string(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    }
+    if (fd != -1) {
+        Boolean written = write(fd, data, size) == (ssize_t)size;
+        close(fd);
+        if (!written || rename(tmpFile.string(), mIndexFile.string()) == -1) {
+            unlink(tmpFile.string());
+        }
+    }
+    free(data);
+}
+
+ComponentIndex::Entry* ComponentIndex::Get(
+    /* [in] */ const Uuid& uuid)
+{
+    for (Integer i = 0; i < mEntryNumber; i++) {
+        if (memcmp(&mEntries[i].mUuid, &uuid, sizeof(Uuid)) == 0) {
+            return &mEntries[i];
+        }
+    }
+    return nullptr;
+}
+
+ComponentIndex::Entry* ComponentIndex::Add()
+{
+    if (mEntryNumber == mEntryCapacity) {
+        Integer capacity = mEntryCapacity == 0 ? 16 : mEntryCapacity * 2;
+        Entry* entries = new Entry[capacity];
+        for (Integer i = 0; i < mEntryNumber; i++) {
+            entries[i] = mEntries[i];
+        }
+        delete[] mEntries;
+        mEntries = entries;
+        mEntryCapacity = capacity;
+    }
+    return &mEntries[mEntryNumber++];
+}
+
+Long ComponentIndex::GetMtime(
+    /* [in] */ const struct stat& st)
+{
+    return (Long)st.st_mtim.tv_sec * 1000000000ll + st.st_mtim.tv_nsec;
+}
+
+String ComponentIndex::GetIndexFile()
+{
+    return String(getenv("CCM_COMPONENT_INDEX"));
+}
+
+}
@@ -0,0 +1,111 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#ifndef __CCM_COMPONENTINDEX_H__
+#define __CCM_COMPONENTINDEX_H__
+
+#include "ccmtypes.h"
+#include "util/arraylist.h"
+#include "util/mutex.h"
+#include <sys/stat.h>
+
+namespace ccm {
+
+// Remembers where components were found, in memory and in a cache file
+// which later processes load. Finding an indexed component then takes a
+// stat() and a pread() of its id, instead of probing every component
+// directory and walking the ELF headers of the component.
+//
+// The cache file is $CCM_COMPONENT_INDEX. Without it the index is kept
+// in memory only, so nothing is written unless asked for. A component copied into an earlier directory of the
+// component path would shadow an indexed one, so the whole file is
+// dropped when the component path or the modification time of one of
+// its directories differs from when the file was written.
+class ComponentIndex
+{
+public:
+    ComponentIndex();
+
+    ~ComponentIndex();
+
+    // Returns whether the component |uuid| named |compFile| is indexed
+    // and unchanged since, and where it is if so.
+    Boolean Find(
+        /* [in] */ ArrayList<String>& componentPath,
+        /* [in] */ const Uuid& uuid,
+        /* [in] */ const String& compFile,
+        /* [out] */ String* compPath);
+
+    void Put(
+        /* [in] */ const Uuid& uuid,
+        /* [in] */ const String& compPath,
+        /* [in] */ const struct stat& st,
+        /* [in] */ Long metadataOffset);
+
+private:
+    struct Directory
+    {
+        String mPath;
+        Long mMtime;
+    };
+
+    struct Entry
+    {
+        Uuid mUuid;
+        String mPath;
+        Long mMtime;
+        Long mSize;
+        Long mMetadataOffset;
+    };
+
+    void Load(
+        /* [in] */ ArrayList<String>& componentPath);
+
+    Boolean Parse(
+        /* [in] */ const Byte* data,
+        /* [in] */ Long size);
+
+    void Save();
+
+    Entry* Get(
+        /* [in] */ const Uuid& uuid);
+
+    Entry* Add();
+
+    static Long GetMtime(
+        /* [in] */ const struct stat& st);
+
+    static String GetIndexFile();
+
+private:
+    static constexpr Integer MAGIC = 0x49434343; // "CCCI"
+    static constexpr Integer VERSION = 1;
+    static constexpr Integer MAX_FILE_SIZE = 1024 * 1024;
+
+    Mutex mLock;
+    Boolean mLoaded;
+    String mIndexFile;
+    Directory* mDirectories;
+    Integer mDirectoryNumber;
+    Entry* mEntries;
+    Integer mEntryNumber;
+    Integer mEntryCapacity;
+};
+
+}
+
+#endif // __CCM_COMPONENTINDEX_H__
@@ -19,11 +19,61 @@
 
 #include "../type/ccmtypekind.h"
 #include "../type/ccmuuid.h"
+#include <stdint.h>
 
 namespace ccm {
 namespace metadata {
 
 #define CCM_MAGIC   0x12E20FD
+// Since version 2 every pointer in the metadata is a MetaPointer, so the
+// metadata is used where it is mapped without being copied or fixed up.
+#define CCM_METADATA_VERSION    2
+// The .metadata section of a component starts with the size of the
+// metadata. The metadata follows at this offset, aligned for reading it
+// in place.
+#define CCM_METADATA_OFFSET     8
+
+// A pointer stored as the distance from itself to its target, which
+// stays valid wherever the block holding both of them is mapped. Zero
+// means null, a pointer never points to itself.
+template<typename T>
+class MetaPointer
+{
+public:
+    MetaPointer() = default;
+
+    MetaPointer(
+        /* [in] */ const MetaPointer& other) = delete;
+
+    inline MetaPointer& operator=(
+        /* [in] */ T* target)
+    {
+        mOffset = target == nullptr ? 0 :
+                reinterpret_cast<intptr_t>(target) - reinterpret_cast<intptr_t>(this);
+        return *this;
+    }
+
+    inline MetaPointer& operator=(
+        /* [in] */ const MetaPointer& other)
+    {
+        return *this = other.Get();
+    }
+
+    inline T* Get() const
+    {
+        return mOffset == 0 ? nullptr : reinterpret_cast<T*>(
+                reinterpret_cast<intptr_t>(this) + mOffset);
+    }
+
+    inline operator T*() const
+    { return Get(); }
+
+    inline T* operator->() const
+    { return Get(); }
+
+private:
+    intptr_t mOffset;
+};
 
 struct MetaCoclass;
 struct MetaConstant;
@@ -40,9 +90,10 @@ struct MetaComponent
 {
     int                 mMagic;
     int                 mSize;
+    int                 mVersion;
     Uuid                mUuid;
-    char*               mName;
-    char*               mUrl;
+    MetaPointer<char>   mName;
+    MetaPointer<char>   mUrl;
     int                 mNamespaceNumber;
     int                 mConstantNumber;
     int                 mCoclassNumber;
@@ -51,18 +102,18 @@ struct MetaComponent
     int                 mInterfaceNumber;
     int                 mExternalInterfaceNumber;
     int                 mTypeNumber;
-    MetaNamespace**     mNamespaces;
-    MetaConstant**      mConstants;
-    MetaCoclass**       mCoclasses;
-    MetaEnumeration**   mEnumerations;
-    MetaInterface**     mInterfaces;
-    MetaType**          mTypes;
-    char*               mStringPool;
+    MetaPointer<MetaPointer<MetaNamespace>> mNamespaces;
+    MetaPointer<MetaPointer<MetaConstant>> mConstants;
+    MetaPointer<MetaPointer<MetaCoclass>> mCoclasses;
+    MetaPointer<MetaPointer<MetaEnumeration>> mEnumerations;
+    MetaPointer<MetaPointer<MetaInterface>> mInterfaces;
+    MetaPointer<MetaPointer<MetaType>> mTypes;
+    MetaPointer<char>   mStringPool;
 };
 
 struct MetaNamespace
 {
-    char*               mName;
+    MetaPointer<char>   mName;
     int                 mInterfaceWrappedIndex;
     int                 mConstantNumber;
     int                 mCoclassNumber;
@@ -70,51 +121,52 @@ struct MetaNamespace
     int                 mExternalEnumerationNumber;
     int                 mInterfaceNumber;
     int                 mExternalInterfaceNumber;
-    int*                mConstantIndexes;
-    int*                mCoclassIndexes;
-    int*                mEnumerationIndexes;
-    int*                mInterfaceIndexes;
+    MetaPointer<int>    mConstantIndexes;
+    MetaPointer<int>    mCoclassIndexes;
+    MetaPointer<int>    mEnumerationIndexes;
+    MetaPointer<int>    mInterfaceIndexes;
 };
 
 struct MetaCoclass
 {
     Uuid                mUuid;
-    char*               mName;
-    char*               mNamespace;
+    MetaPointer<char>   mName;
+    MetaPointer<char>   mNamespace;
     int                 mInterfaceNumber;
-    int*                mInterfaceIndexes;
+    MetaPointer<int>    mInterfaceIndexes;
     bool                mConstructorDefault;
     bool                mConstructorDeleted;
+    bool                mThreadConfined;
 };
 
 struct MetaEnumeration
 {
-    char*               mName;
-    char*               mNamespace;
+    MetaPointer<char>   mName;
+    MetaPointer<char>   mNamespace;
     int                 mEnumeratorNumber;
-    MetaEnumerator**    mEnumerators;
+    MetaPointer<MetaPointer<MetaEnumerator>> mEnumerators;
     bool                mExternal;
 };
 
 struct MetaEnumerator
 {
-    char*               mName;
+    MetaPointer<char>   mName;
     int                 mValue;
 };
 
 struct MetaInterface
 {
     Uuid                mUuid;
-    char*               mName;
-    char*               mNamespace;
+    MetaPointer<char>   mName;
+    MetaPointer<char>   mNamespace;
     int                 mBaseInterfaceIndex;
     int                 mOuterInterfaceIndex;
     int                 mNestedInterfaceNumber;
     int                 mConstantNumber;
     int                 mMethodNumber;
-    int*                mNestedInterfaceIndexes;
-    MetaConstant**      mConstants;
-    MetaMethod**        mMethods;
+    MetaPointer<int>    mNestedInterfaceIndexes;
+    MetaPointer<MetaPointer<MetaConstant>> mConstants;
+    MetaPointer<MetaPointer<MetaMethod>> mMethods;
     bool                mExternal;
 };
 
@@ -133,32 +185,33 @@ struct MetaValue
         long long int   mLong;
         float           mFloat;
         double          mDouble;
-        char*           mString;
+        MetaPointer<char> mString;
     };
     unsigned char       mAttributes;
 };
 
 struct MetaConstant
 {
-    char*               mName;
+    MetaPointer<char>   mName;
     int                 mTypeIndex;
     MetaValue           mValue;
 };
 
 struct MetaMethod
 {
-    char*               mName;
-    char*               mSignature;
+    MetaPointer<char>   mName;
+    MetaPointer<char>   mSignature;
     int                 mReturnTypeIndex;
     int                 mParameterNumber;
-    MetaParameter**     mParameters;
+    MetaPointer<MetaPointer<MetaParameter>> mParameters;
     bool                mDeleted;
     bool                mReference;
+    bool                mOneway;
 };
 
 struct MetaParameter
 {
-    char*               mName;
+    MetaPointer<char>   mName;
     int                 mAttribute;
     int                 mTypeIndex;
     bool                mHasDefaultValue;
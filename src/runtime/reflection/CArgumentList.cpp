@@ -31,38 +31,59 @@ CArgumentList::CArgumentList(
     , mIntegerData(nullptr)
     , mFPData(nullptr)
     , mStackData(nullptr)
+    , mArenaBacked(false)
 {
-    CalculateDataSize(mc, mm,
-            &mIntegerDataNumber, &mFPDataNumber, &mStackDataNumber);
-    if (mIntegerDataNumber > 0) {
-        mIntegerData = (Long*)malloc(sizeof(Long) * mIntegerDataNumber);
-    }
-    if (mFPDataNumber > 0) {
-        mFPData = (Double*)malloc(sizeof(Double) * mFPDataNumber);
-    }
-    if (mStackDataNumber > 0) {
-        mStackData = (Long*)malloc(sizeof(Long) * mStackDataNumber);
-    }
+    AllocData(mc, mm, nullptr);
+}
+
+CArgumentList::CArgumentList(
+    /* [in] */ MetaComponent* mc,
+    /* [in] */ MetaMethod* mm,
+    /* [in] */ Arena* arena)
+    : mArgumentNumber(mm->mParameterNumber)
+    , mArgumentIndicators(nullptr)
+    , mIntegerData(nullptr)
+    , mFPData(nullptr)
+    , mStackData(nullptr)
+    , mArenaBacked(true)
+{
+    AllocData(mc, mm, arena);
 }
 
 CArgumentList::~CArgumentList()
 {
-    if (mArgumentIndicators != nullptr) {
-        free(mArgumentIndicators);
-        mArgumentIndicators = nullptr;
-    }
-    if (mIntegerData != nullptr) {
+    // The indicators and the data share one block.
+    if (mIntegerData != nullptr && !mArenaBacked) {
         free(mIntegerData);
-        mIntegerData = nullptr;
     }
-    if (mFPData != nullptr) {
-        free(mFPData);
-        mFPData = nullptr;
-    }
-    if (mStackData != nullptr) {
-        free(mStackData);
-        mStackData = nullptr;
+    mArgumentIndicators = nullptr;
+    mIntegerData = nullptr;
+    mFPData = nullptr;
+    mStackData = nullptr;
+}
+
+void CArgumentList::AllocData(
+    /* [in] */ MetaComponent* mc,
+    /* [in] */ MetaMethod* mm,
+    /* [in] */ Arena* arena)
+{
+    // The numbers of register slots are bounded, so one block sized
+    // for the worst case holds everything:
+    // | integer data | fp data | stack data | indicators |
+    size_t size = sizeof(Long) * (INT_DATA_MAX + FP_DATA_MAX + mArgumentNumber) +
+            sizeof(Short) * mArgumentNumber;
+    void* block = arena != nullptr ? arena->Alloc(size) : malloc(size);
+    if (block == nullptr) {
+        mIntegerDataNumber = mFPDataNumber = mStackDataNumber = 0;
+        return;
     }
+    mIntegerData = reinterpret_cast<Long*>(block);
+    mFPData = reinterpret_cast<Double*>(mIntegerData + INT_DATA_MAX);
+    mStackData = reinterpret_cast<Long*>(mFPData + FP_DATA_MAX);
+    mArgumentIndicators = reinterpret_cast<Short*>(mStackData + mArgumentNumber);
+
+    CalculateDataSize(mc, mm,
+            &mIntegerDataNumber, &mFPDataNumber, &mStackDataNumber);
 }
 
 ECode CArgumentList::GetInputArgumentOfByte(
@@ -940,10 +961,6 @@ void CArgumentList::CalculateDataSize(
     /* [out] */ Integer* fpDataNum,
     /* [out] */ Integer* stDataNum)
 {
-    if (mArgumentNumber > 0) {
-        mArgumentIndicators =
-                (Short*)malloc(sizeof(Short) * mArgumentNumber);
-    }
     *intDataNum = 1;
     *fpDataNum = 0;
     *stDataNum = 0;
@@ -966,7 +983,7 @@ void CArgumentList::CalculateDataSize(
             case CcmTypeKind::Array:
             case CcmTypeKind::Interface:
             case CcmTypeKind::Triple: {
-                if (*intDataNum < 6) {
+                if (*intDataNum < INT_DATA_MAX) {
                     mArgumentIndicators[i] = (INT_DATA << DATA_SHIFT) | *intDataNum;
                     (*intDataNum)++;
                 }
@@ -978,7 +995,7 @@ void CArgumentList::CalculateDataSize(
             }
             case CcmTypeKind::Float:
             case CcmTypeKind::Double: {
-                if (*fpDataNum < 8) {
+                if (*fpDataNum < FP_DATA_MAX) {
                     mArgumentIndicators[i] = (FP_DATA << DATA_SHIFT) | *fpDataNum;
                     (*fpDataNum)++;
                 }
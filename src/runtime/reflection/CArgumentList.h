@@ -17,6 +17,7 @@
 #ifndef __CCM_CARGUMENTLIST_H__
 #define __CCM_CARGUMENTLIST_H__
 
+#include "arena.h"
 #include "ccmrefbase.h"
 #include "Component.h"
 
@@ -34,6 +35,13 @@ public:
         /* [in] */ MetaComponent* mc,
         /* [in] */ MetaMethod* mm);
 
+    // All the storage, including the object itself if it is created by
+    // CMetaMethod::CreateArgumentList(Arena*), comes from the arena.
+    CArgumentList(
+        /* [in] */ MetaComponent* mc,
+        /* [in] */ MetaMethod* mm,
+        /* [in] */ Arena* arena);
+
     ~CArgumentList();
 
     CCM_INTERFACE_DECL();
@@ -318,6 +326,11 @@ private:
     friend class CMetaConstructor;
     friend class CMetaMethod;
 
+    void AllocData(
+        /* [in] */ MetaComponent* mc,
+        /* [in] */ MetaMethod* mm,
+        /* [in] */ Arena* arena);
+
     void CalculateDataSize(
         /* [in] */ MetaComponent* mc,
         /* [in] */ MetaMethod* mm,
@@ -353,6 +366,7 @@ public:
     Integer mFPDataNumber;
     Long* mStackData;
     Integer mStackDataNumber;
+    Boolean mArenaBacked;
 
 private:
     static constexpr Byte DATA_SHIFT = 14;
@@ -360,6 +374,8 @@ private:
     static constexpr Byte INT_DATA = 0x00;
     static constexpr Byte FP_DATA = 0x01;
     static constexpr Byte STK_DATA = 0x02;
+    static constexpr Integer INT_DATA_MAX = 6;
+    static constexpr Integer FP_DATA_MAX = 8;
 };
 
 }
@@ -18,6 +18,8 @@
 #include "CMetaCoclass.h"
 #include "CMetaComponent.h"
 #include "CMetaConstructor.h"
+#include "CMetaInterface.h"
+#include <string.h>
 
 using ccm::metadata::MetaInterface;
 using ccm::metadata::MetaMethod;
@@ -32,8 +34,8 @@ CMetaCoclass::CMetaCoclass(
     /* [in] */ MetaCoclass* mk)
     : mMetadata(mk)
     , mOwner(mcObj)
-    , mName(mk->mName)
-    , mNamespace(mk->mNamespace)
+    , mName(String::Intern(mk->mName))
+    , mNamespace(String::Intern(mk->mNamespace))
     , mMetaInterfaces(mk->mInterfaceNumber - 1)
 {
     mCid.mUuid = mk->mUuid;
@@ -122,19 +124,21 @@ ECode CMetaCoclass::GetConstructor(
 {
     VALIDATE_NOT_NULL(constr);
 
-    BuildAllConstructors();
+    *constr = nullptr;
+    if (signature.IsNull()) {
+        return NOERROR;
+    }
 
-    for (Integer i = 0; i < mMetaConstructors.GetLength(); i++) {
-        IMetaConstructor* mc = mMetaConstructors[i];
-        String mcSig;
-        mc->GetSignature(&mcSig);
-        if (signature.Equals(mcSig)) {
-            *constr = mc;
+    MetaInterface* mi = mOwner->mMetadata->mInterfaces[
+            mMetadata->mInterfaceIndexes[mMetadata->mInterfaceNumber - 1]];
+    for (Integer i = 0; i < mi->mMethodNumber; i++) {
+        if (strcmp(mi->mMethods[i]->mSignature, signature.string()) == 0) {
+            BuildAllConstructors();
+            *constr = mMetaConstructors[i];
             REFCOUNT_ADD(*constr);
             return NOERROR;
         }
     }
-    *constr = nullptr;
     return NOERROR;
 }
 
@@ -230,8 +234,8 @@ ECode CMetaCoclass::GetMethodNumber(
         for (Integer i = 0; i < mMetadata->mInterfaceNumber - 1; i++) {
             MetaInterface* mi = mOwner->mMetadata->mInterfaces[
                     mMetadata->mInterfaceIndexes[i]];
-            String fullName = String::Format("%s%s", mi->mNamespace,
-                    mi->mName);
+            String fullName = String::Format("%s%s", mi->mNamespace.Get(),
+                    mi->mName.Get());
             if (fullName.Equals("ccm::IInterface")) continue;
             AutoPtr<IMetaInterface> miObj;
             GetInterface(fullName, &miObj);
@@ -264,22 +268,36 @@ ECode CMetaCoclass::GetMethod(
     /* [in] */ const String& signature,
     /* [out] */ IMetaMethod** method)
 {
-    VALIDATE_NOT_NULL(method);
+    return GetMethod(name.string(), signature.string(), method);
+}
 
-    BuildAllMethod();
+ECode CMetaCoclass::GetMethod(
+    /* [in] */ const char* name,
+    /* [in] */ const char* signature,
+    /* [out] */ IMetaMethod** method)
+{
+    VALIDATE_NOT_NULL(method);
 
-    for (Integer i = 0; i < mMetaMethods.GetLength(); i++) {
-        IMetaMethod* mmObj = mMetaMethods[i];
-        String mmName, mmSignature;
-        mmObj->GetName(&mmName);
-        mmObj->GetSignature(&mmSignature);
-        if (mmName.Equals(name) && mmSignature.Equals(signature)) {
-            *method = mmObj;
-            REFCOUNT_ADD(*method);
-            return NOERROR;
+    // The methods of a coclass are the ones of its interfaces, so ask
+    // their method indexes, IInterface first.
+    CMetaInterface* miObj = (CMetaInterface*)mOwner->mIInterface.Get();
+    ECode ec = miObj->GetMethod(name, signature, method);
+    if (FAILED(ec) || *method != nullptr) {
+        return ec;
+    }
+    for (Integer i = 0; i < mMetadata->mInterfaceNumber - 1; i++) {
+        Integer intfIndex = mMetadata->mInterfaceIndexes[i];
+        MetaInterface* mi = mOwner->mMetadata->mInterfaces[intfIndex];
+        if (strcmp(mi->mNamespace, "ccm::") == 0 &&
+                strcmp(mi->mName, "IInterface") == 0) {
+            continue;
+        }
+        AutoPtr<IMetaInterface> intf = mOwner->BuildInterface(intfIndex);
+        ec = ((CMetaInterface*)intf.Get())->GetMethod(name, signature, method);
+        if (FAILED(ec) || *method != nullptr) {
+            return ec;
         }
     }
-    *method = nullptr;
     return NOERROR;
 }
 
@@ -95,6 +95,13 @@ public:
         /* [in] */ const InterfaceID& iid,
         /* [out] */ IInterface** object) override;
 
+    // Like GetMethod(String, String), without building Strings for the
+    // arguments or for the methods.
+    ECode GetMethod(
+        /* [in] */ const char* name,
+        /* [in] */ const char* signature,
+        /* [out] */ IMetaMethod** method);
+
 private:
     void BuildAllConstructors();
 
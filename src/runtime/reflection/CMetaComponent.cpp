@@ -22,7 +22,9 @@
 #include "CMetaMethod.h"
 #include "CMetaParameter.h"
 #include "CMetaType.h"
+#include <dlfcn.h>
 #include <stdlib.h>
+#include <string.h>
 
 using ccm::metadata::MetaCoclass;
 using ccm::metadata::MetaInterface;
@@ -31,31 +33,106 @@ namespace ccm {
 
 CCM_INTERFACE_IMPL_LIGHT_1(CMetaComponent, LightRefBase, IMetaComponent);
 
+static unsigned long long GetNameKey(
+    /* [in] */ const String& fullName)
+{
+    return (unsigned int)fullName.GetHashCode();
+}
+
+static unsigned long long GetUuidKey(
+    /* [in] */ const Uuid& uuid)
+{
+    return GetUuidWord(uuid, 0) ^
+            PerfectHashIndex::Mix(GetUuidWord(uuid, 8) + GetUuidWord(uuid, 14));
+}
+
+static Boolean IsFullName(
+    /* [in] */ const String& fullName,
+    /* [in] */ const char* ns,
+    /* [in] */ const char* name)
+{
+    size_t nsLength = strlen(ns);
+    return strncmp(fullName.string(), ns, nsLength) == 0 &&
+            strcmp(fullName.string() + nsLength, name) == 0;
+}
+
+// Returns the index published in |indexRef|, building it first over the
+// entries |getKey| gives a key for if there is none yet. Returns nullptr
+// when there are no entries, as after the component is unloaded.
+template<class GetKey>
+static PerfectHashIndex* GetIndex(
+    /* [in] */ std::atomic<PerfectHashIndex*>& indexRef,
+    /* [in] */ Integer number,
+    /* [in] */ GetKey getKey)
+{
+    if (number == 0) {
+        return nullptr;
+    }
+
+    PerfectHashIndex* index = indexRef.load(std::memory_order_acquire);
+    if (index != nullptr) {
+        return index;
+    }
+
+    unsigned long long* keys = (unsigned long long*)malloc(
+            sizeof(unsigned long long) * (number + 1));
+    Integer* values = (Integer*)malloc(sizeof(Integer) * (number + 1));
+    if (keys != nullptr && values != nullptr) {
+        Integer entryNumber = 0;
+        for (Integer i = 0; i < number; i++) {
+            if (getKey(i, &keys[entryNumber])) {
+                values[entryNumber++] = i;
+            }
+        }
+        index = PerfectHashIndex::Create(keys, values, entryNumber);
+    }
+    free(keys);
+    free(values);
+    return PerfectHashIndex::Publish(indexRef, index);
+}
+
+// Returns the first value in |index| under |key| which |matches|, or -1.
+template<class Matches>
+static Integer FindInIndex(
+    /* [in] */ PerfectHashIndex* index,
+    /* [in] */ unsigned long long key,
+    /* [in] */ Matches matches)
+{
+    if (index == nullptr) {
+        return -1;
+    }
+    for (Integer entry = index->Find(key); entry != -1; entry = index->GetNext(entry)) {
+        Integer value = index->GetValue(entry);
+        if (matches(value)) {
+            return value;
+        }
+    }
+    return -1;
+}
+
 CMetaComponent::CMetaComponent(
     /* [in] */ IClassLoader* loader,
     /* [in] */ CcmComponent* component,
-    /* [in] */ MetaComponent* metadata)
+    /* [in] */ MetaComponent* metadata,
+    /* [in] */ void* soHandle)
     : mLoader(loader)
     , mComponent(component)
     , mMetadata(metadata)
-    , mName(metadata->mName)
+    , mSoHandle(soHandle)
+    , mName(String::Intern(metadata->mName))
     , mUrl(metadata->mUrl)
     , mMetaCoclasses(mMetadata->mCoclassNumber)
-    , mMetaCoclassNameMap(mMetadata->mCoclassNumber)
-    , mMetaCoclassIdMap(mMetadata->mCoclassNumber)
-    , mMetaCoclassesAllBuilt(false)
-    , mMetaEnumerations(mMetadata->mEnumerationNumber -
-            mMetadata->mExternalEnumerationNumber)
-    , mMetaEnumerationMap(mMetadata->mEnumerationNumber -
+    , mMetaCoclassNameIndex(nullptr)
+    , mMetaCoclassIdIndex(nullptr)
+    , mMetaEnumerations(mMetadata->mEnumerationNumber)
+    , mMetaEnumerationNumber(mMetadata->mEnumerationNumber -
             mMetadata->mExternalEnumerationNumber)
-    , mMetaEnumerationsAllBuilt(false)
-    , mMetaInterfaces(mMetadata->mInterfaceNumber -
+    , mMetaEnumerationNameIndex(nullptr)
+    , mMetaInterfaces(mMetadata->mInterfaceNumber)
+    , mMetaInterfaceNumber(mMetadata->mInterfaceNumber -
             mMetadata->mExternalInterfaceNumber)
-    , mMetaInterfaceNameMap(mMetadata->mInterfaceNumber -
-            mMetadata->mExternalInterfaceNumber)
-    , mMetaInterfaceIdMap(mMetadata->mInterfaceNumber -
-            mMetadata->mExternalInterfaceNumber)
-    , mMetaInterfacesAllBuilt(false)
+    , mMetaInterfaceNameIndex(nullptr)
+    , mMetaInterfaceIdIndex(nullptr)
 {
     mCid.mUuid = metadata->mUuid;
     mCid.mUrl = mUrl.string();
@@ -67,6 +144,14 @@ CMetaComponent::CMetaComponent(
 CMetaComponent::~CMetaComponent()
 {
     ReleaseResources();
+    PerfectHashIndex::Destroy(mMetaCoclassNameIndex.load(std::memory_order_relaxed));
+    PerfectHashIndex::Destroy(mMetaCoclassIdIndex.load(std::memory_order_relaxed));
+    PerfectHashIndex::Destroy(mMetaEnumerationNameIndex.load(std::memory_order_relaxed));
+    PerfectHashIndex::Destroy(mMetaInterfaceNameIndex.load(std::memory_order_relaxed));
+    PerfectHashIndex::Destroy(mMetaInterfaceIdIndex.load(std::memory_order_relaxed));
+    if (mSoHandle != nullptr) {
+        dlclose(mSoHandle);
+    }
 }
 
 ECode CMetaComponent::GetName(
@@ -99,15 +184,9 @@ ECode CMetaComponent::GetCoclassNumber(
 ECode CMetaComponent::GetAllCoclasses(
     /* [out] */ Array<IMetaCoclass*>& klasses)
 {
-    if (mMetaCoclasses.IsEmpty()) {
-        return NOERROR;
-    }
-
-    BuildAllCoclasses();
-
     Integer N = MIN(mMetaCoclasses.GetLength(), klasses.GetLength());
     for (Integer i = 0; i < N; i++) {
-        klasses.Set(i, mMetaCoclasses[i]);
+        klasses.Set(i, BuildCoclass(i));
     }
 
     return NOERROR;
@@ -119,15 +198,12 @@ ECode CMetaComponent::GetCoclass(
 {
     VALIDATE_NOT_NULL(metaKls);
 
-    if (fullName.IsNullOrEmpty() || mMetaCoclasses.IsEmpty()) {
+    if (fullName.IsNullOrEmpty() || mMetaCoclasses.GetLength() == 0) {
         *metaKls = nullptr;
         return NOERROR;
     }
 
-    BuildAllCoclasses();
-
-    *metaKls = mMetaCoclassNameMap.Get(fullName);
-    REFCOUNT_ADD(*metaKls);
+    BuildCoclass(FindCoclass(fullName)).MoveTo(metaKls);
     return NOERROR;
 }
 
@@ -137,10 +213,7 @@ ECode CMetaComponent::GetCoclass(
 {
     VALIDATE_NOT_NULL(metaKls);
 
-    BuildAllCoclasses();
-
-    *metaKls = mMetaCoclassIdMap.Get(cid.mUuid);
-    REFCOUNT_ADD(*metaKls);
+    BuildCoclass(FindCoclass(cid.mUuid)).MoveTo(metaKls);
     return NOERROR;
 }
 
@@ -149,22 +222,18 @@ ECode CMetaComponent::GetEnumerationNumber(
 {
     VALIDATE_NOT_NULL(number);
 
-    *number = mMetaEnumerations.GetLength();
+    *number = mMetaEnumerationNumber;
     return NOERROR;
 }
 
 ECode CMetaComponent::GetAllEnumerations(
     /* [out] */ Array<IMetaEnumeration*>& enumns)
 {
-    if (mMetaEnumerations.IsEmpty()) {
-        return NOERROR;
-    }
-
-    BuildAllEnumerations();
-
-    Integer N = MIN(mMetaEnumerations.GetLength(), enumns.GetLength());
-    for (Integer i = 0; i < N; i++) {
-        enumns.Set(i, mMetaEnumerations[i]);
+    Integer index = 0;
+    for (Integer i = 0; i < mMetaEnumerations.GetLength() &&
+            index < enumns.GetLength(); i++) {
+        if (mMetadata->mEnumerations[i]->mExternal) continue;
+        enumns.Set(index++, BuildEnumeration(i));
     }
 
     return NOERROR;
@@ -176,15 +245,12 @@ ECode CMetaComponent::GetEnumeration(
 {
     VALIDATE_NOT_NULL(enumn);
 
-    if (fullName.IsNullOrEmpty() || mMetaEnumerations.IsEmpty()) {
+    if (fullName.IsNullOrEmpty() || mMetaEnumerationNumber == 0) {
         *enumn = nullptr;
         return NOERROR;
     }
 
-    BuildAllEnumerations();
-
-    *enumn = mMetaEnumerationMap.Get(fullName);
-    REFCOUNT_ADD(*enumn);
+    BuildEnumeration(FindEnumeration(fullName)).MoveTo(enumn);
     return NOERROR;
 }
 
@@ -193,22 +259,18 @@ ECode CMetaComponent::GetInterfaceNumber(
 {
     VALIDATE_NOT_NULL(number);
 
-    *number = mMetaInterfaces.GetLength();
+    *number = mMetaInterfaceNumber;
     return NOERROR;
 }
 
 ECode CMetaComponent::GetAllInterfaces(
     /* [out] */ Array<IMetaInterface*>& intfs)
 {
-    if (mMetaInterfaces.IsEmpty()) {
-        return NOERROR;
-    }
-
-    BuildAllInterfaces();
-
-    Integer N = MIN(mMetaInterfaces.GetLength(), intfs.GetLength());
-    for (Integer i = 0; i < N; i++) {
-        intfs.Set(i, mMetaInterfaces[i]);
+    Integer index = 0;
+    for (Integer i = 0; i < mMetaInterfaces.GetLength() &&
+            index < intfs.GetLength(); i++) {
+        if (mMetadata->mInterfaces[i]->mExternal) continue;
+        intfs.Set(index++, BuildInterface(i));
     }
 
     return NOERROR;
@@ -220,15 +282,12 @@ ECode CMetaComponent::GetInterface(
 {
     VALIDATE_NOT_NULL(metaIntf);
 
-    if (fullName.IsNullOrEmpty() || mMetaInterfaces.IsEmpty()) {
+    if (fullName.IsNullOrEmpty() || mMetaInterfaceNumber == 0) {
         *metaIntf = nullptr;
         return NOERROR;
     }
 
-    BuildAllInterfaces();
-
-    *metaIntf = mMetaInterfaceNameMap.Get(fullName);
-    REFCOUNT_ADD(*metaIntf);
+    BuildInterface(FindInterface(fullName)).MoveTo(metaIntf);
     return NOERROR;
 }
 
@@ -238,9 +297,7 @@ ECode CMetaComponent::GetInterface(
 {
     VALIDATE_NOT_NULL(metaIntf);
 
-    BuildAllInterfaces();
-    *metaIntf = mMetaInterfaceIdMap.Get(iid.mUuid);
-    REFCOUNT_ADD(*metaIntf);
+    BuildInterface(FindInterface(iid.mUuid)).MoveTo(metaIntf);
     return NOERROR;
 }
 
@@ -275,164 +332,134 @@ ECode CMetaComponent::GetClassObject(
     return mComponent->mSoGetClassObject(cid, object);
 }
 
-void CMetaComponent::BuildAllCoclasses()
-{
-    if (mMetadata->mCoclassNumber == 0 ||
-            mMetaCoclassesAllBuilt) {
-        return;
-    }
-
-    for (Integer i = 0; i < mMetadata->mCoclassNumber; i++) {
-        MetaCoclass* mc = mMetadata->mCoclasses[i];
-        String fullName = String::Format("%s%s",
-                mc->mNamespace, mc->mName);
-        if (!mMetaCoclassNameMap.ContainsKey(fullName)) {
-            CMetaCoclass* mcObj = new CMetaCoclass(
-                    this, mMetadata, mc);
-            mMetaCoclasses.Set(i, mcObj);
-            mMetaCoclassNameMap.Put(fullName, mcObj);
-            mMetaCoclassIdMap.Put(mcObj->mCid.mUuid, mcObj);
-        }
-    }
-    mMetaCoclassesAllBuilt = true;
-}
-
 AutoPtr<IMetaCoclass> CMetaComponent::BuildCoclass(
     /* [in] */ Integer index)
 {
-    AutoPtr<IMetaCoclass> ret;
     if (index < 0 || index >= mMetadata->mCoclassNumber) {
-        return ret;
+        return nullptr;
     }
 
-    MetaCoclass* mc = mMetadata->mCoclasses[index];
-    String fullName = String::Format("%s%s",
-                mc->mNamespace, mc->mName);
-    if (!mMetaCoclassNameMap.ContainsKey(fullName)) {
-        CMetaCoclass* mcObj = new CMetaCoclass(
-                this, mMetadata, mc);
-        mMetaCoclasses.Set(index, mcObj);
-        mMetaCoclassNameMap.Put(fullName, mcObj);
-        mMetaCoclassIdMap.Put(mcObj->mCid.mUuid, mcObj);
-        ret = mcObj;
-    }
-    else {
-        ret = mMetaCoclassNameMap.Get(fullName);
+    AutoPtr<IMetaCoclass> ret = mMetaCoclasses.Get(index);
+    if (ret == nullptr) {
+        ret = mMetaCoclasses.Publish(index, new CMetaCoclass(
+                this, mMetadata, mMetadata->mCoclasses[index]));
     }
     return ret;
 }
 
-void CMetaComponent::BuildAllEnumerations()
+AutoPtr<IMetaEnumeration> CMetaComponent::BuildEnumeration(
+    /* [in] */ Integer index)
 {
-    if (mMetadata->mEnumerationNumber == 0 ||
-            mMetaEnumerationsAllBuilt) {
-        return;
+    if (index < 0 || index >= mMetadata->mEnumerationNumber) {
+        return nullptr;
     }
 
-    Integer index = 0;
-    for (Integer i = 0; i < mMetadata->mEnumerationNumber; i++) {
-        MetaEnumeration* me = mMetadata->mEnumerations[i];
-        if (me->mExternal) continue;
-        String fullName = String::Format("%s%s",
-                me->mNamespace, me->mName);
-        if (!mMetaEnumerationMap.ContainsKey(fullName)) {
-            IMetaEnumeration* meObj = new CMetaEnumeration(
-                    this, mMetadata, me);
-            mMetaEnumerations.Set(index, meObj);
-            mMetaEnumerationMap.Put(fullName, meObj);
-        }
-        index++;
+    MetaEnumeration* me = mMetadata->mEnumerations[index];
+    if (me->mExternal) return nullptr;
+    AutoPtr<IMetaEnumeration> ret = mMetaEnumerations.Get(index);
+    if (ret == nullptr) {
+        ret = mMetaEnumerations.Publish(index, new CMetaEnumeration(
+                this, mMetadata, me));
     }
-    mMetaEnumerationsAllBuilt = true;
+    return ret;
 }
 
-AutoPtr<IMetaEnumeration> CMetaComponent::BuildEnumeration(
+AutoPtr<IMetaInterface> CMetaComponent::BuildInterface(
     /* [in] */ Integer index)
 {
-    AutoPtr<IMetaEnumeration> ret;
-    if (index < 0 || index >= mMetadata->mEnumerationNumber) {
-        return ret;
+    if (index < 0 || index >= mMetadata->mInterfaceNumber) {
+        return nullptr;
     }
 
-    MetaEnumeration* me = mMetadata->mEnumerations[index];
-    if (me->mExternal) return ret;
-    String fullName = String::Format("%s%s",
-            me->mNamespace, me->mName);
-    if (!mMetaEnumerationMap.ContainsKey(fullName)) {
-        IMetaEnumeration* meObj = new CMetaEnumeration(
-                this, mMetadata, me);
-        Integer realIndex = index;
-        for (Integer i = 0; i <= index; i++) {
-            if (mMetadata->mEnumerations[i]->mExternal) {
-                realIndex--;
-            }
-        }
-        mMetaEnumerations.Set(realIndex, meObj);
-        mMetaEnumerationMap.Put(fullName, meObj);
-        ret = meObj;
-    }
-    else {
-        ret = mMetaEnumerationMap.Get(fullName);
+    AutoPtr<IMetaInterface> ret = mMetaInterfaces.Get(index);
+    if (ret == nullptr) {
+        ret = mMetaInterfaces.Publish(index, new CMetaInterface(
+                this, mMetadata, mMetadata->mInterfaces[index]));
     }
     return ret;
 }
 
-void CMetaComponent::BuildAllInterfaces()
+Integer CMetaComponent::FindCoclass(
+    /* [in] */ const String& fullName)
 {
-    if (mMetadata->mInterfaceNumber == 0 ||
-            mMetaInterfacesAllBuilt) {
-        return;
-    }
+    PerfectHashIndex* index = GetIndex(mMetaCoclassNameIndex, mMetaCoclasses.GetLength(),
+            [this](Integer i, unsigned long long* key) -> Boolean {
+                MetaCoclass* mc = mMetadata->mCoclasses[i];
+                *key = GetNameKey(String::Format("%s%s",
+                        mc->mNamespace.Get(), mc->mName.Get()));
+                return true;
+            });
+    return FindInIndex(index, GetNameKey(fullName),
+            [this, &fullName](Integer i) -> Boolean {
+                MetaCoclass* mc = mMetadata->mCoclasses[i];
+                return IsFullName(fullName, mc->mNamespace.Get(), mc->mName.Get());
+            });
+}
 
-    Integer index = 0;
-    for (Integer i = 0; i < mMetadata->mInterfaceNumber; i++) {
-        MetaInterface* mi = mMetadata->mInterfaces[i];
-        if (mi->mExternal) continue;
-        String fullName = String::Format("%s%s",
-                mi->mNamespace, mi->mName);
-        if (!mMetaInterfaceNameMap.ContainsKey(fullName)) {
-            CMetaInterface* miObj = new CMetaInterface(
-                    this, mMetadata, mi);
-            mMetaInterfaces.Set(index, miObj);
-            mMetaInterfaceNameMap.Put(fullName, miObj);
-            mMetaInterfaceIdMap.Put(miObj->mIid.mUuid, miObj);
-        }
-        index++;
-    }
-    mMetaInterfacesAllBuilt = true;
+Integer CMetaComponent::FindCoclass(
+    /* [in] */ const Uuid& uuid)
+{
+    PerfectHashIndex* index = GetIndex(mMetaCoclassIdIndex, mMetaCoclasses.GetLength(),
+            [this](Integer i, unsigned long long* key) -> Boolean {
+                *key = GetUuidKey(mMetadata->mCoclasses[i]->mUuid);
+                return true;
+            });
+    return FindInIndex(index, GetUuidKey(uuid),
+            [this, &uuid](Integer i) -> Boolean {
+                return mMetadata->mCoclasses[i]->mUuid == uuid;
+            });
 }
 
-AutoPtr<IMetaInterface> CMetaComponent::BuildInterface(
-    /* [in] */ Integer index)
+Integer CMetaComponent::FindEnumeration(
+    /* [in] */ const String& fullName)
 {
-    AutoPtr<IMetaInterface> ret;
-    if (index < 0 || index >= mMetadata->mInterfaceNumber) {
-        return ret;
-    }
+    PerfectHashIndex* index = GetIndex(mMetaEnumerationNameIndex, mMetaEnumerations.GetLength(),
+            [this](Integer i, unsigned long long* key) -> Boolean {
+                MetaEnumeration* me = mMetadata->mEnumerations[i];
+                if (me->mExternal) return false;
+                *key = GetNameKey(String::Format("%s%s",
+                        me->mNamespace.Get(), me->mName.Get()));
+                return true;
+            });
+    return FindInIndex(index, GetNameKey(fullName),
+            [this, &fullName](Integer i) -> Boolean {
+                MetaEnumeration* me = mMetadata->mEnumerations[i];
+                return IsFullName(fullName, me->mNamespace.Get(), me->mName.Get());
+            });
+}
 
-    MetaInterface* mi = mMetadata->mInterfaces[index];
-    String fullName = String::Format("%s%s",
-            mi->mNamespace, mi->mName);
-    if (!mMetaInterfaceNameMap.ContainsKey(fullName)) {
-        CMetaInterface* miObj = new CMetaInterface(
-                this, mMetadata, mi);
-        Integer realIndex = index;
-        for (Integer i = 0; i <= index; i++) {
-            if (mMetadata->mInterfaces[i]->mExternal) {
-                realIndex--;
-            }
-        }
-        if (!mi->mExternal) {
-            mMetaInterfaces.Set(realIndex, miObj);
-        }
-        mMetaInterfaceNameMap.Put(fullName, miObj);
-        mMetaInterfaceIdMap.Put(miObj->mIid.mUuid, miObj);
-        ret = miObj;
-    }
-    else {
-        ret = mMetaInterfaceNameMap.Get(fullName);
-    }
-    return ret;
+Integer CMetaComponent::FindInterface(
+    /* [in] */ const String& fullName)
+{
+    PerfectHashIndex* index = GetIndex(mMetaInterfaceNameIndex, mMetaInterfaces.GetLength(),
+            [this](Integer i, unsigned long long* key) -> Boolean {
+                MetaInterface* mi = mMetadata->mInterfaces[i];
+                if (mi->mExternal) return false;
+                *key = GetNameKey(String::Format("%s%s",
+                        mi->mNamespace.Get(), mi->mName.Get()));
+                return true;
+            });
+    return FindInIndex(index, GetNameKey(fullName),
+            [this, &fullName](Integer i) -> Boolean {
+                MetaInterface* mi = mMetadata->mInterfaces[i];
+                return IsFullName(fullName, mi->mNamespace.Get(), mi->mName.Get());
+            });
+}
+
+Integer CMetaComponent::FindInterface(
+    /* [in] */ const Uuid& uuid)
+{
+    PerfectHashIndex* index = GetIndex(mMetaInterfaceIdIndex, mMetaInterfaces.GetLength(),
+            [this](Integer i, unsigned long long* key) -> Boolean {
+                MetaInterface* mi = mMetadata->mInterfaces[i];
+                if (mi->mExternal) return false;
+                *key = GetUuidKey(mi->mUuid);
+                return true;
+            });
+    return FindInIndex(index, GetUuidKey(uuid),
+            [this, &uuid](Integer i) -> Boolean {
+                return mMetadata->mInterfaces[i]->mUuid == uuid;
+            });
 }
 
 void CMetaComponent::LoadAllClassObjectGetters()
@@ -447,20 +474,18 @@ void CMetaComponent::LoadAllClassObjectGetters()
 
 void CMetaComponent::BuildIInterface()
 {
-    CMetaInterface* miObj = new CMetaInterface();
+    CMetaInterface* miObj = new CMetaInterface(4);
     miObj->mOwner = this;
     miObj->mIid = IID_IInterface;
     miObj->mName = "IInterface";
     miObj->mNamespace = "ccm::";
-    miObj->mMetaMethods = Array<IMetaMethod*>(4);
 
     // AddRef
-    CMetaMethod* mmObj = new CMetaMethod();
+    CMetaMethod* mmObj = new CMetaMethod(1);
     mmObj->mOwner = miObj;
     mmObj->mIndex = 0;
     mmObj->mName = "AddRef";
     mmObj->mSignature = "(H)I";
-    mmObj->mParameters = Array<IMetaParameter*>(1);
     CMetaParameter* mpObj = new CMetaParameter();
     mpObj->mOwner = mmObj;
     mpObj->mName = "id";
@@ -470,20 +495,19 @@ void CMetaComponent::BuildIInterface()
     mtObj->mKind = CcmTypeKind::HANDLE;
     mtObj->mName = "HANDLE";
     mpObj->mType = mtObj;
-    mmObj->mParameters.Set(0, mpObj);
+    mmObj->mParameters.Publish(0, mpObj);
     mtObj = new CMetaType();
     mtObj->mKind = CcmTypeKind::Integer;
     mtObj->mName = "Integer";
     mmObj->mReturnType = mtObj;
-    miObj->mMetaMethods.Set(0, mmObj);
+    miObj->mMetaMethods.Publish(0, mmObj);
 
     // Release
-    mmObj = new CMetaMethod();
+    mmObj = new CMetaMethod(1);
     mmObj->mOwner = miObj;
     mmObj->mIndex = 1;
     mmObj->mName = "Release";
     mmObj->mSignature = "(H)I";
-    mmObj->mParameters = Array<IMetaParameter*>(1);
     mpObj = new CMetaParameter();
     mpObj->mOwner = mmObj;
     mpObj->mName = "id";
@@ -493,20 +517,19 @@ void CMetaComponent::BuildIInterface()
     mtObj->mKind = CcmTypeKind::HANDLE;
     mtObj->mName = "HANDLE";
     mpObj->mType = mtObj;
-    mmObj->mParameters.Set(0, mpObj);
+    mmObj->mParameters.Publish(0, mpObj);
     mtObj = new CMetaType();
     mtObj->mKind = CcmTypeKind::Integer;
     mtObj->mName = "Integer";
     mmObj->mReturnType = mtObj;
-    miObj->mMetaMethods.Set(1, mmObj);
+    miObj->mMetaMethods.Publish(1, mmObj);
 
     // Probe
-    mmObj = new CMetaMethod();
+    mmObj = new CMetaMethod(1);
     mmObj->mOwner = miObj;
     mmObj->mIndex = 2;
     mmObj->mName = "Probe";
     mmObj->mSignature = "(U)Lccm/IInterface*";
-    mmObj->mParameters = Array<IMetaParameter*>(1);
     mpObj = new CMetaParameter();
     mpObj->mOwner = mmObj;
     mpObj->mName = "iid";
@@ -516,21 +539,20 @@ void CMetaComponent::BuildIInterface()
     mtObj->mKind = CcmTypeKind::InterfaceID;
     mtObj->mName = "InterfaceID";
     mpObj->mType = mtObj;
-    mmObj->mParameters.Set(0, mpObj);
+    mmObj->mParameters.Publish(0, mpObj);
     mtObj = new CMetaType();
     mtObj->mKind = CcmTypeKind::Interface;
     mtObj->mName = "IInterface";
     mtObj->mPointerNumber = 1;
     mmObj->mReturnType = mtObj;
-    miObj->mMetaMethods.Set(2, mmObj);
+    miObj->mMetaMethods.Publish(2, mmObj);
 
     // GetInterfaceID
-    mmObj = new CMetaMethod();
+    mmObj = new CMetaMethod(2);
     mmObj->mOwner = miObj;
     mmObj->mIndex = 3;
     mmObj->mName = "GetInterfaceID";
     mmObj->mSignature = "(Lccm/IInterface*U*)E";
-    mmObj->mParameters = Array<IMetaParameter*>(2);
     mpObj = new CMetaParameter();
     mpObj->mOwner = mmObj;
     mpObj->mName = "object";
@@ -541,7 +563,7 @@ void CMetaComponent::BuildIInterface()
     mtObj->mName = "IInterface";
     mtObj->mPointerNumber = 1;
     mpObj->mType = mtObj;
-    mmObj->mParameters.Set(0, mpObj);
+    mmObj->mParameters.Publish(0, mpObj);
     mpObj = new CMetaParameter();
     mpObj->mOwner = mmObj;
     mpObj->mName = "iid";
@@ -552,12 +574,12 @@ void CMetaComponent::BuildIInterface()
     mtObj->mName = "InterfaceID";
     mtObj->mPointerNumber = 1;
     mpObj->mType = mtObj;
-    mmObj->mParameters.Set(1, mpObj);
+    mmObj->mParameters.Publish(1, mpObj);
     mtObj = new CMetaType();
     mtObj->mKind = CcmTypeKind::ECode;
     mtObj->mName = "ECode";
     mmObj->mReturnType = mtObj;
-    miObj->mMetaMethods.Set(3, mmObj);
+    miObj->mMetaMethods.Publish(3, mmObj);
 
     mIInterface = miObj;
 }
@@ -569,25 +591,19 @@ void CMetaComponent::ReleaseResources()
         free(mComponent);
         mComponent = nullptr;
     }
-    if (mMetadata != nullptr) {
-        free(mMetadata);
-        mMetadata = nullptr;
-    }
     mCid.mUuid = UUID_ZERO;
     mCid.mUrl = nullptr;
     mName = nullptr;
     mUrl = nullptr;
+    // The arrays keep their slots and the indexes stay until the
+    // destructor, so lookups still running do not read freed memory.
+    // mMetadata stays too, mSoHandle keeps the mapping it is read from
+    // for the objects built before, which may still build their own.
     mMetaCoclasses.Clear();
-    mMetaCoclassNameMap.Clear();
-    mMetaCoclassIdMap.Clear();
-    mMetaCoclassesAllBuilt = false;
     mMetaEnumerations.Clear();
-    mMetaEnumerationMap.Clear();
-    mMetaEnumerationsAllBuilt = false;
+    mMetaEnumerationNumber = 0;
     mMetaInterfaces.Clear();
-    mMetaInterfaceNameMap.Clear();
-    mMetaInterfaceIdMap.Clear();
-    mMetaInterfacesAllBuilt = false;
+    mMetaInterfaceNumber = 0;
 }
 
 }
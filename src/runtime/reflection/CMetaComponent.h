@@ -20,8 +20,11 @@
 #include "ccmautoptr.h"
 #include "ccmrefbase.h"
 #include "hashmap.h"
+#include "lazyobjectarray.h"
+#include "perfecthash.h"
 #include "component/ccmcomponent.h"
 #include "metadata/Component.h"
+#include <atomic>
 
 using ccm::metadata::MetaComponent;
 
@@ -32,10 +35,13 @@ class CMetaComponent
     , public IMetaComponent
 {
 public:
+    // |soHandle| is a dlopen reference of the component's own, which is
+    // dlclosed when the object is destroyed.
     CMetaComponent(
         /* [in] */ IClassLoader* loader,
         /* [in] */ CcmComponent* component,
-        /* [in] */ MetaComponent* metadata);
+        /* [in] */ MetaComponent* metadata,
+        /* [in] */ void* soHandle);
 
     ~CMetaComponent();
 
@@ -94,22 +100,34 @@ public:
         /* [in] */ const CoclassID& cid,
         /* [out] */ IClassObject** object);
 
-    void BuildAllCoclasses();
-
+    // The Build* functions return the cached object at |index| of the
+    // metadata, building it if none is yet. They are safe to call from
+    // any thread without a lock.
     AutoPtr<IMetaCoclass> BuildCoclass(
         /* [in] */ Integer index);
 
-    void BuildAllEnumerations();
-
     AutoPtr<IMetaEnumeration> BuildEnumeration(
         /* [in] */ Integer index);
 
-    void BuildAllInterfaces();
-
     AutoPtr<IMetaInterface> BuildInterface(
         /* [in] */ Integer index);
 
 private:
+    Integer FindCoclass(
+        /* [in] */ const String& fullName);
+
+    Integer FindCoclass(
+        /* [in] */ const Uuid& uuid);
+
+    Integer FindEnumeration(
+        /* [in] */ const String& fullName);
+
+    Integer FindInterface(
+        /* [in] */ const String& fullName);
+
+    Integer FindInterface(
+        /* [in] */ const Uuid& uuid);
+
     void LoadAllClassObjectGetters();
 
     void BuildIInterface();
@@ -119,21 +137,26 @@ private:
 public:
     IClassLoader* mLoader;
     CcmComponent* mComponent;
+    // Read where the component is mapped, and kept mapped by mSoHandle
+    // as long as this object lives, even after the loader unloads it.
     MetaComponent* mMetadata;
+    void* mSoHandle;
     ComponentID mCid;
     String mName;
     String mUrl;
-    Array<IMetaCoclass*> mMetaCoclasses;
-    HashMap<String, IMetaCoclass*> mMetaCoclassNameMap;
-    HashMap<Uuid, IMetaCoclass*> mMetaCoclassIdMap;
-    Boolean mMetaCoclassesAllBuilt;
-    Array<IMetaEnumeration*> mMetaEnumerations;
-    HashMap<String, IMetaEnumeration*> mMetaEnumerationMap;
-    Boolean mMetaEnumerationsAllBuilt;
-    Array<IMetaInterface*> mMetaInterfaces;
-    HashMap<String, IMetaInterface*> mMetaInterfaceNameMap;
-    HashMap<Uuid, IMetaInterface*> mMetaInterfaceIdMap;
-    Boolean mMetaInterfacesAllBuilt;
+    // The reflection objects are kept at the indexes of their metadata,
+    // external ones included, and the indexes from names and ids to
+    // those are built the first time a lookup needs them.
+    LazyObjectArray<IMetaCoclass> mMetaCoclasses;
+    std::atomic<PerfectHashIndex*> mMetaCoclassNameIndex;
+    std::atomic<PerfectHashIndex*> mMetaCoclassIdIndex;
+    LazyObjectArray<IMetaEnumeration> mMetaEnumerations;
+    Integer mMetaEnumerationNumber;
+    std::atomic<PerfectHashIndex*> mMetaEnumerationNameIndex;
+    LazyObjectArray<IMetaInterface> mMetaInterfaces;
+    Integer mMetaInterfaceNumber;
+    std::atomic<PerfectHashIndex*> mMetaInterfaceNameIndex;
+    std::atomic<PerfectHashIndex*> mMetaInterfaceIdIndex;
     AutoPtr<IMetaInterface> mIInterface;
     HashMap<Uuid, ClassObjectGetter*> mClassObjects;
 };
@@ -155,6 +155,15 @@ ECode CMetaConstructor::HasOutArguments(
     return NOERROR;
 }
 
+ECode CMetaConstructor::IsOneway(
+    /* [out] */ Boolean* oneway)
+{
+    VALIDATE_NOT_NULL(oneway);
+
+    *oneway = false;
+    return NOERROR;
+}
+
 ECode CMetaConstructor::CreateArgumentList(
     /* [out] */ IArgumentList** argList)
 {
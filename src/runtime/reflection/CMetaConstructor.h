@@ -68,6 +68,9 @@ public:
     ECode HasOutArguments(
         /* [out] */ Boolean* outArgs);
 
+    ECode IsOneway(
+        /* [out] */ Boolean* oneway);
+
     ECode CreateArgumentList(
         /* [out] */ IArgumentList** argList);
 
@@ -28,8 +28,8 @@ CMetaEnumeration::CMetaEnumeration(
     /* [in] */ MetaEnumeration* me)
     : mMetadata(me)
     , mOwner(mcObj)
-    , mName(me->mName)
-    , mNamespace(me->mNamespace)
+    , mName(String::Intern(me->mName))
+    , mNamespace(String::Intern(me->mNamespace))
     , mMetaEnumerators(me->mEnumeratorNumber)
 {}
 
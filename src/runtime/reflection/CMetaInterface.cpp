@@ -18,14 +18,36 @@
 #include "CMetaConstant.h"
 #include "CMetaInterface.h"
 #include "CMetaMethod.h"
+#include <stdlib.h>
+#include <string.h>
 
 namespace ccm {
 
 CCM_INTERFACE_IMPL_LIGHT_1(CMetaInterface, LightRefBase, IMetaInterface);
 
-CMetaInterface::CMetaInterface()
+// FNV-1a over the name and the signature, the index mixes it further.
+static unsigned long long HashMethod(
+    /* [in] */ const char* name,
+    /* [in] */ const char* signature)
+{
+    unsigned long long hash = 0xcbf29ce484222325ull;
+    for (const char* p = name; *p != '\0'; p++) {
+        hash = (hash ^ (unsigned char)*p) * 0x100000001b3ull;
+    }
+    hash = (hash ^ '(') * 0x100000001b3ull;
+    for (const char* p = signature; *p != '\0'; p++) {
+        hash = (hash ^ (unsigned char)*p) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+CMetaInterface::CMetaInterface(
+    /* [in] */ Integer methodNumber)
     : mMetadata(nullptr)
     , mOwner(nullptr)
+    , mBaseInterface(nullptr)
+    , mMetaMethods(methodNumber)
+    , mMethodIndex(nullptr)
 {}
 
 CMetaInterface::CMetaInterface(
@@ -34,21 +56,23 @@ CMetaInterface::CMetaInterface(
     /* [in] */ MetaInterface* mi)
     : mMetadata(mi)
     , mOwner(mcObj)
-    , mName(mi->mName)
-    , mNamespace(mi->mNamespace)
+    , mName(String::Intern(mi->mName))
+    , mNamespace(String::Intern(mi->mNamespace))
+    , mBaseInterface(nullptr)
     , mMetaConstants(mi->mConstantNumber)
-    , mMetaMethods(mi->mMethodNumber)
+    , mMetaMethods(CalculateMethodNumber())
+    , mMethodIndex(nullptr)
 {
     mIid.mUuid = mi->mUuid;
     mIid.mCid = &mcObj->mCid;
     BuildBaseInterface();
-    mMetaMethods = Array<IMetaMethod*>(CalculateMethodNumber());
 }
 
 CMetaInterface::~CMetaInterface()
 {
     mMetadata = nullptr;
     mOwner = nullptr;
+    PerfectHashIndex::Destroy(mMethodIndex.load(std::memory_order_relaxed));
 }
 
 ECode CMetaInterface::GetComponent(
@@ -175,11 +199,9 @@ ECode CMetaInterface::GetMethodNumber(
 ECode CMetaInterface::GetAllMethods(
     /* [out] */ Array<IMetaMethod*>& methods)
 {
-    BuildAllMethods();
-
     Integer N = MIN(mMetaMethods.GetLength(), methods.GetLength());
     for (Integer i = 0; i < N; i++) {
-        methods.Set(i, mMetaMethods[i]);
+        methods.Set(i, BuildMethod(i));
     }
     return NOERROR;
 }
@@ -188,47 +210,64 @@ ECode CMetaInterface::GetMethod(
     /* [in] */ const String& name,
     /* [in] */ const String& signature,
     /* [out] */ IMetaMethod** method)
+{
+    return GetMethod(name.string(), signature.string(), method);
+}
+
+ECode CMetaInterface::GetMethod(
+    /* [in] */ Integer index,
+    /* [out] */ IMetaMethod** method)
 {
     VALIDATE_NOT_NULL(method);
 
-    if (name.IsNullOrEmpty()) {
-        *method = nullptr;
+    BuildMethod(index).MoveTo(method);
+    return NOERROR;
+}
+
+ECode CMetaInterface::GetMethod(
+    /* [in] */ const char* name,
+    /* [in] */ const char* signature,
+    /* [out] */ IMetaMethod** method)
+{
+    VALIDATE_NOT_NULL(method);
+
+    *method = nullptr;
+    if (name == nullptr || name[0] == '\0' || signature == nullptr) {
         return NOERROR;
     }
 
-    BuildAllMethods();
-
-    for (Integer i = 0; i < mMetaMethods.GetLength(); i++) {
-        IMetaMethod* mmObj = mMetaMethods[i];
-        String mmName, mmSignature;
-        mmObj->GetName(&mmName);
-        mmObj->GetSignature(&mmSignature);
-        if (mmName.Equals(name) && mmSignature.Equals(signature)) {
-            *method = mmObj;
-            REFCOUNT_ADD(*method);
+    PerfectHashIndex* index = GetMethodIndex();
+    if (index == nullptr) {
+        return E_OUT_OF_MEMORY_ERROR;
+    }
+    for (Integer entry = index->Find(HashMethod(name, signature));
+            entry != -1; entry = index->GetNext(entry)) {
+        Integer methodIndex = index->GetValue(entry);
+        const char* mmName;
+        const char* mmSignature;
+        if (GetMethodKey(methodIndex, &mmName, &mmSignature) &&
+                strcmp(mmName, name) == 0 && strcmp(mmSignature, signature) == 0) {
+            BuildMethod(methodIndex).MoveTo(method);
             return NOERROR;
         }
     }
-    *method = nullptr;
     return NOERROR;
 }
 
-ECode CMetaInterface::GetMethod(
-    /* [in] */ Integer index,
-    /* [out] */ IMetaMethod** method)
+AutoPtr<IMetaMethod> CMetaInterface::BuildMethod(
+    /* [in] */ Integer index)
 {
-    VALIDATE_NOT_NULL(method);
-
     if (index < 0 || index >= mMetaMethods.GetLength()) {
-        *method = nullptr;
-        return NOERROR;
+        return nullptr;
     }
 
-    BuildAllMethods();
-
-    *method = mMetaMethods[index];
-    REFCOUNT_ADD(*method);
-    return NOERROR;
+    AutoPtr<IMetaMethod> ret = mMetaMethods.Get(index);
+    // The methods of an interface without metadata are all set up front.
+    if (ret == nullptr && mMetadata != nullptr) {
+        ret = mMetaMethods.Publish(index, new CMetaMethod(
+                mOwner->mMetadata, this, index, GetMetaMethod(index)));
+    }
+    return ret;
 }
 
 Integer CMetaInterface::CalculateMethodNumber()
@@ -239,7 +278,7 @@ Integer CMetaInterface::CalculateMethodNumber()
         number += mi->mMethodNumber;
         if (mi->mBaseInterfaceIndex != -1) {
             mi = mOwner->mMetadata->mInterfaces[
-                    mMetadata->mBaseInterfaceIndex];
+                    mi->mBaseInterfaceIndex];
         }
         else {
             mi = nullptr;
@@ -248,6 +287,67 @@ Integer CMetaInterface::CalculateMethodNumber()
     return number;
 }
 
+MetaMethod* CMetaInterface::GetMetaMethod(
+    /* [in] */ Integer index)
+{
+    MetaInterface* mi = mMetadata;
+    Integer startIndex = mMetaMethods.GetLength() - mi->mMethodNumber;
+    while (index < startIndex) {
+        mi = mOwner->mMetadata->mInterfaces[mi->mBaseInterfaceIndex];
+        startIndex -= mi->mMethodNumber;
+    }
+    return mi->mMethods[index - startIndex];
+}
+
+Boolean CMetaInterface::GetMethodKey(
+    /* [in] */ Integer index,
+    /* [out] */ const char** name,
+    /* [out] */ const char** signature)
+{
+    if (mMetadata != nullptr) {
+        MetaMethod* mm = GetMetaMethod(index);
+        *name = mm->mName;
+        *signature = mm->mSignature;
+        return true;
+    }
+
+    CMetaMethod* mmObj = (CMetaMethod*)mMetaMethods.Get(index);
+    if (mmObj == nullptr) {
+        return false;
+    }
+    *name = mmObj->mName.string();
+    *signature = mmObj->mSignature.string();
+    return true;
+}
+
+PerfectHashIndex* CMetaInterface::GetMethodIndex()
+{
+    PerfectHashIndex* index = mMethodIndex.load(std::memory_order_acquire);
+    if (index != nullptr) {
+        return index;
+    }
+
+    Integer N = mMetaMethods.GetLength();
+    unsigned long long* keys = (unsigned long long*)malloc(
+            sizeof(unsigned long long) * (N + 1));
+    Integer* values = (Integer*)malloc(sizeof(Integer) * (N + 1));
+    if (keys != nullptr && values != nullptr) {
+        Integer entryNumber = 0;
+        for (Integer i = 0; i < N; i++) {
+            const char* name;
+            const char* signature;
+            if (GetMethodKey(i, &name, &signature)) {
+                keys[entryNumber] = HashMethod(name, signature);
+                values[entryNumber++] = i;
+            }
+        }
+        index = PerfectHashIndex::Create(keys, values, entryNumber);
+    }
+    free(keys);
+    free(values);
+    return PerfectHashIndex::Publish(mMethodIndex, index);
+}
+
 void CMetaInterface::BuildBaseInterface()
 {
     if (mMetadata->mBaseInterfaceIndex != -1) {
@@ -268,28 +368,4 @@ void CMetaInterface::BuildAllConstants()
     }
 }
 
-void CMetaInterface::BuildAllMethods()
-{
-    if (mMetaMethods[0] == nullptr) {
-        BuildInterfaceMethod(mMetadata);
-    }
-}
-
-Integer CMetaInterface::BuildInterfaceMethod(
-    /* [in] */ MetaInterface* mi)
-{
-    Integer startIndex = 0;
-    if (mi->mBaseInterfaceIndex != -1) {
-        startIndex = BuildInterfaceMethod(mOwner->mMetadata->mInterfaces[
-                mi->mBaseInterfaceIndex]);
-    }
-
-    for (Integer i = 0; i < mi->mMethodNumber; i++) {
-        CMetaMethod* mmObj = new CMetaMethod(mOwner->mMetadata,
-                this, startIndex + i, mi->mMethods[i]);
-        mMetaMethods.Set(startIndex + i, mmObj);
-    }
-    return startIndex + mi->mMethodNumber;
-}
-
 }
@@ -18,10 +18,14 @@
 #define __CCM_CMETAINTERFACE_H__
 
 #include "ccmrefbase.h"
+#include "lazyobjectarray.h"
+#include "perfecthash.h"
 #include "Component.h"
+#include <atomic>
 
 using ccm::metadata::MetaComponent;
 using ccm::metadata::MetaInterface;
+using ccm::metadata::MetaMethod;
 
 namespace ccm {
 
@@ -32,7 +36,8 @@ class CMetaInterface
     , public IMetaInterface
 {
 public:
-    CMetaInterface();
+    explicit CMetaInterface(
+        /* [in] */ Integer methodNumber);
 
     CMetaInterface(
         /* [in] */ CMetaComponent* mcObj,
@@ -87,17 +92,33 @@ public:
         /* [in] */ Integer index,
         /* [out] */ IMetaMethod** method) override;
 
+    // Like GetMethod(String, String), without building Strings for the
+    // arguments or for the methods.
+    ECode GetMethod(
+        /* [in] */ const char* name,
+        /* [in] */ const char* signature,
+        /* [out] */ IMetaMethod** method);
+
+    AutoPtr<IMetaMethod> BuildMethod(
+        /* [in] */ Integer index);
+
 private:
     Integer CalculateMethodNumber();
 
+    MetaMethod* GetMetaMethod(
+        /* [in] */ Integer index);
+
+    Boolean GetMethodKey(
+        /* [in] */ Integer index,
+        /* [out] */ const char** name,
+        /* [out] */ const char** signature);
+
+    PerfectHashIndex* GetMethodIndex();
+
     void BuildBaseInterface();
 
     void BuildAllConstants();
 
-    void BuildAllMethods();
-
-    Integer BuildInterfaceMethod(
-        /* [in] */ MetaInterface* mi);
 
 public:
     MetaInterface* mMetadata;
@@ -107,7 +128,10 @@ public:
     String mNamespace;
     CMetaInterface* mBaseInterface;
     Array<IMetaConstant*> mMetaConstants;
-    Array<IMetaMethod*> mMetaMethods;
+    // The methods of the base interfaces come first.
+    LazyObjectArray<IMetaMethod> mMetaMethods;
+    // From the name and signature of a method to its index.
+    std::atomic<PerfectHashIndex*> mMethodIndex;
 };
 
 }
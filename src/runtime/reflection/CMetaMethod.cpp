@@ -20,6 +20,8 @@
 #include "CMetaMethod.h"
 #include "CMetaParameter.h"
 #include "CMetaType.h"
+#include "ccmlogger.h"
+#include <new>
 
 namespace ccm {
 
@@ -34,11 +36,14 @@ EXTERN_C ECode invoke(
 
 CCM_INTERFACE_IMPL_LIGHT_1(CMetaMethod, LightRefBase, IMetaMethod);
 
-CMetaMethod::CMetaMethod()
+CMetaMethod::CMetaMethod(
+    /* [in] */ Integer parameterNumber)
     : mMetadata(nullptr)
     , mOwner(nullptr)
     , mIndex(0)
-    , mHasOutArguments(false)
+    , mParameters(parameterNumber)
+    , mOneway(false)
+    , mMarshalPlan(nullptr)
 {}
 
 CMetaMethod::CMetaMethod(
@@ -52,7 +57,8 @@ CMetaMethod::CMetaMethod(
     , mName(mm->mName)
     , mSignature(mm->mSignature)
     , mParameters(mMetadata->mParameterNumber)
-    , mHasOutArguments(false)
+    , mOneway(mm->mOneway)
+    , mMarshalPlan(nullptr)
 {
     mReturnType = new CMetaType(mc,
             mc->mTypes[mm->mReturnTypeIndex]);
@@ -62,6 +68,10 @@ CMetaMethod::~CMetaMethod()
 {
     mMetadata = nullptr;
     mOwner = nullptr;
+    MarshalPlan* plan = mMarshalPlan.load(std::memory_order_relaxed);
+    if (plan != nullptr) {
+        free(plan);
+    }
 }
 
 ECode CMetaMethod::GetInterface(
@@ -104,11 +114,9 @@ ECode CMetaMethod::GetParameterNumber(
 ECode CMetaMethod::GetAllParameters(
     /* [out] */ Array<IMetaParameter*>& params)
 {
-    BuildAllParameters();
-
     Integer N = MIN(mParameters.GetLength(), params.GetLength());
     for (Integer i = 0; i < N; i++) {
-        params.Set(i, mParameters[i]);
+        params.Set(i, BuildParameter(i));
     }
     return NOERROR;
 }
@@ -119,15 +127,12 @@ ECode CMetaMethod::GetParameter(
 {
     VALIDATE_NOT_NULL(param);
 
-    if (index < 0 || index >= mMetadata->mParameterNumber) {
+    if (index < 0 || index >= mParameters.GetLength()) {
         *param = nullptr;
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    BuildAllParameters();
-
-    *param = mParameters[index];
-    REFCOUNT_ADD(*param);
+    BuildParameter(index).MoveTo(param);
     return NOERROR;
 }
 
@@ -143,12 +148,11 @@ ECode CMetaMethod::GetParameter(
     }
 
     for (Integer i = 0; i < mParameters.GetLength(); i++) {
-        IMetaParameter* mpObj = mParameters[i];
+        AutoPtr<IMetaParameter> mpObj = BuildParameter(i);
         String mpName;
         mpObj->GetName(&mpName);
         if (name.Equals(mpName)) {
-            *param = mpObj;
-            REFCOUNT_ADD(*param);
+            mpObj.MoveTo(param);
             return NOERROR;
         }
     }
@@ -161,9 +165,24 @@ ECode CMetaMethod::HasOutArguments(
 {
     VALIDATE_NOT_NULL(outArgs);
 
-    BuildAllParameters();
+    *outArgs = false;
+    for (Integer i = 0; i < mParameters.GetLength(); i++) {
+        AutoPtr<IMetaParameter> mpObj = BuildParameter(i);
+        IOAttribute attr = ((CMetaParameter*)mpObj.Get())->mIOAttr;
+        if (attr == IOAttribute::OUT || attr == IOAttribute::IN_OUT) {
+            *outArgs = true;
+            break;
+        }
+    }
+    return NOERROR;
+}
+
+ECode CMetaMethod::IsOneway(
+    /* [out] */ Boolean* oneway)
+{
+    VALIDATE_NOT_NULL(oneway);
 
-    *outArgs = mHasOutArguments;
+    *oneway = mOneway;
     return NOERROR;
 }
 
@@ -178,6 +197,31 @@ ECode CMetaMethod::CreateArgumentList(
     return NOERROR;
 }
 
+static void DestroyArgumentList(
+    /* [in] */ void* object)
+{
+    static_cast<CArgumentList*>(object)->~CArgumentList();
+}
+
+CArgumentList* CMetaMethod::CreateArgumentList(
+    /* [in] */ Arena* arena)
+{
+    void* addr = arena->Alloc<CArgumentList>();
+    if (addr == nullptr) {
+        return nullptr;
+    }
+    CArgumentList* args = new(addr) CArgumentList(
+            mOwner->mOwner->mMetadata, mMetadata, arena);
+    // The list is destroyed when the arena scope ends, the reference
+    // keeps it from being deleted by a Release().
+    args->AddRef();
+    if (!arena->AddCleanup(DestroyArgumentList, args)) {
+        args->~CArgumentList();
+        return nullptr;
+    }
+    return args;
+}
+
 ECode CMetaMethod::Invoke(
     /* [in] */ IInterface* thisObject,
     /* [in] */ IArgumentList* argList)
@@ -203,20 +247,83 @@ ECode CMetaMethod::Invoke(
     return invoke(methodAddr, intData, intDataNum, fpData, fpDataNum, stkData, stkDataNum);
 }
 
-void CMetaMethod::BuildAllParameters()
+MarshalPlan* CMetaMethod::GetMarshalPlan()
 {
-    if (mParameters[0] == nullptr) {
-        for (Integer i = 0; i < mMetadata->mParameterNumber; i++) {
-            CMetaParameter* mpObj = new CMetaParameter(
-                    mOwner->mOwner->mMetadata, this,
-                    mMetadata->mParameters[i], i);
-            mParameters.Set(i, mpObj);
-            if (!mHasOutArguments && (mpObj->mIOAttr == IOAttribute::OUT ||
-                    mpObj->mIOAttr == IOAttribute::IN_OUT)) {
-                mHasOutArguments = true;
-            }
+    MarshalPlan* plan = mMarshalPlan.load(std::memory_order_acquire);
+    if (plan != nullptr) {
+        return plan;
+    }
+
+    plan = BuildMarshalPlan();
+    if (plan == nullptr) {
+        return nullptr;
+    }
+    MarshalPlan* expected = nullptr;
+    if (!mMarshalPlan.compare_exchange_strong(expected, plan,
+            std::memory_order_acq_rel, std::memory_order_acquire)) {
+        // Another thread has published its plan first.
+        free(plan);
+        plan = expected;
+    }
+    return plan;
+}
+
+MarshalPlan* CMetaMethod::BuildMarshalPlan()
+{
+    Integer N = mParameters.GetLength();
+    MarshalPlan* plan = (MarshalPlan*)malloc(
+            sizeof(MarshalPlan) + sizeof(MarshalPlan::Entry) * N);
+    if (plan == nullptr) {
+        Logger::E("CMetaMethod", "Malloc MarshalPlan failed.");
+        return nullptr;
+    }
+    plan->mEntryNumber = N;
+    plan->mHasOutArguments = false;
+    plan->mOneway = mOneway;
+    plan->mStatistics[0].store(nullptr, std::memory_order_relaxed);
+    plan->mStatistics[1].store(nullptr, std::memory_order_relaxed);
+
+    Integer intNum = 1, fpNum = 0;
+    for (Integer i = 0; i < N; i++) {
+        AutoPtr<IMetaParameter> param = BuildParameter(i);
+        CMetaParameter* mpObj = (CMetaParameter*)param.Get();
+        CMetaType* mtObj = (CMetaType*)mpObj->mType.Get();
+        MarshalPlan::Entry& entry = plan->mEntries[i];
+        entry.mKind = mtObj->mKind;
+        entry.mIOAttr = mpObj->mIOAttr;
+        if (entry.mIOAttr == IOAttribute::OUT || entry.mIOAttr == IOAttribute::IN_OUT) {
+            plan->mHasOutArguments = true;
+        }
+        while (mtObj->mKind == CcmTypeKind::Array && mtObj->mElementType != nullptr) {
+            mtObj = (CMetaType*)mtObj->mElementType.Get();
+        }
+        entry.mElementKind = mtObj->mKind;
+        if (entry.mIOAttr == IOAttribute::IN && (entry.mKind == CcmTypeKind::Float ||
+                entry.mKind == CcmTypeKind::Double)) {
+            entry.mRegisterClass = MarshalPlan::RegisterClass::FloatingPoint;
+            entry.mIntIndex = intNum;
+            entry.mFPIndex = fpNum++;
+        }
+        else {
+            entry.mRegisterClass = MarshalPlan::RegisterClass::Integer;
+            entry.mIntIndex = intNum++;
+            entry.mFPIndex = fpNum;
         }
     }
+    return plan;
+}
+
+AutoPtr<IMetaParameter> CMetaMethod::BuildParameter(
+    /* [in] */ Integer index)
+{
+    AutoPtr<IMetaParameter> ret = mParameters.Get(index);
+    // The parameters of a method without metadata are all set up front.
+    if (ret == nullptr && mMetadata != nullptr) {
+        ret = mParameters.Publish(index, new CMetaParameter(
+                mOwner->mOwner->mMetadata, this,
+                mMetadata->mParameters[index], index));
+    }
+    return ret;
 }
 
 }
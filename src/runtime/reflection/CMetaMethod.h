@@ -17,23 +17,62 @@
 #ifndef __CCM_CMETAMETHOD_H__
 #define __CCM_CMETAMETHOD_H__
 
+#include "arena.h"
 #include "ccmautoptr.h"
 #include "ccmrefbase.h"
+#include "lazyobjectarray.h"
 #include "Component.h"
+#include <atomic>
 
 using ccm::metadata::MetaComponent;
 using ccm::metadata::MetaMethod;
 
 namespace ccm {
 
+class CArgumentList;
 class CMetaInterface;
+struct RPCMethodStatistics;
+
+// The flattened parameter layout of a method. It is built once per
+// method and walked by the RPC proxy and stub on every call instead of
+// the reflection objects.
+struct MarshalPlan
+{
+    enum class RegisterClass : Byte
+    {
+        Integer,
+        FloatingPoint
+    };
+
+    struct Entry
+    {
+        CcmTypeKind mKind;
+        // the innermost element kind if mKind is Array, otherwise mKind.
+        CcmTypeKind mElementKind;
+        IOAttribute mIOAttr;
+        RegisterClass mRegisterClass;
+        // the integer and floating-point register slots consumed before
+        // this parameter, counting the "this" pointer.
+        Short mIntIndex;
+        Short mFPIndex;
+    };
+
+    Integer mEntryNumber;
+    Boolean mHasOutArguments;
+    Boolean mOneway;
+    // the RPC statistics of the proxy and of the stub side, set up on
+    // the first recorded invocation.
+    std::atomic<RPCMethodStatistics*> mStatistics[2];
+    Entry mEntries[0];
+};
 
 class CMetaMethod
     : public LightRefBase
     , public IMetaMethod
 {
 public:
-    CMetaMethod();
+    explicit CMetaMethod(
+        /* [in] */ Integer parameterNumber);
 
     CMetaMethod(
         /* [in] */ MetaComponent* mc,
@@ -71,6 +110,9 @@ public:
     ECode HasOutArguments(
         /* [out] */ Boolean* outArgs);
 
+    ECode IsOneway(
+        /* [out] */ Boolean* oneway);
+
     ECode CreateArgumentList(
         /* [out] */ IArgumentList** argList);
 
@@ -78,8 +120,16 @@ public:
         /* [in] */ IInterface* thisObject,
         /* [in] */ IArgumentList* argList);
 
+    MarshalPlan* GetMarshalPlan();
+
+    CArgumentList* CreateArgumentList(
+        /* [in] */ Arena* arena);
+
 private:
-    void BuildAllParameters();
+    AutoPtr<IMetaParameter> BuildParameter(
+        /* [in] */ Integer index);
+
+    MarshalPlan* BuildMarshalPlan();
 
 public:
     MetaMethod* mMetadata;
@@ -87,9 +137,10 @@ public:
     Integer mIndex;
     String mName;
     String mSignature;
-    Array<IMetaParameter*> mParameters;
-    Boolean mHasOutArguments;
+    LazyObjectArray<IMetaParameter> mParameters;
+    Boolean mOneway;
     AutoPtr<IMetaType> mReturnType;
+    std::atomic<MarshalPlan*> mMarshalPlan;
 };
 
 }
@@ -37,6 +37,20 @@ EXTERN_C COM_PUBLIC ECode CoGetCoclassMetadata(
     /* [in] */ IClassLoader* loader,
     /* [in] */ IMetaCoclass** mc);
 
+// Look a method up by name and signature like the GetMethod() of
+// IMetaInterface and IMetaCoclass, without building Strings for them.
+EXTERN_C COM_PUBLIC ECode CoGetInterfaceMethod(
+    /* [in] */ IMetaInterface* intf,
+    /* [in] */ const char* name,
+    /* [in] */ const char* signature,
+    /* [out] */ IMetaMethod** method);
+
+EXTERN_C COM_PUBLIC ECode CoGetCoclassMethod(
+    /* [in] */ IMetaCoclass* klass,
+    /* [in] */ const char* name,
+    /* [in] */ const char* signature,
+    /* [out] */ IMetaMethod** method);
+
 }
 
 #endif // __CCM_CCMREFLECTIONAPI_H__
@@ -18,6 +18,11 @@
 
 namespace ccm {
 
+// Calls |func| the way the System V AMD64 ABI passes arguments: the
+// integer data goes in rdi, rsi, rdx, rcx, r8 and r9, the floating-point
+// data in xmm0-xmm7, and the stack data on the stack with the first item
+// lowest. It is written as a whole function, not as inline assembly, so
+// it does not depend on the frame the compiler builds around it.
 EXTERN_C ECode invoke(
     /* [in] */ HANDLE func,
     /* [in] */ Long* intData,
@@ -25,111 +30,95 @@ EXTERN_C ECode invoke(
     /* [in] */ Double* fpData,
     /* [in] */ Integer fpDataSize,
     /* [in] */ Long* stkData,
-    /* [in] */ Integer stkDataSize)
-{
-    ECode ret;
+    /* [in] */ Integer stkDataSize);
 
-    __asm__ __volatile__(
-        "push   %%rbx;"
-    "push_int_parames:"
-        "mov    %2, %%rax;"
-        "mov    %3, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_fp_params;"
-        "mov    (%%rax), %%rdi;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_fp_params;"
-        "mov    (%%rax), %%rsi;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_fp_params;"
-        "mov    (%%rax), %%rdx;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_fp_params;"
-        "mov    (%%rax), %%rcx;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_fp_params;"
-        "mov    (%%rax), %%r8;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_fp_params;"
-        "mov    (%%rax), %%r9;"
-    "push_fp_params:"
-        "mov    %4, %%rax;"
-        "mov    %5, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_stk_params;"
-        "movsd  (%%rax), %%xmm0;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_stk_params;"
-        "movsd  (%%rax), %%xmm1;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_stk_params;"
-        "movsd  (%%rax), %%xmm2;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_stk_params;"
-        "movsd  (%%rax), %%xmm3;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_stk_params;"
-        "movsd  (%%rax), %%xmm4;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_stk_params;"
-        "movsd  (%%rax), %%xmm5;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_stk_params;"
-        "movsd  (%%rax), %%xmm6;"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "test   %%ebx, %%ebx;"
-        "jz     push_stk_params;"
-        "movsd  (%%rax), %%xmm7;"
-    "push_stk_params:"
-        "mov    %6, %%rax;"
-        "mov    %7, %%ebx;"
-    "push_param:"
-        "test   %%ebx, %%ebx;"
-        "jz     do_call;"
-        "push   (%%rax);"
-        "add    $8, %%rax;"
-        "sub    $1, %%ebx;"
-        "jmp    push_param;"
-    "do_call:"
-        "mov    %1, %%rax;"
-        "call   *%%rax;"
-        "pop    %%rbx;"
-        "mov    %%rbp, %%rsp;"
-        "mov    %%eax, %0;"
-        : "=r" (ret)
-        : "m" (func)
-        , "m" (intData)
-        , "m" (intDataSize)
-        , "m" (fpData)
-        , "m" (fpDataSize)
-        , "m" (stkData)
-        , "m" (stkDataSize)
-    );
-
-    return ret;
-}
+__asm__(
+    ".text;"
+    ".align 16;"
+    ".globl invoke;"
+    ".hidden invoke;"
+    ".type invoke, @function;"
+"invoke:"
+    "push   %rbp;"
+    "mov    %rsp, %rbp;"
+    "push   %rbx;"
+    "push   %r12;"
+    "push   %r13;"
+    "push   %r14;"
+    "mov    %rdi, %r12;"
+    "mov    %rsi, %r13;"
+    "movslq %edx, %r14;"
+    "mov    %rcx, %r10;"
+    "movslq %r8d, %r11;"
+    // Reserve the stack data in 16 bytes steps, which keeps the stack
+    // aligned at the call, and copy it in.
+    "movslq 16(%rbp), %rax;"
+    "lea    15(,%rax,8), %rbx;"
+    "and    $-16, %rbx;"
+    "sub    %rbx, %rsp;"
+    "xor    %ebx, %ebx;"
+"1:"
+    "cmp    %rax, %rbx;"
+    "jge    2f;"
+    "mov    (%r9,%rbx,8), %rcx;"
+    "mov    %rcx, (%rsp,%rbx,8);"
+    "inc    %rbx;"
+    "jmp    1b;"
+"2:"
+    "cmp    $1, %r11;"
+    "jl     3f;"
+    "movsd  (%r10), %xmm0;"
+    "cmp    $2, %r11;"
+    "jl     3f;"
+    "movsd  8(%r10), %xmm1;"
+    "cmp    $3, %r11;"
+    "jl     3f;"
+    "movsd  16(%r10), %xmm2;"
+    "cmp    $4, %r11;"
+    "jl     3f;"
+    "movsd  24(%r10), %xmm3;"
+    "cmp    $5, %r11;"
+    "jl     3f;"
+    "movsd  32(%r10), %xmm4;"
+    "cmp    $6, %r11;"
+    "jl     3f;"
+    "movsd  40(%r10), %xmm5;"
+    "cmp    $7, %r11;"
+    "jl     3f;"
+    "movsd  48(%r10), %xmm6;"
+    "cmp    $8, %r11;"
+    "jl     3f;"
+    "movsd  56(%r10), %xmm7;"
+"3:"
+    "cmp    $1, %r14;"
+    "jl     4f;"
+    "mov    (%r13), %rdi;"
+    "cmp    $2, %r14;"
+    "jl     4f;"
+    "mov    8(%r13), %rsi;"
+    "cmp    $3, %r14;"
+    "jl     4f;"
+    "mov    16(%r13), %rdx;"
+    "cmp    $4, %r14;"
+    "jl     4f;"
+    "mov    24(%r13), %rcx;"
+    "cmp    $5, %r14;"
+    "jl     4f;"
+    "mov    32(%r13), %r8;"
+    "cmp    $6, %r14;"
+    "jl     4f;"
+    "mov    40(%r13), %r9;"
+"4:"
+    "mov    %r11d, %eax;"
+    "call   *%r12;"
+    "lea    -32(%rbp), %rsp;"
+    "pop    %r14;"
+    "pop    %r13;"
+    "pop    %r12;"
+    "pop    %rbx;"
+    "pop    %rbp;"
+    "ret;"
+    ".size invoke, .-invoke;"
+);
 
 }
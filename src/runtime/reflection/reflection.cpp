@@ -17,15 +17,15 @@
 #include "ccmcomponent.h"
 #include "ccmlogger.h"
 #include "ccmreflectionapi.h"
+#include "CMetaCoclass.h"
 #include "CMetaComponent.h"
+#include "CMetaInterface.h"
 #include "Component.h"
 #include "CBootClassLoader.h"
-#include "MetaSerializer.h"
 #include <dlfcn.h>
 #include <errno.h>
 
 using ccm::metadata::MetaComponent;
-using ccm::metadata::MetaSerializer;
 
 namespace ccm {
 
@@ -82,6 +82,13 @@ ECode CoGetComponentMetadataFromFile(
         return E_COMPONENT_IO_EXCEPTION;
     }
 
+    MetaComponent* mmc = reinterpret_cast<MetaComponent*>(metadata->mMetadata);
+    if (mmc->mMagic != CCM_MAGIC || mmc->mVersion != CCM_METADATA_VERSION) {
+        Logger::E("CCMRT", "The metadata of component is bad or its "
+                "version is not supported.");
+        return E_COMPONENT_IO_EXCEPTION;
+    }
+
     CcmComponent* ccmComp = (CcmComponent*)malloc(sizeof(CcmComponent));
     if (ccmComp == nullptr) {
         Logger::E("CCMRT", "Malloc CcmComponent failed.");
@@ -91,23 +98,21 @@ ECode CoGetComponentMetadataFromFile(
     ccmComp->mSoGetClassObject = getFunc;
     ccmComp->mSoGetAllClassObjects = getAllFunc;
     ccmComp->mSoCanUnload = canFunc;
+    ccmComp->mSoReleaseCaches = (ReleaseCachesPtr)dlsym(handle, "soReleaseCaches");
     ccmComp->mMetadataWrapper = metadata;
 
-    MetaComponent* mmc = reinterpret_cast<MetaComponent*>(
-            ccmComp->mMetadataWrapper->mMetadata);
-
-    void* data = malloc(mmc->mSize);
-    if (data == nullptr) {
-        Logger::E("CCMRT", "Malloc %d size metadata failed.", mmc->mSize);
+    // The metadata is read where the component is mapped, so the metadata
+    // object keeps the mapping with a reference of its own. Unloading the
+    // component then only drops the loader's reference.
+    Dl_info info;
+    void* soHandle = dladdr(mmc, &info) != 0 ?
+            dlopen(info.dli_fname, RTLD_NOW | RTLD_NOLOAD) : nullptr;
+    if (soHandle == nullptr) {
+        Logger::E("CCMRT", "Dlopen the component of the metadata failed.");
         free(ccmComp);
-        *mc = nullptr;
-        return E_OUT_OF_MEMORY_ERROR;
+        return E_COMPONENT_IO_EXCEPTION;
     }
-    memcpy(data, mmc, mmc->mSize);
-
-    MetaSerializer serializer;
-    serializer.Deserialize(reinterpret_cast<uintptr_t>(data));
-    *mc = new CMetaComponent(loader, ccmComp, (MetaComponent*)data);
+    *mc = new CMetaComponent(loader, ccmComp, mmc, soHandle);
     REFCOUNT_ADD(*mc);
     return NOERROR;
 }
@@ -132,4 +137,26 @@ ECode CoGetCoclassMetadata(
     return component->GetCoclass(cid, mc);
 }
 
+ECode CoGetInterfaceMethod(
+    /* [in] */ IMetaInterface* intf,
+    /* [in] */ const char* name,
+    /* [in] */ const char* signature,
+    /* [out] */ IMetaMethod** method)
+{
+    VALIDATE_NOT_NULL(intf);
+
+    return static_cast<CMetaInterface*>(intf)->GetMethod(name, signature, method);
+}
+
+ECode CoGetCoclassMethod(
+    /* [in] */ IMetaCoclass* klass,
+    /* [in] */ const char* name,
+    /* [in] */ const char* signature,
+    /* [out] */ IMetaMethod** method)
+{
+    VALIDATE_NOT_NULL(klass);
+
+    return static_cast<CMetaCoclass*>(klass)->GetMethod(name, signature, method);
+}
+
 }
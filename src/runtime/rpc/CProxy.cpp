@@ -32,6 +32,10 @@
 
 #include "ccmrpc.h"
 #include "CProxy.h"
+#include "invocationfuture.h"
+#include "rpcstatistics.h"
+#include "threadpoolexecutor.h"
+#include "reflection/CMetaMethod.h"
 #include "util/ccmlogger.h"
 #include <sys/mman.h>
 
@@ -47,39 +51,11 @@ namespace ccm {
 #define PAGE_ALIGN(va) (((va) + PAGE_SIZE - 1) & PAGE_MASK)
 #endif
 
-#define GET_REG(reg, var)       \
-    __asm__ __volatile__(       \
-        "mov    %%"#reg", %0;"  \
-        : "=m"(var)             \
-    )
-
-#define GET_XREG(reg, var)      \
-    __asm__ __volatile__(       \
-        "movsd  %%"#reg", %0;"  \
-        : "=m"(var)             \
-    )
-
-#define GET_RBP(var)                \
-    __asm__ __volatile__(           \
-        "mov    (%%rbp), %%rax;"    \
-        "mov    %%rax, %0;"         \
-        : "=m"(var)                 \
-    );
-
-#define GET_STACK(rsp, off, var)        \
-    __asm__ __volatile__(               \
-        "mov    %1, %%rax;"             \
-        "mov    %2, %%ebx;"             \
-        "add    %%rbx, %%rax;"          \
-        "mov    (%%rax), %%rax;"        \
-        "mov    %%rax, %0;"             \
-        : "=m"(var)                     \
-        : "m"(rsp)                      \
-        , "m"(off)                      \
-    )
-
 EXTERN_C void __entry();
 
+// Each proxy method slot runs a copy of __entry, which puts the method
+// index in eax and calls the mProxyEntry of the InterfaceProxy, that is
+// __proxy_entry. rbx is callee-saved, so it is not used for the index.
 __asm__ __volatile__(
     ".text;"
     ".align 8;"
@@ -87,12 +63,59 @@ __asm__ __volatile__(
     "__entry:"
     "push   %rbp;"
     "mov    %rsp, %rbp;"
-    "mov    $0xff, %ebx;"
+    "mov    $0xff, %eax;"
     "call   *8(%rdi);"
     "leaveq;"
     "ret;"
 );
 
+EXTERN_C void __proxy_entry();
+
+EXTERN_C COM_LOCAL ECode __proxy_dispatch(
+    /* [in] */ InterfaceProxy* thisObj,
+    /* [in] */ Integer methodIndex,
+    /* [in] */ InterfaceProxy::Registers* regs)
+{
+    return InterfaceProxy::ProxyEntry(thisObj, methodIndex, regs);
+}
+
+// Saves the argument registers in a Registers on the stack before any
+// compiled code can touch them, and passes them to __proxy_dispatch.
+// The stack is 16 bytes aligned at the call.
+__asm__(
+    ".text;"
+    ".align 16;"
+    ".globl __proxy_entry;"
+    ".hidden __proxy_entry;"
+    ".type __proxy_entry, @function;"
+"__proxy_entry:"
+    "push   %rbp;"
+    "mov    %rsp, %rbp;"
+    "sub    $128, %rsp;"
+    "mov    (%rbp), %r10;"
+    "mov    %r10, (%rsp);"
+    "mov    %rdi, 8(%rsp);"
+    "mov    %rsi, 16(%rsp);"
+    "mov    %rdx, 24(%rsp);"
+    "mov    %rcx, 32(%rsp);"
+    "mov    %r8, 40(%rsp);"
+    "mov    %r9, 48(%rsp);"
+    "movsd  %xmm0, 56(%rsp);"
+    "movsd  %xmm1, 64(%rsp);"
+    "movsd  %xmm2, 72(%rsp);"
+    "movsd  %xmm3, 80(%rsp);"
+    "movsd  %xmm4, 88(%rsp);"
+    "movsd  %xmm5, 96(%rsp);"
+    "movsd  %xmm6, 104(%rsp);"
+    "movsd  %xmm7, 112(%rsp);"
+    "mov    %eax, %esi;"
+    "mov    %rsp, %rdx;"
+    "call   __proxy_dispatch;"
+    "leave;"
+    "ret;"
+    ".size __proxy_entry, .-__proxy_entry;"
+);
+
 HANDLE PROXY_ENTRY = 0;
 
 static constexpr Integer PROXY_ENTRY_SIZE = 16;
@@ -183,90 +206,157 @@ ECode InterfaceProxy::S_GetInterfaceID(
     return thisObj->mOwner->GetInterfaceID(object, iid);
 }
 
+// The arguments of a call through the vtable, as the proxy entry saved
+// them from the registers and the stack.
+class InterfaceProxy::RegisterArguments
+{
+public:
+    RegisterArguments(
+        /* [in] */ Registers& regs)
+        : mRegs(regs)
+    {}
+
+    inline Long GetLongValue(
+        /* [in] */ Integer index,
+        /* [in] */ const MarshalPlan::Entry& entry)
+    {
+        return InterfaceProxy::GetLongValue(mRegs, entry.mIntIndex, entry.mFPIndex);
+    }
+
+    inline Double GetDoubleValue(
+        /* [in] */ Integer index,
+        /* [in] */ const MarshalPlan::Entry& entry)
+    {
+        return InterfaceProxy::GetDoubleValue(mRegs, entry.mIntIndex, entry.mFPIndex);
+    }
+
+    inline HANDLE GetValueAddress(
+        /* [in] */ Integer index,
+        /* [in] */ const MarshalPlan::Entry& entry)
+    {
+        return InterfaceProxy::GetValueAddress(mRegs, entry.mIntIndex, entry.mFPIndex);
+    }
+
+private:
+    Registers& mRegs;
+};
+
+// The arguments of a call through IProxy::InvokeAsync. An argument list
+// keeps the [in] values in the same form as the registers do, and the
+// addresses of the caller's variables for the others.
+class InterfaceProxy::ListArguments
+{
+public:
+    ListArguments(
+        /* [in] */ IArgumentList* argList)
+        : mArgList(argList)
+    {}
+
+    inline Long GetLongValue(
+        /* [in] */ Integer index,
+        /* [in] */ const MarshalPlan::Entry& entry)
+    {
+        HANDLE value = 0;
+        mArgList->GetArgumentAddress(index, &value);
+        return static_cast<Long>(value);
+    }
+
+    inline Double GetDoubleValue(
+        /* [in] */ Integer index,
+        /* [in] */ const MarshalPlan::Entry& entry)
+    {
+        Double value = 0;
+        mArgList->GetInputArgumentOfDouble(index, &value);
+        return value;
+    }
+
+    inline HANDLE GetValueAddress(
+        /* [in] */ Integer index,
+        /* [in] */ const MarshalPlan::Entry& entry)
+    {
+        HANDLE addr = 0;
+        mArgList->GetArgumentAddress(index, &addr);
+        return addr;
+    }
+
+private:
+    IArgumentList* mArgList;
+};
+
+template<typename Arguments>
 ECode InterfaceProxy::MarshalArguments(
-    /* [in] */ Registers& regs,
+    /* [in] */ Arguments& args,
     /* [in] */ IMetaMethod* method,
     /* [in] */ IParcel* argParcel)
 {
-    Integer N;
-    method->GetParameterNumber(&N);
-    Integer intNum = 1, fpNum = 0;
-    for (Integer i = 0; i < N; i++) {
-        AutoPtr<IMetaParameter> param;
-        method->GetParameter(i, &param);
-        AutoPtr<IMetaType> type;
-        param->GetType(&type);
-        CcmTypeKind kind;
-        type->GetTypeKind((Integer*)&kind);
-        IOAttribute ioAttr;
-        param->GetIOAttribute(&ioAttr);
+    MarshalPlan* plan = ((CMetaMethod*)method)->GetMarshalPlan();
+    if (plan == nullptr) {
+        return E_OUT_OF_MEMORY_ERROR;
+    }
+
+    for (Integer i = 0; i < plan->mEntryNumber; i++) {
+        const MarshalPlan::Entry& entry = plan->mEntries[i];
+        CcmTypeKind kind = entry.mKind;
+        IOAttribute ioAttr = entry.mIOAttr;
         if (ioAttr == IOAttribute::IN) {
             switch (kind) {
                 case CcmTypeKind::Char: {
-                    Char value = (Char)GetLongValue(regs, intNum++, fpNum);
+                    Char value = (Char)args.GetLongValue(i, entry);
                     argParcel->WriteChar(value);
                     break;
                 }
                 case CcmTypeKind::Byte: {
-                    Byte value = (Byte)GetLongValue(regs, intNum++, fpNum);
+                    Byte value = (Byte)args.GetLongValue(i, entry);
                     argParcel->WriteByte(value);
                     break;
                 }
                 case CcmTypeKind::Short: {
-                    Short value = (Short)GetLongValue(regs, intNum++, fpNum);
+                    Short value = (Short)args.GetLongValue(i, entry);
                     argParcel->WriteShort(value);
                     break;
                 }
                 case CcmTypeKind::Integer: {
-                    Integer value = (Integer)GetLongValue(regs, intNum++, fpNum);
+                    Integer value = (Integer)args.GetLongValue(i, entry);
                     argParcel->WriteInteger(value);
                     break;
                 }
                 case CcmTypeKind::Long: {
-                    Long value = GetLongValue(regs, intNum++, fpNum);
+                    Long value = args.GetLongValue(i, entry);
                     argParcel->WriteLong(value);
                     break;
                 }
                 case CcmTypeKind::Float: {
-                    Float value = (Float)GetDoubleValue(regs, intNum, fpNum++);
+                    Float value = (Float)args.GetDoubleValue(i, entry);
                     argParcel->WriteFloat(value);
                     break;
                 }
                 case CcmTypeKind::Double: {
-                    Double value = GetDoubleValue(regs, intNum, fpNum++);
+                    Double value = args.GetDoubleValue(i, entry);
                     argParcel->WriteDouble(value);
                     break;
                 }
                 case CcmTypeKind::Boolean: {
-                    Boolean value = (Boolean)GetLongValue(regs, intNum++, fpNum);
+                    Boolean value = (Boolean)args.GetLongValue(i, entry);
                     argParcel->WriteBoolean(value);
                     break;
                 }
                 case CcmTypeKind::String: {
-                    String value = *reinterpret_cast<String*>(GetLongValue(regs, intNum++, fpNum));
+                    String value = *reinterpret_cast<String*>(args.GetLongValue(i, entry));
                     argParcel->WriteString(value);
                     break;
                 }
                 case CcmTypeKind::ECode: {
-                    ECode value = (ECode)GetLongValue(regs, intNum++, fpNum);
+                    ECode value = (ECode)args.GetLongValue(i, entry);
                     argParcel->WriteECode(value);
                     break;
                 }
                 case CcmTypeKind::Enum: {
-                    Integer value = (Integer)GetLongValue(regs, intNum++, fpNum);
+                    Integer value = (Integer)args.GetLongValue(i, entry);
                     argParcel->WriteEnumeration(value);
                     break;
                 }
                 case CcmTypeKind::Array: {
-                    AutoPtr<IMetaType> aType, eType;
-                    eType = type;
-                    CcmTypeKind eKind = kind;
-                    while (eKind == CcmTypeKind::Array) {
-                        aType = eType;
-                        eType = nullptr;
-                        aType->GetElementType(&eType);
-                        eType->GetTypeKind((Integer*)&eKind);
-                    }
+                    CcmTypeKind eKind = entry.mElementKind;
                     if (eKind == CcmTypeKind::CoclassID ||
                             eKind == CcmTypeKind::ComponentID ||
                             eKind == CcmTypeKind::InterfaceID ||
@@ -275,12 +365,12 @@ ECode InterfaceProxy::MarshalArguments(
                         return E_ILLEGAL_ARGUMENT_EXCEPTION;
                     }
 
-                    HANDLE value = (HANDLE)GetLongValue(regs, intNum++, fpNum);
+                    HANDLE value = (HANDLE)args.GetLongValue(i, entry);
                     argParcel->WriteArray(value);
                     break;
                 }
                 case CcmTypeKind::Interface: {
-                    IInterface* value = reinterpret_cast<IInterface*>(GetLongValue(regs, intNum++, fpNum));
+                    IInterface* value = reinterpret_cast<IInterface*>(args.GetLongValue(i, entry));
                     argParcel->WriteInterface(value);
                     break;
                 }
@@ -297,70 +387,62 @@ ECode InterfaceProxy::MarshalArguments(
         else if (ioAttr == IOAttribute::IN_OUT) {
             switch (kind) {
                 case CcmTypeKind::Char: {
-                    Char* value = reinterpret_cast<Char*>(GetLongValue(regs, intNum++, fpNum));
+                    Char* value = reinterpret_cast<Char*>(args.GetLongValue(i, entry));
                     argParcel->WriteChar(*value);
                     break;
                 }
                 case CcmTypeKind::Byte: {
-                    Byte* value = reinterpret_cast<Byte*>(GetLongValue(regs, intNum++, fpNum));
+                    Byte* value = reinterpret_cast<Byte*>(args.GetLongValue(i, entry));
                     argParcel->WriteByte(*value);
                     break;
                 }
                 case CcmTypeKind::Short: {
-                    Short* value = reinterpret_cast<Short*>(GetLongValue(regs, intNum++, fpNum));
+                    Short* value = reinterpret_cast<Short*>(args.GetLongValue(i, entry));
                     argParcel->WriteShort(*value);
                     break;
                 }
                 case CcmTypeKind::Integer: {
-                    Integer* value = reinterpret_cast<Integer*>(GetLongValue(regs, intNum++, fpNum));
+                    Integer* value = reinterpret_cast<Integer*>(args.GetLongValue(i, entry));
                     argParcel->WriteInteger(*value);
                     break;
                 }
                 case CcmTypeKind::Long: {
-                    Long* value = reinterpret_cast<Long*>(GetLongValue(regs, intNum++, fpNum));
+                    Long* value = reinterpret_cast<Long*>(args.GetLongValue(i, entry));
                     argParcel->WriteLong(*value);
                     break;
                 }
                 case CcmTypeKind::Float: {
-                    Float* value = reinterpret_cast<Float*>(GetLongValue(regs, intNum++, fpNum));
+                    Float* value = reinterpret_cast<Float*>(args.GetLongValue(i, entry));
                     argParcel->WriteFloat(*value);
                     break;
                 }
                 case CcmTypeKind::Double: {
-                    Double* value = reinterpret_cast<Double*>(GetLongValue(regs, intNum++, fpNum));
+                    Double* value = reinterpret_cast<Double*>(args.GetLongValue(i, entry));
                     argParcel->WriteDouble(*value);
                     break;
                 }
                 case CcmTypeKind::Boolean: {
-                    Boolean* value = reinterpret_cast<Boolean*>(GetLongValue(regs, intNum++, fpNum));
+                    Boolean* value = reinterpret_cast<Boolean*>(args.GetLongValue(i, entry));
                     argParcel->WriteBoolean(*value);
                     break;
                 }
                 case CcmTypeKind::String: {
-                    String* value = reinterpret_cast<String*>(GetLongValue(regs, intNum++, fpNum));
+                    String* value = reinterpret_cast<String*>(args.GetLongValue(i, entry));
                     argParcel->WriteString(*value);
                     break;
                 }
                 case CcmTypeKind::ECode: {
-                    ECode* value = reinterpret_cast<ECode*>(GetLongValue(regs, intNum++, fpNum));
+                    ECode* value = reinterpret_cast<ECode*>(args.GetLongValue(i, entry));
                     argParcel->WriteECode(*value);
                     break;
                 }
                 case CcmTypeKind::Enum: {
-                    Integer* value = reinterpret_cast<Integer*>(GetLongValue(regs, intNum++, fpNum));
+                    Integer* value = reinterpret_cast<Integer*>(args.GetLongValue(i, entry));
                     argParcel->WriteInteger(*value);
                     break;
                 }
                 case CcmTypeKind::Array: {
-                    AutoPtr<IMetaType> aType, eType;
-                    eType = type;
-                    CcmTypeKind eKind = kind;
-                    while (eKind == CcmTypeKind::Array) {
-                        aType = eType;
-                        eType = nullptr;
-                        aType->GetElementType(&eType);
-                        eType->GetTypeKind((Integer*)&eKind);
-                    }
+                    CcmTypeKind eKind = entry.mElementKind;
                     if (eKind == CcmTypeKind::CoclassID ||
                             eKind == CcmTypeKind::ComponentID ||
                             eKind == CcmTypeKind::InterfaceID ||
@@ -369,12 +451,12 @@ ECode InterfaceProxy::MarshalArguments(
                         return E_ILLEGAL_ARGUMENT_EXCEPTION;
                     }
 
-                    HANDLE value = (HANDLE)GetLongValue(regs, intNum++, fpNum);
+                    HANDLE value = (HANDLE)args.GetLongValue(i, entry);
                     argParcel->WriteArray(value);
                     break;
                 }
                 case CcmTypeKind::Interface: {
-                    IInterface** value = reinterpret_cast<IInterface**>(GetLongValue(regs, intNum++, fpNum));
+                    IInterface** value = reinterpret_cast<IInterface**>(args.GetLongValue(i, entry));
                     argParcel->WriteInterface(*value);
                     break;
                 }
@@ -402,18 +484,9 @@ ECode InterfaceProxy::MarshalArguments(
                 case CcmTypeKind::ECode:
                 case CcmTypeKind::Enum:
                 case CcmTypeKind::Interface:
-                    intNum++;
                     break;
                 case CcmTypeKind::Array: {
-                    AutoPtr<IMetaType> aType, eType;
-                    eType = type;
-                    CcmTypeKind eKind = kind;
-                    while (eKind == CcmTypeKind::Array) {
-                        aType = eType;
-                        eType = nullptr;
-                        aType->GetElementType(&eType);
-                        eType->GetTypeKind((Integer*)&eKind);
-                    }
+                    CcmTypeKind eKind = entry.mElementKind;
                     if (eKind == CcmTypeKind::CoclassID ||
                             eKind == CcmTypeKind::ComponentID ||
                             eKind == CcmTypeKind::InterfaceID ||
@@ -421,8 +494,6 @@ ECode InterfaceProxy::MarshalArguments(
                         Logger::E("CProxy", "Invalid [out] Array(%d), param index: %d.\n", eKind, i);
                         return E_ILLEGAL_ARGUMENT_EXCEPTION;
                     }
-
-                    intNum++;
                     break;
                 }
                 case CcmTypeKind::CoclassID:
@@ -438,15 +509,7 @@ ECode InterfaceProxy::MarshalArguments(
         else if (ioAttr == IOAttribute::OUT_CALLEE) {
             switch (kind) {
                 case CcmTypeKind::Array: {
-                    AutoPtr<IMetaType> aType, eType;
-                    eType = type;
-                    CcmTypeKind eKind = kind;
-                    while (eKind == CcmTypeKind::Array) {
-                        aType = eType;
-                        eType = nullptr;
-                        aType->GetElementType(&eType);
-                        eType->GetTypeKind((Integer*)&eKind);
-                    }
+                    CcmTypeKind eKind = entry.mElementKind;
                     if (eKind == CcmTypeKind::CoclassID ||
                             eKind == CcmTypeKind::ComponentID ||
                             eKind == CcmTypeKind::InterfaceID ||
@@ -454,8 +517,6 @@ ECode InterfaceProxy::MarshalArguments(
                         Logger::E("CProxy", "Invalid [out, callee] Array(%d), param index: %d.\n", eKind, i);
                         return E_ILLEGAL_ARGUMENT_EXCEPTION;
                     }
-
-                    intNum++;
                     break;
                 }
                 case CcmTypeKind::Char:
@@ -485,23 +546,21 @@ ECode InterfaceProxy::MarshalArguments(
     return NOERROR;
 }
 
+template<typename Arguments>
 ECode InterfaceProxy::UnmarshalResults(
-        /* [in] */ Registers& regs,
-        /* [in] */ IMetaMethod* method,
-        /* [in] */ IParcel* resParcel)
-{
-    Integer N;
-    method->GetParameterNumber(&N);
-    Integer intNum = 1, fpNum = 0;
-    for (Integer i = 0; i < N; i++) {
-        AutoPtr<IMetaParameter> param;
-        method->GetParameter(i, &param);
-        AutoPtr<IMetaType> type;
-        param->GetType(&type);
-        CcmTypeKind kind;
-        type->GetTypeKind((Integer*)&kind);
-        IOAttribute ioAttr;
-        param->GetIOAttribute(&ioAttr);
+    /* [in] */ Arguments& args,
+    /* [in] */ IMetaMethod* method,
+    /* [in] */ IParcel* resParcel)
+{
+    MarshalPlan* plan = ((CMetaMethod*)method)->GetMarshalPlan();
+    if (plan == nullptr) {
+        return E_OUT_OF_MEMORY_ERROR;
+    }
+
+    for (Integer i = 0; i < plan->mEntryNumber; i++) {
+        const MarshalPlan::Entry& entry = plan->mEntries[i];
+        CcmTypeKind kind = entry.mKind;
+        IOAttribute ioAttr = entry.mIOAttr;
         if (ioAttr == IOAttribute::IN) {
             switch (kind) {
                 case CcmTypeKind::Char:
@@ -515,11 +574,8 @@ ECode InterfaceProxy::UnmarshalResults(
                 case CcmTypeKind::Enum:
                 case CcmTypeKind::Array:
                 case CcmTypeKind::Interface:
-                    intNum++;
-                    break;
                 case CcmTypeKind::Float:
                 case CcmTypeKind::Double:
-                    fpNum++;
                     break;
                 case CcmTypeKind::CoclassID:
                 case CcmTypeKind::ComponentID:
@@ -535,79 +591,79 @@ ECode InterfaceProxy::UnmarshalResults(
             switch (kind) {
                 case CcmTypeKind::Char: {
                     Char* addr = reinterpret_cast<Char*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadChar(addr);
                     break;
                 }
                 case CcmTypeKind::Byte: {
                     Byte* addr = reinterpret_cast<Byte*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadByte(addr);
                     break;
                 }
                 case CcmTypeKind::Short: {
                     Short* addr = reinterpret_cast<Short*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadShort(addr);
                     break;
                 }
                 case CcmTypeKind::Integer: {
                     Integer* addr = reinterpret_cast<Integer*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadInteger(addr);
                     break;
                 }
                 case CcmTypeKind::Long: {
                     Long* addr = reinterpret_cast<Long*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadLong(addr);
                     break;
                 }
                 case CcmTypeKind::Float: {
                     Float* addr = reinterpret_cast<Float*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadFloat(addr);
                     break;
                 }
                 case CcmTypeKind::Double: {
                     Double* addr = reinterpret_cast<Double*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadDouble(addr);
                     break;
                 }
                 case CcmTypeKind::Boolean: {
                     Boolean* addr = reinterpret_cast<Boolean*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadBoolean(addr);
                     break;
                 }
                 case CcmTypeKind::String: {
                     String* addr = reinterpret_cast<String*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadString(addr);
                     break;
                 }
                 case CcmTypeKind::ECode: {
                     ECode* addr = reinterpret_cast<ECode*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadECode(addr);
                     break;
                 }
                 case CcmTypeKind::Enum: {
                     Integer* addr = reinterpret_cast<Integer*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadEnumeration(addr);
                     break;
                 }
                 case CcmTypeKind::Array: {
                     Triple* t = reinterpret_cast<Triple*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadArray(reinterpret_cast<HANDLE>(t));
                     break;
                 }
                 case CcmTypeKind::Interface: {
                     IInterface** intf = reinterpret_cast<IInterface**>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadInterface(intf);
                     break;
                 }
@@ -625,7 +681,7 @@ ECode InterfaceProxy::UnmarshalResults(
             switch (kind) {
                 case CcmTypeKind::Array: {
                     Triple* t = reinterpret_cast<Triple*>(
-                            GetValueAddress(regs, intNum++, fpNum));
+                            args.GetValueAddress(i, entry));
                     resParcel->ReadArray(reinterpret_cast<HANDLE>(t));
                     break;
                 }
@@ -674,11 +730,9 @@ Long InterfaceProxy::GetLongValue(
         case 5:
             return regs.r9;
         default: {
-            Long val;
             Integer off = fpIndex <= 7 ? (intIndex - 5 + 1) * 8 :
                     (intIndex - 5 + fpIndex - 8 + 1) * 8;
-            GET_STACK(regs.rbp, off, val);
-            return val;
+            return *reinterpret_cast<Long*>(regs.rbp + off);
         }
     }
 }
@@ -706,11 +760,9 @@ Double InterfaceProxy::GetDoubleValue(
         case 7:
             return regs.xmm7;
         default: {
-            Double val;
             Integer off = intIndex <= 5 ? (fpIndex - 7 + 1) * 8 :
                     (fpIndex - 7 + intIndex - 6 + 1) * 8;
-            GET_STACK(regs.rbp, off, val);
-            return val;
+            return *reinterpret_cast<Double*>(regs.rbp + off);
         }
     }
 }
@@ -734,42 +786,18 @@ HANDLE InterfaceProxy::GetValueAddress(
         case 5:
             return static_cast<HANDLE>(regs.r9);
         default: {
-            Long val;
             Integer off = fpIndex <= 7 ? (intIndex - 5 + 1) * 8 :
                     (intIndex - 5 + fpIndex - 8 + 1) * 8;
-            GET_STACK(regs.rbp, off, val);
-            return static_cast<HANDLE>(val);
+            return *reinterpret_cast<HANDLE*>(regs.rbp + off);
         }
     }
 }
 
 ECode InterfaceProxy::ProxyEntry(
-    /* [in] */ HANDLE args)
+    /* [in] */ InterfaceProxy* thisObj,
+    /* [in] */ Integer methodIndex,
+    /* [in] */ Registers* regs)
 {
-    InterfaceProxy* thisObj = reinterpret_cast<InterfaceProxy*>(args);
-
-    Integer methodIndex;
-    GET_REG(ebx, methodIndex);
-
-    Registers regs;
-    GET_RBP(regs.rbp);
-
-    GET_REG(rdi, regs.rdi);
-    GET_REG(rsi, regs.rsi);
-    GET_REG(rdx, regs.rdx);
-    GET_REG(rcx, regs.rcx);
-    GET_REG(r8, regs.r8);
-    GET_REG(r9, regs.r9);
-
-    GET_XREG(xmm0, regs.xmm0);
-    GET_XREG(xmm1, regs.xmm1);
-    GET_XREG(xmm2, regs.xmm2);
-    GET_XREG(xmm3, regs.xmm3);
-    GET_XREG(xmm4, regs.xmm4);
-    GET_XREG(xmm5, regs.xmm5);
-    GET_XREG(xmm6, regs.xmm6);
-    GET_XREG(xmm7, regs.xmm7);
-
     if (DEBUG) {
         String name, ns;
         thisObj->mTargetMetadata->GetName(&name);
@@ -791,21 +819,37 @@ ECode InterfaceProxy::ProxyEntry(
 
     RPCType type;
     thisObj->mOwner->mChannel->GetRPCType(&type);
+    RPCStatistics::Recorder recorder(method, RPCMethodStatistics::PROXY);
     AutoPtr<IParcel> inParcel, outParcel;
     CoCreateParcel(type, &inParcel);
     inParcel->WriteInteger(RPC_MAGIC_NUMBER);
     inParcel->WriteInteger(thisObj->mIndex);
     inParcel->WriteInteger(methodIndex + 4);
-    ECode ec = thisObj->MarshalArguments(regs, method, inParcel);
+    RegisterArguments arguments(*regs);
+    ECode ec = MarshalArguments(arguments, method, inParcel);
     if (FAILED(ec)) goto ProxyExit;
-
-    ec = thisObj->mOwner->mChannel->Invoke(
-            thisObj->mOwner, method, inParcel, &outParcel);
+    recorder.Mark(RPCMethodStatistics::MARSHAL);
+
+    {
+        // Waiting for the reply, a pool worker leaves its place to the
+        // calls nested in this one.
+        ThreadPoolExecutor::BlockingScope blocking;
+        ec = thisObj->mOwner->mChannel->Invoke(
+                thisObj->mOwner, method, inParcel, &outParcel);
+    }
     if (FAILED(ec)) goto ProxyExit;
+    recorder.Mark(RPCMethodStatistics::TRANSPORT);
+
+    if (((CMetaMethod*)method.Get())->mOneway) {
+        // nothing comes back from a [oneway] method.
+        goto ProxyExit;
+    }
 
-    ec = thisObj->UnmarshalResults(regs, method, outParcel);
+    ec = UnmarshalResults(arguments, method, outParcel);
+    recorder.Mark(RPCMethodStatistics::UNMARSHAL);
 
 ProxyExit:
+    recorder.Finish(ec, inParcel, outParcel);
     if (DEBUG) {
         Logger::D("CProxy", "Exit ProxyEntry with ec(0x%x)", ec);
     }
@@ -815,6 +859,55 @@ ProxyExit:
 
 //----------------------------------------------------------------------
 
+// Completes an IProxy::InvokeAsync call: the reply is unmarshaled into the
+// argument list by the first thread which waits for it.
+class ProxyInvocationFuture
+    : public InvocationFuture
+{
+public:
+    ProxyInvocationFuture(
+        /* [in] */ IInvocationFuture* channelFuture,
+        /* [in] */ IMetaMethod* method,
+        /* [in] */ IArgumentList* argList)
+        : mChannelFuture(channelFuture)
+        , mMethod(method)
+        , mArgList(argList)
+    {}
+
+    ECode IsDone(
+        /* [out] */ Boolean* done) override
+    {
+        return mChannelFuture->IsDone(done);
+    }
+
+    ECode Wait() override
+    {
+        ECode ec = mChannelFuture->Wait();
+
+        Mutex::AutoLock lock(mLock);
+        if (!mDone) {
+            AutoPtr<IParcel> resParcel;
+            if (SUCCEEDED(ec)) {
+                mChannelFuture->GetReply(&resParcel);
+                InterfaceProxy::ListArguments args(mArgList);
+                ec = InterfaceProxy::UnmarshalResults(args, mMethod, resParcel);
+            }
+            mResult = ec;
+            mReply = resParcel;
+            mDone = true;
+            mCond.SignalAll();
+        }
+        return mResult;
+    }
+
+private:
+    AutoPtr<IInvocationFuture> mChannelFuture;
+    AutoPtr<IMetaMethod> mMethod;
+    AutoPtr<IArgumentList> mArgList;
+};
+
+//----------------------------------------------------------------------
+
 const CoclassID CID_CProxy =
         {{0x228c4e6a,0x1df5,0x4130,0xb46e,{0xd,0x0,0x3,0x2,0x2,0xb,0x6,0x7,0x6,0x9,0x7,0x6}}, &CID_CCMRuntime};
 
@@ -915,6 +1008,82 @@ ECode CProxy::UnlinkToDeath(
     return mChannel->UnlinkToDeath(recipient, cookie, flags, outRecipient);
 }
 
+ECode CProxy::InvokeAsync(
+    /* [in] */ IMetaMethod* method,
+    /* [in] */ IArgumentList* argList,
+    /* [out] */ IInvocationFuture** future)
+{
+    VALIDATE_NOT_NULL(future);
+    *future = nullptr;
+
+    if (method == nullptr || argList == nullptr) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    InterfaceProxy* iproxy = FindInterfaceProxy(method);
+    if (iproxy == nullptr) {
+        Logger::E("CProxy", "The method does not belong to the proxy.");
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+    CMetaMethod* mmObj = (CMetaMethod*)method;
+
+    RPCType type;
+    mChannel->GetRPCType(&type);
+    RPCStatistics::Recorder recorder(method, RPCMethodStatistics::PROXY);
+    AutoPtr<IParcel> inParcel;
+    CoCreateParcel(type, &inParcel);
+    inParcel->WriteInteger(RPC_MAGIC_NUMBER);
+    inParcel->WriteInteger(iproxy->mIndex);
+    inParcel->WriteInteger(mmObj->mIndex);
+    InterfaceProxy::ListArguments args(argList);
+    ECode ec = InterfaceProxy::MarshalArguments(args, method, inParcel);
+    if (FAILED(ec)) {
+        recorder.Finish(ec, inParcel, nullptr);
+        return ec;
+    }
+    recorder.Mark(RPCMethodStatistics::MARSHAL);
+
+    // Only the sending half is timed, the reply is waited for elsewhere.
+    AutoPtr<IInvocationFuture> channelFuture;
+    ec = mChannel->InvokeAsync(this, method, inParcel, &channelFuture);
+    recorder.Mark(RPCMethodStatistics::TRANSPORT);
+    recorder.Finish(ec, inParcel, nullptr);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    if (mmObj->mOneway) {
+        channelFuture.MoveTo(future);
+        return NOERROR;
+    }
+
+    *future = new ProxyInvocationFuture(channelFuture, method, argList);
+    REFCOUNT_ADD(*future);
+    return NOERROR;
+}
+
+InterfaceProxy* CProxy::FindInterfaceProxy(
+    /* [in] */ IMetaMethod* method)
+{
+    CMetaMethod* mmObj = (CMetaMethod*)method;
+    if (mmObj->mIndex < 4) {
+        // the methods of IInterface are not remote.
+        return nullptr;
+    }
+
+    AutoPtr<IMetaInterface> intf;
+    method->GetInterface(&intf);
+    InterfaceID iid;
+    intf->GetInterfaceID(&iid);
+    for (Integer i = 0; i < mInterfaces.GetLength(); i++) {
+        InterfaceProxy* iproxy = mInterfaces[i];
+        if (iproxy->mIid == iid) {
+            return iproxy;
+        }
+    }
+    return nullptr;
+}
+
 AutoPtr<IRPCChannel> CProxy::GetChannel()
 {
     return mChannel;
@@ -953,7 +1122,7 @@ ECode CProxy::CreateObject(
         iproxy->mTargetMetadata = interfaces[i];
         iproxy->mTargetMetadata->GetInterfaceID(&iproxy->mIid);
         iproxy->mVtable = sProxyVtable;
-        iproxy->mProxyEntry = reinterpret_cast<HANDLE>(&InterfaceProxy::ProxyEntry);
+        iproxy->mProxyEntry = reinterpret_cast<HANDLE>(&__proxy_entry);
         proxyObj->mInterfaces[i] = iproxy;
     }
 
@@ -44,7 +44,9 @@ class CProxy;
 
 class InterfaceProxy
 {
-private:
+public:
+    // The argument registers of a call through the vtable, and the frame
+    // of __entry, above which the stack arguments lie.
     struct Registers
     {
         Long rbp;
@@ -64,7 +66,6 @@ private:
         Double xmm7;
     };
 
-public:
     Integer AddRef(
         /* [in] */ HANDLE id = 0);
 
@@ -89,36 +90,44 @@ public:
         /* [out] */ InterfaceID* iid);
 
     static ECode ProxyEntry(
-        /* [in] */ HANDLE args);
+        /* [in] */ InterfaceProxy* thisObj,
+        /* [in] */ Integer methodIndex,
+        /* [in] */ Registers* regs);
 
 private:
-    ECode MarshalArguments(
-        /* [in] */ Registers& regs,
+    class RegisterArguments;
+    class ListArguments;
+
+    template<typename Arguments>
+    static ECode MarshalArguments(
+        /* [in] */ Arguments& args,
         /* [in] */ IMetaMethod* method,
         /* [in] */ IParcel* argParcel);
 
-    ECode UnmarshalResults(
-        /* [in] */ Registers& regs,
+    template<typename Arguments>
+    static ECode UnmarshalResults(
+        /* [in] */ Arguments& args,
         /* [in] */ IMetaMethod* method,
         /* [in] */ IParcel* resParcel);
 
-    Long GetLongValue(
+    static Long GetLongValue(
         /* [in] */ Registers& regs,
         /* [in] */ Integer intIndex,
         /* [in] */ Integer fpIndex);
 
-    Double GetDoubleValue(
+    static Double GetDoubleValue(
         /* [in] */ Registers& regs,
         /* [in] */ Integer intIndex,
         /* [in] */ Integer fpIndex);
 
-    HANDLE GetValueAddress(
+    static HANDLE GetValueAddress(
         /* [in] */ Registers& regs,
         /* [in] */ Integer intIndex,
         /* [in] */ Integer fpIndex);
 
 private:
     friend class CProxy;
+    friend class ProxyInvocationFuture;
 
     static constexpr Boolean DEBUG = false;
     HANDLE* mVtable;    // must be the first member
@@ -160,6 +169,11 @@ public:
         /* [in] */ Integer flags = 0,
         /* [out] */ IDeathRecipient** outRecipient = nullptr) override;
 
+    ECode InvokeAsync(
+        /* [in] */ IMetaMethod* method,
+        /* [in] */ IArgumentList* argList,
+        /* [out] */ IInvocationFuture** future) override;
+
     AutoPtr<IRPCChannel> GetChannel();
 
     CoclassID GetTargetCoclassID();
@@ -172,6 +186,9 @@ public:
 private:
     friend class InterfaceProxy;
 
+    InterfaceProxy* FindInterfaceProxy(
+        /* [in] */ IMetaMethod* method);
+
     CoclassID mCid;
     IMetaCoclass* mTargetMetadata;
     Array<InterfaceProxy*> mInterfaces;
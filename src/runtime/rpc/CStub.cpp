@@ -32,6 +32,10 @@
 
 #include "ccmrpc.h"
 #include "CStub.h"
+#include "rpcstatistics.h"
+#include "reflection/CArgumentList.h"
+#include "reflection/CMetaMethod.h"
+#include <new>
 #include "registry.h"
 
 namespace ccm {
@@ -48,25 +52,59 @@ Integer InterfaceStub::Release(
     return 1;
 }
 
+static void FreeTriple(
+    /* [in] */ void* object)
+{
+    static_cast<Triple*>(object)->FreeData();
+}
+
+static void ReleaseInterface(
+    /* [in] */ void* object)
+{
+    IInterface* intf = *static_cast<IInterface**>(object);
+    REFCOUNT_RELEASE(intf);
+}
+
+// Returns an empty Triple which frees its data when the arena is rewound.
+static Triple* NewTriple(
+    /* [in] */ Arena* arena)
+{
+    void* addr = arena->Alloc<Triple>();
+    if (addr == nullptr) {
+        return nullptr;
+    }
+    Triple* t = new(addr) Triple();
+    return arena->AddCleanup(FreeTriple, t) ? t : nullptr;
+}
+
+// Returns a null interface slot whose reference is released when the
+// arena is rewound.
+static IInterface** NewInterfaceSlot(
+    /* [in] */ Arena* arena)
+{
+    IInterface** intf = arena->Alloc<IInterface*>();
+    if (intf == nullptr) {
+        return nullptr;
+    }
+    *intf = nullptr;
+    return arena->AddCleanup(ReleaseInterface, intf) ? intf : nullptr;
+}
+
 ECode InterfaceStub::UnmarshalArguments(
     /* [in] */ IMetaMethod* method,
     /* [in] */ IParcel* argParcel,
-    /* [out] */ IArgumentList** argList)
+    /* [in] */ Arena* arena,
+    /* [in] */ IArgumentList* args)
 {
-    AutoPtr<IArgumentList> args;
-    method->CreateArgumentList(&args);
-
-    Integer N;
-    method->GetParameterNumber(&N);
-    for (Integer i = 0; i < N; i++) {
-        AutoPtr<IMetaParameter> param;
-        method->GetParameter(i, &param);
-        AutoPtr<IMetaType> type;
-        param->GetType(&type);
-        CcmTypeKind kind;
-        type->GetTypeKind((Integer*)&kind);
-        IOAttribute ioAttr;
-        param->GetIOAttribute(&ioAttr);
+    MarshalPlan* plan = ((CMetaMethod*)method)->GetMarshalPlan();
+    if (plan == nullptr) {
+        return E_OUT_OF_MEMORY_ERROR;
+    }
+
+    for (Integer i = 0; i < plan->mEntryNumber; i++) {
+        const MarshalPlan::Entry& entry = plan->mEntries[i];
+        CcmTypeKind kind = entry.mKind;
+        IOAttribute ioAttr = entry.mIOAttr;
         if (ioAttr == IOAttribute::IN) {
             switch (kind) {
                 case CcmTypeKind::Char: {
@@ -118,7 +156,10 @@ ECode InterfaceStub::UnmarshalArguments(
                     break;
                 }
                 case CcmTypeKind::String: {
-                    String* value = new String();
+                    String* value = arena->New<String>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     argParcel->ReadString(value);
                     args->SetInputArgumentOfString(i, *value);
                     break;
@@ -136,16 +177,21 @@ ECode InterfaceStub::UnmarshalArguments(
                     break;
                 }
                 case CcmTypeKind::Array: {
-                    Triple* t = new Triple();
+                    Triple* t = NewTriple(arena);
+                    if (t == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     argParcel->ReadArray(reinterpret_cast<HANDLE>(t));
                     args->SetInputArgumentOfArray(i, reinterpret_cast<HANDLE>(t));
                     break;
                 }
                 case CcmTypeKind::Interface: {
-                    AutoPtr<IInterface> value;
-                    argParcel->ReadInterface(&value);
-                    args->SetInputArgumentOfInterface(i, value);
-                    REFCOUNT_ADD(value);
+                    IInterface** intf = NewInterfaceSlot(arena);
+                    if (intf == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
+                    argParcel->ReadInterface(intf);
+                    args->SetInputArgumentOfInterface(i, *intf);
                     break;
                 }
                 case CcmTypeKind::CoclassID:
@@ -161,7 +207,10 @@ ECode InterfaceStub::UnmarshalArguments(
         else if (ioAttr == IOAttribute::IN_OUT || ioAttr == IOAttribute::OUT) {
             switch (kind) {
                 case CcmTypeKind::Char: {
-                    Char* value = new Char;
+                    Char* value = arena->Alloc<Char>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadChar(value);
                     }
@@ -169,88 +218,136 @@ ECode InterfaceStub::UnmarshalArguments(
                     break;
                 }
                 case CcmTypeKind::Byte: {
-                    Byte* value = new Byte;
+                    Byte* value = arena->Alloc<Byte>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadByte(value);
                     }
                     args->SetOutputArgumentOfByte(i, reinterpret_cast<HANDLE>(value));
+                    break;
                 }
                 case CcmTypeKind::Short: {
-                    Short* value = new Short;
+                    Short* value = arena->Alloc<Short>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadShort(value);
                     }
                     args->SetOutputArgumentOfShort(i, reinterpret_cast<HANDLE>(value));
+                    break;
                 }
                 case CcmTypeKind::Integer: {
-                    Integer* value = new Integer;
+                    Integer* value = arena->Alloc<Integer>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadInteger(value);
                     }
                     args->SetOutputArgumentOfInteger(i, reinterpret_cast<HANDLE>(value));
+                    break;
                 }
                 case CcmTypeKind::Long: {
-                    Long* value = new Long;
+                    Long* value = arena->Alloc<Long>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadLong(value);
                     }
                     args->SetOutputArgumentOfLong(i, reinterpret_cast<HANDLE>(value));
+                    break;
                 }
                 case CcmTypeKind::Float: {
-                    Float* value = new Float;
+                    Float* value = arena->Alloc<Float>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadFloat(value);
                     }
                     args->SetOutputArgumentOfFloat(i, reinterpret_cast<HANDLE>(value));
+                    break;
                 }
                 case CcmTypeKind::Double: {
-                    Double* value = new Double;
+                    Double* value = arena->Alloc<Double>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadDouble(value);
                     }
                     args->SetOutputArgumentOfDouble(i, reinterpret_cast<HANDLE>(value));
+                    break;
                 }
                 case CcmTypeKind::Boolean: {
-                    Boolean* value = new Boolean;
+                    Boolean* value = arena->Alloc<Boolean>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadBoolean(value);
                     }
                     args->SetOutputArgumentOfBoolean(i, reinterpret_cast<HANDLE>(value));
+                    break;
                 }
                 case CcmTypeKind::String: {
-                    String* value = new String();
+                    String* value = arena->New<String>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadString(value);
                     }
                     args->SetOutputArgumentOfString(i, reinterpret_cast<HANDLE>(value));
+                    break;
                 }
                 case CcmTypeKind::ECode: {
-                    ECode* value = new ECode;
+                    ECode* value = arena->Alloc<ECode>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadECode(value);
                     }
                     args->SetOutputArgumentOfECode(i, reinterpret_cast<HANDLE>(value));
+                    break;
                 }
                 case CcmTypeKind::Enum: {
-                    Integer* value = new Integer;
+                    Integer* value = arena->Alloc<Integer>();
+                    if (value == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadEnumeration(value);
                     }
                     args->SetOutputArgumentOfEnumeration(i, reinterpret_cast<HANDLE>(value));
+                    break;
                 }
                 case CcmTypeKind::Array: {
-                    Triple* t = new Triple();
+                    Triple* t = NewTriple(arena);
+                    if (t == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadArray(reinterpret_cast<HANDLE>(t));
                     }
                     args->SetOutputArgumentOfArray(i, reinterpret_cast<HANDLE>(t));
+                    break;
                 }
                 case CcmTypeKind::Interface: {
-                    IInterface** intf = new IInterface*;
+                    IInterface** intf = NewInterfaceSlot(arena);
+                    if (intf == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     if (ioAttr == IOAttribute::IN_OUT) {
                         argParcel->ReadInterface(intf);
                     }
                     args->SetOutputArgumentOfInterface(i, reinterpret_cast<HANDLE>(intf));
+                    break;
                 }
                 case CcmTypeKind::CoclassID:
                 case CcmTypeKind::ComponentID:
@@ -265,7 +362,10 @@ ECode InterfaceStub::UnmarshalArguments(
         else if (ioAttr == IOAttribute::OUT_CALLEE) {
             switch (kind) {
                 case CcmTypeKind::Array: {
-                    Triple* t = new Triple();
+                    Triple* t = NewTriple(arena);
+                    if (t == nullptr) {
+                        return E_OUT_OF_MEMORY_ERROR;
+                    }
                     args->SetOutputArgumentOfArray(i, reinterpret_cast<HANDLE>(t));
                     break;
                 }
@@ -292,7 +392,6 @@ ECode InterfaceStub::UnmarshalArguments(
         }
     }
 
-    args.MoveTo(argList);
     return NOERROR;
 }
 
@@ -306,17 +405,15 @@ ECode InterfaceStub::MarshalResults(
     AutoPtr<IParcel> outParcel;
     CoCreateParcel(type, &outParcel);
 
-    Integer N;
-    method->GetParameterNumber(&N);
-    for (Integer i = 0; i < N; i++) {
-        AutoPtr<IMetaParameter> param;
-        method->GetParameter(i, &param);
-        AutoPtr<IMetaType> type;
-        param->GetType(&type);
-        CcmTypeKind kind;
-        type->GetTypeKind((Integer*)&kind);
-        IOAttribute ioAttr;
-        param->GetIOAttribute(&ioAttr);
+    MarshalPlan* plan = ((CMetaMethod*)method)->GetMarshalPlan();
+    if (plan == nullptr) {
+        return E_OUT_OF_MEMORY_ERROR;
+    }
+
+    for (Integer i = 0; i < plan->mEntryNumber; i++) {
+        const MarshalPlan::Entry& entry = plan->mEntries[i];
+        CcmTypeKind kind = entry.mKind;
+        IOAttribute ioAttr = entry.mIOAttr;
         if (ioAttr == IOAttribute::IN) {
             switch (kind) {
                 case CcmTypeKind::Char:
@@ -329,29 +426,10 @@ ECode InterfaceStub::MarshalResults(
                 case CcmTypeKind::Boolean:
                 case CcmTypeKind::ECode:
                 case CcmTypeKind::Enum:
+                case CcmTypeKind::String:
+                case CcmTypeKind::Array:
+                case CcmTypeKind::Interface:
                     break;
-                case CcmTypeKind::String: {
-                    HANDLE addr;
-                    argList->GetArgumentAddress(i, &addr);
-                    String* value = reinterpret_cast<String*>(addr);
-                    delete value;
-                    break;
-                }
-                case CcmTypeKind::Array: {
-                    HANDLE addr;
-                    argList->GetArgumentAddress(i, &addr);
-                    Triple* t = reinterpret_cast<Triple*>(addr);
-                    t->FreeData();
-                    delete t;
-                    break;
-                }
-                case CcmTypeKind::Interface: {
-                    HANDLE addr;
-                    argList->GetArgumentAddress(i, &addr);
-                    IInterface* intf = reinterpret_cast<IInterface*>(addr);
-                    REFCOUNT_RELEASE(intf);
-                    break;
-                }
                 case CcmTypeKind::CoclassID:
                 case CcmTypeKind::ComponentID:
                 case CcmTypeKind::InterfaceID:
@@ -369,7 +447,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Char* value = reinterpret_cast<Char*>(addr);
                     outParcel->WriteChar(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::Byte: {
@@ -377,7 +454,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Byte* value = reinterpret_cast<Byte*>(addr);
                     outParcel->WriteByte(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::Short: {
@@ -385,7 +461,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Short* value = reinterpret_cast<Short*>(addr);
                     outParcel->WriteShort(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::Integer: {
@@ -393,7 +468,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Integer* value = reinterpret_cast<Integer*>(addr);
                     outParcel->WriteInteger(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::Long: {
@@ -401,7 +475,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Long* value = reinterpret_cast<Long*>(addr);
                     outParcel->WriteLong(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::Float: {
@@ -409,7 +482,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Float* value = reinterpret_cast<Float*>(addr);
                     outParcel->WriteFloat(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::Double: {
@@ -417,7 +489,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Double* value = reinterpret_cast<Double*>(addr);
                     outParcel->WriteDouble(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::Boolean: {
@@ -425,7 +496,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Boolean* value = reinterpret_cast<Boolean*>(addr);
                     outParcel->WriteBoolean(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::String: {
@@ -433,7 +503,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     String* value = reinterpret_cast<String*>(addr);
                     outParcel->WriteString(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::ECode: {
@@ -441,7 +510,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     ECode* value = reinterpret_cast<ECode*>(addr);
                     outParcel->WriteECode(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::Enum: {
@@ -449,7 +517,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Integer* value = reinterpret_cast<Integer*>(addr);
                     outParcel->WriteEnumeration(*value);
-                    delete value;
                     break;
                 }
                 case CcmTypeKind::Array: {
@@ -457,17 +524,10 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Triple* t = reinterpret_cast<Triple*>(addr);
                     outParcel->WriteArray(reinterpret_cast<HANDLE>(t));
-                    delete t;
                     break;
                 }
-                case CcmTypeKind::Interface: {
-                    HANDLE addr;
-                    argList->GetArgumentAddress(i, &addr);
-                    IInterface** intf = reinterpret_cast<IInterface**>(addr);
-                    REFCOUNT_RELEASE(*intf);
-                    delete intf;
+                case CcmTypeKind::Interface:
                     break;
-                }
                 case CcmTypeKind::CoclassID:
                 case CcmTypeKind::ComponentID:
                 case CcmTypeKind::InterfaceID:
@@ -485,7 +545,6 @@ ECode InterfaceStub::MarshalResults(
                     argList->GetArgumentAddress(i, &addr);
                     Triple* t = reinterpret_cast<Triple*>(addr);
                     outParcel->WriteArray(reinterpret_cast<HANDLE>(t));
-                    delete t;
                     break;
                 }
                 case CcmTypeKind::Char:
@@ -528,18 +587,32 @@ ECode InterfaceStub::Invoke(
     }
     AutoPtr<IMetaMethod> mm;
     mTargetMetadata->GetMethod(methodIndex, &mm);
-    AutoPtr<IArgumentList> argList;
-    ECode ec = UnmarshalArguments(mm, argParcel, &argList);
+    RPCStatistics::Recorder recorder(mm, RPCMethodStatistics::STUB);
+
+    // The argument list and every temporary of this call live in the
+    // arena of the worker thread and are dropped together on return.
+    Arena* arena = Arena::GetThreadArena();
+    Arena::Scope scope(arena);
+    IArgumentList* argList = ((CMetaMethod*)mm.Get())->CreateArgumentList(arena);
+    if (argList == nullptr) {
+        return E_OUT_OF_MEMORY_ERROR;
+    }
+    ECode ec = UnmarshalArguments(mm, argParcel, arena, argList);
     if (FAILED(ec)) {
         Logger::E("CStub", "UnmarshalArguments failed with ec is 0x%x.", ec);
+        recorder.Finish(ec, nullptr, argParcel);
         return ec;
     }
+    recorder.Mark(RPCMethodStatistics::UNMARSHAL);
 
     ECode ret = mm->Invoke(mObject, argList);
+    recorder.Mark(RPCMethodStatistics::DISPATCH);
     ec = MarshalResults(mm, argList, resParcel);
     if (FAILED(ec)) {
         Logger::E("CStub", "MarshalResults failed with ec is 0x%x.", ec);
     }
+    recorder.Mark(RPCMethodStatistics::MARSHAL);
+    recorder.Finish(ret, *resParcel, argParcel);
 
     return ret;
 }
@@ -551,6 +624,10 @@ const CoclassID CID_CStub =
 
 CCM_OBJECT_IMPL(CStub);
 
+CStub::CStub()
+    : mConcurrent(false)
+{}
+
 Integer CStub::AddRef(
     /* [in] */ HANDLE id)
 {
@@ -591,7 +668,9 @@ ECode CStub::GetInterfaceID(
 void CStub::OnLastStrongRef(
     /* [in] */ const void* id)
 {
-    UnregisterExportObject(RPCType::Local, mTarget);
+    RPCType type;
+    mChannel->GetRPCType(&type);
+    UnregisterExportObject(type, mTarget);
     Object::OnLastStrongRef(id);
 }
 
@@ -640,6 +719,17 @@ CoclassID CStub::GetTargetCoclassID()
     return mCid;
 }
 
+void CStub::SetConcurrent(
+    /* [in] */ Boolean concurrent)
+{
+    mConcurrent.store(concurrent, std::memory_order_relaxed);
+}
+
+Boolean CStub::IsConcurrent()
+{
+    return mConcurrent.load(std::memory_order_relaxed);
+}
+
 ECode CStub::CreateObject(
     /* [in] */ IInterface* object,
     /* [in] */ IRPCChannel* channel,
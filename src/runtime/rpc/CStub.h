@@ -34,9 +34,11 @@
 #define __CCM_CSTUB_H__
 
 #include "reflection/ccmreflectionapi.h"
+#include "util/arena.h"
 #include "type/ccmarray.h"
 #include "util/ccmautoptr.h"
 #include "util/ccmobject.h"
+#include <atomic>
 
 namespace ccm {
 
@@ -59,7 +61,8 @@ private:
     ECode UnmarshalArguments(
         /* [in] */ IMetaMethod* method,
         /* [in] */ IParcel* argParcel,
-        /* [out] */ IArgumentList** argList);
+        /* [in] */ Arena* arena,
+        /* [in] */ IArgumentList* args);
 
     ECode MarshalResults(
         /* [in] */ IMetaMethod* method,
@@ -83,6 +86,8 @@ class CStub
     , public IStub
 {
 public:
+    CStub();
+
     CCM_INTERFACE_DECL();
 
     CCM_OBJECT_DECL();
@@ -104,6 +109,11 @@ public:
 
     CoclassID GetTargetCoclassID();
 
+    void SetConcurrent(
+        /* [in] */ Boolean concurrent);
+
+    Boolean IsConcurrent();
+
     static ECode CreateObject(
         /* [in] */ IInterface* object,
         /* [in] */ IRPCChannel* channel,
@@ -119,6 +129,8 @@ private:
     IMetaCoclass* mTargetMetadata;
     Array<InterfaceStub*> mInterfaces;
     AutoPtr<IRPCChannel> mChannel;
+    // Whether invocations of the target may run in parallel.
+    std::atomic<Boolean> mConcurrent;
 };
 
 }
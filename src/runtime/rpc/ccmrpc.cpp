@@ -17,12 +17,29 @@
 #include "ccmrpc.h"
 #include "CProxy.h"
 #include "CStub.h"
+#include "registry.h"
+#include "rpcstatistics.h"
+#include "threadpoolexecutor.h"
 #include "dbus/CDBusChannelFactory.h"
+#include "socket/CSocketChannelFactory.h"
+#include <stdlib.h>
+#include <string.h>
 
 namespace ccm {
 
-static AutoPtr<IRPCChannelFactory> sLocalFactory = new CDBusChannelFactory(RPCType::Local);
-static AutoPtr<IRPCChannelFactory> sRemoteFactory;
+// Setting CCM_RPC_TRANSPORT to "socket" moves the local RPC off the
+// session bus as well.
+static IRPCChannelFactory* CreateLocalFactory()
+{
+    const char* transport = getenv("CCM_RPC_TRANSPORT");
+    if (transport != nullptr && !strcmp(transport, "socket")) {
+        return new CSocketChannelFactory(RPCType::Local);
+    }
+    return new CDBusChannelFactory(RPCType::Local);
+}
+
+static AutoPtr<IRPCChannelFactory> sLocalFactory = CreateLocalFactory();
+static AutoPtr<IRPCChannelFactory> sRemoteFactory = new CSocketChannelFactory(RPCType::Remote);
 
 ECode CoCreateParcel(
     /* [in] */ RPCType type,
@@ -116,4 +133,58 @@ ECode CoUnmarshalInterface(
     return factory->UnmarshalInterface(data, object);
 }
 
+ECode CoSetRPCThreadPoolSize(
+    /* [in] */ Integer size)
+{
+    return ThreadPoolExecutor::GetInstance()->SetMaxThreadNumber(size);
+}
+
+ECode CoSetConcurrentInvocation(
+    /* [in] */ IInterface* object,
+    /* [in] */ RPCType type,
+    /* [in] */ Boolean enabled)
+{
+    IObject* obj = IObject::Probe(object);
+    if (obj == nullptr) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    AutoPtr<IStub> stub;
+    ECode ec = FindExportObject(type, obj, &stub);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    ((CStub*)stub.Get())->SetConcurrent(enabled);
+    return NOERROR;
+}
+
+ECode CoSetRPCStatisticsEnabled(
+    /* [in] */ Boolean enabled)
+{
+    RPCStatistics::SetEnabled(enabled);
+    return NOERROR;
+}
+
+ECode CoGetRPCStatistics(
+    /* [out] */ String* report)
+{
+    VALIDATE_NOT_NULL(report);
+
+    *report = RPCStatistics::Dump();
+    return NOERROR;
+}
+
+ECode CoResetRPCStatistics()
+{
+    RPCStatistics::Reset();
+    return NOERROR;
+}
+
+ECode CoSetRPCStatisticsDumpInterval(
+    /* [in] */ Integer seconds)
+{
+    return RPCStatistics::SetDumpInterval(seconds);
+}
+
 }
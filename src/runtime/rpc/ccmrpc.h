@@ -51,6 +51,36 @@ EXTERN_C COM_PUBLIC ECode CoUnmarshalInterface(
     /* [in] */ IInterfacePack* ipack,
     /* [out] */ IInterface** object);
 
+// Stub invocations run on a pool of at most |size| workers, 4 unless set.
+// A worker waiting for the reply of an outgoing call does not count, so
+// calls nested in it, which come back to this process, are not held up.
+EXTERN_C COM_PUBLIC ECode CoSetRPCThreadPoolSize(
+    /* [in] */ Integer size);
+
+// Lets the invocations of an exported |object| run in parallel. The object
+// has to be marshaled first, otherwise E_NOT_FOUND_EXCEPTION is returned.
+// Invocations of the other objects run one at a time, so a call nested
+// in one which comes back to the same object waits for it forever.
+EXTERN_C COM_PUBLIC ECode CoSetConcurrentInvocation(
+    /* [in] */ IInterface* object,
+    /* [in] */ RPCType type,
+    /* [in] */ Boolean enabled);
+
+// The statistics of RPC invocations, per method and per side, are only
+// gathered while enabled. The environment variable CCM_RPC_STATISTICS
+// enables them at startup and, if it is a positive number, dumps them
+// to the log every that many seconds.
+EXTERN_C COM_PUBLIC ECode CoSetRPCStatisticsEnabled(
+    /* [in] */ Boolean enabled);
+
+EXTERN_C COM_PUBLIC ECode CoGetRPCStatistics(
+    /* [out] */ String* report);
+
+EXTERN_C COM_PUBLIC ECode CoResetRPCStatistics();
+
+EXTERN_C COM_PUBLIC ECode CoSetRPCStatisticsDumpInterval(
+    /* [in] */ Integer seconds);
+
 }
 
 #endif // __CCM_CCMTYPES_H__
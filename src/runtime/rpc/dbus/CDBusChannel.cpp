@@ -19,158 +19,105 @@
 #include "CDBusParcel.h"
 #include "InterfacePack.h"
 #include "util/ccmlogger.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
 
 namespace ccm {
 
-CDBusChannel::ServiceRunnable::ServiceRunnable(
+CDBusChannel::DispatchRunnable::DispatchRunnable(
     /* [in] */ CDBusChannel* owner,
-    /* [in] */ IStub* target)
+    /* [in] */ IStub* target,
+    /* [in] */ DBusMessage* msg)
     : mOwner(owner)
     , mTarget(target)
-    , mRequestToQuit(false)
+    , mMessage(msg)
 {}
 
-ECode CDBusChannel::ServiceRunnable::Run()
+CDBusChannel::DispatchRunnable::~DispatchRunnable()
 {
-    DBusError err;
-
-    dbus_error_init(&err);
-
-    DBusConnection* conn = dbus_bus_get_private(DBUS_BUS_SESSION, &err);
-    if (dbus_error_is_set(&err)) {
-        Logger::E("CDBusChannel", "Connect to bus daemon failed, error is \"%s\".",
-                err.message);
-        dbus_error_free(&err);
-        return E_RUNTIME_EXCEPTION;
+    if (mMessage != nullptr) {
+        dbus_message_unref(mMessage);
     }
+}
 
-    const char* name = dbus_bus_get_unique_name(conn);
-    if (name == nullptr) {
-        Logger::E("CDBusChannel", "Get unique name failed.");
-        if (conn != nullptr) {
-            dbus_connection_close(conn);
-            dbus_connection_unref(conn);
-        }
-        dbus_error_free(&err);
-        return E_RUNTIME_EXCEPTION;
+ECode CDBusChannel::DispatchRunnable::Run()
+{
+    if (mMessage != nullptr) {
+        mOwner->ProcessMessage(mTarget, mMessage);
+        return NOERROR;
     }
 
-    mOwner->mName = name;
-
-    DBusObjectPathVTable opVTable;
-
-    opVTable.unregister_function = nullptr;
-    opVTable.message_function = CDBusChannel::ServiceRunnable::HandleMessage;
-
-    dbus_connection_register_object_path(conn,
-            STUB_OBJECT_PATH, &opVTable, static_cast<void*>(this));
+    while (true) {
+        PendingMessage* pm;
+        {
+            Mutex::AutoLock lock(mOwner->mLock);
+            pm = mOwner->mPendingHead;
+            if (pm == nullptr) {
+                mOwner->mDispatching = false;
+                return NOERROR;
+            }
+            mOwner->mPendingHead = pm->mNext;
+            if (mOwner->mPendingHead == nullptr) {
+                mOwner->mPendingTail = nullptr;
+            }
+        }
 
-    {
-        Mutex::AutoLock lock(mOwner->mLock);
-        mOwner->mStarted = true;
+        mOwner->ProcessMessage(mTarget, pm->mMessage);
+        dbus_message_unref(pm->mMessage);
+        delete pm;
     }
-    mOwner->mCond.Signal();
+}
 
-    while (true) {
-        DBusDispatchStatus status;
+//-------------------------------------------------------------------------------
 
-        do {
-            dbus_connection_read_write_dispatch(conn, -1);
-        } while ((status = dbus_connection_get_dispatch_status(conn))
-                == DBUS_DISPATCH_DATA_REMAINS && !mRequestToQuit);
+CDBusChannel::DBusInvocationFuture::DBusInvocationFuture(
+    /* [in] */ CDBusChannel* owner,
+    /* [in] */ DBusPendingCall* pending,
+    /* [in] */ IMetaMethod* method)
+    : mOwner(owner)
+    , mPending(pending)
+    , mMethod(method)
+{}
 
-        if (status == DBUS_DISPATCH_NEED_MEMORY) {
-            Logger::E("CDBusChannel", "DBus dispatching needs more memory.");
-            break;
-        }
+CDBusChannel::DBusInvocationFuture::~DBusInvocationFuture()
+{
+    if (mPending != nullptr) {
+        dbus_pending_call_unref(mPending);
     }
+}
 
-    dbus_connection_close(conn);
-    dbus_connection_unref(conn);
+ECode CDBusChannel::DBusInvocationFuture::IsDone(
+    /* [out] */ Boolean* done)
+{
+    VALIDATE_NOT_NULL(done);
 
+    Mutex::AutoLock lock(mLock);
+    // Nobody dispatches the proxy connection, so a reply which has
+    // arrived is only noticed by Wait().
+    *done = mDone || dbus_pending_call_get_completed(mPending);
     return NOERROR;
 }
 
-DBusHandlerResult CDBusChannel::ServiceRunnable::HandleMessage(
-    /* [in] */ DBusConnection* conn,
-    /* [in] */ DBusMessage* msg,
-    /* [in] */ void* arg)
+ECode CDBusChannel::DBusInvocationFuture::Wait()
 {
-    CDBusChannel::ServiceRunnable* thisObj = static_cast<CDBusChannel::ServiceRunnable*>(arg);
-
-    if (dbus_message_is_method_call(msg,
-            STUB_INTERFACE_PATH, "GetMetadata")) {
-        if (CDBusChannel::DEBUG) {
-            Logger::D("CDBusChannel", "Handle \"GetMetadata\" message.");
-        }
-    }
-    else if (dbus_message_is_method_call(msg,
-            STUB_INTERFACE_PATH, "Invoke")) {
-        if (CDBusChannel::DEBUG) {
-            Logger::D("CDBusChannel", "Handle \"Invoke\" message.");
-        }
-
-        DBusMessageIter args;
-        DBusMessageIter subArg;
-        void* data = nullptr;
-        Integer size = 0;
-
-        if (!dbus_message_iter_init(msg, &args)) {
-            Logger::E("CDBusChannel", "\"Invoke\" message has no arguments.");
-            return DBUS_HANDLER_RESULT_HANDLED;
-        }
-        if (DBUS_TYPE_ARRAY != dbus_message_iter_get_arg_type(&args)) {
-            Logger::E("CDBusChannel", "\"Invoke\" message has no array arguments.");
-            return DBUS_HANDLER_RESULT_HANDLED;
-        }
-        dbus_message_iter_recurse(&args, &subArg);
-        dbus_message_iter_get_fixed_array(&subArg, &data, (int*)&size);
-
-        AutoPtr<IParcel> argParcel = new CDBusParcel();
-        argParcel->SetData(static_cast<Byte*>(data), size);
+    Mutex::AutoLock lock(mLock);
+    if (!mDone) {
+        dbus_pending_call_block(mPending);
+        DBusMessage* reply = dbus_pending_call_steal_reply(mPending);
         AutoPtr<IParcel> resParcel;
-        ECode ec = thisObj->mTarget->Invoke(argParcel, &resParcel);
-
-        DBusMessage* reply = dbus_message_new_method_return(msg);
-
-        dbus_message_iter_init_append(reply, &args);
-        dbus_message_iter_append_basic(&args, DBUS_TYPE_INT32, &ec);
-        HANDLE resData;
-        Long resSize;
-        dbus_message_iter_open_container(&args,
-                DBUS_TYPE_ARRAY, DBUS_TYPE_BYTE_AS_STRING, &subArg);
-        resParcel->GetData(&resData);
-        resParcel->GetDataSize(&resSize);
-        dbus_message_iter_append_fixed_array(&subArg,
-                DBUS_TYPE_BYTE, &resData, resSize);
-        dbus_message_iter_close_container(&args, &subArg);
-
-        dbus_uint32_t serial = 0;
-        if (!dbus_connection_send(conn, reply, &serial)) {
-            Logger::E("CDBusChannel", "Send reply message failed.");
+        ECode ec = E_REMOTE_EXCEPTION;
+        if (reply != nullptr) {
+            ec = mOwner->ParseReplyMessage(reply, mMethod, &resParcel);
+            dbus_message_unref(reply);
         }
-        dbus_connection_flush(conn);
-
-        dbus_message_unref(reply);
+        mResult = ec;
+        mReply = resParcel;
+        mDone = true;
+        mCond.SignalAll();
     }
-    else if (dbus_message_is_method_call(msg,
-            STUB_INTERFACE_PATH, "Release")) {
-        if (CDBusChannel::DEBUG) {
-            Logger::D("CDBusChannel", "Handle \"Release\" message.");
-        }
-
-        thisObj->mTarget->Release();
-        thisObj->mRequestToQuit = true;
-    }
-    else {
-        const char* name = dbus_message_get_member(msg);
-        if (name != nullptr && CDBusChannel::DEBUG) {
-            Logger::D("CDBusChannel",
-                    "The message which name is \"%s\" does not be handled.", name);
-        }
-    }
-
-    return DBUS_HANDLER_RESULT_HANDLED;
+    return mResult;
 }
 
 //-------------------------------------------------------------------------------
@@ -182,15 +129,52 @@ CCM_INTERFACE_IMPL_1(CDBusChannel, Object, IRPCChannel);
 
 CCM_OBJECT_IMPL(CDBusChannel);
 
+Mutex CDBusChannel::sConnectionsLock;
+CDBusChannel* CDBusChannel::sConnectedChannels = nullptr;
+
+Mutex CDBusChannel::sServiceLock;
+DBusConnection* CDBusChannel::sServiceConnection = nullptr;
+String CDBusChannel::sServiceName;
+pthread_t CDBusChannel::sServiceThread;
+int CDBusChannel::sServiceWakeFds[2] = { -1, -1 };
+Boolean CDBusChannel::sServiceQuit = false;
+Integer CDBusChannel::sStubNumber = 0;
+
 CDBusChannel::CDBusChannel(
     /* [in] */ RPCType type,
     /* [in] */ RPCPeer peer)
     : mType(type)
     , mPeer(peer)
-    , mStarted(false)
-    , mCond(mLock)
+    , mPendingHead(nullptr)
+    , mPendingTail(nullptr)
+    , mDispatching(false)
+    , mConnection(nullptr)
+    , mPrevConnected(nullptr)
+    , mNextConnected(nullptr)
 {}
 
+CDBusChannel::~CDBusChannel()
+{
+    if (mPeer == RPCPeer::Stub) {
+        if (mConnection != nullptr) {
+            dbus_connection_unregister_object_path(mConnection, mObjectPath.string());
+            dbus_connection_unref(mConnection);
+            mConnection = nullptr;
+        }
+        while (mPendingHead != nullptr) {
+            PendingMessage* pm = mPendingHead;
+            mPendingHead = pm->mNext;
+            dbus_message_unref(pm->mMessage);
+            delete pm;
+        }
+        mPendingTail = nullptr;
+        return;
+    }
+
+    Mutex::AutoLock lock(sConnectionsLock);
+    ReleaseConnectionLocked();
+}
+
 ECode CDBusChannel::GetRPCType(
     /* [out] */ RPCType* type)
 {
@@ -224,48 +208,136 @@ ECode CDBusChannel::UnlinkToDeath(
 }
 
 ECode CDBusChannel::UnmarshalArguments(
+    /* [in] */ DBusMessage* msg,
     /* [in] */ void* data,
     /* [in] */ Long size,
-    /* [in] */ IMetaMethod* method,
     /* [in] */ IParcel* argParcel)
 {
-    return NOERROR;
+    // The parcel keeps |msg| alive and reads from its buffer in place.
+    return ((CDBusParcel*)argParcel)->SetBorrowedData(
+            static_cast<Byte*>(data), size, msg);
 }
 
-ECode CDBusChannel::Invoke(
-    /* [in] */ IProxy* proxy,
-    /* [in] */ IMetaMethod* method,
-    /* [in] */ IParcel* argParcel,
-    /* [out] */ IParcel** resParcel)
+DBusMessage* CDBusChannel::NewReplyMessage(
+    /* [in] */ DBusMessage* msg,
+    /* [in] */ ECode ec,
+    /* [in] */ IParcel* resParcel)
 {
-    ECode ec = NOERROR;
-    DBusError err;
-    DBusConnection* conn = nullptr;
-    DBusMessage* msg = nullptr;
-    DBusMessage* reply = nullptr;
+    DBusMessage* reply = dbus_message_new_method_return(msg);
+    if (reply == nullptr) {
+        return nullptr;
+    }
+
     DBusMessageIter args, subArg;
-    HANDLE data;
-    Long size;
+    HANDLE resData = 0;
+    Long resSize = 0;
+    if (resParcel != nullptr) {
+        resParcel->GetData(&resData);
+        resParcel->GetDataSize(&resSize);
+    }
 
-    dbus_error_init(&err);
+    // The results are appended straight from the parcel buffer, which is
+    // the only copy libdbus allows for a fixed array.
+    dbus_message_iter_init_append(reply, &args);
+    dbus_message_iter_append_basic(&args, DBUS_TYPE_INT32, &ec);
+    dbus_message_iter_open_container(&args,
+            DBUS_TYPE_ARRAY, DBUS_TYPE_BYTE_AS_STRING, &subArg);
+    dbus_message_iter_append_fixed_array(&subArg,
+            DBUS_TYPE_BYTE, &resData, resSize);
+    dbus_message_iter_close_container(&args, &subArg);
+    return reply;
+}
 
-    conn = dbus_bus_get_private(DBUS_BUS_SESSION, &err);
+ECode CDBusChannel::AcquireConnection(
+    /* [out] */ DBusConnection** conn)
+{
+    Mutex::AutoLock lock(sConnectionsLock);
 
-    if (dbus_error_is_set(&err)) {
-        Logger::E("CDBusChannel", "Connect to bus daemon failed, error is \"%s\".",
-                err.message);
-        ec = E_RUNTIME_EXCEPTION;
-        goto Exit;
+    if (mConnection == nullptr) {
+        DBusError err;
+
+        dbus_error_init(&err);
+
+        dbus_threads_init_default();
+        DBusConnection* newConn = dbus_bus_get_private(DBUS_BUS_SESSION, &err);
+        if (dbus_error_is_set(&err)) {
+            Logger::E("CDBusChannel", "Connect to bus daemon failed, error is \"%s\".",
+                    err.message);
+            dbus_error_free(&err);
+            *conn = nullptr;
+            return E_RUNTIME_EXCEPTION;
+        }
+        dbus_error_free(&err);
+        dbus_connection_set_exit_on_disconnect(newConn, false);
+
+        mConnection = newConn;
+        mPrevConnected = nullptr;
+        mNextConnected = sConnectedChannels;
+        if (sConnectedChannels != nullptr) {
+            sConnectedChannels->mPrevConnected = this;
+        }
+        sConnectedChannels = this;
+    }
+
+    *conn = dbus_connection_ref(mConnection);
+    return NOERROR;
+}
+
+void CDBusChannel::ResetConnection(
+    /* [in] */ DBusConnection* conn)
+{
+    Mutex::AutoLock lock(sConnectionsLock);
+
+    // Another thread may have already replaced the broken connection.
+    if (mConnection == conn) {
+        ReleaseConnectionLocked();
+    }
+}
+
+void CDBusChannel::ReleaseConnectionLocked()
+{
+    if (mConnection == nullptr) {
+        return;
+    }
+
+    dbus_connection_close(mConnection);
+    dbus_connection_unref(mConnection);
+    mConnection = nullptr;
+
+    if (mPrevConnected != nullptr) {
+        mPrevConnected->mNextConnected = mNextConnected;
+    }
+    else {
+        sConnectedChannels = mNextConnected;
     }
+    if (mNextConnected != nullptr) {
+        mNextConnected->mPrevConnected = mPrevConnected;
+    }
+    mPrevConnected = mNextConnected = nullptr;
+}
 
-    msg = dbus_message_new_method_call(
-            mName, STUB_OBJECT_PATH, STUB_INTERFACE_PATH, "Invoke");
+void CDBusChannel::ReleaseAllConnections()
+{
+    Mutex::AutoLock lock(sConnectionsLock);
+
+    while (sConnectedChannels != nullptr) {
+        sConnectedChannels->ReleaseConnectionLocked();
+    }
+}
+
+DBusMessage* CDBusChannel::NewInvokeMessage(
+    /* [in] */ IParcel* argParcel)
+{
+    DBusMessage* msg = dbus_message_new_method_call(
+            mName, mObjectPath, STUB_INTERFACE_PATH, "Invoke");
     if (msg == nullptr) {
         Logger::E("CDBusChannel", "Fail to create dbus message.");
-        ec = E_RUNTIME_EXCEPTION;
-        goto Exit;
+        return nullptr;
     }
 
+    DBusMessageIter args, subArg;
+    HANDLE data;
+    Long size;
     dbus_message_iter_init_append(msg, &args);
     dbus_message_iter_open_container(&args,
             DBUS_TYPE_ARRAY, DBUS_TYPE_BYTE_AS_STRING, &subArg);
@@ -274,101 +346,566 @@ ECode CDBusChannel::Invoke(
     dbus_message_iter_append_fixed_array(&subArg,
             DBUS_TYPE_BYTE, &data, size);
     dbus_message_iter_close_container(&args, &subArg);
+    return msg;
+}
 
-    if (DEBUG) {
-        Logger::D("CDBusChannel", "Send message.");
-    }
-
-    reply = dbus_connection_send_with_reply_and_block(conn, msg, -1, &err);
-    if (dbus_error_is_set(&err)) {
-        Logger::E("CDBusChannel", "Fail to send message, error is \"%s\"", err.message);
-        ec = E_REMOTE_EXCEPTION;
-        goto Exit;
+ECode CDBusChannel::ParseReplyMessage(
+    /* [in] */ DBusMessage* reply,
+    /* [in] */ IMetaMethod* method,
+    /* [out] */ IParcel** resParcel)
+{
+    if (dbus_message_get_type(reply) == DBUS_MESSAGE_TYPE_ERROR) {
+        const char* name = dbus_message_get_error_name(reply);
+        Logger::E("CDBusChannel", "Reply is an error \"%s\".",
+                name != nullptr ? name : "");
+        return E_REMOTE_EXCEPTION;
     }
 
+    DBusMessageIter args, subArg;
     if (!dbus_message_iter_init(reply, &args)) {
         Logger::E("CDBusChannel", "Reply has no results.");
-        ec = E_REMOTE_EXCEPTION;
-        goto Exit;
+        return E_REMOTE_EXCEPTION;
     }
 
     if (DBUS_TYPE_INT32 != dbus_message_iter_get_arg_type(&args)) {
         Logger::E("CDBusChannel", "The first result is not Integer.");
-        ec = E_REMOTE_EXCEPTION;
-        goto Exit;
+        return E_REMOTE_EXCEPTION;
     }
 
+    ECode ec;
     dbus_message_iter_get_basic(&args, &ec);
 
-    if (SUCCEEDED(ec)) {
-        Boolean hasOutArgs;
-        method->HasOutArguments(&hasOutArgs);
-        if (hasOutArgs) {
-            if (!dbus_message_iter_next(&args)) {
-                Logger::E("CDBusChannel", "Reply has no out arguments.");
-                ec = E_REMOTE_EXCEPTION;
-                goto Exit;
-            }
-            if (DBUS_TYPE_ARRAY != dbus_message_iter_get_arg_type(&args)) {
-                Logger::E("CDBusChannel", "Reply arguments is not array.");
-                ec = E_REMOTE_EXCEPTION;
-                goto Exit;
-            }
+    if (FAILED(ec)) {
+        if (DEBUG) {
+            Logger::D("CDBusChannel", "Remote call failed with ec = 0x%x.", ec);
+        }
+        return ec;
+    }
 
-            void* replyData = nullptr;
-            Integer replySize;
+    Boolean hasOutArgs;
+    method->HasOutArguments(&hasOutArgs);
+    if (!hasOutArgs) {
+        return ec;
+    }
 
-            dbus_message_iter_recurse(&args, &subArg);
-            dbus_message_iter_get_fixed_array(&subArg,
-                    &replyData, &replySize);
-            if (replyData != nullptr) {
-                *resParcel = new CDBusParcel();
-                REFCOUNT_ADD(*resParcel);
-                ec = UnmarshalArguments(replyData, replySize, method, *resParcel);
-            }
-        }
+    if (!dbus_message_iter_next(&args)) {
+        Logger::E("CDBusChannel", "Reply has no out arguments.");
+        return E_REMOTE_EXCEPTION;
     }
-    else {
+    if (DBUS_TYPE_ARRAY != dbus_message_iter_get_arg_type(&args)) {
+        Logger::E("CDBusChannel", "Reply arguments is not array.");
+        return E_REMOTE_EXCEPTION;
+    }
+
+    void* replyData = nullptr;
+    Integer replySize;
+
+    dbus_message_iter_recurse(&args, &subArg);
+    dbus_message_iter_get_fixed_array(&subArg,
+            &replyData, &replySize);
+    if (replyData != nullptr) {
+        *resParcel = new CDBusParcel();
+        REFCOUNT_ADD(*resParcel);
+        ec = UnmarshalArguments(reply, replyData, replySize, *resParcel);
+    }
+    return ec;
+}
+
+ECode CDBusChannel::SendMessage(
+    /* [in] */ DBusMessage* msg,
+    /* [out] */ DBusPendingCall** pending)
+{
+    for (Integer i = 0; ; i++) {
+        DBusConnection* conn;
+        ECode ec = AcquireConnection(&conn);
+        if (FAILED(ec)) {
+            return ec;
+        }
+
         if (DEBUG) {
-            Logger::D("CDBusChannel", "Remote call failed with ec = 0x%x.", ec);
+            Logger::D("CDBusChannel", "Send message.");
         }
+
+        Boolean sent = false;
+        if (dbus_connection_get_is_connected(conn)) {
+            if (pending != nullptr) {
+                *pending = nullptr;
+                // libdbus gives no pending call if the connection is lost.
+                // Remote methods may run for as long as they like, like the
+                // blocking send with a timeout of -1 used to let them.
+                sent = dbus_connection_send_with_reply(conn, msg, pending,
+                        DBUS_TIMEOUT_INFINITE) && *pending != nullptr;
+            }
+            else {
+                sent = dbus_connection_send(conn, msg, nullptr);
+            }
+            if (sent) {
+                dbus_connection_flush(conn);
+            }
+        }
+        if (sent) {
+            dbus_connection_unref(conn);
+            return NOERROR;
+        }
+
+        if (dbus_connection_get_is_connected(conn) || i >= MAX_RECONNECT_NUMBER) {
+            Logger::E("CDBusChannel", "Fail to send message.");
+            dbus_connection_unref(conn);
+            return E_REMOTE_EXCEPTION;
+        }
+
+        Logger::W("CDBusChannel", "Connection to bus daemon is lost, reconnecting.");
+        ResetConnection(conn);
+        dbus_connection_unref(conn);
     }
+}
+
+ECode CDBusChannel::Invoke(
+    /* [in] */ IProxy* proxy,
+    /* [in] */ IMetaMethod* method,
+    /* [in] */ IParcel* argParcel,
+    /* [out] */ IParcel** resParcel)
+{
+    ECode ec = NOERROR;
+    DBusMessage* msg = nullptr;
+    DBusPendingCall* pending = nullptr;
+    DBusMessage* reply = nullptr;
+
+    msg = NewInvokeMessage(argParcel);
+    if (msg == nullptr) {
+        ec = E_RUNTIME_EXCEPTION;
+        goto Exit;
+    }
+
+    Boolean oneway;
+    method->IsOneway(&oneway);
+    if (oneway) {
+        // The stub sends nothing back, the call returns once the
+        // message is written out.
+        dbus_message_set_no_reply(msg, true);
+        ec = SendMessage(msg, nullptr);
+        goto Exit;
+    }
+
+    // SendMessage reconnects only while the message is not queued yet.
+    // Once it is, the stub may have run the call, so losing the
+    // connection fails the call instead of sending it again.
+    ec = SendMessage(msg, &pending);
+    if (FAILED(ec)) {
+        goto Exit;
+    }
+
+    dbus_pending_call_block(pending);
+    reply = dbus_pending_call_steal_reply(pending);
+    if (reply == nullptr) {
+        Logger::E("CDBusChannel", "No reply is received.");
+        ec = E_REMOTE_EXCEPTION;
+        goto Exit;
+    }
+
+    ec = ParseReplyMessage(reply, method, resParcel);
 
 Exit:
     if (msg != nullptr) {
         dbus_message_unref(msg);
     }
+    if (pending != nullptr) {
+        dbus_pending_call_unref(pending);
+    }
     if (reply != nullptr) {
         dbus_message_unref(reply);
     }
-    if (conn != nullptr) {
-        dbus_connection_close(conn);
-        dbus_connection_unref(conn);
+
+    return ec;
+}
+
+ECode CDBusChannel::InvokeAsync(
+    /* [in] */ IProxy* proxy,
+    /* [in] */ IMetaMethod* method,
+    /* [in] */ IParcel* argParcel,
+    /* [out] */ IInvocationFuture** future)
+{
+    VALIDATE_NOT_NULL(future);
+    *future = nullptr;
+
+    DBusMessage* msg = NewInvokeMessage(argParcel);
+    if (msg == nullptr) {
+        return E_RUNTIME_EXCEPTION;
     }
 
-    dbus_error_free(&err);
+    ECode ec;
+    AutoPtr<InvocationFuture> result;
+    Boolean oneway;
+    method->IsOneway(&oneway);
+    if (oneway) {
+        dbus_message_set_no_reply(msg, true);
+        ec = SendMessage(msg, nullptr);
+        if (SUCCEEDED(ec)) {
+            result = InvocationFuture::CreateCompleted(NOERROR);
+        }
+    }
+    else {
+        DBusPendingCall* pending;
+        ec = SendMessage(msg, &pending);
+        if (SUCCEEDED(ec)) {
+            result = new DBusInvocationFuture(this, pending, method);
+        }
+    }
+    dbus_message_unref(msg);
 
-    return ec;
+    if (FAILED(ec)) {
+        return ec;
+    }
+    *future = result;
+    REFCOUNT_ADD(*future);
+    return NOERROR;
 }
 
-ECode CDBusChannel::StartListening(
-    /* [in] */ IStub* stub)
+ECode CDBusChannel::AcquireServiceConnection(
+    /* [out] */ DBusConnection** conn)
 {
-    ECode ec = NOERROR;
-    if (mPeer == RPCPeer::Stub) {
-        AutoPtr<ThreadPoolExecutor::Runnable> r = new ServiceRunnable(this, stub);
-        ec = ThreadPoolExecutor::GetInstance()->RunTask(r);
+    Mutex::AutoLock lock(sServiceLock);
+
+    if (sServiceConnection == nullptr) {
+        DBusError err;
+
+        dbus_error_init(&err);
+
+        dbus_threads_init_default();
+        DBusConnection* newConn = dbus_bus_get_private(DBUS_BUS_SESSION, &err);
+        if (dbus_error_is_set(&err)) {
+            Logger::E("CDBusChannel", "Connect to bus daemon failed, error is \"%s\".",
+                    err.message);
+            dbus_error_free(&err);
+            *conn = nullptr;
+            return E_RUNTIME_EXCEPTION;
+        }
+        dbus_error_free(&err);
+
+        const char* name = dbus_bus_get_unique_name(newConn);
+        if (name == nullptr) {
+            Logger::E("CDBusChannel", "Get unique name failed.");
+            dbus_connection_close(newConn);
+            dbus_connection_unref(newConn);
+            *conn = nullptr;
+            return E_RUNTIME_EXCEPTION;
+        }
+
+        if (pipe2(sServiceWakeFds, O_NONBLOCK | O_CLOEXEC) != 0) {
+            Logger::E("CDBusChannel", "Create wakeup pipe failed, errno is %d.", errno);
+            dbus_connection_close(newConn);
+            dbus_connection_unref(newConn);
+            *conn = nullptr;
+            return E_RUNTIME_EXCEPTION;
+        }
+
+        dbus_connection_set_exit_on_disconnect(newConn, false);
+        // Replies are sent by the worker threads, so the I/O thread must
+        // be woken up to flush them.
+        dbus_connection_set_wakeup_main_function(newConn,
+                CDBusChannel::WakeUpServiceThread, nullptr, nullptr);
+
+        sServiceConnection = newConn;
+        sServiceName = name;
+        sServiceQuit = false;
+
+        int ret = pthread_create(&sServiceThread, nullptr,
+                CDBusChannel::ServiceThreadEntry, (void*)newConn);
+        if (ret != 0) {
+            Logger::E("CDBusChannel", "Create service thread failed, error is %d.", ret);
+            sServiceConnection = nullptr;
+            sServiceName = nullptr;
+            dbus_connection_close(newConn);
+            dbus_connection_unref(newConn);
+            close(sServiceWakeFds[0]);
+            close(sServiceWakeFds[1]);
+            sServiceWakeFds[0] = sServiceWakeFds[1] = -1;
+            *conn = nullptr;
+            return E_RUNTIME_EXCEPTION;
+        }
+    }
+
+    *conn = dbus_connection_ref(sServiceConnection);
+    return NOERROR;
+}
+
+void CDBusChannel::ReleaseServiceConnection()
+{
+    DBusConnection* conn;
+    {
+        Mutex::AutoLock lock(sServiceLock);
+        if (sServiceConnection == nullptr) {
+            return;
+        }
+        conn = sServiceConnection;
+        sServiceConnection = nullptr;
+        sServiceQuit = true;
+    }
+
+    WakeUpServiceThread(nullptr);
+    pthread_join(sServiceThread, nullptr);
+
+    dbus_connection_close(conn);
+    dbus_connection_unref(conn);
+
+    close(sServiceWakeFds[0]);
+    close(sServiceWakeFds[1]);
+    sServiceWakeFds[0] = sServiceWakeFds[1] = -1;
+}
+
+void* CDBusChannel::ServiceThreadEntry(
+    /* [in] */ void* arg)
+{
+    DBusConnection* conn = static_cast<DBusConnection*>(arg);
+
+    int busFd;
+    if (!dbus_connection_get_unix_fd(conn, &busFd)) {
+        Logger::E("CDBusChannel", "Get the fd of bus connection failed.");
+        return nullptr;
+    }
+
+    while (true) {
+        {
+            Mutex::AutoLock lock(sServiceLock);
+            if (sServiceQuit) {
+                break;
+            }
+        }
+
+        struct pollfd fds[2];
+        fds[0].fd = busFd;
+        fds[0].events = POLLIN;
+        if (dbus_connection_has_messages_to_send(conn)) {
+            fds[0].events |= POLLOUT;
+        }
+        fds[0].revents = 0;
+        fds[1].fd = sServiceWakeFds[0];
+        fds[1].events = POLLIN;
+        fds[1].revents = 0;
+
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            Logger::E("CDBusChannel", "Poll bus connection failed, errno is %d.", errno);
+            break;
+        }
+
+        if (fds[1].revents & POLLIN) {
+            char buf[64];
+            while (read(sServiceWakeFds[0], buf, sizeof(buf)) > 0);
+        }
+
+        if (!dbus_connection_read_write(conn, 0)) {
+            Logger::E("CDBusChannel", "Connection to bus daemon is lost.");
+            break;
+        }
+
+        DBusDispatchStatus status;
+        while ((status = dbus_connection_dispatch(conn)) == DBUS_DISPATCH_DATA_REMAINS);
+        if (status == DBUS_DISPATCH_NEED_MEMORY) {
+            Logger::E("CDBusChannel", "DBus dispatching needs more memory.");
+        }
+    }
+
+    return nullptr;
+}
+
+void CDBusChannel::WakeUpServiceThread(
+    /* [in] */ void* data)
+{
+    char c = 0;
+    ssize_t ret = write(sServiceWakeFds[1], &c, 1);
+    (void)ret;
+}
+
+DBusHandlerResult CDBusChannel::HandleMessage(
+    /* [in] */ DBusConnection* conn,
+    /* [in] */ DBusMessage* msg,
+    /* [in] */ void* arg)
+{
+    RefBase::WeakRef* stubRef = static_cast<RefBase::WeakRef*>(arg);
+    if (!stubRef->AttemptIncStrong(conn)) {
+        // The stub is being destroyed, let libdbus reply an error.
+        return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
     }
+    CStub* stubObj = static_cast<CStub*>(stubRef->GetRefBase());
+    AutoPtr<IStub> stub = (IStub*)stubObj;
+    stubObj->Release(reinterpret_cast<HANDLE>(conn));
 
+    if (dbus_message_is_method_call(msg,
+            STUB_INTERFACE_PATH, "GetMetadata")) {
+        if (CDBusChannel::DEBUG) {
+            Logger::D("CDBusChannel", "Handle \"GetMetadata\" message.");
+        }
+    }
+    else if (dbus_message_is_method_call(msg, STUB_INTERFACE_PATH, "Invoke") ||
+            dbus_message_is_method_call(msg, STUB_INTERFACE_PATH, "Release")) {
+        CDBusChannel* channel = GetStubChannel(stub);
+        channel->QueueMessage(stub, dbus_message_ref(msg));
+    }
+    else {
+        const char* name = dbus_message_get_member(msg);
+        if (name != nullptr && CDBusChannel::DEBUG) {
+            Logger::D("CDBusChannel",
+                    "The message which name is \"%s\" does not be handled.", name);
+        }
+    }
+
+    return DBUS_HANDLER_RESULT_HANDLED;
+}
+
+void CDBusChannel::UnregisterStub(
+    /* [in] */ DBusConnection* conn,
+    /* [in] */ void* arg)
+{
+    RefBase::WeakRef* stubRef = static_cast<RefBase::WeakRef*>(arg);
+    stubRef->DecWeak(stubRef->GetRefBase());
+}
+
+ECode CDBusChannel::QueueMessage(
+    /* [in] */ IStub* target,
+    /* [in] */ DBusMessage* msg)
+{
+    if (((CStub*)target)->IsConcurrent()) {
+        AutoPtr<ThreadPoolExecutor::Runnable> r = new DispatchRunnable(this, target, msg);
+        return ThreadPoolExecutor::GetInstance()->RunTask(r);
+    }
+
+    // Invocations of one object are serialized unless it asks for
+    // concurrent invocation, one runnable drains them in order.
+    PendingMessage* pm = new PendingMessage(msg);
     {
         Mutex::AutoLock lock(mLock);
-        while (!mStarted) {
-            mCond.Wait();
+        if (mPendingTail == nullptr) {
+            mPendingHead = mPendingTail = pm;
+        }
+        else {
+            mPendingTail->mNext = pm;
+            mPendingTail = pm;
         }
+        if (mDispatching) {
+            return NOERROR;
+        }
+        mDispatching = true;
+    }
+
+    AutoPtr<ThreadPoolExecutor::Runnable> r = new DispatchRunnable(this, target);
+    ECode ec = ThreadPoolExecutor::GetInstance()->RunTask(r);
+    if (FAILED(ec)) {
+        Logger::E("CDBusChannel", "Dispatch message failed, ec is 0x%x.", ec);
+        Mutex::AutoLock lock(mLock);
+        mDispatching = false;
     }
     return ec;
 }
 
+void CDBusChannel::ProcessMessage(
+    /* [in] */ IStub* target,
+    /* [in] */ DBusMessage* msg)
+{
+    if (dbus_message_is_method_call(msg,
+            STUB_INTERFACE_PATH, "Invoke")) {
+        if (CDBusChannel::DEBUG) {
+            Logger::D("CDBusChannel", "Handle \"Invoke\" message.");
+        }
+
+        DBusMessageIter args;
+        DBusMessageIter subArg;
+        void* data = nullptr;
+        Integer size = 0;
+
+        if (!dbus_message_iter_init(msg, &args)) {
+            Logger::E("CDBusChannel", "\"Invoke\" message has no arguments.");
+            return;
+        }
+        if (DBUS_TYPE_ARRAY != dbus_message_iter_get_arg_type(&args)) {
+            Logger::E("CDBusChannel", "\"Invoke\" message has no array arguments.");
+            return;
+        }
+        dbus_message_iter_recurse(&args, &subArg);
+        dbus_message_iter_get_fixed_array(&subArg, &data, (int*)&size);
+
+        AutoPtr<IParcel> argParcel = new CDBusParcel();
+        ECode ec = UnmarshalArguments(msg, data, size, argParcel);
+        AutoPtr<IParcel> resParcel;
+        if (SUCCEEDED(ec)) {
+            ec = target->Invoke(argParcel, &resParcel);
+        }
+        argParcel = nullptr;
+
+        if (dbus_message_get_no_reply(msg)) {
+            // a [oneway] method, the caller does not wait for a reply.
+            if (FAILED(ec)) {
+                Logger::W("CDBusChannel", "Oneway invocation failed, ec is 0x%x.", ec);
+            }
+            return;
+        }
+
+        DBusMessage* reply = NewReplyMessage(msg, ec, resParcel);
+        if (reply == nullptr) {
+            Logger::E("CDBusChannel", "Fail to create reply message.");
+            return;
+        }
+
+        // The service thread is woken up to flush the reply.
+        dbus_uint32_t serial = 0;
+        if (!dbus_connection_send(mConnection, reply, &serial)) {
+            Logger::E("CDBusChannel", "Send reply message failed.");
+        }
+
+        dbus_message_unref(reply);
+    }
+    else if (dbus_message_is_method_call(msg,
+            STUB_INTERFACE_PATH, "Release")) {
+        if (CDBusChannel::DEBUG) {
+            Logger::D("CDBusChannel", "Handle \"Release\" message.");
+        }
+
+        target->Release();
+    }
+}
+
+ECode CDBusChannel::StartListening(
+    /* [in] */ IStub* stub)
+{
+    if (mPeer != RPCPeer::Stub) {
+        return NOERROR;
+    }
+
+    DBusConnection* conn;
+    ECode ec = AcquireServiceConnection(&conn);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    {
+        Mutex::AutoLock lock(sServiceLock);
+        mName = sServiceName;
+        mObjectPath = String::Format("%s/%d", STUB_OBJECT_PATH, sStubNumber++);
+    }
+
+    DBusObjectPathVTable opVTable;
+
+    opVTable.unregister_function = CDBusChannel::UnregisterStub;
+    opVTable.message_function = CDBusChannel::HandleMessage;
+
+    // The bus connection only keeps a weak reference to the stub.
+    CStub* stubObj = (CStub*)stub;
+    RefBase::WeakRef* stubRef = stubObj->CreateWeak(stubObj);
+    if (!dbus_connection_register_object_path(conn,
+            mObjectPath.string(), &opVTable, static_cast<void*>(stubRef))) {
+        Logger::E("CDBusChannel", "Register object path \"%s\" failed.",
+                mObjectPath.string());
+        stubRef->DecWeak(stubObj);
+        dbus_connection_unref(conn);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    mConnection = conn;
+    return NOERROR;
+}
+
 ECode CDBusChannel::Match(
     /* [in] */ IInterfacePack* ipack,
     /* [out] */ Boolean* matched)
@@ -378,7 +915,8 @@ ECode CDBusChannel::Match(
     IDBusInterfacePack* idpack = IDBusInterfacePack::Probe(ipack);
     if (idpack != nullptr) {
         InterfacePack* pack = (InterfacePack*)idpack;
-        if (pack->GetDBusName().Equals(mName)) {
+        if (pack->GetDBusName().Equals(mName) &&
+                pack->GetDBusObjectPath().Equals(mObjectPath)) {
             *matched = true;
             return NOERROR;
         }
@@ -387,4 +925,10 @@ ECode CDBusChannel::Match(
     return NOERROR;
 }
 
+void Uninit_DBus_Connections()
+{
+    CDBusChannel::ReleaseServiceConnection();
+    CDBusChannel::ReleaseAllConnections();
+}
+
 }
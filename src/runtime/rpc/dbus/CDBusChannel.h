@@ -19,6 +19,7 @@
 
 #include "CProxy.h"
 #include "CStub.h"
+#include "invocationfuture.h"
 #include "threadpoolexecutor.h"
 #include "util/ccmobject.h"
 #include "util/mutex.h"
@@ -34,26 +35,59 @@ class CDBusChannel
     , public IRPCChannel
 {
 private:
-    class ServiceRunnable
+    class DispatchRunnable
         : public ThreadPoolExecutor::Runnable
     {
     public:
-        ServiceRunnable(
+        DispatchRunnable(
             /* [in] */ CDBusChannel* owner,
-            /* [in] */ IStub* target);
+            /* [in] */ IStub* target,
+            /* [in] */ DBusMessage* msg = nullptr);
+
+        ~DispatchRunnable();
 
         ECode Run();
 
     private:
-        static DBusHandlerResult HandleMessage(
-            /* [in] */ DBusConnection* conn,
-            /* [in] */ DBusMessage* msg,
-            /* [in] */ void* arg);
+        AutoPtr<CDBusChannel> mOwner;
+        AutoPtr<IStub> mTarget;
+        // If mMessage is null, drain the pending messages of the owner.
+        DBusMessage* mMessage;
+    };
+
+    // Completed by the first thread which waits for it.
+    class DBusInvocationFuture
+        : public InvocationFuture
+    {
+    public:
+        DBusInvocationFuture(
+            /* [in] */ CDBusChannel* owner,
+            /* [in] */ DBusPendingCall* pending,
+            /* [in] */ IMetaMethod* method);
+
+        ~DBusInvocationFuture();
+
+        ECode IsDone(
+            /* [out] */ Boolean* done) override;
+
+        ECode Wait() override;
 
     private:
-        CDBusChannel* mOwner;
-        IStub* mTarget;
-        Boolean mRequestToQuit;
+        AutoPtr<CDBusChannel> mOwner;
+        DBusPendingCall* mPending;
+        AutoPtr<IMetaMethod> mMethod;
+    };
+
+    struct PendingMessage
+    {
+        PendingMessage(
+            /* [in] */ DBusMessage* msg)
+            : mMessage(msg)
+            , mNext(nullptr)
+        {}
+
+        DBusMessage* mMessage;
+        PendingMessage* mNext;
     };
 
 public:
@@ -61,6 +95,8 @@ public:
         /* [in] */ RPCType type,
         /* [in] */ RPCPeer peer);
 
+    ~CDBusChannel();
+
     CCM_INTERFACE_DECL();
 
     CCM_OBJECT_DECL();
@@ -88,6 +124,12 @@ public:
         /* [in] */ IParcel* argParcel,
         /* [out] */ IParcel** resParcel) override;
 
+    ECode InvokeAsync(
+        /* [in] */ IProxy* proxy,
+        /* [in] */ IMetaMethod* method,
+        /* [in] */ IParcel* argParcel,
+        /* [out] */ IInvocationFuture** future) override;
+
     ECode StartListening(
         /* [in] */ IStub* stub) override;
 
@@ -101,26 +143,107 @@ public:
     static CDBusChannel* GetStubChannel(
         /* [in] */ IStub* stub);
 
+    static void ReleaseAllConnections();
+
+    static void ReleaseServiceConnection();
+
 private:
+    ECode AcquireConnection(
+        /* [out] */ DBusConnection** conn);
+
+    void ResetConnection(
+        /* [in] */ DBusConnection* conn);
+
+    void ReleaseConnectionLocked();
+
+    DBusMessage* NewInvokeMessage(
+        /* [in] */ IParcel* argParcel);
+
+    // Sends |msg| and flushes it, |pending| is null if no reply is
+    // expected.
+    ECode SendMessage(
+        /* [in] */ DBusMessage* msg,
+        /* [out] */ DBusPendingCall** pending);
+
+    ECode ParseReplyMessage(
+        /* [in] */ DBusMessage* reply,
+        /* [in] */ IMetaMethod* method,
+        /* [out] */ IParcel** resParcel);
+
+    static ECode AcquireServiceConnection(
+        /* [out] */ DBusConnection** conn);
+
+    static void* ServiceThreadEntry(
+        /* [in] */ void* arg);
+
+    static void WakeUpServiceThread(
+        /* [in] */ void* data);
+
+    static DBusHandlerResult HandleMessage(
+        /* [in] */ DBusConnection* conn,
+        /* [in] */ DBusMessage* msg,
+        /* [in] */ void* arg);
+
+    static void UnregisterStub(
+        /* [in] */ DBusConnection* conn,
+        /* [in] */ void* arg);
+
+    ECode QueueMessage(
+        /* [in] */ IStub* target,
+        /* [in] */ DBusMessage* msg);
+
+    void ProcessMessage(
+        /* [in] */ IStub* target,
+        /* [in] */ DBusMessage* msg);
+
     ECode UnmarshalArguments(
+        /* [in] */ DBusMessage* msg,
         /* [in] */ void* data,
         /* [in] */ Long size,
-        /* [in] */ IMetaMethod* method,
         /* [in] */ IParcel* argParcel);
 
+    static DBusMessage* NewReplyMessage(
+        /* [in] */ DBusMessage* msg,
+        /* [in] */ ECode ec,
+        /* [in] */ IParcel* resParcel);
+
 private:
     friend class CDBusChannelFactory;
 
     static constexpr Boolean DEBUG = false;
     static constexpr const char* STUB_OBJECT_PATH = "/ccm/rpc/CStub";
     static constexpr const char* STUB_INTERFACE_PATH = "ccm.rpc.IStub";
+    static constexpr Integer MAX_RECONNECT_NUMBER = 1;
+
+    // Guards the cached connection of every channel and the list of
+    // channels which hold one.
+    static Mutex sConnectionsLock;
+    static CDBusChannel* sConnectedChannels;
+
+    // All stubs of the process share one bus connection, which is
+    // served by a single I/O thread. Stubs are told apart by their
+    // object paths and invocations run on the ThreadPoolExecutor.
+    static Mutex sServiceLock;
+    static DBusConnection* sServiceConnection;
+    static String sServiceName;
+    static pthread_t sServiceThread;
+    static int sServiceWakeFds[2];
+    static Boolean sServiceQuit;
+    static Integer sStubNumber;
 
     RPCType mType;
     RPCPeer mPeer;
     String mName;
-    Boolean mStarted;
+    String mObjectPath;
     Mutex mLock;
-    Condition mCond;
+    PendingMessage* mPendingHead;
+    PendingMessage* mPendingTail;
+    Boolean mDispatching;
+    // The cached bus connection used by the proxy side, or the
+    // shared service connection used by the stub side.
+    DBusConnection* mConnection;
+    CDBusChannel* mPrevConnected;
+    CDBusChannel* mNextConnected;
 };
 
 inline CDBusChannel* CDBusChannel::GetProxyChannel(
@@ -79,6 +79,7 @@ ECode CDBusChannelFactory::MarshalInterface(
     if (SUCCEEDED(ec)) {
         CDBusChannel* channel = CDBusChannel::GetStubChannel(stub);
         pack->SetDBusName(channel->mName);
+        pack->SetDBusObjectPath(channel->mObjectPath);
         pack->SetCoclassID(((CStub*)stub.Get())->GetTargetCoclassID());
         pack->SetInterfaceID(iid);
     }
@@ -87,6 +88,7 @@ ECode CDBusChannelFactory::MarshalInterface(
         if (proxy != nullptr) {
             CDBusChannel* channel = CDBusChannel::GetProxyChannel(proxy);
             pack->SetDBusName(channel->mName);
+            pack->SetDBusObjectPath(channel->mObjectPath);
             pack->SetCoclassID(((CProxy*)proxy)->GetTargetCoclassID());
             pack->SetInterfaceID(iid);
         }
@@ -99,6 +101,7 @@ ECode CDBusChannelFactory::MarshalInterface(
             }
             CDBusChannel* channel = CDBusChannel::GetStubChannel(stub);
             pack->SetDBusName(channel->mName);
+            pack->SetDBusObjectPath(channel->mObjectPath);
             pack->SetCoclassID(((CStub*)stub.Get())->GetTargetCoclassID());
             pack->SetInterfaceID(iid);
             RegisterExportObject(mType, IObject::Probe(object), stub);
@@ -147,6 +150,7 @@ ECode CDBusChannelFactory::UnmarshalInterface(
     }
     CDBusChannel* channel = CDBusChannel::GetProxyChannel(proxy);
     channel->mName = ((InterfacePack*)ipack)->GetDBusName();
+    channel->mObjectPath = ((InterfacePack*)ipack)->GetDBusObjectPath();
     RegisterImportObject(mType, ipack, IObject::Probe(proxy));
 
     proxy.MoveTo((IProxy**)object);
@@ -50,11 +50,16 @@ CDBusParcel::CDBusParcel()
     , mDataSize(0)
     , mDataCapacity(0)
     , mDataPos(0)
+    , mReleaseData(nullptr)
+    , mDataOwner(nullptr)
 {}
 
 CDBusParcel::~CDBusParcel()
 {
-    if (mData != nullptr) {
+    if (mReleaseData != nullptr) {
+        DropBorrowedData();
+    }
+    else if (mData != nullptr) {
         free(mData);
     }
 }
@@ -453,6 +458,8 @@ ECode CDBusParcel::WriteEnumeration(
     return WriteInteger(value);
 }
 
+// Arrays are copied out even from borrowed data, since an Array keeps
+// its elements in a SharedBuffer, which message memory can not be.
 ECode CDBusParcel::ReadArray(
     /* [out] */ HANDLE array)
 {
@@ -833,6 +840,58 @@ ECode CDBusParcel::SetData(
     return ec;
 }
 
+ECode CDBusParcel::SetBorrowedData(
+    /* [in] */ Byte* data,
+    /* [in] */ Long size,
+    /* [in] */ ReleaseDataFunc func,
+    /* [in] */ void* owner)
+{
+    if (size < 0 || (size > 0 && data == nullptr) || func == nullptr) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    if (mReleaseData != nullptr) {
+        DropBorrowedData();
+    }
+    else if (mData != nullptr) {
+        free(mData);
+    }
+
+    // With no capacity every write goes through ContinueWrite(), which
+    // takes the data over before touching it.
+    mReleaseData = func;
+    mDataOwner = owner;
+    mData = data;
+    mDataSize = size;
+    mDataCapacity = 0;
+    mDataPos = 0;
+    return NOERROR;
+}
+
+ECode CDBusParcel::SetBorrowedData(
+    /* [in] */ Byte* data,
+    /* [in] */ Long size,
+    /* [in] */ DBusMessage* msg)
+{
+    if (msg == nullptr) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    dbus_message_ref(msg);
+    ECode ec = SetBorrowedData(data, size, ReleaseDBusMessage, msg);
+    if (FAILED(ec)) {
+        dbus_message_unref(msg);
+    }
+    return ec;
+}
+
+void CDBusParcel::ReleaseDBusMessage(
+    /* [in] */ void* owner,
+    /* [in] */ Byte* data)
+{
+    dbus_message_unref(static_cast<DBusMessage*>(owner));
+}
+
 ECode CDBusParcel::GetDataSize(
     /* [out] */ Long* size)
 {
@@ -975,6 +1034,13 @@ ECode CDBusParcel::RestartWrite(
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
+    if (mReleaseData != nullptr) {
+        // The old content is discarded anyway, so there is nothing to copy.
+        DropBorrowedData();
+        mData = nullptr;
+        mDataCapacity = 0;
+    }
+
     Byte* data = (Byte*)realloc(mData, desired);
     if (data == nullptr && desired > mDataCapacity) {
         mError = E_OUT_OF_MEMORY_ERROR;
@@ -997,6 +1063,13 @@ ECode CDBusParcel::ContinueWrite(
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
+    if (mReleaseData != nullptr) {
+        ReleaseBorrowedData();
+        if (FAILED(mError)) {
+            return mError;
+        }
+    }
+
     if (mData != nullptr) {
         if (desired > mDataCapacity) {
             Byte* data = (Byte*)realloc(mData, desired);
@@ -1033,6 +1106,33 @@ ECode CDBusParcel::ContinueWrite(
     return NOERROR;
 }
 
+void CDBusParcel::ReleaseBorrowedData()
+{
+    Byte* data = nullptr;
+    if (mDataSize > 0) {
+        data = (Byte*)malloc(mDataSize);
+        if (data == nullptr) {
+            mError = E_OUT_OF_MEMORY_ERROR;
+            return;
+        }
+        memcpy(data, mData, mDataSize);
+    }
+
+    DropBorrowedData();
+    mData = data;
+    mDataCapacity = mDataSize;
+}
+
+void CDBusParcel::DropBorrowedData()
+{
+    ReleaseDataFunc func = mReleaseData;
+    void* owner = mDataOwner;
+    Byte* data = mData;
+    mReleaseData = nullptr;
+    mDataOwner = nullptr;
+    func(owner, data);
+}
+
 template<class T>
 ECode CDBusParcel::ReadAligned(
     /* [out] */ T* value) const
@@ -1042,9 +1142,10 @@ ECode CDBusParcel::ReadAligned(
     }
 
     if ((mDataPos + sizeof(T)) <= mDataSize) {
-        const void* data = mData + mDataPos;
+        // Borrowed data, e.g. the body of a D-Bus message, is only
+        // 4-byte aligned, so 8-byte values are copied out.
+        memcpy(value, mData + mDataPos, sizeof(T));
         mDataPos += sizeof(T);
-        *value = *reinterpret_cast<const T*>(data);
         return NOERROR;
     }
     else {
@@ -34,6 +34,7 @@
 #define __CCM_CDBUSPARCEL_H__
 
 #include "util/ccmobject.h"
+#include <dbus/dbus.h>
 
 namespace ccm {
 
@@ -162,10 +163,30 @@ public:
     ECode SetDataPosition(
         /* [in] */ Long pos);
 
+    // Called once the parcel no longer reads from borrowed data.
+    typedef void (*ReleaseDataFunc)(
+        /* [in] */ void* owner,
+        /* [in] */ Byte* data);
+
+    // Reads directly from |data| instead of copying it. |data| belongs to
+    // |owner|, which is released by |func| when the parcel is destroyed
+    // or written to; any write first moves the data into an owned buffer.
+    ECode SetBorrowedData(
+        /* [in] */ Byte* data,
+        /* [in] */ Long size,
+        /* [in] */ ReleaseDataFunc func,
+        /* [in] */ void* owner);
+
+    // Borrows the data of a message, which is kept alive by a reference.
+    ECode SetBorrowedData(
+        /* [in] */ Byte* data,
+        /* [in] */ Long size,
+        /* [in] */ DBusMessage* msg);
+
     static ECode CreateObject(
         /* [out] */ IParcel** parcel);
 
-private:
+protected:
     ECode Read(
         /* [in] */ void* outData,
         /* [in] */ Long len) const;
@@ -192,6 +213,14 @@ private:
     ECode ContinueWrite(
         /* [in] */ Long desired);
 
+    void ReleaseBorrowedData();
+
+    void DropBorrowedData();
+
+    static void ReleaseDBusMessage(
+        /* [in] */ void* owner,
+        /* [in] */ Byte* data);
+
     template<class T>
     ECode ReadAligned(
         /* [out] */ T* value) const;
@@ -200,7 +229,7 @@ private:
     ECode WriteAligned(
         /* [in] */ T value);
 
-private:
+protected:
     static constexpr Integer TAG_NULL = 0;
     static constexpr Integer TAG_NOT_NULL = 1;
 
@@ -209,6 +238,8 @@ private:
     Long mDataSize;
     Long mDataCapacity;
     mutable Long mDataPos;
+    ReleaseDataFunc mReleaseData;
+    void* mDataOwner;
 };
 
 }
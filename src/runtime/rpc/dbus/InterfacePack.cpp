@@ -63,7 +63,7 @@ ECode InterfacePack::GetHashCode(
 {
     VALIDATE_NOT_NULL(hash);
 
-    *hash = mDBusName.GetHashCode();
+    *hash = mDBusName.GetHashCode() * 31 + mDBusObjectPath.GetHashCode();
     return NOERROR;
 }
 
@@ -71,6 +71,7 @@ ECode InterfacePack::ReadFromParcel(
     /* [in] */ IParcel* source)
 {
     source->ReadString(&mDBusName);
+    source->ReadString(&mDBusObjectPath);
     source->ReadCoclassID(&mCid);
     source->ReadInterfaceID(&mIid);
     return NOERROR;
@@ -80,6 +81,7 @@ ECode InterfacePack::WriteToParcel(
     /* [in] */ IParcel* dest)
 {
     dest->WriteString(mDBusName);
+    dest->WriteString(mDBusObjectPath);
     dest->WriteCoclassID(mCid);
     dest->WriteInterfaceID(mIid);
     return NOERROR;
@@ -96,6 +98,17 @@ void InterfacePack::SetDBusName(
     mDBusName = name;
 }
 
+String InterfacePack::GetDBusObjectPath()
+{
+    return mDBusObjectPath;
+}
+
+void InterfacePack::SetDBusObjectPath(
+    /* [in] */ const String& path)
+{
+    mDBusObjectPath = path;
+}
+
 void InterfacePack::SetCoclassID(
     /* [in] */ const CoclassID& cid)
 {
@@ -67,6 +67,11 @@ public:
     void SetDBusName(
         /* [in] */ const String& name);
 
+    String GetDBusObjectPath();
+
+    void SetDBusObjectPath(
+        /* [in] */ const String& path);
+
     void SetCoclassID(
         /* [in] */ const CoclassID& cid);
 
@@ -75,6 +80,7 @@ public:
 
 private:
     String mDBusName;
+    String mDBusObjectPath;
     CoclassID mCid;
     InterfaceID mIid;
 };
@@ -0,0 +1,91 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "invocationfuture.h"
+#include "threadpoolexecutor.h"
+
+namespace ccm {
+
+CCM_INTERFACE_IMPL_LIGHT_1(InvocationFuture, LightRefBase, IInvocationFuture);
+
+InvocationFuture::InvocationFuture()
+    : mCond(mLock)
+    , mDone(false)
+    , mResult(NOERROR)
+{}
+
+ECode InvocationFuture::IsDone(
+    /* [out] */ Boolean* done)
+{
+    VALIDATE_NOT_NULL(done);
+
+    Mutex::AutoLock lock(mLock);
+    *done = mDone;
+    return NOERROR;
+}
+
+ECode InvocationFuture::Wait()
+{
+    Mutex::AutoLock lock(mLock);
+    if (!mDone) {
+        ThreadPoolExecutor::BlockingScope blocking;
+        while (!mDone) {
+            mCond.Wait();
+        }
+    }
+    return mResult;
+}
+
+ECode InvocationFuture::GetReply(
+    /* [out] */ IParcel** resParcel)
+{
+    VALIDATE_NOT_NULL(resParcel);
+
+    ECode ec = Wait();
+    if (FAILED(ec)) {
+        *resParcel = nullptr;
+        return ec;
+    }
+    Mutex::AutoLock lock(mLock);
+    *resParcel = mReply;
+    REFCOUNT_ADD(*resParcel);
+    return NOERROR;
+}
+
+void InvocationFuture::Complete(
+    /* [in] */ ECode ec,
+    /* [in] */ IParcel* resParcel)
+{
+    Mutex::AutoLock lock(mLock);
+    if (mDone) {
+        return;
+    }
+    mResult = ec;
+    mReply = resParcel;
+    mDone = true;
+    mCond.SignalAll();
+}
+
+AutoPtr<InvocationFuture> InvocationFuture::CreateCompleted(
+    /* [in] */ ECode ec,
+    /* [in] */ IParcel* resParcel)
+{
+    AutoPtr<InvocationFuture> future = new InvocationFuture();
+    future->Complete(ec, resParcel);
+    return future;
+}
+
+}
@@ -0,0 +1,65 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_INVOCATIONFUTURE_H__
+#define __CCM_INVOCATIONFUTURE_H__
+
+#include "ccmtypes.h"
+#include "util/ccmautoptr.h"
+#include "util/ccmrefbase.h"
+#include "util/mutex.h"
+
+namespace ccm {
+
+// The result of an invocation which is completed by another thread,
+// such as the reader thread of a connection.
+class InvocationFuture
+    : public LightRefBase
+    , public IInvocationFuture
+{
+public:
+    InvocationFuture();
+
+    CCM_INTERFACE_DECL();
+
+    ECode IsDone(
+        /* [out] */ Boolean* done) override;
+
+    ECode Wait() override;
+
+    ECode GetReply(
+        /* [out] */ IParcel** resParcel) override;
+
+    // Only the first completion counts.
+    void Complete(
+        /* [in] */ ECode ec,
+        /* [in] */ IParcel* resParcel);
+
+    static AutoPtr<InvocationFuture> CreateCompleted(
+        /* [in] */ ECode ec,
+        /* [in] */ IParcel* resParcel = nullptr);
+
+protected:
+    Mutex mLock;
+    Condition mCond;
+    Boolean mDone;
+    ECode mResult;
+    AutoPtr<IParcel> mReply;
+};
+
+}
+
+#endif // __CCM_INVOCATIONFUTURE_H__
@@ -15,44 +15,348 @@
 //=========================================================================
 
 #include "registry.h"
-#include "util/hashmap.h"
+#include "util/ccmlogger.h"
 #include "util/mutex.h"
+#include <atomic>
+#include <stdint.h>
+#include <stdlib.h>
 
 namespace ccm {
 
-template<>
-struct HashFunc<IObject*>
+// A map keyed by the identity of the key pointer. It is split into shards,
+// each with its own lock and its own table, which doubles when it is three
+// quarters full. Lookups hash the pointer value instead of calling
+// GetHashCode(), and run under the lock of one shard only. Like the
+// HashMap it replaces, the registry holds a reference to every key and
+// value; they are released after the shard is unlocked, as releasing
+// may run a destructor which comes back to the registry.
+template<class Key, class Val>
+class Registry
 {
-    inline Integer operator()(
-        /* [in] */ IObject* data)
+private:
+    struct Bucket
     {
-        Integer hash;
-        data->GetHashCode(&hash);
-        return hash;
-    }
+        Key mKey;
+        Val mValue;
+        Bucket* mNext;
+    };
+
+    struct alignas(64) Shard
+    {
+        Shard()
+            : mBuckets(nullptr)
+            , mBucketSize(0)
+            , mCount(0)
+            , mLookupCount(0)
+            , mLockWaitCount(0)
+        {}
+
+        Mutex mLock;
+        Bucket** mBuckets;
+        Integer mBucketSize;
+        Integer mCount;
+        std::atomic<Long> mLookupCount;
+        std::atomic<Long> mLockWaitCount;
+    };
+
+    class ShardLock
+    {
+    public:
+        explicit ShardLock(
+            /* [in] */ Shard& shard)
+            : mShard(shard)
+        {
+            if (!mShard.mLock.TryLock()) {
+                mShard.mLockWaitCount.fetch_add(1, std::memory_order_relaxed);
+                mShard.mLock.Lock();
+            }
+        }
+
+        ~ShardLock()
+        {
+            mShard.mLock.Unlock();
+        }
+
+    private:
+        Shard& mShard;
+    };
+
+public:
+    ~Registry();
+
+    Boolean Put(
+        /* [in] */ Key key,
+        /* [in] */ Val value);
+
+    Boolean Remove(
+        /* [in] */ Key key);
+
+    // The value is referenced before the shard is unlocked.
+    Boolean Get(
+        /* [in] */ Key key,
+        /* [out] */ Val* value);
+
+    // Visits the values one shard at a time until |func| returns true,
+    // whose value is then referenced and returned.
+    template<class Func>
+    Boolean Find(
+        /* [in] */ Func func,
+        /* [out] */ Val* value);
+
+    void GetStatistics(
+        /* [out] */ RegistryStatistics* stats);
+
+private:
+    inline static uint64_t HashKey(
+        /* [in] */ Key key);
+
+    inline Shard& GetShard(
+        /* [in] */ uint64_t hash);
+
+    Boolean Grow(
+        /* [in] */ Shard& shard);
+
+private:
+    static constexpr Integer SHARD_SHIFT = 4;
+    static constexpr Integer SHARD_NUMBER = 1 << SHARD_SHIFT;
+    static constexpr Integer MIN_BUCKET_SIZE = 16;
+
+    Shard mShards[SHARD_NUMBER];
 };
 
-template<>
-struct HashFunc<IInterfacePack*>
+template<class Key, class Val>
+Registry<Key, Val>::~Registry()
 {
-    inline Integer operator()(
-        /* [in] */ IInterfacePack* data)
+    // A stub released here unregisters itself, so each shard is emptied
+    // before its buckets are released.
+    for (Integer i = 0; i < SHARD_NUMBER; i++) {
+        Shard& shard = mShards[i];
+        Bucket** buckets = shard.mBuckets;
+        Integer bucketSize = shard.mBucketSize;
+        shard.mBuckets = nullptr;
+        shard.mBucketSize = 0;
+        shard.mCount = 0;
+        for (Integer j = 0; j < bucketSize; j++) {
+            Bucket* curr = buckets[j];
+            while (curr != nullptr) {
+                Bucket* next = curr->mNext;
+                REFCOUNT_RELEASE(curr->mKey);
+                REFCOUNT_RELEASE(curr->mValue);
+                delete curr;
+                curr = next;
+            }
+        }
+        free(buckets);
+    }
+}
+
+template<class Key, class Val>
+uint64_t Registry<Key, Val>::HashKey(
+    /* [in] */ Key key)
+{
+    // The finalizer of MurmurHash3, objects are aligned so the low bits
+    // of the address carry little.
+    uint64_t h = reinterpret_cast<uintptr_t>(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return h;
+}
+
+template<class Key, class Val>
+typename Registry<Key, Val>::Shard& Registry<Key, Val>::GetShard(
+    /* [in] */ uint64_t hash)
+{
+    return mShards[hash >> (64 - SHARD_SHIFT)];
+}
+
+template<class Key, class Val>
+Boolean Registry<Key, Val>::Put(
+    /* [in] */ Key key,
+    /* [in] */ Val value)
+{
+    uint64_t hash = HashKey(key);
+    Shard& shard = GetShard(hash);
+    Val oldValue = nullptr;
     {
-        Integer hash;
-        data->GetHashCode(&hash);
-        return hash;
+        ShardLock lock(shard);
+
+        Bucket* b = nullptr;
+        if (shard.mBucketSize != 0) {
+            b = shard.mBuckets[hash & (shard.mBucketSize - 1)];
+            while (b != nullptr && b->mKey != key) {
+                b = b->mNext;
+            }
+        }
+        if (b == nullptr) {
+            if (shard.mCount >= shard.mBucketSize - (shard.mBucketSize >> 2)) {
+                // A full table is kept if it can not grow, the chains just
+                // get longer.
+                if (!Grow(shard) && shard.mBucketSize == 0) {
+                    return false;
+                }
+            }
+            b = new Bucket();
+            b->mKey = key;
+            b->mValue = nullptr;
+            REFCOUNT_ADD(key);
+            Bucket** head = &shard.mBuckets[hash & (shard.mBucketSize - 1)];
+            b->mNext = *head;
+            *head = b;
+            shard.mCount++;
+        }
+        oldValue = b->mValue;
+        b->mValue = value;
+        REFCOUNT_ADD(value);
     }
-};
+    REFCOUNT_RELEASE(oldValue);
+    return true;
+}
 
-static HashMap<IObject*, IStub*> sLocalExportRegistry;
-static Mutex sLocalExportRegistryLock;
-static HashMap<IObject*, IStub*> sRemoteExportRegistry;
-static Mutex sRemoteExportRegistryLock;
+template<class Key, class Val>
+Boolean Registry<Key, Val>::Remove(
+    /* [in] */ Key key)
+{
+    uint64_t hash = HashKey(key);
+    Shard& shard = GetShard(hash);
+    Bucket* removed = nullptr;
+    {
+        ShardLock lock(shard);
 
-static HashMap<IInterfacePack*, IObject*> sLocalImportRegistry;
-static Mutex sLocalImportRegistryLock;
-static HashMap<IInterfacePack*, IObject*> sRemoteImportRegistry;
-static Mutex sRemoteImportRegistryLock;
+        if (shard.mBucketSize == 0) {
+            return false;
+        }
+        Bucket** pb = &shard.mBuckets[hash & (shard.mBucketSize - 1)];
+        while (*pb != nullptr && (*pb)->mKey != key) {
+            pb = &(*pb)->mNext;
+        }
+        if (*pb == nullptr) {
+            return false;
+        }
+        removed = *pb;
+        *pb = removed->mNext;
+        shard.mCount--;
+    }
+    REFCOUNT_RELEASE(removed->mKey);
+    REFCOUNT_RELEASE(removed->mValue);
+    delete removed;
+    return true;
+}
+
+template<class Key, class Val>
+Boolean Registry<Key, Val>::Get(
+    /* [in] */ Key key,
+    /* [out] */ Val* value)
+{
+    uint64_t hash = HashKey(key);
+    Shard& shard = GetShard(hash);
+    shard.mLookupCount.fetch_add(1, std::memory_order_relaxed);
+    ShardLock lock(shard);
+
+    if (shard.mBucketSize != 0) {
+        for (Bucket* curr = shard.mBuckets[hash & (shard.mBucketSize - 1)];
+                curr != nullptr; curr = curr->mNext) {
+            if (curr->mKey == key) {
+                *value = curr->mValue;
+                REFCOUNT_ADD(*value);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template<class Key, class Val>
+template<class Func>
+Boolean Registry<Key, Val>::Find(
+    /* [in] */ Func func,
+    /* [out] */ Val* value)
+{
+    for (Integer i = 0; i < SHARD_NUMBER; i++) {
+        Shard& shard = mShards[i];
+        shard.mLookupCount.fetch_add(1, std::memory_order_relaxed);
+        ShardLock lock(shard);
+
+        for (Integer j = 0; j < shard.mBucketSize; j++) {
+            for (Bucket* curr = shard.mBuckets[j];
+                    curr != nullptr; curr = curr->mNext) {
+                if (func(curr->mValue)) {
+                    *value = curr->mValue;
+                    REFCOUNT_ADD(*value);
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+template<class Key, class Val>
+void Registry<Key, Val>::GetStatistics(
+    /* [out] */ RegistryStatistics* stats)
+{
+    stats->mObjectCount = 0;
+    stats->mLookupCount = 0;
+    stats->mLockWaitCount = 0;
+    for (Integer i = 0; i < SHARD_NUMBER; i++) {
+        Shard& shard = mShards[i];
+        {
+            Mutex::AutoLock lock(shard.mLock);
+            stats->mObjectCount += shard.mCount;
+        }
+        stats->mLookupCount += shard.mLookupCount.load(std::memory_order_relaxed);
+        stats->mLockWaitCount += shard.mLockWaitCount.load(std::memory_order_relaxed);
+    }
+}
+
+template<class Key, class Val>
+Boolean Registry<Key, Val>::Grow(
+    /* [in] */ Shard& shard)
+{
+    Integer newSize = shard.mBucketSize == 0 ?
+            MIN_BUCKET_SIZE : shard.mBucketSize * 2;
+    Bucket** newBuckets = (Bucket**)calloc(newSize, sizeof(Bucket*));
+    if (newBuckets == nullptr) {
+        Logger::E("Registry", "Calloc %d buckets failed.", newSize);
+        return false;
+    }
+    for (Integer i = 0; i < shard.mBucketSize; i++) {
+        Bucket* curr = shard.mBuckets[i];
+        while (curr != nullptr) {
+            Bucket* next = curr->mNext;
+            Bucket** head = &newBuckets[HashKey(curr->mKey) & (newSize - 1)];
+            curr->mNext = *head;
+            *head = curr;
+            curr = next;
+        }
+    }
+    free(shard.mBuckets);
+    shard.mBuckets = newBuckets;
+    shard.mBucketSize = newSize;
+    return true;
+}
+
+//----------------------------------------------------------------------
+
+static Registry<IObject*, IStub*> sLocalExportRegistry;
+static Registry<IObject*, IStub*> sRemoteExportRegistry;
+
+static Registry<IInterfacePack*, IObject*> sLocalImportRegistry;
+static Registry<IInterfacePack*, IObject*> sRemoteImportRegistry;
+
+static inline Registry<IObject*, IStub*>& GetExportRegistry(
+    /* [in] */ RPCType type)
+{
+    return type == RPCType::Local ?
+            sLocalExportRegistry : sRemoteExportRegistry;
+}
+
+static inline Registry<IInterfacePack*, IObject*>& GetImportRegistry(
+    /* [in] */ RPCType type)
+{
+    return type == RPCType::Local ?
+            sLocalImportRegistry : sRemoteImportRegistry;
+}
 
 ECode RegisterExportObject(
     /* [in] */ RPCType type,
@@ -63,14 +367,8 @@ ECode RegisterExportObject(
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    HashMap<IObject*, IStub*>& registry = type == RPCType::Local ?
-            sLocalExportRegistry : sRemoteExportRegistry;
-    Mutex& registryLock = type == RPCType::Local ?
-            sLocalExportRegistryLock : sRemoteExportRegistryLock;
-
-    Mutex::AutoLock lock(registryLock);
-    registry.Put(object, stub);
-    return NOERROR;
+    return GetExportRegistry(type).Put(object, stub) ?
+            NOERROR : E_OUT_OF_MEMORY_ERROR;
 }
 
 ECode UnregisterExportObject(
@@ -81,17 +379,8 @@ ECode UnregisterExportObject(
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    HashMap<IObject*, IStub*>& registry = type == RPCType::Local ?
-            sLocalExportRegistry : sRemoteExportRegistry;
-    Mutex& registryLock = type == RPCType::Local ?
-            sLocalExportRegistryLock : sRemoteExportRegistryLock;
-
-    Mutex::AutoLock lock(registryLock);
-    if (registry.ContainsKey(object)) {
-        registry.Remove(object);
-        return NOERROR;
-    }
-    return E_NOT_FOUND_EXCEPTION;
+    return GetExportRegistry(type).Remove(object) ?
+            NOERROR : E_NOT_FOUND_EXCEPTION;
 }
 
 ECode FindExportObject(
@@ -101,24 +390,13 @@ ECode FindExportObject(
 {
     VALIDATE_NOT_NULL(stub);
 
+    *stub = nullptr;
     if (object == nullptr) {
-        *stub = nullptr;
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    HashMap<IObject*, IStub*>& registry = type == RPCType::Local ?
-            sLocalExportRegistry : sRemoteExportRegistry;
-    Mutex& registryLock = type == RPCType::Local ?
-            sLocalExportRegistryLock : sRemoteExportRegistryLock;
-
-    Mutex::AutoLock lock(registryLock);
-    if (registry.ContainsKey(object)) {
-        *stub = registry.Get(object);
-        REFCOUNT_ADD(*stub);
-        return NOERROR;
-    }
-    *stub = nullptr;
-    return E_NOT_FOUND_EXCEPTION;
+    return GetExportRegistry(type).Get(object, stub) ?
+            NOERROR : E_NOT_FOUND_EXCEPTION;
 }
 
 ECode FindExportObject(
@@ -128,30 +406,18 @@ ECode FindExportObject(
 {
     VALIDATE_NOT_NULL(stub);
 
+    *stub = nullptr;
     if (ipack == nullptr) {
-        *stub = nullptr;
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    HashMap<IObject*, IStub*>& registry = type == RPCType::Local ?
-            sLocalExportRegistry : sRemoteExportRegistry;
-    Mutex& registryLock = type == RPCType::Local ?
-            sLocalExportRegistryLock : sRemoteExportRegistryLock;
-
-    Mutex::AutoLock lock(registryLock);
-    Array<IStub*> stubs = registry.GetValues();
-    for (Long i = 0; i < stubs.GetLength(); i++) {
-        IStub* stubObj = stubs[i];
-        Boolean matched;
-        stubObj->Match(ipack, &matched);
-        if (matched) {
-            *stub = stubObj;
-            REFCOUNT_ADD(*stub);
-            return NOERROR;
-        }
-    }
-    *stub = nullptr;
-    return E_NOT_FOUND_EXCEPTION;
+    Boolean found = GetExportRegistry(type).Find(
+            [ipack](IStub* stubObj) -> Boolean {
+                Boolean matched;
+                stubObj->Match(ipack, &matched);
+                return matched;
+            }, stub);
+    return found ? NOERROR : E_NOT_FOUND_EXCEPTION;
 }
 
 ECode RegisterImportObject(
@@ -163,14 +429,8 @@ ECode RegisterImportObject(
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    HashMap<IInterfacePack*, IObject*>& registry = type == RPCType::Local ?
-            sLocalImportRegistry : sRemoteImportRegistry;
-    Mutex& registryLock = type == RPCType::Local ?
-            sLocalImportRegistryLock : sRemoteImportRegistryLock;
-
-    Mutex::AutoLock lock(registryLock);
-    registry.Put(ipack, object);
-    return NOERROR;
+    return GetImportRegistry(type).Put(ipack, object) ?
+            NOERROR : E_OUT_OF_MEMORY_ERROR;
 }
 
 ECode UnregisterImportObject(
@@ -181,17 +441,8 @@ ECode UnregisterImportObject(
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    HashMap<IInterfacePack*, IObject*>& registry = type == RPCType::Local ?
-            sLocalImportRegistry : sRemoteImportRegistry;
-    Mutex& registryLock = type == RPCType::Local ?
-            sLocalImportRegistryLock : sRemoteImportRegistryLock;
-
-    Mutex::AutoLock lock(registryLock);
-    if (registry.ContainsKey(ipack)) {
-        registry.Remove(ipack);
-        return NOERROR;
-    }
-    return E_NOT_FOUND_EXCEPTION;
+    return GetImportRegistry(type).Remove(ipack) ?
+            NOERROR : E_NOT_FOUND_EXCEPTION;
 }
 
 ECode FindImportObject(
@@ -201,24 +452,27 @@ ECode FindImportObject(
 {
     VALIDATE_NOT_NULL(object);
 
+    *object = nullptr;
     if (ipack == nullptr) {
-        *object = nullptr;
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    HashMap<IInterfacePack*, IObject*>& registry = type == RPCType::Local ?
-            sLocalImportRegistry : sRemoteImportRegistry;
-    Mutex& registryLock = type == RPCType::Local ?
-            sLocalImportRegistryLock : sRemoteImportRegistryLock;
-
-    Mutex::AutoLock lock(registryLock);
-    if (registry.ContainsKey(ipack)) {
-        *object = registry.Get(ipack);
-        REFCOUNT_ADD(*object);
-        return NOERROR;
-    }
-    *object = nullptr;
-    return E_NOT_FOUND_EXCEPTION;
+    return GetImportRegistry(type).Get(ipack, object) ?
+            NOERROR : E_NOT_FOUND_EXCEPTION;
+}
+
+void GetExportRegistryStatistics(
+    /* [in] */ RPCType type,
+    /* [out] */ RegistryStatistics* stats)
+{
+    GetExportRegistry(type).GetStatistics(stats);
+}
+
+void GetImportRegistryStatistics(
+    /* [in] */ RPCType type,
+    /* [out] */ RegistryStatistics* stats)
+{
+    GetImportRegistry(type).GetStatistics(stats);
 }
 
 }
@@ -21,6 +21,17 @@
 
 namespace ccm {
 
+struct RegistryStatistics
+{
+    // The objects in the registry.
+    Long mObjectCount;
+    // The lookups done so far, a scan over all the objects counts once
+    // for each shard.
+    Long mLookupCount;
+    // The lock acquisitions which had to wait for another thread.
+    Long mLockWaitCount;
+};
+
 extern ECode RegisterExportObject(
     /* [in] */ RPCType type,
     /* [in] */ IObject* object,
@@ -54,6 +65,14 @@ extern ECode FindImportObject(
     /* [in] */ IInterfacePack* ipack,
     /* [out] */ IObject** object);
 
+extern void GetExportRegistryStatistics(
+    /* [in] */ RPCType type,
+    /* [out] */ RegistryStatistics* stats);
+
+extern void GetImportRegistryStatistics(
+    /* [in] */ RPCType type,
+    /* [out] */ RegistryStatistics* stats);
+
 }
 
 #endif // __CCM_REGISTRY_H__
@@ -0,0 +1,320 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "rpcstatistics.h"
+#include "registry.h"
+#include "reflection/CMetaMethod.h"
+#include "util/ccmlogger.h"
+#include "util/mutex.h"
+#include <pthread.h>
+#include <stdlib.h>
+
+namespace ccm {
+
+std::atomic<Boolean> RPCStatistics::sEnabled(false);
+
+// Entries are never freed, a MarshalPlan may cache them for as long as
+// the process lives.
+static Mutex sStatisticsLock;
+static RPCMethodStatistics* sStatistics = nullptr;
+
+static Mutex sDumpLock;
+static Condition sDumpCond(sDumpLock);
+static Integer sDumpInterval = 0;
+static Boolean sDumpThreadStarted = false;
+
+void RPCStatistics::SetEnabled(
+    /* [in] */ Boolean enabled)
+{
+    sEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+ECode RPCStatistics::SetDumpInterval(
+    /* [in] */ Integer seconds)
+{
+    if (seconds < 0) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    Mutex::AutoLock lock(sDumpLock);
+    sDumpInterval = seconds;
+    if (seconds > 0 && !sDumpThreadStarted) {
+        pthread_t thread;
+        int ret = pthread_create(&thread, nullptr,
+                RPCStatistics::DumpThreadEntry, nullptr);
+        if (ret != 0) {
+            Logger::E("RPCStatistics", "Create dump thread failed, error is %d.", ret);
+            sDumpInterval = 0;
+            return E_RUNTIME_EXCEPTION;
+        }
+        pthread_detach(thread);
+        sDumpThreadStarted = true;
+    }
+    sDumpCond.Signal();
+    return NOERROR;
+}
+
+void* RPCStatistics::DumpThreadEntry(
+    /* [in] */ void* arg)
+{
+    while (true) {
+        {
+            Mutex::AutoLock lock(sDumpLock);
+            while (sDumpInterval == 0) {
+                sDumpCond.Wait();
+            }
+            Integer interval = sDumpInterval;
+            sDumpCond.TimedWait((int64_t)interval * 1000, 0);
+            // Woken up early by a new interval, start over with it.
+            if (sDumpInterval != interval) {
+                continue;
+            }
+        }
+
+        String report = Dump();
+        const char* line = report.string();
+        while (line != nullptr && *line != '\0') {
+            const char* end = strchr(line, '\n');
+            Integer length = end != nullptr ? end - line : strlen(line);
+            Logger::D("RPCStatistics", "%.*s", length, line);
+            line = end != nullptr ? end + 1 : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+RPCMethodStatistics* RPCStatistics::Get(
+    /* [in] */ IMetaMethod* method,
+    /* [in] */ RPCMethodStatistics::Side side)
+{
+    MarshalPlan* plan = ((CMetaMethod*)method)->GetMarshalPlan();
+    if (plan == nullptr) {
+        return nullptr;
+    }
+    RPCMethodStatistics* stats = plan->mStatistics[side].load(
+            std::memory_order_acquire);
+    if (stats == nullptr) {
+        stats = Create(method, side);
+        plan->mStatistics[side].store(stats, std::memory_order_release);
+    }
+    return stats;
+}
+
+RPCMethodStatistics* RPCStatistics::Create(
+    /* [in] */ IMetaMethod* method,
+    /* [in] */ RPCMethodStatistics::Side side)
+{
+    AutoPtr<IMetaInterface> intf;
+    method->GetInterface(&intf);
+    InterfaceID iid;
+    intf->GetInterfaceID(&iid);
+    Integer index = ((CMetaMethod*)method)->mIndex;
+
+    // The proxy and the stub of one process, or two components loaded
+    // twice, share the entry of a method.
+    Mutex::AutoLock lock(sStatisticsLock);
+    for (RPCMethodStatistics* s = sStatistics; s != nullptr; s = s->mNext) {
+        if (s->mIid == iid.mUuid && s->mMethodIndex == index && s->mSide == side) {
+            return s;
+        }
+    }
+
+    String ns, intfName, name, signature;
+    intf->GetNamespace(&ns);
+    intf->GetName(&intfName);
+    method->GetName(&name);
+    method->GetSignature(&signature);
+
+    RPCMethodStatistics* stats = new RPCMethodStatistics();
+    stats->mIid = iid.mUuid;
+    stats->mMethodIndex = index;
+    stats->mSide = side;
+    stats->mName = String::Format("%s%s::%s(%s)", ns.string(),
+            intfName.string(), name.string(), signature.string());
+    stats->mCallCount.store(0, std::memory_order_relaxed);
+    stats->mFailureCount.store(0, std::memory_order_relaxed);
+    stats->mBytesSent.store(0, std::memory_order_relaxed);
+    stats->mBytesReceived.store(0, std::memory_order_relaxed);
+    for (Integer i = 0; i < RPCMethodStatistics::PHASE_NUMBER; i++) {
+        RPCMethodStatistics::Histogram& h = stats->mHistograms[i];
+        for (Integer j = 0; j < RPCMethodStatistics::BUCKET_NUMBER; j++) {
+            h.mBuckets[j].store(0, std::memory_order_relaxed);
+        }
+        h.mTotalNanos.store(0, std::memory_order_relaxed);
+    }
+    stats->mNext = sStatistics;
+    sStatistics = stats;
+    return stats;
+}
+
+void RPCStatistics::Record(
+    /* [in] */ RPCMethodStatistics* stats,
+    /* [in] */ RPCMethodStatistics::Phase phase,
+    /* [in] */ Long nanos)
+{
+    if (nanos < 1) {
+        nanos = 1;
+    }
+    Integer bucket = 63 - __builtin_clzll((unsigned long long)nanos);
+    if (bucket >= RPCMethodStatistics::BUCKET_NUMBER) {
+        bucket = RPCMethodStatistics::BUCKET_NUMBER - 1;
+    }
+    RPCMethodStatistics::Histogram& h = stats->mHistograms[phase];
+    h.mBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    h.mTotalNanos.fetch_add(nanos, std::memory_order_relaxed);
+}
+
+void RPCStatistics::RecordCall(
+    /* [in] */ RPCMethodStatistics* stats,
+    /* [in] */ ECode ec,
+    /* [in] */ IParcel* sent,
+    /* [in] */ IParcel* received)
+{
+    stats->mCallCount.fetch_add(1, std::memory_order_relaxed);
+    if (FAILED(ec)) {
+        stats->mFailureCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    Long size;
+    if (sent != nullptr) {
+        sent->GetDataSize(&size);
+        stats->mBytesSent.fetch_add(size, std::memory_order_relaxed);
+    }
+    if (received != nullptr) {
+        received->GetDataSize(&size);
+        stats->mBytesReceived.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+static void DumpHistogram(
+    /* [in] */ const char* name,
+    /* [in] */ RPCMethodStatistics::Histogram& h,
+    /* [out] */ StringBuilder& report)
+{
+    Long counts[RPCMethodStatistics::BUCKET_NUMBER];
+    Long total = 0;
+    for (Integer i = 0; i < RPCMethodStatistics::BUCKET_NUMBER; i++) {
+        counts[i] = h.mBuckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return;
+    }
+
+    // A percentile is reported as the upper bound of its bucket.
+    Long p50 = 0, p99 = 0, max = 0;
+    Long seen = 0;
+    for (Integer i = 0; i < RPCMethodStatistics::BUCKET_NUMBER; i++) {
+        if (counts[i] == 0) {
+            continue;
+        }
+        seen += counts[i];
+        Long bound = 2ll << i;
+        if (p50 == 0 && seen * 2 >= total) {
+            p50 = bound;
+        }
+        if (p99 == 0 && seen * 100 >= total * 99) {
+            p99 = bound;
+        }
+        max = bound;
+    }
+    Long avg = h.mTotalNanos.load(std::memory_order_relaxed) / total;
+    report.AppendFormat(" %s[avg=%lldns p50<%lldns p99<%lldns max<%lldns]",
+            name, avg, p50, p99, max);
+}
+
+String RPCStatistics::Dump()
+{
+    static const char* const PHASE_NAMES[RPCMethodStatistics::PHASE_NUMBER] =
+            { "marshal", "transport", "unmarshal", "dispatch" };
+    static const char* const SIDE_NAMES[RPCMethodStatistics::SIDE_NUMBER] =
+            { "proxy", "stub" };
+
+    StringBuilder report;
+    RPCMethodStatistics* head;
+    {
+        Mutex::AutoLock lock(sStatisticsLock);
+        head = sStatistics;
+    }
+    // Entries are only ever pushed at the head, so the list from |head|
+    // on can be walked without the lock.
+    for (RPCMethodStatistics* s = head; s != nullptr; s = s->mNext) {
+        Long calls = s->mCallCount.load(std::memory_order_relaxed);
+        if (calls == 0) {
+            continue;
+        }
+        report.AppendFormat("%s %s calls=%lld failures=%lld sent=%lld received=%lld",
+                SIDE_NAMES[s->mSide], s->mName.string(), calls,
+                s->mFailureCount.load(std::memory_order_relaxed),
+                s->mBytesSent.load(std::memory_order_relaxed),
+                s->mBytesReceived.load(std::memory_order_relaxed));
+        for (Integer i = 0; i < RPCMethodStatistics::PHASE_NUMBER; i++) {
+            DumpHistogram(PHASE_NAMES[i], s->mHistograms[i], report);
+        }
+        report.Append('\n');
+    }
+
+    for (Integer i = 0; i < 2; i++) {
+        RPCType type = i == 0 ? RPCType::Local : RPCType::Remote;
+        const char* typeName = i == 0 ? "local" : "remote";
+        RegistryStatistics exports, imports;
+        GetExportRegistryStatistics(type, &exports);
+        GetImportRegistryStatistics(type, &imports);
+        report.AppendFormat("registry %s exports=%lld lookups=%lld lockWaits=%lld "
+                "imports=%lld lookups=%lld lockWaits=%lld\n", typeName,
+                exports.mObjectCount, exports.mLookupCount, exports.mLockWaitCount,
+                imports.mObjectCount, imports.mLookupCount, imports.mLockWaitCount);
+    }
+    return report.ToString();
+}
+
+void RPCStatistics::Reset()
+{
+    Mutex::AutoLock lock(sStatisticsLock);
+    for (RPCMethodStatistics* s = sStatistics; s != nullptr; s = s->mNext) {
+        s->mCallCount.store(0, std::memory_order_relaxed);
+        s->mFailureCount.store(0, std::memory_order_relaxed);
+        s->mBytesSent.store(0, std::memory_order_relaxed);
+        s->mBytesReceived.store(0, std::memory_order_relaxed);
+        for (Integer i = 0; i < RPCMethodStatistics::PHASE_NUMBER; i++) {
+            RPCMethodStatistics::Histogram& h = s->mHistograms[i];
+            for (Integer j = 0; j < RPCMethodStatistics::BUCKET_NUMBER; j++) {
+                h.mBuckets[j].store(0, std::memory_order_relaxed);
+            }
+            h.mTotalNanos.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+// CCM_RPC_STATISTICS turns the statistics on at startup, a positive
+// value also dumps them to the log every that many seconds.
+static Boolean InitRPCStatistics()
+{
+    const char* value = getenv("CCM_RPC_STATISTICS");
+    if (value == nullptr) {
+        return false;
+    }
+    RPCStatistics::SetEnabled(true);
+    Integer interval = atoi(value);
+    if (interval > 0) {
+        RPCStatistics::SetDumpInterval(interval);
+    }
+    return true;
+}
+
+static Boolean sStatisticsInitialized = InitRPCStatistics();
+
+}
@@ -0,0 +1,185 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#ifndef __CCM_RPCSTATISTICS_H__
+#define __CCM_RPCSTATISTICS_H__
+
+#include "ccmtypes.h"
+#include <atomic>
+#include <time.h>
+
+namespace ccm {
+
+// The counters of the invocations of one method on one side of a
+// channel. The proxy side times marshaling, transport and unmarshaling,
+// the stub side unmarshaling, dispatch and marshaling.
+struct RPCMethodStatistics
+{
+    enum Side
+    {
+        PROXY = 0,
+        STUB,
+        SIDE_NUMBER
+    };
+
+    enum Phase
+    {
+        MARSHAL = 0,
+        TRANSPORT,
+        UNMARSHAL,
+        DISPATCH,
+        PHASE_NUMBER
+    };
+
+    // Bucket i counts the phases which took [2^i, 2^(i+1)) ns, the last
+    // one also counts everything longer.
+    static constexpr Integer BUCKET_NUMBER = 36;
+
+    struct Histogram
+    {
+        std::atomic<Long> mBuckets[BUCKET_NUMBER];
+        std::atomic<Long> mTotalNanos;
+    };
+
+    Uuid mIid;
+    Integer mMethodIndex;
+    Side mSide;
+    String mName;
+    std::atomic<Long> mCallCount;
+    std::atomic<Long> mFailureCount;
+    std::atomic<Long> mBytesSent;
+    std::atomic<Long> mBytesReceived;
+    Histogram mHistograms[PHASE_NUMBER];
+    RPCMethodStatistics* mNext;
+};
+
+class RPCStatistics
+{
+public:
+    // Times the phases of one invocation, and does nothing if the
+    // statistics are disabled when it is created.
+    class Recorder
+    {
+    public:
+        inline Recorder(
+            /* [in] */ IMetaMethod* method,
+            /* [in] */ RPCMethodStatistics::Side side);
+
+        // Ends |phase|, which started when the previous one ended.
+        inline void Mark(
+            /* [in] */ RPCMethodStatistics::Phase phase);
+
+        inline void Finish(
+            /* [in] */ ECode ec,
+            /* [in] */ IParcel* sent,
+            /* [in] */ IParcel* received);
+
+    private:
+        RPCMethodStatistics* mStatistics;
+        Long mLast;
+    };
+
+public:
+    inline static Boolean IsEnabled();
+
+    static void SetEnabled(
+        /* [in] */ Boolean enabled);
+
+    // 0 stops the periodic dump.
+    static ECode SetDumpInterval(
+        /* [in] */ Integer seconds);
+
+    static String Dump();
+
+    static void Reset();
+
+    inline static Long Now();
+
+    static RPCMethodStatistics* Get(
+        /* [in] */ IMetaMethod* method,
+        /* [in] */ RPCMethodStatistics::Side side);
+
+    static void Record(
+        /* [in] */ RPCMethodStatistics* stats,
+        /* [in] */ RPCMethodStatistics::Phase phase,
+        /* [in] */ Long nanos);
+
+    static void RecordCall(
+        /* [in] */ RPCMethodStatistics* stats,
+        /* [in] */ ECode ec,
+        /* [in] */ IParcel* sent,
+        /* [in] */ IParcel* received);
+
+private:
+    static RPCMethodStatistics* Create(
+        /* [in] */ IMetaMethod* method,
+        /* [in] */ RPCMethodStatistics::Side side);
+
+    static void* DumpThreadEntry(
+        /* [in] */ void* arg);
+
+private:
+    static std::atomic<Boolean> sEnabled;
+};
+
+Boolean RPCStatistics::IsEnabled()
+{
+    return sEnabled.load(std::memory_order_relaxed);
+}
+
+Long RPCStatistics::Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Long)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+RPCStatistics::Recorder::Recorder(
+    /* [in] */ IMetaMethod* method,
+    /* [in] */ RPCMethodStatistics::Side side)
+    : mStatistics(nullptr)
+    , mLast(0)
+{
+    if (IsEnabled()) {
+        mStatistics = Get(method, side);
+        mLast = Now();
+    }
+}
+
+void RPCStatistics::Recorder::Mark(
+    /* [in] */ RPCMethodStatistics::Phase phase)
+{
+    if (mStatistics != nullptr) {
+        Long now = Now();
+        Record(mStatistics, phase, now - mLast);
+        mLast = now;
+    }
+}
+
+void RPCStatistics::Recorder::Finish(
+    /* [in] */ ECode ec,
+    /* [in] */ IParcel* sent,
+    /* [in] */ IParcel* received)
+{
+    if (mStatistics != nullptr) {
+        RecordCall(mStatistics, ec, sent, received);
+    }
+}
+
+}
+
+#endif // __CCM_RPCSTATISTICS_H__
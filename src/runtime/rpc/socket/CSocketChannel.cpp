@@ -0,0 +1,825 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+#include "ccmrpc.h"
+#include "CSocketChannel.h"
+#include "SocketInterfacePack.h"
+#include "util/ccmlogger.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace ccm {
+
+CSocketChannel::DispatchRunnable::DispatchRunnable(
+    /* [in] */ CSocketChannel* owner,
+    /* [in] */ IStub* target,
+    /* [in] */ Request* request)
+    : mOwner(owner)
+    , mTarget(target)
+    , mRequest(request)
+{}
+
+CSocketChannel::DispatchRunnable::~DispatchRunnable()
+{
+    if (mRequest != nullptr) {
+        delete mRequest;
+    }
+}
+
+ECode CSocketChannel::DispatchRunnable::Run()
+{
+    if (mRequest != nullptr) {
+        mOwner->ProcessRequest(mTarget, mRequest);
+        return NOERROR;
+    }
+
+    while (true) {
+        Request* request;
+        {
+            Mutex::AutoLock lock(mOwner->mLock);
+            request = mOwner->mPendingHead;
+            if (request == nullptr) {
+                mOwner->mDispatching = false;
+                return NOERROR;
+            }
+            mOwner->mPendingHead = request->mNext;
+            if (mOwner->mPendingHead == nullptr) {
+                mOwner->mPendingTail = nullptr;
+            }
+        }
+
+        mOwner->ProcessRequest(mTarget, request);
+        delete request;
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+const CoclassID CID_CSocketChannel =
+        {{0x9b756320,0x2016,0x4566,0x986b,{0xe,0xa,0xb,0x6,0x1,0x2,0xa,0xa,0xa,0x7,0x5,0xb}}, &CID_CCMRuntime};
+
+CCM_INTERFACE_IMPL_1(CSocketChannel, Object, IRPCChannel);
+
+CCM_OBJECT_IMPL(CSocketChannel);
+
+Mutex CSocketChannel::sServiceLock;
+int CSocketChannel::sServiceSocket = -1;
+String CSocketChannel::sServiceAddress;
+pthread_t CSocketChannel::sServiceThread;
+int CSocketChannel::sServiceWakeFds[2] = { -1, -1 };
+Boolean CSocketChannel::sServiceQuit = false;
+Long CSocketChannel::sObjectNumber = 0;
+HashMap<Long, RefBase::WeakRef*>* CSocketChannel::sExportedStubs =
+        new HashMap<Long, RefBase::WeakRef*>();
+
+CSocketChannel::CSocketChannel(
+    /* [in] */ RPCType type,
+    /* [in] */ RPCPeer peer)
+    : mType(type)
+    , mPeer(peer)
+    , mObjectId(0)
+    , mPendingHead(nullptr)
+    , mPendingTail(nullptr)
+    , mDispatching(false)
+    , mLaneDisabled(false)
+    , mStubRef(nullptr)
+{}
+
+CSocketChannel::~CSocketChannel()
+{
+    if (mLane != nullptr) {
+        mLane->Close();
+        mLane = nullptr;
+    }
+    if (mStubRef != nullptr) {
+        {
+            Mutex::AutoLock lock(sServiceLock);
+            sExportedStubs->Remove(mObjectId);
+        }
+        mStubRef->DecWeak(mStubRef->GetRefBase());
+        mStubRef = nullptr;
+    }
+    while (mPendingHead != nullptr) {
+        Request* request = mPendingHead;
+        mPendingHead = request->mNext;
+        delete request;
+    }
+    mPendingTail = nullptr;
+}
+
+ECode CSocketChannel::GetRPCType(
+    /* [out] */ RPCType* type)
+{
+    VALIDATE_NOT_NULL(type);
+
+    *type = mType;
+    return NOERROR;
+}
+
+ECode CSocketChannel::IsPeerAlive(
+    /* [out] */ Boolean* alive)
+{
+    VALIDATE_NOT_NULL(alive);
+
+    if (mPeer == RPCPeer::Stub) {
+        *alive = true;
+        return NOERROR;
+    }
+
+    Mutex::AutoLock lock(mLock);
+    *alive = mClient != nullptr && mClient->IsAlive();
+    return NOERROR;
+}
+
+ECode CSocketChannel::LinkToDeath(
+    /* [in] */ IDeathRecipient* recipient,
+    /* [in] */ HANDLE cookie,
+    /* [in] */ Integer flags)
+{
+    return NOERROR;
+}
+
+ECode CSocketChannel::UnlinkToDeath(
+    /* [in] */ IDeathRecipient* recipient,
+    /* [in] */ HANDLE cookie,
+    /* [in] */ Integer flags,
+    /* [out] */ IDeathRecipient** outRecipient)
+{
+    return NOERROR;
+}
+
+ECode CSocketChannel::AcquireClient(
+    /* [out] */ SocketClient** client)
+{
+    Mutex::AutoLock lock(mLock);
+
+    // A lost connection is replaced by a new one on the next call.
+    if (mClient == nullptr || !mClient->IsAlive()) {
+        mClient = nullptr;
+        ECode ec = SocketClient::Get(mAddress, &mClient);
+        if (FAILED(ec)) {
+            return ec;
+        }
+    }
+    *client = mClient;
+    REFCOUNT_ADD(*client);
+    return NOERROR;
+}
+
+ECode CSocketChannel::Invoke(
+    /* [in] */ IProxy* proxy,
+    /* [in] */ IMetaMethod* method,
+    /* [in] */ IParcel* argParcel,
+    /* [out] */ IParcel** resParcel)
+{
+    AutoPtr<SocketClient> client;
+    ECode ec = AcquireClient(&client);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    if (DEBUG) {
+        Logger::D("CSocketChannel", "Send request to object %lld.", mObjectId);
+    }
+
+    CSocketParcel* args = (CSocketParcel*)argParcel;
+    Boolean oneway;
+    method->IsOneway(&oneway);
+    if (oneway) {
+        return client->Post(mObjectId, args);
+    }
+
+    Long size;
+    args->GetDataSize(&size);
+    AutoPtr<CSocketParcel> result;
+    // File descriptors only travel over the socket.
+    if (size >= LANE_THRESHOLD && args->GetFileDescriptorNumber() == 0) {
+        ec = InvokeOnLane(client, args, &result);
+    }
+    else {
+        ec = client->Call(mObjectId, args, &result);
+    }
+    if (FAILED(ec)) {
+        if (DEBUG) {
+            Logger::D("CSocketChannel", "Remote call failed with ec = 0x%x.", ec);
+        }
+        return ec;
+    }
+
+    Boolean hasOutArgs;
+    method->HasOutArguments(&hasOutArgs);
+    if (hasOutArgs && result != nullptr) {
+        *resParcel = (IParcel*)result.Get();
+        REFCOUNT_ADD(*resParcel);
+    }
+    return NOERROR;
+}
+
+ECode CSocketChannel::InvokeAsync(
+    /* [in] */ IProxy* proxy,
+    /* [in] */ IMetaMethod* method,
+    /* [in] */ IParcel* argParcel,
+    /* [out] */ IInvocationFuture** future)
+{
+    VALIDATE_NOT_NULL(future);
+    *future = nullptr;
+
+    AutoPtr<SocketClient> client;
+    ECode ec = AcquireClient(&client);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    // Asynchronous calls always go over the socket, the lane only
+    // serves one call at a time.
+    CSocketParcel* args = (CSocketParcel*)argParcel;
+    AutoPtr<InvocationFuture> result;
+    Boolean oneway;
+    method->IsOneway(&oneway);
+    if (oneway) {
+        ec = client->Post(mObjectId, args);
+        if (SUCCEEDED(ec)) {
+            result = InvocationFuture::CreateCompleted(NOERROR);
+        }
+    }
+    else {
+        result = new InvocationFuture();
+        ec = client->CallAsync(mObjectId, args, result);
+    }
+    if (FAILED(ec)) {
+        if (DEBUG) {
+            Logger::D("CSocketChannel", "Remote call failed with ec = 0x%x.", ec);
+        }
+        return ec;
+    }
+
+    *future = result;
+    REFCOUNT_ADD(*future);
+    return NOERROR;
+}
+
+ECode CSocketChannel::InvokeOnLane(
+    /* [in] */ SocketClient* client,
+    /* [in] */ CSocketParcel* argParcel,
+    /* [out] */ CSocketParcel** resParcel)
+{
+    // The lane carries one call at a time. A call which finds it taken
+    // goes over the socket instead of waiting for the lane to drain.
+    if (!mLaneLock.TryLock()) {
+        return client->Call(mObjectId, argParcel, resParcel);
+    }
+    ECode ec = InvokeOnLaneLocked(client, argParcel, resParcel);
+    mLaneLock.Unlock();
+    return ec;
+}
+
+ECode CSocketChannel::InvokeOnLaneLocked(
+    /* [in] */ SocketClient* client,
+    /* [in] */ CSocketParcel* argParcel,
+    /* [out] */ CSocketParcel** resParcel)
+{
+    if (mLaneDisabled) {
+        return client->Call(mObjectId, argParcel, resParcel);
+    }
+    if (mLane == nullptr || mLane->IsClosed() || mLaneClient != client) {
+        ECode ec = AttachLane(client);
+        if (FAILED(ec)) {
+            Logger::W("CSocketChannel", "Set up lane failed, ec is 0x%x, "
+                    "object %lld falls back to the socket.", ec, mObjectId);
+            mLaneDisabled = true;
+            return client->Call(mObjectId, argParcel, resParcel);
+        }
+    }
+
+    HANDLE data;
+    Long size;
+    argParcel->GetData(&data);
+    argParcel->GetDataSize(&size);
+    ECode ec = mLane->GetRequestRing().Write(NOERROR,
+            reinterpret_cast<void*>(data), size, client);
+    if (FAILED(ec)) {
+        // A request may be half written, the lane is unusable now.
+        mLane->Close();
+        mLane = nullptr;
+        return E_REMOTE_EXCEPTION;
+    }
+
+    AutoPtr<CSocketParcel> result = new CSocketParcel();
+    ECode remoteEc;
+    ec = mLane->GetResponseRing().Read(&remoteEc, result, client);
+    if (FAILED(ec)) {
+        mLane->Close();
+        mLane = nullptr;
+        return E_REMOTE_EXCEPTION;
+    }
+    if (FAILED(remoteEc)) {
+        return remoteEc;
+    }
+    result.MoveTo(resParcel);
+    return NOERROR;
+}
+
+ECode CSocketChannel::AttachLane(
+    /* [in] */ SocketClient* client)
+{
+    AutoPtr<ShmLane> lane;
+    int fd;
+    ECode ec = ShmLane::Create(ShmLane::DEFAULT_CAPACITY, &lane, &fd);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    AutoPtr<CSocketParcel> parcel = new CSocketParcel();
+    ec = parcel->WriteFileDescriptor(fd);
+    close(fd);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    AutoPtr<CSocketParcel> reply;
+    ec = client->Call(mObjectId, parcel, &reply, SocketConnection::FRAME_ATTACH_LANE);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    if (mLane != nullptr) {
+        mLane->Close();
+    }
+    mLane = lane;
+    mLaneClient = client;
+    return NOERROR;
+}
+
+ECode CSocketChannel::AcquireService(
+    /* [out] */ String* address)
+{
+    Mutex::AutoLock lock(sServiceLock);
+
+    if (sServiceSocket == -1) {
+        String newAddress = String::Format("%s.%d", SERVICE_ADDRESS_PREFIX, getpid());
+        int sock;
+        ECode ec = SocketConnection::Listen(newAddress, &sock);
+        if (FAILED(ec)) {
+            return ec;
+        }
+
+        if (pipe2(sServiceWakeFds, O_NONBLOCK | O_CLOEXEC) != 0) {
+            Logger::E("CSocketChannel", "Create wakeup pipe failed, errno is %d.", errno);
+            close(sock);
+            return E_RUNTIME_EXCEPTION;
+        }
+
+        sServiceSocket = sock;
+        sServiceAddress = newAddress;
+        sServiceQuit = false;
+
+        int ret = pthread_create(&sServiceThread, nullptr,
+                CSocketChannel::ServiceThreadEntry, nullptr);
+        if (ret != 0) {
+            Logger::E("CSocketChannel", "Create service thread failed, error is %d.", ret);
+            close(sServiceSocket);
+            sServiceSocket = -1;
+            sServiceAddress = nullptr;
+            close(sServiceWakeFds[0]);
+            close(sServiceWakeFds[1]);
+            sServiceWakeFds[0] = sServiceWakeFds[1] = -1;
+            return E_RUNTIME_EXCEPTION;
+        }
+    }
+
+    *address = sServiceAddress;
+    return NOERROR;
+}
+
+void CSocketChannel::ReleaseService()
+{
+    {
+        Mutex::AutoLock lock(sServiceLock);
+        if (sServiceSocket == -1) {
+            return;
+        }
+        sServiceQuit = true;
+    }
+
+    WakeUpServiceThread();
+    pthread_join(sServiceThread, nullptr);
+
+    Mutex::AutoLock lock(sServiceLock);
+    close(sServiceSocket);
+    sServiceSocket = -1;
+    sServiceAddress = nullptr;
+    close(sServiceWakeFds[0]);
+    close(sServiceWakeFds[1]);
+    sServiceWakeFds[0] = sServiceWakeFds[1] = -1;
+}
+
+void* CSocketChannel::ServiceThreadEntry(
+    /* [in] */ void* arg)
+{
+    // Slots 0 and 1 are the listening socket and the wakeup pipe, the
+    // accepted peers follow.
+    Integer capacity = 16;
+    Integer number = 2;
+    struct pollfd* fds = (struct pollfd*)malloc(sizeof(struct pollfd) * capacity);
+    SocketPeer** conns = (SocketPeer**)malloc(sizeof(SocketPeer*) * capacity);
+    if (fds == nullptr || conns == nullptr) {
+        Logger::E("CSocketChannel", "Out of memory.");
+        free(fds);
+        free(conns);
+        return nullptr;
+    }
+    fds[0].fd = sServiceSocket;
+    fds[0].events = POLLIN;
+    fds[1].fd = sServiceWakeFds[0];
+    fds[1].events = POLLIN;
+
+    while (true) {
+        {
+            Mutex::AutoLock lock(sServiceLock);
+            if (sServiceQuit) {
+                break;
+            }
+        }
+
+        for (Integer i = 0; i < number; i++) {
+            fds[i].revents = 0;
+        }
+        if (poll(fds, number, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            Logger::E("CSocketChannel", "Poll sockets failed, errno is %d.", errno);
+            break;
+        }
+
+        if (fds[1].revents & POLLIN) {
+            char buf[64];
+            while (read(sServiceWakeFds[0], buf, sizeof(buf)) > 0);
+        }
+
+        // Requests of one peer are pipelined, every readable peer hands
+        // over what has arrived. A frame which is not whole yet waits for
+        // the next round.
+        for (Integer i = number - 1; i >= 2; i--) {
+            if (fds[i].revents == 0) {
+                continue;
+            }
+            if (fds[i].revents & POLLIN) {
+                FrameHeader header;
+                AutoPtr<CSocketParcel> parcel;
+                if (SUCCEEDED(conns[i]->ReceivePart(&header, &parcel))) {
+                    if (parcel != nullptr) {
+                        HandleFrame(conns[i], header, parcel);
+                    }
+                    continue;
+                }
+            }
+            // The peer is gone or broke the framing.
+            conns[i]->Shutdown();
+            conns[i]->Release();
+            fds[i] = fds[number - 1];
+            conns[i] = conns[number - 1];
+            number--;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int fd;
+            if (FAILED(SocketConnection::Accept(sServiceSocket, &fd))) {
+                continue;
+            }
+            if (number == capacity) {
+                Integer newCapacity = capacity * 2;
+                struct pollfd* newFds = (struct pollfd*)realloc(
+                        fds, sizeof(struct pollfd) * newCapacity);
+                if (newFds != nullptr) {
+                    fds = newFds;
+                }
+                SocketPeer** newConns = (SocketPeer**)realloc(
+                        conns, sizeof(SocketPeer*) * newCapacity);
+                if (newConns != nullptr) {
+                    conns = newConns;
+                }
+                if (newFds == nullptr || newConns == nullptr) {
+                    Logger::E("CSocketChannel", "Out of memory.");
+                    close(fd);
+                    continue;
+                }
+                capacity = newCapacity;
+            }
+            conns[number] = new SocketPeer(fd);
+            conns[number]->AddRef();
+            fds[number].fd = fd;
+            fds[number].events = POLLIN;
+            number++;
+        }
+    }
+
+    for (Integer i = 2; i < number; i++) {
+        conns[i]->Shutdown();
+        conns[i]->Release();
+    }
+    free(fds);
+    free(conns);
+    return nullptr;
+}
+
+void CSocketChannel::WakeUpServiceThread()
+{
+    char c = 0;
+    ssize_t ret = write(sServiceWakeFds[1], &c, 1);
+    (void)ret;
+}
+
+void CSocketChannel::HandleFrame(
+    /* [in] */ SocketConnection* conn,
+    /* [in] */ const FrameHeader& header,
+    /* [in] */ CSocketParcel* parcel)
+{
+    if (header.mType == SocketConnection::FRAME_ATTACH_LANE) {
+        FrameHeader reply;
+        reply.mType = SocketConnection::FRAME_REPLY;
+        reply.mResult = AcceptLane(conn, header.mObjectId, parcel);
+        reply.mCallId = header.mCallId;
+        reply.mObjectId = header.mObjectId;
+        conn->SendFrame(reply, nullptr);
+        return;
+    }
+    if (header.mType != SocketConnection::FRAME_INVOKE &&
+            header.mType != SocketConnection::FRAME_ONEWAY) {
+        Logger::W("CSocketChannel", "Unexpected frame of type %d.", header.mType);
+        return;
+    }
+    Boolean oneway = header.mType == SocketConnection::FRAME_ONEWAY;
+
+    AutoPtr<IStub> stub;
+    if (FAILED(FindStub(header.mObjectId, conn, &stub))) {
+        if (oneway) {
+            Logger::W("CSocketChannel", "Oneway request to the lost object %lld.",
+                    header.mObjectId);
+            return;
+        }
+        // The stub is gone, fail the call instead of leaving it hanging.
+        FrameHeader reply;
+        reply.mType = SocketConnection::FRAME_REPLY;
+        reply.mResult = E_REMOTE_EXCEPTION;
+        reply.mCallId = header.mCallId;
+        reply.mObjectId = header.mObjectId;
+        conn->SendFrame(reply, nullptr);
+        return;
+    }
+
+    Request* request = new Request(conn, header.mCallId, parcel);
+    request->mOneway = oneway;
+    GetStubChannel(stub)->QueueRequest(stub, request);
+}
+
+ECode CSocketChannel::FindStub(
+    /* [in] */ Long objectId,
+    /* [in] */ const void* id,
+    /* [out] */ IStub** stub)
+{
+    CStub* stubObj = nullptr;
+    {
+        Mutex::AutoLock lock(sServiceLock);
+        RefBase::WeakRef* stubRef = sExportedStubs->Get(objectId);
+        if (stubRef != nullptr && stubRef->AttemptIncStrong(id)) {
+            stubObj = static_cast<CStub*>(stubRef->GetRefBase());
+        }
+    }
+    if (stubObj == nullptr) {
+        *stub = nullptr;
+        return E_NOT_FOUND_EXCEPTION;
+    }
+    *stub = (IStub*)stubObj;
+    REFCOUNT_ADD(*stub);
+    stubObj->Release(reinterpret_cast<HANDLE>(id));
+    return NOERROR;
+}
+
+ECode CSocketChannel::AcceptLane(
+    /* [in] */ SocketConnection* conn,
+    /* [in] */ Long objectId,
+    /* [in] */ CSocketParcel* parcel)
+{
+    AutoPtr<IStub> stub;
+    if (parcel == nullptr || FAILED(FindStub(objectId, conn, &stub))) {
+        return E_REMOTE_EXCEPTION;
+    }
+
+    int fd;
+    ECode ec = parcel->ReadFileDescriptor(&fd);
+    if (FAILED(ec)) {
+        return ec;
+    }
+    AutoPtr<ShmLane> lane;
+    ec = ShmLane::Attach(fd, &lane);
+    close(fd);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    // Every lane is drained by a thread of its own, which only queues
+    // the requests, so a blocked invocation never stalls the socket.
+    LaneContext* context = new LaneContext();
+    context->mLane = lane;
+    context->mConnection = conn;
+    context->mObjectId = objectId;
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_t thread;
+    int ret = pthread_create(&thread, &attr, CSocketChannel::LaneThreadEntry, context);
+    pthread_attr_destroy(&attr);
+    if (ret != 0) {
+        Logger::E("CSocketChannel", "Create lane thread failed, error is %d.", ret);
+        delete context;
+        return E_RUNTIME_EXCEPTION;
+    }
+    return NOERROR;
+}
+
+void* CSocketChannel::LaneThreadEntry(
+    /* [in] */ void* arg)
+{
+    LaneContext* context = static_cast<LaneContext*>(arg);
+    ShmLane* lane = context->mLane;
+    SocketConnection* conn = context->mConnection;
+
+    while (true) {
+        AutoPtr<CSocketParcel> parcel = new CSocketParcel();
+        ECode ec;
+        if (FAILED(lane->GetRequestRing().Read(&ec, parcel, conn))) {
+            break;
+        }
+
+        AutoPtr<IStub> stub;
+        if (FAILED(FindStub(context->mObjectId, lane, &stub))) {
+            parcel = nullptr;
+            if (FAILED(lane->GetResponseRing().Write(
+                    E_REMOTE_EXCEPTION, nullptr, 0, conn))) {
+                break;
+            }
+            continue;
+        }
+
+        Request* request = new Request(conn, 0, parcel);
+        request->mLane = lane;
+        parcel = nullptr;
+        GetStubChannel(stub)->QueueRequest(stub, request);
+    }
+
+    lane->Close();
+    delete context;
+    return nullptr;
+}
+
+ECode CSocketChannel::QueueRequest(
+    /* [in] */ IStub* target,
+    /* [in] */ Request* request)
+{
+    if (((CStub*)target)->IsConcurrent()) {
+        AutoPtr<ThreadPoolExecutor::Runnable> r = new DispatchRunnable(this, target, request);
+        return ThreadPoolExecutor::GetInstance()->RunTask(r);
+    }
+
+    // Invocations of one object are serialized unless it asks for
+    // concurrent invocation, one runnable drains them in order.
+    {
+        Mutex::AutoLock lock(mLock);
+        if (mPendingTail == nullptr) {
+            mPendingHead = mPendingTail = request;
+        }
+        else {
+            mPendingTail->mNext = request;
+            mPendingTail = request;
+        }
+        if (mDispatching) {
+            return NOERROR;
+        }
+        mDispatching = true;
+    }
+
+    AutoPtr<ThreadPoolExecutor::Runnable> r = new DispatchRunnable(this, target);
+    ECode ec = ThreadPoolExecutor::GetInstance()->RunTask(r);
+    if (FAILED(ec)) {
+        Logger::E("CSocketChannel", "Dispatch request failed, ec is 0x%x.", ec);
+        Mutex::AutoLock lock(mLock);
+        mDispatching = false;
+    }
+    return ec;
+}
+
+void CSocketChannel::ProcessRequest(
+    /* [in] */ IStub* target,
+    /* [in] */ Request* request)
+{
+    if (DEBUG) {
+        Logger::D("CSocketChannel", "Handle request %lld.", request->mCallId);
+    }
+
+    AutoPtr<IParcel> resParcel;
+    ECode ec = target->Invoke(request->mParcel, &resParcel);
+    // The arguments may be read in place from a lane, whose records
+    // have to be given back in order.
+    request->mParcel = nullptr;
+
+    if (request->mOneway) {
+        if (FAILED(ec)) {
+            Logger::W("CSocketChannel", "Oneway request failed, ec is 0x%x.", ec);
+        }
+        return;
+    }
+
+    if (request->mLane != nullptr) {
+        HANDLE data = 0;
+        Long size = 0;
+        if (resParcel != nullptr) {
+            resParcel->GetData(&data);
+            resParcel->GetDataSize(&size);
+        }
+        if (FAILED(request->mLane->GetResponseRing().Write(ec,
+                reinterpret_cast<void*>(data), size, request->mConnection))) {
+            request->mLane->Close();
+        }
+        return;
+    }
+
+    FrameHeader reply;
+    reply.mType = SocketConnection::FRAME_REPLY;
+    reply.mResult = ec;
+    reply.mCallId = request->mCallId;
+    reply.mObjectId = mObjectId;
+    ec = request->mConnection->SendFrame(reply, (CSocketParcel*)resParcel.Get());
+    if (FAILED(ec) && DEBUG) {
+        Logger::D("CSocketChannel", "Send reply %lld failed.", request->mCallId);
+    }
+}
+
+ECode CSocketChannel::StartListening(
+    /* [in] */ IStub* stub)
+{
+    if (mPeer != RPCPeer::Stub) {
+        return NOERROR;
+    }
+
+    String address;
+    ECode ec = AcquireService(&address);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    // The service only keeps a weak reference to the stub.
+    CStub* stubObj = (CStub*)stub;
+    RefBase::WeakRef* stubRef = stubObj->CreateWeak(stubObj);
+
+    Mutex::AutoLock lock(sServiceLock);
+    mAddress = address;
+    mObjectId = ++sObjectNumber;
+    mStubRef = stubRef;
+    sExportedStubs->Put(mObjectId, stubRef);
+    return NOERROR;
+}
+
+ECode CSocketChannel::Match(
+    /* [in] */ IInterfacePack* ipack,
+    /* [out] */ Boolean* matched)
+{
+    VALIDATE_NOT_NULL(matched);
+
+    ISocketInterfacePack* ispack = ISocketInterfacePack::Probe(ipack);
+    if (ispack != nullptr) {
+        SocketInterfacePack* pack = (SocketInterfacePack*)ispack;
+        if (pack->GetAddress().Equals(mAddress) &&
+                pack->GetObjectId() == mObjectId) {
+            *matched = true;
+            return NOERROR;
+        }
+    }
+    *matched = false;
+    return NOERROR;
+}
+
+void Uninit_Socket_Connections()
+{
+    CSocketChannel::ReleaseService();
+    SocketClient::CloseAll();
+}
+
+}
@@ -0,0 +1,252 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+#ifndef __CCM_CSOCKETCHANNEL_H__
+#define __CCM_CSOCKETCHANNEL_H__
+
+#include "CProxy.h"
+#include "CStub.h"
+#include "shmlane.h"
+#include "socketconnection.h"
+#include "threadpoolexecutor.h"
+#include "util/ccmobject.h"
+#include "util/hashmap.h"
+#include "util/mutex.h"
+
+namespace ccm {
+
+extern const CoclassID CID_CSocketChannel;
+
+COCLASS_ID(9b756320-2016-4566-986b-eab612aaa75b)
+class CSocketChannel
+    : public Object
+    , public IRPCChannel
+{
+private:
+    struct Request
+    {
+        Request(
+            /* [in] */ SocketConnection* conn,
+            /* [in] */ Long callId,
+            /* [in] */ CSocketParcel* parcel)
+            : mConnection(conn)
+            , mCallId(callId)
+            , mParcel(parcel)
+            , mOneway(false)
+            , mNext(nullptr)
+        {}
+
+        AutoPtr<SocketConnection> mConnection;
+        Long mCallId;
+        AutoPtr<CSocketParcel> mParcel;
+        // Set for a [oneway] method, which takes no reply.
+        Boolean mOneway;
+        // Set if the request came through a lane, which takes the reply.
+        AutoPtr<ShmLane> mLane;
+        Request* mNext;
+    };
+
+    struct LaneContext
+    {
+        AutoPtr<ShmLane> mLane;
+        AutoPtr<SocketConnection> mConnection;
+        Long mObjectId;
+    };
+
+    class DispatchRunnable
+        : public ThreadPoolExecutor::Runnable
+    {
+    public:
+        DispatchRunnable(
+            /* [in] */ CSocketChannel* owner,
+            /* [in] */ IStub* target,
+            /* [in] */ Request* request = nullptr);
+
+        ~DispatchRunnable();
+
+        ECode Run();
+
+    private:
+        AutoPtr<CSocketChannel> mOwner;
+        AutoPtr<IStub> mTarget;
+        // If mRequest is null, drain the pending requests of the owner.
+        Request* mRequest;
+    };
+
+public:
+    CSocketChannel(
+        /* [in] */ RPCType type,
+        /* [in] */ RPCPeer peer);
+
+    ~CSocketChannel();
+
+    CCM_INTERFACE_DECL();
+
+    CCM_OBJECT_DECL();
+
+    ECode GetRPCType(
+        /* [out] */ RPCType* type) override;
+
+    ECode IsPeerAlive(
+        /* [out] */ Boolean* alive) override;
+
+    ECode LinkToDeath(
+        /* [in] */ IDeathRecipient* recipient,
+        /* [in] */ HANDLE cookie = 0,
+        /* [in] */ Integer flags = 0) override;
+
+    ECode UnlinkToDeath(
+        /* [in] */ IDeathRecipient* recipient,
+        /* [in] */ HANDLE cookie = 0,
+        /* [in] */ Integer flags = 0,
+        /* [out] */ IDeathRecipient** outRecipient = nullptr) override;
+
+    ECode Invoke(
+        /* [in] */ IProxy* proxy,
+        /* [in] */ IMetaMethod* method,
+        /* [in] */ IParcel* argParcel,
+        /* [out] */ IParcel** resParcel) override;
+
+    ECode InvokeAsync(
+        /* [in] */ IProxy* proxy,
+        /* [in] */ IMetaMethod* method,
+        /* [in] */ IParcel* argParcel,
+        /* [out] */ IInvocationFuture** future) override;
+
+    ECode StartListening(
+        /* [in] */ IStub* stub) override;
+
+    ECode Match(
+        /* [in] */ IInterfacePack* ipack,
+        /* [out] */ Boolean* matched) override;
+
+    static CSocketChannel* GetProxyChannel(
+        /* [in] */ IProxy* proxy);
+
+    static CSocketChannel* GetStubChannel(
+        /* [in] */ IStub* stub);
+
+    static void ReleaseService();
+
+private:
+    ECode AcquireClient(
+        /* [out] */ SocketClient** client);
+
+    ECode InvokeOnLane(
+        /* [in] */ SocketClient* client,
+        /* [in] */ CSocketParcel* argParcel,
+        /* [out] */ CSocketParcel** resParcel);
+
+    ECode InvokeOnLaneLocked(
+        /* [in] */ SocketClient* client,
+        /* [in] */ CSocketParcel* argParcel,
+        /* [out] */ CSocketParcel** resParcel);
+
+    ECode AttachLane(
+        /* [in] */ SocketClient* client);
+
+    static ECode AcquireService(
+        /* [out] */ String* address);
+
+    static void* ServiceThreadEntry(
+        /* [in] */ void* arg);
+
+    static void WakeUpServiceThread();
+
+    static ECode FindStub(
+        /* [in] */ Long objectId,
+        /* [in] */ const void* id,
+        /* [out] */ IStub** stub);
+
+    static ECode AcceptLane(
+        /* [in] */ SocketConnection* conn,
+        /* [in] */ Long objectId,
+        /* [in] */ CSocketParcel* parcel);
+
+    static void* LaneThreadEntry(
+        /* [in] */ void* arg);
+
+    static void HandleFrame(
+        /* [in] */ SocketConnection* conn,
+        /* [in] */ const FrameHeader& header,
+        /* [in] */ CSocketParcel* parcel);
+
+    ECode QueueRequest(
+        /* [in] */ IStub* target,
+        /* [in] */ Request* request);
+
+    void ProcessRequest(
+        /* [in] */ IStub* target,
+        /* [in] */ Request* request);
+
+private:
+    friend class CSocketChannelFactory;
+
+    static constexpr Boolean DEBUG = false;
+    static constexpr const char* SERVICE_ADDRESS_PREFIX = "ccm.rpc";
+    // Arguments of at least this size go through a shared memory lane.
+    static constexpr Long LANE_THRESHOLD = 64 * 1024;
+
+    // All stubs of the process share one listening socket, which is
+    // served by a single I/O thread together with the accepted peers.
+    // Only peers of the same user are accepted, and their sockets do not
+    // block. Stubs are told apart by their object ids and invocations
+    // run on the ThreadPoolExecutor.
+    static Mutex sServiceLock;
+    static int sServiceSocket;
+    static String sServiceAddress;
+    static pthread_t sServiceThread;
+    static int sServiceWakeFds[2];
+    static Boolean sServiceQuit;
+    static Long sObjectNumber;
+    // Never freed, the stubs the export registry releases at exit still
+    // remove themselves from it.
+    static HashMap<Long, RefBase::WeakRef*>* sExportedStubs;
+
+    RPCType mType;
+    RPCPeer mPeer;
+    String mAddress;
+    Long mObjectId;
+    Mutex mLock;
+    Request* mPendingHead;
+    Request* mPendingTail;
+    Boolean mDispatching;
+    // The shared connection used by the proxy side.
+    AutoPtr<SocketClient> mClient;
+    // Calls on the lane are serialized, which keeps its rings single
+    // producer and single consumer.
+    Mutex mLaneLock;
+    AutoPtr<ShmLane> mLane;
+    AutoPtr<SocketClient> mLaneClient;
+    Boolean mLaneDisabled;
+    // The weak reference the stub side is exported with.
+    RefBase::WeakRef* mStubRef;
+};
+
+inline CSocketChannel* CSocketChannel::GetProxyChannel(
+    /* [in] */ IProxy* proxy)
+{
+    return (CSocketChannel*)((CProxy*)proxy)->GetChannel().Get();
+}
+
+inline CSocketChannel* CSocketChannel::GetStubChannel(
+    /* [in] */ IStub* stub)
+{
+    return (CSocketChannel*)((CStub*)stub)->GetChannel().Get();
+}
+
+}
+
+#endif // __CCM_CSOCKETCHANNEL_H__
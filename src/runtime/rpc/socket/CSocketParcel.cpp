@@ -0,0 +1,136 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+#include "CSocketParcel.h"
+#include "util/ccmlogger.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ccm {
+
+const CoclassID CID_CSocketParcel =
+        {{0x8ea9078b,0x134c,0x4f8a,0xb750,{0x1,0x5,0xb,0xd,0xc,0x9,0xf,0x7,0xe,0x2,0x1,0x7}}, &CID_CCMRuntime};
+
+CCM_OBJECT_IMPL(CSocketParcel);
+
+CSocketParcel::CSocketParcel()
+    : mFdNumber(0)
+{}
+
+CSocketParcel::~CSocketParcel()
+{
+    CloseFileDescriptors();
+}
+
+ECode CSocketParcel::WriteFileDescriptor(
+    /* [in] */ int fd)
+{
+    if (fd < 0) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+    if (mFdNumber >= MAX_FD_NUMBER) {
+        Logger::E("CSocketParcel", "Too many file descriptors in one parcel.");
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    int newFd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    if (newFd < 0) {
+        Logger::E("CSocketParcel", "Duplicate fd %d failed, errno is %d.", fd, errno);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    ECode ec = WriteInteger(mFdNumber);
+    if (FAILED(ec)) {
+        close(newFd);
+        return ec;
+    }
+    mFds[mFdNumber++] = newFd;
+    return NOERROR;
+}
+
+ECode CSocketParcel::ReadFileDescriptor(
+    /* [out] */ int* fd)
+{
+    VALIDATE_NOT_NULL(fd);
+
+    *fd = -1;
+    Integer index;
+    ECode ec = ReadInteger(&index);
+    if (FAILED(ec)) {
+        return ec;
+    }
+    if (index < 0 || index >= mFdNumber) {
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    *fd = fcntl(mFds[index], F_DUPFD_CLOEXEC, 0);
+    if (*fd < 0) {
+        Logger::E("CSocketParcel", "Duplicate fd %d failed, errno is %d.",
+                mFds[index], errno);
+        return E_RUNTIME_EXCEPTION;
+    }
+    return NOERROR;
+}
+
+ECode CSocketParcel::AdoptFileDescriptors(
+    /* [in] */ const int* fds,
+    /* [in] */ Integer number)
+{
+    if (number < 0 || number > MAX_FD_NUMBER) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    CloseFileDescriptors();
+    for (Integer i = 0; i < number; i++) {
+        mFds[i] = fds[i];
+    }
+    mFdNumber = number;
+    return NOERROR;
+}
+
+Byte* CSocketParcel::ResetData(
+    /* [in] */ Long size)
+{
+    if (size <= 0) {
+        mDataSize = mDataPos = 0;
+        return mData;
+    }
+    if (FAILED(RestartWrite(size))) {
+        return nullptr;
+    }
+    mDataSize = size;
+    return mData;
+}
+
+void CSocketParcel::CloseFileDescriptors()
+{
+    for (Integer i = 0; i < mFdNumber; i++) {
+        close(mFds[i]);
+    }
+    mFdNumber = 0;
+}
+
+ECode CSocketParcel::CreateObject(
+    /* [out] */ IParcel** parcel)
+{
+    VALIDATE_NOT_NULL(parcel);
+
+    *parcel = new CSocketParcel();
+    REFCOUNT_ADD(*parcel);
+    return NOERROR;
+}
+
+}
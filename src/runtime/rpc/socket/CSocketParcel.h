@@ -0,0 +1,87 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+#ifndef __CCM_CSOCKETPARCEL_H__
+#define __CCM_CSOCKETPARCEL_H__
+
+#include "CDBusParcel.h"
+
+namespace ccm {
+
+extern const CoclassID CID_CSocketParcel;
+
+// The socket transport shares the data encoding of CDBusParcel, and adds
+// file descriptors which travel beside the data as SCM_RIGHTS.
+COCLASS_ID(8ea9078b-134c-4f8a-b750-15bdc9f7e217)
+class CSocketParcel
+    : public CDBusParcel
+{
+public:
+    CSocketParcel();
+
+    ~CSocketParcel();
+
+    CCM_OBJECT_DECL();
+
+    // The parcel keeps its own duplicate of |fd|.
+    ECode WriteFileDescriptor(
+        /* [in] */ int fd);
+
+    // The caller owns the returned descriptor and must close it.
+    ECode ReadFileDescriptor(
+        /* [out] */ int* fd);
+
+    inline Integer GetFileDescriptorNumber();
+
+    inline const int* GetFileDescriptors();
+
+    // Takes over the descriptors received along with the data.
+    ECode AdoptFileDescriptors(
+        /* [in] */ const int* fds,
+        /* [in] */ Integer number);
+
+    // Discards the content and returns a buffer of |size| bytes which
+    // becomes the data of the parcel, so a frame can be read into it.
+    Byte* ResetData(
+        /* [in] */ Long size);
+
+    static ECode CreateObject(
+        /* [out] */ IParcel** parcel);
+
+public:
+    // Bounded by what one sendmsg() may carry in SCM_RIGHTS.
+    static constexpr Integer MAX_FD_NUMBER = 16;
+
+private:
+    void CloseFileDescriptors();
+
+private:
+    int mFds[MAX_FD_NUMBER];
+    Integer mFdNumber;
+};
+
+Integer CSocketParcel::GetFileDescriptorNumber()
+{
+    return mFdNumber;
+}
+
+const int* CSocketParcel::GetFileDescriptors()
+{
+    return mFds;
+}
+
+}
+
+#endif // __CCM_CSOCKETPARCEL_H__
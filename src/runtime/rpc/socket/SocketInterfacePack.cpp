@@ -0,0 +1,156 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "SocketInterfacePack.h"
+
+namespace ccm {
+
+static void ReleaseComponentID(
+    /* [in] */ const ComponentID* cid)
+{
+    if (cid != nullptr) {
+        if (cid->mUrl != nullptr) {
+            free(const_cast<char*>(cid->mUrl));
+        }
+        free(const_cast<ComponentID*>(cid));
+    }
+}
+
+const InterfaceID IID_ISocketInterfacePack =
+        {{0x58ac2030,0x2d34,0x4baa,0xb23a,{0x4,0xb,0xc,0x4,0xc,0x2,0x2,0x6,0x0,0xb,0xd,0x9}}, &CID_CCMRuntime};
+
+CCM_INTERFACE_IMPL_LIGHT_2(SocketInterfacePack, LightRefBase, IInterfacePack, ISocketInterfacePack);
+
+SocketInterfacePack::SocketInterfacePack()
+    : mObjectId(0)
+{}
+
+SocketInterfacePack::~SocketInterfacePack()
+{
+    ReleaseComponentID(mCid.mCid);
+    ReleaseComponentID(mIid.mCid);
+}
+
+ECode SocketInterfacePack::GetCoclassID(
+    /* [out] */ CoclassID* cid)
+{
+    VALIDATE_NOT_NULL(cid);
+
+    *cid = mCid;
+    return NOERROR;
+}
+
+ECode SocketInterfacePack::GetInterfaceID(
+    /* [out] */ InterfaceID* iid)
+{
+    VALIDATE_NOT_NULL(iid);
+
+    *iid = mIid;
+    return NOERROR;
+}
+
+ECode SocketInterfacePack::GetHashCode(
+    /* [out] */ Integer* hash)
+{
+    VALIDATE_NOT_NULL(hash);
+
+    *hash = mAddress.GetHashCode() * 31 + (Integer)(mObjectId ^ (mObjectId >> 32));
+    return NOERROR;
+}
+
+ECode SocketInterfacePack::ReadFromParcel(
+    /* [in] */ IParcel* source)
+{
+    source->ReadString(&mAddress);
+    source->ReadLong(&mObjectId);
+    source->ReadCoclassID(&mCid);
+    source->ReadInterfaceID(&mIid);
+    return NOERROR;
+}
+
+ECode SocketInterfacePack::WriteToParcel(
+    /* [in] */ IParcel* dest)
+{
+    dest->WriteString(mAddress);
+    dest->WriteLong(mObjectId);
+    dest->WriteCoclassID(mCid);
+    dest->WriteInterfaceID(mIid);
+    return NOERROR;
+}
+
+String SocketInterfacePack::GetAddress()
+{
+    return mAddress;
+}
+
+void SocketInterfacePack::SetAddress(
+    /* [in] */ const String& address)
+{
+    mAddress = address;
+}
+
+Long SocketInterfacePack::GetObjectId()
+{
+    return mObjectId;
+}
+
+void SocketInterfacePack::SetObjectId(
+    /* [in] */ Long id)
+{
+    mObjectId = id;
+}
+
+void SocketInterfacePack::SetCoclassID(
+    /* [in] */ const CoclassID& cid)
+{
+    mCid = cid;
+    if (cid.mCid != nullptr) {
+        ComponentID* comid = (ComponentID*)malloc(sizeof(ComponentID));
+        if (comid != nullptr) {
+            *comid = *cid.mCid;
+            if (cid.mCid->mUrl != nullptr) {
+                char* url = (char*)malloc(strlen(cid.mCid->mUrl) + 1);
+                if (url != nullptr) {
+                    strcpy(url, cid.mCid->mUrl);
+                }
+                comid->mUrl = url;
+            }
+        }
+        mCid.mCid = comid;
+    }
+}
+
+void SocketInterfacePack::SetInterfaceID(
+    /* [in] */ const InterfaceID& iid)
+{
+    mIid = iid;
+    if (iid.mCid != nullptr) {
+        ComponentID* comid = (ComponentID*)malloc(sizeof(ComponentID));
+        if (comid != nullptr) {
+            *comid = *iid.mCid;
+            if (iid.mCid->mUrl != nullptr) {
+                char* url = (char*)malloc(strlen(iid.mCid->mUrl) + 1);
+                if (url != nullptr) {
+                    strcpy(url, iid.mCid->mUrl);
+                }
+                comid->mUrl = url;
+            }
+        }
+        mIid.mCid = comid;
+    }
+}
+
+}
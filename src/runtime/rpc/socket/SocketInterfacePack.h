@@ -0,0 +1,91 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+#ifndef __CCM_SOCKETINTERFACEPACK_H__
+#define __CCM_SOCKETINTERFACEPACK_H__
+
+#include "registry.h"
+#include "util/ccmrefbase.h"
+
+namespace ccm {
+
+extern const InterfaceID IID_ISocketInterfacePack;
+
+INTERFACE_ID(58ac2030-2d34-4baa-b23a-4bc4c2260bd9)
+interface ISocketInterfacePack : public IInterface
+{
+    using IInterface::Probe;
+
+    inline static ISocketInterfacePack* Probe(
+        /* [in] */ IInterface* object)
+    {
+        if (object == nullptr) return nullptr;
+        return (ISocketInterfacePack*)object->Probe(IID_ISocketInterfacePack);
+    }
+};
+
+class SocketInterfacePack
+    : public LightRefBase
+    , public IInterfacePack
+    , public ISocketInterfacePack
+{
+public:
+    SocketInterfacePack();
+
+    ~SocketInterfacePack();
+
+    CCM_INTERFACE_DECL();
+
+    ECode GetCoclassID(
+        /* [out] */ CoclassID* cid);
+
+    ECode GetInterfaceID(
+        /* [out] */ InterfaceID* iid) override;
+
+    ECode GetHashCode(
+        /* [out] */ Integer* hash) override;
+
+    ECode ReadFromParcel(
+        /* [in] */ IParcel* source) override;
+
+    ECode WriteToParcel(
+        /* [in] */ IParcel* dest) override;
+
+    String GetAddress();
+
+    void SetAddress(
+        /* [in] */ const String& address);
+
+    Long GetObjectId();
+
+    void SetObjectId(
+        /* [in] */ Long id);
+
+    void SetCoclassID(
+        /* [in] */ const CoclassID& cid);
+
+    void SetInterfaceID(
+        /* [in] */ const InterfaceID& iid);
+
+private:
+    String mAddress;
+    Long mObjectId;
+    CoclassID mCid;
+    InterfaceID mIid;
+};
+
+}
+
+#endif // __CCM_SOCKETINTERFACEPACK_H__
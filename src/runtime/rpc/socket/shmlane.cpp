@@ -0,0 +1,508 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+#include "shmlane.h"
+#include "util/ccmlogger.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+namespace ccm {
+
+// The lane is mapped by two processes, so the futexes must not be private.
+static inline void FutexWait(
+    /* [in] */ std::atomic<Integer>* addr,
+    /* [in] */ Integer value,
+    /* [in] */ Integer timeoutMs)
+{
+    struct timespec ts;
+    ts.tv_sec = timeoutMs / 1000;
+    ts.tv_nsec = (timeoutMs % 1000) * 1000000;
+    syscall(SYS_futex, reinterpret_cast<int*>(addr), FUTEX_WAIT, value, &ts, nullptr, 0);
+}
+
+static inline void FutexWake(
+    /* [in] */ std::atomic<Integer>* addr)
+{
+    syscall(SYS_futex, reinterpret_cast<int*>(addr), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+static inline Integer Distance(
+    /* [in] */ Integer from,
+    /* [in] */ Integer to)
+{
+    return (Integer)((uint32_t)to - (uint32_t)from);
+}
+
+static inline Integer Advance(
+    /* [in] */ Integer pos,
+    /* [in] */ Integer length)
+{
+    return (Integer)((uint32_t)pos + (uint32_t)length);
+}
+
+ShmRing::ShmRing()
+    : mOwner(nullptr)
+    , mControl(nullptr)
+    , mData(nullptr)
+    , mCapacity(0)
+    , mReadPos(0)
+    , mPending(nullptr)
+    , mPendingCapacity(0)
+    , mPendingStart(0)
+    , mPendingNumber(0)
+{}
+
+ShmRing::~ShmRing()
+{
+    free(mPending);
+}
+
+void ShmRing::Init(
+    /* [in] */ ShmLane* owner,
+    /* [in] */ Control* control,
+    /* [in] */ Byte* data,
+    /* [in] */ Integer capacity)
+{
+    mOwner = owner;
+    mControl = control;
+    mData = data;
+    mCapacity = capacity;
+    mReadPos.store(control->mHead.load(std::memory_order_acquire),
+            std::memory_order_relaxed);
+}
+
+Boolean ShmRing::IsClosed(
+    /* [in] */ SocketConnection* peer)
+{
+    return mOwner->IsClosed() || (peer != nullptr && peer->IsClosed());
+}
+
+ECode ShmRing::Write(
+    /* [in] */ ECode result,
+    /* [in] */ const void* data,
+    /* [in] */ Long size,
+    /* [in] */ SocketConnection* peer)
+{
+    if (size < 0 || size > SocketConnection::MAX_FRAME_DATA_SIZE ||
+            (size > 0 && data == nullptr)) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    const Byte* src = static_cast<const Byte*>(data);
+    Integer maxChunk = mCapacity / 2 - sizeof(RecordHeader);
+    Long remaining = size;
+    do {
+        Integer chunk = remaining > maxChunk ? maxChunk : (Integer)remaining;
+        Integer length = RecordLength(chunk);
+        // Only the producer moves the head.
+        Integer head = mControl->mHead.load(std::memory_order_relaxed);
+        Integer offset = head & (mCapacity - 1);
+        Integer padding = mCapacity - offset < length ? mCapacity - offset : 0;
+
+        ECode ec = WaitForSpace(head, padding + length, peer);
+        if (FAILED(ec)) {
+            return ec;
+        }
+
+        if (padding > 0) {
+            RecordHeader* pad = reinterpret_cast<RecordHeader*>(mData + offset);
+            pad->mSize = padding - sizeof(RecordHeader);
+            pad->mFlags = FLAG_PAD;
+            pad->mResult = NOERROR;
+            pad->mTotalSize = 0;
+            head = Advance(head, padding);
+            offset = 0;
+        }
+
+        RecordHeader* record = reinterpret_cast<RecordHeader*>(mData + offset);
+        record->mSize = chunk;
+        record->mFlags = remaining > chunk ? FLAG_MORE : 0;
+        record->mResult = result;
+        record->mTotalSize = (Integer)size;
+        if (chunk > 0) {
+            memcpy(record + 1, src, chunk);
+        }
+        src += chunk;
+        remaining -= chunk;
+
+        mControl->mHead.store(Advance(head, length), std::memory_order_seq_cst);
+        if (mControl->mConsumerWaiting.load(std::memory_order_seq_cst) != 0) {
+            mControl->mConsumerWaiting.store(0, std::memory_order_relaxed);
+            FutexWake(&mControl->mHead);
+        }
+    } while (remaining > 0);
+
+    return NOERROR;
+}
+
+ECode ShmRing::WaitForSpace(
+    /* [in] */ Integer head,
+    /* [in] */ Integer needed,
+    /* [in] */ SocketConnection* peer)
+{
+    while (true) {
+        Integer tail = mControl->mTail.load(std::memory_order_acquire);
+        Integer used = Distance(tail, head);
+        if (used < 0 || used > mCapacity) {
+            Logger::E("ShmRing", "The ring is corrupted, used %d of %d.", used, mCapacity);
+            mOwner->Close();
+            return E_REMOTE_EXCEPTION;
+        }
+        if (mCapacity - used >= needed) {
+            return NOERROR;
+        }
+        if (IsClosed(peer)) {
+            return E_REMOTE_EXCEPTION;
+        }
+
+        // Announce the wait before the last look at the tail, the
+        // consumer checks the flag after it moves the tail.
+        mControl->mProducerWaiting.store(1, std::memory_order_seq_cst);
+        if (mControl->mTail.load(std::memory_order_seq_cst) != tail) {
+            continue;
+        }
+        FutexWait(&mControl->mTail, tail, WAIT_TIMEOUT_MS);
+    }
+}
+
+ECode ShmRing::Read(
+    /* [out] */ ECode* result,
+    /* [in] */ CSocketParcel* parcel,
+    /* [in] */ SocketConnection* peer)
+{
+    RecordHeader* record;
+    RecordHeader header;
+    ECode ec = WaitForRecord(peer, &record, &header);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    *result = header.mResult;
+    if (!(header.mFlags & FLAG_MORE)) {
+        // The lane has to outlive the parcel which reads from it.
+        mOwner->AddRef();
+        ec = parcel->SetBorrowedData(reinterpret_cast<Byte*>(record + 1),
+                header.mSize, ReleaseInplaceData, this);
+        if (FAILED(ec)) {
+            ReleaseRecord(record);
+            mOwner->Release();
+        }
+        return ec;
+    }
+
+    // Sizes come from the peer, trust none of them.
+    Integer total = header.mTotalSize;
+    if (total < header.mSize || total > SocketConnection::MAX_FRAME_DATA_SIZE) {
+        ReleaseRecord(record);
+        mOwner->Close();
+        return E_REMOTE_EXCEPTION;
+    }
+    Byte* dest = parcel->ResetData(total);
+    if (dest == nullptr) {
+        ReleaseRecord(record);
+        mOwner->Close();
+        return E_OUT_OF_MEMORY_ERROR;
+    }
+
+    Integer copied = 0;
+    while (true) {
+        if (header.mSize > total - copied) {
+            ReleaseRecord(record);
+            mOwner->Close();
+            return E_REMOTE_EXCEPTION;
+        }
+        memcpy(dest + copied, record + 1, header.mSize);
+        copied += header.mSize;
+        ReleaseRecord(record);
+        if (!(header.mFlags & FLAG_MORE)) {
+            break;
+        }
+        ec = WaitForRecord(peer, &record, &header);
+        if (FAILED(ec)) {
+            return ec;
+        }
+    }
+    if (copied != total) {
+        mOwner->Close();
+        return E_REMOTE_EXCEPTION;
+    }
+    return NOERROR;
+}
+
+ECode ShmRing::WaitForRecord(
+    /* [in] */ SocketConnection* peer,
+    /* [out] */ RecordHeader** record,
+    /* [out] */ RecordHeader* copy)
+{
+    while (true) {
+        Integer readPos = mReadPos.load(std::memory_order_relaxed);
+        Integer head = mControl->mHead.load(std::memory_order_acquire);
+        Integer available = Distance(readPos, head);
+        if (available != 0) {
+            Integer offset = readPos & (mCapacity - 1);
+            if (available < (Integer)sizeof(RecordHeader) || available > mCapacity) {
+                Logger::E("ShmRing", "The ring is corrupted, %d bytes available.", available);
+                mOwner->Close();
+                return E_REMOTE_EXCEPTION;
+            }
+            RecordHeader* r = reinterpret_cast<RecordHeader*>(mData + offset);
+            *copy = *r;
+            // Check the size before rounding it up, a size near the
+            // largest Integer would wrap to a negative length.
+            if (copy->mSize < 0 ||
+                    copy->mSize > mCapacity - offset - (Integer)sizeof(RecordHeader) ||
+                    RecordLength(copy->mSize) > available) {
+                Logger::E("ShmRing", "Bad record of %d bytes.", copy->mSize);
+                mOwner->Close();
+                return E_REMOTE_EXCEPTION;
+            }
+            Integer length = RecordLength(copy->mSize);
+            ECode ec = AddPendingRecord(readPos, length);
+            if (FAILED(ec)) {
+                mOwner->Close();
+                return ec;
+            }
+            mReadPos.store(Advance(readPos, length), std::memory_order_relaxed);
+            if (copy->mFlags & FLAG_PAD) {
+                ReleaseRecord(r);
+                continue;
+            }
+            *record = r;
+            return NOERROR;
+        }
+        if (IsClosed(peer)) {
+            return E_REMOTE_EXCEPTION;
+        }
+
+        mControl->mConsumerWaiting.store(1, std::memory_order_seq_cst);
+        if (mControl->mHead.load(std::memory_order_seq_cst) != head) {
+            continue;
+        }
+        FutexWait(&mControl->mHead, head, WAIT_TIMEOUT_MS);
+    }
+}
+
+ECode ShmRing::AddPendingRecord(
+    /* [in] */ Integer position,
+    /* [in] */ Integer length)
+{
+    Mutex::AutoLock lock(mReleaseLock);
+
+    if (mPendingNumber == mPendingCapacity) {
+        Integer capacity = mPendingCapacity == 0 ? 16 : mPendingCapacity * 2;
+        PendingRecord* pending = (PendingRecord*)malloc(sizeof(PendingRecord) * capacity);
+        if (pending == nullptr) {
+            Logger::E("ShmRing", "Out of memory.");
+            return E_OUT_OF_MEMORY_ERROR;
+        }
+        for (Integer i = 0; i < mPendingNumber; i++) {
+            pending[i] = mPending[(mPendingStart + i) & (mPendingCapacity - 1)];
+        }
+        free(mPending);
+        mPending = pending;
+        mPendingCapacity = capacity;
+        mPendingStart = 0;
+    }
+    PendingRecord& record = mPending[
+            (mPendingStart + mPendingNumber) & (mPendingCapacity - 1)];
+    record.mPosition = position;
+    record.mLength = length;
+    record.mReleased = false;
+    mPendingNumber++;
+    return NOERROR;
+}
+
+void ShmRing::ReleaseRecord(
+    /* [in] */ RecordHeader* record)
+{
+    Mutex::AutoLock lock(mReleaseLock);
+
+    Integer offset = reinterpret_cast<Byte*>(record) - mData;
+    for (Integer i = 0; i < mPendingNumber; i++) {
+        PendingRecord& pending = mPending[(mPendingStart + i) & (mPendingCapacity - 1)];
+        if (!pending.mReleased && (pending.mPosition & (mCapacity - 1)) == offset) {
+            pending.mReleased = true;
+            break;
+        }
+    }
+
+    // The tail only moves over the released records at its front.
+    Boolean moved = false;
+    Integer tail = 0;
+    while (mPendingNumber > 0) {
+        PendingRecord& pending = mPending[mPendingStart];
+        if (!pending.mReleased) {
+            break;
+        }
+        tail = Advance(pending.mPosition, pending.mLength);
+        mPendingStart = (mPendingStart + 1) & (mPendingCapacity - 1);
+        mPendingNumber--;
+        moved = true;
+    }
+    if (!moved) {
+        return;
+    }
+
+    mControl->mTail.store(tail, std::memory_order_seq_cst);
+    if (mControl->mProducerWaiting.load(std::memory_order_seq_cst) != 0) {
+        mControl->mProducerWaiting.store(0, std::memory_order_relaxed);
+        FutexWake(&mControl->mTail);
+    }
+}
+
+void ShmRing::ReleaseInplaceData(
+    /* [in] */ void* owner,
+    /* [in] */ Byte* data)
+{
+    ShmRing* ring = static_cast<ShmRing*>(owner);
+    ShmLane* lane = ring->mOwner;
+    ring->ReleaseRecord(reinterpret_cast<RecordHeader*>(data) - 1);
+    lane->Release();
+}
+
+void ShmRing::WakeUp()
+{
+    FutexWake(&mControl->mHead);
+    FutexWake(&mControl->mTail);
+}
+
+//-------------------------------------------------------------------------------
+
+ShmLane::ShmLane(
+    /* [in] */ void* base,
+    /* [in] */ size_t size,
+    /* [in] */ Integer capacity)
+    : mBase(base)
+    , mSize(size)
+    , mHeader(static_cast<Header*>(base))
+{
+    Byte* data = static_cast<Byte*>(base) + GetHeaderSize();
+    mRequestRing.Init(this, &mHeader->mRequest, data, capacity);
+    mResponseRing.Init(this, &mHeader->mResponse, data + capacity, capacity);
+}
+
+ShmLane::~ShmLane()
+{
+    munmap(mBase, mSize);
+}
+
+size_t ShmLane::GetHeaderSize()
+{
+    return (sizeof(Header) + 4095) & ~(size_t)4095;
+}
+
+ECode ShmLane::Create(
+    /* [in] */ Integer capacity,
+    /* [out] */ ShmLane** lane,
+    /* [out] */ int* fd)
+{
+    if (capacity < MIN_CAPACITY || capacity > MAX_CAPACITY ||
+            (capacity & (capacity - 1)) != 0) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    int memfd = memfd_create("ccm.rpc.lane", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (memfd < 0) {
+        Logger::E("ShmLane", "Create memfd failed, errno is %d.", errno);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    size_t size = GetHeaderSize() + 2 * (size_t)capacity;
+    if (ftruncate(memfd, size) != 0 ||
+            fcntl(memfd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0) {
+        Logger::E("ShmLane", "Set up memfd failed, errno is %d.", errno);
+        close(memfd);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    if (base == MAP_FAILED) {
+        Logger::E("ShmLane", "Map memfd failed, errno is %d.", errno);
+        close(memfd);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    // A new memfd is zero filled, which is a valid state of the atomics.
+    Header* header = static_cast<Header*>(base);
+    header->mMagic = MAGIC;
+    header->mCapacity = capacity;
+
+    *lane = new ShmLane(base, size, capacity);
+    (*lane)->AddRef();
+    *fd = memfd;
+    return NOERROR;
+}
+
+ECode ShmLane::Attach(
+    /* [in] */ int fd,
+    /* [out] */ ShmLane** lane)
+{
+    // Without the seal the peer could shrink the file under our mapping.
+    int seals = fcntl(fd, F_GET_SEALS);
+    if (seals < 0 || !(seals & F_SEAL_SHRINK)) {
+        Logger::E("ShmLane", "The lane memory is not sealed.");
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)GetHeaderSize()) {
+        Logger::E("ShmLane", "Bad lane memory.");
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    size_t size = st.st_size;
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        Logger::E("ShmLane", "Map lane memory failed, errno is %d.", errno);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    Header* header = static_cast<Header*>(base);
+    Integer capacity = header->mCapacity;
+    if (header->mMagic != MAGIC || capacity < MIN_CAPACITY || capacity > MAX_CAPACITY ||
+            (capacity & (capacity - 1)) != 0 ||
+            GetHeaderSize() + 2 * (size_t)capacity != size) {
+        Logger::E("ShmLane", "Bad lane header.");
+        munmap(base, size);
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    *lane = new ShmLane(base, size, capacity);
+    (*lane)->AddRef();
+    return NOERROR;
+}
+
+void ShmLane::Close()
+{
+    mHeader->mClosed.store(1, std::memory_order_seq_cst);
+    mRequestRing.WakeUp();
+    mResponseRing.WakeUp();
+}
+
+Boolean ShmLane::IsClosed()
+{
+    return mHeader->mClosed.load(std::memory_order_acquire) != 0;
+}
+
+}
@@ -0,0 +1,221 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+#ifndef __CCM_SHMLANE_H__
+#define __CCM_SHMLANE_H__
+
+#include "CSocketParcel.h"
+#include "socketconnection.h"
+#include "util/ccmrefbase.h"
+#include "util/mutex.h"
+#include <atomic>
+#include <stdint.h>
+
+namespace ccm {
+
+class ShmLane;
+
+// A single-producer single-consumer ring of records in shared memory.
+// Positions are free running 32-bit counters and the capacity is a power
+// of two. A record which would cross the end of the data area is
+// preceded by a padding record, so every record is contiguous.
+class ShmRing
+{
+public:
+    struct Control
+    {
+        alignas(64) std::atomic<Integer> mHead;
+        alignas(64) std::atomic<Integer> mTail;
+        std::atomic<Integer> mConsumerWaiting;
+        std::atomic<Integer> mProducerWaiting;
+    };
+
+    ShmRing();
+
+    ~ShmRing();
+
+    void Init(
+        /* [in] */ ShmLane* owner,
+        /* [in] */ Control* control,
+        /* [in] */ Byte* data,
+        /* [in] */ Integer capacity);
+
+    // Copies |data| into the ring, in several records if it is larger
+    // than half of the ring.
+    ECode Write(
+        /* [in] */ ECode result,
+        /* [in] */ const void* data,
+        /* [in] */ Long size,
+        /* [in] */ SocketConnection* peer);
+
+    // A message of one record is read in place: |parcel| borrows the
+    // record, which is given back to the producer once the parcel lets
+    // it go. Records are handed back in order, so a consumer must not
+    // hold a parcel while reading the next one.
+    ECode Read(
+        /* [out] */ ECode* result,
+        /* [in] */ CSocketParcel* parcel,
+        /* [in] */ SocketConnection* peer);
+
+    void WakeUp();
+
+private:
+    struct RecordHeader
+    {
+        Integer mSize;
+        Integer mFlags;
+        ECode mResult;
+        Integer mTotalSize;
+    };
+
+    struct PendingRecord
+    {
+        Integer mPosition;
+        Integer mLength;
+        Boolean mReleased;
+    };
+
+    ECode WaitForSpace(
+        /* [in] */ Integer head,
+        /* [in] */ Integer needed,
+        /* [in] */ SocketConnection* peer);
+
+    ECode WaitForRecord(
+        /* [in] */ SocketConnection* peer,
+        /* [out] */ RecordHeader** record,
+        /* [out] */ RecordHeader* copy);
+
+    ECode AddPendingRecord(
+        /* [in] */ Integer position,
+        /* [in] */ Integer length);
+
+    void ReleaseRecord(
+        /* [in] */ RecordHeader* record);
+
+    static void ReleaseInplaceData(
+        /* [in] */ void* owner,
+        /* [in] */ Byte* data);
+
+    Boolean IsClosed(
+        /* [in] */ SocketConnection* peer);
+
+    inline static Integer RecordLength(
+        /* [in] */ Integer size);
+
+private:
+    static constexpr Integer RECORD_ALIGNMENT = 16;
+    static constexpr Integer FLAG_PAD = 0x1;
+    static constexpr Integer FLAG_MORE = 0x2;
+    // Bounds how late a dead peer is noticed by a waiting side.
+    static constexpr Integer WAIT_TIMEOUT_MS = 200;
+
+    ShmLane* mOwner;
+    Control* mControl;
+    Byte* mData;
+    Integer mCapacity;
+    // Where the consumer reads next, the records from the tail up to
+    // here are either in use or released out of order.
+    std::atomic<Integer> mReadPos;
+    Mutex mReleaseLock;
+    // The records from the tail up to mReadPos, oldest first, with the
+    // lengths checked when they were read. The peer can rewrite the ring
+    // at any time, so the tail never moves by what the ring says.
+    PendingRecord* mPending;
+    Integer mPendingCapacity;
+    Integer mPendingStart;
+    Integer mPendingNumber;
+};
+
+Integer ShmRing::RecordLength(
+    /* [in] */ Integer size)
+{
+    return (Integer)((sizeof(RecordHeader) + (uint32_t)size +
+            RECORD_ALIGNMENT - 1) & ~(uint32_t)(RECORD_ALIGNMENT - 1));
+}
+
+// A memfd shared by one proxy and one stub, holding a request ring and a
+// response ring. Large invocations travel through it while the socket
+// connection carries the setup and tells either side the other is gone.
+class ShmLane
+    : public LightRefBase
+{
+public:
+    ~ShmLane();
+
+    // The caller owns the returned |fd|, which is sealed against
+    // resizing so the peer can map it safely.
+    static ECode Create(
+        /* [in] */ Integer capacity,
+        /* [out] */ ShmLane** lane,
+        /* [out] */ int* fd);
+
+    static ECode Attach(
+        /* [in] */ int fd,
+        /* [out] */ ShmLane** lane);
+
+    // Tells both sides the lane is no longer used.
+    void Close();
+
+    Boolean IsClosed();
+
+    inline ShmRing& GetRequestRing();
+
+    inline ShmRing& GetResponseRing();
+
+public:
+    static constexpr Integer DEFAULT_CAPACITY = 4 * 1024 * 1024;
+
+private:
+    struct Header
+    {
+        Integer mMagic;
+        Integer mCapacity;
+        std::atomic<Integer> mClosed;
+        ShmRing::Control mRequest;
+        ShmRing::Control mResponse;
+    };
+
+    ShmLane(
+        /* [in] */ void* base,
+        /* [in] */ size_t size,
+        /* [in] */ Integer capacity);
+
+    static size_t GetHeaderSize();
+
+private:
+    static constexpr Integer MAGIC = 0x4c4d4343; // "CCML"
+    static constexpr Integer MIN_CAPACITY = 4096;
+    static constexpr Integer MAX_CAPACITY = 64 * 1024 * 1024;
+
+    void* mBase;
+    size_t mSize;
+    Header* mHeader;
+    ShmRing mRequestRing;
+    ShmRing mResponseRing;
+};
+
+ShmRing& ShmLane::GetRequestRing()
+{
+    return mRequestRing;
+}
+
+ShmRing& ShmLane::GetResponseRing()
+{
+    return mResponseRing;
+}
+
+}
+
+#endif // __CCM_SHMLANE_H__
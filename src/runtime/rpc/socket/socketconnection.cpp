@@ -0,0 +1,710 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+#include "socketconnection.h"
+#include "util/ccmlogger.h"
+#include <errno.h>
+#include <poll.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace ccm {
+
+// Addresses live in the abstract namespace, so nothing is left behind
+// in the file system when a process goes away.
+static ECode BuildAddress(
+    /* [in] */ const String& address,
+    /* [out] */ struct sockaddr_un* addr,
+    /* [out] */ socklen_t* addrLen)
+{
+    if (address.IsNullOrEmpty() ||
+            address.GetByteLength() >= (Integer)sizeof(addr->sun_path)) {
+        Logger::E("SocketConnection", "Invalid socket address \"%s\".", address.string());
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    memset(addr, 0, sizeof(struct sockaddr_un));
+    addr->sun_family = AF_UNIX;
+    memcpy(addr->sun_path + 1, address.string(), address.GetByteLength());
+    *addrLen = offsetof(struct sockaddr_un, sun_path) + 1 + address.GetByteLength();
+    return NOERROR;
+}
+
+// Abstract addresses have no file system permissions and anybody may
+// take a name first, so both ends of a connection check that the other
+// one runs as the same user.
+static ECode CheckPeerCredentials(
+    /* [in] */ int fd)
+{
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0) {
+        Logger::E("SocketConnection", "Get peer credentials failed, errno is %d.", errno);
+        return E_REMOTE_EXCEPTION;
+    }
+    if (cred.uid != geteuid()) {
+        Logger::E("SocketConnection", "Refuse process %d of user %d.", cred.pid, cred.uid);
+        return E_REMOTE_EXCEPTION;
+    }
+    return NOERROR;
+}
+
+// Moves the SCM_RIGHTS descriptors of |msg| to |fds|, the ones beyond
+// MAX_FD_NUMBER are closed.
+static void TakeFileDescriptors(
+    /* [in] */ struct msghdr* msg,
+    /* [out] */ int* fds,
+    /* [out] */ Integer* fdNumber)
+{
+    *fdNumber = 0;
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(msg); cmsg != nullptr;
+            cmsg = CMSG_NXTHDR(msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+        Integer number = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        const int* cfds = reinterpret_cast<const int*>(CMSG_DATA(cmsg));
+        for (Integer i = 0; i < number; i++) {
+            if (*fdNumber < CSocketParcel::MAX_FD_NUMBER) {
+                fds[(*fdNumber)++] = cfds[i];
+            }
+            else {
+                close(cfds[i]);
+            }
+        }
+    }
+}
+
+static ECode ReceiveFully(
+    /* [in] */ int fd,
+    /* [in] */ void* buffer,
+    /* [in] */ Long size)
+{
+    Byte* data = static_cast<Byte*>(buffer);
+    while (size > 0) {
+        ssize_t ret = recv(fd, data, size, 0);
+        if (ret > 0) {
+            data += ret;
+            size -= ret;
+        }
+        else if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        else {
+            return E_REMOTE_EXCEPTION;
+        }
+    }
+    return NOERROR;
+}
+
+SocketConnection::SocketConnection(
+    /* [in] */ int fd)
+    : mFd(fd)
+    , mClosed(false)
+{}
+
+SocketConnection::~SocketConnection()
+{
+    if (mFd >= 0) {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+ECode SocketConnection::Connect(
+    /* [in] */ const String& address,
+    /* [out] */ int* fd)
+{
+    struct sockaddr_un addr;
+    socklen_t addrLen;
+    ECode ec = BuildAddress(address, &addr, &addrLen);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (sock < 0) {
+        Logger::E("SocketConnection", "Create socket failed, errno is %d.", errno);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    int ret;
+    while ((ret = connect(sock, (struct sockaddr*)&addr, addrLen)) < 0 && errno == EINTR);
+    if (ret < 0) {
+        Logger::E("SocketConnection", "Connect to \"%s\" failed, errno is %d.",
+                address.string(), errno);
+        close(sock);
+        return E_REMOTE_EXCEPTION;
+    }
+
+    ec = CheckPeerCredentials(sock);
+    if (FAILED(ec)) {
+        close(sock);
+        return ec;
+    }
+
+    *fd = sock;
+    return NOERROR;
+}
+
+ECode SocketConnection::Listen(
+    /* [in] */ const String& address,
+    /* [out] */ int* fd)
+{
+    struct sockaddr_un addr;
+    socklen_t addrLen;
+    ECode ec = BuildAddress(address, &addr, &addrLen);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (sock < 0) {
+        Logger::E("SocketConnection", "Create socket failed, errno is %d.", errno);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    if (bind(sock, (struct sockaddr*)&addr, addrLen) < 0 ||
+            listen(sock, SOMAXCONN) < 0) {
+        Logger::E("SocketConnection", "Listen on \"%s\" failed, errno is %d.",
+                address.string(), errno);
+        close(sock);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    *fd = sock;
+    return NOERROR;
+}
+
+ECode SocketConnection::Accept(
+    /* [in] */ int listenFd,
+    /* [out] */ int* fd)
+{
+    int sock;
+    while ((sock = accept4(listenFd, nullptr, nullptr,
+            SOCK_CLOEXEC | SOCK_NONBLOCK)) < 0 && errno == EINTR);
+    if (sock < 0) {
+        Logger::E("SocketConnection", "Accept connection failed, errno is %d.", errno);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    ECode ec = CheckPeerCredentials(sock);
+    if (FAILED(ec)) {
+        close(sock);
+        return ec;
+    }
+
+    *fd = sock;
+    return NOERROR;
+}
+
+ECode SocketConnection::SendFrame(
+    /* [in] */ FrameHeader& header,
+    /* [in] */ CSocketParcel* parcel)
+{
+    HANDLE data = 0;
+    Long size = 0;
+    Integer fdNumber = 0;
+    if (parcel != nullptr) {
+        parcel->GetData(&data);
+        parcel->GetDataSize(&size);
+        fdNumber = parcel->GetFileDescriptorNumber();
+    }
+    header.mDataSize = size;
+
+    struct iovec iov[2];
+    iov[0].iov_base = &header;
+    iov[0].iov_len = sizeof(FrameHeader);
+    iov[1].iov_base = reinterpret_cast<void*>(data);
+    iov[1].iov_len = size;
+
+    char control[CMSG_SPACE(sizeof(int) * CSocketParcel::MAX_FD_NUMBER)];
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = size > 0 ? 2 : 1;
+    if (fdNumber > 0) {
+        msg.msg_control = control;
+        msg.msg_controllen = CMSG_SPACE(sizeof(int) * fdNumber);
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int) * fdNumber);
+        memcpy(CMSG_DATA(cmsg), parcel->GetFileDescriptors(), sizeof(int) * fdNumber);
+    }
+
+    Mutex::AutoLock lock(mWriteLock);
+
+    while (true) {
+        ssize_t ret = sendmsg(mFd, &msg, MSG_NOSIGNAL);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                // An accepted socket does not block, wait for the peer
+                // to read. A shut down socket ends the wait.
+                struct pollfd pfd;
+                pfd.fd = mFd;
+                pfd.events = POLLOUT;
+                pfd.revents = 0;
+                poll(&pfd, 1, -1);
+                continue;
+            }
+            if (errno != EPIPE && errno != ECONNRESET) {
+                Logger::E("SocketConnection", "Send frame failed, errno is %d.", errno);
+            }
+            return E_REMOTE_EXCEPTION;
+        }
+
+        // The descriptors went out with the first byte.
+        msg.msg_control = nullptr;
+        msg.msg_controllen = 0;
+        while (msg.msg_iovlen > 0 && (size_t)ret >= msg.msg_iov[0].iov_len) {
+            ret -= msg.msg_iov[0].iov_len;
+            msg.msg_iov++;
+            msg.msg_iovlen--;
+        }
+        if (msg.msg_iovlen == 0) {
+            return NOERROR;
+        }
+        msg.msg_iov[0].iov_base = static_cast<Byte*>(msg.msg_iov[0].iov_base) + ret;
+        msg.msg_iov[0].iov_len -= ret;
+    }
+}
+
+ECode SocketConnection::ReceiveFrame(
+    /* [out] */ FrameHeader* header,
+    /* [out] */ CSocketParcel** parcel)
+{
+    char control[CMSG_SPACE(sizeof(int) * CSocketParcel::MAX_FD_NUMBER)];
+    struct iovec iov;
+    iov.iov_base = header;
+    iov.iov_len = sizeof(FrameHeader);
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t ret;
+    while ((ret = recvmsg(mFd, &msg, MSG_CMSG_CLOEXEC)) < 0 && errno == EINTR);
+    if (ret <= 0) {
+        return E_REMOTE_EXCEPTION;
+    }
+
+    int fds[CSocketParcel::MAX_FD_NUMBER];
+    Integer fdNumber;
+    TakeFileDescriptors(&msg, fds, &fdNumber);
+
+    AutoPtr<CSocketParcel> p = new CSocketParcel();
+    p->AdoptFileDescriptors(fds, fdNumber);
+    if ((msg.msg_flags & MSG_CTRUNC) != 0) {
+        Logger::E("SocketConnection", "File descriptors of a frame are truncated.");
+        return E_REMOTE_EXCEPTION;
+    }
+
+    ECode ec = ReceiveFully(mFd, reinterpret_cast<Byte*>(header) + ret,
+            sizeof(FrameHeader) - ret);
+    if (FAILED(ec)) {
+        return ec;
+    }
+    if (header->mDataSize < 0 || header->mDataSize > MAX_FRAME_DATA_SIZE) {
+        Logger::E("SocketConnection", "Invalid frame data size %lld.", header->mDataSize);
+        return E_REMOTE_EXCEPTION;
+    }
+
+    if (header->mDataSize > 0) {
+        Byte* data = p->ResetData(header->mDataSize);
+        if (data == nullptr) {
+            return E_OUT_OF_MEMORY_ERROR;
+        }
+        ec = ReceiveFully(mFd, data, header->mDataSize);
+        if (FAILED(ec)) {
+            return ec;
+        }
+    }
+
+    p.MoveTo(parcel);
+    return NOERROR;
+}
+
+void SocketConnection::Shutdown()
+{
+    mClosed.store(true, std::memory_order_release);
+    shutdown(mFd, SHUT_RDWR);
+}
+
+//-------------------------------------------------------------------------------
+
+SocketPeer::SocketPeer(
+    /* [in] */ int fd)
+    : SocketConnection(fd)
+    , mHeaderReceived(0)
+    , mData(nullptr)
+    , mDataReceived(0)
+{}
+
+ECode SocketPeer::ReceivePart(
+    /* [out] */ FrameHeader* header,
+    /* [out] */ CSocketParcel** parcel)
+{
+    *parcel = nullptr;
+    if (mParcel == nullptr) {
+        mParcel = new CSocketParcel();
+        mHeaderReceived = 0;
+        mData = nullptr;
+        mDataReceived = 0;
+    }
+
+    while (mHeaderReceived < (Long)sizeof(FrameHeader)) {
+        char control[CMSG_SPACE(sizeof(int) * CSocketParcel::MAX_FD_NUMBER)];
+        struct iovec iov;
+        iov.iov_base = reinterpret_cast<Byte*>(&mHeader) + mHeaderReceived;
+        iov.iov_len = sizeof(FrameHeader) - mHeaderReceived;
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        ssize_t ret = recvmsg(mFd, &msg, MSG_CMSG_CLOEXEC);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return NOERROR;
+        }
+        if (ret <= 0) {
+            return E_REMOTE_EXCEPTION;
+        }
+
+        // The descriptors come with the first byte of the frame.
+        int fds[CSocketParcel::MAX_FD_NUMBER];
+        Integer fdNumber;
+        TakeFileDescriptors(&msg, fds, &fdNumber);
+        if (fdNumber > 0) {
+            mParcel->AdoptFileDescriptors(fds, fdNumber);
+        }
+        if ((msg.msg_flags & MSG_CTRUNC) != 0) {
+            Logger::E("SocketPeer", "File descriptors of a frame are truncated.");
+            return E_REMOTE_EXCEPTION;
+        }
+
+        mHeaderReceived += ret;
+        if (mHeaderReceived == (Long)sizeof(FrameHeader)) {
+            if (mHeader.mDataSize < 0 || mHeader.mDataSize > MAX_FRAME_DATA_SIZE) {
+                Logger::E("SocketPeer", "Invalid frame data size %lld.", mHeader.mDataSize);
+                return E_REMOTE_EXCEPTION;
+            }
+            if (mHeader.mDataSize > 0) {
+                mData = mParcel->ResetData(mHeader.mDataSize);
+                if (mData == nullptr) {
+                    return E_OUT_OF_MEMORY_ERROR;
+                }
+            }
+        }
+    }
+
+    while (mDataReceived < mHeader.mDataSize) {
+        ssize_t ret = recv(mFd, mData + mDataReceived,
+                mHeader.mDataSize - mDataReceived, 0);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return NOERROR;
+        }
+        if (ret <= 0) {
+            return E_REMOTE_EXCEPTION;
+        }
+        mDataReceived += ret;
+    }
+
+    *header = mHeader;
+    mData = nullptr;
+    mParcel.MoveTo(parcel);
+    return NOERROR;
+}
+
+//-------------------------------------------------------------------------------
+
+Mutex SocketClient::sClientsLock;
+SocketClient* SocketClient::sClients = nullptr;
+
+SocketClient::SocketClient(
+    /* [in] */ int fd,
+    /* [in] */ const String& address)
+    : SocketConnection(fd)
+    , mAddress(address)
+    , mPendingCalls(nullptr)
+    , mNextCallId(1)
+    , mAlive(true)
+    , mNext(nullptr)
+{}
+
+ECode SocketClient::Get(
+    /* [in] */ const String& address,
+    /* [out] */ SocketClient** client)
+{
+    Mutex::AutoLock lock(sClientsLock);
+
+    for (SocketClient* c = sClients; c != nullptr; c = c->mNext) {
+        if (c->mAddress.Equals(address) && c->IsAlive()) {
+            *client = c;
+            REFCOUNT_ADD(*client);
+            return NOERROR;
+        }
+    }
+
+    int fd;
+    ECode ec = SocketConnection::Connect(address, &fd);
+    if (FAILED(ec)) {
+        return ec;
+    }
+
+    AutoPtr<SocketClient> c = new SocketClient(fd, address);
+    // The reader thread holds a reference until it exits.
+    c->AddRef();
+    int ret = pthread_create(&c->mReaderThread, nullptr,
+            SocketClient::ReaderThreadEntry, (void*)c.Get());
+    if (ret != 0) {
+        Logger::E("SocketClient", "Create reader thread failed, error is %d.", ret);
+        c->Release();
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    // The list holds another one until the connection is lost or closed.
+    c->AddRef();
+    c->mNext = sClients;
+    sClients = c;
+    c.MoveTo(client);
+    return NOERROR;
+}
+
+ECode SocketClient::Call(
+    /* [in] */ Long objectId,
+    /* [in] */ CSocketParcel* argParcel,
+    /* [out] */ CSocketParcel** resParcel,
+    /* [in] */ Integer type)
+{
+    PendingCall call(0, mLock);
+    {
+        Mutex::AutoLock lock(mLock);
+        if (!mAlive) {
+            return E_REMOTE_EXCEPTION;
+        }
+        call.mCallId = mNextCallId++;
+        call.mNext = mPendingCalls;
+        mPendingCalls = &call;
+    }
+
+    FrameHeader header;
+    header.mType = type;
+    header.mResult = NOERROR;
+    header.mCallId = call.mCallId;
+    header.mObjectId = objectId;
+    ECode ec = SendFrame(header, argParcel);
+
+    Mutex::AutoLock lock(mLock);
+    if (FAILED(ec) && !call.mDone) {
+        PendingCall** pc = &mPendingCalls;
+        while (*pc != &call) {
+            pc = &(*pc)->mNext;
+        }
+        *pc = call.mNext;
+        return ec;
+    }
+    while (!call.mDone) {
+        call.mCond.Wait();
+    }
+    call.mParcel.MoveTo(resParcel);
+    return call.mResult;
+}
+
+ECode SocketClient::CallAsync(
+    /* [in] */ Long objectId,
+    /* [in] */ CSocketParcel* argParcel,
+    /* [in] */ InvocationFuture* future)
+{
+    PendingCall* call = new PendingCall(0, mLock);
+    call->mFuture = future;
+    Long callId;
+    {
+        Mutex::AutoLock lock(mLock);
+        if (!mAlive) {
+            delete call;
+            return E_REMOTE_EXCEPTION;
+        }
+        callId = call->mCallId = mNextCallId++;
+        call->mNext = mPendingCalls;
+        mPendingCalls = call;
+    }
+
+    // The reply may have completed and freed |call| from now on.
+    FrameHeader header;
+    header.mType = FRAME_INVOKE;
+    header.mResult = NOERROR;
+    header.mCallId = callId;
+    header.mObjectId = objectId;
+    ECode ec = SendFrame(header, argParcel);
+    if (FAILED(ec)) {
+        Mutex::AutoLock lock(mLock);
+        PendingCall** pc = &mPendingCalls;
+        while (*pc != nullptr && (*pc)->mCallId != callId) {
+            pc = &(*pc)->mNext;
+        }
+        if (*pc != nullptr) {
+            call = *pc;
+            *pc = call->mNext;
+            delete call;
+        }
+    }
+    return ec;
+}
+
+ECode SocketClient::Post(
+    /* [in] */ Long objectId,
+    /* [in] */ CSocketParcel* argParcel)
+{
+    if (!IsAlive()) {
+        return E_REMOTE_EXCEPTION;
+    }
+
+    FrameHeader header;
+    header.mType = FRAME_ONEWAY;
+    header.mResult = NOERROR;
+    header.mCallId = 0;
+    header.mObjectId = objectId;
+    return SendFrame(header, argParcel);
+}
+
+Boolean SocketClient::IsAlive()
+{
+    Mutex::AutoLock lock(mLock);
+    return mAlive;
+}
+
+void* SocketClient::ReaderThreadEntry(
+    /* [in] */ void* arg)
+{
+    SocketClient* client = static_cast<SocketClient*>(arg);
+    client->ReadReplies();
+
+    Boolean listed = false;
+    {
+        Mutex::AutoLock lock(sClientsLock);
+        SocketClient** c = &sClients;
+        while (*c != nullptr && *c != client) {
+            c = &(*c)->mNext;
+        }
+        if (*c != nullptr) {
+            *c = client->mNext;
+            listed = true;
+            // Nobody is going to join a connection which died by itself.
+            pthread_detach(pthread_self());
+        }
+    }
+
+    if (listed) {
+        client->Release();
+    }
+    client->Release();
+    return nullptr;
+}
+
+void SocketClient::ReadReplies()
+{
+    while (true) {
+        FrameHeader header;
+        AutoPtr<CSocketParcel> parcel;
+        if (FAILED(ReceiveFrame(&header, &parcel))) {
+            break;
+        }
+        if (header.mType != FRAME_REPLY) {
+            Logger::W("SocketClient", "Unexpected frame of type %d.", header.mType);
+            continue;
+        }
+
+        Mutex::AutoLock lock(mLock);
+        PendingCall** pc = &mPendingCalls;
+        while (*pc != nullptr && (*pc)->mCallId != header.mCallId) {
+            pc = &(*pc)->mNext;
+        }
+        if (*pc == nullptr) {
+            Logger::W("SocketClient", "No call is waiting for reply %lld.", header.mCallId);
+            continue;
+        }
+        PendingCall* call = *pc;
+        *pc = call->mNext;
+        CompleteCall(call, header.mResult, parcel);
+    }
+
+    FailPendingCalls();
+}
+
+void SocketClient::FailPendingCalls()
+{
+    Shutdown();
+
+    Mutex::AutoLock lock(mLock);
+    mAlive = false;
+    while (mPendingCalls != nullptr) {
+        PendingCall* call = mPendingCalls;
+        mPendingCalls = call->mNext;
+        CompleteCall(call, E_REMOTE_EXCEPTION, nullptr);
+    }
+}
+
+void SocketClient::CompleteCall(
+    /* [in] */ PendingCall* call,
+    /* [in] */ ECode ec,
+    /* [in] */ CSocketParcel* resParcel)
+{
+    if (call->mFuture != nullptr) {
+        call->mFuture->Complete(ec, (IParcel*)resParcel);
+        delete call;
+        return;
+    }
+    call->mParcel = resParcel;
+    call->mResult = ec;
+    call->mDone = true;
+    call->mCond.Signal();
+}
+
+void SocketClient::CloseAll()
+{
+    SocketClient* clients;
+    {
+        Mutex::AutoLock lock(sClientsLock);
+        clients = sClients;
+        sClients = nullptr;
+    }
+
+    while (clients != nullptr) {
+        SocketClient* c = clients;
+        clients = c->mNext;
+        c->Shutdown();
+        pthread_join(c->mReaderThread, nullptr);
+        c->Release();
+    }
+}
+
+}
@@ -0,0 +1,217 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+#ifndef __CCM_SOCKETCONNECTION_H__
+#define __CCM_SOCKETCONNECTION_H__
+
+#include "CSocketParcel.h"
+#include "invocationfuture.h"
+#include "util/ccmautoptr.h"
+#include "util/ccmrefbase.h"
+#include "util/mutex.h"
+#include <atomic>
+#include <pthread.h>
+
+namespace ccm {
+
+// Every frame is a FrameHeader followed by mDataSize bytes of parcel
+// data. The file descriptors of the parcel ride on the header as
+// SCM_RIGHTS ancillary data.
+struct FrameHeader
+{
+    Integer mType;
+    ECode mResult;
+    Long mCallId;
+    Long mObjectId;
+    Long mDataSize;
+};
+
+class SocketConnection
+    : public LightRefBase
+{
+public:
+    SocketConnection(
+        /* [in] */ int fd);
+
+    ~SocketConnection();
+
+    static ECode Connect(
+        /* [in] */ const String& address,
+        /* [out] */ int* fd);
+
+    static ECode Listen(
+        /* [in] */ const String& address,
+        /* [out] */ int* fd);
+
+    // The accepted |fd| does not block.
+    static ECode Accept(
+        /* [in] */ int listenFd,
+        /* [out] */ int* fd);
+
+    // Frames from different threads never interleave on the wire.
+    ECode SendFrame(
+        /* [in] */ FrameHeader& header,
+        /* [in] */ CSocketParcel* parcel);
+
+    ECode ReceiveFrame(
+        /* [out] */ FrameHeader* header,
+        /* [out] */ CSocketParcel** parcel);
+
+    // Makes a blocked ReceiveFrame() return.
+    void Shutdown();
+
+    inline Boolean IsClosed();
+
+    inline int GetFd();
+
+public:
+    static constexpr Integer FRAME_INVOKE = 1;
+    static constexpr Integer FRAME_REPLY = 2;
+    // Hands a shared memory lane (see shmlane.h) over to a stub.
+    static constexpr Integer FRAME_ATTACH_LANE = 3;
+    // Invokes a [oneway] method, the stub sends no reply.
+    static constexpr Integer FRAME_ONEWAY = 4;
+    static constexpr Long MAX_FRAME_DATA_SIZE = 256 * 1024 * 1024;
+
+protected:
+    int mFd;
+    Mutex mWriteLock;
+    std::atomic<Boolean> mClosed;
+};
+
+Boolean SocketConnection::IsClosed()
+{
+    return mClosed.load(std::memory_order_acquire);
+}
+
+int SocketConnection::GetFd()
+{
+    return mFd;
+}
+
+// The stub side of an accepted connection. One I/O thread serves all
+// peers, so a frame is taken as it arrives and a peer which stops in the
+// middle of one holds up nobody else.
+class SocketPeer
+    : public SocketConnection
+{
+public:
+    SocketPeer(
+        /* [in] */ int fd);
+
+    // Reads what has arrived of the current frame. |parcel| is set once
+    // the frame is whole, and left null while more of it is to come.
+    ECode ReceivePart(
+        /* [out] */ FrameHeader* header,
+        /* [out] */ CSocketParcel** parcel);
+
+private:
+    FrameHeader mHeader;
+    Long mHeaderReceived;
+    // The frame in progress, null between frames.
+    AutoPtr<CSocketParcel> mParcel;
+    Byte* mData;
+    Long mDataReceived;
+};
+
+// The proxy side of a connection. All proxies of one address share it,
+// requests are pipelined and a reader thread matches the replies to the
+// waiting callers by their call ids.
+class SocketClient
+    : public SocketConnection
+{
+private:
+    struct PendingCall
+    {
+        PendingCall(
+            /* [in] */ Long callId,
+            /* [in] */ Mutex& lock)
+            : mCallId(callId)
+            , mDone(false)
+            , mResult(NOERROR)
+            , mCond(lock)
+            , mNext(nullptr)
+        {}
+
+        Long mCallId;
+        Boolean mDone;
+        ECode mResult;
+        AutoPtr<CSocketParcel> mParcel;
+        Condition mCond;
+        // Set for an asynchronous call, which is owned by the list and
+        // completes the future instead of waking up a caller.
+        AutoPtr<InvocationFuture> mFuture;
+        PendingCall* mNext;
+    };
+
+public:
+    SocketClient(
+        /* [in] */ int fd,
+        /* [in] */ const String& address);
+
+    static ECode Get(
+        /* [in] */ const String& address,
+        /* [out] */ SocketClient** client);
+
+    ECode Call(
+        /* [in] */ Long objectId,
+        /* [in] */ CSocketParcel* argParcel,
+        /* [out] */ CSocketParcel** resParcel,
+        /* [in] */ Integer type = FRAME_INVOKE);
+
+    // Returns once the request is sent, the reply completes |future|.
+    ECode CallAsync(
+        /* [in] */ Long objectId,
+        /* [in] */ CSocketParcel* argParcel,
+        /* [in] */ InvocationFuture* future);
+
+    // Sends a request which has no reply.
+    ECode Post(
+        /* [in] */ Long objectId,
+        /* [in] */ CSocketParcel* argParcel);
+
+    Boolean IsAlive();
+
+    static void CloseAll();
+
+private:
+    static void* ReaderThreadEntry(
+        /* [in] */ void* arg);
+
+    void ReadReplies();
+
+    void FailPendingCalls();
+
+    static void CompleteCall(
+        /* [in] */ PendingCall* call,
+        /* [in] */ ECode ec,
+        /* [in] */ CSocketParcel* resParcel);
+
+private:
+    static Mutex sClientsLock;
+    static SocketClient* sClients;
+
+    String mAddress;
+    Mutex mLock;
+    PendingCall* mPendingCalls;
+    Long mNextCallId;
+    Boolean mAlive;
+    pthread_t mReaderThread;
+    SocketClient* mNext;
+};
+
+}
+
+#endif // __CCM_SOCKETCONNECTION_H__
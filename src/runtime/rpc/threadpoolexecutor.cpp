@@ -0,0 +1,253 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+//=========================================================================
+// Copyright (C) 2012 The Elastos Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "threadpoolexecutor.h"
+#include "util/ccmlogger.h"
+
+namespace ccm {
+
+AutoPtr<ThreadPoolExecutor> ThreadPoolExecutor::sInstance;
+Mutex ThreadPoolExecutor::sInstanceLock;
+
+// The pool whose worker is the current thread.
+static thread_local ThreadPoolExecutor* sCurrentExecutor = nullptr;
+
+ThreadPoolExecutor::BlockingScope::BlockingScope()
+    : mExecutor(sCurrentExecutor)
+{
+    if (mExecutor != nullptr) {
+        mExecutor->BeginBlocking();
+    }
+}
+
+ThreadPoolExecutor::BlockingScope::~BlockingScope()
+{
+    if (mExecutor != nullptr) {
+        mExecutor->EndBlocking();
+    }
+}
+
+ThreadPoolExecutor::ThreadPoolExecutor(
+    /* [in] */ Integer maxThreadNumber)
+    : mTaskCond(mMainLock)
+    , mTaskHead(nullptr)
+    , mTaskTail(nullptr)
+    , mTaskNumber(0)
+    , mMaxThreadNumber(maxThreadNumber > 0 ? maxThreadNumber : DEFAULT_THREAD_NUMBER)
+    , mThreadNumber(0)
+    , mIdleThreadNumber(0)
+    , mBlockedThreadNumber(0)
+{}
+
+ThreadPoolExecutor::~ThreadPoolExecutor()
+{
+    Task* task = mTaskHead;
+    while (task != nullptr) {
+        Task* next = task->mNext;
+        delete task;
+        task = next;
+    }
+    mTaskHead = mTaskTail = nullptr;
+}
+
+AutoPtr<ThreadPoolExecutor> ThreadPoolExecutor::GetInstance()
+{
+    {
+        Mutex::AutoLock lock(sInstanceLock);
+        if (sInstance == nullptr) {
+            sInstance = new ThreadPoolExecutor();
+        }
+    }
+    return sInstance;
+}
+
+ECode ThreadPoolExecutor::RunTask(
+    /* [in] */ Runnable* task)
+{
+    if (task == nullptr) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    Task* t = new Task(task);
+
+    Mutex::AutoLock lock(mMainLock);
+
+    // The task is queued only once some worker can run it, so a caller
+    // which gets an error may run the task itself. Workers take tasks
+    // under mMainLock, so a new one can not miss it. An idle worker only
+    // leaves the idle count when it wakes up, so the tasks queued before
+    // have a claim on it already.
+    if (mTaskNumber >= mIdleThreadNumber &&
+            mThreadNumber - mBlockedThreadNumber < mMaxThreadNumber) {
+        ECode ec = StartWorkerLocked();
+        if (FAILED(ec) && mThreadNumber == 0) {
+            Logger::E("ThreadPoolExecutor", "No worker can run the task.");
+            delete t;
+            return ec;
+        }
+    }
+    else {
+        mTaskCond.Signal();
+    }
+
+    if (mTaskTail == nullptr) {
+        mTaskHead = mTaskTail = t;
+    }
+    else {
+        mTaskTail->mNext = t;
+        mTaskTail = t;
+    }
+    mTaskNumber++;
+    return NOERROR;
+}
+
+ECode ThreadPoolExecutor::StopTask(
+    /* [in] */ Runnable* task)
+{
+    Mutex::AutoLock lock(mMainLock);
+
+    Task* prev = nullptr;
+    Task* curr = mTaskHead;
+    while (curr != nullptr) {
+        if (curr->mRunnable == task) {
+            if (prev == nullptr) {
+                mTaskHead = curr->mNext;
+            }
+            else {
+                prev->mNext = curr->mNext;
+            }
+            if (mTaskTail == curr) {
+                mTaskTail = prev;
+            }
+            mTaskNumber--;
+            delete curr;
+            return NOERROR;
+        }
+        prev = curr;
+        curr = curr->mNext;
+    }
+    return E_NOT_FOUND_EXCEPTION;
+}
+
+ECode ThreadPoolExecutor::SetMaxThreadNumber(
+    /* [in] */ Integer number)
+{
+    if (number <= 0) {
+        return E_ILLEGAL_ARGUMENT_EXCEPTION;
+    }
+
+    Mutex::AutoLock lock(mMainLock);
+    mMaxThreadNumber = number;
+    // Surplus workers exit once they become idle.
+    mTaskCond.SignalAll();
+    return NOERROR;
+}
+
+Integer ThreadPoolExecutor::GetMaxThreadNumber()
+{
+    Mutex::AutoLock lock(mMainLock);
+    return mMaxThreadNumber;
+}
+
+void ThreadPoolExecutor::BeginBlocking()
+{
+    Mutex::AutoLock lock(mMainLock);
+    mBlockedThreadNumber++;
+    // The queued tasks may have been waiting for this worker.
+    if (mTaskNumber > mIdleThreadNumber &&
+            mThreadNumber - mBlockedThreadNumber < mMaxThreadNumber) {
+        StartWorkerLocked();
+    }
+}
+
+void ThreadPoolExecutor::EndBlocking()
+{
+    Mutex::AutoLock lock(mMainLock);
+    // A surplus worker exits once it becomes idle.
+    mBlockedThreadNumber--;
+}
+
+ECode ThreadPoolExecutor::StartWorkerLocked()
+{
+    pthread_attr_t threadAddr;
+    pthread_attr_init(&threadAddr);
+    pthread_attr_setdetachstate(&threadAddr, PTHREAD_CREATE_DETACHED);
+
+    pthread_t thread;
+    int ret = pthread_create(&thread, &threadAddr, ThreadPoolExecutor::ThreadEntry, (void*)this);
+    pthread_attr_destroy(&threadAddr);
+    if (ret != 0) {
+        Logger::E("ThreadPoolExecutor", "Create worker thread failed, error is %d.", ret);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    mThreadNumber++;
+    return NOERROR;
+}
+
+void* ThreadPoolExecutor::ThreadEntry(void* arg)
+{
+    AutoPtr<ThreadPoolExecutor> executor = (ThreadPoolExecutor*)arg;
+    sCurrentExecutor = executor;
+
+    while (true) {
+        Task* task;
+        {
+            Mutex::AutoLock lock(executor->mMainLock);
+            while (executor->mTaskHead == nullptr &&
+                    executor->mThreadNumber - executor->mBlockedThreadNumber <=
+                            executor->mMaxThreadNumber) {
+                executor->mIdleThreadNumber++;
+                executor->mTaskCond.Wait();
+                executor->mIdleThreadNumber--;
+            }
+            if (executor->mThreadNumber - executor->mBlockedThreadNumber >
+                    executor->mMaxThreadNumber) {
+                executor->mThreadNumber--;
+                break;
+            }
+            task = executor->mTaskHead;
+            executor->mTaskHead = task->mNext;
+            executor->mTaskNumber--;
+            if (executor->mTaskHead == nullptr) {
+                executor->mTaskTail = nullptr;
+            }
+        }
+
+        task->mRunnable->Run();
+        delete task;
+    }
+
+    return nullptr;
+}
+
+}
@@ -35,8 +35,8 @@
 
 #include "ccmautoptr.h"
 #include "ccmrefbase.h"
-#include "util/arraylist.h"
 #include "util/mutex.h"
+#include <pthread.h>
 
 namespace ccm {
 
@@ -51,25 +51,41 @@ public:
         virtual ECode Run() = 0;
     };
 
-private:
-    class Worker
-        : public LightRefBase
+    // Marks the current thread as blocked, e.g. waiting for the reply of
+    // an outgoing call, while the object is alive. A blocked worker does
+    // not count against the maximum, so a nested call which comes back
+    // to this process gets a worker of its own instead of waiting for
+    // one which is waiting for it. Does nothing outside the workers.
+    class BlockingScope
     {
     public:
-        Worker(
-            /* [in] */ Runnable* task,
-            /* [in] */ ThreadPoolExecutor* owner);
+        BlockingScope();
 
-        ECode Run();
+        ~BlockingScope();
 
-    public:
-        pthread_t mThread;
-        AutoPtr<Runnable> mTask;
-        ThreadPoolExecutor* mOwner;
-        Mutex mLock;
+    private:
+        ThreadPoolExecutor* mExecutor;
+    };
+
+private:
+    struct Task
+    {
+        Task(
+            /* [in] */ Runnable* runnable)
+            : mRunnable(runnable)
+            , mNext(nullptr)
+        {}
+
+        AutoPtr<Runnable> mRunnable;
+        Task* mNext;
     };
 
 public:
+    ThreadPoolExecutor(
+        /* [in] */ Integer maxThreadNumber = DEFAULT_THREAD_NUMBER);
+
+    ~ThreadPoolExecutor();
+
     static AutoPtr<ThreadPoolExecutor> GetInstance();
 
     ECode RunTask(
@@ -78,15 +94,36 @@ public:
     ECode StopTask(
         /* [in] */ Runnable* task);
 
+    ECode SetMaxThreadNumber(
+        /* [in] */ Integer number);
+
+    Integer GetMaxThreadNumber();
+
 private:
+    void BeginBlocking();
+
+    void EndBlocking();
+
+    ECode StartWorkerLocked();
+
     static void* ThreadEntry(void* arg);
 
+public:
+    static constexpr Integer DEFAULT_THREAD_NUMBER = 4;
+
 private:
     static AutoPtr<ThreadPoolExecutor> sInstance;
     static Mutex sInstanceLock;
 
     Mutex mMainLock;
-    ArrayList<Worker*> mWorkers;
+    Condition mTaskCond;
+    Task* mTaskHead;
+    Task* mTaskTail;
+    Integer mTaskNumber;
+    Integer mMaxThreadNumber;
+    Integer mThreadNumber;
+    Integer mIdleThreadNumber;
+    Integer mBlockedThreadNumber;
 };
 
 }
@@ -23,6 +23,8 @@ extern void Init_EMPTY_STRING();
 extern void Uninit_EMPTY_STRING();
 extern void Init_Proxy_Entry();
 extern void Uninit_Proxy_Entry();
+extern void Uninit_DBus_Connections();
+extern void Uninit_Socket_Connections();
 
 static CONS_PROI_1
 void RTInitialize()
@@ -34,6 +36,8 @@ void RTInitialize()
 static DEST_PROI_10
 void RTUninitialize()
 {
+    Uninit_DBus_Connections();
+    Uninit_Socket_Connections();
     Uninit_EMPTY_STRING();
     Uninit_Proxy_Entry();
 }
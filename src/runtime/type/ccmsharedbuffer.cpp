@@ -53,7 +53,10 @@ SharedBuffer* SharedBuffer::Alloc(
         // But that generates a warning with some compilers.
         // The following is OK on Android-supported platforms.
         sb->mRefs.store(1, std::memory_order_relaxed);
+        sb->mInfo.store(0, std::memory_order_relaxed);
         sb->mSize = size;
+        sb->mIndex.store(nullptr, std::memory_order_relaxed);
+        sb->mHash.store(0, std::memory_order_relaxed);
     }
     return sb;
 }
@@ -61,12 +64,32 @@ SharedBuffer* SharedBuffer::Alloc(
 void SharedBuffer::Dealloc(
     /* [in] */ const SharedBuffer* released)
 {
+    released->DropCache();
     free(const_cast<SharedBuffer*>(released));
 }
 
+void SharedBuffer::DropCache() const
+{
+    mInfo.store(0, std::memory_order_relaxed);
+    mHash.store(0, std::memory_order_relaxed);
+    void* index = mIndex.exchange(nullptr, std::memory_order_acquire);
+    if (index != nullptr) {
+        free(index);
+    }
+}
+
+bool SharedBuffer::AttachIndex(
+    /* [in] */ void* index) const
+{
+    void* expected = nullptr;
+    return mIndex.compare_exchange_strong(expected, index,
+            std::memory_order_release, std::memory_order_relaxed);
+}
+
 SharedBuffer* SharedBuffer::Edit() const
 {
     if (OnlyOwner()) {
+        DropCache();
         return const_cast<SharedBuffer*>(this);
     }
     SharedBuffer* sb = Alloc(mSize);
@@ -81,6 +104,7 @@ SharedBuffer* SharedBuffer::EditResize(
     /* [in] */ size_t newSize) const
 {
     if (OnlyOwner()) {
+        DropCache();
         SharedBuffer* buf = const_cast<SharedBuffer*>(this);
         if (buf->mSize == newSize) return buf;
         // Don't overflow if the combined size of the new buffer / header is larger than
@@ -108,6 +132,7 @@ SharedBuffer* SharedBuffer::EditResize(
 SharedBuffer* SharedBuffer::AttemptEdit() const
 {
     if (OnlyOwner()) {
+        DropCache();
         return const_cast<SharedBuffer*>(this);
     }
     return 0;
@@ -84,16 +84,44 @@ public:
 
     inline bool OnlyOwner() const;
 
+    // Bits a reader may cache about the contents, e.g. that a string is
+    // all ASCII. They are dropped whenever the buffer is edited.
+    inline uint32_t GetInfo() const;
+
+    inline void AddInfo(
+        /* [in] */ uint32_t info) const;
+
+    // A malloc'ed side table derived from the contents, owned by the
+    // buffer and freed with it or as soon as it is edited.
+    inline void* GetIndex() const;
+
+    // Fails if another reader attached an index first, in which case
+    // the caller still owns |index|.
+    bool AttachIndex(
+        /* [in] */ void* index) const;
+
+    // A hash of the contents cached by a reader, 0 if there is none yet.
+    // It is dropped whenever the buffer is edited.
+    inline uint32_t GetHash() const;
+
+    inline void SetHash(
+        /* [in] */ uint32_t hash) const;
+
 private:
     inline SharedBuffer() {}
     inline ~SharedBuffer() {}
     SharedBuffer(const SharedBuffer&);
     SharedBuffer& operator = (const SharedBuffer&);
 
+    void DropCache() const;
+
 private:
     mutable std::atomic<int32_t> mRefs;
+    mutable std::atomic<uint32_t> mInfo;
     size_t mSize;
-    uint32_t mReserved[2];
+    mutable std::atomic<void*> mIndex;
+    mutable std::atomic<uint32_t> mHash;
+    uint32_t mReserved;
 };
 
 const void* SharedBuffer::GetData() const
@@ -134,6 +162,33 @@ bool SharedBuffer::OnlyOwner() const
     return (mRefs.load(std::memory_order_acquire) == 1);
 }
 
+uint32_t SharedBuffer::GetInfo() const
+{
+    return mInfo.load(std::memory_order_relaxed);
+}
+
+void SharedBuffer::AddInfo(
+    /* [in] */ uint32_t info) const
+{
+    mInfo.fetch_or(info, std::memory_order_relaxed);
+}
+
+void* SharedBuffer::GetIndex() const
+{
+    return mIndex.load(std::memory_order_acquire);
+}
+
+uint32_t SharedBuffer::GetHash() const
+{
+    return mHash.load(std::memory_order_relaxed);
+}
+
+void SharedBuffer::SetHash(
+    /* [in] */ uint32_t hash) const
+{
+    mHash.store(hash, std::memory_order_relaxed);
+}
+
 }
 
 #endif // __CCM_SHAREDBUFFER_H__
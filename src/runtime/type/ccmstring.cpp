@@ -32,12 +32,16 @@
 
 #include "ccmsharedbuffer.h"
 #include "ccmtypes.h"
+#include "ccmutf8.h"
 #include "ucase.h"
 #include "util/ccmlogger.h"
+#include "util/mutex.h"
 
 #include <ctype.h>
 #include <limits.h>
 #include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -45,15 +49,37 @@ namespace ccm {
 
 char* EMPTY_STRING = nullptr;
 
+// Every one-char ASCII string shares a buffer too, so that single-char
+// literals and ValueOf() don't allocate.
+static char* ASCII_STRINGS[128];
+
+static void ReleaseInternPool();
+
 extern void Init_EMPTY_STRING()
 {
     SharedBuffer* buf = SharedBuffer::Alloc(1);
     EMPTY_STRING = (char*)buf->GetData();
     EMPTY_STRING[0] = '\0';
+
+    for (Integer i = 1; i < 128; i++) {
+        buf = SharedBuffer::Alloc(2);
+        if (buf == nullptr) continue;
+        char* str = (char*)buf->GetData();
+        str[0] = (char)i;
+        str[1] = '\0';
+        ASCII_STRINGS[i] = str;
+    }
 }
 
 extern void Uninit_EMPTY_STRING()
 {
+    ReleaseInternPool();
+    for (Integer i = 1; i < 128; i++) {
+        if (ASCII_STRINGS[i] != nullptr) {
+            SharedBuffer::GetBufferFromData(ASCII_STRINGS[i])->Release();
+            ASCII_STRINGS[i] = nullptr;
+        }
+    }
     SharedBuffer::GetBufferFromData(EMPTY_STRING)->Release();
     EMPTY_STRING = nullptr;
 }
@@ -64,10 +90,133 @@ static char* GetEmptyString()
     return EMPTY_STRING;
 }
 
+// The facts cached in the SharedBuffer of a string.
+static constexpr uint32_t STRING_SCANNED = 0x1;
+static constexpr uint32_t STRING_ASCII = 0x2;
+// The buffer is held by the intern pool and never edited again.
+static constexpr uint32_t STRING_INTERNED = 0x4;
+
+// Strings which are not all ASCII get a CharIndex once they are this
+// long. It samples the byte offset of every CHAR_INDEX_STRIDE-th char,
+// so reaching any char walks less than a stride.
+static constexpr Integer CHAR_INDEX_MIN_BYTE_SIZE = 64;
+static constexpr Integer CHAR_INDEX_STRIDE = 32;
+
+struct CharIndex
+{
+    Integer mCharCount;
+    Integer mOffsets[0];
+};
+
+// wyhash (final4) by Wang Yi, released into the public domain. Keys up
+// to 16 bytes take a couple of multiplications, longer ones are mixed
+// 48 bytes at a time in three independent lanes.
+static const uint64_t HASH_SECRET[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+    0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+};
+
+static inline void HashMultiply(
+    /* [in, out] */ uint64_t* a,
+    /* [in, out] */ uint64_t* b)
+{
+    __uint128_t r = *a;
+    r *= *b;
+    *a = (uint64_t)r;
+    *b = (uint64_t)(r >> 64);
+}
+
+static inline uint64_t HashMix(
+    /* [in] */ uint64_t a,
+    /* [in] */ uint64_t b)
+{
+    HashMultiply(&a, &b);
+    return a ^ b;
+}
+
+static inline uint64_t HashRead8(
+    /* [in] */ const uint8_t* p)
+{
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static inline uint64_t HashRead4(
+    /* [in] */ const uint8_t* p)
+{
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static uint64_t HashBytes(
+    /* [in] */ const char* key,
+    /* [in] */ size_t length)
+{
+    const uint8_t* p = (const uint8_t*)key;
+    uint64_t seed = HashMix(HASH_SECRET[0], HASH_SECRET[1]);
+    uint64_t a, b;
+    if (length <= 16) {
+        if (length >= 4) {
+            a = (HashRead4(p) << 32) | HashRead4(p + ((length >> 3) << 2));
+            b = (HashRead4(p + length - 4) << 32) |
+                    HashRead4(p + length - 4 - ((length >> 3) << 2));
+        }
+        else if (length > 0) {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[length >> 1] << 8) | p[length - 1];
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        size_t i = length;
+        if (i >= 48) {
+            uint64_t seed1 = seed, seed2 = seed;
+            do {
+                seed = HashMix(HashRead8(p) ^ HASH_SECRET[1], HashRead8(p + 8) ^ seed);
+                seed1 = HashMix(HashRead8(p + 16) ^ HASH_SECRET[2], HashRead8(p + 24) ^ seed1);
+                seed2 = HashMix(HashRead8(p + 32) ^ HASH_SECRET[3], HashRead8(p + 40) ^ seed2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (i > 16) {
+            seed = HashMix(HashRead8(p) ^ HASH_SECRET[1], HashRead8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = HashRead8(p + i - 16);
+        b = HashRead8(p + i - 8);
+    }
+    a ^= HASH_SECRET[1];
+    b ^= seed;
+    HashMultiply(&a, &b);
+    return HashMix(a ^ HASH_SECRET[0] ^ length, b ^ HASH_SECRET[1]);
+}
+
+// Folds HashBytes() to a non-negative hash code.
+static uint32_t HashString(
+    /* [in] */ const char* string,
+    /* [in] */ size_t byteSize)
+{
+    uint64_t hash = HashBytes(string, byteSize);
+    return (uint32_t)(hash ^ (hash >> 32)) & 0x7FFFFFFF;
+}
+
 static char* AllocFromUTF8(
     /* [in] */ const char* string, size_t byteSize)
 {
     if (byteSize == 0) return GetEmptyString();
+    if (byteSize == 1 && String::IsASCII(string[0]) &&
+            ASCII_STRINGS[(int)string[0]] != nullptr) {
+        char* str = ASCII_STRINGS[(int)string[0]];
+        SharedBuffer::GetBufferFromData(str)->AddRef();
+        return str;
+    }
     if (byteSize > INT_MAX) {
         Logger::E("String", "Invalid buffer size %zu", byteSize);
         return nullptr;
@@ -85,6 +234,165 @@ static char* AllocFromUTF8(
     return str;
 }
 
+// The intern pool is split into shards by hash. A shard is an open
+// addressing table which only ever gains entries, so lookups take no
+// lock and only insertions take the shard's. A table which has been
+// outgrown is kept until the runtime unloads, as a reader may still be
+// probing it.
+static constexpr Integer INTERN_SHARD_NUMBER = 16;
+static constexpr Integer INTERN_MIN_CAPACITY = 64;
+
+struct InternTable
+{
+    InternTable* mRetired;
+    Integer mCapacity;
+    Integer mCount;
+    std::atomic<SharedBuffer*> mSlots[0];
+};
+
+struct InternShard
+{
+    Mutex mLock;
+    std::atomic<InternTable*> mTable;
+};
+
+static InternShard sInternShards[INTERN_SHARD_NUMBER];
+
+static SharedBuffer* LookUpInternTable(
+    /* [in] */ InternTable* table,
+    /* [in] */ uint32_t hashCode,
+    /* [in] */ const char* string,
+    /* [in] */ size_t byteSize)
+{
+    if (table == nullptr) return nullptr;
+
+    Integer mask = table->mCapacity - 1;
+    for (Integer i = (hashCode >> 4) & mask; ; i = (i + 1) & mask) {
+        SharedBuffer* sb = table->mSlots[i].load(std::memory_order_acquire);
+        if (sb == nullptr) return nullptr;
+        if ((sb->GetHash() & 0x7FFFFFFF) == hashCode &&
+                sb->GetSize() == byteSize + 1 &&
+                memcmp(sb->GetData(), string, byteSize) == 0) {
+            return sb;
+        }
+    }
+}
+
+static void PutInternTable(
+    /* [in] */ InternTable* table,
+    /* [in] */ SharedBuffer* sb)
+{
+    Integer mask = table->mCapacity - 1;
+    Integer i = ((sb->GetHash() & 0x7FFFFFFF) >> 4) & mask;
+    while (table->mSlots[i].load(std::memory_order_relaxed) != nullptr) {
+        i = (i + 1) & mask;
+    }
+    table->mSlots[i].store(sb, std::memory_order_release);
+    table->mCount++;
+}
+
+static InternTable* GrowInternTable(
+    /* [in] */ InternTable* table)
+{
+    Integer capacity = table != nullptr ?
+            table->mCapacity * 2 : INTERN_MIN_CAPACITY;
+    InternTable* grown = (InternTable*)calloc(1,
+            sizeof(InternTable) + sizeof(std::atomic<SharedBuffer*>) * capacity);
+    if (grown == nullptr) return nullptr;
+
+    grown->mRetired = table;
+    grown->mCapacity = capacity;
+    if (table != nullptr) {
+        for (Integer i = 0; i < table->mCapacity; i++) {
+            SharedBuffer* sb = table->mSlots[i].load(std::memory_order_relaxed);
+            if (sb != nullptr) {
+                PutInternTable(grown, sb);
+            }
+        }
+    }
+    return grown;
+}
+
+// Returns the pooled copy of |string| with a reference for the caller.
+// |candidate| holds the same bytes and is pooled itself if there is no
+// copy yet, otherwise a new buffer is.
+static char* InternBytes(
+    /* [in] */ const char* string,
+    /* [in] */ size_t byteSize,
+    /* [in] */ SharedBuffer* candidate)
+{
+    // These are shared already.
+    if (byteSize <= 1) return AllocFromUTF8(string, byteSize);
+    if (byteSize > INT_MAX) {
+        Logger::E("String", "Invalid buffer size %zu", byteSize);
+        return nullptr;
+    }
+
+    uint32_t hashCode = HashString(string, byteSize);
+    InternShard& shard = sInternShards[hashCode & (INTERN_SHARD_NUMBER - 1)];
+    SharedBuffer* sb = LookUpInternTable(
+            shard.mTable.load(std::memory_order_acquire), hashCode, string, byteSize);
+    if (sb == nullptr) {
+        Mutex::AutoLock lock(shard.mLock);
+
+        InternTable* table = shard.mTable.load(std::memory_order_relaxed);
+        sb = LookUpInternTable(table, hashCode, string, byteSize);
+        if (sb == nullptr) {
+            if (table == nullptr || (table->mCount + 1) * 4 > table->mCapacity * 3) {
+                table = GrowInternTable(table);
+                if (table == nullptr) {
+                    Logger::E("String", "Grow the intern pool failed.");
+                    return nullptr;
+                }
+                shard.mTable.store(table, std::memory_order_release);
+            }
+
+            if (candidate != nullptr) {
+                candidate->AddRef();
+                sb = candidate;
+            }
+            else {
+                sb = SharedBuffer::Alloc(byteSize + 1);
+                if (sb == nullptr) {
+                    Logger::E("String", "Malloc string which size is %zu failed.", byteSize);
+                    return nullptr;
+                }
+                char* str = (char*)sb->GetData();
+                memcpy(str, string, byteSize);
+                str[byteSize] = '\0';
+            }
+            sb->SetHash(hashCode | 0x80000000);
+            sb->AddInfo(STRING_INTERNED);
+            PutInternTable(table, sb);
+        }
+    }
+    sb->AddRef();
+    return (char*)sb->GetData();
+}
+
+static void ReleaseInternPool()
+{
+    for (Integer i = 0; i < INTERN_SHARD_NUMBER; i++) {
+        InternShard& shard = sInternShards[i];
+        Mutex::AutoLock lock(shard.mLock);
+
+        InternTable* table = shard.mTable.exchange(nullptr, std::memory_order_acquire);
+        if (table != nullptr) {
+            for (Integer j = 0; j < table->mCapacity; j++) {
+                SharedBuffer* sb = table->mSlots[j].load(std::memory_order_relaxed);
+                if (sb != nullptr) {
+                    sb->Release();
+                }
+            }
+        }
+        while (table != nullptr) {
+            InternTable* retired = table->mRetired;
+            free(table);
+            table = retired;
+        }
+    }
+}
+
 String::String(
     /* [in] */ const char* string)
     : mString(nullptr)
@@ -170,19 +478,7 @@ Integer String::GetLength() const
     if (IsNullOrEmpty()) return 0;
     if (IsCounted()) return GetCharCount();
 
-    Integer charCount = 0;
-    Integer byteSize;
-    const char* p = mString;
-    const char* end = mString + GetByteLength() + 1;
-    while (*p != '\0' && p < end) {
-        byteSize = UTF8SequenceLength(*p);
-        if (byteSize == 0 || p + byteSize >= end) break;
-        p += byteSize;
-        charCount++;
-    }
-
-    SetCharCount(charCount);
-    return charCount;
+    return CountChars();
 }
 
 Integer String::GetUTF16Length(
@@ -190,21 +486,10 @@ Integer String::GetUTF16Length(
 {
     if (IsNullOrEmpty()) return 0;
 
-    Integer utf16Count = 0, charCount = 0;
-    Integer byteSize;
-    const char* p = mString;
-    const char* end = mString + GetByteLength() + 1;
-    while (*p != '\0' && p < end) {
-        Char unicode = GetCharInternal(p, &byteSize);
-        if (byteSize == 0 || p + byteSize >= end) break;
-        p += byteSize;
-        if (charCount >= start) {
-            utf16Count++;
-            if (unicode > 0xFFFF) utf16Count++; // this will be a surrogate pair in utf16
-        }
-        charCount++;
-    }
-    return utf16Count;
+    Integer byteIndex = start <= 0 ? 0 : LocateChar(start);
+    if (byteIndex == -1) return 0;
+    return UTF8::CountUTF16Units(mString + byteIndex,
+            GetByteLength() - byteIndex);
 }
 
 Integer String::GetByteLength() const
@@ -216,63 +501,68 @@ Integer String::GetByteLength() const
 
 Integer String::GetHashCode() const
 {
-    // BKDR Hash Function
-    unsigned int seed = 31; // 31 131 1313 13131 131313 etc..
-    unsigned int hash = 0;
+    if (mString == nullptr) return 0;
 
-    const char* string = mString;
-    if (string) {
-        for ( ; *string; ++string) {
-            hash = hash * seed + (*string);
-        }
+    // The hash is cached with its top bit set, so that 0 means none.
+    SharedBuffer* sb = SharedBuffer::GetBufferFromData(mString);
+    uint32_t cached = sb->GetHash();
+    if (cached != 0) {
+        return (Integer)(cached & 0x7FFFFFFF);
     }
-    return (hash & 0x7FFFFFFF);
+
+    // Equals() compares up to the first '\0', and so does the hash.
+    uint32_t hashCode = HashString(mString, strlen(mString));
+    sb->SetHash(hashCode | 0x80000000);
+    return (Integer)hashCode;
+}
+
+String String::Intern() const
+{
+    if (mString == nullptr) return String();
+
+    SharedBuffer* sb = SharedBuffer::GetBufferFromData(mString);
+    if (sb->GetInfo() & STRING_INTERNED) return *this;
+
+    // A buffer holding bytes after a '\0' is not pooled itself.
+    size_t byteSize = strlen(mString);
+    String string;
+    string.mString = InternBytes(mString, byteSize,
+            byteSize + 1 == sb->GetSize() ? sb : nullptr);
+    return string;
+}
+
+String String::Intern(
+    /* [in] */ const char* string)
+{
+    String interned;
+    if (string != nullptr) {
+        interned.mString = InternBytes(string, strlen(string), nullptr);
+    }
+    return interned;
 }
 
 Char String::GetChar(
     /* [in] */ Integer index) const
 {
-    if (IsNullOrEmpty() || index < 0) return INVALID_CHAR;
+    Integer byteIndex = LocateChar(index);
+    if (byteIndex == -1) return INVALID_CHAR;
 
     Integer byteSize;
-    const char* p = mString;
-    const char* end = mString + GetByteLength() + 1;
-    while (*p && p < end) {
-        Char unicode = GetCharInternal(p, &byteSize);
-        if (byteSize == 0 || p + byteSize >= end) break;
-        if (index == 0) {
-            return unicode;
-        }
-        p += byteSize;
-        index -= 1;
-    }
-
-    return INVALID_CHAR;
+    return GetCharInternal(mString + byteIndex, &byteSize);
 }
 
 Array<Char> String::GetChars(
     /* [in] */ Integer start) const
 {
     Integer charCount = GetLength();
-    if (start >= charCount) {
+    if (start < 0 || start >= charCount) {
         return Array<Char>();
     }
 
     Array<Char> charArray(charCount - start);
-
-    Integer byteSize, i = 0;
-    const char* p = mString;
-    const char* end = mString + GetByteLength() + 1;
-    while (*p && p < end) {
-        Char unicode = GetCharInternal(p, &byteSize);
-        if (byteSize == 0 || p + byteSize >= end) break;
-        if (i >= start) {
-            charArray[i - start] = unicode;
-        }
-        p += byteSize;
-        i++;
-    }
-
+    Integer byteIndex = LocateChar(start);
+    UTF8::ToUTF32(mString + byteIndex, GetByteLength() - byteIndex,
+            charArray.GetPayload());
     return charArray;
 }
 
@@ -289,8 +579,10 @@ ECode String::GetChars(
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    Integer byteSize, i = 0;
-    const char* p = mString;
+    if (srcBegin == srcEnd) return NOERROR;
+
+    Integer byteSize, i = srcBegin;
+    const char* p = mString + LocateChar(srcBegin);
     const char* end = mString + GetByteLength() + 1;
     while (*p && p < end) {
         Char unicode = GetCharInternal(p, &byteSize);
@@ -314,28 +606,11 @@ Array<Short> String::GetUTF16Chars(
     }
 
     Array<Short> utf16Array(utf16Count);
-
-    Integer byteSize, count = 0, i = 0;
-    const char* p = mString;
-    const char* end = mString + GetByteLength() + 1;
-    while (*p && p < end) {
-        Char unicode = GetCharInternal(p, &byteSize);
-        if (byteSize == 0 || p + byteSize >= end) break;
-        if (count >= start) {
-            if (unicode <= 0xFFFF) {
-                utf16Array[i++] = unicode;
-            }
-            else {
-                // Multiple UTF16 characters with surrogates
-                unicode =  unicode - 0x10000;
-                utf16Array[i++] = (Short)((unicode >> 10) + 0xD800);
-                utf16Array[i++] = (Short)((unicode & 0x3FF) + 0xDC00);
-            }
-        }
-        p += byteSize;
-        count++;
+    if (utf16Count > 0) {
+        Integer byteIndex = start <= 0 ? 0 : LocateChar(start);
+        UTF8::ToUTF16(mString + byteIndex, GetByteLength() - byteIndex,
+                utf16Array.GetPayload());
     }
-
     return utf16Array;
 }
 
@@ -352,8 +627,10 @@ ECode String::GetUTF16Chars(
         return E_ILLEGAL_ARGUMENT_EXCEPTION;
     }
 
-    Integer byteSize, count = 0, i = 0;
-    const char* p = mString;
+    if (srcBegin == srcEnd) return NOERROR;
+
+    Integer byteSize, count = srcBegin, i = 0;
+    const char* p = mString + LocateChar(srcBegin);
     const char* end = mString + GetByteLength() + 1;
     while (*p && p < end) {
         Char unicode = GetCharInternal(p, &byteSize);
@@ -471,44 +748,26 @@ String String::Substring(
         return String("");
     }
 
-    Integer charCount = 0;
-    Integer byteSize;
-    const char* p = mString;
-    const char* end = mString + GetByteLength() + 1;
-    const char* p1 = p;
-    const char* p2 = end;
-    while (*p != '\0' && p < end) {
-        byteSize = UTF8SequenceLength(*p);
-        if (byteSize == 0 || p + byteSize >= end) break;
-        if (charCount == charStart) {
-            p1 = p;
-        }
-        p += byteSize;
-        if (charCount == charEnd) {
-            p2 = p;
-            break;
-        }
-        charCount++;
-    }
-
-    return String(p1, (p2 - 1) - p1);
+    Integer byteStart = LocateChar(charStart);
+    Integer byteEnd = charEnd < GetLength() ?
+            LocateChar(charEnd) : GetByteLength();
+    return String(mString + byteStart, byteEnd - byteStart);
 }
 
 Integer String::IndexOf(
     /* [in] */ Char c,
     /* [in] */ Integer fromCharIndex) const
 {
-    if (fromCharIndex < 0) return -1;
+    Integer byteIndex = LocateChar(fromCharIndex);
+    if (byteIndex == -1) return -1;
 
-    Integer byteSize, i = 0;
-    const char* p = mString;
+    Integer byteSize, i = fromCharIndex;
+    const char* p = mString + byteIndex;
     const char* end = mString + GetByteLength() + 1;
     while (*p && p < end) {
         Char unicode = GetCharInternal(p, &byteSize);
         if (byteSize == 0 || p + byteSize >= end) break;
-        if (i >= fromCharIndex) {
-            if (c == unicode) return i;
-        }
+        if (c == unicode) return i;
         p += byteSize;
         i++;
     }
@@ -523,27 +782,15 @@ Integer String::IndexOf(
         return -1;
     }
 
-    Integer i = 0;
-    Integer byteSize;
-    const char* p = mString;
-    const char* end = mString + GetByteLength() + 1;
-    const char* psub = nullptr;
-    while (*p && p < end) {
-        byteSize = UTF8SequenceLength(*p);
-        if (byteSize == 0 || p + byteSize >= end) break;
-        if (i >= fromCharIndex && psub == nullptr) {
-            psub = strstr(p, string);
-            if (psub == nullptr) {
-                return -1;
-            }
-        }
-        if (p == psub) {
-            return i;
-        }
-        p += byteSize;
-        i++;
-    }
-    return -1;
+    Integer byteIndex = LocateChar(fromCharIndex < 0 ? 0 : fromCharIndex);
+    if (byteIndex == -1) return -1;
+
+    const char* psub = strstr(mString + byteIndex, string);
+    if (psub == nullptr) return -1;
+
+    // A match which does not start on a char boundary is not one.
+    Integer charIndex = ToCharIndex(psub - mString);
+    return LocateChar(charIndex) == psub - mString ? charIndex : -1;
 }
 
 Integer String::LastIndexOf(
@@ -839,41 +1086,49 @@ Integer String::ToByteIndex(
     /* [in] */ Integer charIndex,
     /* [in] */ Integer* charByteSize) const
 {
-    if (charIndex < 0 || charIndex >= GetLength()) {
-        return -1;
+    Integer byteIndex = LocateChar(charIndex);
+    if (byteIndex != -1 && charByteSize != nullptr) {
+        *charByteSize = UTF8SequenceLength(mString[byteIndex]);
     }
-
-    Integer charCount = 0;
-    Integer byteSize;
-    const char* p = mString;
-    const char* end = mString + GetByteLength() + 1;
-    while (*p != '\0' && p < end) {
-        byteSize = UTF8SequenceLength(*p);
-        if (byteSize == 0 || p + byteSize >= end) break;
-        if (charCount == charIndex) {
-            if (charByteSize != nullptr) {
-                *charByteSize = byteSize;
-            }
-            return p - mString;
-        }
-        p += byteSize;
-        charCount++;
-    }
-
-    return -1;
+    return byteIndex;
 }
 
 Integer String::ToCharIndex(
     /* [in] */ Integer byteIndex,
     /* [in] */ Integer* charByteSize) const
 {
-    if (byteIndex < 0 || byteIndex > GetByteLength()) {
+    if (IsNullOrEmpty() || byteIndex < 0 || byteIndex > GetByteLength()) {
         return -1;
     }
 
+    SharedBuffer* sb = SharedBuffer::GetBufferFromData(mString);
+    if ((sb->GetInfo() & STRING_SCANNED) == 0) {
+        CountChars();
+    }
+    if (sb->GetInfo() & STRING_ASCII) {
+        if (byteIndex >= GetByteLength()) return -1;
+        if (charByteSize != nullptr) {
+            *charByteSize = 1;
+        }
+        return byteIndex;
+    }
+
+    // Start from the last sample at or before |byteIndex|.
     Integer charIndex = 0;
-    Integer byteSize;
     const char* p = mString;
+    const CharIndex* index = (const CharIndex*)sb->GetIndex();
+    if (index != nullptr) {
+        Integer lo = 0, hi = (index->mCharCount - 1) / CHAR_INDEX_STRIDE;
+        while (lo < hi) {
+            Integer mid = (lo + hi + 1) / 2;
+            if (index->mOffsets[mid] <= byteIndex) lo = mid;
+            else hi = mid - 1;
+        }
+        charIndex = lo * CHAR_INDEX_STRIDE;
+        p = mString + index->mOffsets[lo];
+    }
+
+    Integer byteSize;
     const char* end = mString + GetByteLength() + 1;
     while (*p != '\0' && p < end) {
         byteSize = UTF8SequenceLength(*p);
@@ -894,25 +1149,14 @@ Integer String::ToCharIndex(
 String String::Format(
     /* [in] */ const char* format ...)
 {
-    va_list args, args1;
+    va_list args;
 
     va_start(args, format);
-    va_copy(args1, args);
-
-    int len = vsnprintf(nullptr, 0, format, args);
+    StringBuilder builder;
+    builder.AppendVFormat(format, args);
     va_end(args);
 
-    String str("");
-    char* buf = str.LockBuffer(len);
-    if (buf == nullptr) {
-        Logger::E("String", "Lock %d bytes buffer failed", len);
-        return str;
-    }
-    vsnprintf(buf, len + 1, format, args1);
-    str.UnlockBuffer(len);
-    va_end(args1);
-
-    return str;
+    return builder.ToString();
 }
 
 String String::ValueOf(
@@ -1131,6 +1375,87 @@ void String::ClearCounted()
     mCharCount = 0;
 }
 
+Integer String::CountChars() const
+{
+    SharedBuffer* sb = SharedBuffer::GetBufferFromData(mString);
+    uint32_t info = sb->GetInfo();
+    if (info & STRING_ASCII) {
+        SetCharCount(GetByteLength());
+        return GetByteLength();
+    }
+    const CharIndex* index = (const CharIndex*)sb->GetIndex();
+    if (index != nullptr) {
+        SetCharCount(index->mCharCount);
+        return index->mCharCount;
+    }
+
+    Boolean ascii;
+    Integer charCount = UTF8::CountChars(mString, GetByteLength(), &ascii);
+    SetCharCount(charCount);
+
+    if (info & STRING_SCANNED) {
+        return charCount;
+    }
+    if (ascii && charCount == GetByteLength()) {
+        sb->AddInfo(STRING_SCANNED | STRING_ASCII);
+        return charCount;
+    }
+    if (GetByteLength() >= CHAR_INDEX_MIN_BYTE_SIZE) {
+        Integer sampleNum = (charCount + CHAR_INDEX_STRIDE - 1) / CHAR_INDEX_STRIDE;
+        CharIndex* newIndex = (CharIndex*)malloc(
+                sizeof(CharIndex) + sizeof(Integer) * sampleNum);
+        if (newIndex != nullptr) {
+            newIndex->mCharCount = charCount;
+            const char* p = mString;
+            for (Integer i = 0; i < charCount; i++) {
+                if (i % CHAR_INDEX_STRIDE == 0) {
+                    newIndex->mOffsets[i / CHAR_INDEX_STRIDE] = p - mString;
+                }
+                p += UTF8SequenceLength(*p);
+            }
+            if (!sb->AttachIndex(newIndex)) {
+                free(newIndex);
+            }
+        }
+    }
+    sb->AddInfo(STRING_SCANNED);
+    return charCount;
+}
+
+Integer String::LocateChar(
+    /* [in] */ Integer charIndex) const
+{
+    if (IsNullOrEmpty() || charIndex < 0) {
+        return -1;
+    }
+
+    // A copy of a counted string skips CountChars() in GetLength(), so
+    // scan here in case the buffer has never been looked at.
+    SharedBuffer* sb = SharedBuffer::GetBufferFromData(mString);
+    if ((sb->GetInfo() & STRING_SCANNED) == 0) {
+        CountChars();
+    }
+    if (charIndex >= GetLength()) {
+        return -1;
+    }
+    if (sb->GetInfo() & STRING_ASCII) {
+        return charIndex;
+    }
+
+    const char* p = mString;
+    const CharIndex* index = (const CharIndex*)sb->GetIndex();
+    if (index != nullptr) {
+        p += index->mOffsets[charIndex / CHAR_INDEX_STRIDE];
+        charIndex %= CHAR_INDEX_STRIDE;
+    }
+    // |charIndex| is below the char count, so every char walked over is
+    // a whole UTF-8 sequence.
+    while (charIndex-- > 0) {
+        p += UTF8SequenceLength(*p);
+    }
+    return p - mString;
+}
+
 Char String::GetCharInternal(
     /* [in] */ const char* cur,
     /* [in] */ Integer* byteSize)
@@ -88,6 +88,16 @@ public:
 
     Integer GetHashCode() const;
 
+    // Returns the string from the intern pool which is equal to this one,
+    // pooling this one if there is none yet. Interned strings which are
+    // equal share a buffer, so they compare by pointer. The pool keeps
+    // its strings until the runtime unloads, so only strings from a
+    // bounded set, like the names in metadata, should be interned.
+    String Intern() const;
+
+    static String Intern(
+        /* [in] */ const char* string);
+
     inline const char* string() const;
 
     inline operator const char*() const;
@@ -296,6 +306,8 @@ public:
         /* [in] */ Integer bytes);
 
 private:
+    friend class StringBuilder;
+
     void WriteCharArray(
         /* [in] */ const Array<Char>& charArray,
         /* [in] */ Integer start,
@@ -324,6 +336,11 @@ private:
 
     void ClearCounted();
 
+    Integer CountChars() const;
+
+    Integer LocateChar(
+        /* [in] */ Integer charIndex) const;
+
     static Char GetCharInternal(
         /* [in] */ const char* cur,
         /* [in] */ Integer* byteSize);
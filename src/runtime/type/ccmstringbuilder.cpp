@@ -0,0 +1,229 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "ccmsharedbuffer.h"
+#include "ccmtypes.h"
+#include "util/ccmlogger.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace ccm {
+
+StringBuilder::StringBuilder(
+    /* [in] */ Integer byteCapacity)
+    : mBuffer(nullptr)
+    , mByteLength(0)
+    , mCapacity(0)
+{
+    EnsureCapacity(byteCapacity);
+}
+
+StringBuilder::~StringBuilder()
+{
+    if (mBuffer != nullptr) {
+        SharedBuffer::GetBufferFromData(mBuffer)->Release();
+        mBuffer = nullptr;
+    }
+}
+
+StringBuilder& StringBuilder::Append(
+    /* [in] */ Char c)
+{
+    Integer byteSize = String::GetByteSize(c);
+    if (byteSize == 0 || !Grow(byteSize)) return *this;
+
+    String::WriteUTF8Bytes(mBuffer + mByteLength, c, byteSize);
+    mByteLength += byteSize;
+    return *this;
+}
+
+StringBuilder& StringBuilder::Append(
+    /* [in] */ const char* string)
+{
+    if (string == nullptr) return *this;
+
+    size_t byteSize = strlen(string);
+    if (byteSize > INT_MAX) {
+        Logger::E("StringBuilder", "Invalid string size %zu", byteSize);
+        return *this;
+    }
+    return Append(string, (Integer)byteSize);
+}
+
+StringBuilder& StringBuilder::Append(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize)
+{
+    if (string == nullptr || byteSize <= 0 || !Grow(byteSize)) {
+        return *this;
+    }
+
+    memcpy(mBuffer + mByteLength, string, byteSize);
+    mByteLength += byteSize;
+    return *this;
+}
+
+StringBuilder& StringBuilder::Append(
+    /* [in] */ const String& string)
+{
+    return Append(string.string(), string.GetByteLength());
+}
+
+StringBuilder& StringBuilder::AppendFormat(
+    /* [in] */ const char* format ...)
+{
+    va_list args;
+    va_start(args, format);
+    AppendVFormat(format, args);
+    va_end(args);
+    return *this;
+}
+
+StringBuilder& StringBuilder::AppendVFormat(
+    /* [in] */ const char* format,
+    /* [in] */ va_list args)
+{
+    if (format == nullptr) return *this;
+    if (mBuffer == nullptr && !Grow(MIN_CAPACITY)) return *this;
+
+    // Most formats fit the spare capacity, and are printed only once.
+    va_list retry;
+    va_copy(retry, args);
+    Integer spare = mCapacity - mByteLength;
+    int len = vsnprintf(mBuffer + mByteLength, spare + 1, format, args);
+    if (len > spare) {
+        if (Grow(len)) {
+            vsnprintf(mBuffer + mByteLength, len + 1, format, retry);
+        }
+        else {
+            len = -1;
+        }
+    }
+    va_end(retry);
+
+    if (len > 0) {
+        mByteLength += len;
+    }
+    return *this;
+}
+
+StringBuilder& StringBuilder::AppendUTF16(
+    /* [in] */ const Short* chars,
+    /* [in] */ Integer length)
+{
+    if (chars == nullptr || length <= 0) return *this;
+    // A unit takes 3 bytes at most, a surrogate pair takes 4.
+    if (length > INT_MAX / 3) {
+        Logger::E("StringBuilder", "Invalid UTF-16 length %d", length);
+        return *this;
+    }
+    if (!Grow(length * 3)) return *this;
+
+    char* dst = mBuffer + mByteLength;
+    for (Integer i = 0; i < length; i++) {
+        Char c = (unsigned short)chars[i];
+        if (c < 0x80) {
+            *dst++ = (char)c;
+            continue;
+        }
+        if (0xD800 <= c && c <= 0xDFFF) {
+            Char low = i + 1 < length ? (unsigned short)chars[i + 1] : 0;
+            if (c <= 0xDBFF && 0xDC00 <= low && low <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                i++;
+            }
+            else {
+                c = 0xFFFD;
+            }
+        }
+        Integer byteSize = String::GetByteSize(c);
+        String::WriteUTF8Bytes(dst, c, byteSize);
+        dst += byteSize;
+    }
+    mByteLength = dst - mBuffer;
+    return *this;
+}
+
+StringBuilder& StringBuilder::AppendUTF16(
+    /* [in] */ const Array<Short>& chars)
+{
+    return AppendUTF16(chars.GetPayload(), chars.GetLength());
+}
+
+Boolean StringBuilder::EnsureCapacity(
+    /* [in] */ Integer byteCapacity)
+{
+    if (byteCapacity <= mCapacity) return true;
+    return Grow(byteCapacity - mByteLength);
+}
+
+void StringBuilder::Reset()
+{
+    mByteLength = 0;
+}
+
+String StringBuilder::ToString()
+{
+    if (mByteLength == 0) return String("");
+
+    // The buffer holds one more byte than the capacity for the '\0', and
+    // shrinking it leaves it in place.
+    SharedBuffer* buf = SharedBuffer::GetBufferFromData(mBuffer)->EditResize(
+            mByteLength + 1);
+    if (buf == nullptr) {
+        Logger::E("StringBuilder", "Shrink %d bytes buffer failed", mByteLength);
+        return String();
+    }
+
+    String string;
+    string.mString = (char*)buf->GetData();
+    string.mString[mByteLength] = '\0';
+    mBuffer = nullptr;
+    mByteLength = 0;
+    mCapacity = 0;
+    return string;
+}
+
+Boolean StringBuilder::Grow(
+    /* [in] */ Integer byteSize)
+{
+    if (byteSize > INT_MAX - 1 - mByteLength) {
+        Logger::E("StringBuilder", "The builder can't hold %d more bytes", byteSize);
+        return false;
+    }
+    Integer needed = mByteLength + byteSize;
+    if (needed <= mCapacity) return true;
+
+    Integer capacity = mCapacity < MIN_CAPACITY ? MIN_CAPACITY : mCapacity;
+    while (capacity < needed) {
+        capacity = capacity <= (INT_MAX - 1) / 2 ? capacity * 2 : INT_MAX - 1;
+    }
+
+    SharedBuffer* buf = mBuffer != nullptr ?
+            SharedBuffer::GetBufferFromData(mBuffer)->EditResize(capacity + 1) :
+            SharedBuffer::Alloc(capacity + 1);
+    if (buf == nullptr) {
+        Logger::E("StringBuilder", "Grow to %d bytes failed", capacity);
+        return false;
+    }
+    mBuffer = (char*)buf->GetData();
+    mCapacity = capacity;
+    return true;
+}
+
+}
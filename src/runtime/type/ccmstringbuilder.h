@@ -0,0 +1,116 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_STRINGBUILDER_H__
+#define __CCM_STRINGBUILDER_H__
+
+#include "ccmdef.h"
+#include <stdarg.h>
+
+namespace ccm {
+
+class String;
+template<class T> class Array;
+
+// Builds a String in a SharedBuffer with spare capacity, which grows
+// geometrically, so a run of appends costs linear time. ToString() hands
+// the buffer over to the String without copying it.
+class COM_PUBLIC StringBuilder
+{
+public:
+    inline StringBuilder();
+
+    explicit StringBuilder(
+        /* [in] */ Integer byteCapacity);
+
+    ~StringBuilder();
+
+    StringBuilder& Append(
+        /* [in] */ Char c);
+
+    StringBuilder& Append(
+        /* [in] */ const char* string);
+
+    StringBuilder& Append(
+        /* [in] */ const char* string,
+        /* [in] */ Integer byteSize);
+
+    StringBuilder& Append(
+        /* [in] */ const String& string);
+
+    StringBuilder& AppendFormat(
+        /* [in] */ const char* format ...);
+
+    StringBuilder& AppendVFormat(
+        /* [in] */ const char* format,
+        /* [in] */ va_list args);
+
+    // Appends UTF-16 code units, transcoded to UTF-8 in place. An unpaired
+    // surrogate becomes U+FFFD.
+    StringBuilder& AppendUTF16(
+        /* [in] */ const Short* chars,
+        /* [in] */ Integer length);
+
+    StringBuilder& AppendUTF16(
+        /* [in] */ const Array<Short>& chars);
+
+    inline Integer GetByteLength() const;
+
+    inline Integer GetCapacity() const;
+
+    Boolean EnsureCapacity(
+        /* [in] */ Integer byteCapacity);
+
+    void Reset();
+
+    // Leaves the builder empty.
+    String ToString();
+
+private:
+    StringBuilder(const StringBuilder&);
+    StringBuilder& operator=(const StringBuilder&);
+
+    // Makes room for |byteSize| more bytes, at least doubling the capacity.
+    Boolean Grow(
+        /* [in] */ Integer byteSize);
+
+private:
+    static constexpr Integer MIN_CAPACITY = 32;
+
+    char* mBuffer;
+    Integer mByteLength;
+    Integer mCapacity;
+};
+
+StringBuilder::StringBuilder()
+    : mBuffer(nullptr)
+    , mByteLength(0)
+    , mCapacity(0)
+{}
+
+Integer StringBuilder::GetByteLength() const
+{
+    return mByteLength;
+}
+
+Integer StringBuilder::GetCapacity() const
+{
+    return mCapacity;
+}
+
+}
+
+#endif // __CCM_STRINGBUILDER_H__
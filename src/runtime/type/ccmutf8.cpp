@@ -0,0 +1,514 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "ccmutf8.h"
+#include <stdint.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define CCM_UTF8_X86
+#endif
+
+namespace ccm {
+
+// The length of a sequence by the high nibble of its leading byte, 0 for
+// a continuation byte. 0xF8 to 0xFF are turned down by SequenceLength().
+static const Byte sSequenceLength[16] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 2, 2, 3, 4
+};
+
+static inline Integer SequenceLength(
+    /* [in] */ char b0)
+{
+    uint8_t b = (uint8_t)b0;
+    return b >= 0xF8 ? 0 : sSequenceLength[b >> 4];
+}
+
+static inline Char Decode(
+    /* [in] */ const char* p,
+    /* [in] */ Integer length)
+{
+    const uint8_t* b = (const uint8_t*)p;
+    switch (length) {
+        case 1:
+            return b[0];
+        case 2:
+            return ((b[0] & 0x1F) << 6) | (b[1] & 0x3F);
+        case 3:
+            return ((b[0] & 0x0F) << 12) | ((b[1] & 0x3F) << 6) | (b[2] & 0x3F);
+        default:
+            return ((b[0] & 0x07) << 18) | ((b[1] & 0x3F) << 12) |
+                    ((b[2] & 0x3F) << 6) | (b[3] & 0x3F);
+    }
+}
+
+static inline Short* Put(
+    /* [in] */ Char c,
+    /* [out] */ Short* dst)
+{
+    if (c <= 0xFFFF) {
+        *dst++ = (Short)c;
+    }
+    else {
+        // a surrogate pair in UTF-16
+        c -= 0x10000;
+        *dst++ = (Short)((c >> 10) + 0xD800);
+        *dst++ = (Short)((c & 0x3FF) + 0xDC00);
+    }
+    return dst;
+}
+
+static inline Char* Put(
+    /* [in] */ Char c,
+    /* [out] */ Char* dst)
+{
+    *dst++ = c;
+    return dst;
+}
+
+struct Counts
+{
+    Integer mChars;
+    Integer mUTF16Units;
+    Boolean mASCII;
+};
+
+// Walks whole chars from |p| until one ends at or after |until|, and
+// returns where it got. That is before |until| only if the walk hit the
+// end of the string.
+static const char* Walk(
+    /* [in] */ const char* p,
+    /* [in] */ const char* end,
+    /* [in] */ const char* until,
+    /* [in] */ Boolean countUnits,
+    /* [out] */ Counts* counts)
+{
+    while (p < until && p < end && *p != '\0') {
+        Integer length = SequenceLength(*p);
+        if (length == 0 || length > end - p) {
+            break;
+        }
+        counts->mChars++;
+        counts->mASCII = counts->mASCII && length == 1;
+        if (countUnits) {
+            counts->mUTF16Units += Decode(p, length) > 0xFFFF ? 2 : 1;
+        }
+        p += length;
+    }
+    return p;
+}
+
+struct BlockCounts
+{
+    Integer mChars;
+    Integer mLead4s;
+    // 4-byte sequences led by 0xF0 decode below 0x10000 unless the next
+    // byte is at least 0x90, and so take a single UTF-16 unit.
+    Integer mOverlongs;
+    Boolean mASCII;
+};
+
+typedef Boolean (*ScanBlockFunc)(const char*, BlockCounts*);
+
+// Counts a block at a time while the blocks are well formed. The block
+// checks look 3 bytes back, so they only start once that much has been
+// walked, and a block they turn down is walked before they go on.
+template<Integer BLOCK, ScanBlockFunc SCAN>
+static void CountBlocks(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize,
+    /* [in] */ Boolean countUnits,
+    /* [out] */ Counts* counts)
+{
+    const char* end = string + byteSize;
+    const char* p = string;
+    const char* until = string + 3;
+    while (true) {
+        p = Walk(p, end, until, countUnits, counts);
+        if (p < until) {
+            return;
+        }
+
+        // The walk does not look at continuation bytes, so what it took
+        // for a char may hold a leading byte which the block checks
+        // would see reaching past |p|. Walk on in that case.
+        const char* start = p;
+        Boolean spills = (uint8_t)p[-1] >= 0xC0 || (uint8_t)p[-2] >= 0xE0 ||
+                (uint8_t)p[-3] >= 0xF0;
+        BlockCounts block;
+        while (!spills && end - p >= BLOCK && SCAN(p, &block)) {
+            counts->mChars += block.mChars;
+            counts->mUTF16Units += block.mChars + block.mLead4s - block.mOverlongs;
+            counts->mASCII = counts->mASCII && block.mASCII;
+            p += BLOCK;
+        }
+        if (p > start) {
+            // The last char counted may run on past |p|, back up to its
+            // leading byte so that it is walked again.
+            Integer k = 0;
+            while (k < 3 && ((uint8_t)p[-1 - k] & 0xC0) == 0x80) {
+                k++;
+            }
+            const char* lead = p - 1 - k;
+            Integer length = SequenceLength(*lead);
+            if (length > k + 1) {
+                counts->mChars--;
+                counts->mUTF16Units--;
+                if (length == 4) {
+                    Boolean overlongCounted = k >= 1 && (uint8_t)lead[0] == 0xF0 &&
+                            (uint8_t)lead[1] < 0x90;
+                    counts->mUTF16Units -= overlongCounted ? 0 : 1;
+                }
+                p = lead;
+            }
+        }
+        if (end - p < BLOCK) {
+            Walk(p, end, end, countUnits, counts);
+            return;
+        }
+        until = p + BLOCK;
+    }
+}
+
+template<typename T>
+static Boolean CopyNoBlock(
+    /* [in] */ const char* p,
+    /* [out] */ T* dst)
+{
+    return false;
+}
+
+// Copies blocks which are all ASCII, and decodes one block a char at a
+// time whenever that fails.
+template<typename T, Integer BLOCK, Boolean (*COPY)(const char*, T*)>
+static Integer Transcode(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize,
+    /* [out] */ T* dst)
+{
+    const char* p = string;
+    const char* end = string + byteSize;
+    T* d = dst;
+    while (true) {
+        while (end - p >= BLOCK && COPY(p, d)) {
+            p += BLOCK;
+            d += BLOCK;
+        }
+        const char* until = p + BLOCK;
+        while (p < until && p < end && *p != '\0') {
+            Integer length = SequenceLength(*p);
+            if (length == 0 || length > end - p) {
+                return d - dst;
+            }
+            d = Put(Decode(p, length), d);
+            p += length;
+        }
+        if (p < until) {
+            return d - dst;
+        }
+    }
+}
+
+//----------------------------------------------------------------------
+
+static Integer CountCharsScalar(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize,
+    /* [out] */ Boolean* isASCII)
+{
+    Counts counts = { 0, 0, true };
+    Walk(string, string + byteSize, string + byteSize, false, &counts);
+    *isASCII = counts.mASCII;
+    return counts.mChars;
+}
+
+static Integer CountUTF16UnitsScalar(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize)
+{
+    Counts counts = { 0, 0, true };
+    Walk(string, string + byteSize, string + byteSize, true, &counts);
+    return counts.mUTF16Units;
+}
+
+const UTF8::Kernels UTF8::sScalarKernels = {
+    ISA::Scalar,
+    CountCharsScalar,
+    CountUTF16UnitsScalar,
+    Transcode<Short, 64, CopyNoBlock<Short> >,
+    Transcode<Char, 64, CopyNoBlock<Char> >
+};
+
+#if defined(CCM_UTF8_X86)
+
+//----------------------------------------------------------------------
+
+// In a well formed block a byte is a continuation byte exactly when one
+// of the 3 bytes before it leads a sequence reaching it. '\0' and the
+// leading bytes 0xF8 to 0xFF are never well formed.
+static Boolean ScanBlockSSE2(
+    /* [in] */ const char* p,
+    /* [out] */ BlockCounts* counts)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_loadu_si128((const __m128i*)p);
+    __m128i prev1 = _mm_loadu_si128((const __m128i*)(p - 1));
+    __m128i prev2 = _mm_loadu_si128((const __m128i*)(p - 2));
+    __m128i prev3 = _mm_loadu_si128((const __m128i*)(p - 3));
+
+    // 0x80 to 0xBF are the signed bytes below -64.
+    __m128i cont = _mm_cmpgt_epi8(_mm_set1_epi8(-64), v);
+    __m128i required = _mm_or_si128(
+            _mm_subs_epu8(prev1, _mm_set1_epi8((char)0xBF)),
+            _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8((char)0xDF)),
+                    _mm_subs_epu8(prev3, _mm_set1_epi8((char)0xEF))));
+    __m128i error = _mm_or_si128(
+            _mm_cmpeq_epi8(cont, _mm_cmpeq_epi8(required, zero)),
+            _mm_cmpeq_epi8(v, zero));
+    Integer errors = _mm_movemask_epi8(error) |
+            (~_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_subs_epu8(v, _mm_set1_epi8((char)0xF7)), zero)) & 0xFFFF);
+    if (errors != 0) {
+        return false;
+    }
+
+    counts->mChars = 16 - __builtin_popcount(_mm_movemask_epi8(cont));
+    counts->mLead4s = __builtin_popcount(~_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_subs_epu8(v, _mm_set1_epi8((char)0xEF)), zero)) & 0xFFFF);
+    counts->mOverlongs = __builtin_popcount(_mm_movemask_epi8(_mm_and_si128(
+                    _mm_cmpeq_epi8(prev1, _mm_set1_epi8((char)0xF0)),
+                    _mm_cmpeq_epi8(_mm_subs_epu8(v, _mm_set1_epi8((char)0x8F)), zero))));
+    counts->mASCII = _mm_movemask_epi8(v) == 0;
+    return true;
+}
+
+// A byte has its top bit set if it is not ASCII, and so does the 0xFF
+// that a '\0' compares to.
+static inline Boolean IsASCIIBlockSSE2(
+    /* [in] */ __m128i v)
+{
+    return _mm_movemask_epi8(_mm_or_si128(v,
+            _mm_cmpeq_epi8(v, _mm_setzero_si128()))) == 0;
+}
+
+static Boolean CopyASCIIBlockSSE2(
+    /* [in] */ const char* p,
+    /* [out] */ Short* dst)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_loadu_si128((const __m128i*)p);
+    if (!IsASCIIBlockSSE2(v)) {
+        return false;
+    }
+    _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi8(v, zero));
+    _mm_storeu_si128((__m128i*)(dst + 8), _mm_unpackhi_epi8(v, zero));
+    return true;
+}
+
+static Boolean CopyASCIIBlockSSE2(
+    /* [in] */ const char* p,
+    /* [out] */ Char* dst)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_loadu_si128((const __m128i*)p);
+    if (!IsASCIIBlockSSE2(v)) {
+        return false;
+    }
+    __m128i lo = _mm_unpacklo_epi8(v, zero);
+    __m128i hi = _mm_unpackhi_epi8(v, zero);
+    _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(dst + 4), _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(dst + 8), _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128((__m128i*)(dst + 12), _mm_unpackhi_epi16(hi, zero));
+    return true;
+}
+
+static Integer CountCharsSSE2(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize,
+    /* [out] */ Boolean* isASCII)
+{
+    Counts counts = { 0, 0, true };
+    CountBlocks<16, ScanBlockSSE2>(string, byteSize, false, &counts);
+    *isASCII = counts.mASCII;
+    return counts.mChars;
+}
+
+static Integer CountUTF16UnitsSSE2(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize)
+{
+    Counts counts = { 0, 0, true };
+    CountBlocks<16, ScanBlockSSE2>(string, byteSize, true, &counts);
+    return counts.mUTF16Units;
+}
+
+const UTF8::Kernels UTF8::sSSE2Kernels = {
+    ISA::SSE2,
+    CountCharsSSE2,
+    CountUTF16UnitsSSE2,
+    Transcode<Short, 16, CopyASCIIBlockSSE2>,
+    Transcode<Char, 16, CopyASCIIBlockSSE2>
+};
+
+//----------------------------------------------------------------------
+
+#define AVX2_TARGET __attribute__((target("avx2,popcnt")))
+
+AVX2_TARGET
+static Boolean ScanBlockAVX2(
+    /* [in] */ const char* p,
+    /* [out] */ BlockCounts* counts)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i prev1 = _mm256_loadu_si256((const __m256i*)(p - 1));
+    __m256i prev2 = _mm256_loadu_si256((const __m256i*)(p - 2));
+    __m256i prev3 = _mm256_loadu_si256((const __m256i*)(p - 3));
+
+    __m256i cont = _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), v);
+    __m256i required = _mm256_or_si256(
+            _mm256_subs_epu8(prev1, _mm256_set1_epi8((char)0xBF)),
+            _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8((char)0xDF)),
+                    _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)0xEF))));
+    __m256i error = _mm256_or_si256(
+            _mm256_cmpeq_epi8(cont, _mm256_cmpeq_epi8(required, zero)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, zero),
+                    _mm256_cmpeq_epi8(_mm256_cmpeq_epi8(
+                            _mm256_subs_epu8(v, _mm256_set1_epi8((char)0xF7)), zero), zero)));
+    if (_mm256_movemask_epi8(error) != 0) {
+        return false;
+    }
+
+    counts->mChars = 32 - __builtin_popcount((uint32_t)_mm256_movemask_epi8(cont));
+    counts->mLead4s = 32 - __builtin_popcount((uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_subs_epu8(v, _mm256_set1_epi8((char)0xEF)), zero)));
+    counts->mOverlongs = __builtin_popcount((uint32_t)_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(prev1, _mm256_set1_epi8((char)0xF0)),
+            _mm256_cmpeq_epi8(_mm256_subs_epu8(v, _mm256_set1_epi8((char)0x8F)), zero))));
+    counts->mASCII = _mm256_movemask_epi8(v) == 0;
+    return true;
+}
+
+AVX2_TARGET
+static inline Boolean IsASCIIBlockAVX2(
+    /* [in] */ __m256i v)
+{
+    return _mm256_movemask_epi8(_mm256_or_si256(v,
+            _mm256_cmpeq_epi8(v, _mm256_setzero_si256()))) == 0;
+}
+
+AVX2_TARGET
+static Boolean CopyASCIIBlockAVX2(
+    /* [in] */ const char* p,
+    /* [out] */ Short* dst)
+{
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    if (!IsASCIIBlockAVX2(v)) {
+        return false;
+    }
+    _mm256_storeu_si256((__m256i*)dst,
+            _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+    _mm256_storeu_si256((__m256i*)(dst + 16),
+            _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+    return true;
+}
+
+AVX2_TARGET
+static Boolean CopyASCIIBlockAVX2(
+    /* [in] */ const char* p,
+    /* [out] */ Char* dst)
+{
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    if (!IsASCIIBlockAVX2(v)) {
+        return false;
+    }
+    for (Integer i = 0; i < 32; i += 8) {
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64((const __m128i*)(p + i))));
+    }
+    return true;
+}
+
+static Integer CountCharsAVX2(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize,
+    /* [out] */ Boolean* isASCII)
+{
+    Counts counts = { 0, 0, true };
+    CountBlocks<32, ScanBlockAVX2>(string, byteSize, false, &counts);
+    *isASCII = counts.mASCII;
+    return counts.mChars;
+}
+
+static Integer CountUTF16UnitsAVX2(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize)
+{
+    Counts counts = { 0, 0, true };
+    CountBlocks<32, ScanBlockAVX2>(string, byteSize, true, &counts);
+    return counts.mUTF16Units;
+}
+
+const UTF8::Kernels UTF8::sAVX2Kernels = {
+    ISA::AVX2,
+    CountCharsAVX2,
+    CountUTF16UnitsAVX2,
+    Transcode<Short, 32, CopyASCIIBlockAVX2>,
+    Transcode<Char, 32, CopyASCIIBlockAVX2>
+};
+
+#else
+
+const UTF8::Kernels UTF8::sSSE2Kernels = UTF8::sScalarKernels;
+const UTF8::Kernels UTF8::sAVX2Kernels = UTF8::sScalarKernels;
+
+#endif
+
+//----------------------------------------------------------------------
+
+const UTF8::Kernels* UTF8::sKernels = &UTF8::sScalarKernels;
+
+UTF8::ISA UTF8::GetBestISA()
+{
+#if defined(CCM_UTF8_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return ISA::AVX2;
+    }
+    return ISA::SSE2;
+#else
+    return ISA::Scalar;
+#endif
+}
+
+Boolean UTF8::Select(
+    /* [in] */ ISA isa)
+{
+    if (isa > GetBestISA()) {
+        return false;
+    }
+    sKernels = isa == ISA::AVX2 ? &sAVX2Kernels :
+            isa == ISA::SSE2 ? &sSSE2Kernels : &sScalarKernels;
+    return true;
+}
+
+// Strings used before this runs, by other static initializers, simply
+// go through the scalar kernels.
+static Boolean sKernelsSelected = UTF8::Select(UTF8::GetBestISA());
+
+}
@@ -0,0 +1,124 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#ifndef __CCM_UTF8_H__
+#define __CCM_UTF8_H__
+
+#include "ccmtypes.h"
+
+namespace ccm {
+
+// Bulk UTF-8 kernels for String. They walk a string the way String
+// always has: a sequence is sized by its leading byte only, and the walk
+// stops at the first '\0', invalid leading byte or truncated sequence.
+// Runs of well formed text are handled a vector at a time with SSE2 or
+// AVX2, picked once by what the CPU supports, and anything else falls
+// back to the scalar walk.
+class UTF8
+{
+public:
+    enum class ISA
+    {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    inline static Integer CountChars(
+        /* [in] */ const char* string,
+        /* [in] */ Integer byteSize,
+        /* [out] */ Boolean* isASCII);
+
+    inline static Integer CountUTF16Units(
+        /* [in] */ const char* string,
+        /* [in] */ Integer byteSize);
+
+    // |dst| must hold CountUTF16Units() units.
+    inline static Integer ToUTF16(
+        /* [in] */ const char* string,
+        /* [in] */ Integer byteSize,
+        /* [out] */ Short* dst);
+
+    // |dst| must hold CountChars() chars.
+    inline static Integer ToUTF32(
+        /* [in] */ const char* string,
+        /* [in] */ Integer byteSize,
+        /* [out] */ Char* dst);
+
+    inline static ISA GetISA();
+
+    static ISA GetBestISA();
+
+    // Only for tests and benchmarks, fails if the CPU lacks |isa|.
+    static Boolean Select(
+        /* [in] */ ISA isa);
+
+private:
+    struct Kernels
+    {
+        ISA mISA;
+        Integer (*mCountChars)(const char*, Integer, Boolean*);
+        Integer (*mCountUTF16Units)(const char*, Integer);
+        Integer (*mToUTF16)(const char*, Integer, Short*);
+        Integer (*mToUTF32)(const char*, Integer, Char*);
+    };
+
+    static const Kernels sScalarKernels;
+    static const Kernels sSSE2Kernels;
+    static const Kernels sAVX2Kernels;
+    static const Kernels* sKernels;
+};
+
+Integer UTF8::CountChars(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize,
+    /* [out] */ Boolean* isASCII)
+{
+    return sKernels->mCountChars(string, byteSize, isASCII);
+}
+
+Integer UTF8::CountUTF16Units(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize)
+{
+    return sKernels->mCountUTF16Units(string, byteSize);
+}
+
+Integer UTF8::ToUTF16(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize,
+    /* [out] */ Short* dst)
+{
+    return sKernels->mToUTF16(string, byteSize, dst);
+}
+
+Integer UTF8::ToUTF32(
+    /* [in] */ const char* string,
+    /* [in] */ Integer byteSize,
+    /* [out] */ Char* dst)
+{
+    return sKernels->mToUTF32(string, byteSize, dst);
+}
+
+UTF8::ISA UTF8::GetISA()
+{
+    return sKernels->mISA;
+}
+
+}
+
+#endif // __CCM_UTF8_H__
@@ -0,0 +1,138 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "arena.h"
+#include "ccmlogger.h"
+#include <stdlib.h>
+
+namespace ccm {
+
+Arena::Arena(
+    /* [in] */ size_t chunkSize)
+    : mChunkSize(chunkSize)
+    , mHead(nullptr)
+    , mCurrent(nullptr)
+    , mCleanups(nullptr)
+{}
+
+Arena::~Arena()
+{
+    RunCleanups(nullptr);
+    Chunk* chunk = mHead;
+    while (chunk != nullptr) {
+        Chunk* next = chunk->mNext;
+        free(chunk);
+        chunk = next;
+    }
+    mHead = mCurrent = nullptr;
+}
+
+void* Arena::Alloc(
+    /* [in] */ size_t size,
+    /* [in] */ size_t align)
+{
+    if (mCurrent != nullptr) {
+        size_t offset = (mCurrent->mUsed + align - 1) & ~(align - 1);
+        if (offset + size <= mCurrent->mSize) {
+            mCurrent->mUsed = offset + size;
+            return reinterpret_cast<Byte*>(mCurrent) + CHUNK_HEADER_SIZE + offset;
+        }
+    }
+
+    Chunk* chunk = NextChunk(size + align);
+    if (chunk == nullptr) {
+        return nullptr;
+    }
+    size_t base = reinterpret_cast<size_t>(chunk) + CHUNK_HEADER_SIZE;
+    size_t offset = ((base + align - 1) & ~(align - 1)) - base;
+    chunk->mUsed = offset + size;
+    return reinterpret_cast<Byte*>(chunk) + CHUNK_HEADER_SIZE + offset;
+}
+
+Arena::Chunk* Arena::NextChunk(
+    /* [in] */ size_t size)
+{
+    // Reuse the chunks left by the previous Rewind() if they are large
+    // enough, otherwise insert a new one after the current chunk.
+    Chunk* next = mCurrent != nullptr ? mCurrent->mNext : mHead;
+    if (next != nullptr && next->mSize >= size) {
+        next->mUsed = 0;
+        mCurrent = next;
+        return next;
+    }
+
+    size_t chunkSize = size > mChunkSize ? size : mChunkSize;
+    Chunk* chunk = (Chunk*)malloc(CHUNK_HEADER_SIZE + chunkSize);
+    if (chunk == nullptr) {
+        Logger::E("Arena", "Malloc chunk which size is %zu failed.", chunkSize);
+        return nullptr;
+    }
+    chunk->mSize = chunkSize;
+    chunk->mUsed = 0;
+    chunk->mNext = next;
+    if (mCurrent != nullptr) {
+        mCurrent->mNext = chunk;
+    }
+    else {
+        mHead = chunk;
+    }
+    mCurrent = chunk;
+    return chunk;
+}
+
+Boolean Arena::AddCleanup(
+    /* [in] */ CleanupFunc func,
+    /* [in] */ void* object)
+{
+    Cleanup* cleanup = Alloc<Cleanup>();
+    if (cleanup == nullptr) {
+        return false;
+    }
+    cleanup->mFunc = func;
+    cleanup->mObject = object;
+    cleanup->mNext = mCleanups;
+    mCleanups = cleanup;
+    return true;
+}
+
+void Arena::RunCleanups(
+    /* [in] */ Cleanup* last)
+{
+    while (mCleanups != last) {
+        Cleanup* cleanup = mCleanups;
+        mCleanups = cleanup->mNext;
+        cleanup->mFunc(cleanup->mObject);
+    }
+}
+
+void Arena::Rewind(
+    /* [in] */ const Mark& mark)
+{
+    RunCleanups(mark.mCleanups);
+    mCurrent = mark.mChunk;
+    if (mCurrent != nullptr) {
+        mCurrent->mUsed = mark.mUsed;
+    }
+}
+
+Arena* Arena::GetThreadArena()
+{
+    static thread_local Arena sThreadArena;
+    return &sThreadArena;
+}
+
+}
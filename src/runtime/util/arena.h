@@ -0,0 +1,177 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#ifndef __CCM_ARENA_H__
+#define __CCM_ARENA_H__
+
+#include "ccmtypes.h"
+#include <stddef.h>
+#include <new>
+
+namespace ccm {
+
+// A bump allocator. Memory is carved from chunks which are kept after
+// Rewind(), so a long-lived arena reaches a steady state without
+// touching the heap. Objects which own something are registered with
+// a cleanup, which Rewind() runs before their memory is reused.
+class Arena
+{
+public:
+    typedef void (*CleanupFunc)(
+        /* [in] */ void* object);
+
+private:
+    struct Chunk
+    {
+        Chunk* mNext;
+        size_t mSize;
+        size_t mUsed;
+    };
+
+    struct Cleanup
+    {
+        Cleanup* mNext;
+        CleanupFunc mFunc;
+        void* mObject;
+    };
+
+    static constexpr size_t CHUNK_HEADER_SIZE = (sizeof(Chunk) + 15) & ~15;
+
+public:
+    struct Mark
+    {
+        Chunk* mChunk;
+        size_t mUsed;
+        Cleanup* mCleanups;
+    };
+
+    class Scope
+    {
+    public:
+        inline explicit Scope(
+            /* [in] */ Arena* arena);
+
+        inline ~Scope();
+
+    private:
+        Arena* mArena;
+        Mark mMark;
+    };
+
+public:
+    explicit Arena(
+        /* [in] */ size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+    ~Arena();
+
+    void* Alloc(
+        /* [in] */ size_t size,
+        /* [in] */ size_t align = alignof(Long));
+
+    template<class T>
+    inline T* Alloc();
+
+    // Runs |func| on |object| when the arena is rewound past this call,
+    // the latest registered first. Returns false if out of memory.
+    Boolean AddCleanup(
+        /* [in] */ CleanupFunc func,
+        /* [in] */ void* object);
+
+    // Constructs a T whose destructor runs when the arena is rewound.
+    template<class T>
+    inline T* New();
+
+    inline Mark GetMark();
+
+    void Rewind(
+        /* [in] */ const Mark& mark);
+
+    // Returns the arena of the calling thread.
+    static Arena* GetThreadArena();
+
+private:
+    Chunk* NextChunk(
+        /* [in] */ size_t size);
+
+    void RunCleanups(
+        /* [in] */ Cleanup* last);
+
+    template<class T>
+    static void Destroy(
+        /* [in] */ void* object);
+
+public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 4096;
+
+private:
+    size_t mChunkSize;
+    Chunk* mHead;
+    Chunk* mCurrent;
+    Cleanup* mCleanups;
+};
+
+Arena::Scope::Scope(
+    /* [in] */ Arena* arena)
+    : mArena(arena)
+    , mMark(arena->GetMark())
+{}
+
+Arena::Scope::~Scope()
+{
+    mArena->Rewind(mMark);
+}
+
+template<class T>
+T* Arena::Alloc()
+{
+    return static_cast<T*>(Alloc(sizeof(T), alignof(T)));
+}
+
+template<class T>
+T* Arena::New()
+{
+    void* addr = Alloc(sizeof(T), alignof(T));
+    if (addr == nullptr) {
+        return nullptr;
+    }
+    T* object = new(addr) T();
+    if (!AddCleanup(Destroy<T>, object)) {
+        object->~T();
+        return nullptr;
+    }
+    return object;
+}
+
+template<class T>
+void Arena::Destroy(
+    /* [in] */ void* object)
+{
+    static_cast<T*>(object)->~T();
+}
+
+Arena::Mark Arena::GetMark()
+{
+    Mark mark;
+    mark.mChunk = mCurrent;
+    mark.mUsed = mCurrent != nullptr ? mCurrent->mUsed : 0;
+    mark.mCleanups = mCleanups;
+    return mark;
+}
+
+}
+
+#endif // __CCM_ARENA_H__
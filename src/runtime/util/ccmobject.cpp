@@ -68,8 +68,10 @@ ECode Object::AttachMetadata(
     /* [in] */ IMetaComponent* component,
     /* [in] */ const String& coclassName)
 {
+    // The interned name is held, so its buffer outlives the intern pool.
     mComponent = component;
-    mCoclassName = coclassName;
+    mInternedCoclassName = coclassName.Intern();
+    mCoclassName = mInternedCoclassName.string();
     return NOERROR;
 }
 
@@ -88,7 +90,12 @@ ECode Object::GetCoclass(
     VALIDATE_NOT_NULL(klass);
 
     if (mComponent != nullptr) {
-        return mComponent->GetCoclass(mCoclassName, klass);
+        // A literal name is looked up in the intern pool, which shares the
+        // pooled buffer instead of copying the name on every call.
+        if (mCoclassName == mInternedCoclassName.string()) {
+            return mComponent->GetCoclass(mInternedCoclassName, klass);
+        }
+        return mComponent->GetCoclass(String::Intern(mCoclassName), klass);
     }
     else {
         *klass = nullptr;
@@ -299,4 +306,41 @@ Boolean Object::InstanceOf(
     return ocid == cid;
 }
 
+void ProbeCache::Put(
+    /* [in] */ const void* base,
+    /* [in] */ size_t size,
+    /* [in] */ const InterfaceID& iid,
+    /* [in] */ IInterface* object)
+{
+    Integer offset = OFFSET_NONE;
+    if (object != nullptr) {
+        uintptr_t start = reinterpret_cast<uintptr_t>(base);
+        uintptr_t address = reinterpret_cast<uintptr_t>(object);
+        if (address < start || address >= start + size) {
+            return;
+        }
+        offset = (Integer)(address - start);
+    }
+
+    Integer index = GetIndex(iid);
+    for (Integer i = 0; i < ENTRY_NUMBER; i++) {
+        Entry& entry = mEntries[(index + i) & (ENTRY_NUMBER - 1)];
+        Integer state = entry.mState.load(std::memory_order_acquire);
+        if (state == STATE_EMPTY) {
+            if (!entry.mState.compare_exchange_strong(state, STATE_WRITING,
+                    std::memory_order_acquire)) {
+                continue;
+            }
+            memcpy(&entry.mUuid, &iid.mUuid, sizeof(Uuid));
+            entry.mOffset = offset;
+            entry.mState.store(STATE_READY, std::memory_order_release);
+            return;
+        }
+        if (state == STATE_READY && entry.mUuid == iid.mUuid) {
+            return;
+        }
+    }
+    // Full, the class keeps asking its super classes for the rest.
+}
+
 }
@@ -35,6 +35,12 @@ public:
         /* [in] */ IMetaComponent* component,
         /* [in] */ const String& coclassName) override;
 
+    // Used by the generated class objects, |coclassName| is a literal
+    // of the component and is kept as it is.
+    inline void AttachMetadata(
+        /* [in] */ IMetaComponent* component,
+        /* [in] */ const char* coclassName);
+
     ECode GetCoclassID(
         /* [out] */ CoclassID* cid) override;
 
@@ -101,11 +107,90 @@ public:
         /* [in] */ const CoclassID& cid);
 
 private:
-    IMetaComponent* mComponent;
-    String mCoclassName;
+    IMetaComponent* mComponent = nullptr;
+    const char* mCoclassName = nullptr;
+    String mInternedCoclassName;
     AutoPtr<IReferenceObserver> mRefObserver;
 };
 
+void Object::AttachMetadata(
+    /* [in] */ IMetaComponent* component,
+    /* [in] */ const char* coclassName)
+{
+    mComponent = component;
+    mCoclassName = coclassName;
+}
+
+// Remembers where the Probe() of a super class found each interface, as
+// an offset from the probing class, so CCM_INTERFACE_IMPL_N classes do not
+// walk their super classes again. It relies on a super class answering
+// the same IID at the same place in every instance, and leaves alone the
+// answers which are not inside the object. Kept as a zero-initialized
+// static, so it needs no guard and no destructor.
+class COM_PUBLIC ProbeCache
+{
+public:
+    ALWAYS_INLINE inline Boolean Find(
+        /* [in] */ const void* base,
+        /* [in] */ const InterfaceID& iid,
+        /* [out] */ IInterface** object);
+
+    void Put(
+        /* [in] */ const void* base,
+        /* [in] */ size_t size,
+        /* [in] */ const InterfaceID& iid,
+        /* [in] */ IInterface* object);
+
+private:
+    struct Entry
+    {
+        std::atomic<Integer> mState;
+        Integer mOffset;
+        Uuid mUuid;
+    };
+
+    ALWAYS_INLINE inline static Integer GetIndex(
+        /* [in] */ const InterfaceID& iid);
+
+private:
+    static constexpr Integer ENTRY_NUMBER = 16;
+    static constexpr Integer STATE_EMPTY = 0;
+    static constexpr Integer STATE_WRITING = 1;
+    static constexpr Integer STATE_READY = 2;
+    static constexpr Integer OFFSET_NONE = -1;
+
+    Entry mEntries[ENTRY_NUMBER];
+};
+
+Boolean ProbeCache::Find(
+    /* [in] */ const void* base,
+    /* [in] */ const InterfaceID& iid,
+    /* [out] */ IInterface** object)
+{
+    Integer index = GetIndex(iid);
+    for (Integer i = 0; i < ENTRY_NUMBER; i++) {
+        Entry& entry = mEntries[(index + i) & (ENTRY_NUMBER - 1)];
+        Integer state = entry.mState.load(std::memory_order_acquire);
+        if (state == STATE_EMPTY) {
+            return false;
+        }
+        if (state == STATE_READY && entry.mUuid == iid.mUuid) {
+            *object = entry.mOffset == OFFSET_NONE ? nullptr :
+                    reinterpret_cast<IInterface*>(
+                    reinterpret_cast<uintptr_t>(base) + entry.mOffset);
+            return true;
+        }
+    }
+    return false;
+}
+
+Integer ProbeCache::GetIndex(
+    /* [in] */ const InterfaceID& iid)
+{
+    uint32_t hash = iid.mUuid.mData1 ^ (iid.mUuid.mData1 >> 16);
+    return (Integer)(hash & (ENTRY_NUMBER - 1));
+}
+
 }
 
 #endif // __CCM_OBJECT_H__
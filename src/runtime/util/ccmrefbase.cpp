@@ -65,6 +65,54 @@ namespace ccm {
 
 #define BAD_WEAK(c) ((c) == 0 || ((c) & (~MAX_COUNT)) != 0)
 
+// The inline counts in RefBase::mRefs: the strong count in the high half
+// and the weak count above the two tag bits in the low half. The bits
+// left over above MAX_COUNT keep the owner of a confined object in
+// debug builds, so a weak count at MAX_COUNT moves the counts out.
+static constexpr uint64_t REFS_INLINE = 0x1;
+static constexpr uint64_t REFS_CONFINED = 0x2;
+static constexpr uint64_t REFS_WEAK_ONE = 1ull << 2;
+static constexpr uint64_t REFS_STRONG_ONE = 1ull << 32;
+static constexpr uint64_t REFS_INITIAL =
+        ((uint64_t)INITIAL_STRONG_VALUE << 32) | REFS_INLINE;
+static constexpr Integer REFS_OWNER_SHIFT = 22;
+static constexpr uint64_t REFS_OWNER_MASK = 0x3ffull << REFS_OWNER_SHIFT;
+
+static inline Integer InlineStrong(
+    /* [in] */ uint64_t refs)
+{
+    return (Integer)(int32_t)(refs >> 32);
+}
+
+static inline Integer InlineWeak(
+    /* [in] */ uint64_t refs)
+{
+    return (Integer)((refs >> 2) & MAX_COUNT);
+}
+
+static inline uint64_t OwnerTag()
+{
+#if defined(_DEBUG)
+    uint64_t self = (uint64_t)pthread_self() * 0x9e3779b97f4a7c15ull;
+    return (self >> 54) << REFS_OWNER_SHIFT;
+#else
+    return 0;
+#endif
+}
+
+static inline void CheckOwner(
+    /* [in] */ const RefBase* base,
+    /* [in] */ uint64_t refs)
+{
+#if defined(_DEBUG)
+    if ((refs & REFS_OWNER_MASK) != OwnerTag()) {
+        Logger::E("RefBase", "%p is used out of the thread it is confined to",
+                base);
+        assert(0);
+    }
+#endif
+}
+
 
 class COM_LOCAL RefBase::WeakRefImpl : public RefBase::WeakRef
 {
@@ -473,7 +521,45 @@ void RefBase::WeakRefImpl::PrintRefsLocked(
 Integer RefBase::IncStrong(
     /* [in] */ const void* id) const
 {
-    WeakRefImpl* const refs = mRefs;
+    uint64_t word = mRefs.load(std::memory_order_acquire);
+    while (word & REFS_INLINE) {
+        if (InlineWeak(word) == MAX_COUNT) {
+            // One more would carry into the owner bits, so the counts
+            // move to a WeakRefImpl, which has room for them.
+            word = reinterpret_cast<uintptr_t>(GetWeakRefImpl());
+            break;
+        }
+        // One update takes both counts, and the first one drops
+        // INITIAL_STRONG_VALUE with it.
+        const Integer c = InlineStrong(word);
+        uint64_t next = word + REFS_STRONG_ONE + REFS_WEAK_ONE;
+        if (c == INITIAL_STRONG_VALUE) {
+            next -= (uint64_t)INITIAL_STRONG_VALUE << 32;
+        }
+        if (word & REFS_CONFINED) {
+            CheckOwner(this, word);
+            mRefs.store(next, std::memory_order_relaxed);
+        }
+        else if (!mRefs.compare_exchange_weak(word, next,
+                std::memory_order_acquire, std::memory_order_acquire)) {
+            continue;
+        }
+        if (c <= 0) {
+            Logger::E("RefBase", "IncStrong() called on %p after last strong ref",
+                    this);
+            assert(0);
+        }
+#if PRINT_REFS
+        Logger::D("RefBase", "IncStrong of %p from %p: cnt=%d\n", this, id, c);
+#endif
+        if (c != INITIAL_STRONG_VALUE) {
+            return c + 1;
+        }
+        const_cast<RefBase*>(this)->OnFirstRef();
+        return 1;
+    }
+
+    WeakRefImpl* const refs = reinterpret_cast<WeakRefImpl*>(word);
     refs->IncWeak(id);
 
     refs->AddStrongRef(id);
@@ -503,7 +589,54 @@ Integer RefBase::IncStrong(
 Integer RefBase::DecStrong(
     /* [in] */ const void* id) const
 {
-    WeakRefImpl* const refs = mRefs;
+    uint64_t word = mRefs.load(std::memory_order_acquire);
+    while (word & REFS_INLINE) {
+        // The last strong reference keeps its weak one until
+        // OnLastStrongRef() returns, which may ask for a WeakRefImpl.
+        const Integer c = InlineStrong(word);
+        uint64_t next = word - REFS_STRONG_ONE;
+        if (c != 1) {
+            next -= REFS_WEAK_ONE;
+        }
+        if (word & REFS_CONFINED) {
+            CheckOwner(this, word);
+            mRefs.store(next, std::memory_order_relaxed);
+        }
+        else if (!mRefs.compare_exchange_weak(word, next,
+                std::memory_order_release, std::memory_order_acquire)) {
+            continue;
+        }
+#if PRINT_REFS
+        Logger::D("RefBase", "DecStrong of %p from %p: cnt=%d\n", this, id, c);
+#endif
+        if (BAD_STRONG(c)) {
+            Logger::E("RefBase", "DecStrong() called on %p too many times",
+                    this);
+            assert(0);
+        }
+        if (c != 1) {
+            return c - 1;
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const_cast<RefBase*>(this)->OnLastStrongRef(id);
+        word = mRefs.load(std::memory_order_acquire);
+        if (word & REFS_INLINE) {
+            // Nobody can hold a weak reference, so the counts go with
+            // the object.
+            delete this;
+            return 0;
+        }
+        WeakRefImpl* const refs = reinterpret_cast<WeakRefImpl*>(word);
+        Integer flags = refs->mFlags.load(std::memory_order_relaxed);
+        if ((flags & OBJECT_LIFETIME_MASK) == OBJECT_LIFETIME_STRONG) {
+            delete this;
+        }
+        refs->DecWeak(id);
+        return 0;
+    }
+
+    WeakRefImpl* const refs = reinterpret_cast<WeakRefImpl*>(word);
     refs->RemoveStrongRef(id);
     const Integer c = refs->mStrong.fetch_sub(1, std::memory_order_release);
 #if PRINT_REFS
@@ -530,7 +663,41 @@ Integer RefBase::ForceIncStrong(
     /* [in] */ const void* id) const
 {
     // Allows initial mStrong of 0 in addition to INITIAL_STRONG_VALUE.
-    WeakRefImpl* const refs = mRefs;
+    uint64_t word = mRefs.load(std::memory_order_acquire);
+    while (word & REFS_INLINE) {
+        if (InlineWeak(word) == MAX_COUNT) {
+            word = reinterpret_cast<uintptr_t>(GetWeakRefImpl());
+            break;
+        }
+        const Integer c = InlineStrong(word);
+        uint64_t next = word + REFS_STRONG_ONE + REFS_WEAK_ONE;
+        if (c == INITIAL_STRONG_VALUE) {
+            next -= (uint64_t)INITIAL_STRONG_VALUE << 32;
+        }
+        if (word & REFS_CONFINED) {
+            CheckOwner(this, word);
+            mRefs.store(next, std::memory_order_relaxed);
+        }
+        else if (!mRefs.compare_exchange_weak(word, next,
+                std::memory_order_acquire, std::memory_order_acquire)) {
+            continue;
+        }
+        if (c < 0) {
+            Logger::E("RefBase", "forceIncStrong called on %p after ref count underflow",
+                    this);
+            assert(0);
+        }
+#if PRINT_REFS
+        Logger::D("RefBase", "ForceIncStrong of %p from %p: cnt=%d\n", this, id, c);
+#endif
+        if (c != INITIAL_STRONG_VALUE && c != 0) {
+            return c + 1;
+        }
+        const_cast<RefBase*>(this)->OnFirstRef();
+        return 1;
+    }
+
+    WeakRefImpl* const refs = reinterpret_cast<WeakRefImpl*>(word);
     refs->IncWeak(id);
 
     refs->AddStrongRef(id);
@@ -560,7 +727,12 @@ Integer RefBase::ForceIncStrong(
 
 Integer RefBase::GetStrongCount() const
 {
-    return mRefs->mStrong.load(std::memory_order_relaxed);
+    uint64_t word = mRefs.load(std::memory_order_acquire);
+    if (word & REFS_INLINE) {
+        return InlineStrong(word);
+    }
+    return reinterpret_cast<WeakRefImpl*>(word)->mStrong.load(
+            std::memory_order_relaxed);
 }
 
 RefBase* RefBase::WeakRef::GetRefBase() const
@@ -777,47 +949,101 @@ void RefBase::WeakRef::TrackMe(
 RefBase::WeakRef* RefBase::CreateWeak(
     /* [in] */ const void* id) const
 {
-    mRefs->IncWeak(id);
-    return mRefs;
+    WeakRefImpl* const refs = GetWeakRefImpl();
+    refs->IncWeak(id);
+    return refs;
 }
 
 RefBase::WeakRef* RefBase::GetWeakRefs() const
 {
-    return mRefs;
+    return GetWeakRefImpl();
+}
+
+RefBase::WeakRefImpl* RefBase::GetWeakRefImpl() const
+{
+    uint64_t word = mRefs.load(std::memory_order_acquire);
+    if ((word & REFS_INLINE) == 0) {
+        return reinterpret_cast<WeakRefImpl*>(word);
+    }
+
+    if (word & REFS_CONFINED) {
+        CheckOwner(this, word);
+    }
+    WeakRefImpl* refs = new WeakRefImpl(const_cast<RefBase*>(this));
+    do {
+        refs->mStrong.store(InlineStrong(word), std::memory_order_relaxed);
+        refs->mWeak.store(InlineWeak(word), std::memory_order_relaxed);
+        if (mRefs.compare_exchange_weak(word, reinterpret_cast<uintptr_t>(refs),
+                std::memory_order_release, std::memory_order_acquire)) {
+            return refs;
+        }
+    } while (word & REFS_INLINE);
+
+    // Another thread moved the counts first.
+    delete refs;
+    return reinterpret_cast<WeakRefImpl*>(word);
+}
+
+void RefBase::ConfineToThread()
+{
+    uint64_t word = mRefs.load(std::memory_order_relaxed);
+    if (word & REFS_INLINE) {
+        mRefs.store((word & ~REFS_OWNER_MASK) | REFS_CONFINED | OwnerTag(),
+                std::memory_order_relaxed);
+    }
+}
+
+Boolean RefBase::IsConfinedToThread() const
+{
+    uint64_t word = mRefs.load(std::memory_order_relaxed);
+    return (word & REFS_INLINE) && (word & REFS_CONFINED);
 }
 
 RefBase::RefBase()
-    : mRefs(new WeakRefImpl(this))
+    : mRefs(REFS_INITIAL)
 {
+#if DEBUG_REFS
+    // Tracking keeps its records in the WeakRefImpl from the start.
+    GetWeakRefImpl();
+#endif
 }
 
 RefBase::~RefBase()
 {
-    Integer flags = mRefs->mFlags.load(std::memory_order_relaxed);
+    uint64_t word = mRefs.load(std::memory_order_relaxed);
+    if (word & REFS_INLINE) {
+        return;
+    }
+
+    WeakRefImpl* const refs = reinterpret_cast<WeakRefImpl*>(word);
+    Integer flags = refs->mFlags.load(std::memory_order_relaxed);
     // Life-time of this object is extended to WEAK, in
     // which case weakref_impl doesn't out-live the object and we
     // can free it now.
     if ((flags & OBJECT_LIFETIME_MASK) == OBJECT_LIFETIME_WEAK) {
         // It's possible that the weak count is not 0 if the object
         // re-acquired a weak reference in its destructor
-        if (mRefs->mWeak.load(std::memory_order_relaxed) == 0) {
-            delete mRefs;
+        if (refs->mWeak.load(std::memory_order_relaxed) == 0) {
+            delete refs;
         }
     }
-    else if (mRefs->mStrong.load(std::memory_order_relaxed)
+    else if (refs->mStrong.load(std::memory_order_relaxed)
             == INITIAL_STRONG_VALUE) {
         // We never acquired a strong reference on this object.
-        delete mRefs;
+        delete refs;
     }
-    const_cast<WeakRefImpl*&>(mRefs) = nullptr;
+    mRefs.store(0, std::memory_order_relaxed);
 }
 
 void RefBase::ExtendObjectLifetime(
     /* [in] */ Integer mode)
 {
+    if (mode == OBJECT_LIFETIME_STRONG) {
+        return;
+    }
     // Must be happens-before ordered with respect to construction or any
     // operation that could destroy the object.
-    mRefs->mFlags.fetch_or(mode, std::memory_order_relaxed);
+    GetWeakRefImpl()->mFlags.fetch_or(mode, std::memory_order_relaxed);
 }
 
 void RefBase::OnFirstRef()
@@ -84,6 +84,15 @@ public:
 
     WeakRef* GetWeakRefs() const;
 
+    // Lets AddRef() and Release() use plain increments. It must be called
+    // before the object is shared, and the object must not leave the
+    // calling thread while it holds no weak references. The first weak
+    // reference or lifetime extension makes the counts atomic again.
+    void ConfineToThread();
+
+    // Returns true while AddRef() and Release() use plain increments.
+    Boolean IsConfinedToThread() const;
+
     inline void PrintRefs() const;
 
     inline void TrackMe(
@@ -136,7 +145,16 @@ private:
     RefBase& operator=(
         /* [in] */ const RefBase& o);
 
-    WeakRefImpl* const mRefs;
+    // Moves the counts into a WeakRefImpl the first time the object
+    // needs one.
+    WeakRefImpl* GetWeakRefImpl() const;
+
+    // Until the object gets a weak reference or an extended lifetime, the
+    // strong and weak counts live here with the low bit set, so AddRef()
+    // and Release() touch a single word and the object takes a single
+    // allocation. Afterwards this points to the WeakRefImpl. A confined
+    // object also sets the second bit.
+    mutable std::atomic<uint64_t> mRefs;
 };
 
 void RefBase::PrintRefs() const
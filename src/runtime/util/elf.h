@@ -103,6 +103,33 @@ struct Elf64_Shdr
     Elf64_Xword     sh_entsize;
 };
 
+// Section types.
+enum : Elf64_Word {
+  SHT_NULL      = 0,          // No associated section (inactive entry).
+  SHT_PROGBITS  = 1,          // Program-defined contents.
+  SHT_SYMTAB    = 2,          // Symbol table.
+  SHT_STRTAB    = 3,          // String table.
+  SHT_DYNAMIC   = 6           // Information for dynamic linking.
+};
+
+// Dynamic table entry for ELF64.
+struct Elf64_Dyn
+{
+    Elf64_Sxword    d_tag;              // Type of dynamic table entry.
+    union
+    {
+        Elf64_Xword d_val;              // Integer value of entry.
+        Elf64_Addr  d_ptr;              // Pointer value of entry.
+    } d_un;
+};
+
+// Dynamic table entry tags.
+enum {
+  DT_NULL       = 0,          // Marks end of dynamic array.
+  DT_NEEDED     = 1,          // String table offset of needed library.
+  DT_STRTAB     = 5           // Address of string table.
+};
+
 } // namespace ccm;
 
 #endif // __CCM_ELF_H__
@@ -215,6 +215,25 @@ public:
         return;
     }
 
+    // Removes every entry whose value is |value|.
+    void RemoveValue(
+        /* [in] */ const Val& value)
+    {
+        for (int i = 0; i < mBucketSize; i++) {
+            Bucket** link = &mBuckets[i];
+            while (*link != nullptr) {
+                Bucket* curr = *link;
+                if (curr->mValue == value) {
+                    *link = curr->mNext;
+                    delete curr;
+                }
+                else {
+                    link = &curr->mNext;
+                }
+            }
+        }
+    }
+
     void Clear()
     {
         for (int i = 0; i < mBucketSize; i++) {
@@ -0,0 +1,128 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_LAZYOBJECTARRAY_H__
+#define __CCM_LAZYOBJECTARRAY_H__
+
+#include "ccmdef.h"
+#include "ccmtypes.h"
+#include <atomic>
+
+namespace ccm {
+
+// A fixed number of slots, each holding a reference to an object built
+// the first time it is asked for. A slot is filled once by a CAS, so
+// readers never lock; two threads may both build an object for the
+// same slot, and the one which loses the CAS drops its own.
+template<class T>
+class LazyObjectArray
+{
+public:
+    explicit LazyObjectArray(
+        /* [in] */ Integer length);
+
+    ~LazyObjectArray();
+
+    inline Integer GetLength() const;
+
+    inline T* Get(
+        /* [in] */ Integer index) const;
+
+    // Puts |object| in the empty slot |index| and returns it, or
+    // releases it and returns the object the slot holds already.
+    T* Publish(
+        /* [in] */ Integer index,
+        /* [in] */ T* object);
+
+    // Releases the objects and leaves the array empty. The slots stay
+    // until the array is destroyed, as a reader which checked the length
+    // before may still load or fill one.
+    void Clear();
+
+private:
+    LazyObjectArray(const LazyObjectArray&) = delete;
+
+    LazyObjectArray& operator=(const LazyObjectArray&) = delete;
+
+private:
+    std::atomic<Integer> mLength;
+    Integer mSlotNumber;
+    std::atomic<T*>* mSlots;
+};
+
+template<class T>
+LazyObjectArray<T>::LazyObjectArray(
+    /* [in] */ Integer length)
+    : mLength(length > 0 ? length : 0)
+    , mSlotNumber(length > 0 ? length : 0)
+    , mSlots(nullptr)
+{
+    if (mSlotNumber > 0) {
+        mSlots = new std::atomic<T*>[mSlotNumber];
+        for (Integer i = 0; i < mSlotNumber; i++) {
+            mSlots[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+}
+
+template<class T>
+LazyObjectArray<T>::~LazyObjectArray()
+{
+    Clear();
+    delete[] mSlots;
+}
+
+template<class T>
+Integer LazyObjectArray<T>::GetLength() const
+{
+    return mLength.load(std::memory_order_acquire);
+}
+
+template<class T>
+T* LazyObjectArray<T>::Get(
+    /* [in] */ Integer index) const
+{
+    return mSlots[index].load(std::memory_order_acquire);
+}
+
+template<class T>
+T* LazyObjectArray<T>::Publish(
+    /* [in] */ Integer index,
+    /* [in] */ T* object)
+{
+    REFCOUNT_ADD(object);
+    T* expected = nullptr;
+    if (!mSlots[index].compare_exchange_strong(expected, object,
+            std::memory_order_acq_rel, std::memory_order_acquire)) {
+        REFCOUNT_RELEASE(object);
+        return expected;
+    }
+    return object;
+}
+
+template<class T>
+void LazyObjectArray<T>::Clear()
+{
+    mLength.store(0, std::memory_order_release);
+    for (Integer i = 0; i < mSlotNumber; i++) {
+        T* object = mSlots[i].exchange(nullptr, std::memory_order_acq_rel);
+        REFCOUNT_RELEASE(object);
+    }
+}
+
+}
+
+#endif // __CCM_LAZYOBJECTARRAY_H__
@@ -128,6 +128,19 @@ void Mutex::Lock()
     mRecursionCount++;
 }
 
+Boolean Mutex::TryLock()
+{
+    if (!mRecursive || mExclusiveOwner != GetTid()) {
+        int32_t expected = 0, desired = 1;
+        if (!mState.compare_exchange_strong(expected, desired, std::memory_order_acquire)) {
+            return false;
+        }
+        mExclusiveOwner = GetTid();
+    }
+    mRecursionCount++;
+    return true;
+}
+
 void Mutex::Unlock()
 {
     mRecursionCount--;
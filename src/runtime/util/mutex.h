@@ -62,6 +62,10 @@ public:
 
     void Lock();
 
+    // Returns false instead of waiting if the lock is held by another
+    // thread.
+    Boolean TryLock();
+
     void Unlock();
 
 private:
@@ -98,7 +102,9 @@ inline Mutex::AutoLock::~AutoLock()
 
 inline Mutex::Mutex(
     /* [in] */ Boolean recursive)
-    : mExclusiveOwner(0)
+    : mState(0)
+    , mExclusiveOwner(0)
+    , mNumContenders(0)
     , mRecursive(recursive)
     , mRecursionCount(0)
 {}
@@ -138,6 +144,7 @@ private:
 inline Condition::Condition(
     /* [in] */ Mutex& mutex)
     : mGuard(mutex)
+    , mSequence(0)
     , mNumWaiters(0)
 {}
 
@@ -0,0 +1,265 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "perfecthash.h"
+#include <stdlib.h>
+#include <string.h>
+
+namespace ccm {
+
+static constexpr unsigned int MAX_SEED = 1u << 16;
+
+struct KeyEntry
+{
+    unsigned long long mKey;
+    Integer mEntry;
+};
+
+static int CompareKeyEntries(
+    /* [in] */ const void* lhs,
+    /* [in] */ const void* rhs)
+{
+    const KeyEntry* l = reinterpret_cast<const KeyEntry*>(lhs);
+    const KeyEntry* r = reinterpret_cast<const KeyEntry*>(rhs);
+    if (l->mKey != r->mKey) {
+        return l->mKey < r->mKey ? -1 : 1;
+    }
+    return l->mEntry - r->mEntry;
+}
+
+// Gives every bucket a seed under which its keys land in free slots,
+// the largest buckets first while most slots are free. |owners| gets
+// the unique key of every slot, or -1.
+static Boolean PlaceKeys(
+    /* [in] */ const unsigned long long* keys,
+    /* [in] */ Integer bucketNumber,
+    /* [in] */ const Integer* bucketStarts,
+    /* [in] */ const Integer* members,
+    /* [in] */ Integer maxBucketSize,
+    /* [in] */ Integer slotNumber,
+    /* [out] */ unsigned int* seeds,
+    /* [out] */ Integer* owners,
+    /* [out] */ Integer* candidates)
+{
+    memset(seeds, 0, sizeof(unsigned int) * bucketNumber);
+    for (Integer i = 0; i < slotNumber; i++) {
+        owners[i] = -1;
+    }
+
+    for (Integer size = maxBucketSize; size > 0; size--) {
+        for (Integer b = 0; b < bucketNumber; b++) {
+            if (bucketStarts[b + 1] - bucketStarts[b] != size) {
+                continue;
+            }
+            const Integer* bucket = members + bucketStarts[b];
+            unsigned int seed = 1;
+            for (; seed < MAX_SEED; seed++) {
+                Integer i = 0;
+                for (; i < size; i++) {
+                    Integer slot = PerfectHashIndex::GetSlot(
+                            keys[bucket[i]], seed, slotNumber - 1);
+                    Integer j = 0;
+                    while (j < i && candidates[j] != slot) {
+                        j++;
+                    }
+                    if (owners[slot] != -1 || j < i) {
+                        break;
+                    }
+                    candidates[i] = slot;
+                }
+                if (i == size) {
+                    break;
+                }
+            }
+            if (seed == MAX_SEED) {
+                return false;
+            }
+            seeds[b] = seed;
+            for (Integer i = 0; i < size; i++) {
+                owners[candidates[i]] = bucket[i];
+            }
+        }
+    }
+    return true;
+}
+
+PerfectHashIndex* PerfectHashIndex::Build(
+    /* [in] */ const unsigned long long* keys,
+    /* [in] */ const Integer* heads,
+    /* [in] */ Integer keyNumber,
+    /* [in] */ const Integer* values,
+    /* [in] */ const Integer* next,
+    /* [in] */ Integer number)
+{
+    // About four keys a bucket and at most half of the slots in use.
+    Integer bucketNumber = 1;
+    while (bucketNumber * 4 < keyNumber) {
+        bucketNumber <<= 1;
+    }
+    Integer slotNumber = 1;
+    while (slotNumber < keyNumber * 2) {
+        slotNumber <<= 1;
+    }
+
+    Integer* scratch = (Integer*)calloc(
+            (bucketNumber + 1) * 2 + (keyNumber + 1) * 2, sizeof(Integer));
+    if (scratch == nullptr) {
+        return nullptr;
+    }
+    Integer* bucketStarts = scratch;
+    unsigned int* seeds = reinterpret_cast<unsigned int*>(bucketStarts + bucketNumber + 1);
+    Integer* members = reinterpret_cast<Integer*>(seeds + bucketNumber + 1);
+    Integer* candidates = members + keyNumber + 1;
+
+    Integer maxBucketSize = 0;
+    for (Integer i = 0; i < keyNumber; i++) {
+        bucketStarts[(Mix(keys[i]) & (bucketNumber - 1)) + 1]++;
+    }
+    for (Integer b = 0; b < bucketNumber; b++) {
+        if (bucketStarts[b + 1] > maxBucketSize) {
+            maxBucketSize = bucketStarts[b + 1];
+        }
+        bucketStarts[b + 1] += bucketStarts[b];
+    }
+    // Fill the buckets with bucketStarts[b] as the cursor of bucket b,
+    // then shift the starts back.
+    for (Integer i = 0; i < keyNumber; i++) {
+        Integer b = Mix(keys[i]) & (bucketNumber - 1);
+        members[bucketStarts[b]++] = i;
+    }
+    for (Integer b = bucketNumber; b > 0; b--) {
+        bucketStarts[b] = bucketStarts[b - 1];
+    }
+    bucketStarts[0] = 0;
+
+    Integer* owners = nullptr;
+    for (;;) {
+        owners = (Integer*)malloc(sizeof(Integer) * slotNumber);
+        if (owners == nullptr) {
+            free(scratch);
+            return nullptr;
+        }
+        if (PlaceKeys(keys, bucketNumber, bucketStarts, members,
+                maxBucketSize, slotNumber, seeds, owners, candidates)) {
+            break;
+        }
+        free(owners);
+        slotNumber <<= 1;
+    }
+
+    size_t size = sizeof(PerfectHashIndex) +
+            sizeof(unsigned long long) * slotNumber +
+            sizeof(unsigned int) * bucketNumber +
+            sizeof(Integer) * (slotNumber + number * 2);
+    Byte* block = (Byte*)malloc(size);
+    if (block == nullptr) {
+        free(owners);
+        free(scratch);
+        return nullptr;
+    }
+
+    PerfectHashIndex* index = reinterpret_cast<PerfectHashIndex*>(block);
+    index->mBucketMask = bucketNumber - 1;
+    index->mSlotMask = slotNumber - 1;
+    index->mSlotKeys = reinterpret_cast<unsigned long long*>(
+            block + sizeof(PerfectHashIndex));
+    index->mSeeds = reinterpret_cast<unsigned int*>(
+            index->mSlotKeys + slotNumber);
+    index->mSlots = reinterpret_cast<Integer*>(
+            index->mSeeds + bucketNumber);
+    index->mValues = index->mSlots + slotNumber;
+    index->mNext = index->mValues + number;
+
+    memcpy(index->mSeeds, seeds, sizeof(unsigned int) * bucketNumber);
+    for (Integer i = 0; i < slotNumber; i++) {
+        Integer owner = owners[i];
+        index->mSlotKeys[i] = owner != -1 ? keys[owner] : 0;
+        index->mSlots[i] = owner != -1 ? heads[owner] : -1;
+    }
+    memcpy(index->mValues, values, sizeof(Integer) * number);
+    memcpy(index->mNext, next, sizeof(Integer) * number);
+
+    free(owners);
+    free(scratch);
+    return index;
+}
+
+PerfectHashIndex* PerfectHashIndex::Create(
+    /* [in] */ const unsigned long long* keys,
+    /* [in] */ const Integer* values,
+    /* [in] */ Integer number)
+{
+    KeyEntry* sorted = (KeyEntry*)malloc(sizeof(KeyEntry) * (number + 1));
+    unsigned long long* uniqueKeys = (unsigned long long*)malloc(
+            sizeof(unsigned long long) * (number + 1));
+    Integer* heads = (Integer*)malloc(sizeof(Integer) * (number + 1));
+    Integer* next = (Integer*)malloc(sizeof(Integer) * (number + 1));
+    PerfectHashIndex* index = nullptr;
+    if (sorted != nullptr && uniqueKeys != nullptr &&
+            heads != nullptr && next != nullptr) {
+        for (Integer i = 0; i < number; i++) {
+            sorted[i].mKey = keys[i];
+            sorted[i].mEntry = i;
+        }
+        qsort(sorted, number, sizeof(KeyEntry), CompareKeyEntries);
+
+        // Entries with equal keys share the slot of the first one.
+        Integer keyNumber = 0;
+        for (Integer i = 0; i < number; i++) {
+            next[sorted[i].mEntry] = -1;
+            if (i > 0 && sorted[i].mKey == sorted[i - 1].mKey) {
+                next[sorted[i - 1].mEntry] = sorted[i].mEntry;
+                continue;
+            }
+            uniqueKeys[keyNumber] = sorted[i].mKey;
+            heads[keyNumber] = sorted[i].mEntry;
+            keyNumber++;
+        }
+
+        index = Build(uniqueKeys, heads, keyNumber, values, next, number);
+    }
+
+    free(sorted);
+    free(uniqueKeys);
+    free(heads);
+    free(next);
+    return index;
+}
+
+void PerfectHashIndex::Destroy(
+    /* [in] */ PerfectHashIndex* index)
+{
+    free(index);
+}
+
+PerfectHashIndex* PerfectHashIndex::Publish(
+    /* [in] */ std::atomic<PerfectHashIndex*>& indexRef,
+    /* [in] */ PerfectHashIndex* index)
+{
+    if (index == nullptr) {
+        return indexRef.load(std::memory_order_acquire);
+    }
+
+    PerfectHashIndex* expected = nullptr;
+    if (!indexRef.compare_exchange_strong(expected, index,
+            std::memory_order_acq_rel, std::memory_order_acquire)) {
+        Destroy(index);
+        return expected;
+    }
+    return index;
+}
+
+}
@@ -0,0 +1,131 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_PERFECTHASH_H__
+#define __CCM_PERFECTHASH_H__
+
+#include "ccmtypes.h"
+#include <atomic>
+
+namespace ccm {
+
+// An immutable index over a fixed set of 64-bit keys. The keys are
+// spread over small buckets, and each bucket gets a seed which sends
+// its keys to slots no other key uses, so a lookup reads one seed and
+// one slot and never probes. Entries whose keys are equal are chained,
+// which lets a caller key it by a hash and check the real value.
+class PerfectHashIndex
+{
+public:
+    // Returns nullptr when out of memory. |values| are what the entries
+    // stand for, e.g. their positions in the metadata.
+    static PerfectHashIndex* Create(
+        /* [in] */ const unsigned long long* keys,
+        /* [in] */ const Integer* values,
+        /* [in] */ Integer number);
+
+    static void Destroy(
+        /* [in] */ PerfectHashIndex* index);
+
+    // Puts |index| in the empty |indexRef| and returns it, or destroys
+    // it and returns the index another thread has put there first.
+    static PerfectHashIndex* Publish(
+        /* [in] */ std::atomic<PerfectHashIndex*>& indexRef,
+        /* [in] */ PerfectHashIndex* index);
+
+    // Returns the first entry whose key is |key|, or -1.
+    inline Integer Find(
+        /* [in] */ unsigned long long key) const;
+
+    // Returns the next entry with the same key as |entry|, or -1.
+    inline Integer GetNext(
+        /* [in] */ Integer entry) const;
+
+    inline Integer GetValue(
+        /* [in] */ Integer entry) const;
+
+    inline static unsigned long long Mix(
+        /* [in] */ unsigned long long key);
+
+    inline static Integer GetSlot(
+        /* [in] */ unsigned long long key,
+        /* [in] */ unsigned int seed,
+        /* [in] */ Integer slotMask);
+
+private:
+    PerfectHashIndex() = delete;
+
+    static PerfectHashIndex* Build(
+        /* [in] */ const unsigned long long* keys,
+        /* [in] */ const Integer* heads,
+        /* [in] */ Integer keyNumber,
+        /* [in] */ const Integer* values,
+        /* [in] */ const Integer* next,
+        /* [in] */ Integer number);
+
+private:
+    static constexpr unsigned long long SEED_MULTIPLIER = 0x9e3779b97f4a7c15ull;
+
+    Integer mBucketMask;
+    Integer mSlotMask;
+    unsigned int* mSeeds;
+    unsigned long long* mSlotKeys;
+    Integer* mSlots;
+    Integer* mValues;
+    Integer* mNext;
+};
+
+Integer PerfectHashIndex::Find(
+    /* [in] */ unsigned long long key) const
+{
+    unsigned int seed = mSeeds[Mix(key) & mBucketMask];
+    Integer slot = GetSlot(key, seed, mSlotMask);
+    return mSlotKeys[slot] == key ? mSlots[slot] : -1;
+}
+
+Integer PerfectHashIndex::GetNext(
+    /* [in] */ Integer entry) const
+{
+    return mNext[entry];
+}
+
+Integer PerfectHashIndex::GetValue(
+    /* [in] */ Integer entry) const
+{
+    return mValues[entry];
+}
+
+unsigned long long PerfectHashIndex::Mix(
+    /* [in] */ unsigned long long key)
+{
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ull;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebull;
+    return key ^ (key >> 31);
+}
+
+Integer PerfectHashIndex::GetSlot(
+    /* [in] */ unsigned long long key,
+    /* [in] */ unsigned int seed,
+    /* [in] */ Integer slotMask)
+{
+    return Mix(key ^ (seed * SEED_MULTIPLIER)) & slotMask;
+}
+
+}
+
+#endif // __CCM_PERFECTHASH_H__
@@ -35,6 +35,7 @@ ECode ServiceManager::AddService(
 
     InterfacePack* ipack = new InterfacePack();
     ipack->mDBusName = object.mDBusName;
+    ipack->mDBusObjectPath = object.mDBusObjectPath;
     ipack->mCid = object.mCid;
     ipack->mIid = object.mIid;
 
@@ -127,6 +128,7 @@ DBusHandlerResult ServiceManager::HandleMessage(
         CoCreateParcel(RPCType::Local, &parcel);
         parcel->SetData(static_cast<Byte*>(data), size);
         parcel->ReadString(&ipack.mDBusName);
+        parcel->ReadString(&ipack.mDBusObjectPath);
         parcel->ReadCoclassID(&ipack.mCid);
         parcel->ReadInterfaceID(&ipack.mIid);
         ec = ServiceManager::GetInstance()->AddService(String(str), ipack);
@@ -175,6 +177,7 @@ DBusHandlerResult ServiceManager::HandleMessage(
             AutoPtr<IParcel> parcel;
             CoCreateParcel(RPCType::Local, &parcel);
             parcel->WriteString(ipack->mDBusName);
+            parcel->WriteString(ipack->mDBusObjectPath);
             parcel->WriteCoclassID(ipack->mCid);
             parcel->WriteInterfaceID(ipack->mIid);
             parcel->GetData(&resData);
@@ -33,6 +33,7 @@ public:
     struct InterfacePack
     {
         String mDBusName;
+        String mDBusObjectPath;
         CoclassID mCid;
         InterfaceID mIid;
     };
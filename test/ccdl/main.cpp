@@ -0,0 +1,210 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <string>
+#include <gtest/gtest.h>
+
+static const char* MODULE_HEAD =
+        "[\n"
+        "    uuid(606437f8-b362-4191-96fe-d76d7a2b5b13),\n"
+        "    url(\"http://ccm.org/component/test/ccdl/Demo.so\")\n"
+        "]\n"
+        "module Demo\n"
+        "{\n"
+        "namespace demo {\n";
+
+static const char* MODULE_TAIL =
+        "}\n"
+        "}\n";
+
+static const char* INTERFACE_ATTRIBUTES =
+        "    uuid(0f7baf85-5bd8-4702-b72e-3974d9cadff8),\n"
+        "    version(0.1.0)\n";
+
+// Runs ccdl, which is installed next to the test, on the files of a
+// scratch directory.
+class CcdlTest
+    : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        char dir[] = "/tmp/ccdltest.XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dir));
+        mDir = dir;
+
+        char path[PATH_MAX];
+        ssize_t len = readlink("/proc/self/exe", path, sizeof(path) - 1);
+        ASSERT_GT(len, 0);
+        path[len] = '\0';
+        *strrchr(path, '/') = '\0';
+        mBinDir = path;
+    }
+
+    void TearDown() override
+    {
+        std::string command = "rm -rf " + mDir;
+        system(command.c_str());
+    }
+
+    // Compiles a module holding |body| in namespace demo, returns the
+    // exit status of ccdl and puts what it printed in |output|.
+    int Compile(
+        /* [in] */ const std::string& body,
+        /* [out] */ std::string* output)
+    {
+        std::string cdl = mDir + "/Demo.cdl";
+        FILE* file = fopen(cdl.c_str(), "w");
+        if (file == nullptr) {
+            return -1;
+        }
+        fprintf(file, "%s%s%s", MODULE_HEAD, body.c_str(), MODULE_TAIL);
+        fclose(file);
+
+        // ccdl reads the metadata of ccmrt.so from RT_PATH.
+        std::string command = "RT_PATH=" + mBinDir + " " + mBinDir + "/ccdl -c -k -o " +
+                mDir + "/Demo.metadata " + cdl + " 2>&1";
+        FILE* pipe = popen(command.c_str(), "r");
+        if (pipe == nullptr) {
+            return -1;
+        }
+        output->clear();
+        char buffer[256];
+        size_t size;
+        while ((size = fread(buffer, 1, sizeof(buffer), pipe)) > 0) {
+            output->append(buffer, size);
+        }
+        int status = pclose(pipe);
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    }
+
+    bool HasMetadata()
+    {
+        struct stat st;
+        std::string path = mDir + "/Demo.metadata";
+        return stat(path.c_str(), &st) == 0 && st.st_size > 0;
+    }
+
+    static std::string Interface(
+        /* [in] */ const std::string& attributes,
+        /* [in] */ const std::string& methods)
+    {
+        return "[\n" + attributes + INTERFACE_ATTRIBUTES + "]\n"
+                "interface IDemo\n"
+                "{\n" + methods + "}\n";
+    }
+
+    std::string mDir;
+    std::string mBinDir;
+};
+
+TEST_F(CcdlTest, TestOnewayMethod)
+{
+    std::string output;
+    EXPECT_EQ(0, Compile(Interface("",
+            "    [oneway]\n"
+            "    Post(\n"
+            "        [in] Integer value,\n"
+            "        [in] Array<Byte> data);\n"
+            "\n"
+            "    [oneway]\n"
+            "    Ping();\n"
+            "\n"
+            "    Get(\n"
+            "        [out] Integer* value);\n"), &output)) << output;
+    EXPECT_TRUE(HasMetadata());
+}
+
+TEST_F(CcdlTest, TestOnewayMethodWithOutParameter)
+{
+    std::string output;
+    EXPECT_NE(0, Compile(Interface("",
+            "    [oneway]\n"
+            "    Post(\n"
+            "        [in] Integer value,\n"
+            "        [out] Integer* result);\n"), &output));
+    EXPECT_NE(std::string::npos,
+            output.find("The oneway method \"Post\" has out parameters.")) << output;
+    EXPECT_FALSE(HasMetadata());
+}
+
+TEST_F(CcdlTest, TestOnewayMethodWithCalleeParameter)
+{
+    std::string output;
+    EXPECT_NE(0, Compile(Interface("",
+            "    [oneway]\n"
+            "    Post(\n"
+            "        [out, callee] Array<Byte>* data);\n"), &output));
+    EXPECT_NE(std::string::npos,
+            output.find("The oneway method \"Post\" has out parameters.")) << output;
+}
+
+TEST_F(CcdlTest, TestOnewayMethodWithInOutParameter)
+{
+    std::string output;
+    EXPECT_NE(0, Compile(Interface("",
+            "    [oneway]\n"
+            "    Post(\n"
+            "        [in, out] Integer* value);\n"), &output));
+    EXPECT_NE(std::string::npos,
+            output.find("The oneway method \"Post\" has out parameters.")) << output;
+}
+
+TEST_F(CcdlTest, TestOnewayInterface)
+{
+    std::string output;
+    EXPECT_NE(0, Compile(Interface("    oneway,\n",
+            "    Ping();\n"), &output));
+    EXPECT_NE(std::string::npos,
+            output.find("Interface IDemo can not be oneway.")) << output;
+}
+
+TEST_F(CcdlTest, TestOnewayCoclass)
+{
+    std::string output;
+    EXPECT_NE(0, Compile(Interface("",
+            "    Ping();\n") +
+            "\n"
+            "[\n"
+            "    oneway,\n"
+            "    uuid(54358911-bbc4-49a1-bb80-e102ca2ebb00),\n"
+            "    version(0.1.0)\n"
+            "]\n"
+            "coclass CDemo\n"
+            "{\n"
+            "    interface IDemo;\n"
+            "}\n", &output));
+    EXPECT_NE(std::string::npos,
+            output.find("Coclass CDemo can not be oneway.")) << output;
+}
+
+TEST_F(CcdlTest, TestMethodWithOtherAttribute)
+{
+    std::string output;
+    EXPECT_NE(0, Compile(Interface("",
+            "    [version(0.1.0)]\n"
+            "    Ping();\n"), &output));
+    EXPECT_NE(std::string::npos,
+            output.find("The method \"Ping\" only accepts the oneway attribute.")) << output;
+}
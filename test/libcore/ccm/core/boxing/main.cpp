@@ -0,0 +1,113 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "ccm.core.IBoolean.h"
+#include "ccm.core.IChar.h"
+#include "ccm.core.IInteger.h"
+#include "ccm.core.ILong.h"
+#include <ccm/core/CoreUtils.h>
+#include <ccmautoptr.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+using namespace ccm;
+using ccm::core::CoreUtils;
+using ccm::core::IBoolean;
+using ccm::core::IChar;
+using ccm::core::IInteger;
+using ccm::core::ILong;
+
+// Every allocation made by libcore goes through these.
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t number, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+
+static Long sAllocations = 0;
+
+extern "C" void* malloc(size_t size)
+{
+    __atomic_add_fetch(&sAllocations, 1, __ATOMIC_RELAXED);
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t number, size_t size)
+{
+    __atomic_add_fetch(&sAllocations, 1, __ATOMIC_RELAXED);
+    return __libc_calloc(number, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size)
+{
+    __atomic_add_fetch(&sAllocations, 1, __ATOMIC_RELAXED);
+    return __libc_realloc(ptr, size);
+}
+
+static Long Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Long)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+static constexpr Integer ROUNDS = 200000;
+
+// Prints the allocations and the time one boxing takes, |func| is
+// given the round number to box.
+template<typename Func>
+static void Measure(
+    /* [in] */ const char* name,
+    /* [in] */ Func func)
+{
+    func(0);
+    Long allocations = __atomic_load_n(&sAllocations, __ATOMIC_RELAXED);
+    Long start = Now();
+    for (Integer i = 0; i < ROUNDS; i++) {
+        func(i);
+    }
+    Long nanos = Now() - start;
+    allocations = __atomic_load_n(&sAllocations, __ATOMIC_RELAXED) - allocations;
+    printf("%-40s %6.2f allocs/op %8.1f ns/op\n", name,
+            (double)allocations / ROUNDS, (double)nanos / ROUNDS);
+}
+
+int main(int argc, char** argv)
+{
+    if (CoreUtils::Box(100) != CoreUtils::Box(100) ||
+            CoreUtils::Box(true) != CoreUtils::Box(true) ||
+            CoreUtils::Box(100000) == CoreUtils::Box(100000)) {
+        printf("Box() does not share the cached objects.\n");
+        return 1;
+    }
+
+    Measure("Box(Boolean)", [](Integer i) {
+        AutoPtr<IBoolean> b = CoreUtils::Box((Boolean)(i & 1));
+    });
+    Measure("Box(Char) ASCII", [](Integer i) {
+        AutoPtr<IChar> c = CoreUtils::Box((Char)(i & 0x7f));
+    });
+    Measure("Box(Integer) -128..127", [](Integer i) {
+        AutoPtr<IInteger> v = CoreUtils::Box((Integer)(i & 0xff) - 128);
+    });
+    Measure("Box(Integer) large", [](Integer i) {
+        AutoPtr<IInteger> v = CoreUtils::Box(i + 1000);
+    });
+    Measure("Box(Long) -128..127", [](Integer i) {
+        AutoPtr<ILong> v = CoreUtils::Box((Long)(i & 0xff) - 128);
+    });
+    return 0;
+}
@@ -0,0 +1,114 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "ccm.core.IBoolean.h"
+#include "ccm.core.IChar.h"
+#include "ccm.core.IInteger.h"
+#include "ccm.core.ILong.h"
+#include <ccm/core/CoreUtils.h>
+#include <ccmautoptr.h>
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+using namespace ccm;
+using ccm::core::CoreUtils;
+using ccm::core::IBoolean;
+using ccm::core::IChar;
+using ccm::core::IInteger;
+using ccm::core::ILong;
+
+// What the class loader calls before it checks whether libcore can be
+// unloaded.
+EXTERN_C void soReleaseCaches();
+
+TEST(BoxingCacheTest, TestCachedValuesAreShared)
+{
+    EXPECT_EQ(CoreUtils::Box(true), CoreUtils::Box(true));
+    EXPECT_NE(CoreUtils::Box(true), CoreUtils::Box(false));
+    EXPECT_EQ(CoreUtils::Box((Char)'a'), CoreUtils::Box((Char)'a'));
+    EXPECT_EQ(CoreUtils::Box(-128), CoreUtils::Box(-128));
+    EXPECT_EQ(CoreUtils::Box(127), CoreUtils::Box(127));
+    EXPECT_NE(CoreUtils::Box(128), CoreUtils::Box(128));
+    EXPECT_EQ(CoreUtils::Box((Long)-1), CoreUtils::Box((Long)-1));
+    EXPECT_NE(CoreUtils::Box((Long)1000), CoreUtils::Box((Long)1000));
+}
+
+TEST(BoxingCacheTest, TestReleaseCaches)
+{
+    AutoPtr<IInteger> i = CoreUtils::Box(5);
+    AutoPtr<ILong> l = CoreUtils::Box((Long)5);
+    AutoPtr<IChar> c = CoreUtils::Box((Char)'5');
+    AutoPtr<IBoolean> b = CoreUtils::Box(true);
+    soReleaseCaches();
+
+    // The objects handed out before stay valid, and the caches fill
+    // again with new ones.
+    Integer iv;
+    i->GetValue(&iv);
+    EXPECT_EQ(5, iv);
+    AutoPtr<IInteger> i2 = CoreUtils::Box(5);
+    EXPECT_NE(i, i2);
+    EXPECT_EQ(i2, CoreUtils::Box(5));
+    AutoPtr<ILong> l2 = CoreUtils::Box((Long)5);
+    EXPECT_NE(l, l2);
+    EXPECT_EQ(l2, CoreUtils::Box((Long)5));
+    AutoPtr<IChar> c2 = CoreUtils::Box((Char)'5');
+    EXPECT_NE(c, c2);
+    EXPECT_EQ(c2, CoreUtils::Box((Char)'5'));
+    AutoPtr<IBoolean> b2 = CoreUtils::Box(true);
+    EXPECT_NE(b, b2);
+    EXPECT_EQ(b2, CoreUtils::Box(true));
+}
+
+static constexpr Integer ROUNDS = 1000000;
+
+static Integer sRunningThreads = 0;
+
+static void* BoxValues(
+    /* [in] */ void* arg)
+{
+    Boolean* failed = (Boolean*)arg;
+    for (Integer i = 0; i < ROUNDS; i++) {
+        Integer value = (i & 0xff) - 128;
+        AutoPtr<IInteger> obj = CoreUtils::Box(value);
+        Integer v;
+        obj->GetValue(&v);
+        if (v != value) {
+            *failed = true;
+        }
+    }
+    __atomic_sub_fetch(&sRunningThreads, 1, __ATOMIC_RELEASE);
+    return nullptr;
+}
+
+TEST(BoxingCacheTest, TestReleaseCachesWhileBoxing)
+{
+    constexpr Integer N = 4;
+    pthread_t threads[N];
+    Boolean failed[N] = { false };
+    sRunningThreads = N;
+    for (Integer i = 0; i < N; i++) {
+        ASSERT_EQ(0, pthread_create(&threads[i], nullptr, BoxValues, &failed[i]));
+    }
+    while (__atomic_load_n(&sRunningThreads, __ATOMIC_ACQUIRE) > 0) {
+        soReleaseCaches();
+    }
+    for (Integer i = 0; i < N; i++) {
+        pthread_join(threads[i], nullptr);
+        EXPECT_FALSE(failed[i]);
+    }
+}
@@ -120,6 +120,41 @@ TEST(StringTest, ToUpperCaseTest)
     EXPECT_STREQ("HELLOWORLD:)", String("HellOWoRlD:)").ToUpperCase().string());
 }
 
+TEST(StringTest, HashCodeTest)
+{
+    String first("ccm::core::CInteger");
+    String second("ccm::core::CInteger");
+    EXPECT_NE(first.string(), second.string());
+    EXPECT_EQ(first.GetHashCode(), second.GetHashCode());
+    EXPECT_EQ(first.GetHashCode(), first.GetHashCode());
+    EXPECT_EQ(String("HELLO").GetHashCode(), String("hello").ToUpperCase().GetHashCode());
+    EXPECT_NE(String("hello").GetHashCode(), String("hellp").GetHashCode());
+}
+
+TEST(StringTest, InternTest)
+{
+    String first = String("ccm::util::Locale").Intern();
+    String second = String::Intern("ccm::util::Locale");
+    EXPECT_STREQ("ccm::util::Locale", first.string());
+    EXPECT_EQ(first.string(), second.string());
+    EXPECT_EQ(first.string(), first.Intern().string());
+    EXPECT_NE(first.string(), String::Intern("ccm::util::Locales").string());
+    EXPECT_TRUE(String().Intern().IsNull());
+}
+
+TEST(StringTest, OneCharSharingTest)
+{
+    String first("x");
+    String second("x");
+    EXPECT_EQ(first.string(), second.string());
+    EXPECT_EQ(first.string(), String::ValueOf('x').string());
+    EXPECT_NE(first.string(), String("y").string());
+    EXPECT_EQ(1, first.GetLength());
+    first += "y";
+    EXPECT_STREQ("xy", first.string());
+    EXPECT_STREQ("x", second.string());
+}
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,418 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "RefCountTestUnit.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+using namespace ccm;
+using ccm::test::refcount::CCounter;
+using ccm::test::refcount::ICounter;
+using ccm::test::refcount::IID_ICounter;
+
+// The layout ComponentIndex writes, see componentindex.cpp.
+static constexpr Integer INDEX_MAGIC = 0x49434343;
+static constexpr Integer INDEX_VERSION = 1;
+static constexpr Integer MAX_ITEMS = 8;
+
+struct IndexFile
+{
+    Integer mDirectoryNumber;
+    String mDirectories[MAX_ITEMS];
+    Long mDirectoryMtimes[MAX_ITEMS];
+    Integer mEntryNumber;
+    Uuid mUuids[MAX_ITEMS];
+    Long mMtimes[MAX_ITEMS];
+    Long mSizes[MAX_ITEMS];
+    Long mMetadataOffsets[MAX_ITEMS];
+    String mPaths[MAX_ITEMS];
+};
+
+static Boolean Read(
+    /* [in] */ FILE* fp,
+    /* [out] */ void* value,
+    /* [in] */ size_t size)
+{
+    return fread(value, 1, size, fp) == size;
+}
+
+static Boolean ReadString(
+    /* [in] */ FILE* fp,
+    /* [out] */ String* string)
+{
+    Integer length;
+    if (!Read(fp, &length, sizeof(Integer)) || length < 0 || length > 4096) {
+        return false;
+    }
+    char buffer[4097];
+    if (!Read(fp, buffer, length)) {
+        return false;
+    }
+    buffer[length] = '\0';
+    *string = buffer;
+    return true;
+}
+
+// Returns whether |path| holds a whole, well-formed index.
+static Boolean ReadIndex(
+    /* [in] */ const String& path,
+    /* [out] */ IndexFile* index)
+{
+    FILE* fp = fopen(path.string(), "rb");
+    if (fp == nullptr) {
+        return false;
+    }
+    Integer header[4];
+    Boolean ok = Read(fp, header, sizeof(header)) &&
+            header[0] == INDEX_MAGIC && header[1] == INDEX_VERSION &&
+            header[2] >= 0 && header[2] <= MAX_ITEMS &&
+            header[3] >= 0 && header[3] <= MAX_ITEMS;
+    if (ok) {
+        index->mDirectoryNumber = header[2];
+        index->mEntryNumber = header[3];
+    }
+    for (Integer i = 0; ok && i < index->mDirectoryNumber; i++) {
+        ok = ReadString(fp, &index->mDirectories[i]) &&
+                Read(fp, &index->mDirectoryMtimes[i], sizeof(Long));
+    }
+    for (Integer i = 0; ok && i < index->mEntryNumber; i++) {
+        ok = Read(fp, &index->mUuids[i], sizeof(Uuid)) &&
+                Read(fp, &index->mMtimes[i], sizeof(Long)) &&
+                Read(fp, &index->mSizes[i], sizeof(Long)) &&
+                Read(fp, &index->mMetadataOffsets[i], sizeof(Long)) &&
+                ReadString(fp, &index->mPaths[i]);
+    }
+    Byte extra;
+    ok = ok && fread(&extra, 1, 1, fp) == 0;
+    fclose(fp);
+    return ok;
+}
+
+static void WriteString(
+    /* [in] */ FILE* fp,
+    /* [in] */ const String& string)
+{
+    Integer length = string.GetByteLength();
+    fwrite(&length, sizeof(Integer), 1, fp);
+    fwrite(string.string(), 1, length, fp);
+}
+
+static void WriteIndex(
+    /* [in] */ const String& path,
+    /* [in] */ const IndexFile& index)
+{
+    FILE* fp = fopen(path.string(), "wb");
+    ASSERT_NE(nullptr, fp);
+    Integer header[] = { INDEX_MAGIC, INDEX_VERSION,
+            index.mDirectoryNumber, index.mEntryNumber };
+    fwrite(header, sizeof(header), 1, fp);
+    for (Integer i = 0; i < index.mDirectoryNumber; i++) {
+        WriteString(fp, index.mDirectories[i]);
+        fwrite(&index.mDirectoryMtimes[i], sizeof(Long), 1, fp);
+    }
+    for (Integer i = 0; i < index.mEntryNumber; i++) {
+        fwrite(&index.mUuids[i], sizeof(Uuid), 1, fp);
+        fwrite(&index.mMtimes[i], sizeof(Long), 1, fp);
+        fwrite(&index.mSizes[i], sizeof(Long), 1, fp);
+        fwrite(&index.mMetadataOffsets[i], sizeof(Long), 1, fp);
+        WriteString(fp, index.mPaths[i]);
+    }
+    fclose(fp);
+}
+
+static Long GetMtime(
+    /* [in] */ const String& path)
+{
+    struct stat st;
+    if (stat(path.string(), &st) == -1) {
+        return -1;
+    }
+    return (Long)st.st_mtim.tv_sec * 1000000000ll + st.st_mtim.tv_nsec;
+}
+
+static Long GetSize(
+    /* [in] */ const String& path)
+{
+    struct stat st;
+    return stat(path.string(), &st) == -1 ? -1 : st.st_size;
+}
+
+// The class loader looks for components in the working directory, so
+// this runs from the bin directory.
+static String GetComponentPath()
+{
+    char* cwd = getcwd(nullptr, 0);
+    String path = String(cwd) + "/RefCountTestUnit.so";
+    free(cwd);
+    return path;
+}
+
+static String GetMappedComponent()
+{
+    FILE* fp = fopen("/proc/self/maps", "r");
+    if (fp == nullptr) {
+        return String();
+    }
+    String mapped;
+    char line[1024];
+    while (mapped.IsNull() && fgets(line, sizeof(line), fp) != nullptr) {
+        char* path = strchr(line, '/');
+        if (path != nullptr && strstr(path, "/RefCountTestUnit.so") != nullptr) {
+            path[strcspn(path, "\n")] = '\0';
+            mapped = path;
+        }
+    }
+    fclose(fp);
+    return mapped;
+}
+
+// Creates a CCounter in a new process, which loads the index afresh.
+// Returns the pid; the child exits with 0 when the component was
+// mapped from |expected|, 2 when from elsewhere and 1 on failure.
+static pid_t StartChild(
+    /* [in] */ const String& indexFile,
+    /* [in] */ const String& expected)
+{
+    pid_t pid = fork();
+    if (pid != 0) {
+        return pid;
+    }
+    if (indexFile.IsNull()) {
+        unsetenv("CCM_COMPONENT_INDEX");
+    }
+    else {
+        setenv("CCM_COMPONENT_INDEX", indexFile.string(), 1);
+    }
+    AutoPtr<ICounter> counter;
+    if (FAILED(CCounter::New(IID_ICounter, (IInterface**)&counter))) {
+        _exit(1);
+    }
+    _exit(GetMappedComponent().Equals(expected) ? 0 : 2);
+}
+
+static int WaitChild(
+    /* [in] */ pid_t pid)
+{
+    int status;
+    if (pid == -1 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status)) {
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+
+static int RunChild(
+    /* [in] */ const String& indexFile,
+    /* [in] */ const String& expected)
+{
+    return WaitChild(StartChild(indexFile, expected));
+}
+
+static void CopyFile(
+    /* [in] */ const String& from,
+    /* [in] */ const String& to)
+{
+    int in = open(from.string(), O_RDONLY);
+    int out = open(to.string(), O_WRONLY | O_CREAT | O_TRUNC, 0755);
+    ASSERT_NE(-1, in);
+    ASSERT_NE(-1, out);
+    char buffer[8192];
+    ssize_t n;
+    while ((n = read(in, buffer, sizeof(buffer))) > 0) {
+        ASSERT_EQ(n, write(out, buffer, n));
+    }
+    close(in);
+    close(out);
+}
+
+static int RemoveFile(
+    /* [in] */ const char* path,
+    /* [in] */ const struct stat* st,
+    /* [in] */ int flag,
+    /* [in] */ struct FTW* ftw)
+{
+    return remove(path);
+}
+
+// Every test has a directory of its own for the index and its copies.
+class ComponentIndexTest
+    : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        char dir[] = "/tmp/ccmindexXXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dir));
+        mDir = dir;
+    }
+
+    void TearDown() override
+    {
+        if (!mDir.IsNull()) {
+            nftw(mDir.string(), RemoveFile, 16, FTW_DEPTH | FTW_PHYS);
+        }
+    }
+
+    String mDir;
+};
+
+TEST_F(ComponentIndexTest, TestNoIndexFileByDefault)
+{
+    String xdg = mDir + "/xdg";
+    setenv("HOME", mDir.string(), 1);
+    setenv("XDG_CACHE_HOME", xdg.string(), 1);
+    EXPECT_EQ(0, RunChild(String(), GetComponentPath()));
+    EXPECT_NE(0, access((mDir + "/.cache").string(), F_OK));
+    EXPECT_NE(0, access(xdg.string(), F_OK));
+}
+
+TEST_F(ComponentIndexTest, TestWriteAndParse)
+{
+    String indexFile = mDir + "/ccm/componentindex";
+    EXPECT_EQ(0, RunChild(indexFile, GetComponentPath()));
+
+    IndexFile index;
+    ASSERT_TRUE(ReadIndex(indexFile, &index));
+    char* cwd = getcwd(nullptr, 0);
+    ASSERT_EQ(1, index.mDirectoryNumber);
+    EXPECT_STREQ(cwd, index.mDirectories[0].string());
+    EXPECT_EQ(GetMtime(String(cwd)), index.mDirectoryMtimes[0]);
+    free(cwd);
+    ASSERT_EQ(1, index.mEntryNumber);
+    EXPECT_STREQ(GetComponentPath().string(), index.mPaths[0].string());
+    EXPECT_EQ(GetMtime(GetComponentPath()), index.mMtimes[0]);
+    EXPECT_EQ(GetSize(GetComponentPath()), index.mSizes[0]);
+    EXPECT_GT(index.mMetadataOffsets[0], 0);
+
+    // A second process finds it there and leaves the file as it is.
+    Long mtime = GetMtime(indexFile);
+    EXPECT_EQ(0, RunChild(indexFile, GetComponentPath()));
+    EXPECT_EQ(mtime, GetMtime(indexFile));
+}
+
+TEST_F(ComponentIndexTest, TestIndexedPathUsed)
+{
+    String indexFile = mDir + "/componentindex";
+    ASSERT_EQ(0, RunChild(indexFile, GetComponentPath()));
+    IndexFile index;
+    ASSERT_TRUE(ReadIndex(indexFile, &index));
+
+    // Only a component found through the index can come from |copy|,
+    // as it is not in the component path.
+    String copy = mDir + "/RefCountTestUnit.so";
+    CopyFile(GetComponentPath(), copy);
+    index.mPaths[0] = copy;
+    index.mMtimes[0] = GetMtime(copy);
+    index.mSizes[0] = GetSize(copy);
+    WriteIndex(indexFile, index);
+    EXPECT_EQ(0, RunChild(indexFile, copy));
+}
+
+TEST_F(ComponentIndexTest, TestStaleEntry)
+{
+    String indexFile = mDir + "/componentindex";
+    ASSERT_EQ(0, RunChild(indexFile, GetComponentPath()));
+    IndexFile index;
+    ASSERT_TRUE(ReadIndex(indexFile, &index));
+    String copy = mDir + "/RefCountTestUnit.so";
+    CopyFile(GetComponentPath(), copy);
+    index.mPaths[0] = copy;
+    index.mSizes[0] = GetSize(copy);
+
+    // The copy changed since it was indexed.
+    index.mMtimes[0] = GetMtime(copy) - 1;
+    WriteIndex(indexFile, index);
+    EXPECT_EQ(0, RunChild(indexFile, GetComponentPath()));
+    IndexFile rewritten;
+    ASSERT_TRUE(ReadIndex(indexFile, &rewritten));
+    ASSERT_EQ(1, rewritten.mEntryNumber);
+    EXPECT_STREQ(GetComponentPath().string(), rewritten.mPaths[0].string());
+
+    // A directory of the component path changed, which drops the file.
+    index.mMtimes[0] = GetMtime(copy);
+    index.mDirectoryMtimes[0]--;
+    WriteIndex(indexFile, index);
+    EXPECT_EQ(0, RunChild(indexFile, GetComponentPath()));
+}
+
+TEST_F(ComponentIndexTest, TestBadFile)
+{
+    String indexFile = mDir + "/componentindex";
+    ASSERT_EQ(0, RunChild(indexFile, GetComponentPath()));
+    IndexFile index;
+    ASSERT_TRUE(ReadIndex(indexFile, &index));
+    String copy = mDir + "/RefCountTestUnit.so";
+    CopyFile(GetComponentPath(), copy);
+    index.mPaths[0] = copy;
+    index.mMtimes[0] = GetMtime(copy);
+    index.mSizes[0] = GetSize(copy);
+    WriteIndex(indexFile, index);
+
+    // Cut inside the entry, so none of the file may be trusted.
+    ASSERT_EQ(0, truncate(indexFile.string(), GetSize(indexFile) - 4));
+    EXPECT_EQ(0, RunChild(indexFile, GetComponentPath()));
+    ASSERT_TRUE(ReadIndex(indexFile, &index));
+    EXPECT_STREQ(GetComponentPath().string(), index.mPaths[0].string());
+
+    FILE* fp = fopen(indexFile.string(), "wb");
+    ASSERT_NE(nullptr, fp);
+    fputs("not an index", fp);
+    fclose(fp);
+    EXPECT_EQ(0, RunChild(indexFile, GetComponentPath()));
+    EXPECT_TRUE(ReadIndex(indexFile, &index));
+}
+
+TEST_F(ComponentIndexTest, TestConcurrentRewrite)
+{
+    String indexFile = mDir + "/componentindex";
+
+    // None of them finds an entry, so all of them write the file.
+    static constexpr Integer CHILD_NUMBER = 16;
+    pid_t pids[CHILD_NUMBER];
+    for (Integer i = 0; i < CHILD_NUMBER; i++) {
+        pids[i] = StartChild(indexFile, GetComponentPath());
+    }
+    for (Integer i = 0; i < CHILD_NUMBER; i++) {
+        EXPECT_EQ(0, WaitChild(pids[i]));
+    }
+
+    IndexFile index;
+    ASSERT_TRUE(ReadIndex(indexFile, &index));
+    ASSERT_EQ(1, index.mEntryNumber);
+    EXPECT_STREQ(GetComponentPath().string(), index.mPaths[0].string());
+
+    // No temporary file is left behind.
+    Integer fileNumber = 0;
+    DIR* d = opendir(mDir.string());
+    ASSERT_NE(nullptr, d);
+    struct dirent* entry;
+    while ((entry = readdir(d)) != nullptr) {
+        if (entry->d_name[0] != '.') {
+            fileNumber++;
+        }
+    }
+    closedir(d);
+    EXPECT_EQ(1, fileNumber);
+}
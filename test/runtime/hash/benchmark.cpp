@@ -0,0 +1,188 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include <ccmtypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+using namespace ccm;
+
+struct KeySet
+{
+    const char* mName;
+    String* mKeys;
+    Integer mNumber;
+};
+
+static Long Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Long)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+// The BKDR hash String used before, kept as the reference.
+static Integer HashBKDR(
+    /* [in] */ const char* string)
+{
+    unsigned int hash = 0;
+    for ( ; *string; ++string) {
+        hash = hash * 31 + (*string);
+    }
+    return (hash & 0x7FFFFFFF);
+}
+
+static KeySet MakeKeySet(
+    /* [in] */ const char* name,
+    /* [in] */ Integer number,
+    /* [in] */ void (*format)(char* buffer, Integer i))
+{
+    KeySet set;
+    set.mName = name;
+    set.mKeys = new String[number];
+    set.mNumber = number;
+    char buffer[256];
+    for (Integer i = 0; i < number; i++) {
+        format(buffer, i);
+        set.mKeys[i] = buffer;
+    }
+    return set;
+}
+
+static void FormatIdentifier(char* buffer, Integer i)
+{
+    static const char* const WORDS[] = { "Get", "Set", "Value", "Name", "Count",
+            "Index", "Char", "Byte", "Array", "List", "Map", "Hash", "Key" };
+    snprintf(buffer, 256, "ccm::core::C%s%s%s%d", WORDS[i % 13],
+            WORDS[(i / 13) % 13], WORDS[(i / 169) % 13], i / 2197);
+}
+
+static void FormatNumber(char* buffer, Integer i)
+{
+    snprintf(buffer, 256, "%d", i);
+}
+
+static void FormatPath(char* buffer, Integer i)
+{
+    snprintf(buffer, 256, "/system/lib/ccm/components/module%d/lib%c%c%d.so",
+            i / 1000, 'a' + i % 26, 'a' + (i / 26) % 26, i % 1000);
+}
+
+static void FormatLocale(char* buffer, Integer i)
+{
+    static const char* const LANGUAGES[] = { "en", "zh", "fr", "de", "ja", "es", "ru", "ar" };
+    static const char* const REGIONS[] = { "US", "CN", "FR", "DE", "JP", "ES", "RU", "EG", "GB", "TW" };
+    snprintf(buffer, 256, "%s_%s_%c%c%c", LANGUAGES[i % 8], REGIONS[(i / 8) % 10],
+            'A' + (i / 80) % 26, 'a' + (i / 2080) % 26, 'a' + (i / 54080) % 26);
+}
+
+static int CompareIntegers(const void* a, const void* b)
+{
+    Integer x = *(const Integer*)a, y = *(const Integer*)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// Prints how many keys share a full hash, and the chains they form in a
+// table of 2^k buckets, as a chained hash map would index it.
+static void Distribution(
+    /* [in] */ const char* hashName,
+    /* [in] */ const KeySet& set,
+    /* [in] */ Integer* hashes)
+{
+    Integer* sorted = (Integer*)malloc(sizeof(Integer) * set.mNumber);
+    memcpy(sorted, hashes, sizeof(Integer) * set.mNumber);
+    qsort(sorted, set.mNumber, sizeof(Integer), CompareIntegers);
+    Integer collisions = 0;
+    for (Integer i = 1; i < set.mNumber; i++) {
+        if (sorted[i] == sorted[i - 1]) collisions++;
+    }
+    free(sorted);
+
+    Integer bucketNumber = 1;
+    while (bucketNumber < set.mNumber) bucketNumber <<= 1;
+    Integer* chains = (Integer*)calloc(bucketNumber, sizeof(Integer));
+    for (Integer i = 0; i < set.mNumber; i++) {
+        chains[hashes[i] & (bucketNumber - 1)]++;
+    }
+    Integer maxChain = 0, used = 0;
+    for (Integer i = 0; i < bucketNumber; i++) {
+        if (chains[i] > maxChain) maxChain = chains[i];
+        if (chains[i] > 0) used++;
+    }
+    free(chains);
+
+    printf("%-6s %-10s %7d keys %6d collisions %7d buckets %5.1f%% used "
+            "max chain %3d avg chain %.2f\n", hashName, set.mName, set.mNumber,
+            collisions, bucketNumber, 100.0 * used / bucketNumber, maxChain,
+            (double)set.mNumber / used);
+}
+
+int main(int argc, char** argv)
+{
+    static const Integer KEY_NUMBER = 100000;
+    KeySet sets[] = {
+        MakeKeySet("identifier", KEY_NUMBER, FormatIdentifier),
+        MakeKeySet("number", KEY_NUMBER, FormatNumber),
+        MakeKeySet("path", KEY_NUMBER, FormatPath),
+        MakeKeySet("locale", KEY_NUMBER, FormatLocale),
+    };
+
+    Integer* hashes = (Integer*)malloc(sizeof(Integer) * KEY_NUMBER);
+    for (const KeySet& set : sets) {
+        for (Integer i = 0; i < set.mNumber; i++) {
+            hashes[i] = HashBKDR(set.mKeys[i].string());
+        }
+        Distribution("bkdr", set, hashes);
+
+        Long start = Now();
+        for (Integer i = 0; i < set.mNumber; i++) {
+            hashes[i] = set.mKeys[i].GetHashCode();
+        }
+        Long coldNanos = Now() - start;
+        Distribution("string", set, hashes);
+
+        Long sink = 0;
+        start = Now();
+        for (Integer round = 0; round < 10; round++) {
+            for (Integer i = 0; i < set.mNumber; i++) {
+                sink += set.mKeys[i].GetHashCode();
+            }
+        }
+        Long cachedNanos = Now() - start;
+
+        start = Now();
+        for (Integer round = 0; round < 10; round++) {
+            for (Integer i = 0; i < set.mNumber; i++) {
+                sink += HashBKDR(set.mKeys[i].string());
+            }
+        }
+        Long bkdrNanos = Now() - start;
+
+        printf("%-10s bkdr %6.1f ns/key  first hash %6.1f ns/key  cached %6.1f ns/key  (%lld)\n\n",
+                set.mName, (double)bkdrNanos / (10 * set.mNumber),
+                (double)coldNanos / set.mNumber,
+                (double)cachedNanos / (10 * set.mNumber), sink);
+    }
+
+    free(hashes);
+    for (const KeySet& set : sets) {
+        delete[] set.mKeys;
+    }
+    return 0;
+}
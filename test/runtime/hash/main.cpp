@@ -0,0 +1,97 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include <ccmtypes.h>
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace ccm;
+
+static int CompareIntegers(const void* a, const void* b)
+{
+    Integer x = *(const Integer*)a, y = *(const Integer*)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+TEST(StringHashTest, EqualStringsTest)
+{
+    // Equal strings in different buffers, of every length across the
+    // 8 and 48 byte blocks, hash the same.
+    char buffer[160];
+    for (Integer length = 0; length < (Integer)sizeof(buffer); length++) {
+        for (Integer i = 0; i < length; i++) {
+            buffer[i] = 'a' + (i * 7 + length) % 26;
+        }
+        buffer[length] = '\0';
+        String first(buffer);
+        String second(buffer);
+        EXPECT_EQ(first.GetHashCode(), second.GetHashCode());
+        EXPECT_GE(first.GetHashCode(), 0);
+    }
+}
+
+TEST(StringHashTest, CachedHashTest)
+{
+    String string("ccm::core::CInteger");
+    Integer hash = string.GetHashCode();
+    EXPECT_EQ(hash, string.GetHashCode());
+    String copy = string;
+    EXPECT_EQ(hash, copy.GetHashCode());
+    EXPECT_EQ(0, String().GetHashCode());
+}
+
+TEST(StringHashTest, EditDropsHashTest)
+{
+    String string("ccm::core::");
+    string += "CLong";
+    Integer hash = string.GetHashCode();
+    string += "Test";
+    EXPECT_EQ(String("ccm::core::CLongTest").GetHashCode(), string.GetHashCode());
+    EXPECT_NE(hash, string.GetHashCode());
+}
+
+TEST(StringHashTest, DistributionTest)
+{
+    // Close identifiers, as a map keyed by names sees them, should
+    // neither collide nor crowd the buckets of a power of two table.
+    static constexpr Integer KEY_NUMBER = 100000;
+    static constexpr Integer BUCKET_NUMBER = 131072;
+    Integer* hashes = (Integer*)malloc(sizeof(Integer) * KEY_NUMBER);
+    Integer* chains = (Integer*)calloc(BUCKET_NUMBER, sizeof(Integer));
+    char buffer[64];
+    for (Integer i = 0; i < KEY_NUMBER; i++) {
+        snprintf(buffer, sizeof(buffer), "ccm::core::CKey%d", i);
+        hashes[i] = String(buffer).GetHashCode();
+        chains[hashes[i] & (BUCKET_NUMBER - 1)]++;
+    }
+
+    qsort(hashes, KEY_NUMBER, sizeof(Integer), CompareIntegers);
+    Integer collisions = 0;
+    for (Integer i = 1; i < KEY_NUMBER; i++) {
+        if (hashes[i] == hashes[i - 1]) collisions++;
+    }
+    Integer maxChain = 0;
+    for (Integer i = 0; i < BUCKET_NUMBER; i++) {
+        if (chains[i] > maxChain) maxChain = chains[i];
+    }
+    // A random 31-bit hash gives about 2 collisions and chains of 8.
+    EXPECT_LE(collisions, 16);
+    EXPECT_LE(maxChain, 12);
+
+    free(hashes);
+    free(chains);
+}
@@ -0,0 +1,96 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "NewObjectTestUnit.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmobject.h>
+
+#include <stdio.h>
+#include <time.h>
+
+using namespace ccm;
+using ccm::test::newobject::CValue;
+using ccm::test::newobject::CValueFactory;
+using ccm::test::newobject::IValue;
+using ccm::test::newobject::IValueFactory;
+using ccm::test::newobject::IID_IValue;
+using ccm::test::newobject::IID_IValueFactory;
+
+static Long Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Long)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+static constexpr Integer ROUNDS = 1000000;
+
+// Every object is released before the next one is made, like a boxed
+// value which is only passed along.
+static Long NewFromClient()
+{
+    Long start = Now();
+    for (Integer i = 0; i < ROUNDS; i++) {
+        AutoPtr<IValue> value;
+        CValue::New(i, IID_IValue, (IInterface**)&value);
+    }
+    return Now() - start;
+}
+
+static Long NewInComponent(
+    /* [in] */ IValueFactory* factory)
+{
+    Long start = Now();
+    for (Integer i = 0; i < ROUNDS; i++) {
+        AutoPtr<IValue> value;
+        factory->Create(i, &value);
+    }
+    return Now() - start;
+}
+
+static Boolean Verify(
+    /* [in] */ IValueFactory* factory)
+{
+    AutoPtr<IValue> value;
+    factory->Create(42, &value);
+    if (value == nullptr) return false;
+    Integer v;
+    value->GetValue(&v);
+    String name = Object::GetCoclassName(value);
+    return v == 42 && name.Equals("CValue");
+}
+
+int main(int argc, char** argv)
+{
+    AutoPtr<IValueFactory> factory;
+    CValueFactory::New(IID_IValueFactory, (IInterface**)&factory);
+    if (factory == nullptr || !Verify(factory)) {
+        printf("CValueFactory does not work.\n");
+        return 1;
+    }
+
+    // Warm up the loader, the class objects and the allocator.
+    NewFromClient();
+    NewInComponent(factory);
+
+    printf("%-40s %8.1f ns/object\n", "CValue::New() from the client",
+            (double)NewFromClient() / ROUNDS);
+    printf("%-40s %8.1f ns/object\n", "CValue::New() in the component",
+            (double)NewInComponent(factory) / ROUNDS);
+    return 0;
+}
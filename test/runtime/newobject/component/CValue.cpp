@@ -0,0 +1,44 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "CValue.h"
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+CCM_INTERFACE_IMPL_1(CValue, Object, IValue);
+
+ECode CValue::Constructor(
+    /* [in] */ Integer value)
+{
+    mValue = value;
+    return NOERROR;
+}
+
+ECode CValue::GetValue(
+    /* [out] */ Integer* value)
+{
+    VALIDATE_NOT_NULL(value);
+
+    *value = mValue;
+    return NOERROR;
+}
+
+}
+}
+}
@@ -0,0 +1,48 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#ifndef __CCM_TEST_NEWOBJECT_CVALUEFACTORY_H__
+#define __CCM_TEST_NEWOBJECT_CVALUEFACTORY_H__
+
+#include <ccmapi.h>
+#include <ccmobject.h>
+#include "ccm.test.newobject.IValueFactory.h"
+#include "_ccm_test_newobject_CValueFactory.h"
+
+namespace ccm {
+namespace test {
+namespace newobject {
+
+// Creates CValue objects from inside the component, the way
+// CoreUtils::Box() creates CInteger objects in libcore.
+Coclass(CValueFactory)
+    , public Object
+    , public IValueFactory
+{
+public:
+    CCM_INTERFACE_DECL();
+
+    ECode Create(
+        /* [in] */ Integer value,
+        /* [out] */ IValue** object) override;
+};
+
+}
+}
+}
+
+#endif // __CCM_TEST_NEWOBJECT_CVALUEFACTORY_H__
@@ -0,0 +1,40 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CProbe.h"
+
+namespace ccm {
+
+extern const InterfaceID IID_IProbeA =
+        {{0x3f1c2a01, 0x4b1e, 0x4a0d, 0x9c11, {0x0e, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b}}, nullptr};
+extern const InterfaceID IID_IProbeB =
+        {{0x3f1c2a01, 0x4b1e, 0x4a0d, 0x9c11, {0x0e, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0c}}, nullptr};
+extern const InterfaceID IID_IProbeC =
+        {{0x8d77e6b2, 0x1a20, 0x43f5, 0xa2b4, {0x0f, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b}}, nullptr};
+extern const InterfaceID IID_IProbeD =
+        {{0x51b0c6e3, 0x77d1, 0x4c02, 0x8e0f, {0x10, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b}}, nullptr};
+extern const InterfaceID IID_IProbeMissing =
+        {{0x3f1c2a01, 0x4b1e, 0x4a0d, 0x9c11, {0x0e, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0d}}, nullptr};
+
+CCM_INTERFACE_IMPL_1(CProbe1, Object, IProbeA);
+
+CCM_INTERFACE_IMPL_1(CProbe2, CProbe1, IProbeB);
+
+CCM_INTERFACE_IMPL_1(CProbe3, CProbe2, IProbeC);
+
+CCM_INTERFACE_IMPL_1(CProbe4, CProbe3, IProbeD);
+
+}
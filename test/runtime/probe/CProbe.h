@@ -0,0 +1,86 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEST_CPROBE_H__
+#define __CCM_TEST_CPROBE_H__
+
+#include <ccmobject.h>
+
+namespace ccm {
+
+extern const InterfaceID IID_IProbeA;
+extern const InterfaceID IID_IProbeB;
+extern const InterfaceID IID_IProbeC;
+extern const InterfaceID IID_IProbeD;
+extern const InterfaceID IID_IProbeMissing;
+
+// IProbeA and IProbeB share all but their last byte, the worst case for
+// telling IIDs apart.
+#define PROBE_INTERFACE(Name)                               \
+    interface Name : public IInterface                      \
+    {                                                       \
+        virtual ECode Name##Method() = 0;                   \
+    };
+
+PROBE_INTERFACE(IProbeA)
+PROBE_INTERFACE(IProbeB)
+PROBE_INTERFACE(IProbeC)
+PROBE_INTERFACE(IProbeD)
+
+// CProbeN implements N interfaces, one more at each depth.
+class CProbe1
+    : public Object
+    , public IProbeA
+{
+public:
+    CCM_INTERFACE_DECL();
+
+    ECode IProbeAMethod() override { return NOERROR; }
+};
+
+class CProbe2
+    : public CProbe1
+    , public IProbeB
+{
+public:
+    CCM_INTERFACE_DECL();
+
+    ECode IProbeBMethod() override { return NOERROR; }
+};
+
+class CProbe3
+    : public CProbe2
+    , public IProbeC
+{
+public:
+    CCM_INTERFACE_DECL();
+
+    ECode IProbeCMethod() override { return NOERROR; }
+};
+
+class CProbe4
+    : public CProbe3
+    , public IProbeD
+{
+public:
+    CCM_INTERFACE_DECL();
+
+    ECode IProbeDMethod() override { return NOERROR; }
+};
+
+}
+
+#endif // __CCM_TEST_CPROBE_H__
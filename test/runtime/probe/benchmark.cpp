@@ -0,0 +1,71 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "CProbe.h"
+#include <stdio.h>
+#include <time.h>
+
+using namespace ccm;
+
+static Long Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Long)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+static constexpr Integer ROUNDS = 10000000;
+
+// Prints the time Probe(|iid|) takes on |object|.
+static void Measure(
+    /* [in] */ const char* name,
+    /* [in] */ IInterface* object,
+    /* [in] */ const InterfaceID& iid)
+{
+    // Through a volatile pointer so the loop can not be hoisted.
+    IInterface* volatile target = object;
+    Long found = 0;
+    Long start = Now();
+    for (Integer i = 0; i < ROUNDS; i++) {
+        found += target->Probe(iid) != nullptr;
+    }
+    Long nanos = Now() - start;
+    printf("%-28s %-16s %6.2f ns\n", name, found != 0 ? "found" : "missing",
+            (double)nanos / ROUNDS);
+}
+
+int main(int argc, char** argv)
+{
+    IInterface* objects[] = {
+        (IProbeA*)new CProbe1(),
+        (IProbeA*)new CProbe2(),
+        (IProbeA*)new CProbe3(),
+        (IProbeA*)new CProbe4(),
+    };
+
+    for (Integer depth = 1; depth <= 4; depth++) {
+        IInterface* object = objects[depth - 1];
+        object->AddRef();
+        printf("depth %d\n", depth);
+        Measure("  IProbeA (CProbe1)", object, IID_IProbeA);
+        Measure("  IInterface", object, IID_IInterface);
+        Measure("  IObject (Object::Probe)", object, IID_IObject);
+        Measure("  unknown", object, IID_IProbeMissing);
+        object->Release();
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CProbe.h"
+#include <ccmautoptr.h>
+#include <gtest/gtest.h>
+
+using namespace ccm;
+
+// The second round is answered from the ProbeCaches.
+TEST(ProbeTest, TestProbeDeepest)
+{
+    AutoPtr<CProbe4> object = new CProbe4();
+    IInterface* itf = (IProbeD*)object.Get();
+    for (Integer round = 0; round < 2; round++) {
+        EXPECT_EQ((IInterface*)(IProbeA*)object.Get(), itf->Probe(IID_IProbeA));
+        EXPECT_EQ((IInterface*)(IProbeB*)object.Get(), itf->Probe(IID_IProbeB));
+        EXPECT_EQ((IInterface*)(IProbeC*)object.Get(), itf->Probe(IID_IProbeC));
+        EXPECT_EQ((IInterface*)(IProbeD*)object.Get(), itf->Probe(IID_IProbeD));
+        EXPECT_EQ((IInterface*)(IObject*)object.Get(), itf->Probe(IID_IObject));
+        EXPECT_EQ((IInterface*)(IWeakReferenceSource*)object.Get(),
+                itf->Probe(IID_IWeakReferenceSource));
+        EXPECT_EQ(nullptr, itf->Probe(IID_IProbeMissing));
+    }
+}
+
+// Every depth caches its own offsets, a shallower class must not see
+// the interfaces of a deeper one.
+TEST(ProbeTest, TestProbeEachDepth)
+{
+    AutoPtr<CProbe4> deepest = new CProbe4();
+    EXPECT_NE(nullptr, ((IProbeA*)deepest.Get())->Probe(IID_IProbeD));
+
+    AutoPtr<CProbe1> probe1 = new CProbe1();
+    IInterface* itf1 = (IProbeA*)probe1.Get();
+    EXPECT_EQ((IInterface*)(IProbeA*)probe1.Get(), itf1->Probe(IID_IProbeA));
+    EXPECT_EQ(nullptr, itf1->Probe(IID_IProbeB));
+    EXPECT_EQ(nullptr, itf1->Probe(IID_IProbeD));
+
+    AutoPtr<CProbe2> probe2 = new CProbe2();
+    IInterface* itf2 = (IProbeB*)probe2.Get();
+    EXPECT_EQ((IInterface*)(IProbeA*)probe2.Get(), itf2->Probe(IID_IProbeA));
+    EXPECT_EQ((IInterface*)(IProbeB*)probe2.Get(), itf2->Probe(IID_IProbeB));
+    EXPECT_EQ(nullptr, itf2->Probe(IID_IProbeC));
+
+    AutoPtr<CProbe3> probe3 = new CProbe3();
+    IInterface* itf3 = (IProbeC*)probe3.Get();
+    EXPECT_EQ((IInterface*)(IProbeB*)probe3.Get(), itf3->Probe(IID_IProbeB));
+    EXPECT_EQ((IInterface*)(IProbeC*)probe3.Get(), itf3->Probe(IID_IProbeC));
+    EXPECT_EQ(nullptr, itf3->Probe(IID_IProbeD));
+}
+
+// The cached offsets hold for every object of the class, not only the
+// one which filled the cache.
+TEST(ProbeTest, TestProbeAnotherObject)
+{
+    AutoPtr<CProbe4> first = new CProbe4();
+    ((IProbeA*)first.Get())->Probe(IID_IProbeC);
+    AutoPtr<CProbe4> second = new CProbe4();
+    EXPECT_EQ((IInterface*)(IProbeC*)second.Get(),
+            ((IProbeA*)second.Get())->Probe(IID_IProbeC));
+}
+
+TEST(ProbeTest, TestGetInterfaceID)
+{
+    AutoPtr<CProbe4> object = new CProbe4();
+    InterfaceID iid;
+    EXPECT_EQ(NOERROR, object->GetInterfaceID((IProbeA*)object.Get(), &iid));
+    EXPECT_TRUE(iid == IID_IProbeA);
+    EXPECT_EQ(NOERROR, object->GetInterfaceID((IProbeD*)object.Get(), &iid));
+    EXPECT_TRUE(iid == IID_IProbeD);
+}
@@ -0,0 +1,164 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include <ccmautoptr.h>
+#include <ccmrefbase.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+using namespace ccm;
+
+// libcore can not be loaded here, so these mirror what ArrayList::Get
+// and a HashMap entry iterator do to the objects they hand out.
+class Element
+    : public RefBase
+{
+public:
+    Element(
+        /* [in] */ Integer value)
+        : mValue(value)
+    {}
+
+    Integer mValue;
+};
+
+class Node
+    : public RefBase
+{
+public:
+    AutoPtr<Element> mKey;
+    AutoPtr<Element> mValue;
+    AutoPtr<Node> mNext;
+};
+
+static Long Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Long)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+static constexpr Integer ELEMENT_NUMBER = 1024;
+static constexpr Integer BUCKET_NUMBER = 256;
+static constexpr Integer ROUNDS = 2000;
+
+template<typename T>
+static T* NewObject(
+    /* [in] */ Boolean confined,
+    /* [in] */ T* object)
+{
+    if (confined) {
+        object->ConfineToThread();
+    }
+    return object;
+}
+
+__attribute__((noinline))
+static void Get(
+    /* [in] */ Element** elements,
+    /* [in] */ Integer index,
+    /* [out] */ AutoPtr<Element>& element)
+{
+    element = elements[index];
+}
+
+static Long IterateList(
+    /* [in] */ Boolean confined)
+{
+    Element** elements = (Element**)malloc(sizeof(Element*) * ELEMENT_NUMBER);
+    for (Integer i = 0; i < ELEMENT_NUMBER; i++) {
+        elements[i] = NewObject(confined, new Element(i));
+        elements[i]->AddRef();
+    }
+
+    Long sum = 0;
+    Long start = Now();
+    for (Integer round = 0; round < ROUNDS; round++) {
+        for (Integer i = 0; i < ELEMENT_NUMBER; i++) {
+            AutoPtr<Element> element;
+            Get(elements, i, element);
+            sum += element->mValue;
+        }
+    }
+    Long nanos = Now() - start;
+
+    for (Integer i = 0; i < ELEMENT_NUMBER; i++) {
+        elements[i]->Release();
+    }
+    free(elements);
+    return sum == 0 ? 0 : nanos;
+}
+
+__attribute__((noinline))
+static void NextEntry(
+    /* [in] */ AutoPtr<Node>* buckets,
+    /* [in, out] */ Integer& index,
+    /* [in, out] */ AutoPtr<Node>& node)
+{
+    if (node != nullptr) {
+        node = node->mNext;
+    }
+    while (node == nullptr && index < BUCKET_NUMBER) {
+        node = buckets[index++];
+    }
+}
+
+static Long IterateMap(
+    /* [in] */ Boolean confined)
+{
+    AutoPtr<Node>* buckets = new AutoPtr<Node>[BUCKET_NUMBER];
+    for (Integer i = 0; i < ELEMENT_NUMBER; i++) {
+        AutoPtr<Node> node = NewObject(confined, new Node());
+        node->mKey = NewObject(confined, new Element(i));
+        node->mValue = NewObject(confined, new Element(i * 2));
+        node->mNext = buckets[i % BUCKET_NUMBER];
+        buckets[i % BUCKET_NUMBER] = node;
+    }
+
+    Long sum = 0;
+    Long start = Now();
+    for (Integer round = 0; round < ROUNDS; round++) {
+        Integer index = 0;
+        AutoPtr<Node> node;
+        for (NextEntry(buckets, index, node); node != nullptr;
+                NextEntry(buckets, index, node)) {
+            AutoPtr<Element> key = node->mKey;
+            AutoPtr<Element> value = node->mValue;
+            sum += key->mValue + value->mValue;
+        }
+    }
+    Long nanos = Now() - start;
+
+    delete[] buckets;
+    return sum == 0 ? 0 : nanos;
+}
+
+int main(int argc, char** argv)
+{
+    Long operations = (Long)ELEMENT_NUMBER * ROUNDS;
+    Long atomicList = IterateList(false);
+    Long confinedList = IterateList(true);
+    Long atomicMap = IterateMap(false);
+    Long confinedMap = IterateMap(true);
+
+    printf("%-24s %10s %10s\n", "ns/element", "atomic", "confined");
+    printf("%-24s %10.2f %10.2f\n", "ArrayList Get",
+            (double)atomicList / operations, (double)confinedList / operations);
+    printf("%-24s %10.2f %10.2f\n", "HashMap entry iteration",
+            (double)atomicMap / operations, (double)confinedMap / operations);
+    return 0;
+}
@@ -0,0 +1,120 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "RefCountTestUnit.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmobject.h>
+#include <gtest/gtest.h>
+
+using namespace ccm;
+using ccm::test::refcount::CConfinedCounter;
+using ccm::test::refcount::CCounter;
+using ccm::test::refcount::ICounter;
+using ccm::test::refcount::IID_ICounter;
+
+static Object* GetObject(
+    /* [in] */ IInterface* object)
+{
+    return static_cast<Object*>(IObject::Probe(object));
+}
+
+TEST(RefCountTest, ThreadConfinedCoclassTest)
+{
+    AutoPtr<ICounter> counter;
+    ASSERT_EQ(NOERROR, CConfinedCounter::New(IID_ICounter, (IInterface**)&counter));
+    Object* obj = GetObject(counter);
+    EXPECT_TRUE(obj->IsConfinedToThread());
+    EXPECT_EQ(1, obj->GetStrongCount());
+    EXPECT_EQ(2, obj->AddRef());
+    EXPECT_EQ(1, obj->Release());
+    counter->Increase();
+    Integer value;
+    counter->GetValue(&value);
+    EXPECT_EQ(1, value);
+}
+
+TEST(RefCountTest, SharedCoclassTest)
+{
+    AutoPtr<ICounter> counter;
+    ASSERT_EQ(NOERROR, CCounter::New(IID_ICounter, (IInterface**)&counter));
+    EXPECT_FALSE(GetObject(counter)->IsConfinedToThread());
+    EXPECT_EQ(1, GetObject(counter)->GetStrongCount());
+}
+
+TEST(RefCountTest, WeakReferenceEndsConfinementTest)
+{
+    AutoPtr<ICounter> counter;
+    ASSERT_EQ(NOERROR, CConfinedCounter::New(IID_ICounter, (IInterface**)&counter));
+    AutoPtr<IWeakReference> wr = Object::GetWeakReference(counter);
+    ASSERT_TRUE(wr != nullptr);
+    EXPECT_FALSE(GetObject(counter)->IsConfinedToThread());
+    EXPECT_EQ(1, GetObject(counter)->GetStrongCount());
+
+    AutoPtr<ICounter> resolved;
+    wr->Resolve(IID_ICounter, (IInterface**)&resolved);
+    EXPECT_EQ(counter.Get(), resolved.Get());
+    resolved = nullptr;
+    counter = nullptr;
+    wr->Resolve(IID_ICounter, (IInterface**)&resolved);
+    EXPECT_TRUE(resolved == nullptr);
+}
+
+static Boolean sDestroyed = false;
+
+class Element
+    : public RefBase
+{
+public:
+    ~Element()
+    {
+        sDestroyed = true;
+    }
+};
+
+TEST(RefCountTest, InlineCountsTest)
+{
+    sDestroyed = false;
+    Element* element = new Element();
+    element->ConfineToThread();
+    EXPECT_EQ(1, element->AddRef());
+    EXPECT_EQ(2, element->AddRef());
+    EXPECT_EQ(2, element->GetStrongCount());
+    EXPECT_EQ(1, element->Release());
+    EXPECT_FALSE(sDestroyed);
+    EXPECT_EQ(0, element->Release());
+    EXPECT_TRUE(sDestroyed);
+}
+
+TEST(RefCountTest, InlineCountsBoundTest)
+{
+    // The inline weak count has 20 bits. The reference which would
+    // carry out of them moves the counts to a WeakRefImpl, and the
+    // object stops being confined. The element is leaked, as RefBase
+    // reports more than 0xfffff weak references once they are released.
+    static constexpr Integer MAX_COUNT = 0xfffff;
+    Element* element = new Element();
+    element->ConfineToThread();
+    for (Integer i = 0; i < MAX_COUNT; i++) {
+        element->AddRef();
+    }
+    EXPECT_TRUE(element->IsConfinedToThread());
+    EXPECT_EQ(MAX_COUNT, element->GetStrongCount());
+    EXPECT_EQ(MAX_COUNT + 1, element->AddRef());
+    EXPECT_FALSE(element->IsConfinedToThread());
+    EXPECT_EQ(MAX_COUNT + 1, element->GetStrongCount());
+    EXPECT_EQ(MAX_COUNT + 1, element->GetWeakRefs()->GetWeakCount());
+}
@@ -0,0 +1,49 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEST_REFCOUNT_CCOUNTER_H__
+#define __CCM_TEST_REFCOUNT_CCOUNTER_H__
+
+#include <ccmapi.h>
+#include <ccmobject.h>
+#include "ccm.test.refcount.ICounter.h"
+#include "_ccm_test_refcount_CCounter.h"
+
+namespace ccm {
+namespace test {
+namespace refcount {
+
+Coclass(CCounter)
+    , public Object
+    , public ICounter
+{
+public:
+    CCM_INTERFACE_DECL();
+
+    ECode Increase() override;
+
+    ECode GetValue(
+        /* [out] */ Integer* value) override;
+
+private:
+    Integer mValue;
+};
+
+}
+}
+}
+
+#endif // __CCM_TEST_REFCOUNT_CCOUNTER_H__
@@ -17,113 +17,276 @@
 #include "ReflectionTestUnit.h"
 #include <ccmapi.h>
 #include <ccmautoptr.h>
+#include <pthread.h>
+#include <gtest/gtest.h>
 
-#include <stdio.h>
+using namespace ccm;
 
-int main(int argv, char** argc)
+static constexpr Integer LOOKUP_THREAD_NUMBER = 8;
+
+// These run in order and share the component; the last one unloads it.
+static AutoPtr<IMetaComponent> sComponent;
+
+static IMetaComponent* GetComponent()
 {
-    AutoPtr<IMetaComponent> mc;
-    CoGetComponentMetadata(CID_ReflectionTestUnit, nullptr, &mc);
-    String name;
-    mc->GetName(&name);
-    printf("==== component name: %s ====\n\n", name.string());
-
-    Integer clsNumber;
-    mc->GetCoclassNumber(&clsNumber);
-    printf("==== component class number: %d ====\n", clsNumber);
-    Array<IMetaCoclass*> klasses(clsNumber);
-    mc->GetAllCoclasses(klasses);
-    for (Integer i = 0; i < klasses.GetLength(); i++) {
-        String clsName, clsNs;
-        klasses[i]->GetName(&clsName);
-        klasses[i]->GetNamespace(&clsNs);
-        printf("==== [%d] class name: %s, namespace: %s ====\n",
-                i, clsName.string(), clsNs.string());
+    if (sComponent == nullptr) {
+        CoGetComponentMetadata(CID_ReflectionTestUnit, nullptr, &sComponent);
     }
-    printf("\n");
-
-    Integer intfNumber;
-    mc->GetInterfaceNumber(&intfNumber);
-    printf("==== component interface number: %d ====\n", intfNumber);
-    Array<IMetaInterface*> intfs(intfNumber);
-    mc->GetAllInterfaces(intfs);
-    for (Integer i = 0; i < intfs.GetLength(); i++) {
-        String intfName, intfNs;
-        intfs[i]->GetName(&intfName);
-        intfs[i]->GetNamespace(&intfNs);
-        Integer methodNumber;
-        intfs[i]->GetMethodNumber(&methodNumber);
-        printf("==== [%d] interface name: %s, namespace: %s, %d methods ====\n",
-                i, intfName.string(), intfNs.string(), methodNumber);
+    return sComponent;
+}
+
+static AutoPtr<IMetaCoclass> GetTester()
+{
+    AutoPtr<IMetaCoclass> klass;
+    GetComponent()->GetCoclass(
+            String("ccm::test::reflection::CMethodTester"), &klass);
+    return klass;
+}
+
+// Looks the coclass up by name and by id, and returns it when both
+// lookups give the same object.
+static void* LookupCoclass(
+    /* [in] */ void* arg)
+{
+    IMetaComponent* mc = reinterpret_cast<IMetaComponent*>(arg);
+    AutoPtr<IMetaCoclass> klass;
+    mc->GetCoclass(String("ccm::test::reflection::CMethodTester"), &klass);
+    if (klass == nullptr) {
+        return nullptr;
     }
-    printf("\n");
+    CoclassID cid;
+    klass->GetCoclassID(&cid);
+    AutoPtr<IMetaCoclass> klassById;
+    mc->GetCoclass(cid, &klassById);
+    AutoPtr<IMetaInterface> intf;
+    mc->GetInterface(String("ccm::test::reflection::IMethodTest"), &intf);
+    if (klassById != klass || intf == nullptr) {
+        return nullptr;
+    }
+    return klass.Get();
+}
 
-    AutoPtr<IInterface> obj;
-    klasses[0]->CreateObject(IID_IInterface, &obj);
+TEST(ReflectionTest, TestComponent)
+{
+    IMetaComponent* mc = GetComponent();
+    ASSERT_NE(nullptr, mc);
+    String name;
+    EXPECT_EQ(NOERROR, mc->GetName(&name));
+    EXPECT_STREQ("ReflectionTestUnit", name.string());
+}
+
+TEST(ReflectionTest, TestGetAllCoclasses)
+{
+    IMetaComponent* mc = GetComponent();
+    Integer number;
+    EXPECT_EQ(NOERROR, mc->GetCoclassNumber(&number));
+    ASSERT_EQ(1, number);
+    Array<IMetaCoclass*> klasses(number);
+    EXPECT_EQ(NOERROR, mc->GetAllCoclasses(klasses));
+    String name, ns;
+    klasses[0]->GetName(&name);
+    klasses[0]->GetNamespace(&ns);
+    EXPECT_STREQ("CMethodTester", name.string());
+    EXPECT_STREQ("ccm::test::reflection::", ns.string());
+    EXPECT_EQ(GetTester(), klasses[0]);
+}
 
-    AutoPtr<IMetaCoclass> klass = klasses[0];
-    String clsName, clsNs;
-    klass->GetName(&clsName);
-    klass->GetNamespace(&clsNs);
+TEST(ReflectionTest, TestGetAllInterfaces)
+{
+    IMetaComponent* mc = GetComponent();
+    Integer number;
+    EXPECT_EQ(NOERROR, mc->GetInterfaceNumber(&number));
+    ASSERT_EQ(1, number);
+    Array<IMetaInterface*> intfs(number);
+    EXPECT_EQ(NOERROR, mc->GetAllInterfaces(intfs));
+    String name, ns;
+    intfs[0]->GetName(&name);
+    intfs[0]->GetNamespace(&ns);
+    EXPECT_STREQ("IMethodTest", name.string());
+    EXPECT_STREQ("ccm::test::reflection::", ns.string());
     Integer methodNumber;
-    klass->GetMethodNumber(&methodNumber);
-    printf("==== class %s has %d methods ====\n", (clsNs + clsName).string(), methodNumber);
-    Array<IMetaMethod*> methods(methodNumber);
-    klass->GetAllMethods(methods);
-    for (Integer i = 0; i < methodNumber; i++) {
-        IMetaMethod* method = methods[i];
-        String mthName, mthSig;
-        method->GetName(&mthName);
-        method->GetSignature(&mthSig);
-        printf("==== [%d] method name: %s, signature: %s ====\n", i, mthName.string(), mthSig.string());
-    }
-    printf("\n");
+    intfs[0]->GetMethodNumber(&methodNumber);
+    EXPECT_EQ(6, methodNumber);
+
+    AutoPtr<IMetaInterface> intf;
+    EXPECT_EQ(NOERROR, mc->GetInterface(
+            String("ccm::test::reflection::IMethodTest"), &intf));
+    EXPECT_EQ(intfs[0], intf);
+}
+
+TEST(ReflectionTest, TestGetCoclassById)
+{
+    AutoPtr<IMetaCoclass> klass = GetTester();
+    ASSERT_NE(nullptr, klass);
+    CoclassID cid;
+    klass->GetCoclassID(&cid);
+    AutoPtr<IMetaCoclass> klassById;
+    EXPECT_EQ(NOERROR, GetComponent()->GetCoclass(cid, &klassById));
+    EXPECT_EQ(klass, klassById);
 
+    AutoPtr<IMetaCoclass> missing;
+    GetComponent()->GetCoclass(
+            String("ccm::test::reflection::CMissing"), &missing);
+    EXPECT_EQ(nullptr, missing);
+}
+
+TEST(ReflectionTest, TestGetMethod)
+{
+    AutoPtr<IMetaCoclass> klass = GetTester();
+    ASSERT_NE(nullptr, klass);
     AutoPtr<IMetaMethod> method;
-    klass->GetMethod(String("TestMethod1"), String("(I)E"), &method);
-    Integer paramNumber;
-    method->GetParameterNumber(&paramNumber);
-    printf("==== method TestMethod1 has %d parameters ====\n", paramNumber);
-    Array<IMetaParameter*> params(paramNumber);
-    method->GetAllParameters(params);
-    for (Integer i = 0; i < paramNumber; i++) {
-        IMetaParameter* param = params[i];
-        String pname;
-        param->GetName(&pname);
-        Integer pidx;
-        param->GetIndex(&pidx);
-        IOAttribute attr;
-        param->GetIOAttribute(&attr);
-        AutoPtr<IMetaType> type;
-        param->GetType(&type);
-        String tname;
-        type->GetName(&tname);
-        printf("==== [%d] parameter name: %s, index: %d, attr: %d, type: %s ====\n",
-                i, pname.string(), pidx, (Integer)attr, tname.string());
+    EXPECT_EQ(NOERROR, klass->GetMethod(
+            String("TestMethod1"), String("(I)E"), &method));
+    ASSERT_NE(nullptr, method);
+    String name, signature;
+    method->GetName(&name);
+    method->GetSignature(&signature);
+    EXPECT_STREQ("TestMethod1", name.string());
+    EXPECT_STREQ("(I)E", signature.string());
+
+    AutoPtr<IMetaMethod> sameMethod;
+    EXPECT_EQ(NOERROR, CoGetCoclassMethod(
+            klass, "TestMethod1", "(I)E", &sameMethod));
+    EXPECT_EQ(method, sameMethod);
+
+    AutoPtr<IMetaInterface> intf;
+    GetComponent()->GetInterface(
+            String("ccm::test::reflection::IMethodTest"), &intf);
+    ASSERT_NE(nullptr, intf);
+    AutoPtr<IMetaMethod> intfMethod;
+    EXPECT_EQ(NOERROR, CoGetInterfaceMethod(
+            intf, "TestMethod1", "(I)E", &intfMethod));
+    ASSERT_NE(nullptr, intfMethod);
+    intfMethod->GetSignature(&signature);
+    EXPECT_STREQ("(I)E", signature.string());
+
+    AutoPtr<IMetaMethod> wrongMethod;
+    CoGetCoclassMethod(klass, "TestMethod1", "(J)E", &wrongMethod);
+    EXPECT_EQ(nullptr, wrongMethod);
+}
+
+TEST(ReflectionTest, TestGetParameters)
+{
+    AutoPtr<IMetaMethod> method;
+    CoGetCoclassMethod(GetTester(), "TestMethod1", "(I)E", &method);
+    ASSERT_NE(nullptr, method);
+    Integer number;
+    EXPECT_EQ(NOERROR, method->GetParameterNumber(&number));
+    ASSERT_EQ(1, number);
+    Array<IMetaParameter*> params(number);
+    EXPECT_EQ(NOERROR, method->GetAllParameters(params));
+    String name;
+    params[0]->GetName(&name);
+    EXPECT_STREQ("arg1", name.string());
+    Integer index;
+    params[0]->GetIndex(&index);
+    EXPECT_EQ(0, index);
+    IOAttribute attr;
+    params[0]->GetIOAttribute(&attr);
+    EXPECT_EQ(IOAttribute::IN, attr);
+    AutoPtr<IMetaType> type;
+    params[0]->GetType(&type);
+    ASSERT_NE(nullptr, type);
+    String typeName;
+    type->GetName(&typeName);
+    EXPECT_STREQ("Integer", typeName.string());
+}
+
+TEST(ReflectionTest, TestInvoke)
+{
+    AutoPtr<IMetaCoclass> klass = GetTester();
+    ASSERT_NE(nullptr, klass);
+    AutoPtr<IInterface> obj;
+    EXPECT_EQ(NOERROR, klass->CreateObject(IID_IInterface, &obj));
+    ASSERT_NE(nullptr, obj);
+    AutoPtr<IMetaMethod> method;
+    CoGetCoclassMethod(klass, "TestMethod1", "(I)E", &method);
+    ASSERT_NE(nullptr, method);
+    AutoPtr<IArgumentList> args;
+    EXPECT_EQ(NOERROR, method->CreateArgumentList(&args));
+    EXPECT_EQ(NOERROR, args->SetInputArgumentOfInteger(0, 9));
+    EXPECT_EQ(NOERROR, method->Invoke(obj, args));
+
+    AutoPtr<IMetaCoclass> objKlass;
+    EXPECT_EQ(NOERROR, IObject::Probe(obj)->GetCoclass(&objKlass));
+    EXPECT_EQ(klass, objKlass);
+}
+
+TEST(ReflectionTest, TestInvokeWithStackArguments)
+{
+    AutoPtr<IMetaCoclass> klass = GetTester();
+    ASSERT_NE(nullptr, klass);
+    AutoPtr<IInterface> obj;
+    klass->CreateObject(IID_IInterface, &obj);
+    ASSERT_NE(nullptr, obj);
+    Integer number;
+    klass->GetMethodNumber(&number);
+    Array<IMetaMethod*> methods(number);
+    klass->GetAllMethods(methods);
+    AutoPtr<IMetaMethod> method;
+    for (Integer i = 0; i < number; i++) {
+        String name;
+        methods[i]->GetName(&name);
+        if (name.Equals("TestMethod2")) {
+            method = methods[i];
+        }
     }
-    printf("\n");
+    ASSERT_NE(nullptr, method);
 
     AutoPtr<IArgumentList> args;
     method->CreateArgumentList(&args);
-    args->SetInputArgumentOfInteger(0, 9);
-    method->Invoke(obj, args);
-
-    klass = nullptr;
-    IObject::Probe(obj)->GetCoclass(&klass);
-    klass->GetName(&clsName);
-    klass->GetNamespace(&clsNs);
-    printf("==== object class name: %s, namespace: %s ====\n",
-            clsName.string(), clsNs.string());
+    Long expected = 0;
+    for (Integer i = 0; i < 7; i++) {
+        args->SetInputArgumentOfInteger(i, 10 + i);
+        expected += (i + 1) * (10 + i);
+    }
+    for (Integer i = 7; i < 16; i++) {
+        args->SetInputArgumentOfDouble(i, 100 + i);
+        expected += (i + 1) * (100 + i);
+    }
+    Long result = 0;
+    args->SetOutputArgumentOfLong(16, reinterpret_cast<HANDLE>(&result));
+    EXPECT_EQ(NOERROR, method->Invoke(obj, args));
+    EXPECT_EQ(expected, result);
+}
 
-    obj = nullptr;
-    Boolean canUnload;
-    mc->CanUnload(&canUnload);
-    if (canUnload) {
-        ECode ec = mc->Unload();
-        printf("==== Unload component %s ====\n", SUCCEEDED(ec) ? "succeeded." : "fail.");
+TEST(ReflectionTest, TestConcurrentLookups)
+{
+    AutoPtr<IMetaCoclass> klass = GetTester();
+    ASSERT_NE(nullptr, klass);
+    pthread_t threads[LOOKUP_THREAD_NUMBER];
+    for (Integer i = 0; i < LOOKUP_THREAD_NUMBER; i++) {
+        ASSERT_EQ(0, pthread_create(&threads[i], nullptr,
+                LookupCoclass, GetComponent()));
     }
-    else {
-        printf("==== Cannot unload component ====\n");
+    for (Integer i = 0; i < LOOKUP_THREAD_NUMBER; i++) {
+        void* found;
+        pthread_join(threads[i], &found);
+        EXPECT_EQ(klass.Get(), found);
     }
-    return 0;
-}
\ No newline at end of file
+}
+
+TEST(ReflectionTest, TestUnload)
+{
+    AutoPtr<IMetaCoclass> klass = GetTester();
+    ASSERT_NE(nullptr, klass);
+    IMetaComponent* mc = GetComponent();
+    Boolean canUnload;
+    EXPECT_EQ(NOERROR, mc->CanUnload(&canUnload));
+    ASSERT_TRUE(canUnload);
+    EXPECT_EQ(NOERROR, mc->Unload());
+
+    // What was looked up before stays usable, and new lookups find nothing.
+    String name;
+    EXPECT_EQ(NOERROR, klass->GetName(&name));
+    EXPECT_STREQ("CMethodTester", name.string());
+    AutoPtr<IMetaCoclass> after;
+    mc->GetCoclass(String("ccm::test::reflection::CMethodTester"), &after);
+    EXPECT_EQ(nullptr, after);
+    AutoPtr<IMetaInterface> intf;
+    mc->GetInterface(String("ccm::test::reflection::IMethodTest"), &intf);
+    EXPECT_EQ(nullptr, intf);
+    Integer number;
+    mc->GetCoclassNumber(&number);
+    EXPECT_EQ(0, number);
+}
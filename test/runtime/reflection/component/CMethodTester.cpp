@@ -42,6 +42,42 @@ ECode CMethodTester::TestMethod1(
     return NOERROR;
 }
 
+ECode CMethodTester::TestMethod2(
+    /* [in] */ Integer arg1,
+    /* [in] */ Integer arg2,
+    /* [in] */ Integer arg3,
+    /* [in] */ Integer arg4,
+    /* [in] */ Integer arg5,
+    /* [in] */ Integer arg6,
+    /* [in] */ Integer arg7,
+    /* [in] */ Double arg8,
+    /* [in] */ Double arg9,
+    /* [in] */ Double arg10,
+    /* [in] */ Double arg11,
+    /* [in] */ Double arg12,
+    /* [in] */ Double arg13,
+    /* [in] */ Double arg14,
+    /* [in] */ Double arg15,
+    /* [in] */ Double arg16,
+    /* [out] */ Long* result)
+{
+    VALIDATE_NOT_NULL(result);
+
+    // Weighs each argument by its position, so a swap changes the result.
+    Integer ints[] = { arg1, arg2, arg3, arg4, arg5, arg6, arg7 };
+    Double doubles[] = { arg8, arg9, arg10, arg11, arg12,
+            arg13, arg14, arg15, arg16 };
+    Long sum = 0;
+    for (Integer i = 0; i < 7; i++) {
+        sum += (i + 1) * ints[i];
+    }
+    for (Integer i = 0; i < 9; i++) {
+        sum += (i + 8) * (Long)doubles[i];
+    }
+    *result = sum;
+    return NOERROR;
+}
+
 }
 }
 }
@@ -40,6 +40,25 @@ public:
 
     ECode TestMethod1(
         /* [in] */ Integer arg1);
+
+    ECode TestMethod2(
+        /* [in] */ Integer arg1,
+        /* [in] */ Integer arg2,
+        /* [in] */ Integer arg3,
+        /* [in] */ Integer arg4,
+        /* [in] */ Integer arg5,
+        /* [in] */ Integer arg6,
+        /* [in] */ Integer arg7,
+        /* [in] */ Double arg8,
+        /* [in] */ Double arg9,
+        /* [in] */ Double arg10,
+        /* [in] */ Double arg11,
+        /* [in] */ Double arg12,
+        /* [in] */ Double arg13,
+        /* [in] */ Double arg14,
+        /* [in] */ Double arg15,
+        /* [in] */ Double arg16,
+        /* [out] */ Long* result);
 };
 
 }
@@ -0,0 +1,326 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "ServiceProcess.h"
+#include <ccmreflectionapi.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+using namespace ccm;
+using ccm::test::rpcchannel::CChannelTest;
+using ccm::test::rpcchannel::CID_CChannelTest;
+using ccm::test::rpcchannel::IChannelTest;
+using ccm::test::rpcchannel::IID_IChannelTest;
+using ccm::test::rpcchannel::ServiceProcess;
+
+static Long GetTimeMs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000ll + ts.tv_nsec / 1000000;
+}
+
+static AutoPtr<IMetaMethod> GetMethod(
+    /* [in] */ const char* name)
+{
+    AutoPtr<IMetaCoclass> klass;
+    CoGetCoclassMetadata(CID_CChannelTest, nullptr, &klass);
+    if (klass == nullptr) {
+        return nullptr;
+    }
+    Integer number;
+    klass->GetMethodNumber(&number);
+    Array<IMetaMethod*> methods(number);
+    klass->GetAllMethods(methods);
+    for (Integer i = 0; i < number; i++) {
+        String methodName;
+        methods[i]->GetName(&methodName);
+        if (methodName.Equals(name)) {
+            return methods[i];
+        }
+    }
+    return nullptr;
+}
+
+// Local RPC goes over D-Bus and remote RPC over sockets, every test runs
+// on both channels.
+class AsyncInvocationTest
+    : public testing::TestWithParam<RPCType>
+{
+protected:
+    void SetUp() override
+    {
+        if (FAILED(mProcess.Start(GetParam()))) {
+            // Without a session bus there is no D-Bus channel to test.
+            ASSERT_EQ(RPCType::Local, GetParam());
+            GTEST_SKIP();
+        }
+        mService = mProcess.GetService();
+        mProxy = IProxy::Probe(mService);
+        ASSERT_NE(nullptr, mProxy);
+    }
+
+    void TearDown() override
+    {
+        mProxy = nullptr;
+        mService = nullptr;
+        mProcess.Stop();
+    }
+
+    // Waits up to |milliseconds| for |number| posts and returns their sum.
+    Long WaitForPosts(
+        /* [in] */ Integer number,
+        /* [in] */ Integer milliseconds)
+    {
+        Integer posts = 0;
+        Long sum = 0;
+        Long deadline = GetTimeMs() + milliseconds;
+        while (GetTimeMs() < deadline) {
+            EXPECT_EQ(NOERROR, mService->GetPosts(&posts, &sum));
+            if (posts >= number) {
+                break;
+            }
+            usleep(10 * 1000);
+        }
+        EXPECT_EQ(number, posts);
+        return sum;
+    }
+
+    ServiceProcess mProcess;
+    IChannelTest* mService = nullptr;
+    IProxy* mProxy = nullptr;
+};
+
+TEST_P(AsyncInvocationTest, TestMethodIsOneway)
+{
+    AutoPtr<IMetaMethod> post = GetMethod("Post");
+    ASSERT_NE(nullptr, post);
+    Boolean oneway;
+    EXPECT_EQ(NOERROR, post->IsOneway(&oneway));
+    EXPECT_TRUE(oneway);
+
+    AutoPtr<IMetaMethod> echo = GetMethod("Echo");
+    ASSERT_NE(nullptr, echo);
+    EXPECT_EQ(NOERROR, echo->IsOneway(&oneway));
+    EXPECT_FALSE(oneway);
+}
+
+// A oneway call returns once it is sent, while the service still works
+// on it.
+TEST_P(AsyncInvocationTest, TestOnewayReturnsAtOnce)
+{
+    static constexpr Integer DELAY_MS = 500;
+
+    Long start = GetTimeMs();
+    EXPECT_EQ(NOERROR, mService->Post(5, DELAY_MS));
+    EXPECT_LT(GetTimeMs() - start, DELAY_MS / 2);
+
+    Integer number;
+    Long sum;
+    EXPECT_EQ(NOERROR, mService->GetPosts(&number, &sum));
+    EXPECT_EQ(0, number);
+    EXPECT_EQ(5, WaitForPosts(1, DELAY_MS * 4));
+}
+
+// Oneway calls get no replies, which must not confuse the replies of
+// the calls around them.
+TEST_P(AsyncInvocationTest, TestOnewayBetweenCalls)
+{
+    static constexpr Integer POST_NUMBER = 20;
+
+    Long expected = 0;
+    for (Integer i = 0; i < POST_NUMBER; i++) {
+        EXPECT_EQ(NOERROR, mService->Post(i, 0));
+        expected += i;
+        Integer result;
+        EXPECT_EQ(NOERROR, mService->Echo(i + 100, &result));
+        EXPECT_EQ(i + 100, result);
+    }
+    EXPECT_EQ(expected, WaitForPosts(POST_NUMBER, 2000));
+}
+
+TEST_P(AsyncInvocationTest, TestInvokeAsync)
+{
+    AutoPtr<IMetaMethod> echo = GetMethod("EchoLater");
+    ASSERT_NE(nullptr, echo);
+    AutoPtr<IArgumentList> args;
+    ASSERT_EQ(NOERROR, echo->CreateArgumentList(&args));
+    Integer result = 0;
+    args->SetInputArgumentOfInteger(0, 42);
+    args->SetInputArgumentOfInteger(1, 300);
+    args->SetOutputArgumentOfInteger(2, reinterpret_cast<HANDLE>(&result));
+
+    Long start = GetTimeMs();
+    AutoPtr<IInvocationFuture> future;
+    ASSERT_EQ(NOERROR, mProxy->InvokeAsync(echo, args, &future));
+    ASSERT_NE(nullptr, future);
+    EXPECT_LT(GetTimeMs() - start, 150);
+    Boolean done;
+    EXPECT_EQ(NOERROR, future->IsDone(&done));
+    EXPECT_FALSE(done);
+    EXPECT_EQ(0, result);
+
+    EXPECT_EQ(NOERROR, future->Wait());
+    EXPECT_EQ(42, result);
+    EXPECT_EQ(NOERROR, future->IsDone(&done));
+    EXPECT_TRUE(done);
+    AutoPtr<IParcel> reply;
+    EXPECT_EQ(NOERROR, future->GetReply(&reply));
+    EXPECT_NE(nullptr, reply);
+
+    // Waiting again gives the same result and stores nothing new.
+    result = 0;
+    EXPECT_EQ(NOERROR, future->Wait());
+    EXPECT_EQ(0, result);
+}
+
+// Many calls are in flight on one connection from a single thread, and
+// each future gets the reply of its own call.
+TEST_P(AsyncInvocationTest, TestPipelinedFutures)
+{
+    static constexpr Integer CALL_NUMBER = 8;
+    static constexpr Integer DELAY_MS = 300;
+
+    AutoPtr<IMetaMethod> echo = GetMethod("EchoLater");
+    ASSERT_NE(nullptr, echo);
+    AutoPtr<IArgumentList> args[CALL_NUMBER];
+    AutoPtr<IInvocationFuture> futures[CALL_NUMBER];
+    Integer results[CALL_NUMBER] = { 0 };
+    Long start = GetTimeMs();
+    for (Integer i = 0; i < CALL_NUMBER; i++) {
+        echo->CreateArgumentList(&args[i]);
+        args[i]->SetInputArgumentOfInteger(0, i + 100);
+        // The later calls reply first.
+        args[i]->SetInputArgumentOfInteger(1, DELAY_MS * (CALL_NUMBER - i) / CALL_NUMBER);
+        args[i]->SetOutputArgumentOfInteger(2, reinterpret_cast<HANDLE>(&results[i]));
+        ASSERT_EQ(NOERROR, mProxy->InvokeAsync(echo, args[i], &futures[i]));
+    }
+    for (Integer i = 0; i < CALL_NUMBER; i++) {
+        EXPECT_EQ(NOERROR, futures[i]->Wait());
+        EXPECT_EQ(i + 100, results[i]);
+    }
+
+    // One after the other they would take more than 1.3s.
+    EXPECT_LT(GetTimeMs() - start, DELAY_MS * 2);
+}
+
+// The future of a oneway method is done once the call is sent.
+TEST_P(AsyncInvocationTest, TestInvokeOnewayAsync)
+{
+    AutoPtr<IMetaMethod> post = GetMethod("Post");
+    ASSERT_NE(nullptr, post);
+    AutoPtr<IArgumentList> args;
+    post->CreateArgumentList(&args);
+    args->SetInputArgumentOfInteger(0, 9);
+    args->SetInputArgumentOfInteger(1, 300);
+
+    Long start = GetTimeMs();
+    AutoPtr<IInvocationFuture> future;
+    ASSERT_EQ(NOERROR, mProxy->InvokeAsync(post, args, &future));
+    ASSERT_NE(nullptr, future);
+    EXPECT_EQ(NOERROR, future->Wait());
+    EXPECT_LT(GetTimeMs() - start, 150);
+    AutoPtr<IParcel> reply;
+    future->GetReply(&reply);
+    EXPECT_EQ(nullptr, reply);
+    EXPECT_EQ(9, WaitForPosts(1, 2000));
+}
+
+TEST_P(AsyncInvocationTest, TestInvokeAsyncIllegalArguments)
+{
+    AutoPtr<IMetaMethod> echo = GetMethod("Echo");
+    ASSERT_NE(nullptr, echo);
+    AutoPtr<IArgumentList> args;
+    echo->CreateArgumentList(&args);
+    AutoPtr<IInvocationFuture> future;
+    EXPECT_EQ(E_ILLEGAL_ARGUMENT_EXCEPTION, mProxy->InvokeAsync(nullptr, args, &future));
+    EXPECT_EQ(E_ILLEGAL_ARGUMENT_EXCEPTION, mProxy->InvokeAsync(echo, nullptr, &future));
+    EXPECT_EQ(nullptr, future);
+}
+
+// The calls bounce between the client and the service, and each one waits
+// on a worker for the one nested in it. There are more of them on either
+// side than the pool has workers, the service has 16 and the client 4.
+TEST_P(AsyncInvocationTest, TestNestedCalls)
+{
+    static constexpr Integer DEPTH = 40;
+
+    AutoPtr<IChannelTest> local;
+    ASSERT_EQ(NOERROR, CChannelTest::New(IID_IChannelTest, (IInterface**)&local));
+    AutoPtr<IInterfacePack> ipack;
+    ASSERT_EQ(NOERROR, CoMarshalInterface(local, GetParam(), &ipack));
+    ASSERT_EQ(NOERROR, CoSetConcurrentInvocation(local, GetParam(), true));
+    AutoPtr<IParcel> parcel;
+    CoCreateParcel(GetParam(), &parcel);
+    ipack->WriteToParcel(parcel);
+    HANDLE data;
+    Long size;
+    parcel->GetData(&data);
+    parcel->GetDataSize(&size);
+    Array<Byte> pack(size);
+    memcpy(pack.GetPayload(), reinterpret_cast<void*>(data), size);
+
+    Integer pid;
+    EXPECT_EQ(NOERROR, mService->Relay((Integer)GetParam(), pack, DEPTH, &pid));
+    EXPECT_EQ(mProcess.GetPid(), pid);
+    EXPECT_EQ(NOERROR, mService->Relay((Integer)GetParam(), pack, DEPTH + 1, &pid));
+    EXPECT_EQ(getpid(), pid);
+}
+
+TEST_P(AsyncInvocationTest, TestConcurrentInvocationNeedsExport)
+{
+    AutoPtr<IChannelTest> local;
+    ASSERT_EQ(NOERROR, CChannelTest::New(IID_IChannelTest, (IInterface**)&local));
+    EXPECT_EQ(E_NOT_FOUND_EXCEPTION, CoSetConcurrentInvocation(local, GetParam(), true));
+    AutoPtr<IInterfacePack> ipack;
+    ASSERT_EQ(NOERROR, CoMarshalInterface(local, GetParam(), &ipack));
+    EXPECT_EQ(NOERROR, CoSetConcurrentInvocation(local, GetParam(), true));
+}
+
+INSTANTIATE_TEST_CASE_P(Channels, AsyncInvocationTest,
+        testing::Values(RPCType::Local, RPCType::Remote));
+
+// The D-Bus channel needs a session bus, the test runs itself again
+// under a private one if there is none.
+int main(int argc, char** argv)
+{
+    if (getenv("DBUS_SESSION_BUS_ADDRESS") == nullptr &&
+            getenv("CCM_TEST_PRIVATE_BUS") == nullptr) {
+        // /proc/self/exe would be dbus-run-session itself.
+        char path[PATH_MAX];
+        ssize_t len = readlink("/proc/self/exe", path, sizeof(path) - 1);
+        path[len > 0 ? len : 0] = '\0';
+        setenv("CCM_TEST_PRIVATE_BUS", "1", 1);
+        char** args = (char**)calloc(argc + 3, sizeof(char*));
+        args[0] = const_cast<char*>("dbus-run-session");
+        args[1] = const_cast<char*>("--");
+        args[2] = path;
+        for (int i = 1; i < argc; i++) {
+            args[i + 2] = argv[i];
+        }
+        execvp(args[0], args);
+        free(args);
+    }
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,181 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "ServiceProcess.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+namespace ccm {
+namespace test {
+namespace rpcchannel {
+
+static Boolean ReadFully(
+    /* [in] */ int fd,
+    /* [out] */ void* data,
+    /* [in] */ size_t size)
+{
+    char* p = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t ret = read(fd, p, size);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            return false;
+        }
+        p += ret;
+        size -= ret;
+    }
+    return true;
+}
+
+// The service is installed next to the test.
+static String GetServicePath()
+{
+    char path[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path, sizeof(path) - 1);
+    if (len <= 0) {
+        return String("testRPCChannelSrv");
+    }
+    path[len] = '\0';
+    char* slash = strrchr(path, '/');
+    if (slash != nullptr) {
+        slash[1] = '\0';
+    }
+    return String(path) + "testRPCChannelSrv";
+}
+
+ServiceProcess::ServiceProcess()
+    : mPid(-1)
+    , mControlFd(-1)
+{}
+
+ServiceProcess::~ServiceProcess()
+{
+    Stop();
+}
+
+ECode ServiceProcess::Start(
+    /* [in] */ RPCType type)
+{
+    int packFds[2];
+    int controlFds[2];
+    if (pipe2(packFds, O_CLOEXEC) != 0) {
+        return E_RUNTIME_EXCEPTION;
+    }
+    if (pipe2(controlFds, O_CLOEXEC) != 0) {
+        close(packFds[0]);
+        close(packFds[1]);
+        return E_RUNTIME_EXCEPTION;
+    }
+
+    String path = GetServicePath();
+    String typeArg(type == RPCType::Remote ? "remote" : "local");
+    String packArg = String::Format("%d", packFds[1]);
+    String controlArg = String::Format("%d", controlFds[0]);
+    pid_t pid = fork();
+    if (pid == 0) {
+        fcntl(packFds[1], F_SETFD, 0);
+        fcntl(controlFds[0], F_SETFD, 0);
+        execl(path.string(), path.string(), typeArg.string(),
+                packArg.string(), controlArg.string(), (char*)nullptr);
+        _exit(127);
+    }
+    close(packFds[1]);
+    close(controlFds[0]);
+    if (pid < 0) {
+        close(packFds[0]);
+        close(controlFds[1]);
+        return E_RUNTIME_EXCEPTION;
+    }
+    mPid = pid;
+    mControlFd = controlFds[1];
+
+    ECode ec = ReadPack(type, packFds[0]);
+    close(packFds[0]);
+    if (FAILED(ec)) {
+        Kill();
+    }
+    return ec;
+}
+
+ECode ServiceProcess::ReadPack(
+    /* [in] */ RPCType type,
+    /* [in] */ int fd)
+{
+    Long size;
+    if (!ReadFully(fd, &size, sizeof(size)) || size <= 0) {
+        return E_REMOTE_EXCEPTION;
+    }
+    Byte* data = (Byte*)malloc(size);
+    if (data == nullptr) {
+        return E_OUT_OF_MEMORY_ERROR;
+    }
+    if (!ReadFully(fd, data, size)) {
+        free(data);
+        return E_REMOTE_EXCEPTION;
+    }
+
+    AutoPtr<IParcel> parcel;
+    CoCreateParcel(type, &parcel);
+    parcel->SetData(data, size);
+    free(data);
+    AutoPtr<IInterfacePack> ipack;
+    CoCreateInterfacePack(type, &ipack);
+    ECode ec = ipack->ReadFromParcel(parcel);
+    if (FAILED(ec)) {
+        return ec;
+    }
+    AutoPtr<IInterface> obj;
+    ec = CoUnmarshalInterface(type, ipack, &obj);
+    if (FAILED(ec)) {
+        return ec;
+    }
+    mService = IChannelTest::Probe(obj);
+    return mService != nullptr ? NOERROR : E_INTERFACE_NOT_FOUND_EXCEPTION;
+}
+
+void ServiceProcess::Stop()
+{
+    mService = nullptr;
+    if (mControlFd != -1) {
+        close(mControlFd);
+        mControlFd = -1;
+    }
+    if (mPid > 0) {
+        waitpid(mPid, nullptr, 0);
+        mPid = -1;
+    }
+}
+
+void ServiceProcess::Kill()
+{
+    if (mPid > 0) {
+        kill(mPid, SIGKILL);
+    }
+    Stop();
+}
+
+}
+}
+}
@@ -0,0 +1,75 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEST_RPCCHANNEL_SERVICEPROCESS_H__
+#define __CCM_TEST_RPCCHANNEL_SERVICEPROCESS_H__
+
+#include "RPCChannelTestUnit.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <sys/types.h>
+
+namespace ccm {
+namespace test {
+namespace rpcchannel {
+
+// A testRPCChannelSrv process and a proxy of the CChannelTest it serves.
+class ServiceProcess
+{
+public:
+    ServiceProcess();
+
+    ~ServiceProcess();
+
+    ECode Start(
+        /* [in] */ RPCType type);
+
+    // Lets the service exit and waits for it.
+    void Stop();
+
+    // Kills the service without warning and waits for it.
+    void Kill();
+
+    inline IChannelTest* GetService();
+
+    inline pid_t GetPid();
+
+private:
+    ECode ReadPack(
+        /* [in] */ RPCType type,
+        /* [in] */ int fd);
+
+private:
+    pid_t mPid;
+    int mControlFd;
+    AutoPtr<IChannelTest> mService;
+};
+
+IChannelTest* ServiceProcess::GetService()
+{
+    return mService;
+}
+
+pid_t ServiceProcess::GetPid()
+{
+    return mPid;
+}
+
+}
+}
+}
+
+#endif // __CCM_TEST_RPCCHANNEL_SERVICEPROCESS_H__
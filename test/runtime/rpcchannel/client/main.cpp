@@ -0,0 +1,463 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "ServiceProcess.h"
+#include <dirent.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <gtest/gtest.h>
+
+using namespace ccm;
+using ccm::test::rpcchannel::IChannelTest;
+using ccm::test::rpcchannel::ServiceProcess;
+
+static Long GetTimeMs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000ll + ts.tv_nsec / 1000000;
+}
+
+static Integer CountSockets()
+{
+    Integer number = 0;
+    DIR* dir = opendir("/proc/self/fd");
+    if (dir == nullptr) {
+        return -1;
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        char path[64], target[64];
+        snprintf(path, sizeof(path), "/proc/self/fd/%s", entry->d_name);
+        ssize_t len = readlink(path, target, sizeof(target) - 1);
+        if (len > 0) {
+            target[len] = '\0';
+            if (!strncmp(target, "socket:", 7)) {
+                number++;
+            }
+        }
+    }
+    closedir(dir);
+    return number;
+}
+
+// Returns the inode of the lane memfd |pid| has mapped, or 0.
+static unsigned long GetLaneInode(
+    /* [in] */ pid_t pid)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/%d/maps", pid);
+    FILE* maps = fopen(path, "r");
+    if (maps == nullptr) {
+        return 0;
+    }
+    unsigned long inode = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), maps) != nullptr) {
+        if (strstr(line, "/memfd:ccm.rpc.lane") != nullptr) {
+            sscanf(line, "%*s %*s %*s %*s %lu", &inode);
+            break;
+        }
+    }
+    fclose(maps);
+    return inode;
+}
+
+// Connects a bare socket to the RPC service of |pid|, or returns -1.
+static int ConnectToService(
+    /* [in] */ pid_t pid)
+{
+    char name[64];
+    int len = snprintf(name, sizeof(name), "ccm.rpc.%d", pid);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path + 1, name, len);
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr*)&addr,
+            offsetof(struct sockaddr_un, sun_path) + 1 + len) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Whether |pid| has mapped the lane memfd whose inode is |inode|. The
+// client keeps the lanes of the services earlier tests talked to.
+static Boolean MapsLane(
+    /* [in] */ pid_t pid,
+    /* [in] */ unsigned long inode)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/%d/maps", pid);
+    FILE* maps = fopen(path, "r");
+    if (maps == nullptr) {
+        return false;
+    }
+    Boolean found = false;
+    char line[512];
+    while (!found && fgets(line, sizeof(line), maps) != nullptr) {
+        unsigned long mapped;
+        found = strstr(line, "/memfd:ccm.rpc.lane") != nullptr &&
+                sscanf(line, "%*s %*s %*s %*s %lu", &mapped) == 1 &&
+                mapped == inode;
+    }
+    fclose(maps);
+    return found;
+}
+
+// Fills |data| with bytes depending on |seed| and returns their sum.
+static Long FillBytes(
+    /* [in] */ Array<Byte>& data,
+    /* [in] */ Integer seed)
+{
+    Long sum = 0;
+    for (Long i = 0; i < data.GetLength(); i++) {
+        data[i] = (Byte)(i * 7 + seed + (i >> 12));
+        sum += data[i];
+    }
+    return sum;
+}
+
+// Reverses |data| through the service and checks what comes back.
+static void ExpectReversed(
+    /* [in] */ IChannelTest* service,
+    /* [in] */ const Array<Byte>& data)
+{
+    Array<Byte> reversed;
+    ASSERT_EQ(NOERROR, service->Reverse(data, &reversed));
+    ASSERT_EQ(data.GetLength(), reversed.GetLength());
+    Long length = data.GetLength();
+    Long mismatch = -1;
+    for (Long i = 0; i < length && mismatch == -1; i++) {
+        if (reversed[i] != data[length - 1 - i]) {
+            mismatch = i;
+        }
+    }
+    EXPECT_EQ(-1, mismatch);
+}
+
+struct SumCall
+{
+    IChannelTest* mService;
+    Array<Byte> mData;
+    Integer mMilliseconds;
+    Long mSum;
+    ECode mEc;
+};
+
+static void* CallSumLater(
+    /* [in] */ void* arg)
+{
+    SumCall* call = static_cast<SumCall*>(arg);
+    call->mEc = call->mService->SumLater(
+            call->mData, call->mMilliseconds, &call->mSum);
+    return nullptr;
+}
+
+struct EchoCall
+{
+    IChannelTest* mService;
+    Integer mValue;
+    Integer mMilliseconds;
+    Integer mResult;
+    ECode mEc;
+};
+
+static void* CallEchoLater(
+    /* [in] */ void* arg)
+{
+    EchoCall* call = static_cast<EchoCall*>(arg);
+    call->mEc = call->mService->EchoLater(
+            call->mValue, call->mMilliseconds, &call->mResult);
+    return nullptr;
+}
+
+class SocketTransportTest
+    : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(NOERROR, mProcess.Start(RPCType::Local));
+        mService = mProcess.GetService();
+    }
+
+    void TearDown() override
+    {
+        mService = nullptr;
+        mProcess.Stop();
+    }
+
+    ServiceProcess mProcess;
+    IChannelTest* mService = nullptr;
+};
+
+TEST_F(SocketTransportTest, TestCallAnotherProcess)
+{
+    Integer pid;
+    EXPECT_EQ(NOERROR, mService->GetProcessId(&pid));
+    EXPECT_EQ(mProcess.GetPid(), pid);
+    EXPECT_NE(getpid(), pid);
+    Integer result;
+    EXPECT_EQ(NOERROR, mService->Echo(7, &result));
+    EXPECT_EQ(7, result);
+}
+
+// The calls of all threads share one connection and are in flight
+// together, each reply goes back to its own caller.
+TEST_F(SocketTransportTest, TestPipelinedCalls)
+{
+    static constexpr Integer THREAD_NUMBER = 8;
+    static constexpr Integer DELAY_MS = 300;
+
+    Integer pid;
+    ASSERT_EQ(NOERROR, mService->GetProcessId(&pid));
+    Integer sockets = CountSockets();
+
+    pthread_t threads[THREAD_NUMBER];
+    EchoCall calls[THREAD_NUMBER];
+    Long start = GetTimeMs();
+    for (Integer i = 0; i < THREAD_NUMBER; i++) {
+        // The later threads reply first.
+        calls[i] = { mService, i + 100, DELAY_MS * (THREAD_NUMBER - i) / THREAD_NUMBER, 0, NOERROR };
+        ASSERT_EQ(0, pthread_create(&threads[i], nullptr, CallEchoLater, &calls[i]));
+    }
+    for (Integer i = 0; i < THREAD_NUMBER; i++) {
+        pthread_join(threads[i], nullptr);
+        EXPECT_EQ(NOERROR, calls[i].mEc);
+        EXPECT_EQ(i + 100, calls[i].mResult);
+    }
+    Long elapsed = GetTimeMs() - start;
+
+    // One after the other they would take more than 1.3s.
+    EXPECT_LT(elapsed, DELAY_MS * 2);
+    EXPECT_EQ(sockets, CountSockets());
+}
+
+// Arguments of 64KB go through a lane, whose memfd is handed over to
+// the service as SCM_RIGHTS.
+TEST_F(SocketTransportTest, TestPassFileDescriptor)
+{
+    EXPECT_EQ(0, GetLaneInode(mProcess.GetPid()));
+
+    Array<Byte> data(64 * 1024);
+    Long expected = 0;
+    for (Long i = 0; i < data.GetLength(); i++) {
+        data[i] = (Byte)(i * 7);
+        expected += data[i];
+    }
+    Long sum;
+    EXPECT_EQ(NOERROR, mService->Sum(data, &sum));
+    EXPECT_EQ(expected, sum);
+
+    unsigned long inode = GetLaneInode(mProcess.GetPid());
+    EXPECT_NE(0, inode);
+    EXPECT_TRUE(MapsLane(getpid(), inode));
+}
+
+// Arguments well under 64KB stay on the socket, odd sizes from 64KB
+// on go through the lane. The threshold counts the whole marshalled
+// arguments, not only the array.
+TEST_F(SocketTransportTest, TestLaneThreshold)
+{
+    Array<Byte> small(60 * 1024);
+    Long expected = FillBytes(small, 1);
+    Long sum;
+    EXPECT_EQ(NOERROR, mService->Sum(small, &sum));
+    EXPECT_EQ(expected, sum);
+    EXPECT_EQ(0, GetLaneInode(mProcess.GetPid()));
+
+    Long sizes[] = { 64 * 1024, 64 * 1024 + 17, 200 * 1024 + 3 };
+    for (Long size : sizes) {
+        Array<Byte> data(size);
+        expected = FillBytes(data, (Integer)size);
+        EXPECT_EQ(NOERROR, mService->Sum(data, &sum));
+        EXPECT_EQ(expected, sum);
+    }
+    EXPECT_NE(0, GetLaneInode(mProcess.GetPid()));
+}
+
+// Payloads larger than half a ring are split into several records,
+// which the service puts together while the client writes the rest.
+TEST_F(SocketTransportTest, TestSplitRecords)
+{
+    Long sizes[] = { 3 * 1024 * 1024, 10 * 1024 * 1024 + 5 };
+    for (Long size : sizes) {
+        Array<Byte> data(size);
+        Long expected = FillBytes(data, (Integer)(size >> 10));
+        Long sum;
+        EXPECT_EQ(NOERROR, mService->Sum(data, &sum));
+        EXPECT_EQ(expected, sum);
+    }
+    EXPECT_NE(0, GetLaneInode(mProcess.GetPid()));
+}
+
+// Replies come back through the lane too, in place when they fit in
+// one record and split when they don't.
+TEST_F(SocketTransportTest, TestLargeReplies)
+{
+    Long sizes[] = { 64 * 1024, 1024 * 1024 + 1, 3 * 1024 * 1024 };
+    for (Long size : sizes) {
+        Array<Byte> data(size);
+        FillBytes(data, (Integer)size);
+        ExpectReversed(mService, data);
+    }
+}
+
+// Records of sizes which don't divide the ring end past its end sooner
+// or later, so both rings get pad records and wrap.
+TEST_F(SocketTransportTest, TestRingWrap)
+{
+    for (Integer i = 0; i < 8; i++) {
+        Array<Byte> data(1536 * 1024 + i * 4099);
+        Long expected = FillBytes(data, i);
+        Long sum;
+        EXPECT_EQ(NOERROR, mService->Sum(data, &sum));
+        EXPECT_EQ(expected, sum);
+        ExpectReversed(mService, data);
+    }
+}
+
+// A large call which finds the lane taken by another one goes over the
+// socket and doesn't wait for the lane.
+TEST_F(SocketTransportTest, TestBusyLaneFallsBack)
+{
+    static constexpr Integer DELAY_MS = 800;
+
+    SumCall call = { mService, Array<Byte>(2 * 1024 * 1024), DELAY_MS, 0, NOERROR };
+    Long slowExpected = FillBytes(call.mData, 3);
+    pthread_t thread;
+    ASSERT_EQ(0, pthread_create(&thread, nullptr, CallSumLater, &call));
+    usleep(150 * 1000);
+
+    Array<Byte> data(1024 * 1024);
+    Long expected = FillBytes(data, 4);
+    Long start = GetTimeMs();
+    Long sum;
+    EXPECT_EQ(NOERROR, mService->Sum(data, &sum));
+    EXPECT_EQ(expected, sum);
+    EXPECT_LT(GetTimeMs() - start, DELAY_MS / 2);
+
+    pthread_join(thread, nullptr);
+    EXPECT_EQ(NOERROR, call.mEc);
+    EXPECT_EQ(slowExpected, call.mSum);
+}
+
+// A peer which stops in the middle of a frame holds up no other one.
+TEST_F(SocketTransportTest, TestStalledPeer)
+{
+    Integer result;
+    ASSERT_EQ(NOERROR, mService->Echo(1, &result));
+
+    int fd = ConnectToService(mProcess.GetPid());
+    ASSERT_GE(fd, 0);
+    char partial[8];
+    memset(partial, 0, sizeof(partial));
+    ASSERT_EQ((ssize_t)sizeof(partial), write(fd, partial, sizeof(partial)));
+    usleep(100 * 1000);
+
+    Long start = GetTimeMs();
+    EXPECT_EQ(NOERROR, mService->Echo(2, &result));
+    EXPECT_EQ(2, result);
+    EXPECT_LT(GetTimeMs() - start, 1000);
+    close(fd);
+}
+
+// The service hangs up on processes of other users.
+TEST_F(SocketTransportTest, TestRefuseOtherUser)
+{
+    if (geteuid() != 0) {
+        // Only root can try it as somebody else.
+        GTEST_SKIP();
+    }
+
+    pid_t service = mProcess.GetPid();
+    pid_t pid = fork();
+    if (pid == 0) {
+        if (setgid(65534) != 0 || setuid(65534) != 0) {
+            _exit(2);
+        }
+        int fd = ConnectToService(service);
+        if (fd < 0) {
+            _exit(3);
+        }
+        struct pollfd pfd;
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        char c;
+        _exit(poll(&pfd, 1, 2000) == 1 && read(fd, &c, 1) == 0 ? 0 : 1);
+    }
+    ASSERT_GT(pid, 0);
+    int status;
+    ASSERT_EQ(pid, waitpid(pid, &status, 0));
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(0, WEXITSTATUS(status));
+
+    Integer result;
+    EXPECT_EQ(NOERROR, mService->Echo(3, &result));
+}
+
+TEST_F(SocketTransportTest, TestPeerDiesMidCall)
+{
+    Integer result;
+    ASSERT_EQ(NOERROR, mService->Echo(1, &result));
+
+    EchoCall call = { mService, 2, 10000, 0, NOERROR };
+    pthread_t thread;
+    ASSERT_EQ(0, pthread_create(&thread, nullptr, CallEchoLater, &call));
+    usleep(200 * 1000);
+    Long start = GetTimeMs();
+    mProcess.Kill();
+    pthread_join(thread, nullptr);
+
+    // The pending call fails as soon as the connection breaks.
+    EXPECT_EQ(E_REMOTE_EXCEPTION, call.mEc);
+    EXPECT_LT(GetTimeMs() - start, 2000);
+    Boolean alive;
+    IProxy::Probe(mService)->IsStubAlive(&alive);
+    EXPECT_FALSE(alive);
+    EXPECT_TRUE(FAILED(mService->Echo(3, &result)));
+}
+
+// Local RPC takes the socket transport if CCM_RPC_TRANSPORT says so
+// when ccmrt is loaded, so the test runs itself again with it set.
+int main(int argc, char** argv)
+{
+    const char* transport = getenv("CCM_RPC_TRANSPORT");
+    if (transport == nullptr || strcmp(transport, "socket")) {
+        setenv("CCM_RPC_TRANSPORT", "socket", 1);
+        execv("/proc/self/exe", argv);
+        fprintf(stderr, "Run the test again failed.\n");
+        return 1;
+    }
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,170 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CChannelTest.h"
+#include <string.h>
+#include <unistd.h>
+
+namespace ccm {
+namespace test {
+namespace rpcchannel {
+
+CCM_INTERFACE_IMPL_1(CChannelTest, Object, IChannelTest);
+CCM_OBJECT_IMPL(CChannelTest);
+
+ECode CChannelTest::Echo(
+    /* [in] */ Integer value,
+    /* [out] */ Integer* result)
+{
+    VALIDATE_NOT_NULL(result);
+
+    *result = value;
+    return NOERROR;
+}
+
+ECode CChannelTest::EchoLater(
+    /* [in] */ Integer value,
+    /* [in] */ Integer milliseconds,
+    /* [out] */ Integer* result)
+{
+    VALIDATE_NOT_NULL(result);
+
+    usleep(milliseconds * 1000);
+    *result = value;
+    return NOERROR;
+}
+
+ECode CChannelTest::GetProcessId(
+    /* [out] */ Integer* pid)
+{
+    VALIDATE_NOT_NULL(pid);
+
+    *pid = getpid();
+    return NOERROR;
+}
+
+ECode CChannelTest::Sum(
+    /* [in] */ const Array<Byte>& data,
+    /* [out] */ Long* sum)
+{
+    VALIDATE_NOT_NULL(sum);
+
+    Long value = 0;
+    for (Long i = 0; i < data.GetLength(); i++) {
+        value += data[i];
+    }
+    *sum = value;
+    return NOERROR;
+}
+
+ECode CChannelTest::SumLater(
+    /* [in] */ const Array<Byte>& data,
+    /* [in] */ Integer milliseconds,
+    /* [out] */ Long* sum)
+{
+    usleep(milliseconds * 1000);
+    return Sum(data, sum);
+}
+
+ECode CChannelTest::Reverse(
+    /* [in] */ const Array<Byte>& data,
+    /* [out, callee] */ Array<Byte>* reversed)
+{
+    VALIDATE_NOT_NULL(reversed);
+
+    Long length = data.GetLength();
+    Array<Byte> bytes(length);
+    for (Long i = 0; i < length; i++) {
+        bytes[i] = data[length - 1 - i];
+    }
+    *reversed = bytes;
+    return NOERROR;
+}
+
+ECode CChannelTest::Post(
+    /* [in] */ Integer value,
+    /* [in] */ Integer milliseconds)
+{
+    usleep(milliseconds * 1000);
+    // The sum first, so a reader which sees the number sees the value.
+    mPostSum += value;
+    mPostNumber++;
+    return NOERROR;
+}
+
+ECode CChannelTest::GetPosts(
+    /* [out] */ Integer* number,
+    /* [out] */ Long* sum)
+{
+    VALIDATE_NOT_NULL(number);
+    VALIDATE_NOT_NULL(sum);
+
+    *number = mPostNumber;
+    *sum = mPostSum;
+    return NOERROR;
+}
+
+ECode CChannelTest::Relay(
+    /* [in] */ Integer type,
+    /* [in] */ const Array<Byte>& peer,
+    /* [in] */ Integer depth,
+    /* [out] */ Integer* pid)
+{
+    VALIDATE_NOT_NULL(pid);
+
+    if (depth <= 0) {
+        return GetProcessId(pid);
+    }
+
+    AutoPtr<IParcel> parcel;
+    CoCreateParcel((RPCType)type, &parcel);
+    parcel->SetData(peer.GetPayload(), peer.GetLength());
+    AutoPtr<IInterfacePack> ipack;
+    CoCreateInterfacePack((RPCType)type, &ipack);
+    ECode ec = ipack->ReadFromParcel(parcel);
+    if (FAILED(ec)) {
+        return ec;
+    }
+    AutoPtr<IInterface> obj;
+    ec = CoUnmarshalInterface((RPCType)type, ipack, &obj);
+    if (FAILED(ec)) {
+        return ec;
+    }
+    IChannelTest* next = IChannelTest::Probe(obj);
+    if (next == nullptr) {
+        return E_INTERFACE_NOT_FOUND_EXCEPTION;
+    }
+
+    ipack = nullptr;
+    ec = CoMarshalInterface((IChannelTest*)this, (RPCType)type, &ipack);
+    if (FAILED(ec)) {
+        return ec;
+    }
+    parcel = nullptr;
+    CoCreateParcel((RPCType)type, &parcel);
+    ipack->WriteToParcel(parcel);
+    HANDLE data;
+    Long size;
+    parcel->GetData(&data);
+    parcel->GetDataSize(&size);
+    Array<Byte> self(size);
+    memcpy(self.GetPayload(), reinterpret_cast<void*>(data), size);
+    return next->Relay(type, self, depth - 1, pid);
+}
+
+}
+}
+}
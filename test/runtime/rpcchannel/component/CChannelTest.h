@@ -0,0 +1,86 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#ifndef __CCM_TEST_RPCCHANNEL_CCHANNELTEST_H__
+#define __CCM_TEST_RPCCHANNEL_CCHANNELTEST_H__
+
+#include <ccmapi.h>
+#include <ccmobject.h>
+#include "_ccm_test_rpcchannel_CChannelTest.h"
+#include <atomic>
+
+namespace ccm {
+namespace test {
+namespace rpcchannel {
+
+Coclass(CChannelTest)
+    , public Object
+    , public IChannelTest
+{
+public:
+    CCM_INTERFACE_DECL();
+
+    CCM_OBJECT_DECL();
+
+    ECode Echo(
+        /* [in] */ Integer value,
+        /* [out] */ Integer* result) override;
+
+    ECode EchoLater(
+        /* [in] */ Integer value,
+        /* [in] */ Integer milliseconds,
+        /* [out] */ Integer* result) override;
+
+    ECode GetProcessId(
+        /* [out] */ Integer* pid) override;
+
+    ECode Sum(
+        /* [in] */ const Array<Byte>& data,
+        /* [out] */ Long* sum) override;
+
+    ECode SumLater(
+        /* [in] */ const Array<Byte>& data,
+        /* [in] */ Integer milliseconds,
+        /* [out] */ Long* sum) override;
+
+    ECode Reverse(
+        /* [in] */ const Array<Byte>& data,
+        /* [out, callee] */ Array<Byte>* reversed) override;
+
+    ECode Post(
+        /* [in] */ Integer value,
+        /* [in] */ Integer milliseconds) override;
+
+    ECode GetPosts(
+        /* [out] */ Integer* number,
+        /* [out] */ Long* sum) override;
+
+    ECode Relay(
+        /* [in] */ Integer type,
+        /* [in] */ const Array<Byte>& peer,
+        /* [in] */ Integer depth,
+        /* [out] */ Integer* pid) override;
+
+private:
+    std::atomic<Integer> mPostNumber { 0 };
+    std::atomic<Long> mPostSum { 0 };
+};
+
+}
+}
+}
+
+#endif // __CCM_TEST_RPCCHANNEL_CCHANNELTEST_H__
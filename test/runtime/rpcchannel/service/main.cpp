@@ -0,0 +1,91 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "RPCChannelTestUnit.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+using ccm::test::rpcchannel::CChannelTest;
+using ccm::test::rpcchannel::IChannelTest;
+using ccm::test::rpcchannel::IID_IChannelTest;
+
+static Boolean WriteFully(
+    /* [in] */ int fd,
+    /* [in] */ const void* data,
+    /* [in] */ size_t size)
+{
+    const char* p = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t ret = write(fd, p, size);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            return false;
+        }
+        p += ret;
+        size -= ret;
+    }
+    return true;
+}
+
+// Run by the rpcchannel tests: exports a CChannelTest, writes its marshaled
+// interface pack to <pack fd> and serves it until <control fd> is closed.
+int main(int argc, char** argv)
+{
+    if (argc != 4) {
+        fprintf(stderr, "Usage: testRPCChannelSrv local|remote <pack fd> <control fd>\n");
+        return 1;
+    }
+    RPCType type = !strcmp(argv[1], "remote") ? RPCType::Remote : RPCType::Local;
+    int packFd = atoi(argv[2]);
+    int controlFd = atoi(argv[3]);
+
+    CoSetRPCThreadPoolSize(16);
+
+    AutoPtr<IChannelTest> obj;
+    CChannelTest::New(IID_IChannelTest, (IInterface**)&obj);
+    AutoPtr<IInterfacePack> ipack;
+    CoMarshalInterface(obj, type, &ipack);
+    CoSetConcurrentInvocation(obj, type, true);
+    AutoPtr<IParcel> parcel;
+    CoCreateParcel(type, &parcel);
+    ipack->WriteToParcel(parcel);
+
+    HANDLE data;
+    Long size;
+    parcel->GetData(&data);
+    parcel->GetDataSize(&size);
+    if (!WriteFully(packFd, &size, sizeof(size)) ||
+            !WriteFully(packFd, reinterpret_cast<void*>(data), size)) {
+        return 1;
+    }
+    close(packFd);
+
+    // The client closes the control pipe when it is done, or dies.
+    char c;
+    ssize_t ret;
+    do {
+        ret = read(controlFd, &c, 1);
+    } while (ret > 0 || (ret < 0 && errno == EINTR));
+    return 0;
+}
@@ -0,0 +1,213 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmcomponent.h>
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+using namespace ccm;
+
+static Long Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Long)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+static constexpr Integer ROUNDS = 20;
+static constexpr Integer MAX_COMPONENTS = 64;
+static constexpr Integer STEPS = 3;
+
+static Integer sComponentNumber = 0;
+static char* sComponents[MAX_COMPONENTS];
+
+// Finds |name| in $COMPONENT_PATH the way the boot class loader does.
+static String Resolve(
+    /* [in] */ const char* name)
+{
+    if (strchr(name, '/') != nullptr) {
+        return String(name);
+    }
+    const char* env = getenv("COMPONENT_PATH");
+    char* dirs = strdup(env != nullptr ? env : ".");
+    String path(name);
+    char* saved;
+    for (char* dir = strtok_r(dirs, ":", &saved); dir != nullptr;
+            dir = strtok_r(nullptr, ":", &saved)) {
+        String candidate = String(dir) + "/" + name;
+        if (access(candidate.string(), R_OK) == 0) {
+            path = candidate;
+            break;
+        }
+    }
+    free(dirs);
+    return path;
+}
+
+// Runs |func| in a new process, so every round starts with nothing
+// loaded, and returns the |number| values it reports.
+template<typename Func>
+static Boolean RunInChild(
+    /* [in] */ Func func,
+    /* [out] */ Long* values,
+    /* [in] */ Integer number)
+{
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return false;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        Boolean succeeded = func(values);
+        if (succeeded) {
+            write(fds[1], values, sizeof(Long) * number);
+        }
+        _exit(succeeded ? 0 : 1);
+    }
+    close(fds[1]);
+    ssize_t size = pid > 0 ? read(fds[0], values, sizeof(Long) * number) : -1;
+    close(fds[0]);
+    int status;
+    if (pid > 0) {
+        waitpid(pid, &status, 0);
+    }
+    return size == (ssize_t)(sizeof(Long) * number);
+}
+
+// How long each component takes to be mapped, to have its metadata
+// found and to have its CMetaComponent built.
+static Boolean LoadSteps(
+    /* [out] */ Long* values)
+{
+    for (Integer i = 0; i < sComponentNumber; i++) {
+        String path = Resolve(sComponents[i]);
+        Long start = Now();
+        void* handle = dlopen(path.string(), RTLD_NOW);
+        if (handle == nullptr) {
+            fprintf(stderr, "%s\n", dlerror());
+            return false;
+        }
+        Long mapped = Now();
+        MetadataWrapper** wrapper = (MetadataWrapper**)dlsym(handle, "soMetadataHandle");
+        if (wrapper == nullptr || *wrapper == nullptr || (*wrapper)->mSize <= 0) {
+            fprintf(stderr, "%s has no metadata.\n", path.string());
+            return false;
+        }
+        Long found = Now();
+        AutoPtr<IMetaComponent> mc;
+        if (FAILED(CoGetComponentMetadataFromFile(
+                reinterpret_cast<HANDLE>(handle), nullptr, &mc))) {
+            return false;
+        }
+        Long built = Now();
+        values[i * STEPS] = mapped - start;
+        values[i * STEPS + 1] = found - mapped;
+        values[i * STEPS + 2] = built - found;
+    }
+    return true;
+}
+
+static Boolean LoadSerially(
+    /* [out] */ Long* values)
+{
+    Long start = Now();
+    for (Integer i = 0; i < sComponentNumber; i++) {
+        if (FAILED(CoPreloadComponents(sComponents[i], true))) {
+            return false;
+        }
+    }
+    values[0] = Now() - start;
+    return true;
+}
+
+static Boolean LoadInParallel(
+    /* [out] */ Long* values)
+{
+    String list;
+    for (Integer i = 0; i < sComponentNumber; i++) {
+        list = i == 0 ? String(sComponents[i]) : list + ":" + sComponents[i];
+    }
+    Long start = Now();
+    if (FAILED(CoPreloadComponents(list.string(), true))) {
+        return false;
+    }
+    values[0] = Now() - start;
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    const char* env = getenv("CCM_PRELOAD");
+    char* list = strdup(argc > 1 ? "" : (env != nullptr && env[0] != '\0') ?
+            env : "FooBarDemo.so:NewObjectTestUnit.so");
+    char* saved;
+    for (char* name = strtok_r(list, ":", &saved); name != nullptr &&
+            sComponentNumber < MAX_COMPONENTS; name = strtok_r(nullptr, ":", &saved)) {
+        sComponents[sComponentNumber++] = name;
+    }
+    for (Integer i = 1; i < argc && sComponentNumber < MAX_COMPONENTS; i++) {
+        sComponents[sComponentNumber++] = argv[i];
+    }
+    // Only the listed components may be loaded by the rounds.
+    unsetenv("CCM_PRELOAD");
+
+    Long steps[MAX_COMPONENTS * STEPS];
+    Long totals[MAX_COMPONENTS * STEPS] = { 0 };
+    for (Integer round = 0; round < ROUNDS; round++) {
+        if (!RunInChild(LoadSteps, steps, sComponentNumber * STEPS)) {
+            printf("Loading the components failed.\n");
+            return 1;
+        }
+        for (Integer i = 0; i < sComponentNumber * STEPS; i++) {
+            totals[i] += steps[i];
+        }
+    }
+    printf("%-32s %12s %12s %16s\n", "component", "dlopen", "metadata", "CMetaComponent");
+    for (Integer i = 0; i < sComponentNumber; i++) {
+        printf("%-32s %9.1f us %9.1f us %13.1f us\n", sComponents[i],
+                totals[i * STEPS] / ROUNDS / 1000.0,
+                totals[i * STEPS + 1] / ROUNDS / 1000.0,
+                totals[i * STEPS + 2] / ROUNDS / 1000.0);
+    }
+
+    Long serial = 0, parallel = 0, value;
+    for (Integer round = 0; round < ROUNDS; round++) {
+        if (!RunInChild(LoadSerially, &value, 1)) {
+            printf("Preloading the components failed.\n");
+            return 1;
+        }
+        serial += value;
+        if (!RunInChild(LoadInParallel, &value, 1)) {
+            printf("Preloading the components failed.\n");
+            return 1;
+        }
+        parallel += value;
+    }
+    printf("%-32s %9.1f us\n", "preload one by one", serial / ROUNDS / 1000.0);
+    printf("%-32s %9.1f us\n", "preload in parallel", parallel / ROUNDS / 1000.0);
+
+    free(list);
+    return 0;
+}
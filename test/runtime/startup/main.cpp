@@ -0,0 +1,80 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+using namespace ccm;
+
+// Run from the bin directory, where the class loader finds the test
+// components by default.
+static Boolean IsLoaded(
+    /* [in] */ const char* name)
+{
+    char* cwd = getcwd(nullptr, 0);
+    String path = String(cwd) + "/" + name;
+    free(cwd);
+    void* handle = dlopen(path.string(), RTLD_NOW | RTLD_NOLOAD);
+    if (handle == nullptr) {
+        return false;
+    }
+    dlclose(handle);
+    return true;
+}
+
+// These run in order and share the process; each uses components the
+// ones before it have not loaded.
+TEST(StartupTest, TestLoadDoesNotPreload)
+{
+    ASSERT_FALSE(IsLoaded("FooBarDemo.so"));
+    ASSERT_FALSE(IsLoaded("NewObjectTestUnit.so"));
+    setenv("CCM_PRELOAD", "NewObjectTestUnit.so", 1);
+
+    char* cwd = getcwd(nullptr, 0);
+    String path = String(cwd) + "/FooBarDemo.so";
+    free(cwd);
+    AutoPtr<IMetaComponent> mc;
+    EXPECT_EQ(NOERROR, CoGetBootClassLoader()->LoadComponent(path, &mc));
+    EXPECT_NE(nullptr, mc);
+    EXPECT_TRUE(IsLoaded("FooBarDemo.so"));
+    EXPECT_FALSE(IsLoaded("NewObjectTestUnit.so"));
+}
+
+TEST(StartupTest, TestPreloadEnvComponents)
+{
+    EXPECT_EQ(NOERROR, CoPreloadComponents(nullptr, true));
+    EXPECT_TRUE(IsLoaded("NewObjectTestUnit.so"));
+
+    // $CCM_PRELOAD is only read the first time.
+    setenv("CCM_PRELOAD", "RefCountTestUnit.so", 1);
+    EXPECT_EQ(NOERROR, CoPreloadComponents(nullptr, true));
+    EXPECT_FALSE(IsLoaded("RefCountTestUnit.so"));
+    unsetenv("CCM_PRELOAD");
+}
+
+TEST(StartupTest, TestPreloadList)
+{
+    // Missing and empty entries are skipped, loaded ones left alone.
+    EXPECT_EQ(NOERROR, CoPreloadComponents(
+            "::NoSuchComponent.so:FooBarDemo.so:RefCountTestUnit.so:", true));
+    EXPECT_TRUE(IsLoaded("RefCountTestUnit.so"));
+    EXPECT_FALSE(IsLoaded("NoSuchComponent.so"));
+    EXPECT_EQ(NOERROR, CoPreloadComponents("RefCountTestUnit.so", true));
+}
@@ -0,0 +1,148 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmobject.h>
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+using namespace ccm;
+
+// Every allocation made by the runtime goes through these.
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t number, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+
+static Long sAllocations = 0;
+
+extern "C" void* malloc(size_t size)
+{
+    __atomic_add_fetch(&sAllocations, 1, __ATOMIC_RELAXED);
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t number, size_t size)
+{
+    __atomic_add_fetch(&sAllocations, 1, __ATOMIC_RELAXED);
+    return __libc_calloc(number, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size)
+{
+    __atomic_add_fetch(&sAllocations, 1, __ATOMIC_RELAXED);
+    return __libc_realloc(ptr, size);
+}
+
+static Long Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Long)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+static constexpr Integer ROUNDS = 200000;
+
+// Prints the allocations and the time |func| takes per call.
+template<typename Func>
+static void Measure(
+    /* [in] */ const char* name,
+    /* [in] */ Func func)
+{
+    func();
+    Long allocations = __atomic_load_n(&sAllocations, __ATOMIC_RELAXED);
+    Long start = Now();
+    for (Integer i = 0; i < ROUNDS; i++) {
+        func();
+    }
+    Long nanos = Now() - start;
+    allocations = __atomic_load_n(&sAllocations, __ATOMIC_RELAXED) - allocations;
+    printf("%-40s %6.2f allocs/op %8.1f ns/op\n", name,
+            (double)allocations / ROUNDS, (double)nanos / ROUNDS);
+}
+
+static void MeasureReflection(
+    /* [in] */ const char* componentPath)
+{
+    void* handle = dlopen(componentPath, RTLD_NOW);
+    if (handle == nullptr) {
+        printf("skip reflection, %s\n", dlerror());
+        return;
+    }
+    AutoPtr<IMetaComponent> mc;
+    if (FAILED(CoGetComponentMetadataFromFile(reinterpret_cast<HANDLE>(handle), nullptr, &mc))) {
+        printf("skip reflection, no metadata in %s\n", componentPath);
+        return;
+    }
+
+    Integer number;
+    mc->GetCoclassNumber(&number);
+    Array<IMetaCoclass*> klasses(number);
+    mc->GetAllCoclasses(klasses);
+    if (number == 0) return;
+
+    String name, ns;
+    klasses[0]->GetName(&name);
+    klasses[0]->GetNamespace(&ns);
+    String fullName = ns + name;
+    const char* literal = fullName.string();
+
+    Measure("GetCoclass(String(name))", [&]() {
+        AutoPtr<IMetaCoclass> klass;
+        mc->GetCoclass(String(literal), &klass);
+    });
+    Measure("GetCoclass(String::Intern(name))", [&]() {
+        AutoPtr<IMetaCoclass> klass;
+        mc->GetCoclass(String::Intern(literal), &klass);
+    });
+    Measure("IMetaCoclass::GetName", [&]() {
+        String n;
+        klasses[0]->GetName(&n);
+    });
+}
+
+int main(int argc, char** argv)
+{
+    Measure("String(\"x\")", []() {
+        String s("x");
+    });
+    Measure("String::ValueOf('x')", []() {
+        String s = String::ValueOf('x');
+    });
+    Measure("String(\"ccm::demo::CFoo\")", []() {
+        String s("ccm::demo::CFoo");
+    });
+    Measure("String::Intern(\"ccm::demo::CFoo\")", []() {
+        String s = String::Intern("ccm::demo::CFoo");
+    });
+
+    // What the generated New does per object, less the constructor.
+    Measure("new Object, coclass name String()", []() {
+        AutoPtr<Object> object = new Object();
+        object->AttachMetadata(nullptr, String("ccm::demo::CFoo"));
+    });
+    Measure("new Object, coclass name Intern()", []() {
+        AutoPtr<Object> object = new Object();
+        object->AttachMetadata(nullptr, String::Intern("ccm::demo::CFoo"));
+    });
+
+    MeasureReflection(argc > 1 ? argv[1] : "FooBarDemo.so");
+    return 0;
+}
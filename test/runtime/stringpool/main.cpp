@@ -0,0 +1,127 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <ccmobject.h>
+#include <dlfcn.h>
+#include <gtest/gtest.h>
+
+using namespace ccm;
+
+// Every allocation made by the runtime goes through these.
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t number, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+
+static Long sAllocations = 0;
+
+extern "C" void* malloc(size_t size)
+{
+    __atomic_add_fetch(&sAllocations, 1, __ATOMIC_RELAXED);
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t number, size_t size)
+{
+    __atomic_add_fetch(&sAllocations, 1, __ATOMIC_RELAXED);
+    return __libc_calloc(number, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size)
+{
+    __atomic_add_fetch(&sAllocations, 1, __ATOMIC_RELAXED);
+    return __libc_realloc(ptr, size);
+}
+
+// Returns the allocations |func| makes once it has run one time.
+template<typename Func>
+static Long CountAllocations(
+    /* [in] */ Func func)
+{
+    func();
+    Long allocations = __atomic_load_n(&sAllocations, __ATOMIC_RELAXED);
+    func();
+    return __atomic_load_n(&sAllocations, __ATOMIC_RELAXED) - allocations;
+}
+
+TEST(StringPoolTest, TestOneCharStringNoAllocation)
+{
+    EXPECT_EQ(0, CountAllocations([]() {
+        String s("x");
+    }));
+    EXPECT_EQ(0, CountAllocations([]() {
+        String s = String::ValueOf('x');
+    }));
+    String s = String::ValueOf('x');
+    EXPECT_STREQ("x", s.string());
+    EXPECT_EQ(1, s.GetByteLength());
+}
+
+TEST(StringPoolTest, TestInternSharesBuffer)
+{
+    String first = String::Intern("ccm::test::CStringPool");
+    String second = String::Intern(String("ccm::test::CStringPool"));
+    EXPECT_STREQ("ccm::test::CStringPool", first.string());
+    EXPECT_EQ(first.string(), second.string());
+    EXPECT_EQ(0, CountAllocations([]() {
+        String s = String::Intern("ccm::test::CStringPool");
+    }));
+}
+
+TEST(StringPoolTest, TestCoclassNameShared)
+{
+    // Objects hold the interned name, so naming one copies nothing.
+    Long plain = CountAllocations([]() {
+        AutoPtr<Object> object = new Object();
+    });
+    Long named = CountAllocations([]() {
+        AutoPtr<Object> object = new Object();
+        object->AttachMetadata(nullptr, String::Intern("ccm::test::CStringPool"));
+    });
+    EXPECT_EQ(plain, named);
+}
+
+TEST(StringPoolTest, TestGetCoclassByInternedName)
+{
+    void* handle = dlopen("FooBarDemo.so", RTLD_NOW);
+    ASSERT_NE(nullptr, handle) << dlerror();
+    AutoPtr<IMetaComponent> mc;
+    ASSERT_EQ(NOERROR, CoGetComponentMetadataFromFile(
+            reinterpret_cast<HANDLE>(handle), nullptr, &mc));
+
+    Integer number;
+    mc->GetCoclassNumber(&number);
+    ASSERT_GT(number, 0);
+    Array<IMetaCoclass*> klasses(number);
+    mc->GetAllCoclasses(klasses);
+    String name, ns;
+    klasses[0]->GetName(&name);
+    klasses[0]->GetNamespace(&ns);
+    String fullName = String::Intern(ns + name);
+
+    AutoPtr<IMetaCoclass> klass;
+    EXPECT_EQ(NOERROR, mc->GetCoclass(fullName, &klass));
+    EXPECT_EQ(klasses[0], klass.Get());
+    EXPECT_EQ(0, CountAllocations([&]() {
+        AutoPtr<IMetaCoclass> k;
+        mc->GetCoclass(fullName, &k);
+    }));
+
+    AutoPtr<Object> object = new Object();
+    object->AttachMetadata(mc, ns + name);
+    EXPECT_EQ(klasses[0], Object::GetCoclass((IObject*)object.Get()).Get());
+}
@@ -0,0 +1,133 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "UnloadTestUnit.h"
+#include <ccmapi.h>
+#include <ccmautoptr.h>
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+using namespace ccm;
+using ccm::test::unload::CValueFactory;
+using ccm::test::unload::IValue;
+using ccm::test::unload::IValueFactory;
+using ccm::test::unload::IID_IValueFactory;
+
+// The class loader finds the component in the working directory, so
+// this runs from the bin directory.
+static String GetComponentPath()
+{
+    char* cwd = getcwd(nullptr, 0);
+    String path = String(cwd) + "/UnloadTestUnit.so";
+    free(cwd);
+    return path;
+}
+
+static Boolean IsLoaded()
+{
+    void* handle = dlopen(GetComponentPath().string(), RTLD_NOW | RTLD_NOLOAD);
+    if (handle == nullptr) {
+        return false;
+    }
+    dlclose(handle);
+    return true;
+}
+
+static ECode Unload()
+{
+    AutoPtr<IMetaComponent> mc;
+    ECode ec = CoGetBootClassLoader()->LoadComponent(GetComponentPath(), &mc);
+    if (FAILED(ec)) {
+        return ec;
+    }
+    return mc->Unload();
+}
+
+static AutoPtr<IValue> ValueOf(
+    /* [in] */ Integer value)
+{
+    AutoPtr<IValueFactory> factory;
+    CValueFactory::New(IID_IValueFactory, (IInterface**)&factory);
+    AutoPtr<IValue> object;
+    if (factory != nullptr) {
+        factory->ValueOf(value, &object);
+    }
+    return object;
+}
+
+TEST(UnloadTest, TestUnloadWithCachedObjects)
+{
+    AutoPtr<IValue> first = ValueOf(1);
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ(first, ValueOf(1));
+    EXPECT_NE(ValueOf(100), ValueOf(100));
+    first = nullptr;
+    ASSERT_TRUE(IsLoaded());
+
+    EXPECT_EQ(NOERROR, Unload());
+    EXPECT_FALSE(IsLoaded());
+}
+
+TEST(UnloadTest, TestUnloadWhileObjectHeld)
+{
+    AutoPtr<IValue> held = ValueOf(1);
+    ASSERT_NE(nullptr, held);
+    EXPECT_EQ(E_COMPONENT_UNLOAD_EXCEPTION, Unload());
+    EXPECT_TRUE(IsLoaded());
+
+    // The cache was dropped and fills again with new objects.
+    Integer value;
+    EXPECT_EQ(NOERROR, held->GetValue(&value));
+    EXPECT_EQ(1, value);
+    AutoPtr<IValue> again = ValueOf(1);
+    EXPECT_NE(held, again);
+    EXPECT_EQ(again, ValueOf(1));
+
+    held = nullptr;
+    again = nullptr;
+    EXPECT_EQ(NOERROR, Unload());
+    EXPECT_FALSE(IsLoaded());
+}
+
+TEST(UnloadTest, TestMetadataOutlivesUnload)
+{
+    AutoPtr<IMetaComponent> mc;
+    ASSERT_EQ(NOERROR, CoGetBootClassLoader()->LoadComponent(GetComponentPath(), &mc));
+    AutoPtr<IMetaCoclass> klass;
+    mc->GetCoclass(String("ccm::test::unload::CValueFactory"), &klass);
+    ASSERT_NE(nullptr, klass);
+    EXPECT_EQ(NOERROR, mc->Unload());
+
+    // The metadata is read where the component is mapped, so it stays
+    // mapped as long as the metadata objects are referenced.
+    EXPECT_TRUE(IsLoaded());
+    {
+        Integer number = 0;
+        klass->GetMethodNumber(&number);
+        ASSERT_GT(number, 0);
+        Array<IMetaMethod*> methods(number);
+        klass->GetAllMethods(methods);
+        String name;
+        methods[number - 1]->GetName(&name);
+        EXPECT_STREQ("ValueOf", name.string());
+    }
+
+    klass = nullptr;
+    mc = nullptr;
+    EXPECT_FALSE(IsLoaded());
+}
@@ -0,0 +1,98 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "CValue.h"
+
+namespace ccm {
+namespace test {
+namespace unload {
+
+CCM_INTERFACE_IMPL_1(CValue, Object, IValue);
+
+IValue* CValue::sCache[CACHE_SIZE];
+Spinlock CValue::sCacheLock;
+
+ECode CValue::Constructor(
+    /* [in] */ Integer value)
+{
+    mValue = value;
+    return NOERROR;
+}
+
+AutoPtr<IValue> CValue::ValueOf(
+    /* [in] */ Integer value)
+{
+    AutoPtr<IValue> obj;
+    if (value < 0 || value >= CACHE_SIZE) {
+        CValue::New(value, IID_IValue, (IInterface**)&obj);
+        return obj;
+    }
+
+    // ReleaseCache() may drop a cached object at any time, so the
+    // reference to it is taken under the cache lock.
+    IValue** slot = &sCache[value];
+    sCacheLock.Lock();
+    obj = *slot;
+    sCacheLock.Unlock();
+    if (obj != nullptr) {
+        return obj;
+    }
+
+    CValue::New(value, IID_IValue, (IInterface**)&obj);
+    AutoPtr<IValue> cached;
+    sCacheLock.Lock();
+    if (*slot == nullptr) {
+        *slot = obj;
+        REFCOUNT_ADD(*slot);
+    }
+    else {
+        cached = *slot;
+    }
+    sCacheLock.Unlock();
+    return cached != nullptr ? cached : obj;
+}
+
+void CValue::ReleaseCache()
+{
+    IValue* cache[CACHE_SIZE];
+    sCacheLock.Lock();
+    for (Integer i = 0; i < CACHE_SIZE; i++) {
+        cache[i] = sCache[i];
+        sCache[i] = nullptr;
+    }
+    sCacheLock.Unlock();
+    for (Integer i = 0; i < CACHE_SIZE; i++) {
+        REFCOUNT_RELEASE(cache[i]);
+    }
+}
+
+ECode CValue::GetValue(
+    /* [out] */ Integer* value)
+{
+    VALIDATE_NOT_NULL(value);
+
+    *value = mValue;
+    return NOERROR;
+}
+
+}
+}
+}
+
+EXTERN_C COM_PUBLIC void soReleaseCaches()
+{
+    ccm::test::unload::CValue::ReleaseCache();
+}
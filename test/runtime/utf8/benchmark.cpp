@@ -0,0 +1,143 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+
+#include "ccmutf8.h"
+#include <ccmtypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+using namespace ccm;
+
+static const char* ISA_NAMES[] = { "scalar", "sse2", "avx2" };
+
+struct Corpus
+{
+    const char* mName;
+    char* mData;
+    Integer mByteSize;
+};
+
+static Long Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Long)ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
+
+// Repeats |pieces| at random up to |byteSize| bytes.
+static Corpus MakeCorpus(
+    /* [in] */ const char* name,
+    /* [in] */ const char* const* pieces,
+    /* [in] */ Integer pieceNumber,
+    /* [in] */ Integer byteSize)
+{
+    Corpus corpus;
+    corpus.mName = name;
+    corpus.mData = (char*)malloc(byteSize + 1);
+    Integer size = 0;
+    unsigned int seed = 1;
+    while (true) {
+        seed = seed * 1103515245 + 12345;
+        const char* piece = pieces[(seed >> 16) % pieceNumber];
+        Integer length = strlen(piece);
+        if (size + length > byteSize) break;
+        memcpy(corpus.mData + size, piece, length);
+        size += length;
+    }
+    corpus.mData[size] = '\0';
+    corpus.mByteSize = size;
+    return corpus;
+}
+
+// Prints the throughput of |func| in bytes per nanosecond.
+template<typename Func>
+static void Measure(
+    /* [in] */ const char* kernel,
+    /* [in] */ const char* isa,
+    /* [in] */ const Corpus& corpus,
+    /* [in] */ Func func)
+{
+    Integer rounds = 1 + (64 << 20) / (corpus.mByteSize + 1);
+    Long sink = 0;
+    Long start = Now();
+    for (Integer i = 0; i < rounds; i++) {
+        sink += func();
+    }
+    Long nanos = Now() - start;
+    printf("%-14s %-7s %-8s %8d bytes %9.3f GB/s  (%lld)\n", kernel, isa,
+            corpus.mName, corpus.mByteSize,
+            (double)corpus.mByteSize * rounds / nanos, sink);
+}
+
+int main(int argc, char** argv)
+{
+    static const char* const ASCII[] = { "the ", "quick ", "brown ", "fox, ", "jumps\n" };
+    static const char* const LATIN[] = { "caf\xc3\xa9 ", "na\xc3\xafve ", "stra\xc3\x9f" "e ", "word " };
+    static const char* const CJK[] = { "\xe4\xb8\xad", "\xe6\x96\x87", "\xe5\xad\x97", "\xe3\x80\x82" };
+    static const char* const EMOJI[] = { "ok ", "\xf0\x9f\x98\x80", "\xe2\x9c\x93", "go " };
+
+    Integer sizes[] = { 64, 4096, 1 << 20 };
+    Corpus corpora[12];
+    Integer corpusNumber = 0;
+    for (Integer size : sizes) {
+        corpora[corpusNumber++] = MakeCorpus("ascii", ASCII, 5, size);
+        corpora[corpusNumber++] = MakeCorpus("latin", LATIN, 4, size);
+        corpora[corpusNumber++] = MakeCorpus("cjk", CJK, 4, size);
+        corpora[corpusNumber++] = MakeCorpus("emoji", EMOJI, 4, size);
+    }
+
+    Short* utf16 = (Short*)malloc(sizeof(Short) * ((1 << 20) + 32));
+    Char* utf32 = (Char*)malloc(sizeof(Char) * ((1 << 20) + 32));
+    for (Integer n = 0; n < corpusNumber; n++) {
+        const Corpus& corpus = corpora[n];
+        const char* data = corpus.mData;
+        Integer size = corpus.mByteSize;
+
+        for (Integer isa = 0; isa <= (Integer)UTF8::GetBestISA(); isa++) {
+            UTF8::Select((UTF8::ISA)isa);
+            Measure("CountChars", ISA_NAMES[isa], corpus, [&]() {
+                Boolean b;
+                return UTF8::CountChars(data, size, &b);
+            });
+            Measure("CountUTF16", ISA_NAMES[isa], corpus, [&]() {
+                return UTF8::CountUTF16Units(data, size);
+            });
+            Measure("ToUTF16", ISA_NAMES[isa], corpus, [&]() {
+                return UTF8::ToUTF16(data, size, utf16);
+            });
+            Measure("ToUTF32", ISA_NAMES[isa], corpus, [&]() {
+                return UTF8::ToUTF32(data, size, utf32);
+            });
+        }
+
+        // What a regex Matcher pays to get at the input, with the
+        // kernels the runtime picked.
+        String string(data);
+        Measure("GetUTF16Chars", "runtime", corpus, [&]() {
+            return string.GetUTF16Chars().GetLength();
+        });
+    }
+
+    for (Integer n = 0; n < corpusNumber; n++) {
+        free(corpora[n].mData);
+    }
+    free(utf16);
+    free(utf32);
+    return 0;
+}
@@ -0,0 +1,139 @@
+//=========================================================================
+// Copyright (C) 2018 The C++ Component Model(CCM) Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//=========================================================================
+
+#include "ccmutf8.h"
+#include <ccmstring.h>
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace ccm;
+
+// "a", "é", "中", "😀" and "b": one to four bytes a char.
+static const char MIXED[] = "a\xc3\xa9\xe4\xb8\xad\xf0\x9f\x98\x80" "b";
+
+static Integer BestISA()
+{
+    return (Integer)UTF8::GetBestISA();
+}
+
+TEST(UTF8Test, CountTest)
+{
+    for (Integer isa = 0; isa <= BestISA(); isa++) {
+        ASSERT_TRUE(UTF8::Select((UTF8::ISA)isa));
+        Boolean ascii;
+        EXPECT_EQ(5, UTF8::CountChars(MIXED, strlen(MIXED), &ascii));
+        EXPECT_FALSE(ascii);
+        EXPECT_EQ(6, UTF8::CountUTF16Units(MIXED, strlen(MIXED)));
+        EXPECT_EQ(3, UTF8::CountChars("abc", 3, &ascii));
+        EXPECT_TRUE(ascii);
+        EXPECT_EQ(0, UTF8::CountChars("", 0, &ascii));
+    }
+    UTF8::Select(UTF8::GetBestISA());
+}
+
+TEST(UTF8Test, TranscodeTest)
+{
+    for (Integer isa = 0; isa <= BestISA(); isa++) {
+        ASSERT_TRUE(UTF8::Select((UTF8::ISA)isa));
+        Short utf16[8];
+        ASSERT_EQ(6, UTF8::ToUTF16(MIXED, strlen(MIXED), utf16));
+        EXPECT_EQ('a', utf16[0]);
+        EXPECT_EQ(0xe9, utf16[1]);
+        EXPECT_EQ(0x4e2d, utf16[2]);
+        EXPECT_EQ((Short)0xd83d, utf16[3]);
+        EXPECT_EQ((Short)0xde00, utf16[4]);
+        EXPECT_EQ('b', utf16[5]);
+
+        Char utf32[8];
+        ASSERT_EQ(5, UTF8::ToUTF32(MIXED, strlen(MIXED), utf32));
+        EXPECT_EQ('a', utf32[0]);
+        EXPECT_EQ(0xe9, utf32[1]);
+        EXPECT_EQ(0x4e2d, utf32[2]);
+        EXPECT_EQ(0x1f600, utf32[3]);
+        EXPECT_EQ('b', utf32[4]);
+    }
+    UTF8::Select(UTF8::GetBestISA());
+}
+
+TEST(UTF8Test, StopTest)
+{
+    // The walk stops at a '\0', an invalid leading byte and a
+    // truncated sequence, however far into a vector they are.
+    char text[128];
+    for (Integer isa = 0; isa <= BestISA(); isa++) {
+        ASSERT_TRUE(UTF8::Select((UTF8::ISA)isa));
+        for (Integer stop = 0; stop < 100; stop++) {
+            Boolean ascii;
+            memset(text, 'x', sizeof(text));
+            text[stop] = '\0';
+            EXPECT_EQ(stop, UTF8::CountChars(text, sizeof(text), &ascii));
+            text[stop] = (char)0xff;
+            EXPECT_EQ(stop, UTF8::CountChars(text, sizeof(text), &ascii));
+            EXPECT_EQ(stop, UTF8::CountUTF16Units(text, sizeof(text)));
+            memcpy(text + stop, "\xe4\xb8", 2);
+            EXPECT_EQ(stop, UTF8::CountChars(text, stop + 2, &ascii));
+        }
+    }
+    UTF8::Select(UTF8::GetBestISA());
+}
+
+TEST(UTF8Test, KernelsAgreeTest)
+{
+    // Every length up to a few vectors, cut from repeated mixed text at
+    // every offset, must give what the scalar walk gives.
+    static constexpr Integer SIZE = 200;
+    char text[SIZE + 1];
+    for (Integer i = 0; i < SIZE; i += strlen(MIXED)) {
+        strncpy(text + i, MIXED, SIZE - i);
+    }
+    text[SIZE] = '\0';
+
+    Short expected16[SIZE], utf16[SIZE];
+    Char expected32[SIZE], utf32[SIZE];
+    for (Integer start = 0; start < 16; start++) {
+        for (Integer size = 0; start + size <= SIZE; size++) {
+            const char* data = text + start;
+            UTF8::Select(UTF8::ISA::Scalar);
+            Boolean expectedASCII;
+            Integer chars = UTF8::CountChars(data, size, &expectedASCII);
+            Integer units = UTF8::CountUTF16Units(data, size);
+            ASSERT_EQ(units, UTF8::ToUTF16(data, size, expected16));
+            ASSERT_EQ(chars, UTF8::ToUTF32(data, size, expected32));
+
+            for (Integer isa = 1; isa <= BestISA(); isa++) {
+                ASSERT_TRUE(UTF8::Select((UTF8::ISA)isa));
+                Boolean ascii;
+                ASSERT_EQ(chars, UTF8::CountChars(data, size, &ascii));
+                ASSERT_EQ(expectedASCII, ascii);
+                ASSERT_EQ(units, UTF8::CountUTF16Units(data, size));
+                ASSERT_EQ(units, UTF8::ToUTF16(data, size, utf16));
+                ASSERT_EQ(0, memcmp(expected16, utf16, sizeof(Short) * units));
+                ASSERT_EQ(chars, UTF8::ToUTF32(data, size, utf32));
+                ASSERT_EQ(0, memcmp(expected32, utf32, sizeof(Char) * chars));
+            }
+        }
+    }
+    UTF8::Select(UTF8::GetBestISA());
+}
+
+TEST(UTF8Test, StringTest)
+{
+    String string(MIXED);
+    EXPECT_EQ(5, string.GetLength());
+    EXPECT_EQ(6, string.GetUTF16Chars().GetLength());
+    EXPECT_EQ(0x1f600, string.GetChar(3));
+}